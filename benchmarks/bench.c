@@ -0,0 +1,298 @@
+/*
+ * bench.c — Minimal microbenchmark harness for xboing_bench.
+ *
+ * See benchmarks/bench.h for API documentation.
+ */
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* =========================================================================
+ * Internal state
+ * ========================================================================= */
+
+struct bench
+{
+    uint64_t iterations;
+    uint64_t elapsed_ns; /* Accumulated between start/stop pairs */
+    uint64_t started_ns; /* Nonzero while the timer runs */
+};
+
+/* Upper bound on calibrated iterations, so a benchmark that does nothing
+ * measurable still terminates. */
+#define BENCH_MAX_ITERATIONS 1000000000ULL
+
+static volatile int bench_sink_value;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* One call of fn with `iters` operations; returns timed nanoseconds. */
+static uint64_t run_once(bench_fn fn, void *arg, uint64_t iters)
+{
+    bench_t b = {.iterations = iters};
+    fn(&b, arg);
+    if (b.started_ns != 0)
+    {
+        bench_timer_stop(&b);
+    }
+    return b.elapsed_ns;
+}
+
+/* =========================================================================
+ * Public API — Running benchmarks
+ * ========================================================================= */
+
+void bench_config_init(bench_config_t *config)
+{
+    if (config == NULL)
+    {
+        return;
+    }
+    config->min_time_ns = BENCH_DEFAULT_MIN_TIME_NS;
+    config->reps = BENCH_DEFAULT_REPS;
+}
+
+bench_status_t bench_run(const bench_config_t *config, const char *name, bench_fn fn, void *arg,
+                         bench_result_t *out)
+{
+    if (name == NULL || fn == NULL || out == NULL)
+    {
+        return BENCH_ERR_NULL_ARG;
+    }
+
+    bench_config_t cfg;
+    bench_config_init(&cfg);
+    if (config != NULL)
+    {
+        cfg = *config;
+    }
+    if (cfg.reps < 1)
+    {
+        cfg.reps = 1;
+    }
+
+    /* Calibrate: grow the count until one run reaches min_time_ns. */
+    uint64_t iters = 1;
+    for (;;)
+    {
+        uint64_t ns = run_once(fn, arg, iters);
+        if (ns >= cfg.min_time_ns || iters >= BENCH_MAX_ITERATIONS)
+        {
+            break;
+        }
+        uint64_t next = iters * 2;
+        if (ns > 0)
+        {
+            /* Aim 20% past the target so the next run usually suffices. */
+            double scaled = (double)iters * (double)cfg.min_time_ns * 1.2 / (double)ns;
+            if (scaled > (double)next)
+            {
+                next = (scaled < (double)BENCH_MAX_ITERATIONS) ? (uint64_t)scaled
+                                                                : BENCH_MAX_ITERATIONS;
+            }
+        }
+        iters = (next < BENCH_MAX_ITERATIONS) ? next : BENCH_MAX_ITERATIONS;
+    }
+
+    /* Interference from the rest of the machine only ever adds time, so
+     * the fastest run is the most repeatable estimate. */
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < cfg.reps; r++)
+    {
+        uint64_t ns = run_once(fn, arg, iters);
+        if (ns < best)
+        {
+            best = ns;
+        }
+    }
+
+    memset(out, 0, sizeof(*out));
+    snprintf(out->name, sizeof(out->name), "%s", name);
+    out->iterations = iters;
+    out->ns_per_op = (double)best / (double)iters;
+    return BENCH_OK;
+}
+
+uint64_t bench_iterations(const bench_t *b)
+{
+    return (b != NULL) ? b->iterations : 0;
+}
+
+void bench_timer_start(bench_t *b)
+{
+    if (b != NULL && b->started_ns == 0)
+    {
+        b->started_ns = now_ns();
+    }
+}
+
+void bench_timer_stop(bench_t *b)
+{
+    if (b != NULL && b->started_ns != 0)
+    {
+        b->elapsed_ns += now_ns() - b->started_ns;
+        b->started_ns = 0;
+    }
+}
+
+void bench_sink(int value)
+{
+    bench_sink_value = value;
+}
+
+/* =========================================================================
+ * Public API — JSON output and baselines
+ * ========================================================================= */
+
+bench_status_t bench_write_json(FILE *out, const bench_result_t *results, int count)
+{
+    if (out == NULL || (results == NULL && count > 0))
+    {
+        return BENCH_ERR_NULL_ARG;
+    }
+
+    fprintf(out, "{\n  \"benchmarks\": [\n");
+    for (int i = 0; i < count; i++)
+    {
+        fprintf(out, "    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f}%s\n",
+                results[i].name, (unsigned long long)results[i].iterations, results[i].ns_per_op,
+                (i + 1 < count) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    return ferror(out) ? BENCH_ERR_IO : BENCH_OK;
+}
+
+bench_status_t bench_read_baseline(const char *path, bench_result_t *out, int max, int *count)
+{
+    if (path == NULL || out == NULL || count == NULL)
+    {
+        return BENCH_ERR_NULL_ARG;
+    }
+    *count = 0;
+
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+    {
+        return BENCH_ERR_IO;
+    }
+
+    /* One entry per line, exactly as bench_write_json lays them out. */
+    char line[512];
+    bench_status_t st = BENCH_OK;
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        const char *key = strstr(line, "\"name\": \"");
+        if (key == NULL)
+        {
+            continue;
+        }
+        const char *name = key + strlen("\"name\": \"");
+        const char *end = strchr(name, '"');
+        const char *ns = strstr(line, "\"ns_per_op\": ");
+        if (end == NULL || ns == NULL || (size_t)(end - name) >= BENCH_NAME_MAX)
+        {
+            st = BENCH_ERR_PARSE;
+            break;
+        }
+        if (*count >= max)
+        {
+            st = BENCH_ERR_FULL;
+            break;
+        }
+
+        bench_result_t *r = &out[*count];
+        memset(r, 0, sizeof(*r));
+        memcpy(r->name, name, (size_t)(end - name));
+
+        char *num_end = NULL;
+        r->ns_per_op = strtod(ns + strlen("\"ns_per_op\": "), &num_end);
+        if (num_end == ns + strlen("\"ns_per_op\": "))
+        {
+            st = BENCH_ERR_PARSE;
+            break;
+        }
+        const char *it = strstr(line, "\"iterations\": ");
+        if (it != NULL)
+        {
+            r->iterations = strtoull(it + strlen("\"iterations\": "), NULL, 10);
+        }
+        (*count)++;
+    }
+
+    if (st == BENCH_OK && ferror(fp))
+    {
+        st = BENCH_ERR_IO;
+    }
+    fclose(fp);
+    return st;
+}
+
+int bench_compare(const bench_result_t *results, int count, const bench_result_t *baseline,
+                  int baseline_count, double tolerance_pct, FILE *report)
+{
+    if (results == NULL || (baseline == NULL && baseline_count > 0))
+    {
+        return 0;
+    }
+
+    int regressions = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const bench_result_t *base = NULL;
+        for (int j = 0; j < baseline_count; j++)
+        {
+            if (strcmp(baseline[j].name, results[i].name) == 0)
+            {
+                base = &baseline[j];
+                break;
+            }
+        }
+
+        if (base == NULL || base->ns_per_op <= 0.0)
+        {
+            if (report != NULL)
+            {
+                fprintf(report, "%-44s %10.2f ns/op  (new)\n", results[i].name,
+                        results[i].ns_per_op);
+            }
+            continue;
+        }
+
+        double delta_pct = (results[i].ns_per_op / base->ns_per_op - 1.0) * 100.0;
+        int regressed = delta_pct > tolerance_pct;
+        regressions += regressed;
+        if (report != NULL)
+        {
+            fprintf(report, "%-44s %10.2f ns/op  baseline %10.2f  %+7.1f%%%s\n",
+                    results[i].name, results[i].ns_per_op, base->ns_per_op, delta_pct,
+                    regressed ? "  REGRESSED" : "");
+        }
+    }
+    return regressions;
+}
+
+const char *bench_status_string(bench_status_t status)
+{
+    switch (status)
+    {
+        case BENCH_OK:
+            return "OK";
+        case BENCH_ERR_NULL_ARG:
+            return "NULL argument";
+        case BENCH_ERR_IO:
+            return "I/O error";
+        case BENCH_ERR_PARSE:
+            return "malformed baseline";
+        case BENCH_ERR_FULL:
+            return "too many results";
+    }
+    return "unknown status";
+}
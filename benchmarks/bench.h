@@ -0,0 +1,119 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+ * bench.h — Minimal microbenchmark harness for xboing_bench.
+ *
+ * A benchmark is a function that performs bench_iterations() operations
+ * between bench_timer_start() and bench_timer_stop().  Setup and any
+ * periodic state resets go outside the timed region (stop, reset,
+ * start again).  bench_run() first grows the iteration count until one
+ * run takes at least min_time_ns, then times `reps` runs at that count
+ * and reports the fastest as ns/op.
+ *
+ * Results are written as JSON and can be compared against a stored
+ * baseline of the same format; a benchmark regresses when its ns/op
+ * exceeds the baseline by more than a tolerance in percent.
+ *
+ * No dependency on SDL2 or cmocka.  See ADR-081 in docs/DESIGN.md.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+#define BENCH_NAME_MAX 64 /* Including NUL */
+#define BENCH_MAX_RESULTS 64
+
+#define BENCH_DEFAULT_MIN_TIME_NS 50000000ULL /* 50 ms per timed run */
+#define BENCH_DEFAULT_REPS 5
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    BENCH_OK = 0,
+    BENCH_ERR_NULL_ARG,
+    BENCH_ERR_IO,    /* File could not be opened, read or written */
+    BENCH_ERR_PARSE, /* Baseline file is not in the format bench_write_json emits */
+    BENCH_ERR_FULL   /* More than the caller's array can hold */
+} bench_status_t;
+
+/* =========================================================================
+ * Types
+ * ========================================================================= */
+
+typedef struct bench bench_t;
+
+/* Run bench_iterations(b) operations; `arg` is passed through from bench_run. */
+typedef void (*bench_fn)(bench_t *b, void *arg);
+
+typedef struct
+{
+    uint64_t min_time_ns; /* Minimum duration of one timed run */
+    int reps;             /* Timed runs; the fastest is reported */
+} bench_config_t;
+
+typedef struct
+{
+    char name[BENCH_NAME_MAX];
+    uint64_t iterations; /* Operations per timed run */
+    double ns_per_op;    /* Fastest of the runs */
+} bench_result_t;
+
+/* =========================================================================
+ * Running benchmarks
+ * ========================================================================= */
+
+/* Fill *config with BENCH_DEFAULT_MIN_TIME_NS and BENCH_DEFAULT_REPS. */
+void bench_config_init(bench_config_t *config);
+
+/*
+ * Calibrate and time `fn`, storing the result under `name` (truncated to
+ * BENCH_NAME_MAX - 1).  config may be NULL for defaults.
+ */
+bench_status_t bench_run(const bench_config_t *config, const char *name, bench_fn fn, void *arg,
+                         bench_result_t *out);
+
+/* Operations the benchmark function must perform this call. */
+uint64_t bench_iterations(const bench_t *b);
+
+/* Start / stop the timer.  Time between a stop and the next start is not counted. */
+void bench_timer_start(bench_t *b);
+void bench_timer_stop(bench_t *b);
+
+/* Consume a value so the compiler cannot discard the work producing it. */
+void bench_sink(int value);
+
+/* =========================================================================
+ * JSON output and baselines
+ * ========================================================================= */
+
+/* Write results as {"benchmarks": [{"name", "iterations", "ns_per_op"}, ...]}. */
+bench_status_t bench_write_json(FILE *out, const bench_result_t *results, int count);
+
+/*
+ * Read a file written by bench_write_json into out[0..max-1].
+ * Sets *count to the number of entries read.
+ */
+bench_status_t bench_read_baseline(const char *path, bench_result_t *out, int max, int *count);
+
+/*
+ * Compare results against a baseline and print one line per benchmark
+ * to `report` (may be NULL).  A benchmark regresses when its ns/op is
+ * more than tolerance_pct percent above the baseline entry of the same
+ * name; benchmarks missing from the baseline are reported as new and
+ * never fail.  Returns the number of regressions.
+ */
+int bench_compare(const bench_result_t *results, int count, const bench_result_t *baseline,
+                  int baseline_count, double tolerance_pct, FILE *report);
+
+/* Return a human-readable string for a status code. */
+const char *bench_status_string(bench_status_t status);
+
+#endif /* BENCH_H */
@@ -0,0 +1,215 @@
+/*
+ * render_bench.c — CPU cost of game_render_frame.
+ *
+ * Builds the full game context the way the integration tests do (SDL
+ * dummy video driver), puts it in a fixed state and times one
+ * game_render_frame per op:
+ *
+ *   render_frame/game     level 1 in play, a few hundred ticks in
+ *   render_frame/intro    the attract-mode block legend
+ *
+ * What is measured is the game's side of a frame (sprite lookups, layout,
+ * text, SDL call overhead) plus whatever the dummy driver's renderer does
+ * with the draws.  The numbers depend on that renderer, so they are not
+ * part of benchmarks/baseline.json.
+ *
+ * Usage:
+ *   SDL_VIDEODRIVER=dummy ./xboing_render_bench [-json FILE] [-filter SUBSTR]
+ *                                               [-min-time MS] [-reps N]
+ *
+ * Output follows xboing_bench: JSON to stdout, or a table when -json
+ * names a file.  See ADR-086 in docs/DESIGN.md.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "game_context.h"
+#include "game_init.h"
+#include "game_render.h"
+#include "parse_util.h"
+#include "sdl2_input.h"
+#include "sdl2_state.h"
+
+/* Ticks run before timing, so balls and blocks are mid-level. */
+#define GAME_WARMUP_TICKS 300
+#define INTRO_WARMUP_TICKS 120
+
+typedef struct
+{
+    const bench_config_t *config;
+    const char *filter;
+    bench_result_t results[BENCH_MAX_RESULTS];
+    int count;
+} run_state_t;
+
+static void bench_render_frame(bench_t *b, void *arg)
+{
+    const game_ctx_t *ctx = arg;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < bench_iterations(b); i++)
+    {
+        game_render_frame(ctx);
+    }
+    bench_timer_stop(b);
+}
+
+static void run(run_state_t *rs, const char *name, bench_fn fn, void *arg)
+{
+    if (rs->filter != NULL && strstr(name, rs->filter) == NULL)
+    {
+        return;
+    }
+    if (rs->count >= BENCH_MAX_RESULTS)
+    {
+        return;
+    }
+    if (bench_run(rs->config, name, fn, arg, &rs->results[rs->count]) == BENCH_OK)
+    {
+        rs->count++;
+    }
+}
+
+static void tick_frames(game_ctx_t *ctx, int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        sdl2_input_begin_frame(ctx->input);
+        sdl2_state_update(ctx->state);
+    }
+}
+
+/* Fresh context in the given mode, ticked forward.  NULL on failure. */
+static game_ctx_t *fixture_create(sdl2_state_mode_t mode, int warmup)
+{
+    static char arg_prog[] = "xboing_render_bench";
+    static char arg_nosound[] = "-nosound";
+    char *argv[] = {arg_prog, arg_nosound, NULL};
+
+    game_ctx_t *ctx = game_create(2, argv);
+    if (ctx == NULL)
+    {
+        return NULL;
+    }
+    sdl2_state_transition(ctx->state, mode);
+    tick_frames(ctx, warmup);
+    return ctx;
+}
+
+static int run_all(run_state_t *rs)
+{
+    static const struct
+    {
+        const char *name;
+        sdl2_state_mode_t mode;
+        int warmup;
+    } cases[] = {
+        {"render_frame/game", SDL2ST_GAME, GAME_WARMUP_TICKS},
+        {"render_frame/intro", SDL2ST_INTRO, INTRO_WARMUP_TICKS},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        if (rs->filter != NULL && strstr(cases[i].name, rs->filter) == NULL)
+        {
+            continue;
+        }
+        game_ctx_t *ctx = fixture_create(cases[i].mode, cases[i].warmup);
+        if (ctx == NULL)
+        {
+            return -1;
+        }
+        run(rs, cases[i].name, bench_render_frame, ctx);
+        game_destroy(ctx);
+    }
+    return 0;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-json FILE] [-filter SUBSTR] [-min-time MS] [-reps N]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *json_path = NULL;
+    int min_time_ms = (int)(BENCH_DEFAULT_MIN_TIME_NS / 1000000ULL);
+
+    bench_config_t config;
+    bench_config_init(&config);
+
+    run_state_t rs;
+    memset(&rs, 0, sizeof(rs));
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (val == NULL)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+
+        if (strcmp(arg, "-json") == 0)
+        {
+            json_path = val;
+        }
+        else if (strcmp(arg, "-filter") == 0)
+        {
+            rs.filter = val;
+        }
+        else if (strcmp(arg, "-min-time") == 0)
+        {
+            if (!parse_int_in_range(val, 1, 60000, &min_time_ms))
+            {
+                fprintf(stderr, "xboing_render_bench: bad -min-time '%s'\n", val);
+                return 1;
+            }
+        }
+        else if (strcmp(arg, "-reps") == 0)
+        {
+            if (!parse_int_in_range(val, 1, 1000, &config.reps))
+            {
+                fprintf(stderr, "xboing_render_bench: bad -reps '%s'\n", val);
+                return 1;
+            }
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    config.min_time_ns = (uint64_t)min_time_ms * UINT64_C(1000000);
+    rs.config = &config;
+
+    if (run_all(&rs) != 0)
+    {
+        fprintf(stderr, "xboing_render_bench: game_create failed (is SDL_VIDEODRIVER=dummy?)\n");
+        return 1;
+    }
+
+    if (json_path == NULL)
+    {
+        return bench_write_json(stdout, rs.results, rs.count) == BENCH_OK ? 0 : 1;
+    }
+
+    FILE *fp = fopen(json_path, "w");
+    bench_status_t st = (fp != NULL) ? bench_write_json(fp, rs.results, rs.count) : BENCH_ERR_IO;
+    if (fp != NULL && fclose(fp) != 0)
+    {
+        st = BENCH_ERR_IO;
+    }
+    if (st != BENCH_OK)
+    {
+        fprintf(stderr, "xboing_render_bench: %s: %s\n", json_path, bench_status_string(st));
+        return 1;
+    }
+    (void)bench_compare(rs.results, rs.count, NULL, 0, 0.0, stdout);
+    return 0;
+}
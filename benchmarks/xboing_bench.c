@@ -0,0 +1,715 @@
+/*
+ * xboing_bench.c — microbenchmarks for the gameplay hot paths.
+ *
+ * Times the per-tick system calls a level spends its time in, each in
+ * isolation with fixed inputs, and reports ns/op as JSON:
+ *
+ *   ball_update/N               ball_system_update, N = 1..MAX_BALLS balls
+ *                               bouncing in a sparse block field, reading
+ *                               block windows through get_window
+ *   ball_update_cells/N         the same, probing cells through check_region
+ *   ball_will_collide           ball_math_will_collide on a fixed set of pairs
+ *   block_check_region/GRID     block_system_check_region_bbox, one cell probe
+ *   block_still_active/GRID     block_system_still_active, the level-complete check
+ *   block_update_movement/GRID  block_system_update_movement, one tick
+ *   block_advance_anim/GRID     block_system_advance_animations, one tick
+ *   gun_update/full             gun_system_update, GUN_MAX_BULLETS in flight
+ *
+ * GRID is `dense` (every cell above the paddle rows filled, roamers,
+ * drops and animated blocks mixed in) or `sparse` (about one cell in
+ * seven).  State that a benchmark consumes — balls drifting, bullets
+ * leaving the top, blocks moving — is restored from a snapshot outside
+ * the timed region, so every op measures the same steady state.
+ *
+ * Usage:
+ *   ./xboing_bench [-json FILE] [-baseline FILE] [-tolerance PCT]
+ *                  [-filter SUBSTR] [-min-time MS] [-reps N]
+ *
+ * Results go to stdout as JSON unless -json names a file, in which case
+ * a table is printed instead.  With -baseline, each result is compared
+ * against the stored one of the same name and the exit status is 2 if
+ * any is more than PCT percent (default 25) slower.
+ * Exit status is 0 on success, 1 on a usage or I/O error.
+ *
+ * See ADR-081 and ADR-082 in docs/DESIGN.md.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ball_math.h"
+#include "ball_system.h"
+#include "bench.h"
+#include "block_system.h"
+#include "block_types.h"
+#include "gun_system.h"
+#include "parse_util.h"
+#include "rng.h"
+
+#define BENCH_DEFAULT_TOLERANCE 25
+
+/* Production playfield, matching the test fixtures. */
+#define PLAY_WIDTH 495
+#define PLAY_HEIGHT 580
+#define COL_WIDTH 55
+#define ROW_HEIGHT 32
+#define SPEED_LEVEL 5
+
+/* Ops between snapshot restores for benchmarks that drift. */
+#define BALL_RESET_OPS 1024
+#define BLOCK_RESET_OPS 1024
+#define GUN_RESET_OPS 60
+
+#define BENCH_SEED 20261016
+
+/* =========================================================================
+ * Fixtures
+ * ========================================================================= */
+
+typedef enum
+{
+    GRID_DENSE,
+    GRID_SPARSE
+} grid_kind_t;
+
+/* Cycled through the cells of a grid: mostly plain blocks, with the types
+ * advance_animations and update_movement do per-cell work for. */
+static const int grid_types[] = {
+    RED_BLK,       BLUE_BLK, GREEN_BLK,   TAN_BLK,    YELLOW_BLK, PURPLE_BLK, BONUS_BLK,
+    BONUSX2_BLK,   RED_BLK,  DEATH_BLK,   ROAMER_BLK, GREEN_BLK,  DROP_BLK,   EXTRABALL_BLK,
+    BONUSX4_BLK,   TAN_BLK,  COUNTER_BLK, BLUE_BLK,   ROAMER_BLK, RANDOM_BLK,
+};
+
+#define GRID_TYPE_COUNT ((int)(sizeof(grid_types) / sizeof(grid_types[0])))
+
+/* Rows a level fills; the bottom rows stay clear for the paddle. */
+#define GRID_ROWS (MAX_ROW - 4)
+
+static int fixture_rand(void *ud)
+{
+    return rng_next((rng_t *)ud);
+}
+
+static void fill_grid(block_system_t *blocks, grid_kind_t kind)
+{
+    int n = 0;
+    for (int r = 0; r < GRID_ROWS; r++)
+    {
+        for (int c = 0; c < MAX_COL; c++)
+        {
+            if (kind == GRID_SPARSE && (r * 5 + c * 3) % 7 != 0)
+            {
+                continue;
+            }
+            (void)block_system_add(blocks, r, c, grid_types[n % GRID_TYPE_COUNT], 3, 0);
+            n++;
+        }
+    }
+}
+
+static const char *grid_name(grid_kind_t kind)
+{
+    return (kind == GRID_DENSE) ? "dense" : "sparse";
+}
+
+/* --- Balls --- */
+
+typedef struct
+{
+    rng_t rng;
+    block_system_t *blocks;
+    ball_system_t *balls;
+    ball_system_env_t env;
+    int nballs;
+} ball_fixture_t;
+
+static int ball_fixture_check_region(int row, int col, int bx, int by, int bdx, void *ud)
+{
+    ball_fixture_t *fx = ud;
+    return block_system_check_region_bbox(row, col, bx, by, bdx, fx->blocks);
+}
+
+static int ball_fixture_get_window(int row, int col, block_window_t *out, void *ud)
+{
+    ball_fixture_t *fx = ud;
+    return block_system_get_window(row, col, out, fx->blocks);
+}
+
+static int ball_fixture_rand(void *ud)
+{
+    ball_fixture_t *fx = ud;
+    return rng_next(&fx->rng);
+}
+
+/* Balls bounce off indestructible sparse blocks and a paddle as wide as
+ * the playfield, so none is ever lost between resets.  With use_window
+ * the balls read block windows the way the game does; without it they
+ * probe cell by cell through check_region, for comparison. */
+static int ball_fixture_init(ball_fixture_t *fx, int nballs, int use_window)
+{
+    memset(fx, 0, sizeof(*fx));
+    rng_seed(&fx->rng, BENCH_SEED);
+    fx->nballs = nballs;
+
+    fx->blocks = block_system_create(COL_WIDTH, ROW_HEIGHT, fixture_rand, &fx->rng, NULL);
+    ball_system_callbacks_t cbs = {.check_region = ball_fixture_check_region};
+    if (use_window)
+    {
+        cbs.get_window = ball_fixture_get_window;
+    }
+    fx->balls = ball_system_create(&cbs, fx, ball_fixture_rand, NULL);
+    if (fx->blocks == NULL || fx->balls == NULL)
+    {
+        return -1;
+    }
+    fill_grid(fx->blocks, GRID_SPARSE);
+
+    fx->env = (ball_system_env_t){
+        .speed_level = SPEED_LEVEL,
+        .paddle_pos = PLAY_WIDTH / 2,
+        .paddle_size = PLAY_WIDTH * 2,
+        .play_width = PLAY_WIDTH,
+        .play_height = PLAY_HEIGHT,
+        .col_width = COL_WIDTH,
+        .row_height = ROW_HEIGHT,
+    };
+
+    for (int i = 0; i < nballs; i++)
+    {
+        int dx = (i % 2 == 0) ? 3 + i : -(3 + i);
+        (void)ball_system_restore(fx->balls, i, 0, 1, BALL_ACTIVE, 60 + i * 85, 500 - i * 8, dx,
+                                  -4, BALL_NONE);
+    }
+    return 0;
+}
+
+static void ball_fixture_free(ball_fixture_t *fx)
+{
+    ball_system_destroy(fx->balls);
+    block_system_destroy(fx->blocks);
+}
+
+static void bench_ball_update(bench_t *b, void *arg)
+{
+    ball_fixture_t *fx = arg;
+    size_t size = ball_system_snapshot_size();
+    void *snap = malloc(size);
+    if (snap == NULL)
+    {
+        return;
+    }
+    ball_system_snapshot_save(fx->balls, snap);
+    rng_t rng0 = fx->rng;
+
+    uint64_t n = bench_iterations(b);
+    int frame = 0;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < n; i++)
+    {
+        if (i % BALL_RESET_OPS == BALL_RESET_OPS - 1)
+        {
+            bench_timer_stop(b);
+            ball_system_snapshot_load(fx->balls, snap);
+            fx->rng = rng0;
+            frame = 0;
+            bench_timer_start(b);
+        }
+        /* Every op is a physics tick: balls move on BALL_FRAME_RATE frames. */
+        frame += BALL_FRAME_RATE;
+        fx->env.frame = frame;
+        ball_system_update(fx->balls, &fx->env);
+    }
+    bench_timer_stop(b);
+
+    bench_sink(ball_system_get_active_count(fx->balls));
+    ball_system_snapshot_load(fx->balls, snap);
+    fx->rng = rng0;
+    free(snap);
+}
+
+/* --- Ball-to-ball collision --- */
+
+#define PAIR_COUNT 64
+
+typedef struct
+{
+    BALL a[PAIR_COUNT];
+    BALL b[PAIR_COUNT];
+    float eps;
+} pair_fixture_t;
+
+/* Pairs at assorted distances and headings; roughly half converge. */
+static void pair_fixture_init(pair_fixture_t *fx)
+{
+    memset(fx, 0, sizeof(*fx));
+    fx->eps = ball_math_init();
+    rng_t rng;
+    rng_seed(&rng, BENCH_SEED);
+    for (int i = 0; i < PAIR_COUNT; i++)
+    {
+        BALL *a = &fx->a[i];
+        BALL *o = &fx->b[i];
+        a->ballx = 100 + rng_next(&rng) % 300;
+        a->bally = 100 + rng_next(&rng) % 300;
+        o->ballx = a->ballx + rng_next(&rng) % 81 - 40;
+        o->bally = a->bally + rng_next(&rng) % 81 - 40;
+        a->dx = rng_next(&rng) % 15 - 7;
+        a->dy = rng_next(&rng) % 15 - 7;
+        o->dx = rng_next(&rng) % 15 - 7;
+        o->dy = rng_next(&rng) % 15 - 7;
+        a->radius = o->radius = BALL_WC;
+        a->mass = o->mass = 1.0f;
+    }
+}
+
+static void bench_will_collide(bench_t *b, void *arg)
+{
+    pair_fixture_t *fx = arg;
+    uint64_t n = bench_iterations(b);
+    int hits = 0;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < n; i++)
+    {
+        int p = (int)(i % PAIR_COUNT);
+        float t;
+        hits += ball_math_will_collide(&fx->a[p], &fx->b[p], &t, fx->eps);
+    }
+    bench_timer_stop(b);
+    bench_sink(hits);
+}
+
+/* --- Blocks --- */
+
+#define PROBE_COUNT 256
+
+typedef struct
+{
+    rng_t rng;
+    block_system_t *blocks;
+    block_system_ball_pos_t balls[MAX_BALLS];
+    int probe_row[PROBE_COUNT];
+    int probe_col[PROBE_COUNT];
+    int probe_x[PROBE_COUNT];
+    int probe_y[PROBE_COUNT];
+} block_fixture_t;
+
+static int block_fixture_init(block_fixture_t *fx, grid_kind_t kind)
+{
+    memset(fx, 0, sizeof(*fx));
+    rng_seed(&fx->rng, BENCH_SEED);
+    fx->blocks = block_system_create(COL_WIDTH, ROW_HEIGHT, fixture_rand, &fx->rng, NULL);
+    if (fx->blocks == NULL)
+    {
+        return -1;
+    }
+    fill_grid(fx->blocks, kind);
+
+    /* Balls among the blocks, as update_movement sees them mid-level. */
+    for (int i = 0; i < MAX_BALLS; i++)
+    {
+        fx->balls[i] = (block_system_ball_pos_t){1, 40 + i * 100, 120 + i * 60};
+    }
+
+    /* Probes: a ball somewhere in the block area against the cell it is
+     * in, the way ball_system walks the cells around each ball. */
+    rng_t rng;
+    rng_seed(&rng, BENCH_SEED + 1);
+    for (int i = 0; i < PROBE_COUNT; i++)
+    {
+        fx->probe_x[i] = rng_next(&rng) % PLAY_WIDTH;
+        fx->probe_y[i] = rng_next(&rng) % (GRID_ROWS * ROW_HEIGHT);
+        fx->probe_row[i] = fx->probe_y[i] / ROW_HEIGHT;
+        fx->probe_col[i] = fx->probe_x[i] / COL_WIDTH;
+    }
+    return 0;
+}
+
+static void bench_check_region(bench_t *b, void *arg)
+{
+    block_fixture_t *fx = arg;
+    uint64_t n = bench_iterations(b);
+    int hits = 0;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < n; i++)
+    {
+        int p = (int)(i % PROBE_COUNT);
+        hits += block_system_check_region_bbox(fx->probe_row[p], fx->probe_col[p], fx->probe_x[p],
+                                               fx->probe_y[p], 0, fx->blocks);
+    }
+    bench_timer_stop(b);
+    bench_sink(hits);
+}
+
+/* The level-complete check the game and the sim make every tick. */
+static void bench_still_active(bench_t *b, void *arg)
+{
+    const block_fixture_t *fx = arg;
+    uint64_t n = bench_iterations(b);
+    int active = 0;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < n; i++)
+    {
+        active += block_system_still_active(fx->blocks);
+    }
+    bench_timer_stop(b);
+    bench_sink(active);
+}
+
+/* Shared driver for the two per-tick block passes. */
+static void run_block_ticks(bench_t *b, block_fixture_t *fx, int movement)
+{
+    size_t size = block_system_snapshot_size();
+    void *snap = malloc(size);
+    if (snap == NULL)
+    {
+        return;
+    }
+    block_system_snapshot_save(fx->blocks, snap);
+    rng_t rng0 = fx->rng;
+
+    uint64_t n = bench_iterations(b);
+    int frame = 0;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < n; i++)
+    {
+        if (i % BLOCK_RESET_OPS == BLOCK_RESET_OPS - 1)
+        {
+            bench_timer_stop(b);
+            block_system_snapshot_load(fx->blocks, snap);
+            fx->rng = rng0;
+            frame = 0;
+            bench_timer_start(b);
+        }
+        frame++;
+        if (movement)
+        {
+            block_system_update_movement(fx->blocks, frame, fx->balls, MAX_BALLS);
+        }
+        else
+        {
+            block_system_advance_animations(fx->blocks, frame);
+        }
+    }
+    bench_timer_stop(b);
+
+    bench_sink(block_system_still_active(fx->blocks));
+    block_system_snapshot_load(fx->blocks, snap);
+    fx->rng = rng0;
+    free(snap);
+}
+
+static void bench_update_movement(bench_t *b, void *arg)
+{
+    run_block_ticks(b, arg, 1);
+}
+
+static void bench_advance_animations(bench_t *b, void *arg)
+{
+    run_block_ticks(b, arg, 0);
+}
+
+/* --- Bullets --- */
+
+typedef struct
+{
+    gun_system_t *gun;
+    gun_system_env_t env;
+} gun_fixture_t;
+
+/* Never hits anything, so every bullet flies its full course. */
+static int gun_fixture_no_ball(int bx, int by, void *ud)
+{
+    (void)bx;
+    (void)by;
+    (void)ud;
+    return -1;
+}
+
+static int gun_fixture_init(gun_fixture_t *fx)
+{
+    memset(fx, 0, sizeof(*fx));
+    gun_system_callbacks_t cbs = {.check_ball_hit = gun_fixture_no_ball};
+    fx->gun = gun_system_create(PLAY_HEIGHT, &cbs, fx, NULL);
+    if (fx->gun == NULL)
+    {
+        return -1;
+    }
+    gun_system_set_unlimited(fx->gun, 1);
+
+    /* Fire a staggered volley until every slot is in flight. */
+    fx->env = (gun_system_env_t){.paddle_pos = PLAY_WIDTH / 2, .paddle_size = 50, .fast_gun = 1};
+    for (int f = 0; gun_system_get_active_bullet_count(fx->gun) < GUN_MAX_BULLETS; f++)
+    {
+        fx->env.frame = f;
+        fx->env.paddle_pos = 40 + (f * 37) % (PLAY_WIDTH - 80);
+        (void)gun_system_shoot(fx->gun, &fx->env);
+        gun_system_update(fx->gun, &fx->env);
+    }
+    return 0;
+}
+
+static void bench_gun_update(bench_t *b, void *arg)
+{
+    gun_fixture_t *fx = arg;
+    size_t size = gun_system_snapshot_size();
+    void *snap = malloc(size);
+    if (snap == NULL)
+    {
+        return;
+    }
+    gun_system_snapshot_save(fx->gun, snap);
+
+    uint64_t n = bench_iterations(b);
+    int frame = 0;
+    bench_timer_start(b);
+    for (uint64_t i = 0; i < n; i++)
+    {
+        if (i % GUN_RESET_OPS == GUN_RESET_OPS - 1)
+        {
+            bench_timer_stop(b);
+            gun_system_snapshot_load(fx->gun, snap);
+            frame = 0;
+            bench_timer_start(b);
+        }
+        /* Every op moves the bullets: they step on GUN_BULLET_FRAME_RATE frames. */
+        frame += GUN_BULLET_FRAME_RATE;
+        fx->env.frame = frame;
+        gun_system_update(fx->gun, &fx->env);
+    }
+    bench_timer_stop(b);
+
+    bench_sink(gun_system_get_active_bullet_count(fx->gun));
+    gun_system_snapshot_load(fx->gun, snap);
+    free(snap);
+}
+
+/* =========================================================================
+ * Driver
+ * ========================================================================= */
+
+typedef struct
+{
+    const bench_config_t *config;
+    const char *filter;
+    bench_result_t results[BENCH_MAX_RESULTS];
+    int count;
+    int failed;
+} run_state_t;
+
+static void run(run_state_t *rs, const char *name, bench_fn fn, void *arg)
+{
+    if (rs->filter != NULL && strstr(name, rs->filter) == NULL)
+    {
+        return;
+    }
+    if (rs->count >= BENCH_MAX_RESULTS)
+    {
+        fprintf(stderr, "xboing_bench: %s: %s\n", name, bench_status_string(BENCH_ERR_FULL));
+        rs->failed = 1;
+        return;
+    }
+    bench_status_t st = bench_run(rs->config, name, fn, arg, &rs->results[rs->count]);
+    if (st != BENCH_OK)
+    {
+        fprintf(stderr, "xboing_bench: %s: %s\n", name, bench_status_string(st));
+        rs->failed = 1;
+        return;
+    }
+    rs->count++;
+}
+
+static int run_all(run_state_t *rs)
+{
+    char name[BENCH_NAME_MAX];
+
+    for (int use_window = 1; use_window >= 0; use_window--)
+    {
+        for (int nballs = 1; nballs <= MAX_BALLS; nballs++)
+        {
+            ball_fixture_t fx;
+            if (ball_fixture_init(&fx, nballs, use_window) != 0)
+            {
+                ball_fixture_free(&fx);
+                return -1;
+            }
+            snprintf(name, sizeof(name), "%s/%d", use_window ? "ball_update" : "ball_update_cells",
+                     nballs);
+            run(rs, name, bench_ball_update, &fx);
+            ball_fixture_free(&fx);
+        }
+    }
+
+    pair_fixture_t pairs;
+    pair_fixture_init(&pairs);
+    run(rs, "ball_will_collide", bench_will_collide, &pairs);
+
+    static const grid_kind_t kinds[] = {GRID_DENSE, GRID_SPARSE};
+    for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++)
+    {
+        block_fixture_t fx;
+        if (block_fixture_init(&fx, kinds[k]) != 0)
+        {
+            return -1;
+        }
+        snprintf(name, sizeof(name), "block_check_region/%s", grid_name(kinds[k]));
+        run(rs, name, bench_check_region, &fx);
+        snprintf(name, sizeof(name), "block_still_active/%s", grid_name(kinds[k]));
+        run(rs, name, bench_still_active, &fx);
+        snprintf(name, sizeof(name), "block_update_movement/%s", grid_name(kinds[k]));
+        run(rs, name, bench_update_movement, &fx);
+        snprintf(name, sizeof(name), "block_advance_anim/%s", grid_name(kinds[k]));
+        run(rs, name, bench_advance_animations, &fx);
+        block_system_destroy(fx.blocks);
+    }
+
+    gun_fixture_t gun;
+    if (gun_fixture_init(&gun) != 0)
+    {
+        return -1;
+    }
+    run(rs, "gun_update/full", bench_gun_update, &gun);
+    gun_system_destroy(gun.gun);
+    return 0;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-json FILE] [-baseline FILE] [-tolerance PCT]\n"
+            "          [-filter SUBSTR] [-min-time MS] [-reps N]\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *json_path = NULL;
+    const char *baseline_path = NULL;
+    int tolerance = BENCH_DEFAULT_TOLERANCE;
+    int min_time_ms = (int)(BENCH_DEFAULT_MIN_TIME_NS / 1000000ULL);
+
+    bench_config_t config;
+    bench_config_init(&config);
+
+    run_state_t rs;
+    memset(&rs, 0, sizeof(rs));
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (val == NULL)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+
+        if (strcmp(arg, "-json") == 0)
+        {
+            json_path = val;
+        }
+        else if (strcmp(arg, "-baseline") == 0)
+        {
+            baseline_path = val;
+        }
+        else if (strcmp(arg, "-filter") == 0)
+        {
+            rs.filter = val;
+        }
+        else if (strcmp(arg, "-tolerance") == 0)
+        {
+            if (!parse_int_in_range(val, 0, 10000, &tolerance))
+            {
+                fprintf(stderr, "xboing_bench: bad -tolerance '%s'\n", val);
+                return 1;
+            }
+        }
+        else if (strcmp(arg, "-min-time") == 0)
+        {
+            if (!parse_int_in_range(val, 1, 60000, &min_time_ms))
+            {
+                fprintf(stderr, "xboing_bench: bad -min-time '%s'\n", val);
+                return 1;
+            }
+        }
+        else if (strcmp(arg, "-reps") == 0)
+        {
+            if (!parse_int_in_range(val, 1, 1000, &config.reps))
+            {
+                fprintf(stderr, "xboing_bench: bad -reps '%s'\n", val);
+                return 1;
+            }
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    config.min_time_ns = (uint64_t)min_time_ms * UINT64_C(1000000);
+    rs.config = &config;
+
+    /* Read the baseline first so a bad path fails before minutes of timing. */
+    bench_result_t baseline[BENCH_MAX_RESULTS];
+    int baseline_count = 0;
+    if (baseline_path != NULL)
+    {
+        bench_status_t st =
+            bench_read_baseline(baseline_path, baseline, BENCH_MAX_RESULTS, &baseline_count);
+        if (st != BENCH_OK)
+        {
+            fprintf(stderr, "xboing_bench: %s: %s\n", baseline_path, bench_status_string(st));
+            return 1;
+        }
+    }
+
+    if (run_all(&rs) != 0)
+    {
+        fprintf(stderr, "xboing_bench: fixture allocation failed\n");
+        return 1;
+    }
+
+    if (json_path != NULL)
+    {
+        FILE *fp = fopen(json_path, "w");
+        bench_status_t st = (fp != NULL) ? bench_write_json(fp, rs.results, rs.count)
+                                         : BENCH_ERR_IO;
+        if (fp != NULL && fclose(fp) != 0)
+        {
+            st = BENCH_ERR_IO;
+        }
+        if (st != BENCH_OK)
+        {
+            fprintf(stderr, "xboing_bench: %s: %s\n", json_path, bench_status_string(st));
+            return 1;
+        }
+    }
+
+    /* Table to stdout when the JSON went to a file; JSON otherwise. */
+    FILE *report = (json_path != NULL) ? stdout : stderr;
+    if (json_path == NULL)
+    {
+        (void)bench_write_json(stdout, rs.results, rs.count);
+    }
+
+    int regressions = 0;
+    if (baseline_path != NULL)
+    {
+        regressions = bench_compare(rs.results, rs.count, baseline, baseline_count,
+                                    (double)tolerance, report);
+        fprintf(report, "benchmarks=%d regressions=%d tolerance=%d%%\n", rs.count, regressions,
+                tolerance);
+    }
+    else if (json_path != NULL)
+    {
+        (void)bench_compare(rs.results, rs.count, NULL, 0, 0.0, report);
+    }
+
+    if (rs.failed)
+    {
+        return 1;
+    }
+    return (regressions > 0) ? 2 : 0;
+}
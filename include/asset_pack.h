@@ -0,0 +1,165 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+/*
+ * asset_pack.h — Single-file, memory-mapped asset pack.
+ *
+ * An installed game reads its images, sounds, fonts and levels from one
+ * pack file (xboing.pak) instead of hundreds of loose files.  The pack is
+ * mapped read-only, and every lookup hands back a pointer into the
+ * mapping: nothing is copied, and pages are read on first touch.
+ *
+ * File layout (all integers little-endian):
+ *
+ *   header    64 bytes: magic, version, counts and section offsets
+ *   entries   one 48-byte record per asset, sorted by key
+ *   buckets   open-addressed hash table (FNV-1a, linear probing) of
+ *             entry index + 1; 0 marks an empty bucket
+ *   strings   NUL-terminated keys
+ *   blobs     asset data, each starting on an ASSET_PACK_ALIGN boundary
+ *
+ * Keys are "<kind dir>/<name>", matching the lookups of the consumers:
+ * "images/balls/ball1" (no .png), "sounds/boing" (no .wav),
+ * "fonts/LiberationSans-Bold.ttf" and "levels/level01.data".
+ *
+ * The writer half builds packs for tools/xboing_pack.c and the tests.
+ *
+ * Pure C, POSIX mmap, no SDL2.  Opaque context pattern.  See ADR-098 in
+ * docs/DESIGN.md.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+/* File name of the installed pack under the data directory. */
+#define ASSET_PACK_FILENAME "xboing.pak"
+
+/* On-disk format version; packs of another version are rejected. */
+#define ASSET_PACK_VERSION 1
+
+/* Alignment of every blob within the file (and so within the mapping). */
+#define ASSET_PACK_ALIGN 64
+
+/* Longest key, in bytes. */
+#define ASSET_PACK_MAX_KEY 255
+
+/* =========================================================================
+ * Types
+ * ========================================================================= */
+
+typedef enum
+{
+    ASSET_PACK_OK = 0,
+    ASSET_PACK_ERR_NULL_ARG,
+    ASSET_PACK_ERR_ALLOC_FAILED,
+    ASSET_PACK_ERR_IO,
+    ASSET_PACK_ERR_BAD_FORMAT,
+    ASSET_PACK_ERR_NOT_FOUND,
+    ASSET_PACK_ERR_KEY_TOO_LONG,
+    ASSET_PACK_ERR_DUPLICATE
+} asset_pack_status_t;
+
+/* How an entry's data is to be read. */
+typedef enum
+{
+    ASSET_PACK_RAW = 0, /* File bytes as shipped (TTF, level text) */
+    ASSET_PACK_PIXELS,  /* Decoded RGBA32 pixels, rows pitch bytes apart */
+    ASSET_PACK_PCM      /* Decoded audio samples */
+} asset_pack_kind_t;
+
+/*
+ * One asset.  Returned by the lookups with key and data pointing into
+ * the mapping (valid until asset_pack_close()); passed to
+ * asset_pack_writer_add(), which copies both.
+ */
+typedef struct
+{
+    const char *key;
+    const void *data;
+    size_t size;
+    asset_pack_kind_t kind;
+    /* ASSET_PACK_PIXELS: image size in pixels and row stride in bytes.
+     * ASSET_PACK_PCM: sample rate in Hz, SDL AudioFormat, channels.
+     * Zero otherwise. */
+    uint32_t param[3];
+} asset_pack_entry_t;
+
+typedef struct asset_pack asset_pack_t;
+typedef struct asset_pack_writer asset_pack_writer_t;
+
+/* =========================================================================
+ * Reading
+ * ========================================================================= */
+
+/*
+ * Map the pack at path and check its header and directory: every key
+ * and blob must lie inside the file.  Asks the kernel to read the file
+ * ahead, so a pack on a network filesystem streams in with a few large
+ * reads instead of one small read per asset.
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason:
+ * ASSET_PACK_ERR_IO if the file cannot be opened or mapped,
+ * ASSET_PACK_ERR_BAD_FORMAT if it is not a valid pack of this version.
+ */
+asset_pack_t *asset_pack_open(const char *path, asset_pack_status_t *status);
+
+/* Unmap the pack.  Every pointer obtained from it becomes invalid.  Safe
+ * to call with NULL. */
+void asset_pack_close(asset_pack_t *ctx);
+
+/*
+ * Look up key.  Returns ASSET_PACK_OK and fills *out, or
+ * ASSET_PACK_ERR_NOT_FOUND.  NULL ctx is simply not found, so callers can
+ * pass a missing pack straight through.
+ */
+asset_pack_status_t asset_pack_find(const asset_pack_t *ctx, const char *key,
+                                    asset_pack_entry_t *out);
+
+/* Number of entries; 0 for NULL. */
+int asset_pack_count(const asset_pack_t *ctx);
+
+/* Copy entry index (0 .. count - 1, in key order) into *out. */
+asset_pack_status_t asset_pack_get(const asset_pack_t *ctx, int index, asset_pack_entry_t *out);
+
+/* Number of entries whose key starts with prefix (e.g. "images/"). */
+int asset_pack_count_prefix(const asset_pack_t *ctx, const char *prefix);
+
+/* =========================================================================
+ * Writing
+ * ========================================================================= */
+
+/* Create an empty pack builder.  Returns NULL on allocation failure. */
+asset_pack_writer_t *asset_pack_writer_create(asset_pack_status_t *status);
+
+/* Free the builder and the data it copied.  Safe to call with NULL. */
+void asset_pack_writer_destroy(asset_pack_writer_t *w);
+
+/*
+ * Add entry, copying its key and data.  Returns ASSET_PACK_ERR_KEY_TOO_LONG
+ * for an empty key or one over ASSET_PACK_MAX_KEY bytes, and
+ * ASSET_PACK_ERR_DUPLICATE if the key was already added.
+ */
+asset_pack_status_t asset_pack_writer_add(asset_pack_writer_t *w, const asset_pack_entry_t *entry);
+
+/* Number of entries added so far; 0 for NULL. */
+int asset_pack_writer_count(const asset_pack_writer_t *w);
+
+/*
+ * Write the pack to path, via a temporary file renamed into place so a
+ * running game never maps a half-written pack.  The output depends only
+ * on the entries, not on the order they were added.
+ */
+asset_pack_status_t asset_pack_writer_save(const asset_pack_writer_t *w, const char *path);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *asset_pack_status_string(asset_pack_status_t status);
+
+#endif /* ASSET_PACK_H */
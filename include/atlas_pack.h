@@ -0,0 +1,49 @@
+#ifndef ATLAS_PACK_H
+#define ATLAS_PACK_H
+
+/*
+ * atlas_pack.h — Shelf packer for texture atlas pages.
+ *
+ * Assigns each sprite a page and a top-left position so that many small
+ * images share a few large textures.  Pure C, no SDL dependency: the
+ * sdl2_texture cache packs with it at startup, and tests can check the
+ * layout without a renderer.
+ *
+ * See ADR-085 in docs/DESIGN.md.
+ */
+
+/* Page index of an item that was not packed (too large, or out of pages). */
+#define ATLAS_PACK_NONE (-1)
+
+/* Status codes returned by atlas_pack(). */
+typedef enum
+{
+    ATLAS_PACK_OK = 0,
+    ATLAS_PACK_ERR_NULL_ARG,
+    ATLAS_PACK_ERR_BAD_SIZE,
+    ATLAS_PACK_ERR_NO_MEMORY
+} atlas_pack_status_t;
+
+typedef struct
+{
+    int w, h;    /* In: sprite size in pixels */
+    int page;    /* Out: page index, or ATLAS_PACK_NONE */
+    int x, y;    /* Out: top-left corner within the page */
+} atlas_pack_item_t;
+
+/*
+ * Pack count items onto at most max_pages square pages of page_size
+ * pixels, leaving padding empty pixels between neighbours.  Items are
+ * placed tallest first onto horizontal shelves; an item that does not
+ * fit any page gets page = ATLAS_PACK_NONE and is left for the caller to
+ * handle on its own.  The layout depends only on the inputs.
+ *
+ * *pages_used receives the number of pages holding at least one item.
+ */
+atlas_pack_status_t atlas_pack(atlas_pack_item_t *items, int count, int page_size, int padding,
+                               int max_pages, int *pages_used);
+
+/* Return a human-readable string for a status code. */
+const char *atlas_pack_status_string(atlas_pack_status_t status);
+
+#endif /* ATLAS_PACK_H */
@@ -12,8 +12,12 @@
  * See ADR-015 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+
 #include "ball_types.h"
+#include "block_geom.h"
 #include "block_types.h"
+#include "sound_catalog.h"
 
 /* =========================================================================
  * Status codes
@@ -96,6 +100,15 @@ typedef struct
      */
     int (*check_region)(int row, int col, int bx, int by, int bdx, void *ud);
 
+    /*
+     * Cell window fetch: fill *out with the cells around (row, col), see
+     * block_geom.h (block_system_get_window has this signature).  When
+     * set, it replaces check_region: each ray-march fetches one window
+     * and classifies the nine probed cells from it, fetching again only
+     * if the search base moves.  Returns nonzero on success.
+     */
+    int (*get_window)(int row, int col, block_window_t *out, void *ud);
+
     /*
      * Block hit: called when a ball strikes a block.
      * Returns BLOCK_HIT_BOUNCE, BLOCK_HIT_ABSORB, or BLOCK_HIT_TELEPORT.
@@ -108,10 +121,10 @@ typedef struct
      */
     int (*cell_available)(int row, int col, void *ud);
 
-    /* Audio playback: play the named sound effect at a per-call volume
+    /* Audio playback: play the given sound effect at a per-call volume
      * (0-100 percent of master).  Volumes from
      * docs/audits/2026-06-28-audio-volume-modulation.md. */
-    void (*on_sound)(const char *name, int volume, void *ud);
+    void (*on_sound)(sound_id_t sound, int volume, void *ud);
 
     /* Score addition: add points to the player's score. */
     void (*on_score)(unsigned long points, void *ud);
@@ -148,6 +161,12 @@ typedef struct
     int inc; /* Guide animation direction: +1 or -1 */
 } ball_system_guide_info_t;
 
+/* =========================================================================
+ * Random function type — injectable for deterministic testing
+ * ========================================================================= */
+
+typedef int (*ball_rand_fn)(void *user_data);
+
 /* =========================================================================
  * Opaque context
  * ========================================================================= */
@@ -165,11 +184,13 @@ typedef struct ball_system ball_system_t;
  * callbacks: side-effect function pointers (any may be NULL for stubs).
  *            The struct is copied — caller need not keep it alive.
  * user_data: opaque pointer passed to all callbacks.
+ * rand_fn:   random number source for mass, jitter, tilt and teleport,
+ *            called with user_data (NULL = stdlib rand).
  *
  * Returns NULL on allocation failure (sets *status if non-NULL).
  */
 ball_system_t *ball_system_create(const ball_system_callbacks_t *callbacks, void *user_data,
-                                  ball_system_status_t *status);
+                                  ball_rand_fn rand_fn, ball_system_status_t *status);
 
 /* Destroy the ball system.  Safe to call with NULL. */
 void ball_system_destroy(ball_system_t *ctx);
@@ -303,6 +324,25 @@ ball_system_status_t ball_system_restore(ball_system_t *ctx, int index, int curr
                                          int active, enum BallStates state, int x, int y, int dx,
                                          int dy, enum BallStates wait_mode);
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: every ball slot (position, velocity, state, deadlines),
+ * the guide animation, and the last update frame.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any ball_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t ball_system_snapshot_size(void);
+
+/* Copy the current state into buf (ball_system_snapshot_size() bytes). */
+void ball_system_snapshot_save(const ball_system_t *ctx, void *buf);
+
+/* Replace the current state with a saved snapshot.  No callbacks fire. */
+void ball_system_snapshot_load(ball_system_t *ctx, const void *buf);
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
@@ -0,0 +1,77 @@
+#ifndef BLOCK_GEOM_H
+#define BLOCK_GEOM_H
+
+/*
+ * block_geom.h — Ball-vs-block collision classifier and cell windows.
+ *
+ * The bbox-vs-triangle face test from block_system_check_region_bbox,
+ * split out so ball_system can classify hits against a window of cells
+ * fetched once per ray-march instead of calling back into block_system
+ * for every probe.  Pure C, no state: shared by block_system (which
+ * fills windows) and ball_system (which reads them), the way
+ * score_logic is shared by block_system and score_system.
+ *
+ * See ADR-082 in docs/DESIGN.md.
+ */
+
+#include <stdint.h>
+
+#include "block_types.h"
+
+/* =========================================================================
+ * Cell window
+ *
+ * A BLOCK_WINDOW_SPAN x BLOCK_WINDOW_SPAN square of grid cells around a
+ * centre cell.  The 3x3 cells around the centre are the ones
+ * ball_system's collision search probes; the outer ring is there so the
+ * adjacency filter of every probed cell can see its four neighbours.
+ * Cells outside the grid read as empty.
+ * ========================================================================= */
+
+#define BLOCK_WINDOW_RADIUS 2
+#define BLOCK_WINDOW_SPAN (2 * BLOCK_WINDOW_RADIUS + 1)
+#define BLOCK_WINDOW_CELLS (BLOCK_WINDOW_SPAN * BLOCK_WINDOW_SPAN)
+
+typedef struct
+{
+    int16_t x, y; /* Block top-left in playfield pixels */
+    int16_t w, h; /* Block size in pixels */
+} block_window_rect_t;
+
+typedef struct
+{
+    int row;           /* Centre cell */
+    int col;
+    uint32_t occupied; /* Bit per cell: occupied in any state (adjacency) */
+    uint32_t solid;    /* Bit per cell: occupied and not exploding (hittable) */
+    block_window_rect_t rect[BLOCK_WINDOW_CELLS]; /* Valid where solid */
+} block_window_t;
+
+/* Bit / array index of (row, col) in a window, or -1 if outside it. */
+int block_window_index(const block_window_t *w, int row, int col);
+
+/*
+ * Nonzero if (row, col) is close enough to the centre for
+ * block_window_check_region to classify it (within BLOCK_WINDOW_RADIUS-1).
+ */
+int block_window_covers(const block_window_t *w, int row, int col);
+
+/*
+ * Same result as block_system_check_region_bbox for (row, col), read
+ * from the window.  (row, col) must satisfy block_window_covers.
+ */
+int block_window_check_region(const block_window_t *w, int row, int col, int bx, int by);
+
+/* =========================================================================
+ * Classifier
+ * ========================================================================= */
+
+/*
+ * Faces of the block rectangle (x, y, w, h) that the ball's
+ * BALL_WIDTH x BALL_HEIGHT bounding box centred on (bx, by) overlaps,
+ * as a COLLISION_REGION_* bitmask, before adjacency suppression.
+ * Port of the XRectInRegion tests in original/ball.c:1387-1452.
+ */
+int block_geom_face_hits(int bx, int by, int x, int y, int w, int h);
+
+#endif /* BLOCK_GEOM_H */
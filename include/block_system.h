@@ -17,6 +17,10 @@
  * See ADR-016 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include "block_geom.h"
 #include "block_types.h"
 
 /* =========================================================================
@@ -101,6 +105,12 @@ typedef struct
     int explode_all;   /* Dynamite overlay flag */
 } block_system_render_info_t;
 
+/* =========================================================================
+ * Random function type — injectable for deterministic testing
+ * ========================================================================= */
+
+typedef int (*block_rand_fn)(void *user_data);
+
 /* =========================================================================
  * Opaque context
  * ========================================================================= */
@@ -117,10 +127,13 @@ typedef struct block_system block_system_t;
  *
  * col_width:  pixel width per grid column  (typically PLAY_WIDTH / MAX_COL = 55)
  * row_height: pixel height per grid row    (typically PLAY_HEIGHT / MAX_ROW = 32)
+ * rand_fn:    random number source for drop/roam/random-block timers,
+ *             called with rand_user_data (NULL = stdlib rand).
  *
  * Returns NULL on allocation failure (sets *status if non-NULL).
  */
-block_system_t *block_system_create(int col_width, int row_height, block_system_status_t *status);
+block_system_t *block_system_create(int col_width, int row_height, block_rand_fn rand_fn,
+                                    void *rand_user_data, block_system_status_t *status);
 
 /* Destroy the block system.  Safe to call with NULL. */
 void block_system_destroy(block_system_t *ctx);
@@ -391,6 +404,7 @@ void block_system_set_last_frame(block_system_t *ctx, int row, int col, int last
  *
  * These functions match the callback signatures in ball_system.h:
  *   check_region: int (*)(int row, int col, int bx, int by, int bdx, void *ud)
+ *   get_window: int (*)(int row, int col, block_window_t *out, void *ud)
  *   cell_available: int (*)(int row, int col, void *ud)
  *
  * Pass block_system_t* as the user_data (ud) parameter.
@@ -420,6 +434,18 @@ void block_system_set_last_frame(block_system_t *ctx, int row, int col, int last
  */
 int block_system_check_region_bbox(int row, int col, int bx, int by, int bdx, void *ud);
 
+/*
+ * Fill *out with the BLOCK_WINDOW_SPAN x BLOCK_WINDOW_SPAN window of
+ * cells centred on (row, col): occupancy, hittability and geometry, so a
+ * caller can classify every cell in the 3x3 around the centre with
+ * block_window_check_region instead of one check_region call per cell.
+ * Matches the get_window callback signature in ball_system.h.
+ *
+ * ud must be a block_system_t* (cast from void*).  Returns 0 if ud or
+ * out is NULL, 1 otherwise.
+ */
+int block_system_get_window(int row, int col, block_window_t *out, void *ud);
+
 /*
  * Return nonzero if cell (row, col) is available for placement.
  * A cell is available if it is within bounds, unoccupied, and not exploding.
@@ -447,7 +473,8 @@ int block_system_get_hit_points(const block_system_t *ctx, int row, int col);
  * A block counts as required iff block_system_type_is_required() returns
  * nonzero for its type (the single source of truth for the required set).
  * Also returns nonzero if blocks_exploding > 1 (explosions still pending).
- * Matches legacy StillActiveBlocks().
+ * Matches legacy StillActiveBlocks().  O(1): reads the required-block
+ * count kept up to date by every grid mutation (ADR-083).
  */
 int block_system_still_active(const block_system_t *ctx);
 
@@ -501,6 +528,12 @@ int block_system_explode_all_required(block_system_t *ctx, int frame);
 /* Return the count of blocks currently in explosion animation. */
 int block_system_get_exploding_count(const block_system_t *ctx);
 
+/*
+ * Return the count of occupied cells holding a required block type
+ * (exploding ones included).  Maintained incrementally, O(1).
+ */
+int block_system_get_required_count(const block_system_t *ctx);
+
 /* Fill render info for block at (row, col).  Returns error on bad coords. */
 block_system_status_t block_system_get_render_info(const block_system_t *ctx, int row, int col,
                                                    block_system_render_info_t *info);
@@ -508,6 +541,52 @@ block_system_status_t block_system_get_render_info(const block_system_t *ctx, in
 /* Get the block info catalog entry for a block type (0..MAX_BLOCKS-1). */
 const block_system_info_t *block_system_get_info(const block_system_t *ctx, int block_type);
 
+/* =========================================================================
+ * Change tracking — which cells look different since the renderer last asked
+ *
+ * Every mutation that changes what get_render_info reports for a cell
+ * (add, clear, explosion stage, animation frame, counter hit, morph,
+ * roam) sets that cell's dirty bit and bumps a generation counter.  An
+ * animation tick that leaves the frame unchanged marks nothing.  See
+ * ADR-089 in docs/DESIGN.md.
+ * ========================================================================= */
+
+/* Incremented on every cell change; 0 for NULL. */
+uint32_t block_system_get_generation(const block_system_t *ctx);
+
+/*
+ * Copy the dirty masks into rows (bit c of rows[r] set iff cell (r, c)
+ * changed), clear them, and return the number of dirty cells.  Returns 0
+ * and zeroes rows for a NULL ctx.
+ */
+int block_system_take_dirty(block_system_t *ctx, uint16_t rows[MAX_ROW]);
+
+/* Mark every cell dirty, e.g. after the renderer lost its cached copy. */
+void block_system_mark_all_dirty(block_system_t *ctx);
+
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: the whole grid (occupancy, hit points, explosion and
+ * animation deadlines, roamer/drop state) and the exploding count.  The
+ * block info catalog is constant and is not included.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any block_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t block_system_snapshot_size(void);
+
+/* Copy the current state into buf (block_system_snapshot_size() bytes). */
+void block_system_snapshot_save(const block_system_t *ctx, void *buf);
+
+/*
+ * Replace the current state with a saved snapshot.  No callbacks fire;
+ * every cell is marked dirty.
+ */
+void block_system_snapshot_load(block_system_t *ctx, const void *buf);
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
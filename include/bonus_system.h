@@ -16,6 +16,8 @@
  * See ADR-022 in docs/DESIGN.md for design rationale.
  */
 
+#include "sound_catalog.h"
+
 /* =========================================================================
  * Constants — match legacy bonus.c / bonus.h values
  * ========================================================================= */
@@ -112,7 +114,7 @@ typedef struct
     void (*on_save_triggered)(void *ud);
 
     /* Sound effect requested at per-call volume (0-100 percent of master). */
-    void (*on_sound)(const char *name, int volume, void *ud);
+    void (*on_sound)(sound_id_t sound, int volume, void *ud);
 
     /* Bonus sequence is complete; next_level is the level to start */
     void (*on_finished)(int next_level, void *ud);
@@ -17,6 +17,7 @@
 #define EDITOR_SYSTEM_H
 
 #include "block_types.h" /* MAX_ROW, MAX_COL, block type constants */
+#include "sound_catalog.h"
 
 /* =========================================================================
  * Constants
@@ -91,8 +92,8 @@ typedef struct
      * Must fill *cell and return nonzero if occupied, 0 otherwise. */
     int (*query_cell)(int row, int col, editor_cell_t *cell, void *ud);
 
-    /* Called to play a sound effect. name: sound file name, volume: 0-100. */
-    void (*on_sound)(const char *name, int volume, void *ud);
+    /* Called to play a sound effect. sound: catalog ID, volume: 0-100. */
+    void (*on_sound)(sound_id_t sound, int volume, void *ud);
 
     /* Called to display a status message. sticky: nonzero to persist. */
     void (*on_message)(const char *message, int sticky, void *ud);
@@ -15,6 +15,10 @@
  * See ADR-024 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+
+#include "sound_catalog.h"
+
 /* =========================================================================
  * Constants — match legacy eyedude.h values
  * ========================================================================= */
@@ -82,7 +86,7 @@ typedef struct
     void (*on_score)(unsigned long points, void *ud);
 
     /* Sound effect requested at per-call volume (0-100 percent of master). */
-    void (*on_sound)(const char *name, int volume, void *ud);
+    void (*on_sound)(sound_id_t sound, int volume, void *ud);
 
     /* Message display */
     void (*on_message)(const char *msg, void *ud);
@@ -92,7 +96,7 @@ typedef struct
  * Random function type — injectable for deterministic testing
  * ========================================================================= */
 
-typedef int (*eyedude_rand_fn)(void);
+typedef int (*eyedude_rand_fn)(void *user_data);
 
 /* =========================================================================
  * Opaque context
@@ -172,4 +176,23 @@ void eyedude_system_get_position(const eyedude_system_t *ctx, int *out_x, int *o
 /* Get render info for the integration layer */
 eyedude_render_info_t eyedude_system_get_render_info(const eyedude_system_t *ctx);
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: state, direction, position, animation frame and turn
+ * flag.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any eyedude_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t eyedude_system_snapshot_size(void);
+
+/* Copy the current state into buf (eyedude_system_snapshot_size() bytes). */
+void eyedude_system_snapshot_save(const eyedude_system_t *ctx, void *buf);
+
+/* Replace the current state with a saved snapshot.  No callbacks fire. */
+void eyedude_system_snapshot_load(eyedude_system_t *ctx, const void *buf);
+
 #endif /* EYEDUDE_SYSTEM_H */
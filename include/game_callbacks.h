@@ -21,6 +21,7 @@
 #include "intro_system.h"
 #include "keys_system.h"
 #include "presents_system.h"
+#include "rules_logic.h"
 #include "sfx_system.h"
 
 /*
@@ -35,6 +36,12 @@ ball_system_callbacks_t game_callbacks_ball(void);
  */
 ball_system_env_t game_callbacks_ball_env(const game_ctx_t *ctx);
 
+/*
+ * Build the rules_logic view of the game: its systems, rule state, and
+ * the audio/sfx effect hooks.  `ctx` must outlive the returned struct.
+ */
+rules_logic_t game_callbacks_rules(game_ctx_t *ctx);
+
 /*
  * Build and return the gun_system callback table.
  */
@@ -80,6 +87,13 @@ eyedude_system_callbacks_t game_callbacks_eyedude(void);
  */
 sdl2_state_mode_t game_callbacks_attract_next(sdl2_state_mode_t current);
 
+/*
+ * rand_fn shared by every game system (ball, block, eyedude, sfx,
+ * special, intro, demo, keys).  `ud` is a game_ctx_t*; draws from
+ * ctx->rng.
+ */
+int game_callbacks_rand(void *ud);
+
 /*
  * Block explosion finalize callback — registered with
  * block_system_update_explosions().  Fires once per block reaching the
@@ -8,7 +8,7 @@
  * Opaque module contexts are forward-declared (no headers pulled in),
  * which keeps compile times low and avoids circular dependencies.  The
  * only headers included are for value-type members stored inline in the
- * struct (config_io, highscore, paths, savegame_io) -- these must be
+ * struct (config_io, highscore, paths, rng, savegame_io) -- these must be
  * complete types, and none of them include game_context.h, so there is
  * no cycle.
  */
@@ -22,6 +22,7 @@
 #include "config_io.h"
 #include "highscore_system.h" /* highscore_table_t (value type, needed inline) */
 #include "paths.h"            /* paths_config_t (value type, needed inline) */
+#include "rng.h"              /* rng_t (value type, needed inline) */
 #include "savegame_io.h"      /* savegame_data_t / savegame_level_t (value types, needed inline) */
 
 /* =========================================================================
@@ -35,8 +36,15 @@ typedef struct sdl2_font sdl2_font_t;
 typedef struct sdl2_audio sdl2_audio_t;
 typedef struct sdl2_input sdl2_input_t;
 typedef struct sdl2_cursor sdl2_cursor_t;
+typedef struct sdl2_layer sdl2_layer_t;
+typedef struct sdl2_capture sdl2_capture_t;
 typedef struct sdl2_state sdl2_state_t;
 typedef struct sdl2_loop sdl2_loop_t;
+typedef struct sdl2_pacer sdl2_pacer_t;
+typedef struct perf_hud perf_hud_t;
+typedef struct sdl2_decode sdl2_decode_t;
+typedef struct startup_profile startup_profile_t;
+typedef struct asset_pack asset_pack_t;
 
 /* Game system modules */
 typedef struct ball_system ball_system_t;
@@ -58,6 +66,9 @@ typedef struct intro_system intro_system_t;
 typedef struct demo_system demo_system_t;
 typedef struct keys_system keys_system_t;
 typedef struct dialogue_system dialogue_system_t;
+
+/* Session recording / playback (game_replay.h) */
+typedef struct game_replay game_replay_t;
 /* highscore_system_t already typedef'd via highscore_system.h above */
 
 /* =========================================================================
@@ -84,6 +95,24 @@ typedef struct game_ctx
     sdl2_cursor_t *cursor;
     sdl2_state_t *state;
     sdl2_loop_t *loop;
+    sdl2_pacer_t *pacer;    /* Frame limiter (ADR-090) */
+    const char *trace_path; /* -trace output, NULL = off (ADR-091) */
+    perf_hud_t *perf_hud;   /* F3 performance overlay (ADR-092) */
+
+    /* Startup only (ADR-097): asset decode pool and -startup-profile
+     * timings.  Both are released before game_create() returns. */
+    sdl2_decode_t *decoder;
+    startup_profile_t *startup_profile;
+
+    /* Installed asset pack (ADR-098), or NULL when assets are loose files.
+     * Open for the whole session: textures, sounds and fonts point into
+     * it, and levels are read from it on demand. */
+    asset_pack_t *assets;
+
+    /* Cached static layers (ADR-088); NULL means draw directly */
+    sdl2_layer_t *backdrop_layer; /* Window background */
+    sdl2_layer_t *play_layer;     /* Play-area tiles, border, editor grid */
+    sdl2_layer_t *block_layer;    /* Block grid, patched per dirty cell (ADR-089) */
 
     /* --- Game systems ---------------------------------------------------- */
     ball_system_t *ball;
@@ -154,6 +183,14 @@ typedef struct game_ctx
     int time_remaining;   /* Seconds remaining on level timer */
     int timer_frame_acc;  /* Frame accumulator for 1-second countdown */
 
+    /* Gameplay RNG — every system's rand_fn and the rules layer draw from
+     * this one stream (game_callbacks_rand), so a game replays from its
+     * seed regardless of other rand() consumers in the process.  Seeded
+     * by game_create() from the caller-seeded rand() stream, or from the
+     * recording under -replay; rng_seed keeps the seed for -record. */
+    rng_t rng;
+    uint64_t rng_seed;
+
     /* Tilt state — original/include/main.h:85 */
 #define GAME_MAX_TILTS 3
     int user_tilts;
@@ -171,12 +208,17 @@ typedef struct game_ctx
     /* Visual-capture: -1 = off, SDL2ST_* = single mode, 99 = all */
     int vc_mode;
     int vc_interval;
+    const char *vc_dir;      /* -capture-dir, NULL = signal only (ADR-093) */
+    sdl2_capture_t *capture; /* Writes the snapshots when vc_dir is set */
 
     /* Autoload: -load CLI flag asks main() to call
      * savegame_system_load and enter SDL2ST_GAME before the event
      * loop, bypassing the attract cycle. */
     bool autoload;
 
+    /* -record / -replay session, NULL when neither is active. */
+    game_replay_t *replay;
+
     /* Attract-mode display overrides (don't affect game state) */
     int attract_level_display; /* 0 = use real level_number */
 
@@ -31,6 +31,10 @@ void game_destroy(game_ctx_t *ctx);
  *   - Other tests call neither and inherit whatever rand() state
  *     existed at process start.
  *
+ * game_create draws the seed for the game's own gameplay RNG (ctx->rng)
+ * from rand(), so seeding rand() before game_create still makes a whole
+ * game reproducible.
+ *
  * If the production seeding policy ever needs to change (e.g.,
  * combine time() with getpid() for parallel-test safety), this is
  * the one place to edit.
@@ -5,17 +5,47 @@
 #ifndef GAME_RENDER_H
 #define GAME_RENDER_H
 
+#include <stdbool.h>
+
 #include "game_context.h"
 #include "score_system.h" /* SCORE_DIGIT_STRIDE — shared with level number layout */
 #include "special_system.h"
+#include "sprite_catalog.h"
+
+/* Static border drawn around the play area by game_render_backdrop. */
+typedef enum
+{
+    GAME_BORDER_NONE = 0,
+    GAME_BORDER_RED,  /* Walls on (original/special.c:146) */
+    GAME_BORDER_GREEN /* No-walls special, attract screens (original/special.c:141) */
+} game_border_t;
 
-/* Render the complete game frame (background + playfield + blocks + UI). */
+/* Render the complete game frame (background + playfield + blocks + UI)
+ * and present it. */
 void game_render_frame(const game_ctx_t *ctx);
 
-/* Render the play area background. */
+/*
+ * The two halves of game_render_frame: draw the frame, then present it.
+ * Between them the finished frame can still be read back, which
+ * -visual-capture does (ADR-093).
+ */
+void game_render_compose(const game_ctx_t *ctx);
+void game_render_present(const game_ctx_t *ctx);
+
+/* Render the current level's background tiles across the play area. */
 void game_render_background(const game_ctx_t *ctx);
 
-/* Render the play area border and all blocks. */
+/*
+ * Render the static play-area backdrop: tile (SPRITE_NONE for none)
+ * tiled across the play area, the editor grid if grid is set, then the
+ * border.  Composed once into ctx->play_layer and copied from there until
+ * an argument or the logical size changes (ADR-088); drawn directly when
+ * there is no layer.
+ */
+void game_render_backdrop(const game_ctx_t *ctx, sprite_id_t tile, game_border_t border,
+                          bool grid);
+
+/* Render blocks, paddle, balls and bullets, clipped to the play area. */
 void game_render_playfield(const game_ctx_t *ctx);
 
 /* Render all occupied blocks in the grid. */
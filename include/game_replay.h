@@ -0,0 +1,92 @@
+/*
+ * game_replay.h -- -record / -replay wiring for the SDL2 game.
+ *
+ * Connects the frame loop in game_main.c to replay_io.  Recording
+ * captures, once per visual frame, the sdl2_input snapshot the game is
+ * about to act on plus any keystrokes routed to the dialogue, and after
+ * the loop has run, how many logic ticks that frame dispatched.  Playback
+ * feeds the same snapshots back in place of live SDL events and steps
+ * the loop by the recorded tick counts, so the session repeats exactly
+ * from the recorded RNG seed.
+ *
+ * Per-frame call order in game_main.c:
+ *
+ *   sdl2_input_begin_frame
+ *   event pump (live events dropped while game_replay_playing)
+ *   ticks = game_replay_frame_input(ctx)     -- before game_input_global
+ *   game_input_global
+ *   loop update, or sdl2_loop_step(ticks) during playback
+ *   game_replay_frame_done(ctx, ticks_run)
+ *
+ * Not captured: the level editor (reads SDL keyboard state and the wall
+ * clock directly) and save/load files (Z/X read whatever is on disk).
+ * A session that uses either replays only up to that point.
+ *
+ * See ADR-078 in docs/DESIGN.md.
+ */
+
+#ifndef GAME_REPLAY_H
+#define GAME_REPLAY_H
+
+#include <stdbool.h>
+
+#include "dialogue_system.h"
+#include "game_context.h"
+
+/* Returned by game_replay_frame_input when not playing back. */
+#define GAME_REPLAY_LIVE (-1)
+
+/*
+ * Open a recording for playback.  Call after the CLI has overridden
+ * ctx->config and before game systems are created: the recording's
+ * speed, start level, control mode, sfx and debug options replace the
+ * current ones and its seed is stored in ctx->rng_seed.  With `fast`,
+ * playback skips rendering and frame pacing and the game exits when the
+ * recording ends.  Returns false (message printed) on failure.
+ */
+bool game_replay_open_playback(game_ctx_t *ctx, const char *path, bool fast);
+
+/*
+ * Start recording to `path`.  Call once ctx->rng has been seeded from
+ * ctx->rng_seed.  Returns false (message printed) on failure.
+ */
+bool game_replay_open_record(game_ctx_t *ctx, const char *path);
+
+/* True while a recording is being played back. */
+bool game_replay_playing(const game_ctx_t *ctx);
+
+/* True while playing back in -replay-fast mode. */
+bool game_replay_fast(const game_ctx_t *ctx);
+
+/*
+ * Log a keystroke delivered to the dialogue this frame (recording only;
+ * a no-op otherwise).  Call alongside dialogue_system_key_input.
+ */
+void game_replay_note_dialogue_key(game_ctx_t *ctx, dialogue_key_type_t key, char ch);
+
+/*
+ * Settle this frame's input.  During playback: load the next recorded
+ * frame into sdl2_input, deliver its dialogue keystrokes, and return the
+ * tick count to step.  When the recording runs out, print a summary and
+ * return GAME_REPLAY_LIVE (live play resumes).  When recording: snapshot
+ * the input.  Returns GAME_REPLAY_LIVE whenever the caller should run
+ * the loop from wall time.
+ */
+int game_replay_frame_input(game_ctx_t *ctx);
+
+/*
+ * Finish the frame: append it to the recording with the ticks that ran,
+ * and during normal-speed playback, sleep to hold the recorded tick rate.
+ */
+void game_replay_frame_done(game_ctx_t *ctx, int ticks);
+
+/*
+ * True once -replay-fast playback has consumed the whole recording and
+ * the game should exit.
+ */
+bool game_replay_finished(const game_ctx_t *ctx);
+
+/* Flush and close any recording/playback.  Safe to call repeatedly. */
+void game_replay_close(game_ctx_t *ctx);
+
+#endif /* GAME_REPLAY_H */
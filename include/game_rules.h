@@ -9,6 +9,7 @@
 #define GAME_RULES_H
 
 #include "game_context.h"
+#include "level_system.h"
 
 /*
  * Check game rules for the current frame.
@@ -31,6 +32,25 @@ void game_rules_ball_died(game_ctx_t *ctx);
  */
 void game_rules_next_level(game_ctx_t *ctx);
 
+/*
+ * Load a stock level file (e.g. "level01.data") into ctx->level.  The
+ * file is read from the asset pack (ADR-098) when it holds it, else
+ * resolved with paths_level_file().  XBOING_LEVELS_DIR bypasses the
+ * pack, so a developer's edited levels always win.
+ *
+ * Returns LEVEL_SYS_ERR_FILE_NOT_FOUND when no source has the file,
+ * otherwise the level_system load status.  Does not clear the block
+ * grid.
+ */
+level_system_status_t game_rules_load_level(game_ctx_t *ctx, const char *filename);
+
+/*
+ * True if game_rules_load_level() would find filename: in the pack, or
+ * as a readable file.  Lets callers check before tearing down the
+ * current level.
+ */
+bool game_rules_level_available(const game_ctx_t *ctx, const char *filename);
+
 /*
  * Check if any active ball overlaps the eyedude.
  * On hit: set eyedude to DIE state. Score, sound, and message fire
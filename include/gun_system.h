@@ -13,6 +13,10 @@
  * See ADR-018 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+
+#include "sound_catalog.h"
+
 /* =========================================================================
  * Status codes
  * ========================================================================= */
@@ -98,7 +102,7 @@ typedef struct
     void (*on_eyedude_hit)(void *ud);
 
     /* Sound playback at per-call volume (0-100 percent of master). */
-    void (*on_sound)(const char *name, int volume, void *ud);
+    void (*on_sound)(sound_id_t sound, int volume, void *ud);
 
     /*
      * Ball-waiting query: returns nonzero if ball is waiting on paddle.
@@ -257,6 +261,25 @@ int gun_system_get_active_bullet_count(const gun_system_t *ctx);
 /* Return number of active tinks. */
 int gun_system_get_active_tink_count(const gun_system_t *ctx);
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: bullets and tinks in flight, ammo, unlimited flag and
+ * the last update frame.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any gun_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t gun_system_snapshot_size(void);
+
+/* Copy the current state into buf (gun_system_snapshot_size() bytes). */
+void gun_system_snapshot_save(const gun_system_t *ctx, void *buf);
+
+/* Replace the current state with a saved snapshot.  No callbacks fire. */
+void gun_system_snapshot_load(gun_system_t *ctx, const void *buf);
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
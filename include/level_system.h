@@ -13,6 +13,8 @@
  * See ADR-020 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+
 #include "block_types.h" /* Block type constants, MAX_ROW, MAX_COL */
 
 /* =========================================================================
@@ -101,6 +103,14 @@ void level_system_destroy(level_system_t *ctx);
  */
 level_system_status_t level_system_load_file(level_system_t *ctx, const char *path);
 
+/*
+ * Load a level from size bytes of level file text at data, e.g. an entry
+ * of the asset pack (ADR-098).  The text need not be NUL-terminated and
+ * is only read during the call.  Same parsing and results as
+ * level_system_load_file(); an empty buffer is LEVEL_SYS_ERR_PARSE_FAILED.
+ */
+level_system_status_t level_system_load_memory(level_system_t *ctx, const char *data, size_t size);
+
 /* =========================================================================
  * Background cycling
  * ========================================================================= */
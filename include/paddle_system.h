@@ -12,6 +12,8 @@
  * See ADR-017 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+
 /* =========================================================================
  * Status codes
  * ========================================================================= */
@@ -189,6 +191,25 @@ int paddle_system_get_sticky(const paddle_system_t *ctx);
 paddle_system_status_t paddle_system_get_render_info(const paddle_system_t *ctx,
                                                      paddle_system_render_info_t *info);
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: position, size, reverse/sticky flags and the mouse
+ * delta tracking.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any paddle_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t paddle_system_snapshot_size(void);
+
+/* Copy the current state into buf (paddle_system_snapshot_size() bytes). */
+void paddle_system_snapshot_save(const paddle_system_t *ctx, void *buf);
+
+/* Replace the current state with a saved snapshot.  No callbacks fire. */
+void paddle_system_snapshot_load(paddle_system_t *ctx, const void *buf);
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
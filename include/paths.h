@@ -173,4 +173,19 @@ paths_status_t paths_user_data_dir(const paths_config_t *cfg, char *buf, size_t
 paths_status_t paths_install_data_dir(const paths_config_t *cfg, const char *subdir, char *buf,
                                       size_t bufsize);
 
+/*
+ * Resolve a file that sits directly in the system data directory, such
+ * as the asset pack "xboing.pak" (ADR-098).
+ *
+ * Resolution order:
+ *   1. $XDG_DATA_DIRS entries: <dir>/xboing/<filename>
+ *   2. cfg->install_data_dir/<filename>  — compiled install prefix
+ *
+ * There is no cwd tier: a source tree has no installed data files.
+ * Returns PATHS_NOT_FOUND if no candidate exists, PATHS_TRUNCATED if a
+ * candidate does not fit in buf.
+ */
+paths_status_t paths_install_data_file(const paths_config_t *cfg, const char *filename, char *buf,
+                                       size_t bufsize);
+
 #endif /* PATHS_H */
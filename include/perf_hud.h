@@ -0,0 +1,147 @@
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+/*
+ * perf_hud.h — Numbers behind the on-screen performance HUD.
+ *
+ * Collects, for each frame the main loop runs while the HUD is shown, the
+ * frame time, the ticks sdl2_loop stepped and the draw calls and texture
+ * switches counted by sdl2_draw.  Every PERF_HUD_WINDOW_US of frame time
+ * the window is folded into a summary (FPS, mean and worst frame time,
+ * per-frame means of the rest) and the heaviest profiler zones over the
+ * same window are read from the trace module's statistics, so the text
+ * changes at a readable pace.  The last PERF_HUD_HISTORY frame times are
+ * kept for a sparkline.
+ *
+ * Showing the HUD starts the trace statistics and hiding it stops them,
+ * so a hidden HUD costs nothing per zone.  Zone costs need the zones
+ * compiled in (XBOING_TRACE); without them the list is empty.
+ *
+ * Pure C, no SDL2: game_render.c draws the summary.  Opaque context
+ * pattern.  See ADR-092 in docs/DESIGN.md.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "trace.h"
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+/* Frame times kept for the sparkline. */
+#define PERF_HUD_HISTORY 120
+
+/* Frame time folded into each summary: two refreshes of the text a second. */
+#define PERF_HUD_WINDOW_US 500000U
+
+/* Profiler zones listed, heaviest first. */
+#define PERF_HUD_MAX_ZONES 5
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    PERF_HUD_OK = 0,
+    PERF_HUD_ERR_NULL_ARG,
+    PERF_HUD_ERR_ALLOC_FAILED
+} perf_hud_status_t;
+
+/* =========================================================================
+ * Summary
+ * ========================================================================= */
+
+typedef struct
+{
+    const char *name;    /* Zone name, as passed to TRACE_BEGIN */
+    double ms_per_frame; /* Mean time in the zone per frame */
+} perf_hud_zone_t;
+
+/* The last completed window; all zero until the first one closes. */
+typedef struct
+{
+    int frames;              /* Frames in the window */
+    double fps;              /* frames / window duration */
+    double frame_ms_mean;    /* Frame time: mean */
+    double frame_ms_max;     /* and worst */
+    double ticks_per_frame;  /* Mean game ticks per frame */
+    int ticks_max;           /* Most ticks in one frame */
+    double draw_calls;       /* Mean draw calls per frame */
+    double texture_switches; /* Mean texture switches per frame */
+    int zone_count;          /* Valid entries in zones[] */
+    perf_hud_zone_t zones[PERF_HUD_MAX_ZONES];
+} perf_hud_summary_t;
+
+/* =========================================================================
+ * Opaque context
+ * ========================================================================= */
+
+typedef struct perf_hud perf_hud_t;
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+/*
+ * Create a hidden HUD.  clock_fn is handed to trace_stats_start() when
+ * the HUD is shown and is required.
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason.
+ */
+perf_hud_t *perf_hud_create(trace_clock_fn clock_fn, perf_hud_status_t *status);
+
+/* Destroy the HUD, stopping the trace statistics if it was shown.  Safe
+ * to call with NULL. */
+void perf_hud_destroy(perf_hud_t *ctx);
+
+/* =========================================================================
+ * Visibility
+ * ========================================================================= */
+
+/*
+ * Show or hide the HUD.  Showing clears the history and summary and
+ * starts the trace statistics; hiding stops them.
+ */
+void perf_hud_set_visible(perf_hud_t *ctx, bool visible);
+
+/* True while shown; false for NULL. */
+bool perf_hud_is_visible(const perf_hud_t *ctx);
+
+/* =========================================================================
+ * Per-frame input (ignored while hidden)
+ * ========================================================================= */
+
+/* Add draws made during the current frame (from sdl2_draw_take_stats). */
+void perf_hud_add_draws(perf_hud_t *ctx, uint32_t draw_calls, uint32_t texture_switches);
+
+/*
+ * Close the current frame: frame_us since the previous frame started and
+ * the ticks stepped.  Refreshes the summary when the window is full.
+ */
+void perf_hud_end_frame(perf_hud_t *ctx, uint64_t frame_us, int ticks);
+
+/* =========================================================================
+ * Queries
+ * ========================================================================= */
+
+/* Copy the last summary.  Zeroes *out for a NULL ctx. */
+void perf_hud_get_summary(const perf_hud_t *ctx, perf_hud_summary_t *out);
+
+/*
+ * Copy up to max recent frame times in microseconds, oldest first, ending
+ * with the newest.  Returns the number copied; 0 for NULL arguments.
+ */
+size_t perf_hud_history(const perf_hud_t *ctx, uint32_t *out_us, size_t max);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *perf_hud_status_string(perf_hud_status_t status);
+
+#endif /* PERF_HUD_H */
@@ -0,0 +1,154 @@
+/*
+ * replay_io.h — Compact binary input recording for deterministic replay.
+ *
+ * A replay is the RNG seed and gameplay options a session started with,
+ * followed by one record per visual frame: the input state the game saw
+ * (held/just-pressed action bits, mouse position and buttons, shift,
+ * dialogue keystrokes) and how many logic ticks ran after it.  Given the
+ * same seed the game is a pure function of that stream, so feeding it
+ * back reproduces the session tick for tick.
+ *
+ * File layout (all multi-byte integers little-endian):
+ *
+ *   "XBRP"  u8 version  u8 flags  u8 speed  u8 start_level  u64 seed
+ *   frame*
+ *
+ * Each frame starts with a byte of REPLAY_F_* bits naming the fields
+ * that differ from the previous frame; only those follow, as LEB128
+ * varints (XOR deltas for bit masks, zigzag deltas for mouse position).
+ * A zero byte is a run: a varint count of frames identical to the
+ * previous one with no edges or keystrokes — the common case, so an idle
+ * minute costs a few bytes.
+ *
+ * Pure C — no SDL2 dependency.  Action and key values are stored as
+ * plain integers; the integration layer maps them to sdl2_input and
+ * dialogue_system.
+ */
+
+#ifndef REPLAY_IO_H
+#define REPLAY_IO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+#define REPLAY_IO_VERSION 1
+
+/* Dialogue keystrokes kept per frame; extras in one frame are dropped. */
+#define REPLAY_MAX_KEYS 16
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    REPLAY_IO_OK = 0,
+    REPLAY_IO_END, /* No more frames (read only) */
+    REPLAY_IO_ERR_NULL_ARG,
+    REPLAY_IO_ERR_OPEN,       /* fopen failed */
+    REPLAY_IO_ERR_WRITE,      /* Short write or close failure */
+    REPLAY_IO_ERR_BAD_FORMAT, /* Wrong magic/version or truncated frame */
+    REPLAY_IO_ERR_ALLOC_FAILED
+} replay_io_status_t;
+
+/* =========================================================================
+ * Types
+ * ========================================================================= */
+
+/* Options that change how the simulation evolves. */
+typedef struct
+{
+    uint64_t seed;   /* Seed game_ctx_t's rng was started from */
+    int speed;       /* Starting warp 1-9 */
+    int start_level; /* Starting level 1-80 */
+    bool use_keys;   /* Keyboard (true) or mouse (false) paddle control */
+    bool sfx;        /* Special effects on (sfx draws from the RNG) */
+    bool debug;      /* -debug cheats enabled */
+} replay_header_t;
+
+/* One dialogue keystroke: a dialogue_key_type_t and its character. */
+typedef struct
+{
+    uint8_t key;
+    char ch;
+} replay_key_t;
+
+/* Input seen in one visual frame and the ticks that ran after it. */
+typedef struct
+{
+    uint32_t ticks;       /* Logic ticks dispatched this frame */
+    uint32_t held;        /* Bit per sdl2_input_action_t: key held */
+    uint32_t edge;        /* Bit per sdl2_input_action_t: pressed this frame */
+    int32_t mouse_x;      /* Pointer position, window coordinates */
+    int32_t mouse_y;      /* Pointer position, window coordinates */
+    uint32_t buttons;     /* SDL_BUTTON mask: held */
+    uint32_t button_edge; /* SDL_BUTTON mask: pressed this frame */
+    bool shift;           /* Either Shift held */
+    int key_count;        /* Entries used in keys[] */
+    replay_key_t keys[REPLAY_MAX_KEYS];
+} replay_frame_t;
+
+/* =========================================================================
+ * Opaque contexts
+ * ========================================================================= */
+
+typedef struct replay_io_writer replay_io_writer_t;
+typedef struct replay_io_reader replay_io_reader_t;
+
+/* =========================================================================
+ * Writing
+ * ========================================================================= */
+
+/*
+ * Create `path` (truncating) and write the header.
+ * Returns NULL on failure (sets *status if non-NULL).
+ */
+replay_io_writer_t *replay_io_write_open(const char *path, const replay_header_t *header,
+                                         replay_io_status_t *status);
+
+/* Append one frame.  Returns REPLAY_IO_ERR_WRITE once any write fails. */
+replay_io_status_t replay_io_write_frame(replay_io_writer_t *w, const replay_frame_t *frame);
+
+/*
+ * Flush any pending run, close the file, and free the writer.
+ * Returns the first error seen over the writer's life.  Safe with NULL.
+ */
+replay_io_status_t replay_io_write_close(replay_io_writer_t *w);
+
+/* =========================================================================
+ * Reading
+ * ========================================================================= */
+
+/*
+ * Open `path` and read the header into *header.
+ * Returns NULL on failure (sets *status if non-NULL).  A speed or start
+ * level outside the -speed/-startlevel ranges is REPLAY_IO_ERR_BAD_FORMAT.
+ */
+replay_io_reader_t *replay_io_read_open(const char *path, replay_header_t *header,
+                                        replay_io_status_t *status);
+
+/*
+ * Decode the next frame into *frame.  Returns REPLAY_IO_END after the
+ * last frame, REPLAY_IO_ERR_BAD_FORMAT on a truncated or corrupt record,
+ * including a tick count above SDL2L_TURBO_MAX_TICKS_PER_UPDATE.
+ */
+replay_io_status_t replay_io_read_frame(replay_io_reader_t *r, replay_frame_t *frame);
+
+/* Frames decoded so far. */
+uint64_t replay_io_frames_read(const replay_io_reader_t *r);
+
+/* Close the file and free the reader.  Safe with NULL. */
+void replay_io_read_close(replay_io_reader_t *r);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *replay_io_status_string(replay_io_status_t status);
+
+#endif /* REPLAY_IO_H */
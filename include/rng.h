@@ -0,0 +1,41 @@
+/*
+ * rng.h — Small seedable pseudo-random number generator (PCG32).
+ *
+ * Replaces the process-global rand() stream for gameplay.  Each game or
+ * simulation instance owns one rng_t and hands it to its systems through
+ * their rand_fn hook, so two instances never share state: they can run on
+ * different threads, and one instance replays bit-exactly from its seed
+ * no matter what else in the process consumes random numbers.
+ *
+ * rng_next() returns a non-negative int in [0, RNG_MAX], the same range
+ * contract as rand() with glibc's RAND_MAX, so existing `% n` and `>> 16`
+ * expressions keep their distribution.
+ *
+ * The state is a plain struct (no allocation) so it can live inline in a
+ * context and be copied with it.
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/* Largest value rng_next() returns. */
+#define RNG_MAX 0x7fffffff
+
+typedef struct
+{
+    uint64_t state;
+    uint64_t inc; /* Stream selector — always odd */
+} rng_t;
+
+/* Seed the generator.  Equal seeds produce equal sequences. */
+void rng_seed(rng_t *rng, uint64_t seed);
+
+/* Return the next 32-bit output. */
+uint32_t rng_next_u32(rng_t *rng);
+
+/* Return the next output in [0, RNG_MAX] — drop-in for rand(). */
+int rng_next(rng_t *rng);
+
+#endif /* RNG_H */
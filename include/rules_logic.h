@@ -0,0 +1,159 @@
+#ifndef RULES_LOGIC_H
+#define RULES_LOGIC_H
+
+/*
+ * rules_logic.h — Gameplay rules shared by the game and the simulation.
+ *
+ * The state-changing halves of the ball, gun and explosion callbacks,
+ * ball death, and bonus block spawning.  src/game_callbacks.c and
+ * src/game_rules.c call these with the game's systems; src/sim_system.c
+ * calls them with its own.  A rule therefore has one home, and a
+ * simulated level follows the real game's rules by construction.
+ *
+ * No SDL2 dependency.  Audio, screen shake, messages and mode changes
+ * stay with the caller: the functions report what happened, or call the
+ * optional effect hooks in rules_logic_t.
+ *
+ * See ADR-075 in docs/DESIGN.md.
+ */
+
+#include <stdbool.h>
+
+#include "ball_system.h"
+#include "block_system.h"
+#include "eyedude_system.h"
+#include "gun_system.h"
+#include "paddle_system.h"
+#include "rng.h"
+#include "score_system.h"
+#include "special_system.h"
+
+/* Legacy bonus spawning interval — original/main.c BONUS_SEED. */
+#define RULES_BONUS_SEED 2000
+
+/* Bullet half-extents for the eyedude hit test.  The bullet sprite is
+ * 7x10 (original) / 7x16 (modern PNG with alpha padding); 4x5 gives a
+ * slightly forgiving AABB. */
+#define RULES_EYEDUDE_BULLET_HW 4
+#define RULES_EYEDUDE_BULLET_HH 5
+
+/* Bullet-to-ball hit radius in pixels. */
+#define RULES_BULLET_BALL_RADIUS 15
+
+/*
+ * The systems and state a rule reads and writes.  Every pointer is
+ * borrowed from the caller (game_ctx_t or sim_system_t) and must be
+ * non-NULL, except the effect hooks.  Build one per call; it is cheap.
+ */
+typedef struct
+{
+    ball_system_t *ball;
+    block_system_t *block;
+    paddle_system_t *paddle;
+    gun_system_t *gun;
+    score_system_t *score;
+    special_system_t *special;
+    eyedude_system_t *eyedude;
+    rng_t *rng;
+
+    /* Caller-owned state */
+    int *lives_left;
+    int *time_remaining;
+    int *bonus_count;        /* BONUS_BLK pickups this level */
+    bool *bonus_block_active; /* a spawned bonus/special block is on the grid */
+    int *next_bonus_frame;   /* frame the next spawn may happen; 0 = unscheduled */
+    int *bonus_row;          /* cell and type of the active spawned block */
+    int *bonus_col;
+    int *bonus_type;
+
+    /* Block grid cell size in pixels, for the bullet hit test */
+    int col_width;
+    int row_height;
+
+    /* Returns the ball environment for the current paddle and specials.
+     * Called after the rule changes them, so the env is always current. */
+    ball_system_env_t (*ball_env)(void *user_data);
+
+    /* Optional effect hooks (NULL = no effect) */
+    void (*on_block_sound)(int block_type, void *user_data); /* block hit */
+    void (*on_shake)(void *user_data);                       /* bomb explosion */
+
+    void *user_data;
+} rules_logic_t;
+
+/* Result of rules_logic_ball_died(). */
+typedef enum
+{
+    RULES_BALL_OTHERS_LEFT = 0, /* Multiball: other balls still in play */
+    RULES_BALL_RESPAWN,         /* New ball placed on the paddle */
+    RULES_BALL_GAME_OVER        /* No lives left; caller ends the game */
+} rules_ball_death_t;
+
+/* =========================================================================
+ * Ball callbacks
+ * ========================================================================= */
+
+/*
+ * Apply a ball hitting the block at (row, col): arm its explosion and
+ * apply the pickup effect (reverse, multiball, sticky, paddle size,
+ * machine gun, walls off, extra ball, death).  Counter and black blocks
+ * only explode on their last hit.  Score is awarded at finalize.
+ *
+ * Returns how the ball reacts.  Calls on_block_sound for every block
+ * that explodes, and for a hyperspace block.
+ */
+block_hit_result_t rules_logic_block_hit(const rules_logic_t *r, int row, int col,
+                                         int ball_index, int frame);
+
+/*
+ * Apply the end of a block's explosion: award hit_points (with the x2/x4
+ * multiplier) and the finalize-only effects (bomb chain, x2/x4, timer,
+ * ammo, unlimited ammo, bonus count and killer mode).  Calls on_shake
+ * for a bomb.
+ */
+void rules_logic_block_finalize(const rules_logic_t *r, int row, int col, int block_type,
+                                int hit_points, int frame);
+
+/*
+ * Apply the loss of a ball.  When it was the last one, either reports
+ * game over, or grants the consolation ammo, resets the paddle and
+ * places a new ball.  With keep_lives (editor play-test) lives are never
+ * taken and the game never ends.
+ */
+rules_ball_death_t rules_logic_ball_died(const rules_logic_t *r, bool keep_lives);
+
+/* =========================================================================
+ * Gun callbacks
+ * ========================================================================= */
+
+/* Find the occupied block under a bullet at (bx, by).  Returns 1 and
+ * fills *out_row, *out_col on a hit, else 0. */
+int rules_logic_bullet_block_at(const rules_logic_t *r, int bx, int by, int *out_row,
+                                int *out_col);
+
+/*
+ * Apply a bullet hitting the block at (row, col).  Returns the block type
+ * when the bullet destroys it (its explosion is armed and on_block_sound
+ * called), or NONE_BLK when the block absorbs the bullet.
+ */
+int rules_logic_bullet_block_hit(const rules_logic_t *r, int row, int col, int frame);
+
+/* Return the index of the active ball a bullet at (bx, by) hits, or -1. */
+int rules_logic_bullet_ball_at(const rules_logic_t *r, int bx, int by);
+
+/* Return nonzero when the eyedude may walk: the top block row is empty. */
+int rules_logic_eyedude_path_clear(const rules_logic_t *r);
+
+/* =========================================================================
+ * Bonus block spawning
+ * ========================================================================= */
+
+/*
+ * Per-tick bonus spawning: expire the active spawned block when its
+ * lifetime ends, schedule the next spawn, and on the scheduled frame roll
+ * for a bonus, special, dynamite or eyedude.  Port of the switch in
+ * original/main.c:handleGameMode().
+ */
+void rules_logic_spawn_bonus(const rules_logic_t *r, int frame);
+
+#endif /* RULES_LOGIC_H */
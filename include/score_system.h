@@ -14,6 +14,7 @@
  * See ADR-019 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
 #include <sys/types.h> /* u_long */
 
 /* =========================================================================
@@ -156,6 +157,24 @@ void score_system_get_digit_layout(u_long score_value, score_system_digit_layout
 /* Return the current extra life threshold index. */
 int score_system_get_life_threshold(const score_system_t *ctx);
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: the score and the extra-life threshold.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any score_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t score_system_snapshot_size(void);
+
+/* Copy the current state into buf (score_system_snapshot_size() bytes). */
+void score_system_snapshot_save(const score_system_t *ctx, void *buf);
+
+/* Replace the current state with a saved snapshot.  No callbacks fire. */
+void score_system_snapshot_load(score_system_t *ctx, const void *buf);
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
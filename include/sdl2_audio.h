@@ -7,11 +7,21 @@
  * Replaces the legacy fork+pipe /dev/dsp architecture with SDL2_mixer.
  * Scans a sound directory for .wav files at creation time, caches them
  * as Mix_Chunk objects in a hash map for O(1) lookup by name (e.g., "boing").
+ * Hot paths play by integer ID instead: a registry of keys passed in the
+ * config is resolved to cache entries at creation (ADR-096).  The .wav
+ * files can instead be decoded on an sdl2_decode pool and collected
+ * later with sdl2_audio_finish_decode() (ADR-097).  An installed game
+ * reads them from an asset pack instead, as PCM ready for the mixer
+ * (ADR-098).
  *
  * Supports concurrent playback by reserving a free channel via
  * Mix_GroupAvailable, setting its volume, and starting the play on
  * that explicit channel — so per-call volume is deterministic from
  * the first sample.
+ * A voice manager shares the channels out (ADR-095): each sound has a
+ * priority class; when every channel is busy the oldest voice of the
+ * lowest priority not above the new sound is stolen, and repeats of a
+ * sound within one game tick merge into a single voice.
  * Master volume is a global setting; per-call volume is supported via
  * sdl2_audio_play_at_percent() and matches the original's Sun backend
  * (original/audio/SUNaudio.c:243).  The LINUXaudio.c shim that ships in
@@ -27,6 +37,9 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 
+#include "asset_pack.h"
+#include "sdl2_decode.h"
+
 /* Maximum length of a sound cache key (basename without extension). */
 #define SDL2A_MAX_KEY_LEN 64
 
@@ -49,6 +62,9 @@
 /* Volume step for increment/decrement (1%). */
 #define SDL2A_VOLUME_STEP 1
 
+/* sdl2_decode batch used for sound files. */
+#define SDL2A_DECODE_BATCH 2
+
 /* Status codes returned by sdl2_audio functions. */
 typedef enum
 {
@@ -63,6 +79,25 @@ typedef enum
     SDL2A_ERR_PLAY_FAILED
 } sdl2_audio_status_t;
 
+/*
+ * Priority class of a sound, for voice stealing.  A sound may take over
+ * the channel of a sound of equal or lower class, never higher.
+ */
+typedef enum
+{
+    SDL2A_PRIORITY_LOW = 0, /* Frequent collision chatter */
+    SDL2A_PRIORITY_NORMAL,  /* Default for every sound */
+    SDL2A_PRIORITY_HIGH     /* Game events that must be heard */
+} sdl2_audio_priority_t;
+
+/* Voice manager counters since the context was created. */
+typedef struct
+{
+    int dropped;   /* No channel free and none could be stolen */
+    int stolen;    /* Plays that cut off an older voice */
+    int coalesced; /* Repeats merged into a voice started the same tick */
+} sdl2_audio_voice_stats_t;
+
 /*
  * Configuration for sdl2_audio_create().
  * Use sdl2_audio_config_defaults() for sane starting values,
@@ -75,6 +110,15 @@ typedef struct
     int channels;          /* SDL_mixer playback channels, default: 16 */
     int chunk_size;        /* audio buffer size, default: 2048 */
     int volume;            /* master volume 0-128, default: MIX_MAX_VOLUME */
+    /* Sound ID registry for sdl2_audio_play_id(): id_keys[i] is the key
+     * of ID i.  The table must outlive the context (e.g. the sound
+     * catalog's sound_key_table()).  Default: NULL, 0 (no IDs). */
+    const char *const *id_keys;
+    int id_count;           /* at most SDL2A_MAX_SOUNDS */
+    sdl2_decode_t *decoder; /* decode the files here; NULL = load in create */
+    /* Borrowed; used instead of sound_dir and decoder if it has sounds.
+     * Must stay open until the context is destroyed. */
+    const asset_pack_t *pack;
 } sdl2_audio_config_t;
 
 /* Opaque audio context — allocated by create, freed by destroy. */
@@ -87,6 +131,9 @@ typedef struct sdl2_audio sdl2_audio_t;
  *   channels   = 16
  *   chunk_size = 2048
  *   volume     = MIX_MAX_VOLUME (128)
+ *   id_keys    = NULL, id_count = 0
+ *   decoder    = NULL
+ *   pack       = NULL
  */
 sdl2_audio_config_t sdl2_audio_config_defaults(void);
 
@@ -95,7 +142,19 @@ sdl2_audio_config_t sdl2_audio_config_defaults(void);
  * then scans sound_dir for .wav files and caches each as a Mix_Chunk.
  *
  * Keys are derived from the filename by stripping the .wav extension
- * (e.g., "boing.wav" -> "boing").
+ * (e.g., "boing.wav" -> "boing").  Once the directory is loaded, each
+ * ID in config->id_keys is resolved to its cache entry; IDs whose key
+ * is not cached are logged and play as SDL2A_ERR_NOT_FOUND.  An
+ * id_count above SDL2A_MAX_SOUNDS fails with SDL2A_ERR_CACHE_FULL.
+ *
+ * With config->decoder set, the files are only submitted to it (batch
+ * SDL2A_DECODE_BATCH) and the cache stays empty until
+ * sdl2_audio_finish_decode(), which also resolves the IDs.
+ *
+ * With config->pack holding any "sounds/" entries, neither sound_dir nor
+ * the decoder is used: each ASSET_PACK_PCM entry is cached under its key
+ * minus "sounds/".  Samples already in the device's format are played
+ * straight from the mapping; others are converted once, here.
  *
  * Partial loads succeed — individual file failures are logged but do not
  * abort.  Only structural failures (Mix_OpenAudio failure, unreadable
@@ -106,6 +165,15 @@ sdl2_audio_config_t sdl2_audio_config_defaults(void);
  */
 sdl2_audio_t *sdl2_audio_create(const sdl2_audio_config_t *config, sdl2_audio_status_t *status);
 
+/*
+ * Collect the sounds queued on config->decoder by sdl2_audio_create(),
+ * waiting for any still decoding, and resolve the ID registry.  The
+ * decoder is not used afterwards and may be destroyed.  Returns the
+ * number of files that failed.  No-op (returns 0) for NULL, for a
+ * context created without a decoder, or when called again.
+ */
+int sdl2_audio_finish_decode(sdl2_audio_t *ctx);
+
 /*
  * Destroy the audio context: frees all cached Mix_Chunk objects, closes
  * the audio device, and quits SDL_mixer if this context initialized it.
@@ -119,9 +187,13 @@ void sdl2_audio_destroy(sdl2_audio_t *ctx);
  * master, then starts playback so the first sample is at the intended
  * volume (avoids the volume-jump that would happen if a recycled
  * channel still carried a per-call attenuation from
- * sdl2_audio_play_at_percent).  Returns SDL2A_ERR_NOT_FOUND if the
- * name is not in the cache, or SDL2A_ERR_PLAY_FAILED if no channel
- * is available or Mix_PlayChannel rejects the play.
+ * sdl2_audio_play_at_percent).  If the same sound was already started
+ * since the last sdl2_audio_begin_tick() and is still playing, that
+ * voice is reused at the louder of the two volumes.  With no channel
+ * free, the oldest voice of the lowest priority class not above this
+ * sound's is stolen.  Returns SDL2A_ERR_NOT_FOUND if the name is not
+ * in the cache, or SDL2A_ERR_PLAY_FAILED if every voice outranks the
+ * sound or Mix_PlayChannel rejects the play.
  * Fire-and-forget — the channel plays to completion. */
 sdl2_audio_status_t sdl2_audio_play(sdl2_audio_t *ctx, const char *name);
 
@@ -135,6 +207,41 @@ sdl2_audio_status_t sdl2_audio_play(sdl2_audio_t *ctx, const char *name);
  * identical to sdl2_audio_play(). */
 sdl2_audio_status_t sdl2_audio_play_at_percent(sdl2_audio_t *ctx, const char *name, int percent);
 
+/*
+ * Play a sound by registry ID (see sdl2_audio_config_t.id_keys) at a
+ * per-call volume percentage.  Same behaviour and logging as
+ * sdl2_audio_play_at_percent() with the ID's key, without hashing the
+ * key: the entry was resolved at create.  SDL2A_ERR_NOT_FOUND for IDs
+ * that are out of range or whose sound is not cached.
+ */
+sdl2_audio_status_t sdl2_audio_play_id(sdl2_audio_t *ctx, int id, int percent);
+
+/*
+ * Set the priority class of a cached sound (default
+ * SDL2A_PRIORITY_NORMAL).  Returns SDL2A_ERR_NOT_FOUND if the name is
+ * not in the cache.
+ */
+sdl2_audio_status_t sdl2_audio_set_priority(sdl2_audio_t *ctx, const char *name,
+                                            sdl2_audio_priority_t priority);
+
+/*
+ * Set the priority class of a sound by registry ID.  Same as
+ * sdl2_audio_set_priority() with the ID's key.  SDL2A_ERR_NOT_FOUND for
+ * IDs that are out of range or whose sound is not cached.
+ */
+sdl2_audio_status_t sdl2_audio_set_priority_id(sdl2_audio_t *ctx, int id,
+                                               sdl2_audio_priority_t priority);
+
+/*
+ * Start a new coalescing window: plays of the same sound after this
+ * call no longer merge with voices started before it.  Call once per
+ * game tick.  No-op for NULL.
+ */
+void sdl2_audio_begin_tick(sdl2_audio_t *ctx);
+
+/* Copy the voice manager counters into *out (zeros for a NULL ctx). */
+void sdl2_audio_get_voice_stats(const sdl2_audio_t *ctx, sdl2_audio_voice_stats_t *out);
+
 /*
  * Set the master volume (0 = silent, MIX_MAX_VOLUME = full).
  * Applies immediately to all channels.
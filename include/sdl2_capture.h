@@ -0,0 +1,87 @@
+#ifndef SDL2_CAPTURE_H
+#define SDL2_CAPTURE_H
+
+/*
+ * sdl2_capture.h — Asynchronous frame capture to PNG files.
+ *
+ * sdl2_capture_frame() reads the renderer's current frame into one of a
+ * fixed pool of buffers with SDL_RenderReadPixels and queues it; a
+ * background encoder thread writes the queued frames to PNG files in
+ * order.  The render thread waits only when every buffer is still queued,
+ * so capture throughput is bounded by encoding, never by the display.
+ *
+ * Call sdl2_capture_frame() after drawing and before presenting: once a
+ * frame is presented the backbuffer contents are undefined.
+ *
+ * Opaque context pattern.  See ADR-093 in docs/DESIGN.md.
+ */
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+/* Status codes returned by sdl2_capture functions. */
+typedef enum
+{
+    SDL2CAP_OK = 0,
+    SDL2CAP_ERR_NULL_ARG,
+    SDL2CAP_ERR_BAD_CONFIG,
+    SDL2CAP_ERR_ALLOC_FAILED,
+    SDL2CAP_ERR_THREAD_FAILED,
+    SDL2CAP_ERR_PATH_TOO_LONG,
+    SDL2CAP_ERR_READ_FAILED
+} sdl2_capture_status_t;
+
+/* Longest output path accepted, including the terminator. */
+#define SDL2CAP_MAX_PATH 1024
+
+/* Configuration for sdl2_capture_create(). */
+typedef struct
+{
+    int buffers; /* Frames that can wait for the encoder (>= 1) */
+} sdl2_capture_config_t;
+
+/* Opaque capture context — allocated by create, freed by destroy. */
+typedef struct sdl2_capture sdl2_capture_t;
+
+/*
+ * Return a config populated with defaults:
+ *   buffers = 4
+ */
+sdl2_capture_config_t sdl2_capture_config_defaults(void);
+
+/*
+ * Create a capture context and start its encoder thread.  Buffers are
+ * allocated on first use, sized to the frame.
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason.
+ * The caller owns the returned context and must call sdl2_capture_destroy().
+ */
+sdl2_capture_t *sdl2_capture_create(const sdl2_capture_config_t *config,
+                                    sdl2_capture_status_t *status);
+
+/*
+ * Write every queued frame, stop the encoder thread and free the context.
+ * Safe to call with NULL.
+ */
+void sdl2_capture_destroy(sdl2_capture_t *ctx);
+
+/*
+ * Read the renderer's current frame (the whole viewport, in output
+ * pixels) and queue it to be written to path as a PNG.  path is copied.
+ * Waits for a free buffer if all are queued.
+ */
+sdl2_capture_status_t sdl2_capture_frame(sdl2_capture_t *ctx, SDL_Renderer *renderer,
+                                         const char *path);
+
+/* Wait until every queued frame has been written.  No-op for NULL. */
+void sdl2_capture_flush(sdl2_capture_t *ctx);
+
+/* Number of frames written, and of frames the encoder failed to write. */
+int sdl2_capture_written(const sdl2_capture_t *ctx);
+int sdl2_capture_failed(const sdl2_capture_t *ctx);
+
+/* Return a human-readable string for a status code. */
+const char *sdl2_capture_status_string(sdl2_capture_status_t status);
+
+#endif /* SDL2_CAPTURE_H */
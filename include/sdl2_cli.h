@@ -30,6 +30,7 @@
 #define SDL2C_DEFAULT_LEVEL 1
 #define SDL2C_MIN_VOLUME 0
 #define SDL2C_MAX_VOLUME 100
+#define SDL2C_MAX_TEXTURE_BUDGET 4096 /* MiB */
 
 /* =========================================================================
  * Status codes
@@ -71,14 +72,66 @@ typedef struct
     /* Display options */
     bool grab; /* false = no pointer grab (default), true = grab */
 
+    /* Offscreen (ADR-094): render into an in-memory surface with no window
+     * and no video driver, for tests and captures on headless machines. */
+    bool offscreen;
+
     /* Visual-capture: -1 = off, 0+ = SDL2ST_* mode, 99 = all */
     int visual_capture_mode;
     int visual_capture_interval;
 
+    /* -capture-dir (ADR-093): with -visual-capture, write each snapshot
+     * as DIR/<mode>/<substate>-<seq>.png.  Points into argv; NULL = signal
+     * the snapshots on stdout only. */
+    const char *capture_dir;
+
     /* Autoload: when true, main() calls savegame_system_load and
      * enters SDL2ST_GAME immediately, bypassing the attract cycle.
      * Reads from the standard XDG-resolved save paths. */
     bool autoload;
+
+    /* Replay recording/playback (ADR-078).  Paths point into argv;
+     * NULL = off.  replay_fast plays back with rendering and frame pacing
+     * skipped and exits when the recording ends. */
+    const char *record_path;
+    const char *replay_path;
+    bool replay_fast;
+
+    /* Turbo (ADR-080): run logic ticks as fast as a per-frame time budget
+     * allows instead of at the warp rate, rendering once per frame. */
+    bool turbo;
+
+    /* Sprite atlas (ADR-085): pack images onto shared texture pages.
+     * -noatlas loads one texture per image instead. */
+    bool atlas;
+
+    /* Cached layers (ADR-088, ADR-089): compose backgrounds, frames and
+     * blocks into render-target textures.  -nolayers redraws them every
+     * frame. */
+    bool layers;
+
+    /* Frame pacing (ADR-090): sleep until the next frame is due and block
+     * on input while paused.  -nopace runs frames back to back. */
+    bool pace;
+
+    /* Frame profiler (ADR-091): write the timing zones recorded this
+     * session to this file as Chrome trace JSON on exit.  Points into
+     * argv; NULL = off. */
+    const char *trace_path;
+
+    /* Startup profile (ADR-097): print how long each startup phase took
+     * once the game is ready. */
+    bool startup_profile;
+
+    /* Asset pack (ADR-098): read assets from this pack file instead of
+     * the installed xboing.pak.  Points into argv; NULL = search the data
+     * directories. */
+    const char *asset_pack_path;
+
+    /* Texture residency (ADR-099): -texture-budget N loads images on first
+     * use and keeps at most N MiB of them resident (0 = no limit).  -1 =
+     * load them all at startup (default). */
+    int texture_budget;
 } sdl2_cli_config_t;
 
 /* =========================================================================
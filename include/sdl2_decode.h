@@ -0,0 +1,122 @@
+#ifndef SDL2_DECODE_H
+#define SDL2_DECODE_H
+
+/*
+ * sdl2_decode.h — Worker pool that decodes asset files off the main thread.
+ *
+ * Callers submit files in numbered batches, each with the function that
+ * decodes it (IMG_Load for images, Mix_LoadWAV for sounds).  Workers
+ * decode in submission order; sdl2_decode_take() hands the results of a
+ * batch back to the caller's thread in the order they complete, waiting
+ * when none is ready yet.  The caller then does whatever must happen on
+ * its own thread, such as creating textures.
+ *
+ * Decode functions run concurrently and must be safe to call from any
+ * thread; anything they need initialized once (IMG_Init, Mix_OpenAudio)
+ * must be set up before the submit.
+ *
+ * Opaque context pattern.  See ADR-097 in docs/DESIGN.md.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+/* Status codes returned by sdl2_decode functions. */
+typedef enum
+{
+    SDL2D_OK = 0,
+    SDL2D_ERR_NULL_ARG,
+    SDL2D_ERR_BAD_CONFIG,
+    SDL2D_ERR_ALLOC_FAILED,
+    SDL2D_ERR_THREAD_FAILED,
+    SDL2D_ERR_KEY_TOO_LONG
+} sdl2_decode_status_t;
+
+/* Longest key and path accepted, including the terminator. */
+#define SDL2D_MAX_KEY 129
+#define SDL2D_MAX_PATH 1024
+
+/* Upper bound on worker threads. */
+#define SDL2D_MAX_THREADS 8
+
+/* Decode the file at path; return the decoded item, or NULL on failure. */
+typedef void *(*sdl2_decode_fn)(const char *path);
+
+/* Free an item returned by a decode function. */
+typedef void (*sdl2_decode_free_fn)(void *item);
+
+/* Configuration for sdl2_decode_create(). */
+typedef struct
+{
+    int threads; /* Worker threads, 1..SDL2D_MAX_THREADS; 0 = one per CPU */
+} sdl2_decode_config_t;
+
+/* One decoded file handed back by sdl2_decode_take(). */
+typedef struct
+{
+    char key[SDL2D_MAX_KEY];
+    char path[SDL2D_MAX_PATH];
+    void *item; /* Caller now owns it; NULL if the decode failed */
+} sdl2_decode_result_t;
+
+/* Pool counters since the context was created. */
+typedef struct
+{
+    int submitted;
+    int decoded;
+    int failed;       /* Decode function returned NULL */
+    uint64_t work_us; /* Summed decode time across all workers */
+} sdl2_decode_stats_t;
+
+/* Opaque pool context — allocated by create, freed by destroy. */
+typedef struct sdl2_decode sdl2_decode_t;
+
+/*
+ * Return a config populated with defaults:
+ *   threads = 0  (one per CPU, capped at SDL2D_MAX_THREADS)
+ */
+sdl2_decode_config_t sdl2_decode_config_defaults(void);
+
+/*
+ * Create a pool and start its workers.
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason.
+ * The caller owns the returned context and must call sdl2_decode_destroy().
+ */
+sdl2_decode_t *sdl2_decode_create(const sdl2_decode_config_t *config,
+                                  sdl2_decode_status_t *status);
+
+/*
+ * Stop the workers and free the context.  Files not yet started are
+ * dropped; items not yet taken are released with their free function.
+ * Safe to call with NULL.
+ */
+void sdl2_decode_destroy(sdl2_decode_t *ctx);
+
+/*
+ * Queue path for decoding in the given batch.  key and path are copied.
+ * free_fn releases the item if it is never taken.
+ */
+sdl2_decode_status_t sdl2_decode_submit(sdl2_decode_t *ctx, int batch, const char *key,
+                                        const char *path, sdl2_decode_fn decode,
+                                        sdl2_decode_free_fn free_fn);
+
+/*
+ * Take the next completed file of a batch into *out, waiting until one
+ * completes.  Returns false once every file submitted to the batch has
+ * been taken (or for NULL arguments).
+ */
+bool sdl2_decode_take(sdl2_decode_t *ctx, int batch, sdl2_decode_result_t *out);
+
+/* Number of worker threads. */
+int sdl2_decode_threads(const sdl2_decode_t *ctx);
+
+/* Copy the pool counters into *out (zeros for a NULL ctx). */
+void sdl2_decode_get_stats(const sdl2_decode_t *ctx, sdl2_decode_stats_t *out);
+
+/* Return a human-readable string for a status code. */
+const char *sdl2_decode_status_string(sdl2_decode_status_t status);
+
+#endif /* SDL2_DECODE_H */
@@ -0,0 +1,79 @@
+#ifndef SDL2_DRAW_H
+#define SDL2_DRAW_H
+
+/*
+ * sdl2_draw.h — Counted draw calls.
+ *
+ * Thin wrappers over the three SDL draw calls the game uses.  Each does
+ * exactly what the SDL call does and also counts it, plus every change
+ * of source texture between consecutive draws: the points where SDL's
+ * render batching has to start a new batch.  Filled rectangles and lines
+ * count as drawing with no texture.
+ *
+ * The counters are process-wide, like the renderer they describe, and are
+ * touched only from the render thread.  sdl2_draw_take_stats() reads and
+ * clears them, so calling it once per frame yields per-frame numbers for
+ * the performance HUD.  The wrappers are inline so counting costs an
+ * increment and a compare per draw, no extra call.  See ADR-092 in
+ * docs/DESIGN.md.
+ */
+
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+/* Draw counters returned by sdl2_draw_take_stats(). */
+typedef struct
+{
+    uint32_t draw_calls;       /* Copies, fills and lines issued */
+    uint32_t texture_switches; /* Draws whose texture differs from the previous draw's */
+} sdl2_draw_stats_t;
+
+/* Counter state.  Read and written by the inline wrappers; do not touch. */
+typedef struct
+{
+    sdl2_draw_stats_t stats;
+    const SDL_Texture *last_texture; /* Texture of the last draw (NULL = untextured) */
+} sdl2_draw_state_t;
+
+extern sdl2_draw_state_t sdl2_draw_state;
+
+static inline void sdl2_draw_count(const SDL_Texture *texture)
+{
+    sdl2_draw_state.stats.draw_calls++;
+    if (texture != sdl2_draw_state.last_texture)
+    {
+        sdl2_draw_state.stats.texture_switches++;
+        sdl2_draw_state.last_texture = texture;
+    }
+}
+
+/* SDL_RenderCopy, counted. */
+static inline int sdl2_draw_copy(SDL_Renderer *renderer, SDL_Texture *texture,
+                                 const SDL_Rect *src, const SDL_Rect *dst)
+{
+    sdl2_draw_count(texture);
+    return SDL_RenderCopy(renderer, texture, src, dst);
+}
+
+/* SDL_RenderFillRect, counted. */
+static inline int sdl2_draw_fill_rect(SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    sdl2_draw_count(NULL);
+    return SDL_RenderFillRect(renderer, rect);
+}
+
+/* SDL_RenderDrawLine, counted. */
+static inline int sdl2_draw_line(SDL_Renderer *renderer, int x1, int y1, int x2, int y2)
+{
+    sdl2_draw_count(NULL);
+    return SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+}
+
+/*
+ * Copy the counters into *out (if non-NULL) and reset them.  The texture
+ * of the last draw is forgotten too, so the next draw counts as a switch.
+ */
+void sdl2_draw_take_stats(sdl2_draw_stats_t *out);
+
+#endif /* SDL2_DRAW_H */
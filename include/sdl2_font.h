@@ -8,18 +8,39 @@
  * into four enum-indexed slots matching the legacy XLFD bitmap fonts.
  * Provides draw, shadow-draw, centred-shadow-draw, and text measurement.
  *
+ * Rendered strings are kept in an LRU texture cache keyed on (font,
+ * text, colour), and strings made only of SDL2F_GLYPH_CHARS are drawn
+ * from a per-font glyph strip.  See ADR-087.
+ *
+ * The TTF files are read from an asset pack when one is given (ADR-098).
+ *
  * Opaque context pattern: no globals, fully testable.
  * See ADR-006 in docs/DESIGN.md.
  */
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <SDL2/SDL.h>
 
+#include "asset_pack.h"
+
 /* Shadow text offset in pixels (matches legacy DrawShadowText at x+2, y+2). */
 #define SDL2F_SHADOW_OFFSET 2
 
 /* Default font directory (relative to CWD, development mode). */
 #define SDL2F_DEFAULT_FONT_DIR "assets/fonts"
 
+/* Default number of rendered strings kept in the text cache. */
+#define SDL2F_TEXT_CACHE_SIZE 256
+
+/* Longest string (bytes) the text cache holds; longer ones render per draw. */
+#define SDL2F_TEXT_CACHE_MAX_LEN 127
+
+/* Characters drawn glyph by glyph when glyph_atlas is on: the timer and
+ * counter digits, which change too often for the text cache to help. */
+#define SDL2F_GLYPH_CHARS "0123456789:"
+
 /* Font slot identifiers — match the four legacy XLFD fonts in init.c. */
 typedef enum
 {
@@ -49,6 +70,16 @@ typedef struct
     int height;
 } sdl2_font_metrics_t;
 
+/* Text cache counters returned by sdl2_font_cache_stats(). */
+typedef struct
+{
+    uint64_t hits;        /* Draws served by a cached texture */
+    uint64_t misses;      /* Draws that had to render the string */
+    uint64_t evictions;   /* Cached strings dropped to make room */
+    uint64_t glyph_draws; /* Draws assembled from the glyph strip */
+    int entries;          /* Strings currently cached */
+} sdl2_font_cache_stats_t;
+
 /*
  * Configuration for sdl2_font_create().
  * Use sdl2_font_config_defaults() for sane starting values,
@@ -58,6 +89,11 @@ typedef struct
 {
     SDL_Renderer *renderer; /* required — borrowed, not owned */
     const char *font_dir;   /* default: SDL2F_DEFAULT_FONT_DIR */
+    int text_cache_size;    /* default: SDL2F_TEXT_CACHE_SIZE; 0 disables */
+    bool glyph_atlas;       /* default: true */
+    /* Borrowed; "fonts/<file>" entries are used instead of font_dir.
+     * Must stay open until the context is destroyed. */
+    const asset_pack_t *pack;
 } sdl2_font_config_t;
 
 /* Opaque font context — allocated by create, freed by destroy. */
@@ -65,14 +101,18 @@ typedef struct sdl2_font sdl2_font_t;
 
 /*
  * Return a config struct populated with default values:
- *   renderer = NULL  (caller must set)
- *   font_dir = SDL2F_DEFAULT_FONT_DIR
+ *   renderer        = NULL  (caller must set)
+ *   font_dir        = SDL2F_DEFAULT_FONT_DIR
+ *   text_cache_size = SDL2F_TEXT_CACHE_SIZE
+ *   glyph_atlas     = true
+ *   pack            = NULL
  */
 sdl2_font_config_t sdl2_font_config_defaults(void);
 
 /*
- * Create a font context.  Opens all four TTF fonts from font_dir.
- * All four fonts must load successfully (all-or-nothing).
+ * Create a font context.  Opens all four TTF fonts from font_dir, or
+ * from config->pack for each font the pack holds.  All four fonts must
+ * load successfully (all-or-nothing).
  *
  * Single-context invariant: at most one sdl2_font_t may be alive at a
  * time.  The implementation calls TTF_Init() on first create and
@@ -135,6 +175,11 @@ int sdl2_font_line_height(const sdl2_font_t *ctx, sdl2_font_id_t font_id);
  */
 int sdl2_font_ascent(const sdl2_font_t *ctx, sdl2_font_id_t font_id);
 
+/*
+ * Fill *stats with the text cache counters accumulated since create.
+ */
+sdl2_font_status_t sdl2_font_cache_stats(const sdl2_font_t *ctx, sdl2_font_cache_stats_t *stats);
+
 /* Return a human-readable string for a status code. */
 const char *sdl2_font_status_string(sdl2_font_status_t status);
 
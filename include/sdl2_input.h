@@ -16,6 +16,7 @@
  */
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <SDL2/SDL.h>
 
@@ -76,6 +77,9 @@ typedef enum
     SDL2I_SPEED_8,
     SDL2I_SPEED_9,
 
+    /* Performance HUD (ADR-092).  Last, so replay bitmasks keep their bits. */
+    SDL2I_TOGGLE_HUD,
+
     SDL2I_ACTION_COUNT
 } sdl2_input_action_t;
 
@@ -204,6 +208,36 @@ SDL_Scancode sdl2_input_get_binding(const sdl2_input_t *ctx, sdl2_input_action_t
 /* Reset all bindings to their defaults. */
 void sdl2_input_reset_bindings(sdl2_input_t *ctx);
 
+/* =========================================================================
+ * Snapshots (replay)
+ * ========================================================================= */
+
+/*
+ * Everything game logic can observe through this module in one frame.
+ * Action state is one bit per sdl2_input_action_t (SDL2I_ACTION_COUNT
+ * fits in 32 bits); mouse buttons use SDL's SDL_BUTTON() mask.
+ */
+typedef struct
+{
+    uint32_t held;               /* Actions currently held */
+    uint32_t just_pressed;       /* Actions pressed this frame */
+    int mouse_x;                 /* Pointer position */
+    int mouse_y;                 /* Pointer position */
+    uint32_t mouse_buttons;      /* Buttons currently held */
+    uint32_t mouse_just_pressed; /* Buttons pressed this frame */
+    bool shift;                  /* Either Shift held */
+} sdl2_input_snapshot_t;
+
+/* Capture the current frame's input state into *snap. */
+void sdl2_input_get_snapshot(const sdl2_input_t *ctx, sdl2_input_snapshot_t *snap);
+
+/*
+ * Replace the current frame's input state with *snap, as if the events
+ * that produced it had just been processed.  Per-scancode state is
+ * cleared, so a later key-up event cannot re-derive stale actions.
+ */
+void sdl2_input_apply_snapshot(sdl2_input_t *ctx, const sdl2_input_snapshot_t *snap);
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
@@ -0,0 +1,114 @@
+#ifndef SDL2_LAYER_H
+#define SDL2_LAYER_H
+
+/*
+ * sdl2_layer.h — Cached static layers on render-target textures.
+ *
+ * A layer is a transparent texture the size of the logical canvas.  Draw
+ * code renders into it once, between sdl2_layer_begin() and
+ * sdl2_layer_end(), using ordinary window coordinates; every later frame
+ * copies the finished layer back with one sdl2_layer_draw().  A 64-bit
+ * key supplied by the caller names what was composed (sprite id, border
+ * colour, ...): the layer is stale when the key or the canvas size
+ * changes, or after sdl2_layer_invalidate().
+ *
+ * A current layer can also be patched in place: sdl2_layer_update()
+ * reopens it as the render target without clearing, sdl2_layer_clear_rect()
+ * punches the changed areas back to transparent, and the caller redraws
+ * just those before sdl2_layer_end() (ADR-089).
+ *
+ * Renderers without render-target support make sdl2_layer_create() fail
+ * with SDL2LY_ERR_UNSUPPORTED; callers then keep drawing directly.
+ *
+ * Opaque context pattern.  See ADR-088 in docs/DESIGN.md.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+/* Status codes returned by sdl2_layer functions. */
+typedef enum
+{
+    SDL2LY_OK = 0,
+    SDL2LY_ERR_NULL_ARG,
+    SDL2LY_ERR_UNSUPPORTED,
+    SDL2LY_ERR_CREATE_FAILED,
+    SDL2LY_ERR_BAD_SIZE,
+    SDL2LY_ERR_TARGET_FAILED,
+    SDL2LY_ERR_STALE
+} sdl2_layer_status_t;
+
+/* Opaque layer — allocated by create, freed by destroy. */
+typedef struct sdl2_layer sdl2_layer_t;
+
+/*
+ * Create an empty layer for the given renderer.  No texture is allocated
+ * until the first sdl2_layer_begin().
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason.
+ * The caller owns the returned layer and must call sdl2_layer_destroy().
+ */
+sdl2_layer_t *sdl2_layer_create(SDL_Renderer *renderer, sdl2_layer_status_t *status);
+
+/* Destroy the layer and its texture.  Safe to call with NULL. */
+void sdl2_layer_destroy(sdl2_layer_t *layer);
+
+/*
+ * True if the layer holds a finished composition of key at w x h.
+ * False for NULL.
+ */
+bool sdl2_layer_is_current(const sdl2_layer_t *layer, int w, int h, uint64_t key);
+
+/*
+ * Start composing key at w x h: (re)allocate the texture if the size
+ * changed, make it the render target and clear it to transparent.  On
+ * SDL2LY_OK the caller draws, then must call sdl2_layer_end().  On any
+ * error the render target is unchanged and the layer stays stale.
+ */
+sdl2_layer_status_t sdl2_layer_begin(sdl2_layer_t *layer, int w, int h, uint64_t key);
+
+/*
+ * Reopen a current layer for drawing without clearing it, keeping its
+ * size and key.  Returns SDL2LY_ERR_STALE if the layer is not current
+ * (use begin() instead).  On SDL2LY_OK the caller must call
+ * sdl2_layer_end().
+ */
+sdl2_layer_status_t sdl2_layer_update(sdl2_layer_t *layer);
+
+/*
+ * Reset rect of the layer to transparent, ignoring the draw blend mode.
+ * Only between a successful begin()/update() and end(); otherwise no-op.
+ */
+void sdl2_layer_clear_rect(sdl2_layer_t *layer, const SDL_Rect *rect);
+
+/*
+ * Finish composing: restore the previous render target and mark the
+ * layer current.  No-op unless a begin() or update() succeeded.
+ */
+void sdl2_layer_end(sdl2_layer_t *layer);
+
+/*
+ * Copy the area of the layer onto the current render target at the same
+ * position (the whole layer if area is NULL).  No-op for a stale layer.
+ */
+void sdl2_layer_draw(const sdl2_layer_t *layer, const SDL_Rect *area);
+
+/*
+ * Mark the layer stale so the next is_current() fails.  Call this when
+ * the renderer reports SDL_RENDER_TARGETS_RESET: target contents are
+ * lost then.  Safe to call with NULL.
+ */
+void sdl2_layer_invalidate(sdl2_layer_t *layer);
+
+/* Number of completed full compositions (begin/end) so far; 0 for NULL. */
+uint64_t sdl2_layer_redraws(const sdl2_layer_t *layer);
+
+/* Number of completed in-place updates (update/end) so far; 0 for NULL. */
+uint64_t sdl2_layer_updates(const sdl2_layer_t *layer);
+
+/* Return a human-readable string for a status code. */
+const char *sdl2_layer_status_string(sdl2_layer_status_t status);
+
+#endif /* SDL2_LAYER_H */
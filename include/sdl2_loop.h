@@ -19,8 +19,13 @@
  *   Warp 5 (medium):   7500 us =  7.5ms = ~133 ticks/sec
  *   Warp 9 (fastest):  1500 us =  1.5ms = ~667 ticks/sec
  *
+ * Turbo mode drops the fixed timestep for fast-forward and soak runs:
+ * each update runs as many ticks as fit in a wall-time budget, read from
+ * an injected microsecond clock, then renders once.  Tick logic is the
+ * same, so a turbo run makes the same decisions, only sooner.
+ *
  * Opaque context pattern: no globals, fully testable.
- * See ADR-013 in docs/DESIGN.md for design rationale.
+ * See ADR-013 (timestep) and ADR-080 (turbo) in docs/DESIGN.md.
  */
 
 #include <stdbool.h>
@@ -42,6 +47,14 @@
  * the game falls behind real time (e.g., breakpoint, suspend). */
 #define SDL2L_MAX_TICKS_PER_UPDATE 10
 
+/* Turbo: default wall-time budget for the ticks of one update — most of
+ * a 60 Hz refresh, leaving the rest for events and the single render. */
+#define SDL2L_TURBO_DEFAULT_BUDGET_US 12000
+
+/* Turbo: hard cap on ticks per update, so a stalled clock cannot hang
+ * the frame. */
+#define SDL2L_TURBO_MAX_TICKS_PER_UPDATE 100000
+
 /* =========================================================================
  * Status codes
  * ========================================================================= */
@@ -73,6 +86,12 @@ typedef void (*sdl2_loop_tick_fn)(void *user_data);
  */
 typedef void (*sdl2_loop_render_fn)(double alpha, void *user_data);
 
+/*
+ * Monotonic clock in microseconds, used only by turbo mode to measure its
+ * budget.  Any epoch; only differences matter.
+ */
+typedef uint64_t (*sdl2_loop_clock_fn)(void);
+
 /* =========================================================================
  * Opaque context
  * ========================================================================= */
@@ -110,9 +129,34 @@ void sdl2_loop_destroy(sdl2_loop_t *ctx);
  * alpha.  Returns the number of logic ticks dispatched (0 if paused).
  *
  * Clamps to SDL2L_MAX_TICKS_PER_UPDATE to prevent spiral of death.
+ *
+ * In turbo mode elapsed_ms is ignored: ticks run back to back until the
+ * turbo budget is spent (or SDL2L_TURBO_MAX_TICKS_PER_UPDATE), then
+ * render_fn runs once with alpha 0.
  */
 int sdl2_loop_update(sdl2_loop_t *ctx, uint64_t elapsed_ms);
 
+/*
+ * sdl2_loop_update with elapsed time in microseconds, for callers that
+ * pace frames more finely than a millisecond (ADR-090).
+ */
+int sdl2_loop_update_us(sdl2_loop_t *ctx, uint64_t elapsed_us);
+
+/*
+ * Dispatch exactly `ticks` logic ticks regardless of elapsed time, then
+ * render_fn once (alpha 0) if `render` is true.  Used by replay playback,
+ * which must repeat the recorded tick counts rather than re-derive them
+ * from wall time.  Leaves the accumulator empty.  Returns the number of
+ * ticks dispatched (0 if paused or ticks <= 0).
+ */
+int sdl2_loop_step(sdl2_loop_t *ctx, int ticks, bool render);
+
+/*
+ * Microseconds of further elapsed time before the next update would run
+ * a tick: 0 if one is already due, in turbo mode, or for NULL.
+ */
+uint64_t sdl2_loop_until_tick_us(const sdl2_loop_t *ctx);
+
 /* =========================================================================
  * Speed control
  * ========================================================================= */
@@ -126,6 +170,36 @@ int sdl2_loop_get_speed(const sdl2_loop_t *ctx);
 /* Get the tick interval for a speed level in microseconds. */
 uint64_t sdl2_loop_tick_interval_us(int speed_level);
 
+/* =========================================================================
+ * Turbo
+ * ========================================================================= */
+
+/*
+ * Enable or disable turbo mode.  When enabling, clock_fn is required and
+ * budget_us is the wall time each update may spend on ticks (0 selects
+ * SDL2L_TURBO_DEFAULT_BUDGET_US).  Rendering happens once per update, so
+ * with a vsync'd renderer the game draws at most once per display
+ * refresh however many ticks ran.  Disabling clears the accumulator so
+ * normal pacing resumes without a catch-up burst.
+ *
+ * Returns SDL2L_ERR_NULL_ARG for a NULL ctx, or for on with no clock.
+ */
+sdl2_loop_status_t sdl2_loop_set_turbo(sdl2_loop_t *ctx, bool on, uint64_t budget_us,
+                                       sdl2_loop_clock_fn clock_fn);
+
+/* True if turbo mode is on. */
+bool sdl2_loop_is_turbo(const sdl2_loop_t *ctx);
+
+/*
+ * Start a turbo budget window now.  sdl2_loop_update does this itself;
+ * callers that drive ticks through sdl2_loop_step (replay scrubbing) use
+ * it with sdl2_loop_turbo_budget_left to pace their own batch.
+ */
+void sdl2_loop_turbo_begin(sdl2_loop_t *ctx);
+
+/* True while turbo is on and the current window has budget left. */
+bool sdl2_loop_turbo_budget_left(const sdl2_loop_t *ctx);
+
 /* =========================================================================
  * Pause
  * ========================================================================= */
@@ -0,0 +1,157 @@
+#ifndef SDL2_PACER_H
+#define SDL2_PACER_H
+
+/*
+ * sdl2_pacer.h — Frame pacing for the main loop.
+ *
+ * Decides when the next frame is due and waits for it without burning a
+ * core: the bulk of the wait is a coarse sleep, and only the last stretch,
+ * shorter than the sleep's observed overshoot, is spun on the clock.  The
+ * overshoot estimate (mean plus one standard deviation of past sleeps) is
+ * learnt as the game runs, so the spin stays short on precise platforms
+ * and grows only where the scheduler is sloppy.
+ *
+ * A frame is due at the next display refresh when the refresh rate is
+ * known, otherwise at the loop's next tick, and never more than
+ * SDL2P_MAX_TICKS_PER_FRAME ticks after the previous frame so the loop's
+ * catch-up clamp is not hit in steady state.
+ *
+ * Like sdl2_loop, the module is time-source agnostic: the caller injects a
+ * microsecond clock and a millisecond sleep, so tests run on fake time.
+ *
+ * Opaque context pattern.  See ADR-090 in docs/DESIGN.md.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sdl2_loop.h"
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+/* Most ticks a paced frame may span: half the loop's per-update clamp. */
+#define SDL2P_MAX_TICKS_PER_FRAME (SDL2L_MAX_TICKS_PER_UPDATE / 2)
+
+/* Overshoot assumed before any sleep has been measured. */
+#define SDL2P_INITIAL_OVERSHOOT_US 1000
+
+/* The overshoot estimate is kept within [0, this]. */
+#define SDL2P_MAX_OVERSHOOT_US 4000
+
+/* How long an idle (paused or dialogue) frame may block waiting for input. */
+#define SDL2P_IDLE_TIMEOUT_MS 100
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    SDL2P_OK = 0,
+    SDL2P_ERR_NULL_ARG,
+    SDL2P_ERR_ALLOC_FAILED
+} sdl2_pacer_status_t;
+
+/* =========================================================================
+ * Callback types
+ * ========================================================================= */
+
+/* Monotonic clock in microseconds.  Any epoch; only differences matter. */
+typedef uint64_t (*sdl2_pacer_clock_fn)(void);
+
+/* Sleep for at least ms milliseconds (e.g. SDL_Delay).  May oversleep. */
+typedef void (*sdl2_pacer_sleep_fn)(uint32_t ms);
+
+/* =========================================================================
+ * Statistics
+ * ========================================================================= */
+
+typedef struct
+{
+    uint64_t waits;        /* wait_until calls that had time to wait */
+    uint64_t slept_us;     /* Wall time spent in sleep_fn */
+    uint64_t spun_us;      /* Wall time spent spinning on the clock */
+    double late_mean_us;   /* Wake-up lateness past the deadline: mean, */
+    double late_stddev_us; /* standard deviation */
+    uint64_t late_max_us;  /* and worst case */
+    double overshoot_us;   /* Current sleep overshoot estimate */
+} sdl2_pacer_stats_t;
+
+/* =========================================================================
+ * Opaque context
+ * ========================================================================= */
+
+typedef struct sdl2_pacer sdl2_pacer_t;
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+/*
+ * Create a pacer.  Both callbacks are required.  Starts enabled, with no
+ * known refresh rate.
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason.
+ */
+sdl2_pacer_t *sdl2_pacer_create(sdl2_pacer_clock_fn clock_fn, sdl2_pacer_sleep_fn sleep_fn,
+                                sdl2_pacer_status_t *status);
+
+/* Destroy the pacer.  Safe to call with NULL. */
+void sdl2_pacer_destroy(sdl2_pacer_t *ctx);
+
+/* =========================================================================
+ * Configuration
+ * ========================================================================= */
+
+/*
+ * Enable or disable waiting.  A disabled pacer still tells the time, but
+ * sdl2_pacer_wait_until returns at once and sdl2_pacer_is_enabled is
+ * false, so the caller runs frames back to back as before.
+ */
+void sdl2_pacer_set_enabled(sdl2_pacer_t *ctx, bool enabled);
+
+/* True if waiting is enabled; false for NULL. */
+bool sdl2_pacer_is_enabled(const sdl2_pacer_t *ctx);
+
+/* Display refresh rate in Hz; 0 (or less) means unknown. */
+void sdl2_pacer_set_refresh_hz(sdl2_pacer_t *ctx, int hz);
+
+/* =========================================================================
+ * Pacing
+ * ========================================================================= */
+
+/* Current time from the injected clock; 0 for NULL. */
+uint64_t sdl2_pacer_now(const sdl2_pacer_t *ctx);
+
+/*
+ * When the frame after one that started at frame_start_us is due.
+ * tick_due_us is when the loop's next tick falls due (now plus
+ * sdl2_loop_until_tick_us) and tick_interval_us its tick length.
+ *
+ * With a known refresh rate the answer is one refresh period after the
+ * frame start, otherwise tick_due_us; either way it is capped at
+ * SDL2P_MAX_TICKS_PER_FRAME ticks after the frame start.
+ */
+uint64_t sdl2_pacer_deadline(const sdl2_pacer_t *ctx, uint64_t frame_start_us,
+                             uint64_t tick_due_us, uint64_t tick_interval_us);
+
+/*
+ * Wait until the clock reaches deadline_us: sleep while more than the
+ * overshoot estimate remains, then spin.  Returns at once if disabled or
+ * if the deadline has passed.
+ */
+void sdl2_pacer_wait_until(sdl2_pacer_t *ctx, uint64_t deadline_us);
+
+/* Copy the statistics gathered so far.  Zeroes *out for a NULL ctx. */
+void sdl2_pacer_get_stats(const sdl2_pacer_t *ctx, sdl2_pacer_stats_t *out);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *sdl2_pacer_status_string(sdl2_pacer_status_t status);
+
+#endif /* SDL2_PACER_H */
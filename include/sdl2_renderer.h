@@ -9,6 +9,10 @@
  * SDL_RenderSetLogicalSize() handles letterboxing/scaling to the
  * physical window size.
  *
+ * Offscreen mode draws with SDL's software renderer into an in-memory
+ * surface of the logical size instead: no window and no video driver, so
+ * tests and captures run on machines without a display (ADR-094).
+ *
  * Opaque context pattern: no globals, fully testable.
  * See ADR-004 in docs/DESIGN.md.
  */
@@ -37,6 +41,7 @@ typedef struct
     bool fullscreen;
     bool vsync;
     const char *title;
+    bool offscreen; /* Software surface, no window; scale/fullscreen/vsync ignored */
 } sdl2_renderer_config_t;
 
 /* Opaque renderer context — allocated by create, freed by destroy. */
@@ -50,11 +55,14 @@ typedef struct sdl2_renderer sdl2_renderer_t;
  *   fullscreen     = false
  *   vsync          = true
  *   title          = "XBoing"
+ *   offscreen      = false
  */
 sdl2_renderer_config_t sdl2_renderer_config_defaults(void);
 
 /*
- * Create a window and renderer.  Returns NULL on failure.
+ * Create a window and renderer, or in offscreen mode a surface and a
+ * software renderer drawing into it.  Offscreen mode does not initialize
+ * the SDL video subsystem.  Returns NULL on failure.
  * The caller owns the returned context and must call sdl2_renderer_destroy().
  */
 sdl2_renderer_t *sdl2_renderer_create(const sdl2_renderer_config_t *config);
@@ -102,13 +110,13 @@ bool sdl2_renderer_is_mouse_grabbed(const sdl2_renderer_t *ctx);
 /* Access the underlying SDL_Renderer (for drawing operations). */
 SDL_Renderer *sdl2_renderer_get(const sdl2_renderer_t *ctx);
 
-/* Access the underlying SDL_Window. */
+/* Access the underlying SDL_Window (NULL in offscreen mode). */
 SDL_Window *sdl2_renderer_get_window(const sdl2_renderer_t *ctx);
 
 /* Get the logical (game-coordinate) size. */
 void sdl2_renderer_get_logical_size(const sdl2_renderer_t *ctx, int *w, int *h);
 
-/* Get the current physical window size. */
+/* Get the current physical window size (0x0 in offscreen mode). */
 void sdl2_renderer_get_window_size(const sdl2_renderer_t *ctx, int *w, int *h);
 
 /*
@@ -130,6 +138,8 @@ void sdl2_renderer_get_window_size(const sdl2_renderer_t *ctx, int *w, int *h);
  * trade-off unique to fullscreen editor use — see
  * docs/specs/2026-07-11-editor-window-width.md.
  *
+ * Offscreen mode behaves like fullscreen: the surface keeps its size.
+ *
  * No-op if new_logical_width already equals the current logical
  * width (idempotent — safe to call on every mode-enter).
  *
@@ -137,6 +147,9 @@ void sdl2_renderer_get_window_size(const sdl2_renderer_t *ctx, int *w, int *h);
  */
 int sdl2_renderer_set_logical_width(sdl2_renderer_t *ctx, int new_logical_width);
 
+/* Query whether the renderer draws offscreen (no window). */
+bool sdl2_renderer_is_offscreen(const sdl2_renderer_t *ctx);
+
 /* Save the current framebuffer to a BMP file.  Returns 0 on success. */
 int sdl2_renderer_save_screenshot(const sdl2_renderer_t *ctx, const char *path);
 
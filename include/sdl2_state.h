@@ -70,6 +70,15 @@ typedef enum
  */
 typedef void (*sdl2_state_handler_fn)(sdl2_state_mode_t mode, void *user_data);
 
+/*
+ * Transition hook: called on every mode change (transition, dialogue push
+ * and pop) after the current mode is updated and before the new mode's
+ * on_enter.  Lets a subsystem prepare for the new mode (e.g. texture
+ * prefetch) without each mode's handler having to call it.
+ */
+typedef void (*sdl2_state_transition_fn)(sdl2_state_mode_t from, sdl2_state_mode_t to,
+                                         void *user_data);
+
 /*
  * Mode definition: the three callbacks for a mode.
  * Any callback may be NULL (no-op).
@@ -114,6 +123,13 @@ void sdl2_state_destroy(sdl2_state_t *ctx);
 sdl2_state_status_t sdl2_state_register(sdl2_state_t *ctx, sdl2_state_mode_t mode,
                                         const sdl2_state_mode_def_t *def);
 
+/*
+ * Set the transition hook (NULL = none), replacing any previous one.  It
+ * receives the user_data passed at creation time.
+ */
+sdl2_state_status_t sdl2_state_set_transition_hook(sdl2_state_t *ctx,
+                                                   sdl2_state_transition_fn hook);
+
 /* =========================================================================
  * Transitions
  * ========================================================================= */
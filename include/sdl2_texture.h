@@ -7,18 +7,56 @@
  * Loads PNG images from disk into SDL_Texture objects and caches them
  * in a hash map for O(1) lookup by string key (e.g., "balls/ball1").
  *
+ * By default the images found at startup are packed onto a few large
+ * atlas pages, so consecutive draws of different sprites share one
+ * texture and SDL can batch them.  Callers therefore always draw with
+ * the info's rect as the source rectangle.
+ *
+ * The PNG decoding can run on an sdl2_decode pool while the caller does
+ * other startup work: sdl2_texture_queue_decode() submits the files, and
+ * sdl2_texture_create() with config.decoder set uploads each image as
+ * its decode completes.
+ *
+ * With an asset pack (asset_pack.h) the images come from its "images/"
+ * entries instead: already-decoded pixels in the mapped pack, wrapped in
+ * surfaces without copying and uploaded straight to the GPU.
+ *
+ * In lazy mode (config.lazy) create() only records where each image comes
+ * from.  An image is uploaded on its first lookup or when a prefetch hint
+ * names it, and under config.vram_budget the least recently drawn images
+ * are unloaded to make room; they reload on their next lookup.  The atlas
+ * is not used, since a page can only be dropped as a whole.
+ *
  * Opaque context pattern: no globals, fully testable.
- * See ADR-005 in docs/DESIGN.md.
+ * See ADR-005, ADR-085, ADR-097, ADR-098 and ADR-099 in docs/DESIGN.md.
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #include <SDL2/SDL.h>
 
+#include "asset_pack.h"
+#include "sdl2_decode.h"
+
 /* Maximum length of a texture cache key (e.g., "balls/ball1"). */
 #define SDL2T_MAX_KEY_LEN 128
 
 /* Hash map capacity.  ~180 textures at 256 slots gives ~70% load factor. */
 #define SDL2T_MAX_TEXTURES 256
 
+/* Default atlas page edge in pixels.  The stock sprite set fits one page. */
+#define SDL2T_ATLAS_SIZE 1024
+
+/* Maximum atlas pages; images that do not fit get textures of their own. */
+#define SDL2T_MAX_ATLAS_PAGES 4
+
+/* Transparent pixels left between neighbouring images on a page. */
+#define SDL2T_ATLAS_PADDING 1
+
+/* sdl2_decode batch used for texture files. */
+#define SDL2T_DECODE_BATCH 1
+
 /* Status codes returned by sdl2_texture functions. */
 typedef enum
 {
@@ -37,6 +75,7 @@ typedef enum
 typedef struct
 {
     SDL_Texture *texture; /* owned by cache -- do NOT destroy */
+    SDL_Rect rect;        /* source rect of the image within texture */
     int width;
     int height;
 } sdl2_texture_info_t;
@@ -50,6 +89,11 @@ typedef struct
 {
     SDL_Renderer *renderer; /* required -- borrowed, not owned */
     const char *base_dir;   /* default: "assets/images" */
+    int atlas_size;         /* atlas page edge; 0 = one texture per image */
+    sdl2_decode_t *decoder; /* images queued by sdl2_texture_queue_decode(); NULL = scan */
+    const asset_pack_t *pack; /* borrowed; used instead of base_dir if it has images */
+    bool lazy;                /* upload each image on first use; ignores atlas and decoder */
+    size_t vram_budget;       /* lazy: texture bytes kept resident; 0 = no limit */
 } sdl2_texture_config_t;
 
 /* Opaque texture cache context -- allocated by create, freed by destroy. */
@@ -57,11 +101,28 @@ typedef struct sdl2_texture sdl2_texture_t;
 
 /*
  * Return a config struct populated with default values:
- *   renderer = NULL  (caller must set)
- *   base_dir = "assets/images"
+ *   renderer   = NULL  (caller must set)
+ *   base_dir   = "assets/images"
+ *   atlas_size = SDL2T_ATLAS_SIZE
+ *   decoder    = NULL
+ *   pack       = NULL
+ *   lazy       = false
+ *   vram_budget = 0
  */
 sdl2_texture_config_t sdl2_texture_config_defaults(void);
 
+/*
+ * Scan base_dir (NULL = "assets/images") as sdl2_texture_create() would
+ * and submit each .png to decoder as batch SDL2T_DECODE_BATCH.  Also
+ * initializes SDL_image PNG support, on the calling thread, before the
+ * first submit.  Pass the same decoder in sdl2_texture_config_t to
+ * collect the images.
+ *
+ * Returns SDL2T_ERR_IMG_INIT or SDL2T_ERR_SCAN_FAILED on structural
+ * failures; files that cannot be queued are logged and skipped.
+ */
+sdl2_texture_status_t sdl2_texture_queue_decode(sdl2_decode_t *decoder, const char *base_dir);
+
 /*
  * Create a texture cache.  Recursively scans base_dir for .png files,
  * loads each into an SDL_Texture, and inserts it into the hash map.
@@ -69,6 +130,25 @@ sdl2_texture_config_t sdl2_texture_config_defaults(void);
  * Keys are derived from the file path relative to base_dir, with the
  * .png extension stripped (e.g., "balls/ball1").
  *
+ * With config->decoder set, the directory is not scanned: the images
+ * queued by sdl2_texture_queue_decode() are taken as they finish
+ * decoding, and (without an atlas) each is uploaded as soon as it
+ * arrives.  The context then owns the SDL_image initialization.
+ *
+ * With config->pack holding any "images/" entries, neither the directory
+ * nor the decoder is used: each ASSET_PACK_PIXELS entry is inserted under
+ * its key minus "images/".  The surfaces point into the pack, which must
+ * stay open until create() returns (in lazy mode, until destroy()).
+ *
+ * With config->lazy set, the images are found as above but not loaded:
+ * count() includes them at once, and each is uploaded by its first
+ * lookup or prefetch.  A file that fails then is logged once and stays
+ * not found.
+ *
+ * When atlas_size is nonzero the images are then packed onto atlas pages
+ * of that size (capped at the renderer's maximum texture size).  Images
+ * too large for a page keep a texture of their own.
+ *
  * Partial loads succeed -- individual file failures are logged but do
  * not abort.  Only structural failures (NULL renderer, IMG_Init failure,
  * unreadable base_dir) set *status to an error code.
@@ -89,21 +169,77 @@ void sdl2_texture_destroy(sdl2_texture_t *ctx);
 /*
  * Look up a cached texture by key.
  * Returns SDL2T_OK and fills *info on success; SDL2T_ERR_NOT_FOUND otherwise.
+ * info->rect locates the image within info->texture, which may be an
+ * atlas page shared with other images.
+ *
+ * In lazy mode this uploads the image if it is not resident and marks it
+ * used in the current frame, which keeps it resident until a later
+ * frame: info->texture stays valid until sdl2_texture_next_frame().
  */
-sdl2_texture_status_t sdl2_texture_get(const sdl2_texture_t *ctx, const char *key,
+sdl2_texture_status_t sdl2_texture_get(sdl2_texture_t *ctx, const char *key,
                                        sdl2_texture_info_t *info);
 
+/*
+ * Bind dense integer IDs to keys: after this, sdl2_texture_get_id(ctx, i)
+ * returns the image cached under keys[i], without hashing the key.  Call
+ * once after create with a table that outlives ctx (e.g. the sprite
+ * catalog's).  IDs whose key is not cached report SDL2T_ERR_NOT_FOUND
+ * until load_file() inserts that key.  NULL entries are never bound.
+ * count must not exceed SDL2T_MAX_TEXTURES (SDL2T_ERR_CACHE_FULL).
+ * A second call replaces the previous binding.
+ */
+sdl2_texture_status_t sdl2_texture_bind_ids(sdl2_texture_t *ctx, const char *const *keys,
+                                            int count);
+
+/*
+ * Look up a cached texture by bound ID.  Same result as sdl2_texture_get()
+ * with the ID's key, in constant time.  SDL2T_ERR_NOT_FOUND for IDs that
+ * are out of range or not cached.
+ */
+sdl2_texture_status_t sdl2_texture_get_id(sdl2_texture_t *ctx, int id,
+                                          sdl2_texture_info_t *info);
+
+/*
+ * Prefetch hint (lazy mode): upload now every image whose key starts with
+ * one of prefixes (e.g. "presents/", or a full key), so that the first
+ * frame that draws them does not stall.  Called on a mode change with the
+ * new mode's images.  The images count as used in the current frame.
+ * Under a budget, prefetching stops making room once only images used in
+ * the current frame are left; the rest load on first use.  A no-op
+ * outside lazy mode, where every image is already resident.
+ */
+sdl2_texture_status_t sdl2_texture_prefetch(sdl2_texture_t *ctx, const char *const *prefixes,
+                                            int count);
+
+/*
+ * Start a new frame (lazy mode): images used so far become candidates for
+ * eviction, least recently used first.  If one frame needed more than the
+ * budget, the excess is unloaded here.  Safe to call with NULL.
+ */
+void sdl2_texture_next_frame(sdl2_texture_t *ctx);
+
 /*
  * Load a single PNG file and insert (or replace) it in the cache under
  * the given key.  This is the test seam: tests can load individual files
- * without scanning a directory tree.
+ * without scanning a directory tree.  Images loaded this way always get a
+ * texture of their own.
  */
 sdl2_texture_status_t sdl2_texture_load_file(sdl2_texture_t *ctx, const char *key,
                                              const char *path);
 
-/* Return the number of textures currently cached. */
+/* Return the number of textures currently cached (in lazy mode, known). */
 int sdl2_texture_count(const sdl2_texture_t *ctx);
 
+/* Return the number of images with a texture uploaded. */
+int sdl2_texture_resident_count(const sdl2_texture_t *ctx);
+
+/* Return the bytes of texture memory held: 4 per pixel of every image
+ * texture and atlas page. */
+size_t sdl2_texture_resident_bytes(const sdl2_texture_t *ctx);
+
+/* Return the number of atlas pages built by sdl2_texture_create(). */
+int sdl2_texture_atlas_pages(const sdl2_texture_t *ctx);
+
 /* Return a human-readable string for a status code. */
 const char *sdl2_texture_status_string(sdl2_texture_status_t status);
 
@@ -15,6 +15,8 @@
  * See ADR-023 in docs/DESIGN.md for design rationale.
  */
 
+#include "sound_catalog.h"
+
 /* =========================================================================
  * Constants — match legacy sfx.c values
  * ========================================================================= */
@@ -133,14 +135,14 @@ typedef struct
     void (*on_move_window)(int x, int y, void *ud);
 
     /* Sound effect requested at per-call volume (0-100 percent of master). */
-    void (*on_sound)(const char *name, int volume, void *ud);
+    void (*on_sound)(sound_id_t sound, int volume, void *ud);
 } sfx_system_callbacks_t;
 
 /* =========================================================================
  * Random function type — injectable for deterministic testing
  * ========================================================================= */
 
-typedef int (*sfx_rand_fn)(void);
+typedef int (*sfx_rand_fn)(void *user_data);
 
 /* =========================================================================
  * Opaque context
@@ -157,7 +159,8 @@ typedef struct sfx_system sfx_system_t;
  *
  * callbacks: callback table (copied).  NULL is safe.
  * user_data: opaque pointer passed to all callbacks.
- * rand_fn:   random number generator (NULL = stdlib rand).
+ * rand_fn:   random number generator, called with user_data
+ *            (NULL = stdlib rand).
  *
  * Initial state: SFX_MODE_NONE, effects enabled.
  * Returns NULL on allocation failure.
@@ -0,0 +1,168 @@
+#ifndef SIM_BATCH_H
+#define SIM_BATCH_H
+
+/*
+ * sim_batch.h — Multi-threaded batch runner for headless simulations.
+ *
+ * Runs many independent sim_system games — one per job, each a
+ * (level file, seed, input policy) triple — across worker threads and
+ * aggregates the outcomes per level: clear rate, ticks to clear, balls
+ * lost, and the score distribution.  This is the release gate for level
+ * packs: every level under many seeds, in minutes instead of hours.
+ * The games play by the shared rules in rules_logic.h, so a level that
+ * passes here follows the same rules in the real game.
+ *
+ * Scheduling is work stealing over contiguous job ranges.  Each worker
+ * owns a range and takes jobs from its front; an idle worker steals the
+ * back half of the busiest range.  Jobs vary wildly in length (a cleared
+ * level stops early, a stuck one runs to max_ticks), so static splitting
+ * would leave cores idle at the tail of the run.
+ *
+ * Results are stored by job index and every game owns its own RNG
+ * (see rng.h), so results and summaries are identical for any thread
+ * count.
+ *
+ * Opaque context pattern: no globals, fully testable with CMocka.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sim_system.h"
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    SIM_BATCH_OK = 0,
+    SIM_BATCH_ERR_NULL_ARG,
+    SIM_BATCH_ERR_ALLOC_FAILED,
+    SIM_BATCH_ERR_BAD_INDEX /* Job or summary index out of range */
+} sim_batch_status_t;
+
+/* =========================================================================
+ * Configuration
+ * ========================================================================= */
+
+typedef struct
+{
+    int threads;        /* Worker threads; 0 = one per online CPU (default 0) */
+    uint64_t max_ticks; /* Per-game tick cap (default 200000) */
+    int speed_level;    /* Passed to every sim_system (default 5) */
+    int lives;          /* Passed to every sim_system (default 3) */
+} sim_batch_config_t;
+
+/* =========================================================================
+ * Per-job result
+ * ========================================================================= */
+
+typedef struct
+{
+    const char *path;         /* Level file (owned by the batch) */
+    uint64_t seed;            /* RNG seed for this game */
+    sim_policy_t policy;      /* Paddle driver */
+    sim_system_status_t load; /* SIM_SYS_OK, or why the game never started */
+    sim_system_stats_t stats; /* Final statistics (zeroed if load failed) */
+} sim_batch_result_t;
+
+/* =========================================================================
+ * Per-level summary — one per distinct level path, in first-added order
+ * ========================================================================= */
+
+typedef struct
+{
+    const char *path;  /* Level file (owned by the batch) */
+    int runs;          /* Jobs for this level, including load failures */
+    int load_errors;   /* Jobs whose level failed to load */
+    int cleared;       /* SIM_OUTCOME_LEVEL_CLEARED */
+    int game_over;     /* SIM_OUTCOME_GAME_OVER */
+    int timed_out;     /* Still running at max_ticks */
+    double clear_rate; /* cleared / (runs - load_errors); 0 if none played */
+
+    /* Ticks to clear, over cleared runs only (0 if none cleared) */
+    uint64_t ticks_to_clear_min;
+    double ticks_to_clear_mean;
+    uint64_t ticks_to_clear_max;
+
+    /* Balls lost, over every played run */
+    double balls_lost_mean;
+    int balls_lost_max;
+
+    /* Final score distribution, over every played run */
+    unsigned long score_min;
+    unsigned long score_p50;
+    unsigned long score_p90;
+    unsigned long score_max;
+    double score_mean;
+} sim_batch_summary_t;
+
+/* =========================================================================
+ * Opaque context
+ * ========================================================================= */
+
+typedef struct sim_batch sim_batch_t;
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+/* Fill *config with the defaults listed above. */
+void sim_batch_config_init(sim_batch_config_t *config);
+
+/*
+ * Create an empty batch.  config may be NULL for defaults.
+ * Returns NULL on allocation failure (sets *status if non-NULL).
+ */
+sim_batch_t *sim_batch_create(const sim_batch_config_t *config, sim_batch_status_t *status);
+
+/* Destroy the batch and every result it holds.  Safe to call with NULL. */
+void sim_batch_destroy(sim_batch_t *batch);
+
+/* =========================================================================
+ * Jobs
+ * ========================================================================= */
+
+/*
+ * Queue one game.  `path` is copied.  Jobs added after sim_batch_run()
+ * are played by the next run; earlier results are kept.
+ */
+sim_batch_status_t sim_batch_add_job(sim_batch_t *batch, const char *path, uint64_t seed,
+                                     sim_policy_t policy);
+
+/* Number of queued jobs (played or not). */
+size_t sim_batch_job_count(const sim_batch_t *batch);
+
+/*
+ * Play every job not yet played, across the configured worker threads,
+ * then rebuild the per-level summaries.  Blocks until all jobs finish.
+ */
+sim_batch_status_t sim_batch_run(sim_batch_t *batch);
+
+/* =========================================================================
+ * Results
+ * ========================================================================= */
+
+/* Copy the result of job `index` (in add order) into *out. */
+sim_batch_status_t sim_batch_get_result(const sim_batch_t *batch, size_t index,
+                                        sim_batch_result_t *out);
+
+/* Number of distinct levels summarized by the last sim_batch_run(). */
+size_t sim_batch_summary_count(const sim_batch_t *batch);
+
+/* Copy summary `index` (levels in first-added order) into *out. */
+sim_batch_status_t sim_batch_get_summary(const sim_batch_t *batch, size_t index,
+                                         sim_batch_summary_t *out);
+
+/* Worker threads the last sim_batch_run() actually used. */
+int sim_batch_threads_used(const sim_batch_t *batch);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *sim_batch_status_string(sim_batch_status_t status);
+
+#endif /* SIM_BATCH_H */
@@ -0,0 +1,219 @@
+#ifndef SIM_SYSTEM_H
+#define SIM_SYSTEM_H
+
+/*
+ * sim_system.h — Headless gameplay simulation with no SDL2 dependency.
+ *
+ * Wires the pure C gameplay systems (ball, block, paddle, gun, score,
+ * special, level, eyedude) together exactly the way game_callbacks.c and
+ * game_rules.c do for SDL2ST_GAME, but with audio/message/render side
+ * effects stubbed out.  One sim_system_tick() is one gameplay tick of
+ * mode_game_update (src/game_modes.c), so a run here follows the same
+ * rules as a real game at the same speed level.
+ *
+ * Intended for offline throughput and regression work: validating level
+ * packs, sweeping score tables, and benchmarking the simulation hot
+ * paths.  The xboing_sim driver (tools/xboing_sim.c) runs N ticks as fast
+ * as the CPU allows and reports ticks per second.
+ *
+ * The simulation plays exactly one level: it stops with
+ * SIM_OUTCOME_LEVEL_CLEARED where the game would enter SDL2ST_BONUS, and
+ * with SIM_OUTCOME_GAME_OVER where it would enter SDL2ST_HIGHSCORE.
+ *
+ * Opaque context pattern: no globals, fully testable with CMocka.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ball_system.h"
+#include "block_system.h"
+#include "gun_system.h"
+#include "paddle_system.h"
+#include "score_system.h"
+#include "special_system.h"
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    SIM_SYS_OK = 0,
+    SIM_SYS_ERR_NULL_ARG,
+    SIM_SYS_ERR_ALLOC_FAILED,
+    SIM_SYS_ERR_LEVEL_LOAD /* Level file missing or unparseable */
+} sim_system_status_t;
+
+/* =========================================================================
+ * Run outcome
+ * ========================================================================= */
+
+typedef enum
+{
+    SIM_OUTCOME_RUNNING = 0,   /* Level still in progress */
+    SIM_OUTCOME_LEVEL_CLEARED, /* No required blocks remain (game: BONUS) */
+    SIM_OUTCOME_GAME_OVER      /* Last ball lost with no lives (game: HIGHSCORE) */
+} sim_outcome_t;
+
+/* =========================================================================
+ * Input policy — what drives the paddle in place of a player
+ * ========================================================================= */
+
+typedef enum
+{
+    SIM_POLICY_IDLE = 0, /* Paddle never moves; balls auto-launch on timeout */
+    SIM_POLICY_TRACK     /* Paddle chases the lowest active ball, launches at once */
+} sim_policy_t;
+
+/* =========================================================================
+ * Configuration
+ * ========================================================================= */
+
+typedef struct
+{
+    int speed_level;     /* 1-9, feeds ball speed and the level timer (default 5) */
+    int lives;           /* Starting lives (default 3, matches start_new_game) */
+    sim_policy_t policy; /* Paddle driver (default SIM_POLICY_TRACK) */
+    uint64_t seed;       /* Seed for the context's own RNG (default 1) */
+} sim_system_config_t;
+
+/* =========================================================================
+ * Statistics — accumulated since the last successful level load
+ * ========================================================================= */
+
+typedef struct
+{
+    uint64_t ticks;           /* Gameplay ticks simulated */
+    unsigned long score;      /* Current score */
+    int balls_lost;           /* Balls that fell out or popped with none left */
+    int blocks_destroyed;     /* Explosion finalizations */
+    int paddle_hits;          /* BALL_EVT_PADDLE_HIT count */
+    int lives_left;           /* Remaining lives */
+    int time_remaining;       /* Level timer, seconds */
+    sim_outcome_t outcome;    /* Current outcome */
+    uint64_t outcome_tick;    /* Tick the outcome was reached (0 while running) */
+} sim_system_stats_t;
+
+/* =========================================================================
+ * Opaque context
+ * ========================================================================= */
+
+typedef struct sim_system sim_system_t;
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+/* Fill *config with the defaults listed above. */
+void sim_system_config_init(sim_system_config_t *config);
+
+/*
+ * Create a simulation context and every gameplay system it owns.
+ * config may be NULL for defaults.  No level is loaded yet.
+ *
+ * Every random draw comes from an RNG owned by this context and seeded
+ * from config->seed — never from rand() — so contexts are independent
+ * and may run on separate threads, and equal seeds give equal runs.
+ *
+ * Returns NULL on allocation failure (sets *status if non-NULL).
+ */
+sim_system_t *sim_system_create(const sim_system_config_t *config, sim_system_status_t *status);
+
+/* Destroy the simulation and every system it owns.  Safe to call with NULL. */
+void sim_system_destroy(sim_system_t *ctx);
+
+/*
+ * Reset game state (score, lives, paddle, specials, ammo, timers,
+ * statistics), load the level file at `path`, and place a ball on the
+ * paddle — the same sequence as start_new_game (src/game_modes.c).
+ *
+ * Returns SIM_SYS_ERR_LEVEL_LOAD if the file cannot be loaded; the grid
+ * is left empty and the outcome stays SIM_OUTCOME_RUNNING.
+ */
+sim_system_status_t sim_system_load_level(sim_system_t *ctx, const char *path);
+
+/* =========================================================================
+ * Simulation
+ * ========================================================================= */
+
+/*
+ * Advance one gameplay tick.  No-op once an outcome has been reached.
+ * Returns the outcome after the tick.
+ */
+sim_outcome_t sim_system_tick(sim_system_t *ctx);
+
+/*
+ * Tick until an outcome is reached or `max_ticks` ticks have run
+ * (whichever comes first).  Returns the outcome.
+ */
+sim_outcome_t sim_system_run(sim_system_t *ctx, uint64_t max_ticks);
+
+/* =========================================================================
+ * Snapshots — in-memory fork and rewind
+ * ========================================================================= */
+
+/*
+ * A snapshot is a flat block of sim_system_snapshot_size() bytes holding
+ * the complete simulation state: every owned system's snapshot (ball,
+ * block, paddle, gun, score, special, eyedude) followed by the context's
+ * configuration, RNG, frame counter, lives, level timer, bonus spawning
+ * state and statistics.  It contains no pointers, so copying one is a
+ * plain memcpy, and it can be loaded into any sim_system_t of the same
+ * build — the context it came from or another one, e.g. one per thread.
+ *
+ * Loading a snapshot and ticking reproduces exactly what the saved
+ * context would have done, so a search can save once and try many
+ * continuations.  The level file (title, time bonus) is read only by
+ * sim_system_load_level and is not part of a snapshot.
+ *
+ * This is far cheaper than savegame_system_capture, which only records
+ * what the player-facing save file needs and goes through JSON.
+ */
+typedef struct sim_system_snapshot sim_system_snapshot_t;
+
+/* Byte size of a snapshot (constant for a given build). */
+size_t sim_system_snapshot_size(void);
+
+/* Allocate an uninitialised snapshot buffer.  Returns NULL on failure. */
+sim_system_snapshot_t *sim_system_snapshot_create(void);
+
+/* Free a snapshot buffer.  Safe to call with NULL. */
+void sim_system_snapshot_destroy(sim_system_snapshot_t *snap);
+
+/* Save the full simulation state into *snap.  Returns error on NULL args. */
+sim_system_status_t sim_system_snapshot_save(const sim_system_t *ctx, sim_system_snapshot_t *snap);
+
+/*
+ * Replace the full simulation state with *snap.  No callbacks fire and
+ * nothing else is reset.  Returns error on NULL args.
+ */
+sim_system_status_t sim_system_snapshot_load(sim_system_t *ctx, const sim_system_snapshot_t *snap);
+
+/* =========================================================================
+ * Queries
+ * ========================================================================= */
+
+/* Fill *out with the current statistics.  Returns error on NULL args. */
+sim_system_status_t sim_system_get_stats(const sim_system_t *ctx, sim_system_stats_t *out);
+
+/* Current game frame (one per tick). */
+int sim_system_get_frame(const sim_system_t *ctx);
+
+/* Owned subsystems — for tests and benchmarks that need to inspect state. */
+ball_system_t *sim_system_get_ball(const sim_system_t *ctx);
+block_system_t *sim_system_get_block(const sim_system_t *ctx);
+paddle_system_t *sim_system_get_paddle(const sim_system_t *ctx);
+gun_system_t *sim_system_get_gun(const sim_system_t *ctx);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *sim_system_status_string(sim_system_status_t status);
+
+/* Return a short name for an outcome ("running", "cleared", "game_over"). */
+const char *sim_system_outcome_name(sim_outcome_t outcome);
+
+#endif /* SIM_SYSTEM_H */
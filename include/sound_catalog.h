@@ -0,0 +1,97 @@
+#ifndef SOUND_CATALOG_H
+#define SOUND_CATALOG_H
+
+/*
+ * sound_catalog.h -- Sound IDs for the SDL2 game.
+ *
+ * One ID per sound asset, named after its cache key: the basename of the
+ * file in sounds/ with .wav stripped, as loaded by sdl2_audio_create().
+ *
+ * Game systems report sounds to their callbacks by ID, and the audio
+ * context resolves the whole table to cache entries once at creation
+ * (sdl2_audio_config_t.id_keys), so sdl2_audio_play_id() is an array
+ * index instead of a string hash and probe per play.  The keys remain
+ * for logs, tools, tests and sdl2_audio_play().  Same pattern as the
+ * sprite IDs in sprite_catalog.h.  See ADR-096 in docs/DESIGN.md.
+ */
+
+#include <stddef.h>
+
+#define SOUND_LIST(X) \
+    X(SOUND_AMMO, "ammo") \
+    X(SOUND_APPLAUSE, "applause") \
+    X(SOUND_BALL2BALL, "ball2ball") \
+    X(SOUND_BALLLOST, "balllost") \
+    X(SOUND_BALLSHOT, "ballshot") \
+    X(SOUND_BOING, "boing") \
+    X(SOUND_BOMB, "bomb") \
+    X(SOUND_BONUS, "bonus") \
+    X(SOUND_BUZZER, "buzzer") \
+    X(SOUND_CLICK, "click") \
+    X(SOUND_DDLOO, "ddloo") \
+    X(SOUND_DOH1, "Doh1") \
+    X(SOUND_DOH2, "Doh2") \
+    X(SOUND_DOH3, "Doh3") \
+    X(SOUND_DOH4, "Doh4") \
+    X(SOUND_EVILLAUGH, "evillaugh") \
+    X(SOUND_GAME_OVER, "game_over") \
+    X(SOUND_GATE, "gate") \
+    X(SOUND_HITHERE, "hithere") \
+    X(SOUND_HYPSPC, "hypspc") \
+    X(SOUND_INTRO, "intro") \
+    X(SOUND_KEY, "key") \
+    X(SOUND_LOOKSBAD, "looksbad") \
+    X(SOUND_METAL, "metal") \
+    X(SOUND_MGUN, "mgun") \
+    X(SOUND_OUCH, "ouch") \
+    X(SOUND_PADDLE, "paddle") \
+    X(SOUND_PING, "ping") \
+    X(SOUND_SHARK, "shark") \
+    X(SOUND_SHOOT, "shoot") \
+    X(SOUND_SHOTGUN, "shotgun") \
+    X(SOUND_SPRING, "spring") \
+    X(SOUND_STAMP, "stamp") \
+    X(SOUND_STICKY, "sticky") \
+    X(SOUND_SUPBONS, "supbons") \
+    X(SOUND_TOGGLE, "toggle") \
+    X(SOUND_TONE, "tone") \
+    X(SOUND_TOUCH, "touch") \
+    X(SOUND_WALLSOFF, "wallsoff") \
+    X(SOUND_WARP, "warp") \
+    X(SOUND_WEEEK, "weeek") \
+    X(SOUND_WHIZZO, "whizzo") \
+    X(SOUND_WHOOSH, "whoosh") \
+    X(SOUND_WZZZ, "wzzz") \
+    X(SOUND_WZZZ2, "wzzz2") \
+    X(SOUND_YOUAGOD, "youagod")
+
+typedef enum
+{
+    SOUND_NONE = -1,
+#define SOUND_ENUM_ENTRY(id, key) id,
+    SOUND_LIST(SOUND_ENUM_ENTRY)
+#undef SOUND_ENUM_ENTRY
+    SOUND_COUNT
+} sound_id_t;
+
+/*
+ * Return the key table indexed by sound_id_t (SOUND_COUNT entries), for
+ * sdl2_audio_config_t.id_keys.  The table has static storage duration.
+ */
+static inline const char *const *sound_key_table(void)
+{
+#define SOUND_KEY_ENTRY(id, key) key,
+    static const char *const keys[SOUND_COUNT] = {SOUND_LIST(SOUND_KEY_ENTRY)};
+#undef SOUND_KEY_ENTRY
+    return keys;
+}
+
+/* Return the cache key for a sound ID, or NULL for SOUND_NONE. */
+static inline const char *sound_key(sound_id_t id)
+{
+    if (id < 0 || id >= SOUND_COUNT)
+        return NULL;
+    return sound_key_table()[id];
+}
+
+#endif /* SOUND_CATALOG_H */
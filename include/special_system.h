@@ -15,6 +15,8 @@
  * See ADR-021 in docs/DESIGN.md for design rationale.
  */
 
+#include <stddef.h>
+
 /* =========================================================================
  * Constants — match legacy special.h values
  * ========================================================================= */
@@ -86,6 +88,12 @@ typedef struct
     void (*on_wall_state_changed)(int no_walls, void *ud);
 } special_system_callbacks_t;
 
+/* =========================================================================
+ * Random function type — injectable for deterministic testing
+ * ========================================================================= */
+
+typedef int (*special_rand_fn)(void *user_data);
+
 /* =========================================================================
  * Opaque context
  * ========================================================================= */
@@ -175,9 +183,27 @@ void special_system_get_labels(const special_system_t *ctx, int reverse_on,
  *
  * Returns the randomized state snapshot (includes reverse_on).
  *
- * rand_fn: returns a random int (e.g., wraps rand()).
- *          If NULL, uses stdlib rand().
+ * rand_fn: returns a random int; called with the user_data given to
+ *          special_system_create().  If NULL, uses stdlib rand().
  */
-special_system_state_t special_system_randomize(special_system_t *ctx, int (*rand_fn)(void));
+special_system_state_t special_system_randomize(special_system_t *ctx, special_rand_fn rand_fn);
+
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/*
+ * Byte size of a state snapshot: the seven special flags.
+ * A snapshot holds no pointers, so it may be memcpy'd freely and loaded
+ * into any special_system_t from the same build.  Callbacks and user_data
+ * stay with the context they were created with.
+ */
+size_t special_system_snapshot_size(void);
+
+/* Copy the current state into buf (special_system_snapshot_size() bytes). */
+void special_system_snapshot_save(const special_system_t *ctx, void *buf);
+
+/* Replace the current state with a saved snapshot.  No callbacks fire. */
+void special_system_snapshot_load(special_system_t *ctx, const void *buf);
 
 #endif /* SPECIAL_SYSTEM_H */
@@ -0,0 +1,110 @@
+#ifndef STARTUP_PROFILE_H
+#define STARTUP_PROFILE_H
+
+/*
+ * startup_profile.h — Wall-clock breakdown of game startup by phase.
+ *
+ * game_create() marks the end of each startup phase (SDL init, window,
+ * textures, ...) and, under -startup-profile, prints the table once the
+ * game is ready.  A phase's time is the time since the previous mark, so
+ * the phases add up to the total.  With asset decoding running on worker
+ * threads, a phase that waits on the workers shows only the wait, not
+ * the decode work.
+ *
+ * Every function is a no-op on a NULL context, so call sites need no
+ * checks when profiling is off.
+ *
+ * Pure C, no SDL2.  Opaque context pattern.  See ADR-097 in
+ * docs/DESIGN.md.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+/* Most phases recorded; later marks are dropped. */
+#define STARTUP_PROFILE_MAX_PHASES 16
+
+/* =========================================================================
+ * Types
+ * ========================================================================= */
+
+typedef enum
+{
+    STARTUP_PROFILE_OK = 0,
+    STARTUP_PROFILE_ERR_NULL_ARG,
+    STARTUP_PROFILE_ERR_ALLOC_FAILED,
+    STARTUP_PROFILE_ERR_FULL
+} startup_profile_status_t;
+
+/* Monotonic clock in microseconds. */
+typedef uint64_t (*startup_profile_clock_fn)(void);
+
+/* One recorded phase. */
+typedef struct
+{
+    const char *name; /* As passed to startup_profile_mark() */
+    uint64_t us;      /* Time since the previous mark */
+} startup_profile_phase_t;
+
+typedef struct startup_profile startup_profile_t;
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+/*
+ * Create a profile; the first phase starts now.  clock_fn is required.
+ *
+ * Returns NULL on failure; *status (if non-NULL) indicates the reason.
+ */
+startup_profile_t *startup_profile_create(startup_profile_clock_fn clock_fn,
+                                          startup_profile_status_t *status);
+
+/* Free the profile.  Safe to call with NULL. */
+void startup_profile_destroy(startup_profile_t *ctx);
+
+/* =========================================================================
+ * Recording
+ * ========================================================================= */
+
+/*
+ * End the current phase, naming it, and start the next.  name is kept by
+ * pointer and must outlive the profile (string literals).  Returns
+ * STARTUP_PROFILE_ERR_FULL, recording nothing, once
+ * STARTUP_PROFILE_MAX_PHASES phases are recorded.
+ */
+startup_profile_status_t startup_profile_mark(startup_profile_t *ctx, const char *name);
+
+/* =========================================================================
+ * Queries
+ * ========================================================================= */
+
+/* Number of recorded phases; 0 for NULL. */
+int startup_profile_count(const startup_profile_t *ctx);
+
+/* Copy phase index into *out.  Returns STARTUP_PROFILE_ERR_NULL_ARG for
+ * NULL arguments or an index out of range. */
+startup_profile_status_t startup_profile_get(const startup_profile_t *ctx, int index,
+                                             startup_profile_phase_t *out);
+
+/* Sum of the recorded phases (create to last mark); 0 for NULL. */
+uint64_t startup_profile_total_us(const startup_profile_t *ctx);
+
+/*
+ * Print one line per phase (milliseconds and share of the total) and a
+ * total line to out.  Nothing is printed for NULL arguments.
+ */
+void startup_profile_report(const startup_profile_t *ctx, FILE *out);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *startup_profile_status_string(startup_profile_status_t status);
+
+#endif /* STARTUP_PROFILE_H */
@@ -0,0 +1,165 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * trace.h — Scoped timing zones exported as a Chrome trace.
+ *
+ * A zone is a named span of code bracketed by TRACE_BEGIN(name) and
+ * TRACE_END(name) in the same block.  While a trace is running, each
+ * completed zone is appended to a ring buffer owned by the calling
+ * thread, so recording takes no lock: the first zone a thread completes
+ * allocates its ring and pushes it onto a global list with a single
+ * compare-and-swap.  When a ring fills, the oldest zones are overwritten,
+ * so the file holds the most recent history.
+ *
+ * trace_write_json() writes every ring in the Trace Event Format read by
+ * chrome://tracing and ui.perfetto.dev: one complete ("X") event per zone
+ * and one thread-name record per ring.
+ *
+ * The same zones can also feed a running total per zone name instead of,
+ * or as well as, the file: trace_stats_start() turns that on for the
+ * calling thread and trace_stats_take() hands the totals to an on-screen
+ * display such as the performance HUD (ADR-092).
+ *
+ * The zone macros compile to nothing unless XBOING_TRACE is defined (the
+ * CMake option of the same name).  When compiled in but neither a trace
+ * nor the statistics are running, a zone costs an inline flag test at
+ * each end, no call.
+ *
+ * No dependency on SDL2.  The clock is injected.  See ADR-091 in
+ * docs/DESIGN.md.
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* =========================================================================
+ * Constants
+ * ========================================================================= */
+
+/* Ring size per thread: at ~20 zones per tick that is a minute of play. */
+#define TRACE_DEFAULT_EVENTS (1U << 18)
+
+/* Distinct zone names the statistics track; further names are ignored. */
+#define TRACE_MAX_STAT_ZONES 32
+
+/* =========================================================================
+ * Status codes
+ * ========================================================================= */
+
+typedef enum
+{
+    TRACE_OK = 0,
+    TRACE_ERR_NULL_ARG,
+    TRACE_ERR_RUNNING, /* trace_start or trace_stats_start when already running */
+    TRACE_ERR_IO       /* Output file could not be opened or written */
+} trace_status_t;
+
+/* =========================================================================
+ * Callback types
+ * ========================================================================= */
+
+/* Monotonic clock in nanoseconds.  Any epoch; only differences matter. */
+typedef uint64_t (*trace_clock_fn)(void);
+
+/* =========================================================================
+ * Zone statistics
+ * ========================================================================= */
+
+typedef struct
+{
+    const char *name;  /* Zone name, as passed to TRACE_BEGIN */
+    uint64_t total_ns; /* Time spent in the zone since the last take */
+    uint64_t count;    /* Completed zones since the last take */
+} trace_zone_stat_t;
+
+/* =========================================================================
+ * Zone macros
+ * ========================================================================= */
+
+/* Set while a trace or the statistics are running.  Read by the macros;
+ * do not write. */
+extern atomic_bool trace_active_flag;
+
+#ifdef XBOING_TRACE
+#define TRACE_BEGIN(name)                                                                          \
+    const uint64_t trace_t0_##name =                                                               \
+        atomic_load_explicit(&trace_active_flag, memory_order_relaxed) ? trace_zone_begin() : 0
+#define TRACE_END(name)                                                                            \
+    ((trace_t0_##name) != 0 ? trace_zone_end(#name, trace_t0_##name) : (void)0)
+#else
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END(name) ((void)0)
+#endif
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+/*
+ * Start recording.  events_per_thread is the ring size of each thread
+ * (0 = TRACE_DEFAULT_EVENTS).  Rings are allocated lazily, on a thread's
+ * first zone, so allocation failure there just drops that thread's zones.
+ */
+trace_status_t trace_start(trace_clock_fn clock_fn, size_t events_per_thread);
+
+/* True between trace_start and trace_shutdown. */
+bool trace_is_running(void);
+
+/*
+ * Write everything recorded so far to path as Trace Event Format JSON.
+ * Timestamps are microseconds since trace_start.  Call it from the thread
+ * that owns the trace, after the other recording threads have stopped.
+ */
+trace_status_t trace_write_json(const char *path);
+
+/* Number of zones lost to ring overwrites or failed ring allocation. */
+uint64_t trace_dropped(void);
+
+/* Stop recording and free every ring.  Safe to call when not running. */
+void trace_shutdown(void);
+
+/* =========================================================================
+ * Statistics
+ * ========================================================================= */
+
+/*
+ * Start totalling zone times by name on the calling thread; zones on other
+ * threads are not counted.  clock_fn is read only while no trace is
+ * running (a running trace keeps its own), so pass the same clock to both.
+ */
+trace_status_t trace_stats_start(trace_clock_fn clock_fn);
+
+/* Stop totalling.  Safe to call when not running. */
+void trace_stats_stop(void);
+
+/*
+ * Copy up to max zones with a nonzero count into out, largest total first,
+ * and reset every total to zero.  Call it from the thread that started the
+ * statistics.  Returns the number of zones copied.
+ */
+size_t trace_stats_take(trace_zone_stat_t *out, size_t max);
+
+/* =========================================================================
+ * Zone recording (use the macros)
+ * ========================================================================= */
+
+/* Return the zone start time, or 0 when neither a trace nor the
+ * statistics are running. */
+uint64_t trace_zone_begin(void);
+
+/* Record zone `name` as running from t0 to now.  The pointer is kept, so
+ * it must outlive the trace (TRACE_BEGIN passes a string literal).  The
+ * statistics merge zones by name content, not pointer. */
+void trace_zone_end(const char *name, uint64_t t0);
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+/* Return a human-readable string for a status code. */
+const char *trace_status_string(trace_status_t status);
+
+#endif /* TRACE_H */
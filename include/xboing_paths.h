@@ -30,6 +30,8 @@
  *   fonts/         — TTF fonts (symlinks to fonts-liberation in the .deb)
  *   images/        — PNG sprite sheets organized by category
  *   docs/          — bundled documentation (problems.doc)
+ *   xboing.pak     — all of the above but docs in one mapped file
+ *                    (asset_pack.h); the loose copies are the fallback
  */
 
 #ifndef XBOING_PATHS_H
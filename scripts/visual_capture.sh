@@ -5,11 +5,17 @@
 # Launches xboing with -visual-capture, reads XBOING_SNAPSHOT signals
 # from stdout, and captures the window at each sub-state transition.
 #
+# The original binary is captured from outside with ImageMagick import.
+# The modern binary writes its own PNGs (-capture-dir, ADR-093): it reads
+# each frame back before presenting it and encodes on a background
+# thread, so there is no window to find and no settle delay to wait out.
+# It also renders offscreen (ADR-094), so it needs no display at all.
+#
 # Usage:
 #   scripts/visual_capture.sh original <mode|all> <output-dir>
 #   scripts/visual_capture.sh modern   <mode|all> <output-dir>
 #
-# Prereqs: imagemagick (import), x11-utils (xwininfo, xprop)
+# Prereqs (original only): imagemagick (import), x11-utils (xwininfo, xprop)
 
 set -euo pipefail
 
@@ -23,18 +29,19 @@ require() {
     command -v "$1" >/dev/null 2>&1 || die "missing '$1'"
 }
 
-require import
-require xwininfo
-require xprop
-
-[[ -n "${DISPLAY:-}" ]] || die "DISPLAY not set"
-
 case "$VARIANT" in
     original) BINARY="./xboing" ; EXTRA_ARGS="-usedefcmap" ; RUN_DIR="original" ;;
     modern)   BINARY="./${BUILD_DIR:-build}/xboing" ; EXTRA_ARGS="" ; RUN_DIR="." ;;
     *)        die "Unknown variant '$VARIANT' — use 'original' or 'modern'" ;;
 esac
 
+if [[ "$VARIANT" == "original" ]]; then
+    require import
+    require xwininfo
+    require xprop
+    [[ -n "${DISPLAY:-}" ]] || die "DISPLAY not set"
+fi
+
 # Only the original binary parses -bonus-scenario.  The env var keeps
 # the script CLI surface unchanged for both variants.
 if [[ "$VARIANT" == "original" && -n "${BONUS_SCENARIO:-}" ]]; then
@@ -64,6 +71,10 @@ fi
 mkdir -p "$OUT_DIR"
 OUT_DIR="$(cd "$OUT_DIR" && pwd)"
 
+if [[ "$VARIANT" == "modern" ]]; then
+    EXTRA_ARGS="$EXTRA_ARGS -offscreen -capture-dir $OUT_DIR"
+fi
+
 find_xboing_window() {
     local target_pid="$1"
     xwininfo -root -tree 2>/dev/null \
@@ -110,6 +121,13 @@ while IFS= read -r -t 300 line; do
             filename="${rest//\//-}.png"
             mkdir -p "$OUT_DIR/$mode_dir"
 
+            if [[ "$VARIANT" == "modern" ]]; then
+                # Written by the binary; on disk by XBOING_SNAPSHOT_DONE.
+                echo "  queued $name → $mode_dir/$filename"
+                COUNT=$((COUNT + 1))
+                continue
+            fi
+
             if [[ -z "$WIN_ID" ]]; then
                 WIN_ID="$(find_xboing_window "$XPID")"
                 [[ -n "$WIN_ID" ]] || die "Could not find XBoing window for PID $XPID"
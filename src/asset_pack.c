@@ -0,0 +1,624 @@
+/*
+ * asset_pack.c — Single-file, memory-mapped asset pack.
+ *
+ * See include/asset_pack.h for API documentation and the file layout.
+ * See ADR-098 in docs/DESIGN.md for design rationale.
+ */
+
+#include "asset_pack.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* =========================================================================
+ * On-disk format
+ * ========================================================================= */
+
+static const uint8_t pack_magic[8] = {'X', 'B', 'O', 'I', 'N', 'G', 'P', 'K'};
+
+#define HEADER_SIZE 64
+#define ENTRY_SIZE 48
+
+/* Header field offsets. */
+#define H_MAGIC 0
+#define H_VERSION 8
+#define H_COUNT 12
+#define H_BUCKETS 16
+#define H_ENTRIES_OFF 24
+#define H_BUCKETS_OFF 32
+#define H_STRINGS_OFF 40
+#define H_STRINGS_SIZE 48
+#define H_FILE_SIZE 56
+
+/* Entry record field offsets. */
+#define E_KEY_OFF 0
+#define E_KEY_LEN 4
+#define E_KIND 8
+#define E_HASH 12
+#define E_DATA_OFF 16
+#define E_DATA_SIZE 24
+#define E_PARAM 32
+
+/* Far more than the ~250 stock assets; bounds the directory checks. */
+#define MAX_ENTRIES (1 << 20)
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t get_u64(const uint8_t *p)
+{
+    return (uint64_t)get_u32(p) | (uint64_t)get_u32(p + 4) << 32;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put_u64(uint8_t *p, uint64_t v)
+{
+    put_u32(p, (uint32_t)v);
+    put_u32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t fnv1a_hash(const char *str)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *p = str; *p != '\0'; p++)
+    {
+        hash ^= (uint32_t)(unsigned char)*p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint64_t align_up(uint64_t v)
+{
+    return (v + ASSET_PACK_ALIGN - 1) & ~(uint64_t)(ASSET_PACK_ALIGN - 1);
+}
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+struct asset_pack
+{
+    const uint8_t *base; /* The whole file, mapped read-only */
+    size_t size;
+    uint32_t count;
+    uint32_t bucket_count; /* Power of two, above count */
+    const uint8_t *entries;
+    const uint8_t *buckets;
+    const char *strings;
+};
+
+struct pack_item
+{
+    char *key;
+    void *data;
+    size_t size;
+    asset_pack_kind_t kind;
+    uint32_t param[3];
+};
+
+struct asset_pack_writer
+{
+    struct pack_item *items;
+    int count;
+    int capacity;
+};
+
+/* =========================================================================
+ * Reading — validation
+ * ========================================================================= */
+
+/* True if [offset, offset + len) lies within a file of size bytes. */
+static bool in_file(uint64_t offset, uint64_t len, size_t size)
+{
+    return offset <= size && len <= size - offset;
+}
+
+/* Check the header and directory so lookups can trust every offset. */
+static bool validate(asset_pack_t *ctx)
+{
+    const uint8_t *h = ctx->base;
+    if (ctx->size < HEADER_SIZE || memcmp(h + H_MAGIC, pack_magic, sizeof(pack_magic)) != 0 ||
+        get_u32(h + H_VERSION) != ASSET_PACK_VERSION || get_u64(h + H_FILE_SIZE) != ctx->size)
+    {
+        return false;
+    }
+
+    uint32_t count = get_u32(h + H_COUNT);
+    uint32_t buckets = get_u32(h + H_BUCKETS);
+    if (count > MAX_ENTRIES || buckets <= count || (buckets & (buckets - 1)) != 0)
+    {
+        return false;
+    }
+
+    uint64_t entries_off = get_u64(h + H_ENTRIES_OFF);
+    uint64_t buckets_off = get_u64(h + H_BUCKETS_OFF);
+    uint64_t strings_off = get_u64(h + H_STRINGS_OFF);
+    uint64_t strings_size = get_u64(h + H_STRINGS_SIZE);
+    if (!in_file(entries_off, (uint64_t)count * ENTRY_SIZE, ctx->size) ||
+        !in_file(buckets_off, (uint64_t)buckets * 4, ctx->size) ||
+        !in_file(strings_off, strings_size, ctx->size))
+    {
+        return false;
+    }
+
+    ctx->count = count;
+    ctx->bucket_count = buckets;
+    ctx->entries = ctx->base + entries_off;
+    ctx->buckets = ctx->base + buckets_off;
+    ctx->strings = (const char *)ctx->base + strings_off;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint8_t *e = ctx->entries + (size_t)i * ENTRY_SIZE;
+        uint32_t key_off = get_u32(e + E_KEY_OFF);
+        uint32_t key_len = get_u32(e + E_KEY_LEN);
+        uint64_t data_off = get_u64(e + E_DATA_OFF);
+        if (key_len == 0 || key_len > ASSET_PACK_MAX_KEY ||
+            !in_file(key_off, (uint64_t)key_len + 1, (size_t)strings_size) ||
+            strnlen(ctx->strings + key_off, key_len + 1) != key_len ||
+            get_u32(e + E_KIND) > ASSET_PACK_PCM || data_off % ASSET_PACK_ALIGN != 0 ||
+            !in_file(data_off, get_u64(e + E_DATA_SIZE), ctx->size))
+        {
+            return false;
+        }
+    }
+    for (uint32_t b = 0; b < buckets; b++)
+    {
+        if (get_u32(ctx->buckets + (size_t)b * 4) > count)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void fill_entry(const asset_pack_t *ctx, uint32_t index, asset_pack_entry_t *out)
+{
+    const uint8_t *e = ctx->entries + (size_t)index * ENTRY_SIZE;
+    out->key = ctx->strings + get_u32(e + E_KEY_OFF);
+    out->data = ctx->base + get_u64(e + E_DATA_OFF);
+    out->size = (size_t)get_u64(e + E_DATA_SIZE);
+    out->kind = (asset_pack_kind_t)get_u32(e + E_KIND);
+    for (int i = 0; i < 3; i++)
+    {
+        out->param[i] = get_u32(e + E_PARAM + 4 * i);
+    }
+}
+
+/* =========================================================================
+ * Public API — Reading
+ * ========================================================================= */
+
+asset_pack_t *asset_pack_open(const char *path, asset_pack_status_t *status)
+{
+    asset_pack_status_t st = ASSET_PACK_OK;
+    asset_pack_t *ctx = NULL;
+    int fd = -1;
+
+    if (path == NULL)
+    {
+        st = ASSET_PACK_ERR_NULL_ARG;
+        goto done;
+    }
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat sb;
+    if (fd < 0 || fstat(fd, &sb) != 0)
+    {
+        st = ASSET_PACK_ERR_IO;
+        goto done;
+    }
+    if (!S_ISREG(sb.st_mode) || sb.st_size < HEADER_SIZE || (uint64_t)sb.st_size > SIZE_MAX)
+    {
+        st = ASSET_PACK_ERR_BAD_FORMAT;
+        goto done;
+    }
+
+    ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        st = ASSET_PACK_ERR_ALLOC_FAILED;
+        goto done;
+    }
+
+    ctx->size = (size_t)sb.st_size;
+    void *map = mmap(NULL, ctx->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        st = ASSET_PACK_ERR_IO;
+        free(ctx);
+        ctx = NULL;
+        goto done;
+    }
+    ctx->base = map;
+
+    /* Start the whole file on its way now; the directory checks below
+     * and the first lookups would otherwise fault it in page by page. */
+    (void)posix_madvise(map, ctx->size, POSIX_MADV_WILLNEED);
+
+    if (!validate(ctx))
+    {
+        st = ASSET_PACK_ERR_BAD_FORMAT;
+        asset_pack_close(ctx);
+        ctx = NULL;
+    }
+
+done:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    if (status != NULL)
+    {
+        *status = st;
+    }
+    return ctx;
+}
+
+void asset_pack_close(asset_pack_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    munmap((void *)ctx->base, ctx->size);
+    free(ctx);
+}
+
+asset_pack_status_t asset_pack_find(const asset_pack_t *ctx, const char *key,
+                                    asset_pack_entry_t *out)
+{
+    if (key == NULL || out == NULL)
+    {
+        return ASSET_PACK_ERR_NULL_ARG;
+    }
+    if (ctx == NULL)
+    {
+        return ASSET_PACK_ERR_NOT_FOUND;
+    }
+
+    uint32_t hash = fnv1a_hash(key);
+    uint32_t mask = ctx->bucket_count - 1;
+    for (uint32_t probe = 0; probe < ctx->bucket_count; probe++)
+    {
+        uint32_t slot = get_u32(ctx->buckets + (size_t)((hash + probe) & mask) * 4);
+        if (slot == 0)
+        {
+            break;
+        }
+        const uint8_t *e = ctx->entries + (size_t)(slot - 1) * ENTRY_SIZE;
+        if (get_u32(e + E_HASH) == hash && strcmp(ctx->strings + get_u32(e + E_KEY_OFF), key) == 0)
+        {
+            fill_entry(ctx, slot - 1, out);
+            return ASSET_PACK_OK;
+        }
+    }
+    return ASSET_PACK_ERR_NOT_FOUND;
+}
+
+int asset_pack_count(const asset_pack_t *ctx)
+{
+    return ctx != NULL ? (int)ctx->count : 0;
+}
+
+asset_pack_status_t asset_pack_get(const asset_pack_t *ctx, int index, asset_pack_entry_t *out)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return ASSET_PACK_ERR_NULL_ARG;
+    }
+    if (index < 0 || (uint32_t)index >= ctx->count)
+    {
+        return ASSET_PACK_ERR_NOT_FOUND;
+    }
+    fill_entry(ctx, (uint32_t)index, out);
+    return ASSET_PACK_OK;
+}
+
+int asset_pack_count_prefix(const asset_pack_t *ctx, const char *prefix)
+{
+    if (ctx == NULL || prefix == NULL)
+    {
+        return 0;
+    }
+    size_t len = strlen(prefix);
+    int n = 0;
+    for (uint32_t i = 0; i < ctx->count; i++)
+    {
+        const char *key = ctx->strings + get_u32(ctx->entries + (size_t)i * ENTRY_SIZE);
+        if (strncmp(key, prefix, len) == 0)
+        {
+            n++;
+        }
+    }
+    return n;
+}
+
+/* =========================================================================
+ * Public API — Writing
+ * ========================================================================= */
+
+asset_pack_writer_t *asset_pack_writer_create(asset_pack_status_t *status)
+{
+    asset_pack_writer_t *w = calloc(1, sizeof(*w));
+    if (status != NULL)
+    {
+        *status = w != NULL ? ASSET_PACK_OK : ASSET_PACK_ERR_ALLOC_FAILED;
+    }
+    return w;
+}
+
+void asset_pack_writer_destroy(asset_pack_writer_t *w)
+{
+    if (w == NULL)
+    {
+        return;
+    }
+    for (int i = 0; i < w->count; i++)
+    {
+        free(w->items[i].key);
+        free(w->items[i].data);
+    }
+    free(w->items);
+    free(w);
+}
+
+asset_pack_status_t asset_pack_writer_add(asset_pack_writer_t *w, const asset_pack_entry_t *entry)
+{
+    if (w == NULL || entry == NULL || entry->key == NULL ||
+        (entry->data == NULL && entry->size > 0))
+    {
+        return ASSET_PACK_ERR_NULL_ARG;
+    }
+    size_t key_len = strlen(entry->key);
+    if (key_len == 0 || key_len > ASSET_PACK_MAX_KEY)
+    {
+        return ASSET_PACK_ERR_KEY_TOO_LONG;
+    }
+    if (entry->kind > ASSET_PACK_PCM)
+    {
+        return ASSET_PACK_ERR_BAD_FORMAT;
+    }
+    for (int i = 0; i < w->count; i++)
+    {
+        if (strcmp(w->items[i].key, entry->key) == 0)
+        {
+            return ASSET_PACK_ERR_DUPLICATE;
+        }
+    }
+    if (w->count >= MAX_ENTRIES)
+    {
+        return ASSET_PACK_ERR_ALLOC_FAILED;
+    }
+
+    if (w->count == w->capacity)
+    {
+        int cap = w->capacity > 0 ? w->capacity * 2 : 64;
+        struct pack_item *items = realloc(w->items, (size_t)cap * sizeof(*items));
+        if (items == NULL)
+        {
+            return ASSET_PACK_ERR_ALLOC_FAILED;
+        }
+        w->items = items;
+        w->capacity = cap;
+    }
+
+    struct pack_item *it = &w->items[w->count];
+    it->key = malloc(key_len + 1);
+    it->data = malloc(entry->size > 0 ? entry->size : 1);
+    if (it->key == NULL || it->data == NULL)
+    {
+        free(it->key);
+        free(it->data);
+        return ASSET_PACK_ERR_ALLOC_FAILED;
+    }
+    memcpy(it->key, entry->key, key_len + 1);
+    if (entry->size > 0)
+    {
+        memcpy(it->data, entry->data, entry->size);
+    }
+    it->size = entry->size;
+    it->kind = entry->kind;
+    memcpy(it->param, entry->param, sizeof(it->param));
+    w->count++;
+    return ASSET_PACK_OK;
+}
+
+int asset_pack_writer_count(const asset_pack_writer_t *w)
+{
+    return w != NULL ? w->count : 0;
+}
+
+static int compare_items(const void *a, const void *b)
+{
+    const struct pack_item *const *ia = a;
+    const struct pack_item *const *ib = b;
+    return strcmp((*ia)->key, (*ib)->key);
+}
+
+/* Write len bytes, then zeros up to offset *pos + len rounded up to
+ * ASSET_PACK_ALIGN.  Returns false on a write error. */
+static bool write_aligned(FILE *fp, const void *data, size_t len, uint64_t *pos)
+{
+    static const uint8_t zeros[ASSET_PACK_ALIGN];
+    if (len > 0 && fwrite(data, 1, len, fp) != len)
+    {
+        return false;
+    }
+    uint64_t end = *pos + len;
+    size_t pad = (size_t)(align_up(end) - end);
+    if (pad > 0 && fwrite(zeros, 1, pad, fp) != pad)
+    {
+        return false;
+    }
+    *pos = end + pad;
+    return true;
+}
+
+/* Build the header and directory (everything before the first blob) in
+ * one buffer, then stream the blobs after it. */
+static bool write_pack(FILE *fp, const asset_pack_writer_t *w, struct pack_item **sorted)
+{
+    uint32_t count = (uint32_t)w->count;
+    uint32_t buckets = 8;
+    while (buckets < count * 2)
+    {
+        buckets *= 2;
+    }
+
+    uint64_t strings_size = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        strings_size += strlen(sorted[i]->key) + 1;
+    }
+
+    uint64_t entries_off = HEADER_SIZE;
+    uint64_t buckets_off = entries_off + (uint64_t)count * ENTRY_SIZE;
+    uint64_t strings_off = buckets_off + (uint64_t)buckets * 4;
+    uint64_t dir_size = strings_off + strings_size;
+    uint64_t data_off = align_up(dir_size);
+
+    uint8_t *dir = calloc(1, (size_t)dir_size);
+    if (dir == NULL)
+    {
+        return false;
+    }
+
+    uint64_t key_off = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const struct pack_item *it = sorted[i];
+        size_t key_len = strlen(it->key);
+        uint32_t hash = fnv1a_hash(it->key);
+        uint8_t *e = dir + entries_off + (uint64_t)i * ENTRY_SIZE;
+        put_u32(e + E_KEY_OFF, (uint32_t)key_off);
+        put_u32(e + E_KEY_LEN, (uint32_t)key_len);
+        put_u32(e + E_KIND, (uint32_t)it->kind);
+        put_u32(e + E_HASH, hash);
+        put_u64(e + E_DATA_OFF, data_off);
+        put_u64(e + E_DATA_SIZE, it->size);
+        for (int p = 0; p < 3; p++)
+        {
+            put_u32(e + E_PARAM + 4 * p, it->param[p]);
+        }
+        memcpy(dir + strings_off + key_off, it->key, key_len + 1);
+        key_off += key_len + 1;
+        data_off = align_up(data_off + it->size);
+
+        uint32_t mask = buckets - 1;
+        uint32_t slot = hash & mask;
+        while (get_u32(dir + buckets_off + (uint64_t)slot * 4) != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        put_u32(dir + buckets_off + (uint64_t)slot * 4, i + 1);
+    }
+
+    memcpy(dir + H_MAGIC, pack_magic, sizeof(pack_magic));
+    put_u32(dir + H_VERSION, ASSET_PACK_VERSION);
+    put_u32(dir + H_COUNT, count);
+    put_u32(dir + H_BUCKETS, buckets);
+    put_u64(dir + H_ENTRIES_OFF, entries_off);
+    put_u64(dir + H_BUCKETS_OFF, buckets_off);
+    put_u64(dir + H_STRINGS_OFF, strings_off);
+    put_u64(dir + H_STRINGS_SIZE, strings_size);
+    put_u64(dir + H_FILE_SIZE, data_off);
+
+    uint64_t pos = 0;
+    bool ok = write_aligned(fp, dir, (size_t)dir_size, &pos);
+    free(dir);
+    for (uint32_t i = 0; ok && i < count; i++)
+    {
+        ok = write_aligned(fp, sorted[i]->data, sorted[i]->size, &pos);
+    }
+    return ok;
+}
+
+asset_pack_status_t asset_pack_writer_save(const asset_pack_writer_t *w, const char *path)
+{
+    if (w == NULL || path == NULL)
+    {
+        return ASSET_PACK_ERR_NULL_ARG;
+    }
+
+    char tmp_path[1024];
+    int n = snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    if (n < 0 || (size_t)n >= sizeof(tmp_path))
+    {
+        return ASSET_PACK_ERR_IO;
+    }
+
+    struct pack_item **sorted = malloc((size_t)(w->count > 0 ? w->count : 1) * sizeof(*sorted));
+    if (sorted == NULL)
+    {
+        return ASSET_PACK_ERR_ALLOC_FAILED;
+    }
+    for (int i = 0; i < w->count; i++)
+    {
+        sorted[i] = &w->items[i];
+    }
+    qsort(sorted, (size_t)w->count, sizeof(*sorted), compare_items);
+
+    FILE *fp = fopen(tmp_path, "wb");
+    if (fp == NULL)
+    {
+        free(sorted);
+        return ASSET_PACK_ERR_IO;
+    }
+    bool ok = write_pack(fp, w, sorted);
+    free(sorted);
+    if (fclose(fp) != 0)
+    {
+        ok = false;
+    }
+    if (!ok || rename(tmp_path, path) != 0)
+    {
+        (void)remove(tmp_path);
+        return ASSET_PACK_ERR_IO;
+    }
+    return ASSET_PACK_OK;
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *asset_pack_status_string(asset_pack_status_t status)
+{
+    switch (status)
+    {
+        case ASSET_PACK_OK:
+            return "OK";
+        case ASSET_PACK_ERR_NULL_ARG:
+            return "NULL argument";
+        case ASSET_PACK_ERR_ALLOC_FAILED:
+            return "allocation failed";
+        case ASSET_PACK_ERR_IO:
+            return "cannot read or write pack file";
+        case ASSET_PACK_ERR_BAD_FORMAT:
+            return "not a valid asset pack";
+        case ASSET_PACK_ERR_NOT_FOUND:
+            return "asset not found";
+        case ASSET_PACK_ERR_KEY_TOO_LONG:
+            return "key empty or too long";
+        case ASSET_PACK_ERR_DUPLICATE:
+            return "duplicate key";
+    }
+    return "unknown status";
+}
@@ -0,0 +1,167 @@
+/*
+ * atlas_pack.c — Shelf packer for texture atlas pages.
+ *
+ * See include/atlas_pack.h for API documentation and ADR-085 in
+ * docs/DESIGN.md for design rationale.
+ */
+
+#include "atlas_pack.h"
+
+#include <stdlib.h>
+
+/* =========================================================================
+ * Internal state
+ * ========================================================================= */
+
+/* The open (bottom-most) shelf of one page. */
+typedef struct
+{
+    int shelf_y; /* Top of the open shelf */
+    int shelf_h; /* Height of the tallest item on it */
+    int cursor;  /* Next free x on it */
+} page_state_t;
+
+typedef struct
+{
+    const atlas_pack_item_t *item;
+    int index;
+} order_t;
+
+/* Tallest first, then widest, then input order: a total order, so the
+ * layout does not depend on the qsort implementation. */
+static int compare_order(const void *a, const void *b)
+{
+    const order_t *oa = a;
+    const order_t *ob = b;
+    if (oa->item->h != ob->item->h)
+    {
+        return ob->item->h - oa->item->h;
+    }
+    if (oa->item->w != ob->item->w)
+    {
+        return ob->item->w - oa->item->w;
+    }
+    return oa->index - ob->index;
+}
+
+/*
+ * Place a w x h item on page p if it fits on the open shelf or on a new
+ * shelf below it.  Returns nonzero and fills (x, y) on success.
+ */
+static int place_on_page(page_state_t *p, int w, int h, int page_size, int padding, int *x,
+                         int *y)
+{
+    if (p->cursor + w <= page_size && p->shelf_y + h <= page_size &&
+        (p->shelf_h == 0 || h <= p->shelf_h))
+    {
+        *x = p->cursor;
+        *y = p->shelf_y;
+        p->cursor += w + padding;
+        if (h > p->shelf_h)
+        {
+            p->shelf_h = h;
+        }
+        return 1;
+    }
+
+    int next_y = p->shelf_y + p->shelf_h + padding;
+    if (p->shelf_h == 0 || next_y + h > page_size || w > page_size)
+    {
+        return 0;
+    }
+    p->shelf_y = next_y;
+    p->shelf_h = h;
+    p->cursor = w + padding;
+    *x = 0;
+    *y = next_y;
+    return 1;
+}
+
+/* =========================================================================
+ * Public API
+ * ========================================================================= */
+
+atlas_pack_status_t atlas_pack(atlas_pack_item_t *items, int count, int page_size, int padding,
+                               int max_pages, int *pages_used)
+{
+    if (pages_used == NULL || (items == NULL && count > 0))
+    {
+        return ATLAS_PACK_ERR_NULL_ARG;
+    }
+    *pages_used = 0;
+    if (page_size <= 0 || padding < 0 || max_pages < 0 || count < 0)
+    {
+        return ATLAS_PACK_ERR_BAD_SIZE;
+    }
+    if (count == 0)
+    {
+        return ATLAS_PACK_OK;
+    }
+
+    order_t *order = malloc((size_t)count * sizeof(*order));
+    page_state_t *pages = calloc((size_t)(max_pages > 0 ? max_pages : 1), sizeof(*pages));
+    if (order == NULL || pages == NULL)
+    {
+        free(order);
+        free(pages);
+        return ATLAS_PACK_ERR_NO_MEMORY;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        items[i].page = ATLAS_PACK_NONE;
+        items[i].x = 0;
+        items[i].y = 0;
+        order[i].item = &items[i];
+        order[i].index = i;
+    }
+    qsort(order, (size_t)count, sizeof(*order), compare_order);
+
+    int open = 0;
+    for (int i = 0; i < count; i++)
+    {
+        atlas_pack_item_t *it = &items[order[i].index];
+        if (it->w <= 0 || it->h <= 0 || it->w > page_size || it->h > page_size)
+        {
+            continue;
+        }
+
+        /* First fit over the pages already open, then a fresh page. */
+        for (int p = 0; p < max_pages; p++)
+        {
+            if (p == open)
+            {
+                open++;
+            }
+            if (place_on_page(&pages[p], it->w, it->h, page_size, padding, &it->x, &it->y))
+            {
+                it->page = p;
+                break;
+            }
+        }
+    }
+
+    /* Every item that passed the size check fits a fresh page, so no page
+     * is opened and then left empty. */
+    *pages_used = open;
+
+    free(order);
+    free(pages);
+    return ATLAS_PACK_OK;
+}
+
+const char *atlas_pack_status_string(atlas_pack_status_t status)
+{
+    switch (status)
+    {
+        case ATLAS_PACK_OK:
+            return "OK";
+        case ATLAS_PACK_ERR_NULL_ARG:
+            return "NULL argument";
+        case ATLAS_PACK_ERR_BAD_SIZE:
+            return "invalid page size or count";
+        case ATLAS_PACK_ERR_NO_MEMORY:
+            return "out of memory";
+    }
+    return "unknown status";
+}
@@ -13,6 +13,7 @@
 #include "ball_math.h"
 #include "block_types.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -27,8 +28,11 @@ struct ball_system
     int guide_inc;         /* +1 or -1, guide animation direction */
     int last_update_frame; /* Most recent env->frame from ball_system_update */
     float machine_eps;
+
+    /* Wiring — everything above is snapshot state (see Snapshots) */
     ball_system_callbacks_t callbacks;
     void *user_data;
+    ball_rand_fn rand_fn;
 };
 
 /* =========================================================================
@@ -51,15 +55,32 @@ static void animate_ball_create(ball_system_t *ctx, const ball_system_env_t *env
 static void do_ball_wait(ball_system_t *ctx, const ball_system_env_t *env, int i);
 static void randomise_velocity(ball_system_t *ctx, const ball_system_env_t *env, int i);
 static void update_guide(ball_system_t *ctx, const ball_system_env_t *env);
-static int check_for_collision(ball_system_t *ctx, int x, int y, int *r, int *c, int ball_index);
+/* Cells fetched once per ray-march through the get_window callback. */
+typedef struct
+{
+    block_window_t cells;
+    int valid;
+} cell_window_t;
+
+static int check_for_collision(ball_system_t *ctx, cell_window_t *win, int x, int y, int *r,
+                               int *c, int ball_index);
 static void teleport_ball(ball_system_t *ctx, const ball_system_env_t *env, int i);
 
+static int get_rand(const ball_system_t *ctx)
+{
+    if (ctx->rand_fn)
+    {
+        return ctx->rand_fn(ctx->user_data);
+    }
+    return rand();
+}
+
 /* =========================================================================
  * Public API — Lifecycle
  * ========================================================================= */
 
 ball_system_t *ball_system_create(const ball_system_callbacks_t *callbacks, void *user_data,
-                                  ball_system_status_t *status)
+                                  ball_rand_fn rand_fn, ball_system_status_t *status)
 {
     ball_system_t *ctx = calloc(1, sizeof(*ctx));
     if (ctx == NULL)
@@ -80,6 +101,7 @@ ball_system_t *ball_system_create(const ball_system_callbacks_t *callbacks, void
         ctx->callbacks = *callbacks;
     }
     ctx->user_data = user_data;
+    ctx->rand_fn = rand_fn;
 
     /* Clear all ball slots to defaults */
     for (int i = 0; i < MAX_BALLS; i++)
@@ -138,7 +160,8 @@ int ball_system_add(ball_system_t *ctx, const ball_system_env_t *env, int x, int
             ctx->balls[i].dx = dx;
             ctx->balls[i].dy = dy;
             ctx->balls[i].ballState = BALL_CREATE;
-            ctx->balls[i].mass = (float)((rand() % (int)MAX_BALL_MASS) + (int)MIN_BALL_MASS);
+            ctx->balls[i].mass =
+                (float)((get_rand(ctx) % (int)MAX_BALL_MASS) + (int)MIN_BALL_MASS);
             ctx->balls[i].slide = 0;
             ctx->balls[i].nextFrame = env->frame + BIRTH_FRAME_RATE;
 
@@ -460,7 +483,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
     /*
      * Main physics update for a single ball.
      * Handles wall collision, paddle collision, speed normalization,
-     * block collision (via check_region/on_block_hit callbacks),
+     * block collision (via get_window or check_region, and on_block_hit),
      * and ball-to-ball collision (via ball_math).
      * Matches UpdateABall() in ball.c:1023-1346.
      */
@@ -487,7 +510,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
         b->dx = abs(b->dx);
         if (ctx->callbacks.on_sound != NULL)
         {
-            ctx->callbacks.on_sound("boing", 10, ctx->user_data);
+            ctx->callbacks.on_sound(SOUND_BOING, 10, ctx->user_data);
         }
     }
     else if (env->no_walls != 0 && b->ballx < BALL_WC)
@@ -507,7 +530,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
         b->dx = -(abs(b->dx));
         if (ctx->callbacks.on_sound != NULL)
         {
-            ctx->callbacks.on_sound("boing", 10, ctx->user_data);
+            ctx->callbacks.on_sound(SOUND_BOING, 10, ctx->user_data);
         }
     }
     else if (env->no_walls != 0 && b->ballx > (env->play_width - BALL_WC))
@@ -527,7 +550,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
         b->dy = abs(b->dy);
         if (ctx->callbacks.on_sound != NULL)
         {
-            ctx->callbacks.on_sound("boing", 10, ctx->user_data);
+            ctx->callbacks.on_sound(SOUND_BOING, 10, ctx->user_data);
         }
     }
 
@@ -624,6 +647,9 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
         int cx = b->dx > 0 ? 1 : -1;
         int cy = b->dy > 0 ? 1 : -1;
 
+        cell_window_t win;
+        win.valid = 0;
+
         float incx, incy;
         int step;
 
@@ -648,7 +674,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
 
         for (int j = 0; j < step; j++)
         {
-            int ret = check_for_collision(ctx, (int)x_f, (int)y_f, &row, &col, i);
+            int ret = check_for_collision(ctx, &win, (int)x_f, (int)y_f, &row, &col, i);
             if (ret != BALL_REGION_NONE)
             {
                 /* Delegate block handling to callback */
@@ -670,7 +696,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
 
                 int ddx = 0;
                 int ddy = 0;
-                int r = (rand() >> 16) % 4;
+                int r = (get_rand(ctx) >> 16) % 4;
 
                 switch (ret)
                 {
@@ -724,8 +750,8 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
                         break;
                 }
 
-                b->ballx = (int)x_f + b->dx + ddx + 1 - rand() % 3;
-                b->bally = (int)y_f + b->dy + ddy + 1 - rand() % 3;
+                b->ballx = (int)x_f + b->dx + ddx + 1 - get_rand(ctx) % 3;
+                b->bally = (int)y_f + b->dy + ddy + 1 - get_rand(ctx) % 3;
 
                 break;
             }
@@ -753,7 +779,7 @@ static void update_a_ball(ball_system_t *ctx, const ball_system_env_t *env, int
 
                     if (ctx->callbacks.on_sound != NULL)
                     {
-                        ctx->callbacks.on_sound("ball2ball", 90, ctx->user_data);
+                        ctx->callbacks.on_sound(SOUND_BALL2BALL, 90, ctx->user_data);
                     }
                 }
             }
@@ -941,14 +967,14 @@ static void randomise_velocity(ball_system_t *ctx, const ball_system_env_t *env,
 
     while (b->dx == 0 || b->dy == 0)
     {
-        b->dx = (rand() % (MAX_X_VEL - 3)) + 3;
-        b->dy = (rand() % (MAX_Y_VEL - 3)) + 3;
+        b->dx = (get_rand(ctx) % (MAX_X_VEL - 3)) + 3;
+        b->dy = (get_rand(ctx) % (MAX_Y_VEL - 3)) + 3;
 
-        if ((rand() % 10) < 5)
+        if ((get_rand(ctx) % 10) < 5)
         {
             b->dx *= -1;
         }
-        if ((rand() % 10) < 5)
+        if ((get_rand(ctx) % 10) < 5)
         {
             b->dy *= -1;
         }
@@ -983,7 +1009,19 @@ static void update_guide(ball_system_t *ctx, const ball_system_env_t *env)
  * Static helpers — block collision
  * ========================================================================= */
 
-static int check_for_collision(ball_system_t *ctx, int x, int y, int *r, int *c, int ball_index)
+/* Region of one probed cell: from the window when get_window supplied
+ * one, otherwise through check_region. */
+static int probe_cell(ball_system_t *ctx, const cell_window_t *win, int row, int col, int x, int y)
+{
+    if (win->valid)
+    {
+        return block_window_check_region(&win->cells, row, col, x, y);
+    }
+    return ctx->callbacks.check_region(row, col, x, y, 0, ctx->user_data);
+}
+
+static int check_for_collision(ball_system_t *ctx, cell_window_t *win, int x, int y, int *r,
+                               int *c, int ball_index)
 {
     /*
      * Check each adjoining block and see if the ball has hit any region in it.
@@ -1008,14 +1046,21 @@ static int check_for_collision(ball_system_t *ctx, int x, int y, int *r, int *c,
 
     int ret, row, col;
 
-    if (ctx->callbacks.check_region == NULL)
+    row = *r;
+    col = *c;
+
+    /* One window serves every probe below while the search base stays
+     * put; it only moves after a hit or the quirk drift. */
+    if (ctx->callbacks.get_window != NULL &&
+        (!win->valid || win->cells.row != row || win->cells.col != col))
+    {
+        win->valid = ctx->callbacks.get_window(row, col, &win->cells, ctx->user_data);
+    }
+    if (!win->valid && ctx->callbacks.check_region == NULL)
     {
         return BALL_REGION_NONE;
     }
 
-    row = *r;
-    col = *c;
-
     /* Check cell and 8 neighbors in original's order:
      * (0,0), (+1,0), (-1,0), (0,+1), (0,-1), (+1,+1), (-1,-1), (+1,-1)
      * The 9th cell (-1, +1) is handled below to preserve the original quirk. */
@@ -1025,7 +1070,7 @@ static int check_for_collision(ball_system_t *ctx, int x, int y, int *r, int *c,
     ret = BALL_REGION_NONE;
     for (int n = 0; n < 8; n++)
     {
-        ret = ctx->callbacks.check_region(row + dr[n], col + dc[n], x, y, 0, ctx->user_data);
+        ret = probe_cell(ctx, win, row + dr[n], col + dc[n], x, y);
         if (ret != BALL_REGION_NONE)
         {
             row += dr[n];
@@ -1037,7 +1082,7 @@ static int check_for_collision(ball_system_t *ctx, int x, int y, int *r, int *c,
     if (ret == BALL_REGION_NONE)
     {
         /* 9th neighbor: (-1, +1).  Original quirk preserved verbatim. */
-        ret = ctx->callbacks.check_region(row - 1, col + 1, x, y, 0, ctx->user_data);
+        ret = probe_cell(ctx, win, row - 1, col + 1, x, y);
         if (ret != BALL_REGION_NONE)
         {
             /* Original/ball.c:1499-1500 discards the hit and points
@@ -1083,8 +1128,8 @@ static void teleport_ball(ball_system_t *ctx, const ball_system_env_t *env, int
 
         /* Legacy ball.c:529-530 uses +1, skipping row 0 and col 0.
          * Column MAX_COL is rejected by the bounds check below. */
-        int r = (rand() % (MAX_ROW - 6)) + 1;
-        int c = (rand() % MAX_COL) + 1;
+        int r = (get_rand(ctx) % (MAX_ROW - 6)) + 1;
+        int c = (get_rand(ctx) % MAX_COL) + 1;
 
         if (r < 0 || r >= MAX_ROW)
         {
@@ -1355,6 +1400,36 @@ ball_system_status_t ball_system_restore(ball_system_t *ctx, int index, int curr
     return BALL_SYS_OK;
 }
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct ball_system, copied as bytes. */
+#define BALL_SNAPSHOT_SIZE offsetof(struct ball_system, callbacks)
+
+size_t ball_system_snapshot_size(void)
+{
+    return BALL_SNAPSHOT_SIZE;
+}
+
+void ball_system_snapshot_save(const ball_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, BALL_SNAPSHOT_SIZE);
+}
+
+void ball_system_snapshot_load(ball_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, BALL_SNAPSHOT_SIZE);
+}
+
 /* =========================================================================
  * Public API — Utility
  * ========================================================================= */
@@ -9,10 +9,13 @@
  */
 
 #include "block_system.h"
-#include "ball_types.h"  /* BALL_WC, BALL_HC, BALL_WIDTH, BALL_HEIGHT */
+#include "block_geom.h"  /* block_geom_face_hits() */
 #include "score_logic.h" /* score_block_hit_points() */
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* =========================================================================
  * Internal block entry — replaces legacy struct aBlock
@@ -57,6 +60,19 @@ typedef struct
     int ball_dx, ball_dy;
 } block_entry_t;
 
+/* One pending block timer: the cell's earliest movement/morph deadline. */
+typedef struct
+{
+    int deadline; /* Frame at which the cell is next due */
+    int cell;     /* row * MAX_COL + col */
+} block_timer_t;
+
+/* Heap capacity.  Stale entries accumulate between pops; when the heap
+ * fills it is rebuilt from the grid, which needs at most one per cell. */
+#define BLOCK_TIMER_CAP (4 * MAX_ROW * MAX_COL)
+
+_Static_assert(MAX_COL <= 16, "per-row cell masks must fit in uint16_t");
+
 /* =========================================================================
  * Opaque context
  * ========================================================================= */
@@ -64,16 +80,45 @@ typedef struct
 struct block_system
 {
     block_entry_t blocks[MAX_ROW][MAX_COL];
-    block_system_info_t info[MAX_BLOCKS];
     int blocks_exploding;
+
+    /* Derived from blocks[] by track_cell/untrack_cell on every change to a
+     * cell's occupied flag or type, so the per-tick queries need no scan. */
+    uint16_t occupied_rows[MAX_ROW]; /* Bit c set iff blocks[r][c].occupied */
+    uint16_t animated_rows[MAX_ROW]; /* Bit c set iff occupied by a spinning type */
+    int required_count;              /* Occupied cells of a required type */
+
+    /* Min-heap of movement/morph deadlines (ADR-084).  An entry is live
+     * only while it matches the cell's current deadline; anything else
+     * is dropped when popped. */
+    block_timer_t timers[BLOCK_TIMER_CAP];
+    int timer_count;
     int col_width;
     int row_height;
+
+    /* Constant catalog and wiring — everything above is snapshot state */
+    block_system_info_t info[MAX_BLOCKS];
+    block_rand_fn rand_fn;
+    void *rand_user_data;
+
+    /* Render change tracking (ADR-089) — not part of a snapshot */
+    uint16_t dirty_rows[MAX_ROW]; /* Bit c set iff cell (r, c) changed since take_dirty */
+    uint32_t generation;
 };
 
 /* =========================================================================
  * Static helpers
  * ========================================================================= */
 
+static int get_rand(const block_system_t *ctx)
+{
+    if (ctx->rand_fn)
+    {
+        return ctx->rand_fn(ctx->rand_user_data);
+    }
+    return rand();
+}
+
 /*
  * Clear a single block entry to defaults.
  * Mirrors legacy ClearBlock() (blocks.c:2528-2598) minus the XDestroyRegion calls.
@@ -112,6 +157,209 @@ static void clear_entry(block_entry_t *bp, int *blocks_exploding)
     bp->explode_all = 0;
 }
 
+/* Types block_system_advance_animations steps every tick.  ROAMER_BLK is
+ * not one: its eye direction is driven by the randomly scheduled eye timer
+ * in block_system_update_movement, not a deterministic cycle — see
+ * original/blocks.c:1364-1373. */
+static int type_is_animated(int block_type)
+{
+    return block_type == BONUSX2_BLK || block_type == BONUSX4_BLK || block_type == BONUS_BLK ||
+           block_type == DEATH_BLK || block_type == EXTRABALL_BLK;
+}
+
+/*
+ * Add / remove cell (row, col)'s contribution to occupied_rows,
+ * animated_rows and required_count.  Every mutation of a cell's occupied flag or block_type
+ * is bracketed by untrack_cell before and track_cell after.
+ */
+static void track_cell(block_system_t *ctx, int row, int col)
+{
+    const block_entry_t *bp = &ctx->blocks[row][col];
+    if (!bp->occupied)
+    {
+        return;
+    }
+    ctx->occupied_rows[row] = (uint16_t)(ctx->occupied_rows[row] | (1u << col));
+    if (type_is_animated(bp->block_type))
+    {
+        ctx->animated_rows[row] = (uint16_t)(ctx->animated_rows[row] | (1u << col));
+    }
+    if (block_system_type_is_required(bp->block_type))
+    {
+        ctx->required_count++;
+    }
+}
+
+static void untrack_cell(block_system_t *ctx, int row, int col)
+{
+    const block_entry_t *bp = &ctx->blocks[row][col];
+    if (!bp->occupied)
+    {
+        return;
+    }
+    ctx->occupied_rows[row] = (uint16_t)(ctx->occupied_rows[row] & ~(1u << col));
+    ctx->animated_rows[row] = (uint16_t)(ctx->animated_rows[row] & ~(1u << col));
+    if (block_system_type_is_required(bp->block_type))
+    {
+        ctx->required_count--;
+    }
+}
+
+/* =========================================================================
+ * Block timers
+ *
+ * update_movement used to scan every cell every tick to compare
+ * next_frame/last_frame against the frame.  Cells with a movement or
+ * morph timer are instead kept in a min-heap keyed on their earliest
+ * deadline, so a tick only touches the cells that are due.  Every change
+ * to a cell's timers is followed by schedule_cell; superseded entries
+ * are left in place and discarded on pop.
+ * ========================================================================= */
+
+/*
+ * Earliest frame at which update_timed_cell would act on this cell.
+ * Returns 0 if the cell has no movement or morph timer.
+ */
+static int cell_deadline(const block_entry_t *bp, int *deadline)
+{
+    if (!bp->occupied)
+    {
+        return 0;
+    }
+
+    int timed = 0;
+    int d = 0;
+    if (bp->block_type == ROAMER_BLK)
+    {
+        d = (bp->next_frame < bp->last_frame) ? bp->next_frame : bp->last_frame;
+        timed = 1;
+    }
+    if (bp->random || bp->drop)
+    {
+        d = (timed && d < bp->next_frame) ? d : bp->next_frame;
+        timed = 1;
+    }
+    *deadline = d;
+    return timed;
+}
+
+static void timer_sift_up(block_system_t *ctx, int i)
+{
+    block_timer_t t = ctx->timers[i];
+    while (i > 0)
+    {
+        int parent = (i - 1) / 2;
+        if (ctx->timers[parent].deadline <= t.deadline)
+        {
+            break;
+        }
+        ctx->timers[i] = ctx->timers[parent];
+        i = parent;
+    }
+    ctx->timers[i] = t;
+}
+
+static block_timer_t timer_pop(block_system_t *ctx)
+{
+    block_timer_t top = ctx->timers[0];
+    block_timer_t last = ctx->timers[--ctx->timer_count];
+    int n = ctx->timer_count;
+    int i = 0;
+    for (;;)
+    {
+        int child = 2 * i + 1;
+        if (child >= n)
+        {
+            break;
+        }
+        if (child + 1 < n && ctx->timers[child + 1].deadline < ctx->timers[child].deadline)
+        {
+            child++;
+        }
+        if (last.deadline <= ctx->timers[child].deadline)
+        {
+            break;
+        }
+        ctx->timers[i] = ctx->timers[child];
+        i = child;
+    }
+    if (n > 0)
+    {
+        ctx->timers[i] = last;
+    }
+    return top;
+}
+
+static void timer_push(block_system_t *ctx, int deadline, int cell)
+{
+    ctx->timers[ctx->timer_count].deadline = deadline;
+    ctx->timers[ctx->timer_count].cell = cell;
+    timer_sift_up(ctx, ctx->timer_count++);
+}
+
+/* Drop every stale entry: one entry per timed cell, straight from the grid. */
+static void rebuild_timers(block_system_t *ctx)
+{
+    ctx->timer_count = 0;
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        for (int c = 0; c < MAX_COL; c++)
+        {
+            int deadline;
+            if (cell_deadline(&ctx->blocks[r][c], &deadline))
+            {
+                timer_push(ctx, deadline, r * MAX_COL + c);
+            }
+        }
+    }
+}
+
+/* Queue cell (row, col) at its current deadline, if it has one. */
+static void schedule_cell(block_system_t *ctx, int row, int col)
+{
+    int deadline;
+    if (!cell_deadline(&ctx->blocks[row][col], &deadline))
+    {
+        return;
+    }
+    if (ctx->timer_count == BLOCK_TIMER_CAP)
+    {
+        /* Rebuilding already covers this cell at its new deadline. */
+        rebuild_timers(ctx);
+        return;
+    }
+    timer_push(ctx, deadline, row * MAX_COL + col);
+}
+
+/* Record that cell (row, col) no longer looks the way it was last drawn. */
+static void mark_dirty(block_system_t *ctx, int row, int col)
+{
+    ctx->dirty_rows[row] = (uint16_t)(ctx->dirty_rows[row] | (1u << col));
+    ctx->generation++;
+}
+
+/* Set bonus_slide, marking the cell only if the frame actually changes. */
+static void set_bonus_slide(block_system_t *ctx, int row, int col, int slide)
+{
+    block_entry_t *bp = &ctx->blocks[row][col];
+    if (bp->bonus_slide != slide)
+    {
+        bp->bonus_slide = slide;
+        mark_dirty(ctx, row, col);
+    }
+}
+
+/* clear_entry for a grid cell, keeping the derived counts in step. */
+static void clear_cell(block_system_t *ctx, int row, int col)
+{
+    if (ctx->blocks[row][col].occupied)
+    {
+        mark_dirty(ctx, row, col);
+    }
+    untrack_cell(ctx, row, col);
+    clear_entry(&ctx->blocks[row][col], &ctx->blocks_exploding);
+}
+
 /*
  * Populate the block info catalog.
  * Mirrors legacy SetupBlockInfo() (blocks.c:607-760), including the
@@ -376,7 +624,8 @@ static void calculate_geometry(block_system_t *ctx, int row, int col)
  * Lifecycle
  * ========================================================================= */
 
-block_system_t *block_system_create(int col_width, int row_height, block_system_status_t *status)
+block_system_t *block_system_create(int col_width, int row_height, block_rand_fn rand_fn,
+                                    void *rand_user_data, block_system_status_t *status)
 {
     block_system_t *ctx = calloc(1, sizeof(*ctx));
 
@@ -391,6 +640,8 @@ block_system_t *block_system_create(int col_width, int row_height, block_system_
 
     ctx->col_width = col_width;
     ctx->row_height = row_height;
+    ctx->rand_fn = rand_fn;
+    ctx->rand_user_data = rand_user_data;
     ctx->blocks_exploding = 0;
 
     /* Initialize all blocks to cleared state */
@@ -442,7 +693,7 @@ block_system_status_t block_system_add(block_system_t *ctx, int row, int col, in
     }
 
     /* Clear any existing block at this position */
-    clear_entry(&ctx->blocks[row][col], &ctx->blocks_exploding);
+    clear_cell(ctx, row, col);
 
     block_entry_t *bp = &ctx->blocks[row][col];
 
@@ -461,12 +712,12 @@ block_system_status_t block_system_add(block_system_t *ctx, int row, int col, in
     else if (block_type == DROP_BLK)
     {
         bp->drop = 1;
-        bp->next_frame = frame + (rand() % BLOCK_DROP_DELAY) + 200;
+        bp->next_frame = frame + (get_rand(ctx) % BLOCK_DROP_DELAY) + 200;
     }
     else if (block_type == ROAMER_BLK)
     {
-        bp->next_frame = frame + (rand() % BLOCK_ROAM_EYES_DELAY) + 50;
-        bp->last_frame = frame + (rand() % BLOCK_ROAM_DELAY) + 300;
+        bp->next_frame = frame + (get_rand(ctx) % BLOCK_ROAM_EYES_DELAY) + 50;
+        bp->last_frame = frame + (get_rand(ctx) % BLOCK_ROAM_DELAY) + 300;
     }
 
     /* Calculate pixel geometry */
@@ -485,6 +736,9 @@ block_system_status_t block_system_add(block_system_t *ctx, int row, int col, in
         bp->next_frame = frame + BLOCK_DEATH_DELAY2;
     }
 
+    track_cell(ctx, row, col);
+    schedule_cell(ctx, row, col);
+    mark_dirty(ctx, row, col);
     return BLOCK_SYS_OK;
 }
 
@@ -499,7 +753,7 @@ block_system_status_t block_system_clear(block_system_t *ctx, int row, int col)
         return BLOCK_SYS_ERR_OUT_OF_BOUNDS;
     }
 
-    clear_entry(&ctx->blocks[row][col], &ctx->blocks_exploding);
+    clear_cell(ctx, row, col);
     return BLOCK_SYS_OK;
 }
 
@@ -514,9 +768,10 @@ block_system_status_t block_system_clear_all(block_system_t *ctx)
     {
         for (int c = 0; c < MAX_COL; c++)
         {
-            clear_entry(&ctx->blocks[r][c], &ctx->blocks_exploding);
+            clear_cell(ctx, r, c);
         }
     }
+    ctx->timer_count = 0;
     return BLOCK_SYS_OK;
 }
 
@@ -551,6 +806,7 @@ block_system_status_t block_system_explode(block_system_t *ctx, int row, int col
     bp->explode_start_frame = frame;
     bp->explode_next_frame = frame;
     bp->explode_slide = 1;
+    mark_dirty(ctx, row, col);
 
     return BLOCK_SYS_OK;
 }
@@ -595,6 +851,7 @@ void block_system_update_explosions(block_system_t *ctx, int frame, block_system
              * advance slide and next_frame, then check for finalize. */
             bp->explode_slide++;
             bp->explode_next_frame += BLOCK_EXPLODE_DELAY;
+            mark_dirty(ctx, r, c);
 
             if (bp->explode_slide > 4)
             {
@@ -602,7 +859,7 @@ void block_system_update_explosions(block_system_t *ctx, int frame, block_system
                 int saved_block_type = bp->block_type;
                 int saved_hit_points = bp->hit_points;
 
-                clear_entry(bp, &ctx->blocks_exploding);
+                clear_cell(ctx, r, c);
 
                 /* Callback fires AFTER clear_entry: cell is unoccupied. */
                 if (cb != NULL)
@@ -619,14 +876,15 @@ void block_system_advance_animations(block_system_t *ctx, int frame)
     if (ctx == NULL)
         return;
 
+    /* Only the spinning types change here; animated_rows lists them. */
     for (int r = 0; r < MAX_ROW; r++)
     {
-        for (int c = 0; c < MAX_COL; c++)
+        for (int c = 0; ctx->animated_rows[r] >> c; c++)
         {
-            block_entry_t *bp = &ctx->blocks[r][c];
-            if (!bp->occupied)
+            if (!((ctx->animated_rows[r] >> c) & 1u))
                 continue;
 
+            block_entry_t *bp = &ctx->blocks[r][c];
             switch (bp->block_type)
             {
                 case BONUSX2_BLK:
@@ -635,7 +893,7 @@ void block_system_advance_animations(block_system_t *ctx, int frame)
                     /* 4-frame spin, descending 3->0 per BLOCK_BONUS_DELAY,
                      * matching original/blocks.c:1188-1218 (HandlePendingBonuses
                      * decrements bonusSlide). */
-                    bp->bonus_slide = 3 - (frame / BLOCK_BONUS_DELAY) % 4;
+                    set_bonus_slide(ctx, r, c, 3 - (frame / BLOCK_BONUS_DELAY) % 4);
                     break;
 
                 case DEATH_BLK:
@@ -655,19 +913,14 @@ void block_system_advance_animations(block_system_t *ctx, int frame)
                     const int hold0 = BLOCK_DEATH_DELAY2 + BLOCK_DEATH_DELAY1;
                     const int period = BLOCK_DEATH_DELAY2 + 4 * BLOCK_DEATH_DELAY1;
                     const int t = frame % period;
-                    bp->bonus_slide = (t < hold0) ? 0 : 1 + (t - hold0) / BLOCK_DEATH_DELAY1;
+                    set_bonus_slide(ctx, r, c,
+                                    (t < hold0) ? 0 : 1 + (t - hold0) / BLOCK_DEATH_DELAY1);
                     break;
                 }
 
                 case EXTRABALL_BLK:
                     /* 2-frame flip */
-                    bp->bonus_slide = (frame / BLOCK_EXTRABALL_DELAY) % 2;
-                    break;
-
-                case ROAMER_BLK:
-                    /* Eye direction is driven by the rand()-scheduled eye
-                     * timer in block_system_update_movement, not a
-                     * deterministic cycle — see original/blocks.c:1364-1373. */
+                    set_bonus_slide(ctx, r, c, (frame / BLOCK_EXTRABALL_DELAY) % 2);
                     break;
 
                 default:
@@ -687,9 +940,9 @@ void block_system_advance_animations(block_system_t *ctx, int frame)
  * Case 7 returns YELLOW_BLK rather than NONE_BLK because blankBlock is
  * False here — a morphing "?" block never turns into empty space.
  */
-static int get_random_block_type(void)
+static int get_random_block_type(const block_system_t *ctx)
 {
-    switch (rand() % 8)
+    switch (get_rand(ctx) % 8)
     {
         case 0:
             return RED_BLK;
@@ -765,293 +1018,198 @@ static int check_adjacent(const block_system_t *ctx, int row, int col,
     return 1;
 }
 
-void block_system_update_movement(block_system_t *ctx, int frame,
-                                  const block_system_ball_pos_t *balls, int nballs)
+/*
+ * One due cell of block_system_update_movement: the ROAMER_BLK eye and
+ * move timers, the RANDOM_BLK morph and the DROP_BLK drop, each fired
+ * when its deadline has passed.
+ */
+static void update_timed_cell(block_system_t *ctx, int r, int c, int frame,
+                              const block_system_ball_pos_t *balls, int nballs)
 {
-    if (ctx == NULL)
+    block_entry_t *bp = &ctx->blocks[r][c];
+    if (!bp->occupied)
     {
         return;
     }
-    if (balls == NULL)
+
+    /* An exploding block is mid-finalize: skip movement/morph/drop
+     * so clear_entry() can't decrement blocks_exploding out from
+     * under the explosion path (see :83) or vacate the cell before
+     * its scoring callback fires. Matches check_adjacent (:701) and
+     * the placement guards (:1036, :1110). original/blocks.c:1834
+     * keeps such a block occupied+exploding with its type intact. */
+    if (bp->exploding)
     {
-        nballs = 0;
+        return;
     }
 
-    for (int r = 0; r < MAX_ROW; r++)
+    /* ROAMER_BLK: eye timer + move timer (original/blocks.c:1364-1421).
+     * The original checks `== frame`; this port checks `frame >=`
+     * instead. Level-loaded blocks are added with a hardcoded
+     * frame=0 (game_callbacks.c, game_init.c), so a timer scheduled
+     * as next_frame = 0 + delay can land before the first update
+     * tick actually runs under the modern fixed-timestep loop,
+     * and an exact `==` match would then never fire. `>=` fires
+     * once on the first tick the schedule is due and each handler
+     * reschedules to a future frame before returning, so there is
+     * no double-fire. Matches the ball timer convention in
+     * ball_system.c (e.g. lines 405, 845, 890). */
+    if (bp->block_type == ROAMER_BLK)
     {
-        for (int c = 0; c < MAX_COL; c++)
+        if (frame >= bp->next_frame)
         {
-            block_entry_t *bp = &ctx->blocks[r][c];
-            if (!bp->occupied)
-            {
-                continue;
-            }
-
-            /* An exploding block is mid-finalize: skip movement/morph/drop
-             * so clear_entry() can't decrement blocks_exploding out from
-             * under the explosion path (see :83) or vacate the cell before
-             * its scoring callback fires. Matches check_adjacent (:701) and
-             * the placement guards (:1036, :1110). original/blocks.c:1834
-             * keeps such a block occupied+exploding with its type intact. */
-            if (bp->exploding)
+            /* Eye timer fires: reroll gaze direction. */
+            bp->next_frame = frame + (get_rand(ctx) % BLOCK_ROAM_EYES_DELAY) + 50;
+            set_bonus_slide(ctx, r, c, get_rand(ctx) % 5);
+        }
+        else if (frame >= bp->last_frame)
+        {
+            /* Move timer fires: every firing attempts a real move
+             * (jck ruling, round 2 — original/blocks.c:1377 maps
+             * bonus_slide 1-4 to L/R/U/D via `d = bonus_slide + 1`
+             * and silently falls through to a stale r1/c1 from a
+             * prior block's move on the 0/5 cases, but it always
+             * *attempts* a move on every firing; a naive 0=neutral
+             * port would skip ~1/5 of firings and understate
+             * roamer wander frequency ~20% on roamer-dense
+             * levels).  This port maps all 5 rolled eye values to
+             * a direction so every firing attempts a move,
+             * without reproducing the stale-variable bug: 0=L,
+             * 1=R, 2=U, 3=D match the original's 0-3 exactly, and
+             * 4 wraps to L (deterministic substitute for the
+             * original's stale fallthrough on d==5). The eye
+             * sprite roll (bonus_slide) stays a plain get_rand() % 5
+             * above — eye/move alignment is cosmetic and not
+             * required to match. */
+            int dr = 0;
+            int dc = 0;
+            switch (bp->bonus_slide)
             {
-                continue;
+                case 0:
+                    dc = -1;
+                    break;
+                case 1:
+                    dc = 1;
+                    break;
+                case 2:
+                    dr = -1;
+                    break;
+                case 3:
+                    dr = 1;
+                    break;
+                case 4:
+                    dc = -1;
+                    break;
+                default:
+                    break;
             }
 
-            /* ROAMER_BLK: eye timer + move timer (original/blocks.c:1364-1421).
-             * The original checks `== frame`; this port checks `frame >=`
-             * instead. Level-loaded blocks are added with a hardcoded
-             * frame=0 (game_callbacks.c, game_init.c), so a timer scheduled
-             * as next_frame = 0 + delay can land before the first update
-             * tick actually runs under the modern fixed-timestep loop,
-             * and an exact `==` match would then never fire. `>=` fires
-             * once on the first tick the schedule is due and each handler
-             * reschedules to a future frame before returning, so there is
-             * no double-fire. Matches the ball timer convention in
-             * ball_system.c (e.g. lines 405, 845, 890). */
-            if (bp->block_type == ROAMER_BLK)
+            if (check_adjacent(ctx, r + dr, c + dc, balls, nballs))
             {
-                if (frame >= bp->next_frame)
-                {
-                    /* Eye timer fires: reroll gaze direction. */
-                    bp->next_frame = frame + (rand() % BLOCK_ROAM_EYES_DELAY) + 50;
-                    bp->bonus_slide = rand() % 5;
-                }
-                else if (frame >= bp->last_frame)
-                {
-                    /* Move timer fires: every firing attempts a real move
-                     * (jck ruling, round 2 — original/blocks.c:1377 maps
-                     * bonus_slide 1-4 to L/R/U/D via `d = bonus_slide + 1`
-                     * and silently falls through to a stale r1/c1 from a
-                     * prior block's move on the 0/5 cases, but it always
-                     * *attempts* a move on every firing; a naive 0=neutral
-                     * port would skip ~1/5 of firings and understate
-                     * roamer wander frequency ~20% on roamer-dense
-                     * levels).  This port maps all 5 rolled eye values to
-                     * a direction so every firing attempts a move,
-                     * without reproducing the stale-variable bug: 0=L,
-                     * 1=R, 2=U, 3=D match the original's 0-3 exactly, and
-                     * 4 wraps to L (deterministic substitute for the
-                     * original's stale fallthrough on d==5). The eye
-                     * sprite roll (bonus_slide) stays a plain rand() % 5
-                     * above — eye/move alignment is cosmetic and not
-                     * required to match. */
-                    int dr = 0;
-                    int dc = 0;
-                    switch (bp->bonus_slide)
-                    {
-                        case 0:
-                            dc = -1;
-                            break;
-                        case 1:
-                            dc = 1;
-                            break;
-                        case 2:
-                            dr = -1;
-                            break;
-                        case 3:
-                            dr = 1;
-                            break;
-                        case 4:
-                            dc = -1;
-                            break;
-                        default:
-                            break;
-                    }
-
-                    if (check_adjacent(ctx, r + dr, c + dc, balls, nballs))
-                    {
-                        block_system_add(ctx, r + dr, c + dc, ROAMER_BLK, 0, frame);
-                        clear_entry(bp, &ctx->blocks_exploding);
-                    }
-                    else
-                    {
-                        bp->last_frame = frame + (rand() % BLOCK_ROAM_DELAY) + 300;
-                    }
-                }
+                block_system_add(ctx, r + dr, c + dc, ROAMER_BLK, 0, frame);
+                clear_cell(ctx, r, c);
             }
-
-            /* RANDOM_BLK morph: cycles the block's visible type on a
-             * timer, independent of block_type (original/blocks.c:1427-
-             * 1445).  The random flag is NEVER cleared here — it keeps
-             * re-morphing forever until the block is destroyed, matching
-             * the original which only ever touches blockType/bonusSlide/
-             * nextFrame inside this branch. Checks `frame >=` rather than
-             * the original's `==`: level-loaded blocks start at hardcoded
-             * frame=0, so next_frame=1 can be skipped by an exact match
-             * once the update loop's frame counter is already past 1 —
-             * see the ROAMER_BLK comment above for the full rationale. */
-            if (bp->random && frame >= bp->next_frame)
+            else
             {
-                bp->block_type = get_random_block_type();
-                bp->bonus_slide = 0;
-                bp->next_frame = frame + (rand() % BLOCK_RANDOM_DELAY) + 300;
-            }
-
-            /* DROP_BLK: single drop timer (original/blocks.c:1447-1474).
-             * `frame >=` rather than the original's `==` — same hardcoded
-             * frame=0 level-load hazard as ROAMER_BLK/RANDOM_BLK above. */
-            if (bp->drop && frame >= bp->next_frame)
-            {
-                if (check_adjacent(ctx, r + 1, c, balls, nballs))
-                {
-                    block_system_add(ctx, r + 1, c, DROP_BLK, 0, frame);
-                    clear_entry(bp, &ctx->blocks_exploding);
-                }
-                else
-                {
-                    bp->next_frame = frame + BLOCK_DROP_DELAY;
-                }
+                bp->last_frame = frame + (get_rand(ctx) % BLOCK_ROAM_DELAY) + 300;
             }
         }
     }
-}
-
-/* =========================================================================
- * Collision detection — bbox-vs-triangle classifier
- *
- * Port of CheckRegions() in original/ball.c:1338-1457.  Tests the ball's
- * full BALL_WIDTH x BALL_HEIGHT bounding rectangle against each of the
- * block's four triangular face regions and returns a bitmask of overlapping
- * faces, with unconditional-on-neighbour-occupancy adjacency suppression.
- * ========================================================================= */
-
-/*
- * Point-in-triangle test using the sign-of-cross-product (barycentric)
- * method.  Returns nonzero iff (px, py) is inside or on the boundary of
- * the triangle (v0, v1, v2).  Vertex winding is irrelevant; the test
- * accepts both orientations by allowing the signs to be all <= 0 OR all
- * >= 0.
- */
-static int point_in_triangle(int px, int py, int v0x, int v0y, int v1x, int v1y, int v2x, int v2y)
-{
-    long d1 = (long)(px - v1x) * (v0y - v1y) - (long)(v0x - v1x) * (py - v1y);
-    long d2 = (long)(px - v2x) * (v1y - v2y) - (long)(v1x - v2x) * (py - v2y);
-    long d3 = (long)(px - v0x) * (v2y - v0y) - (long)(v2x - v0x) * (py - v0y);
-    int has_neg = (d1 < 0) || (d2 < 0) || (d3 < 0);
-    int has_pos = (d1 > 0) || (d2 > 0) || (d3 > 0);
-    return !(has_neg && has_pos);
-}
-
-/*
- * Segment (p1q1) intersects segment (p2q2) on the open or closed
- * interval.  Sufficient for ball-vs-triangle screen-pixel collision.
- */
-static int seg_orient(int px, int py, int qx, int qy, int rx, int ry)
-{
-    long v = (long)(qy - py) * (rx - qx) - (long)(qx - px) * (ry - qy);
-    if (v > 0)
-        return 1;
-    if (v < 0)
-        return -1;
-    return 0;
-}
-
-static int on_segment(int px, int py, int qx, int qy, int rx, int ry)
-{
-    int min_x = px < rx ? px : rx;
-    int max_x = px > rx ? px : rx;
-    int min_y = py < ry ? py : ry;
-    int max_y = py > ry ? py : ry;
-    return qx >= min_x && qx <= max_x && qy >= min_y && qy <= max_y;
-}
-
-static int segments_intersect(int p1x, int p1y, int q1x, int q1y, int p2x, int p2y, int q2x,
-                              int q2y)
-{
-    int o1 = seg_orient(p1x, p1y, q1x, q1y, p2x, p2y);
-    int o2 = seg_orient(p1x, p1y, q1x, q1y, q2x, q2y);
-    int o3 = seg_orient(p2x, p2y, q2x, q2y, p1x, p1y);
-    int o4 = seg_orient(p2x, p2y, q2x, q2y, q1x, q1y);
-
-    if (o1 != o2 && o3 != o4)
-        return 1;
 
-    /* Collinear-overlap edge cases. */
-    if (o1 == 0 && on_segment(p1x, p1y, p2x, p2y, q1x, q1y))
-        return 1;
-    if (o2 == 0 && on_segment(p1x, p1y, q2x, q2y, q1x, q1y))
-        return 1;
-    if (o3 == 0 && on_segment(p2x, p2y, p1x, p1y, q2x, q2y))
-        return 1;
-    if (o4 == 0 && on_segment(p2x, p2y, q1x, q1y, q2x, q2y))
-        return 1;
+    /* RANDOM_BLK morph: cycles the block's visible type on a
+     * timer, independent of block_type (original/blocks.c:1427-
+     * 1445).  The random flag is NEVER cleared here — it keeps
+     * re-morphing forever until the block is destroyed, matching
+     * the original which only ever touches blockType/bonusSlide/
+     * nextFrame inside this branch. Checks `frame >=` rather than
+     * the original's `==`: level-loaded blocks start at hardcoded
+     * frame=0, so next_frame=1 can be skipped by an exact match
+     * once the update loop's frame counter is already past 1 —
+     * see the ROAMER_BLK comment above for the full rationale. */
+    if (bp->random && frame >= bp->next_frame)
+    {
+        /* BULLET_BLK is not required: a morph can change the count. */
+        untrack_cell(ctx, r, c);
+        bp->block_type = get_random_block_type(ctx);
+        track_cell(ctx, r, c);
+        bp->bonus_slide = 0;
+        mark_dirty(ctx, r, c);
+        bp->next_frame = frame + (get_rand(ctx) % BLOCK_RANDOM_DELAY) + 300;
+    }
 
-    return 0;
+    /* DROP_BLK: single drop timer (original/blocks.c:1447-1474).
+     * `frame >=` rather than the original's `==` — same hardcoded
+     * frame=0 level-load hazard as ROAMER_BLK/RANDOM_BLK above. */
+    if (bp->drop && frame >= bp->next_frame)
+    {
+        if (check_adjacent(ctx, r + 1, c, balls, nballs))
+        {
+            block_system_add(ctx, r + 1, c, DROP_BLK, 0, frame);
+            clear_cell(ctx, r, c);
+        }
+        else
+        {
+            bp->next_frame = frame + BLOCK_DROP_DELAY;
+        }
+    }
 }
 
-/*
- * Does an axis-aligned rectangle overlap a triangle?
- *
- * The 3-condition test:
- *   (1) any triangle vertex is inside the rectangle, OR
- *   (2) any rectangle corner is inside the triangle, OR
- *   (3) any triangle edge crosses any rectangle edge.
- *
- * Equivalent to XRectInRegion(triangle_region, rect) != RectangleOut.
- *
- * Rectangle convention: half-open [rx, rx+rw) x [ry, ry+rh).  This
- * matches the half-open block geometry used elsewhere in this module
- * (e.g. ball_right > bp->x as the overlap predicate, with `right`
- * being one past the last covered pixel).  The inclusive variant
- * would over-report by one pixel on edge-only contact.
- *
- * For the corner-in-triangle and edge-vs-edge sub-tests we use the
- * inclusive corner coordinate (rx + rw - 1, ry + rh - 1) so a
- * geometrically-touching rectangle is treated as overlap iff at least
- * one of its interior pixels lies in the triangle.
- */
-static int rect_overlaps_triangle(int rx, int ry, int rw, int rh, int v0x, int v0y, int v1x,
-                                  int v1y, int v2x, int v2y)
+void block_system_update_movement(block_system_t *ctx, int frame,
+                                  const block_system_ball_pos_t *balls, int nballs)
 {
-    int rx2 = rx + rw - 1; /* inclusive right edge */
-    int ry2 = ry + rh - 1; /* inclusive bottom edge */
-
-    /* (1) Triangle vertices inside rect (half-open interpretation). */
-    if ((v0x >= rx && v0x < rx + rw && v0y >= ry && v0y < ry + rh) ||
-        (v1x >= rx && v1x < rx + rw && v1y >= ry && v1y < ry + rh) ||
-        (v2x >= rx && v2x < rx + rw && v2y >= ry && v2y < ry + rh))
+    if (ctx == NULL)
     {
-        return 1;
+        return;
+    }
+    if (balls == NULL)
+    {
+        nballs = 0;
     }
 
-    /* (2) Rect corners (inclusive) inside triangle. */
-    if (point_in_triangle(rx, ry, v0x, v0y, v1x, v1y, v2x, v2y) ||
-        point_in_triangle(rx2, ry, v0x, v0y, v1x, v1y, v2x, v2y) ||
-        point_in_triangle(rx, ry2, v0x, v0y, v1x, v1y, v2x, v2y) ||
-        point_in_triangle(rx2, ry2, v0x, v0y, v1x, v1y, v2x, v2y))
+    /* Collect every cell whose deadline has passed, then fire them in
+     * row-major order — the order the full-grid scan visited them in, so
+     * RNG draws and move conflicts resolve exactly as before.  Cells a
+     * move fills this tick get fresh timers at least 50 frames out, so
+     * they can never be due in the tick that created them. */
+    uint16_t due[MAX_ROW] = {0};
+    while (ctx->timer_count > 0 && ctx->timers[0].deadline <= frame)
     {
-        return 1;
+        block_timer_t t = timer_pop(ctx);
+        int deadline;
+        int r = t.cell / MAX_COL;
+        int c = t.cell % MAX_COL;
+        /* Stale entries (cell cleared, retimed or rescheduled) are dropped. */
+        if (cell_deadline(&ctx->blocks[r][c], &deadline) && deadline == t.deadline)
+        {
+            due[r] = (uint16_t)(due[r] | (1u << c));
+        }
     }
 
-    /* (3) Triangle edges vs rect edges (inclusive corner coords). */
-    const int rect_edges[4][4] = {
-        {rx, ry, rx2, ry},   /* top */
-        {rx2, ry, rx2, ry2}, /* right */
-        {rx2, ry2, rx, ry2}, /* bottom */
-        {rx, ry2, rx, ry},   /* left */
-    };
-    const int tri_edges[3][4] = {
-        {v0x, v0y, v1x, v1y},
-        {v1x, v1y, v2x, v2y},
-        {v2x, v2y, v0x, v0y},
-    };
-    for (int i = 0; i < 3; i++)
-    {
-        for (int j = 0; j < 4; j++)
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        for (int c = 0; due[r] != 0 && c < MAX_COL; c++)
         {
-            if (segments_intersect(tri_edges[i][0], tri_edges[i][1], tri_edges[i][2],
-                                   tri_edges[i][3], rect_edges[j][0], rect_edges[j][1],
-                                   rect_edges[j][2], rect_edges[j][3]))
+            if ((due[r] >> c) & 1u)
             {
-                return 1;
+                due[r] = (uint16_t)(due[r] & ~(1u << c));
+                update_timed_cell(ctx, r, c, frame, balls, nballs);
+                schedule_cell(ctx, r, c);
             }
         }
     }
-
-    return 0;
 }
 
+/* =========================================================================
+ * Collision detection — bbox-vs-triangle classifier
+ *
+ * Port of CheckRegions() in original/ball.c:1338-1457.  Tests the ball's
+ * full BALL_WIDTH x BALL_HEIGHT bounding rectangle against each of the
+ * block's four triangular face regions and returns a bitmask of overlapping
+ * faces, with unconditional-on-neighbour-occupancy adjacency suppression.
+ * The face test itself is block_geom_face_hits (block_geom.c), shared with
+ * the cell-window path below.
+ * ========================================================================= */
+
 int block_system_check_region_bbox(int row, int col, int bx, int by, int bdx, void *ud)
 {
     (void)bdx;
@@ -1072,31 +1230,7 @@ int block_system_check_region_bbox(int row, int col, int bx, int by, int bdx, vo
         return BLOCK_REGION_NONE;
     }
 
-    /* Ball bounding box.  Mirrors the (x - BALL_WC, y - BALL_HC, BALL_WIDTH,
-     * BALL_HEIGHT) rect that original/ball.c:1387 passes to XRectInRegion. */
-    int rx = bx - BALL_WC;
-    int ry = by - BALL_HC;
-    int rw = BALL_WIDTH;
-    int rh = BALL_HEIGHT;
-
-    /* Triangle vertices.  Each face's triangle is one quadrant of the block,
-     * cut by the two diagonals.  Vertices match
-     * original/blocks.c:2215-2265. */
-    int bx0 = bp->x;
-    int by0 = bp->y;
-    int bx1 = bp->x + bp->width;
-    int by1 = bp->y + bp->height;
-    int cx = bp->x + bp->width / 2;
-    int cy = bp->y + bp->height / 2;
-
-    /* TOP triangle: (bx0, by0), (bx1, by0), (cx, cy) */
-    int hit_top = rect_overlaps_triangle(rx, ry, rw, rh, bx0, by0, bx1, by0, cx, cy);
-    /* BOTTOM triangle: (bx0, by1), (bx1, by1), (cx, cy) */
-    int hit_bottom = rect_overlaps_triangle(rx, ry, rw, rh, bx0, by1, bx1, by1, cx, cy);
-    /* LEFT triangle: (bx0, by0), (bx0, by1), (cx, cy) */
-    int hit_left = rect_overlaps_triangle(rx, ry, rw, rh, bx0, by0, bx0, by1, cx, cy);
-    /* RIGHT triangle: (bx1, by0), (bx1, by1), (cx, cy) */
-    int hit_right = rect_overlaps_triangle(rx, ry, rw, rh, bx1, by0, bx1, by1, cx, cy);
+    int hits = block_geom_face_hits(bx, by, bp->x, bp->y, bp->width, bp->height);
 
     /* Adjacency suppression — unconditional on neighbour occupancy,
      * matching original/ball.c:1390-1452 (a region is set ONLY if the
@@ -1106,19 +1240,20 @@ int block_system_check_region_bbox(int row, int col, int bx, int by, int bdx, vo
      * neighbour AND BOTTOM still fires from the bbox dip into the
      * block's bottom triangle. */
     int region = BLOCK_REGION_NONE;
-    if (hit_top && (row == 0 || !ctx->blocks[row - 1][col].occupied))
+    if ((hits & BLOCK_REGION_TOP) && (row == 0 || !ctx->blocks[row - 1][col].occupied))
     {
         region |= BLOCK_REGION_TOP;
     }
-    if (hit_bottom && (row == MAX_ROW - 1 || !ctx->blocks[row + 1][col].occupied))
+    if ((hits & BLOCK_REGION_BOTTOM) &&
+        (row == MAX_ROW - 1 || !ctx->blocks[row + 1][col].occupied))
     {
         region |= BLOCK_REGION_BOTTOM;
     }
-    if (hit_left && (col == 0 || !ctx->blocks[row][col - 1].occupied))
+    if ((hits & BLOCK_REGION_LEFT) && (col == 0 || !ctx->blocks[row][col - 1].occupied))
     {
         region |= BLOCK_REGION_LEFT;
     }
-    if (hit_right && (col == MAX_COL - 1 || !ctx->blocks[row][col + 1].occupied))
+    if ((hits & BLOCK_REGION_RIGHT) && (col == MAX_COL - 1 || !ctx->blocks[row][col + 1].occupied))
     {
         region |= BLOCK_REGION_RIGHT;
     }
@@ -1126,6 +1261,50 @@ int block_system_check_region_bbox(int row, int col, int bx, int by, int bdx, vo
     return region;
 }
 
+/* cppcheck-suppress constParameterPointer ; signature must match ball_system.h callback */
+int block_system_get_window(int row, int col, block_window_t *out, void *ud)
+{
+    const block_system_t *ctx = (const block_system_t *)ud;
+
+    if (ctx == NULL || out == NULL)
+    {
+        return 0;
+    }
+
+    out->row = row;
+    out->col = col;
+    out->occupied = 0;
+    out->solid = 0;
+
+    int i = 0;
+    for (int r = row - BLOCK_WINDOW_RADIUS; r <= row + BLOCK_WINDOW_RADIUS; r++)
+    {
+        for (int c = col - BLOCK_WINDOW_RADIUS; c <= col + BLOCK_WINDOW_RADIUS; c++, i++)
+        {
+            if (r < 0 || r >= MAX_ROW || c < 0 || c >= MAX_COL)
+            {
+                continue;
+            }
+            const block_entry_t *bp = &ctx->blocks[r][c];
+            if (!bp->occupied)
+            {
+                continue;
+            }
+            out->occupied |= 1u << i;
+            if (bp->exploding)
+            {
+                continue;
+            }
+            out->solid |= 1u << i;
+            out->rect[i].x = (int16_t)bp->x;
+            out->rect[i].y = (int16_t)bp->y;
+            out->rect[i].w = (int16_t)bp->width;
+            out->rect[i].h = (int16_t)bp->height;
+        }
+    }
+    return 1;
+}
+
 /* cppcheck-suppress constParameterPointer ; signature must match ball_system.h callback */
 int block_system_cell_available(int row, int col, void *ud)
 {
@@ -1140,8 +1319,8 @@ int block_system_cell_available(int row, int col, void *ud)
         return 0;
     }
 
-    const block_entry_t *bp = &ctx->blocks[row][col];
-    return !bp->occupied && !bp->exploding;
+    /* Exploding cells are still occupied until finalize clears them. */
+    return !((ctx->occupied_rows[row] >> col) & 1u);
 }
 
 /* =========================================================================
@@ -1154,7 +1333,7 @@ int block_system_is_occupied(const block_system_t *ctx, int row, int col)
     {
         return 0;
     }
-    return ctx->blocks[row][col].occupied;
+    return (ctx->occupied_rows[row] >> col) & 1u;
 }
 
 int block_system_get_type(const block_system_t *ctx, int row, int col)
@@ -1246,14 +1425,10 @@ int block_system_still_active(const block_system_t *ctx)
         return 0;
     }
 
-    for (int r = 0; r < MAX_ROW; r++)
+    /* Exploding required blocks stay occupied, so they are still counted. */
+    if (ctx->required_count > 0)
     {
-        for (int c = 0; c < MAX_COL; c++)
-        {
-            const block_entry_t *bp = &ctx->blocks[r][c];
-            if (bp->occupied && block_system_type_is_required(bp->block_type))
-                return 1;
-        }
+        return 1;
     }
 
     /* Explosions still pending — level not complete. */
@@ -1267,7 +1442,7 @@ int block_system_still_active(const block_system_t *ctx)
 
 int block_system_explode_all_required(block_system_t *ctx, int frame)
 {
-    if (ctx == NULL)
+    if (ctx == NULL || ctx->required_count == 0)
     {
         return 0;
     }
@@ -1302,6 +1477,15 @@ int block_system_get_exploding_count(const block_system_t *ctx)
     return ctx->blocks_exploding;
 }
 
+int block_system_get_required_count(const block_system_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    return ctx->required_count;
+}
+
 block_system_status_t block_system_get_render_info(const block_system_t *ctx, int row, int col,
                                                    block_system_render_info_t *info)
 {
@@ -1390,7 +1574,10 @@ int block_system_decrement_gun_hit(block_system_t *ctx, int row, int col)
     if (is_multi_hit_special(block_type))
     {
         if (bp->counter_slide > 0)
+        {
             bp->counter_slide--;
+            mark_dirty(ctx, row, col);
+        }
         if (bp->counter_slide > 0)
             return 1; /* Still has hits remaining — bullet absorbed */
         /* counterSlide reached zero — fall through to clear */
@@ -1417,6 +1604,7 @@ int block_system_ball_hit_counter(block_system_t *ctx, int row, int col)
         return 0;
 
     bp->counter_slide--;
+    mark_dirty(ctx, row, col);
     return 1;
 }
 
@@ -1433,6 +1621,7 @@ int block_system_check_black_hit(block_system_t *ctx, int row, int col, int fram
         return 0;
 
     bp->next_frame = frame + 30;
+    schedule_cell(ctx, row, col);
     return 1;
 }
 
@@ -1458,6 +1647,7 @@ void block_system_set_black_next_frame(block_system_t *ctx, int row, int col, in
         return;
 
     bp->next_frame = next_frame;
+    schedule_cell(ctx, row, col);
 }
 
 int block_system_get_random(const block_system_t *ctx, int row, int col)
@@ -1482,6 +1672,7 @@ void block_system_set_random(block_system_t *ctx, int row, int col, int random)
         return;
 
     bp->random = random ? 1 : 0;
+    schedule_cell(ctx, row, col);
 }
 
 int block_system_get_last_frame(const block_system_t *ctx, int row, int col)
@@ -1498,6 +1689,78 @@ void block_system_set_last_frame(block_system_t *ctx, int row, int col, int last
         return;
 
     ctx->blocks[row][col].last_frame = last_frame;
+    schedule_cell(ctx, row, col);
+}
+
+/* =========================================================================
+ * Change tracking
+ * ========================================================================= */
+
+uint32_t block_system_get_generation(const block_system_t *ctx)
+{
+    return ctx != NULL ? ctx->generation : 0;
+}
+
+int block_system_take_dirty(block_system_t *ctx, uint16_t rows[MAX_ROW])
+{
+    int count = 0;
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        rows[r] = ctx != NULL ? ctx->dirty_rows[r] : 0;
+        for (unsigned int bits = rows[r]; bits != 0; bits &= bits - 1)
+        {
+            count++;
+        }
+    }
+    if (ctx != NULL)
+    {
+        memset(ctx->dirty_rows, 0, sizeof(ctx->dirty_rows));
+    }
+    return count;
+}
+
+void block_system_mark_all_dirty(block_system_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        ctx->dirty_rows[r] = (uint16_t)((1u << MAX_COL) - 1u);
+    }
+    ctx->generation++;
+}
+
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct block_system, copied as bytes. */
+#define BLOCK_SNAPSHOT_SIZE offsetof(struct block_system, info)
+
+size_t block_system_snapshot_size(void)
+{
+    return BLOCK_SNAPSHOT_SIZE;
+}
+
+void block_system_snapshot_save(const block_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, BLOCK_SNAPSHOT_SIZE);
+}
+
+void block_system_snapshot_load(block_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, BLOCK_SNAPSHOT_SIZE);
+    block_system_mark_all_dirty(ctx);
 }
 
 /* =========================================================================
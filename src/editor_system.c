@@ -81,12 +81,12 @@ struct editor_system
  * Helpers
  * ========================================================================= */
 
-static void play_sound(const editor_system_t *ctx, const char *name, int volume)
+static void play_sound(const editor_system_t *ctx, sound_id_t sound, int volume)
 {
     if (ctx->no_sound)
         return;
     if (ctx->cb.on_sound != NULL)
-        ctx->cb.on_sound(name, volume, ctx->user_data);
+        ctx->cb.on_sound(sound, volume, ctx->user_data);
 }
 
 static void show_message(const editor_system_t *ctx, const char *msg, int sticky)
@@ -266,7 +266,7 @@ void editor_system_update(editor_system_t *ctx, int frame)
             break;
 
         case EDITOR_STATE_FINISH:
-            play_sound(ctx, "evillaugh", 50);
+            play_sound(ctx, SOUND_EVILLAUGH, 50);
             if (ctx->cb.on_finish != NULL)
                 ctx->cb.on_finish(ctx->user_data);
             break;
@@ -408,7 +408,7 @@ editor_draw_action_t editor_system_mouse_button(editor_system_t *ctx, int x, int
                 ctx->old_col = col;
                 ctx->old_row = row;
                 ctx->modified = 1;
-                play_sound(ctx, "bonus", 20);
+                play_sound(ctx, SOUND_BONUS, 20);
                 break;
             }
 
@@ -418,7 +418,7 @@ editor_draw_action_t editor_system_mouse_button(editor_system_t *ctx, int x, int
                 ctx->old_col = col;
                 ctx->old_row = row;
                 ctx->modified = 1;
-                play_sound(ctx, "bonus", 20);
+                play_sound(ctx, SOUND_BONUS, 20);
                 break;
 
             case 3: /* Right button: inspect (no-op in pure logic) */
@@ -471,7 +471,7 @@ void editor_system_mouse_motion(editor_system_t *ctx, int x, int y)
                 ctx->old_col = col;
                 ctx->old_row = row;
                 ctx->modified = 1;
-                play_sound(ctx, "bonus", 20);
+                play_sound(ctx, SOUND_BONUS, 20);
             }
             break;
 
@@ -482,7 +482,7 @@ void editor_system_mouse_motion(editor_system_t *ctx, int x, int y)
                 ctx->old_col = col;
                 ctx->old_row = row;
                 ctx->modified = 1;
-                play_sound(ctx, "bonus", 20);
+                play_sound(ctx, SOUND_BONUS, 20);
             }
             break;
 
@@ -504,7 +504,7 @@ void editor_system_flip_horizontal(editor_system_t *ctx)
     if (ctx == NULL || ctx->cb.query_cell == NULL)
         return;
 
-    play_sound(ctx, "wzzz", 50);
+    play_sound(ctx, SOUND_WZZZ, 50);
     normalize_random_blocks(ctx);
 
     for (int c = 0; c < EDITOR_MAX_COL_EDIT / 2; c++)
@@ -556,7 +556,7 @@ void editor_system_flip_vertical(editor_system_t *ctx)
     if (ctx == NULL || ctx->cb.query_cell == NULL)
         return;
 
-    play_sound(ctx, "wzzz2", 50);
+    play_sound(ctx, SOUND_WZZZ2, 50);
     normalize_random_blocks(ctx);
 
     for (int r = 0; r < EDITOR_MAX_ROW_EDIT / 2; r++)
@@ -609,7 +609,7 @@ void editor_system_scroll_horizontal(editor_system_t *ctx)
     if (ctx == NULL || ctx->cb.query_cell == NULL)
         return;
 
-    play_sound(ctx, "sticky", 50);
+    play_sound(ctx, SOUND_STICKY, 50);
     normalize_random_blocks(ctx);
 
     /* Save leftmost column (col 0) — it will be overwritten first */
@@ -672,7 +672,7 @@ void editor_system_scroll_vertical(editor_system_t *ctx)
     if (ctx == NULL || ctx->cb.query_cell == NULL)
         return;
 
-    play_sound(ctx, "sticky", 50);
+    play_sound(ctx, SOUND_STICKY, 50);
     normalize_random_blocks(ctx);
 
     /* Save topmost row (row 0) — it will be overwritten first */
@@ -10,7 +10,9 @@
 
 #include "eyedude_system.h"
 
+#include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* =========================================================================
  * Internal structure
@@ -27,6 +29,7 @@ struct eyedude_system
     int inc;        /* Movement increment per step (+5 or -5) */
     int turn;       /* 1 = will turn at midpoint */
 
+    /* Wiring — everything above is snapshot state (see Snapshots) */
     eyedude_system_callbacks_t callbacks;
     void *user_data;
     eyedude_rand_fn rand_fn;
@@ -40,16 +43,16 @@ static int get_rand(const eyedude_system_t *ctx)
 {
     if (ctx->rand_fn)
     {
-        return ctx->rand_fn();
+        return ctx->rand_fn(ctx->user_data);
     }
     return rand();
 }
 
-static void fire_sound(const eyedude_system_t *ctx, const char *name, int volume)
+static void fire_sound(const eyedude_system_t *ctx, sound_id_t sound, int volume)
 {
     if (ctx->callbacks.on_sound)
     {
-        ctx->callbacks.on_sound(name, volume, ctx->user_data);
+        ctx->callbacks.on_sound(sound, volume, ctx->user_data);
     }
 }
 
@@ -184,7 +187,7 @@ static void do_reset(eyedude_system_t *ctx, int play_w)
     ctx->oldy = ctx->y;
 
     ctx->state = EYEDUDE_STATE_WALK;
-    fire_sound(ctx, "hithere", 100);
+    fire_sound(ctx, SOUND_HITHERE, 100);
 }
 
 static void do_walk(eyedude_system_t *ctx, int frame, int play_w)
@@ -257,7 +260,7 @@ static void do_die(eyedude_system_t *ctx)
         ctx->callbacks.on_score(EYEDUDE_HIT_BONUS, ctx->user_data);
     }
 
-    fire_sound(ctx, "supbons", 80);
+    fire_sound(ctx, SOUND_SUPBONS, 80);
 }
 
 /* =========================================================================
@@ -358,3 +361,33 @@ eyedude_render_info_t eyedude_system_get_render_info(const eyedude_system_t *ctx
 
     return info;
 }
+
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct eyedude_system, copied as bytes. */
+#define EYEDUDE_SNAPSHOT_SIZE offsetof(struct eyedude_system, callbacks)
+
+size_t eyedude_system_snapshot_size(void)
+{
+    return EYEDUDE_SNAPSHOT_SIZE;
+}
+
+void eyedude_system_snapshot_save(const eyedude_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, EYEDUDE_SNAPSHOT_SIZE);
+}
+
+void eyedude_system_snapshot_load(eyedude_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, EYEDUDE_SNAPSHOT_SIZE);
+}
@@ -33,6 +33,8 @@
 #include "paddle_system.h"
 #include "paths.h"
 #include "presents_system.h"
+#include "rng.h"
+#include "rules_logic.h"
 #include "savegame_system.h"
 #include "score_logic.h"
 #include "score_system.h"
@@ -40,6 +42,7 @@
 #include "sdl2_loop.h"
 #include "sdl2_state.h"
 #include "sfx_system.h"
+#include "sound_catalog.h"
 #include "special_system.h"
 
 /* =========================================================================
@@ -69,16 +72,16 @@ sdl2_state_mode_t game_callbacks_attract_next(sdl2_state_mode_t current)
     return SDL2ST_NONE;
 }
 
-/* Block-hit sound: delegates the type→(name, volume) mapping to the pure
- * block_sound module (testable without an audio context).  Silent for
- * types that map to NULL (intermediate hits, sentinels, gaps).  Per-call
+/* Block-hit sound: delegates the type→(sound ID, volume) mapping to the
+ * pure block_sound module (testable without an audio context).  Silent for
+ * types that map to SOUND_NONE (intermediate hits, sentinels, gaps).  Per-call
  * volume matches the original's playSoundFile(name, volume) per
  * docs/audits/2026-06-28-audio-volume-modulation.md. */
 static void play_block_hit_sound(sdl2_audio_t *audio, int block_type)
 {
     block_sound_t s = block_sound_lookup(block_type);
-    if (audio && s.name)
-        sdl2_audio_play_at_percent(audio, s.name, s.volume);
+    if (audio && s.id != SOUND_NONE)
+        sdl2_audio_play_id(audio, s.id, s.volume);
 }
 
 /* =========================================================================
@@ -99,122 +102,25 @@ static int ball_cb_check_region(int row, int col, int bx, int by, int bdx, void
 }
 
 /*
- * Block hit handler: process the hit, award points, clear the block.
- *
- * Returns nonzero if ball should NOT bounce (e.g., DEATH_BLK kills ball,
- * HYPERSPACE_BLK teleports — these absorb the hit).
+ * Block window fetch: hands ball_system the cells around a ray-march
+ * step in one call, so its collision probes classify hits locally
+ * instead of calling ball_cb_check_region once per probe.
  */
-static block_hit_result_t ball_cb_on_block_hit(int row, int col, int ball_index, void *ud)
+static int ball_cb_get_window(int row, int col, block_window_t *out, void *ud)
 {
     game_ctx_t *ctx = ud;
+    return block_system_get_window(row, col, out, ctx->block);
+}
 
-    int block_type = block_system_get_type(ctx->block, row, col);
-    if (block_type == NONE_BLK)
-        return BLOCK_HIT_BOUNCE;
-
-    int frame = (int)sdl2_state_frame(ctx->state);
-    int killer = special_system_is_active(ctx->special, SPECIAL_KILLER);
-
-    switch (block_type)
-    {
-        case DEATH_BLK:
-            /* Match original/ball.c:847-861 ordering: kill ball first,
-             * then arm explosion and play sound (the original plays the
-             * sound inside DrawBlock(KILL_BLK) which is called AFTER
-             * ClearBallNow). */
-            {
-                ball_system_env_t benv = game_callbacks_ball_env(ctx);
-                ball_system_change_mode(ctx->ball, &benv, ball_index, BALL_POP);
-            }
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, DEATH_BLK);
-            return BLOCK_HIT_ABSORB;
-
-        case BOMB_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, BOMB_BLK);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case REVERSE_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, REVERSE_BLK);
-            paddle_system_toggle_reverse(ctx->paddle);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case MULTIBALL_BLK:
-        {
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, MULTIBALL_BLK);
-            ball_system_env_t env = game_callbacks_ball_env(ctx);
-            ball_system_split(ctx->ball, &env);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-        }
-
-        case STICKY_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, STICKY_BLK);
-            special_system_set(ctx->special, SPECIAL_STICKY, 1);
-            paddle_system_set_sticky(ctx->paddle, 1);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case PAD_SHRINK_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, PAD_SHRINK_BLK);
-            paddle_system_change_size(ctx->paddle, 1);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case PAD_EXPAND_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, PAD_EXPAND_BLK);
-            paddle_system_change_size(ctx->paddle, 0);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case MGUN_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, MGUN_BLK);
-            special_system_set(ctx->special, SPECIAL_FAST_GUN, 1);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case WALLOFF_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, WALLOFF_BLK);
-            special_system_set(ctx->special, SPECIAL_NO_WALLS, 1);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case EXTRABALL_BLK:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, EXTRABALL_BLK);
-            ctx->lives_left++;
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-
-        case COUNTER_BLK:
-            if (killer || block_system_ball_hit_counter(ctx->block, row, col) <= 0)
-            {
-                (void)block_system_explode(ctx->block, row, col, frame);
-                play_block_hit_sound(ctx->audio, COUNTER_BLK);
-                return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-            }
-            return BLOCK_HIT_BOUNCE;
-
-        case BLACK_BLK:
-        {
-            int survives = block_system_check_black_hit(ctx->block, row, col, frame);
-            if (survives > 0)
-                return BLOCK_HIT_BOUNCE;
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, BLACK_BLK);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-        }
-
-        case HYPERSPACE_BLK:
-            play_block_hit_sound(ctx->audio, HYPERSPACE_BLK);
-            return BLOCK_HIT_TELEPORT;
-
-        default:
-            (void)block_system_explode(ctx->block, row, col, frame);
-            play_block_hit_sound(ctx->audio, block_type);
-            return killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
-    }
+/*
+ * Block hit handler: process the hit (rules_logic), play the block's
+ * sound.  Score is awarded at finalize.
+ */
+static block_hit_result_t ball_cb_on_block_hit(int row, int col, int ball_index, void *ud)
+{
+    game_ctx_t *ctx = ud;
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    return rules_logic_block_hit(&rules, row, col, ball_index, (int)sdl2_state_frame(ctx->state));
 }
 
 /*
@@ -228,85 +134,9 @@ static block_hit_result_t ball_cb_on_block_hit(int row, int col, int ball_index,
 void game_callbacks_on_block_finalize(int row, int col, int block_type, int hit_points, void *ud)
 {
     game_ctx_t *ctx = ud;
-    int frame = (int)sdl2_state_frame(ctx->state);
-
-    /* Score deferred from hit time (original/blocks.c:1547). */
-    if (hit_points > 0)
-    {
-        score_system_env_t senv = {
-            .x2_active = special_system_is_active(ctx->special, SPECIAL_X2_BONUS),
-            .x4_active = special_system_is_active(ctx->special, SPECIAL_X4_BONUS),
-        };
-        score_system_add(ctx->score, (unsigned long)hit_points, &senv);
-    }
-
-    switch (block_type)
-    {
-        case BOMB_BLK:
-            /* 8-neighbor chain reaction (original/blocks.c:1559-1566).
-             * Return value intentionally discarded — overlapping chains
-             * may try to re-arm an already-exploding neighbor and the
-             * silent skip matches original/blocks.c:1825. */
-            for (int dr = -1; dr <= 1; dr++)
-            {
-                for (int dc = -1; dc <= 1; dc++)
-                {
-                    if (dr == 0 && dc == 0)
-                        continue;
-                    (void)block_system_explode(ctx->block, row + dr, col + dc,
-                                               frame + BLOCK_EXPLODE_DELAY);
-                }
-            }
-            /* Screen shake — matches original/blocks.c:1571-1572 SFX_SHAKE. */
-            if (ctx->sfx)
-                sfx_system_set_mode(ctx->sfx, SFX_MODE_SHAKE);
-            break;
-
-        case BONUSX2_BLK:
-            /* x2 explicitly disables x4 (original/blocks.c:1619). */
-            special_system_set(ctx->special, SPECIAL_X2_BONUS, 1);
-            special_system_set(ctx->special, SPECIAL_X4_BONUS, 0);
-            break;
-
-        case BONUSX4_BLK:
-            /* x4 explicitly disables x2 (original/blocks.c:1628). */
-            special_system_set(ctx->special, SPECIAL_X4_BONUS, 1);
-            special_system_set(ctx->special, SPECIAL_X2_BONUS, 0);
-            break;
-
-        case TIMER_BLK:
-            /* +20 seconds (original/blocks.c:1576, BLOCK_EXTRA_TIME=20). */
-            if (ctx->time_remaining < 1000000)
-                ctx->time_remaining += BLOCK_EXTRA_TIME;
-            break;
-
-        case BULLET_BLK:
-            /* +4 ammo (original/blocks.c:1584-1585).  Matches the gun-hit
-             * pattern at gun_cb_on_block_hit line 317-319. */
-            if (!gun_system_get_unlimited(ctx->gun))
-            {
-                for (int i = 0; i < BLOCK_NUMBER_OF_BULLETS_NEW_LEVEL; i++)
-                    gun_system_add_ammo(ctx->gun);
-            }
-            break;
-
-        case MAXAMMO_BLK:
-            /* Unlimited bullets (original/blocks.c:1590-1591). */
-            gun_system_set_unlimited(ctx->gun, 1);
-            gun_system_set_ammo(ctx->gun, GUN_MAX_AMMO + 1);
-            break;
-
-        case BONUS_BLK:
-            /* Bonus counter — killer mode at exactly 10
-             * (original/blocks.c:1607). */
-            ctx->bonus_count++;
-            if (ctx->bonus_count == 10)
-                special_system_set(ctx->special, SPECIAL_KILLER, 1);
-            break;
-
-        default:
-            break;
-    }
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    rules_logic_block_finalize(&rules, row, col, block_type, hit_points,
+                               (int)sdl2_state_frame(ctx->state));
 }
 
 /*
@@ -321,11 +151,11 @@ static int ball_cb_cell_available(int row, int col, void *ud)
 /*
  * Sound playback: delegates to sdl2_audio.
  */
-static void ball_cb_on_sound(const char *name, int volume, void *ud)
+static void ball_cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
     game_ctx_t *ctx = ud;
     if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, name, volume);
+        sdl2_audio_play_id(ctx->audio, sound, volume);
 }
 
 /*
@@ -365,7 +195,7 @@ static void ball_cb_on_event(ball_system_event_t event, int ball_index, void *ud
 
         case BALL_EVT_PADDLE_HIT:
             if (ctx->audio)
-                sdl2_audio_play_at_percent(ctx->audio, "paddle", 50);
+                sdl2_audio_play_id(ctx->audio, SOUND_PADDLE, 50);
             break;
 
         default:
@@ -381,69 +211,23 @@ static void ball_cb_on_event(ball_system_event_t event, int ball_index, void *ud
  * Gun system callbacks
  * ========================================================================= */
 
-/* Check if bullet at (bx, by) hits a block. Narrows to 3x3 neighborhood. */
+/* Check if bullet at (bx, by) hits a block. */
 static int gun_cb_check_block_hit(int bx, int by, int *out_row, int *out_col, void *ud)
 {
-    const game_ctx_t *ctx = ud;
-
-    int center_col = bx / GAME_COL_WIDTH;
-    int center_row = by / GAME_ROW_HEIGHT;
-    int r0 = (center_row > 0) ? center_row - 1 : 0;
-    int r1 = (center_row < MAX_ROW - 1) ? center_row + 1 : MAX_ROW - 1;
-    int c0 = (center_col > 0) ? center_col - 1 : 0;
-    int c1 = (center_col < MAX_COL - 1) ? center_col + 1 : MAX_COL - 1;
-
-    for (int row = r0; row <= r1; row++)
-    {
-        for (int col = c0; col <= c1; col++)
-        {
-            if (!block_system_is_occupied(ctx->block, row, col))
-                continue;
-
-            block_system_render_info_t info;
-            if (block_system_get_render_info(ctx->block, row, col, &info) != BLOCK_SYS_OK)
-                continue;
-
-            if (bx >= info.x && bx < info.x + info.width && by >= info.y &&
-                by < info.y + info.height)
-            {
-                *out_row = row;
-                *out_col = col;
-                return 1;
-            }
-        }
-    }
-    return 0;
+    game_ctx_t *ctx = ud;
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    return rules_logic_bullet_block_at(&rules, bx, by, out_row, out_col);
 }
 
-/* Handle bullet-block hit: decrement/absorb per block type, award points. */
+/* Handle bullet-block hit (rules_logic); pickup-feedback messages fire
+ * at hit time for immediate player feedback. */
 static void gun_cb_on_block_hit(int row, int col, void *ud)
 {
     game_ctx_t *ctx = ud;
-    int block_type = block_system_get_type(ctx->block, row, col);
-    if (block_type == NONE_BLK)
-        return;
-
-    /* Delegate decrement / absorb logic to block_system —
-     * original/gun.c:318-350.  Returns 1 if bullet absorbed (block still
-     * occupied), 0 if the block would be destroyed by this hit. */
-    int absorbed = block_system_decrement_gun_hit(ctx->block, row, col);
-    if (absorbed)
-        return;
-
-    /* Block destroyed by this bullet — arm the explosion lifecycle so
-     * finalize-time effects (BULLET +4 ammo, MAXAMMO unlimited, score,
-     * BOMB chain, etc.) fire via game_callbacks_on_block_finalize at
-     * the end of the explosion animation.  This matches original
-     * blocks.c:1547-1637 where every block dies through
-     * ExplodeBlocksPending regardless of whether the killing hit was
-     * a bullet or a ball.  Pickup-feedback messages still fire at hit
-     * time below for immediate player feedback. */
+    rules_logic_t rules = game_callbacks_rules(ctx);
     int frame = (int)sdl2_state_frame(ctx->state);
-    (void)block_system_explode(ctx->block, row, col, frame);
-    play_block_hit_sound(ctx->audio, block_type);
 
-    switch (block_type)
+    switch (rules_logic_bullet_block_hit(&rules, row, col, frame))
     {
         case BULLET_BLK:
             message_system_set(ctx->message, "More ammunition, cool!", 1, frame);
@@ -458,24 +242,12 @@ static void gun_cb_on_block_hit(int row, int col, void *ud)
     }
 }
 
-/* Check if bullet hits any active ball (AABB overlap) */
+/* Check if bullet hits any active ball */
 static int gun_cb_check_ball_hit(int bx, int by, void *ud)
 {
-    const game_ctx_t *ctx = ud;
-    for (int i = 0; i < MAX_BALLS; i++)
-    {
-        ball_system_render_info_t info;
-        if (ball_system_get_render_info(ctx->ball, i, &info) != BALL_SYS_OK)
-            continue;
-        if (!info.active || info.state != BALL_ACTIVE)
-            continue;
-        /* Simple distance check */
-        int dx = bx - info.x;
-        int dy = by - info.y;
-        if (dx * dx + dy * dy < 15 * 15)
-            return i;
-    }
-    return -1;
+    game_ctx_t *ctx = ud;
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    return rules_logic_bullet_ball_at(&rules, bx, by);
 }
 
 /* Bullet hit ball: kill the ball — original/gun.c:284 ClearBallNow. */
@@ -488,20 +260,14 @@ static void gun_cb_on_ball_hit(int ball_index, void *ud)
     ball_system_change_mode(ctx->ball, &env, ball_index, BALL_POP);
 }
 
-/* Bullet half-dimensions for the eyedude collision check.  The bullet
- * sprite is 7x10 (original) / 7x16 (modern PNG with alpha padding); we
- * use 4x5 half-extents for a slightly forgiving AABB. */
-#define EYEDUDE_BULLET_HW 4
-#define EYEDUDE_BULLET_HH 5
-
 /* Check if a bullet at (bx, by) hits the eyedude — AABB overlap when
  * the eyedude is in WALK state.  Reuses eyedude_system_check_collision
  * which already enforces the state guard. */
 static int gun_cb_check_eyedude_hit(int bx, int by, void *ud)
 {
     const game_ctx_t *ctx = ud;
-    return eyedude_system_check_collision(ctx->eyedude, bx, by, EYEDUDE_BULLET_HW,
-                                          EYEDUDE_BULLET_HH);
+    return eyedude_system_check_collision(ctx->eyedude, bx, by, RULES_EYEDUDE_BULLET_HW,
+                                          RULES_EYEDUDE_BULLET_HH);
 }
 
 /* Bullet hit on eyedude: switch to DIE state.  The next
@@ -515,11 +281,11 @@ static void gun_cb_on_eyedude_hit(void *ud)
     eyedude_system_set_state(ctx->eyedude, EYEDUDE_STATE_DIE);
 }
 
-static void gun_cb_on_sound(const char *name, int volume, void *ud)
+static void gun_cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
     game_ctx_t *ctx = ud;
     if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, name, volume);
+        sdl2_audio_play_id(ctx->audio, sound, volume);
 }
 
 static int gun_cb_is_ball_waiting(void *ud)
@@ -536,6 +302,7 @@ ball_system_callbacks_t game_callbacks_ball(void)
 {
     ball_system_callbacks_t cbs = {
         .check_region = ball_cb_check_region,
+        .get_window = ball_cb_get_window,
         .on_block_hit = ball_cb_on_block_hit,
         .cell_available = ball_cb_cell_available,
         .on_sound = ball_cb_on_sound,
@@ -591,6 +358,53 @@ ball_system_env_t game_callbacks_ball_env(const game_ctx_t *ctx)
     return env;
 }
 
+static ball_system_env_t rules_ball_env(void *ud)
+{
+    return game_callbacks_ball_env(ud);
+}
+
+static void rules_block_sound(int block_type, void *ud)
+{
+    const game_ctx_t *ctx = ud;
+    play_block_hit_sound(ctx->audio, block_type);
+}
+
+static void rules_shake(void *ud)
+{
+    const game_ctx_t *ctx = ud;
+    if (ctx->sfx)
+        sfx_system_set_mode(ctx->sfx, SFX_MODE_SHAKE);
+}
+
+rules_logic_t game_callbacks_rules(game_ctx_t *ctx)
+{
+    rules_logic_t rules = {
+        .ball = ctx->ball,
+        .block = ctx->block,
+        .paddle = ctx->paddle,
+        .gun = ctx->gun,
+        .score = ctx->score,
+        .special = ctx->special,
+        .eyedude = ctx->eyedude,
+        .rng = &ctx->rng,
+        .lives_left = &ctx->lives_left,
+        .time_remaining = &ctx->time_remaining,
+        .bonus_count = &ctx->bonus_count,
+        .bonus_block_active = &ctx->bonus_block_active,
+        .next_bonus_frame = &ctx->next_bonus_frame,
+        .bonus_row = &ctx->bonus_row,
+        .bonus_col = &ctx->bonus_col,
+        .bonus_type = &ctx->bonus_type,
+        .col_width = GAME_COL_WIDTH,
+        .row_height = GAME_ROW_HEIGHT,
+        .ball_env = rules_ball_env,
+        .on_block_sound = rules_block_sound,
+        .on_shake = rules_shake,
+        .user_data = ctx,
+    };
+    return rules;
+}
+
 /* =========================================================================
  * Presents system callbacks
  * ========================================================================= */
@@ -663,11 +477,11 @@ static void bonus_cb_on_save_triggered(void *ud)
     (void)savegame_system_autosave((game_ctx_t *)ud);
 }
 
-static void bonus_cb_on_sound(const char *name, int volume, void *ud)
+static void bonus_cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
     game_ctx_t *ctx = ud;
     if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, name, volume);
+        sdl2_audio_play_id(ctx->audio, sound, volume);
 }
 
 static void bonus_cb_on_finished(int next_level, void *ud)
@@ -709,11 +523,10 @@ static void demo_cb_on_load_level(int level_num, void *ud)
     char filename[32];
     snprintf(filename, sizeof(filename), "level%02d.data", file_num);
 
-    char level_path[PATHS_MAX_PATH];
-    if (paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) == PATHS_OK)
+    if (game_rules_level_available(ctx, filename))
     {
         block_system_clear_all(ctx->block);
-        level_system_load_file(ctx->level, level_path);
+        game_rules_load_level(ctx, filename);
     }
 }
 
@@ -783,11 +596,11 @@ static void sfx_cb_on_move_window(int x, int y, void *ud)
     /* Shake offset is applied during rendering via sfx_system_get_shake_pos() */
 }
 
-static void sfx_cb_on_sound(const char *name, int volume, void *ud)
+static void sfx_cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
     game_ctx_t *ctx = ud;
     if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, name, volume);
+        sdl2_audio_play_id(ctx->audio, sound, volume);
 }
 
 sfx_system_callbacks_t game_callbacks_sfx(void)
@@ -805,14 +618,9 @@ sfx_system_callbacks_t game_callbacks_sfx(void)
 
 static int eyedude_cb_is_path_clear(void *ud)
 {
-    const game_ctx_t *ctx = ud;
-    /* Check if top row has blocks */
-    for (int col = 0; col < MAX_COL; col++)
-    {
-        if (block_system_is_occupied(ctx->block, 0, col))
-            return 0;
-    }
-    return 1;
+    game_ctx_t *ctx = ud;
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    return rules_logic_eyedude_path_clear(&rules);
 }
 
 static void eyedude_cb_on_score(unsigned long points, void *ud)
@@ -825,11 +633,11 @@ static void eyedude_cb_on_score(unsigned long points, void *ud)
     score_system_add(ctx->score, points, &senv);
 }
 
-static void eyedude_cb_on_sound(const char *name, int volume, void *ud)
+static void eyedude_cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
     game_ctx_t *ctx = ud;
     if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, name, volume);
+        sdl2_audio_play_id(ctx->audio, sound, volume);
 }
 
 static void eyedude_cb_on_message(const char *msg, void *ud)
@@ -850,6 +658,16 @@ eyedude_system_callbacks_t game_callbacks_eyedude(void)
     return cbs;
 }
 
+/* =========================================================================
+ * Shared random source
+ * ========================================================================= */
+
+int game_callbacks_rand(void *ud)
+{
+    game_ctx_t *ctx = ud;
+    return rng_next(&ctx->rng);
+}
+
 /* =========================================================================
  * Editor system callbacks
  * ========================================================================= */
@@ -886,11 +704,11 @@ static int editor_cb_query_cell(int row, int col, editor_cell_t *cell, void *ud)
     return 1;
 }
 
-static void editor_cb_on_sound(const char *name, int volume, void *ud)
+static void editor_cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
     game_ctx_t *ctx = ud;
     if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, name, volume);
+        sdl2_audio_play_id(ctx->audio, sound, volume);
 }
 
 static void editor_cb_on_message(const char *message, int sticky, void *ud)
@@ -3,7 +3,8 @@
  *
  * game_create() builds the full game_ctx_t in dependency order:
  *   1. CLI + config + paths (no SDL2 needed)
- *   2. SDL2 platform modules (renderer → texture → font → audio → input → cursor)
+ *   2. SDL2 platform modules (decode pool → audio → renderer → texture → font
+ *      → input → cursor), with asset decoding overlapping window creation
  *   3. Pure C state/loop modules
  *   4. Game systems (block → paddle → ball → gun → score → level → etc.)
  *   5. UI sequencers (presents, intro, demo, keys, dialogue, highscore)
@@ -18,17 +19,21 @@
 #include "game_callbacks.h"
 #include "game_modes.h"
 #include "game_render.h"
+#include "game_replay.h"
 #include "game_rules.h"
 
 #include <dirent.h> /* opendir/closedir for asset-dir readability check */
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h> /* mkdir for -capture-dir mode subdirectories */
 #include <time.h>
 
 #include <SDL2/SDL.h>
 
+#include "asset_pack.h"
 #include "ball_system.h"
 #include "block_system.h"
 #include "bonus_system.h"
@@ -46,20 +51,30 @@
 #include "message_system.h"
 #include "paddle_system.h"
 #include "paths.h"
+#include "perf_hud.h"
 #include "presents_system.h"
+#include "rng.h"
 #include "score_system.h"
 #include "sdl2_audio.h"
+#include "sdl2_capture.h"
 #include "sdl2_cli.h"
 #include "sdl2_cursor.h"
+#include "sdl2_decode.h"
 #include "sdl2_font.h"
 #include "sdl2_input.h"
+#include "sdl2_layer.h"
 #include "sdl2_loop.h"
+#include "sdl2_pacer.h"
 #include "sdl2_renderer.h"
 #include "sdl2_state.h"
 #include "sdl2_texture.h"
 #include "sfx_system.h"
+#include "sound_catalog.h"
 #include "special_system.h"
+#include "sprite_catalog.h"
+#include "startup_profile.h"
 #include "sys_priv.h"
+#include "trace.h"
 #include "xboing_paths.h"
 #include "xboing_version.h"
 
@@ -82,9 +97,49 @@ static void on_level_add_block(int row, int col, int block_type, int counter_sli
 
 /* Informational-flag handlers (xboing -help / -version / -setup / -scores). */
 static void print_usage(FILE *out);
-static void print_setup_info(const paths_config_t *cfg);
+static void print_setup_info(const paths_config_t *cfg, const char *asset_pack_path);
 static void print_scores(const paths_config_t *cfg);
 
+/* Microsecond clock for the loop's -turbo budget and the frame pacer. */
+static uint64_t clock_us(void)
+{
+    return (uint64_t)((double)SDL_GetPerformanceCounter() * 1e6 /
+                      (double)SDL_GetPerformanceFrequency());
+}
+
+/* Nanosecond clock for -trace and the performance HUD, split so the
+ * product stays in range. */
+static uint64_t clock_ns(void)
+{
+    uint64_t count = SDL_GetPerformanceCounter();
+    uint64_t freq = SDL_GetPerformanceFrequency();
+    return count / freq * 1000000000U + count % freq * 1000000000U / freq;
+}
+
+/* Voice-stealing classes (ADR-095).  Collision sounds fire many times a
+ * tick in multiball play and are the first to give up a channel; the
+ * end-of-ball and end-of-game stings are never cut off by them.  Every
+ * other sound stays SDL2A_PRIORITY_NORMAL.  Keyed by sound ID, so a
+ * misspelling is a compile error; a missing file was already logged
+ * when the IDs were resolved. */
+static void set_sound_priorities(sdl2_audio_t *audio)
+{
+    static const sound_id_t low[] = {SOUND_BOING, SOUND_BALL2BALL, SOUND_PADDLE,
+                                     SOUND_TOUCH, SOUND_AMMO, SOUND_SHOOT};
+    static const sound_id_t high[] = {SOUND_BALLLOST, SOUND_GAME_OVER, SOUND_APPLAUSE,
+                                      SOUND_YOUAGOD, SOUND_SUPBONS};
+    for (size_t i = 0; i < sizeof(low) / sizeof(low[0]); i++)
+        (void)sdl2_audio_set_priority_id(audio, low[i], SDL2A_PRIORITY_LOW);
+    for (size_t i = 0; i < sizeof(high) / sizeof(high[0]); i++)
+        (void)sdl2_audio_set_priority_id(audio, high[i], SDL2A_PRIORITY_HIGH);
+}
+
+/* Coarse sleep for the frame pacer. */
+static void pacer_sleep_ms(uint32_t ms)
+{
+    SDL_Delay(ms);
+}
+
 /* Return non-zero if path is a directory we can list.  opendir() succeeds
  * iff the path exists, is a directory, and is readable + executable for
  * us — which is exactly the condition the subsequent directory scan
@@ -114,10 +169,30 @@ static void print_usage(FILE *out)
                  "  -nickname <name>    Set high-score nickname\n"
                  "  -debug              Enable debug mode\n"
                  "  -grab               Grab pointer to window\n"
+                 "  -offscreen          Render into memory with no window (tests, CI)\n"
                  "  -load               On startup, autoload the saved game (skips\n"
                  "                      attract cycle); used by visual-capture scripts\n"
                  "  -nosfx              Disable visual special effects (e.g. screen "
                  "shake)\n"
+                 "  -record <file>      Record this session's input for -replay\n"
+                 "  -replay <file>      Play back a recorded session, then continue live\n"
+                 "  -replay-fast        With -replay: skip rendering and pacing, print\n"
+                 "                      a summary and exit when the recording ends\n"
+                 "  -turbo              Run game ticks as fast as possible, drawing\n"
+                 "                      once per frame (fast-forward, soak tests)\n"
+                 "  -noatlas            Load one texture per sprite instead of packing\n"
+                 "                      them onto shared atlas pages\n"
+                 "  -nolayers           Redraw backgrounds and blocks every frame\n"
+                 "                      instead of caching them in render-target textures\n"
+                 "  -nopace             Run frames back to back instead of sleeping\n"
+                 "                      until the next one is due\n"
+                 "  -trace <file>       Profile frame timing; write a Chrome trace on exit\n"
+                 "  -startup-profile    Print how long each startup phase took\n"
+                 "  -asset-pack <file>  Read assets from this pack instead of the\n"
+                 "                      installed xboing.pak\n"
+                 "  -texture-budget <MiB>\n"
+                 "                      Load images on first use and keep at most\n"
+                 "                      this much texture memory (0 = no limit)\n"
                  "\n"
                  "Audio options:\n"
                  "  -sound              Enable sound (default)\n"
@@ -131,7 +206,7 @@ static void print_usage(FILE *out)
                  "  -scores             Show high scores (personal + global)\n");
 }
 
-static void print_setup_info(const paths_config_t *cfg)
+static void print_setup_info(const paths_config_t *cfg, const char *asset_pack_path)
 {
     char buf[PATHS_MAX_PATH];
     printf("xboing %s configuration:\n\n", XBOING_VERSION);
@@ -151,6 +226,10 @@ static void print_setup_info(const paths_config_t *cfg)
         printf("  Levels dir (editor)   = %s\n", buf);
     if (paths_sounds_dir_readable(cfg, buf, sizeof(buf)) == PATHS_OK)
         printf("  Sounds dir            = %s\n", buf);
+    if (asset_pack_path != NULL)
+        printf("  Asset pack            = %s\n", asset_pack_path);
+    else if (paths_install_data_file(cfg, ASSET_PACK_FILENAME, buf, sizeof(buf)) == PATHS_OK)
+        printf("  Asset pack            = %s\n", buf);
     if (paths_score_file_global(cfg, buf, sizeof(buf)) == PATHS_OK)
         printf("  Score file (global)   = %s\n", buf);
     if (paths_score_file_personal(cfg, buf, sizeof(buf)) == PATHS_OK)
@@ -266,6 +345,11 @@ game_ctx_t *game_create(int argc, char *argv[])
         return NULL;
     }
 
+    /* -startup-profile: phases are marked from here to the end of
+     * game_create(). */
+    if (cli.startup_profile)
+        ctx->startup_profile = startup_profile_create(clock_us, NULL);
+
     /* Initialize paths */
     if (paths_init(&ctx->paths) != PATHS_OK)
     {
@@ -277,7 +361,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* Informational flags that depend on resolved paths. */
     if (cli_status == SDL2C_EXIT_SETUP)
     {
-        print_setup_info(&ctx->paths);
+        print_setup_info(&ctx->paths, cli.asset_pack_path);
         free(ctx);
         return NULL;
     }
@@ -322,8 +406,27 @@ game_ctx_t *game_create(int argc, char *argv[])
     ctx->debug_mode = cli.debug;
     ctx->vc_mode = cli.visual_capture_mode;
     ctx->vc_interval = cli.visual_capture_interval;
+    ctx->vc_dir = cli.capture_dir;
     ctx->autoload = cli.autoload;
 
+    /* A save file on disk is outside the recording, so -load would make
+     * the session irreproducible. */
+    if (cli.autoload && (cli.record_path != NULL || cli.replay_path != NULL))
+    {
+        fprintf(stderr, "Error: -load cannot be combined with -record or -replay\n");
+        free(ctx);
+        return NULL;
+    }
+
+    /* -replay: the recording's options override the CLI and config. */
+    if (cli.replay_path != NULL &&
+        !game_replay_open_playback(ctx, cli.replay_path, cli.replay_fast))
+    {
+        game_replay_close(ctx);
+        free(ctx);
+        return NULL;
+    }
+
     /* Load high score tables */
     highscore_io_init_table(&ctx->hs_global);
     highscore_io_init_table(&ctx->hs_personal);
@@ -341,15 +444,116 @@ game_ctx_t *game_create(int argc, char *argv[])
 
     /* ---- Phase 2: SDL2 platform modules --------------------------------- */
 
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_TIMER) != 0)
+    startup_profile_mark(ctx->startup_profile, "config");
+
+    /* -offscreen needs no video driver; audio is then left to sdl2_audio,
+     * which carries on without sound when no device is available. */
+    Uint32 sdl_flags = SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_TIMER;
+    if (cli.offscreen)
+        sdl_flags = SDL_INIT_EVENTS | SDL_INIT_TIMER;
+    if (SDL_Init(sdl_flags) != 0)
     {
         fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
+        startup_profile_destroy(ctx->startup_profile);
         free(ctx);
         return NULL;
     }
+    startup_profile_mark(ctx->startup_profile, "sdl init");
+
+    /* Asset pack (ADR-098): an installed game maps one xboing.pak and
+     * reads every image, sound, font and level from it.  Without one
+     * (a build tree, or XBOING_BUILD_ASSET_PACK=OFF) the loose files
+     * below are used.  An explicit -asset-pack must open. */
+    {
+        char pack_path[PATHS_MAX_PATH];
+        const char *pack_file = cli.asset_pack_path;
+        if (pack_file == NULL && paths_install_data_file(&ctx->paths, ASSET_PACK_FILENAME,
+                                                         pack_path, sizeof(pack_path)) == PATHS_OK)
+            pack_file = pack_path;
+        if (pack_file != NULL)
+        {
+            asset_pack_status_t aps;
+            ctx->assets = asset_pack_open(pack_file, &aps);
+            if (!ctx->assets && cli.asset_pack_path != NULL)
+            {
+                fprintf(stderr, "game_create: cannot open asset pack %s: %s\n", pack_file,
+                        asset_pack_status_string(aps));
+                goto fail;
+            }
+            if (!ctx->assets)
+                fprintf(stderr, "Warning: ignoring asset pack %s: %s (using loose files)\n",
+                        pack_file, asset_pack_status_string(aps));
+        }
+    }
+    bool pack_images = asset_pack_count_prefix(ctx->assets, "images/") > 0;
+    bool lazy_images = cli.texture_budget >= 0;
+    startup_profile_mark(ctx->startup_profile, "pack");
+
+    /* Asset directories.  Resolution order for each (matches paths.c's
+     * level/sound file lookup, freedesktop XDG Base Directory spec):
+     *   1. $XDG_DATA_DIRS/xboing/<kind>  (handles --prefix=/usr,
+     *      /usr/local, etc. transparently — same mechanism Debian
+     *      games and GNOME apps use)
+     *   2. XBOING_INSTALLED_<KIND>_DIR  (compile-time fallback for
+     *      unusual installs not in $XDG_DATA_DIRS)
+     *   3. the cwd-relative default of the module's config */
+    char tex_dir[PATHS_MAX_PATH];
+    const char *images = NULL;
+    if (paths_install_data_dir(&ctx->paths, "images", tex_dir, sizeof(tex_dir)) == PATHS_OK)
+        images = tex_dir;
+    else if (asset_dir_exists(XBOING_INSTALLED_IMAGES_DIR))
+        images = XBOING_INSTALLED_IMAGES_DIR;
+
+    char sound_dir[PATHS_MAX_PATH];
+    const char *sounds = NULL;
+    if (paths_install_data_dir(&ctx->paths, "sounds", sound_dir, sizeof(sound_dir)) == PATHS_OK)
+        sounds = sound_dir;
+    else if (asset_dir_exists(XBOING_INSTALLED_SOUNDS_DIR))
+        sounds = XBOING_INSTALLED_SOUNDS_DIR;
+
+    /* Decode pool (ADR-097): PNGs and WAVs decode on worker threads
+     * while this thread opens the window and loads the fonts; only the
+     * GPU uploads stay here.  Without it everything loads serially. */
+    bool decode_images = false;
+    sdl2_decode_stats_t decode_stats;
+    int decode_threads = 0;
+    {
+        sdl2_decode_config_t dcfg = sdl2_decode_config_defaults();
+        sdl2_decode_status_t ds;
+        ctx->decoder = sdl2_decode_create(&dcfg, &ds);
+        if (!ctx->decoder)
+            fprintf(stderr, "Warning: decode pool creation failed: %s (loading serially)\n",
+                    sdl2_decode_status_string(ds));
+        else if (!pack_images && !lazy_images)
+            decode_images = sdl2_texture_queue_decode(ctx->decoder, images) == SDL2T_OK;
+    }
+
+    /* Audio (optional — game works without sound).  Created before the
+     * window because the device must be open before the workers convert
+     * samples to its format; the cache fills in sdl2_audio_finish_decode()
+     * below. */
+    if (ctx->config.sound)
+    {
+        sdl2_audio_config_t acfg = sdl2_audio_config_defaults();
+        acfg.id_keys = sound_key_table();
+        acfg.id_count = SOUND_COUNT;
+        acfg.decoder = ctx->decoder;
+        acfg.pack = ctx->assets;
+        if (sounds != NULL)
+            acfg.sound_dir = sounds;
+        sdl2_audio_status_t as;
+        ctx->audio = sdl2_audio_create(&acfg, &as);
+        if (!ctx->audio)
+        {
+            fprintf(stderr, "Warning: audio creation failed: %s (continuing without sound)\n",
+                    sdl2_audio_status_string(as));
+        }
+    }
+    startup_profile_mark(ctx->startup_profile, "decode queue");
 
     /* Renderer */
     sdl2_renderer_config_t rcfg = sdl2_renderer_config_defaults();
+    rcfg.offscreen = cli.offscreen;
     ctx->renderer = sdl2_renderer_create(&rcfg);
     if (!ctx->renderer)
     {
@@ -360,24 +564,23 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* -grab: confine the mouse pointer to the window (original/main.c:248
      * grabbed via XGrabPointer with confine_to=window). */
     sdl2_renderer_set_mouse_grab(ctx->renderer, cli.grab);
+    startup_profile_mark(ctx->startup_profile, "window");
 
-    /* Texture cache.  Resolution order (matches paths.c's level/sound
-     * file lookup, freedesktop XDG Base Directory spec):
-     *   1. $XDG_DATA_DIRS/xboing/images  (handles --prefix=/usr,
-     *      /usr/local, etc. transparently — same mechanism Debian
-     *      games and GNOME apps use)
-     *   2. XBOING_INSTALLED_IMAGES_DIR  (compile-time fallback for
-     *      unusual installs not in $XDG_DATA_DIRS)
-     *   3. cwd-relative "assets/images"  (dev mode default in
-     *      sdl2_texture_config_defaults) */
-    char tex_dir[PATHS_MAX_PATH];
+    /* Texture cache: uploads each decoded image as it arrives, or with
+     * -texture-budget each image on first use (ADR-099). */
     {
         sdl2_texture_config_t tcfg = sdl2_texture_config_defaults();
         tcfg.renderer = sdl2_renderer_get(ctx->renderer);
-        if (paths_install_data_dir(&ctx->paths, "images", tex_dir, sizeof(tex_dir)) == PATHS_OK)
-            tcfg.base_dir = tex_dir;
-        else if (asset_dir_exists(XBOING_INSTALLED_IMAGES_DIR))
-            tcfg.base_dir = XBOING_INSTALLED_IMAGES_DIR;
+        if (!cli.atlas)
+            tcfg.atlas_size = 0;
+        if (images != NULL)
+            tcfg.base_dir = images;
+        if (decode_images)
+            tcfg.decoder = ctx->decoder;
+        tcfg.pack = ctx->assets;
+        tcfg.lazy = lazy_images;
+        if (lazy_images)
+            tcfg.vram_budget = (size_t)cli.texture_budget * 1024 * 1024;
         sdl2_texture_status_t ts;
         ctx->texture = sdl2_texture_create(&tcfg, &ts);
         if (!ctx->texture)
@@ -386,13 +589,17 @@ game_ctx_t *game_create(int argc, char *argv[])
                     sdl2_texture_status_string(ts));
             goto fail;
         }
+        /* Draw code looks sprites up by sprite_id_t (ADR-086). */
+        sdl2_texture_bind_ids(ctx->texture, sprite_key_table(), SPRITE_COUNT);
     }
+    startup_profile_mark(ctx->startup_profile, "textures");
 
-    /* Font.  Same XDG-first resolution as texture cache above. */
+    /* Font.  Same XDG-first resolution as the images and sounds above. */
     char font_dir[PATHS_MAX_PATH];
     {
         sdl2_font_config_t fcfg = sdl2_font_config_defaults();
         fcfg.renderer = sdl2_renderer_get(ctx->renderer);
+        fcfg.pack = ctx->assets;
         if (paths_install_data_dir(&ctx->paths, "fonts", font_dir, sizeof(font_dir)) == PATHS_OK)
             fcfg.font_dir = font_dir;
         else if (asset_dir_exists(XBOING_INSTALLED_FONTS_DIR))
@@ -405,30 +612,67 @@ game_ctx_t *game_create(int argc, char *argv[])
             goto fail;
         }
     }
+    startup_profile_mark(ctx->startup_profile, "fonts");
 
-    /* Audio (optional — game works without sound).  Same XDG-first
-     * resolution as the texture and font subsystems. */
-    char sound_dir[PATHS_MAX_PATH];
-    if (ctx->config.sound)
+    /* Cached static layers (optional — without render-target support the
+     * backgrounds are drawn directly each frame). */
+    if (cli.layers)
     {
-        sdl2_audio_config_t acfg = sdl2_audio_config_defaults();
-        if (paths_install_data_dir(&ctx->paths, "sounds", sound_dir, sizeof(sound_dir)) == PATHS_OK)
-            acfg.sound_dir = sound_dir;
-        else if (asset_dir_exists(XBOING_INSTALLED_SOUNDS_DIR))
-            acfg.sound_dir = XBOING_INSTALLED_SOUNDS_DIR;
-        sdl2_audio_status_t as;
-        ctx->audio = sdl2_audio_create(&acfg, &as);
-        if (!ctx->audio)
+        SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
+        sdl2_layer_status_t ls;
+        ctx->backdrop_layer = sdl2_layer_create(sdl, &ls);
+        if (ctx->backdrop_layer)
+            ctx->play_layer = sdl2_layer_create(sdl, &ls);
+        if (ctx->play_layer)
+            ctx->block_layer = sdl2_layer_create(sdl, &ls);
+        if (!ctx->block_layer)
         {
-            fprintf(stderr, "Warning: audio creation failed: %s (continuing without sound)\n",
-                    sdl2_audio_status_string(as));
+            if (ls != SDL2LY_ERR_UNSUPPORTED)
+                fprintf(stderr, "Warning: layer creation failed: %s (drawing directly)\n",
+                        sdl2_layer_status_string(ls));
+            sdl2_layer_destroy(ctx->play_layer);
+            sdl2_layer_destroy(ctx->backdrop_layer);
+            ctx->play_layer = NULL;
+            ctx->backdrop_layer = NULL;
         }
-        else if (ctx->config.max_volume > 0)
+    }
+
+    /* -visual-capture -capture-dir: read-back buffers and the PNG encoder
+     * thread (ADR-093). */
+    if (ctx->vc_dir != NULL && ctx->vc_mode < 0)
+    {
+        fprintf(stderr, "Warning: -capture-dir has no effect without -visual-capture\n");
+    }
+    else if (ctx->vc_dir != NULL)
+    {
+        (void)mkdir(ctx->vc_dir, 0755);
+        sdl2_capture_config_t ccfg = sdl2_capture_config_defaults();
+        sdl2_capture_status_t cs;
+        ctx->capture = sdl2_capture_create(&ccfg, &cs);
+        if (!ctx->capture)
         {
-            sdl2_audio_set_volume_percent(ctx->audio, ctx->config.max_volume);
+            fprintf(stderr, "game_create: frame capture creation failed: %s\n",
+                    sdl2_capture_status_string(cs));
+            goto fail;
         }
     }
 
+    startup_profile_mark(ctx->startup_profile, "layers");
+
+    /* Collect the sounds; the pool has no more work after this. */
+    if (ctx->audio)
+    {
+        sdl2_audio_finish_decode(ctx->audio);
+        set_sound_priorities(ctx->audio);
+        if (ctx->config.max_volume > 0)
+            sdl2_audio_set_volume_percent(ctx->audio, ctx->config.max_volume);
+    }
+    sdl2_decode_get_stats(ctx->decoder, &decode_stats);
+    decode_threads = sdl2_decode_threads(ctx->decoder);
+    sdl2_decode_destroy(ctx->decoder);
+    ctx->decoder = NULL;
+    startup_profile_mark(ctx->startup_profile, "audio");
+
     /* Input */
     {
         sdl2_input_status_t is;
@@ -472,14 +716,69 @@ game_ctx_t *game_create(int argc, char *argv[])
             goto fail;
         }
         sdl2_loop_set_speed(ctx->loop, ctx->config.speed);
+        if (cli.turbo)
+            sdl2_loop_set_turbo(ctx->loop, true, 0, clock_us);
+    }
+
+    {
+        sdl2_pacer_status_t pst;
+        ctx->pacer = sdl2_pacer_create(clock_us, pacer_sleep_ms, &pst);
+        if (!ctx->pacer)
+        {
+            fprintf(stderr, "game_create: frame pacer creation failed: %s\n",
+                    sdl2_pacer_status_string(pst));
+            goto fail;
+        }
+        sdl2_pacer_set_enabled(ctx->pacer, cli.pace);
+
+        /* Pace to the display when its refresh rate is known, else to ticks. */
+        int display = SDL_GetWindowDisplayIndex(sdl2_renderer_get_window(ctx->renderer));
+        SDL_DisplayMode dm;
+        if (display >= 0 && SDL_GetCurrentDisplayMode(display, &dm) == 0)
+            sdl2_pacer_set_refresh_hz(ctx->pacer, dm.refresh_rate);
+    }
+
+    /* -trace: record timing zones from here on; written by game_destroy. */
+    if (cli.trace_path != NULL)
+    {
+#ifndef XBOING_TRACE
+        fprintf(stderr, "Warning: built without XBOING_TRACE; -trace records no zones\n");
+#endif
+        trace_status_t ts = trace_start(clock_ns, 0);
+        if (ts == TRACE_OK)
+            ctx->trace_path = cli.trace_path;
+        else
+            fprintf(stderr, "Warning: -trace: %s\n", trace_status_string(ts));
+    }
+
+    {
+        perf_hud_status_t hst;
+        ctx->perf_hud = perf_hud_create(clock_ns, &hst);
+        if (!ctx->perf_hud)
+        {
+            fprintf(stderr, "game_create: performance HUD creation failed: %s\n",
+                    perf_hud_status_string(hst));
+            goto fail;
+        }
     }
 
     /* ---- Phase 4: Game systems ------------------------------------------ */
 
+    /* Gameplay RNG.  Derived from the caller-seeded rand() stream, so the
+     * caller-seeds contract (game_init.h) still pins the whole game; from
+     * here on the systems draw only from ctx->rng via game_callbacks_rand.
+     * Under -replay the seed comes from the recording instead. */
+    if (!game_replay_playing(ctx))
+        ctx->rng_seed = ((uint64_t)(unsigned)rand() << 31) ^ (uint64_t)(unsigned)rand();
+    rng_seed(&ctx->rng, ctx->rng_seed);
+    if (cli.record_path != NULL && !game_replay_open_record(ctx, cli.record_path))
+        goto fail;
+
     /* Block system */
     {
         block_system_status_t bs;
-        ctx->block = block_system_create(GAME_COL_WIDTH, GAME_ROW_HEIGHT, &bs);
+        ctx->block = block_system_create(GAME_COL_WIDTH, GAME_ROW_HEIGHT, game_callbacks_rand, ctx,
+                                         &bs);
         if (!ctx->block)
         {
             fprintf(stderr, "game_create: block system creation failed\n");
@@ -503,7 +802,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     {
         ball_system_callbacks_t bcb = game_callbacks_ball();
         ball_system_status_t bs;
-        ctx->ball = ball_system_create(&bcb, ctx, &bs);
+        ctx->ball = ball_system_create(&bcb, ctx, game_callbacks_rand, &bs);
         if (!ctx->ball)
         {
             fprintf(stderr, "game_create: ball system creation failed\n");
@@ -572,7 +871,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* SFX system (callbacks wired by game_callbacks.c) */
     {
         sfx_system_callbacks_t scb = game_callbacks_sfx();
-        ctx->sfx = sfx_system_create(&scb, ctx, NULL);
+        ctx->sfx = sfx_system_create(&scb, ctx, game_callbacks_rand);
         if (!ctx->sfx)
         {
             fprintf(stderr, "game_create: sfx system creation failed\n");
@@ -588,7 +887,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* EyeDude system (callbacks wired by game_callbacks.c) */
     {
         eyedude_system_callbacks_t ecb = game_callbacks_eyedude();
-        ctx->eyedude = eyedude_system_create(&ecb, ctx, NULL);
+        ctx->eyedude = eyedude_system_create(&ecb, ctx, game_callbacks_rand);
         if (!ctx->eyedude)
         {
             fprintf(stderr, "game_create: eyedude system creation failed\n");
@@ -636,7 +935,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* Intro (callbacks wired by game_callbacks.c) */
     {
         intro_system_callbacks_t icb = game_callbacks_intro();
-        ctx->intro = intro_system_create(&icb, ctx, NULL);
+        ctx->intro = intro_system_create(&icb, ctx, game_callbacks_rand);
         if (!ctx->intro)
         {
             fprintf(stderr, "game_create: intro system creation failed\n");
@@ -647,7 +946,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* Demo (callbacks wired by game_callbacks.c) */
     {
         demo_system_callbacks_t dcb = game_callbacks_demo();
-        ctx->demo = demo_system_create(&dcb, ctx, NULL);
+        ctx->demo = demo_system_create(&dcb, ctx, game_callbacks_rand);
         if (!ctx->demo)
         {
             fprintf(stderr, "game_create: demo system creation failed\n");
@@ -658,7 +957,7 @@ game_ctx_t *game_create(int argc, char *argv[])
     /* Keys (callbacks wired by game_callbacks.c) */
     {
         keys_system_callbacks_t kcb = game_callbacks_keys();
-        ctx->keys = keys_system_create(&kcb, ctx, NULL);
+        ctx->keys = keys_system_create(&kcb, ctx, game_callbacks_rand);
         if (!ctx->keys)
         {
             fprintf(stderr, "game_create: keys system creation failed\n");
@@ -704,11 +1003,10 @@ game_ctx_t *game_create(int argc, char *argv[])
         char filename[32];
         snprintf(filename, sizeof(filename), "level%02d.data", file_num);
 
-        char level_path[PATHS_MAX_PATH];
-        if (paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) == PATHS_OK)
+        if (game_rules_level_available(ctx, filename))
         {
             block_system_clear_all(ctx->block);
-            level_system_load_file(ctx->level, level_path);
+            game_rules_load_level(ctx, filename);
         }
         else
         {
@@ -732,6 +1030,20 @@ game_ctx_t *game_create(int argc, char *argv[])
         ball_system_reset_start(ctx->ball, &env);
     }
 
+    startup_profile_mark(ctx->startup_profile, "systems");
+    if (ctx->startup_profile != NULL)
+    {
+        startup_profile_report(ctx->startup_profile, stdout);
+        if (decode_threads > 0)
+            printf("startup: decoded %d file(s) (%d failed) on %d thread(s), %.2f ms of work\n",
+                   decode_stats.decoded, decode_stats.failed, decode_threads,
+                   (double)decode_stats.work_us / 1000.0);
+        else
+            printf("startup: assets loaded serially\n");
+        startup_profile_destroy(ctx->startup_profile);
+        ctx->startup_profile = NULL;
+    }
+
     return ctx;
 
 fail:
@@ -762,6 +1074,17 @@ void game_destroy(game_ctx_t *ctx)
     if (!ctx)
         return;
 
+    /* Flush the recording before anything it reads is torn down. */
+    game_replay_close(ctx);
+
+    if (ctx->trace_path != NULL)
+    {
+        trace_status_t ts = trace_write_json(ctx->trace_path);
+        if (ts != TRACE_OK)
+            fprintf(stderr, "xboing: -trace %s: %s\n", ctx->trace_path, trace_status_string(ts));
+        trace_shutdown();
+    }
+
     /* Phase 5: UI sequencers (reverse order) */
     highscore_system_destroy(ctx->highscore_display);
     dialogue_system_destroy(ctx->dialogue);
@@ -785,16 +1108,27 @@ void game_destroy(game_ctx_t *ctx)
     block_system_destroy(ctx->block);
 
     /* Phase 3: State + loop */
+    perf_hud_destroy(ctx->perf_hud);
+    sdl2_pacer_destroy(ctx->pacer);
     sdl2_loop_destroy(ctx->loop);
     sdl2_state_destroy(ctx->state);
 
-    /* Phase 2: SDL2 platform (reverse order) */
+    /* Phase 2: SDL2 platform (reverse order).  A failed startup can leave
+     * the decode pool running; its workers use SDL_image and SDL_mixer,
+     * so it stops first. */
+    sdl2_decode_destroy(ctx->decoder);
+    startup_profile_destroy(ctx->startup_profile);
     sdl2_cursor_destroy(ctx->cursor);
     sdl2_input_destroy(ctx->input);
     sdl2_audio_destroy(ctx->audio);
+    sdl2_capture_destroy(ctx->capture);
+    sdl2_layer_destroy(ctx->block_layer);
+    sdl2_layer_destroy(ctx->play_layer);
+    sdl2_layer_destroy(ctx->backdrop_layer);
     sdl2_font_destroy(ctx->font);
     sdl2_texture_destroy(ctx->texture);
     sdl2_renderer_destroy(ctx->renderer);
+    asset_pack_close(ctx->assets); /* after everything that points into it */
 
     SDL_Quit();
 
@@ -957,21 +1291,28 @@ static const char *vc_edit_name(int s)
     }
 }
 
-static void vc_signal_modern(const char *mode_name, const char *substate, int seq)
+/* Snapshot one sub-state (ADR-093).  Runs between game_render_compose and
+ * game_render_present, so the backbuffer still holds the frame just drawn.
+ * With -capture-dir the frame is read back and queued for the encoder
+ * thread, which writes DIR/<mode>/<substate>-<seq>.png; either way the
+ * snapshot is announced on stdout.  Nothing here waits on the display. */
+static void vc_signal_modern(game_ctx_t *ctx, const char *mode_name, const char *substate,
+                             int seq)
 {
-    /* Pre-signal pause: the SDL_RenderPresent that ran in
-     * game_render_frame queues a frame for the X server.  Under
-     * XWayland+Mutter the actual on-screen update lags by up to
-     * ~50 ms after present, especially on the first frame of a
-     * newly-entered state.  Sleep BEFORE printing the signal so
-     * the script's `import -window` sees the just-rendered frame,
-     * not the previous one. */
-    SDL_Delay(150);
+    if (ctx->capture != NULL)
+    {
+        char path[SDL2CAP_MAX_PATH];
+        snprintf(path, sizeof(path), "%s/%s", ctx->vc_dir, mode_name);
+        (void)mkdir(path, 0755);
+        size_t len = strlen(path);
+        snprintf(path + len, sizeof(path) - len, "/%s-%03d.png", substate, seq);
+        sdl2_capture_status_t cs =
+            sdl2_capture_frame(ctx->capture, sdl2_renderer_get(ctx->renderer), path);
+        if (cs != SDL2CAP_OK)
+            fprintf(stderr, "xboing: capture %s: %s\n", path, sdl2_capture_status_string(cs));
+    }
     printf("XBOING_SNAPSHOT %s/%s/%03d\n", mode_name, substate, seq);
     fflush(stdout);
-    /* Post-signal pause: hold the binary while the script's
-     * ImageMagick `import` runs (typically ~50 ms). */
-    SDL_Delay(200);
 }
 
 static void vc_check(game_ctx_t *ctx, int pre_presents, int pre_credits, int pre_intro,
@@ -993,6 +1334,11 @@ static void vc_check(game_ctx_t *ctx, int pre_presents, int pre_credits, int pre
     {
         if (prev_mode != SDL2ST_NONE && ctx->vc_mode != 99 && ctx->vc_mode == (int)prev_mode)
         {
+            /* Every PNG is on disk before the script hears DONE. */
+            sdl2_capture_flush(ctx->capture);
+            int failed = sdl2_capture_failed(ctx->capture);
+            if (failed > 0)
+                fprintf(stderr, "xboing: %d snapshot(s) could not be written\n", failed);
             printf("XBOING_SNAPSHOT_DONE\n");
             fflush(stdout);
             exit(0);
@@ -1028,7 +1374,7 @@ static void vc_check(game_ctx_t *ctx, int pre_presents, int pre_credits, int pre
             if (cn && cn != cur_subname)
             {
                 seq = 0;
-                vc_signal_modern("presents", cn, seq);
+                vc_signal_modern(ctx, "presents", cn, seq);
                 seq++;
                 cur_subname = cn;
                 next_capture_frame = frame + (unsigned long)ctx->vc_interval;
@@ -1040,7 +1386,7 @@ static void vc_check(game_ctx_t *ctx, int pre_presents, int pre_credits, int pre
             if (cn != cur_subname)
             {
                 seq = 0;
-                vc_signal_modern("presents", cn, seq);
+                vc_signal_modern(ctx, "presents", cn, seq);
                 seq++;
                 cur_subname = cn;
                 next_capture_frame = frame + (unsigned long)ctx->vc_interval;
@@ -1137,7 +1483,7 @@ static void vc_check(game_ctx_t *ctx, int pre_presents, int pre_credits, int pre
     if (pre_sub != post_sub && pre_name && pre_name != cur_subname)
     {
         seq = 0;
-        vc_signal_modern(mode_str, pre_name, seq);
+        vc_signal_modern(ctx, mode_str, pre_name, seq);
         seq++;
         cur_subname = pre_name;
         next_capture_frame = frame + (unsigned long)ctx->vc_interval;
@@ -1150,14 +1496,14 @@ static void vc_check(game_ctx_t *ctx, int pre_presents, int pre_credits, int pre
         if (post_name != cur_subname)
         {
             seq = 0;
-            vc_signal_modern(mode_str, post_name, seq);
+            vc_signal_modern(ctx, mode_str, post_name, seq);
             seq++;
             cur_subname = post_name;
             next_capture_frame = frame + (unsigned long)ctx->vc_interval;
         }
         else if (frame >= next_capture_frame)
         {
-            vc_signal_modern(mode_str, post_name, seq);
+            vc_signal_modern(ctx, mode_str, post_name, seq);
             seq++;
             next_capture_frame = frame + (unsigned long)ctx->vc_interval;
         }
@@ -1176,6 +1522,7 @@ static int vc_pre_edit_state;
 static void stub_tick(void *user_data)
 {
     game_ctx_t *ctx = user_data;
+    TRACE_BEGIN(tick);
 
     vc_pre_presents_state = (int)presents_system_get_state(ctx->presents);
     vc_pre_credits_stage = presents_system_get_credits_stage(ctx->presents);
@@ -1186,7 +1533,10 @@ static void stub_tick(void *user_data)
     vc_pre_bonus_state = (int)bonus_system_get_highest_reached(ctx->bonus);
     vc_pre_edit_state = (int)editor_system_get_state(ctx->editor);
 
+    /* Repeats of a sound within this tick share one voice (ADR-095). */
+    sdl2_audio_begin_tick(ctx->audio);
     sdl2_state_update(ctx->state);
+    TRACE_END(tick);
 }
 
 static void stub_render(double alpha, void *user_data)
@@ -1194,12 +1544,18 @@ static void stub_render(double alpha, void *user_data)
     game_ctx_t *ctx = user_data;
     sdl2_state_mode_t mode = sdl2_state_current(ctx->state);
     ctx->render_alpha = (mode == SDL2ST_PAUSE || mode == SDL2ST_DIALOGUE) ? 0.0 : alpha;
-    game_render_frame(ctx);
+    if (ctx->vc_mode < 0)
+    {
+        game_render_frame(ctx);
+        return;
+    }
 
-    if (ctx->vc_mode >= 0)
-        vc_check(ctx, vc_pre_presents_state, vc_pre_credits_stage, vc_pre_intro_state,
-                 vc_pre_demo_state, vc_pre_keys_state, vc_pre_highscore_state, vc_pre_bonus_state,
-                 vc_pre_edit_state);
+    /* Visual capture snapshots the drawn frame before it is presented. */
+    game_render_compose(ctx);
+    vc_check(ctx, vc_pre_presents_state, vc_pre_credits_stage, vc_pre_intro_state,
+             vc_pre_demo_state, vc_pre_keys_state, vc_pre_highscore_state, vc_pre_bonus_state,
+             vc_pre_edit_state);
+    game_render_present(ctx);
 }
 
 /* =========================================================================
@@ -26,6 +26,7 @@
 #include "message_system.h"
 #include "paddle_system.h"
 #include "paths.h"
+#include "perf_hud.h"
 #include "savegame_system.h"
 #include "score_system.h"
 #include "sdl2_audio.h"
@@ -278,6 +279,11 @@ void game_input_global(game_ctx_t *ctx)
     if (sdl2_input_just_pressed(ctx->input, SDL2I_ICONIFY))
         sdl2_renderer_minimize(ctx->renderer);
 
+    /* F3: performance HUD (ADR-092).  Not in the original; any mode, so
+     * field staff can watch frame times on a cabinet without a profiler. */
+    if (sdl2_input_just_pressed(ctx->input, SDL2I_TOGGLE_HUD))
+        perf_hud_set_visible(ctx->perf_hud, !perf_hud_is_visible(ctx->perf_hud));
+
     /* G: toggle keyboard/mouse control — original/main.c:377-394 */
     if (sdl2_input_just_pressed(ctx->input, SDL2I_TOGGLE_CONTROL))
     {
@@ -21,12 +21,59 @@
 #include "dialogue_system.h"
 #include "game_context.h"
 #include "game_input.h"
+#include "game_replay.h"
+#include "perf_hud.h"
 #include "savegame_system.h"
 #include "sdl2_input.h"
+#include "sdl2_layer.h"
 #include "sdl2_loop.h"
+#include "sdl2_pacer.h"
 #include "sdl2_state.h"
 #include "sys_priv.h"
 
+/*
+ * -replay under -turbo: play recorded frames back to back until the
+ * loop's turbo budget is spent, then draw once.  Every recorded frame
+ * still gets its own input snapshot and exact tick count, so the session
+ * ends the same as at normal speed.  `ticks` belongs to the frame that
+ * game_replay_frame_input has already loaded.
+ */
+static void replay_scrub(game_ctx_t *ctx, int ticks)
+{
+    sdl2_loop_turbo_begin(ctx->loop);
+    for (;;)
+    {
+        game_replay_frame_done(ctx, sdl2_loop_step(ctx->loop, ticks, false));
+        if (!sdl2_loop_turbo_budget_left(ctx->loop))
+            break;
+
+        sdl2_input_begin_frame(ctx->input);
+        ticks = game_replay_frame_input(ctx);
+        if (ticks == GAME_REPLAY_LIVE)
+            break;
+        game_input_global(ctx);
+    }
+    sdl2_loop_step(ctx->loop, 0, true);
+}
+
+/*
+ * True when the next frame will look the same as the last one unless input
+ * arrives: paused, or a dialogue waiting for text.  Neither advances the
+ * frame counter, so nothing animates (ADR-090).
+ */
+static bool frame_is_idle(const game_ctx_t *ctx)
+{
+    switch (sdl2_state_current(ctx->state))
+    {
+        case SDL2ST_PAUSE:
+            return true;
+        case SDL2ST_DIALOGUE:
+            return dialogue_system_get_state(ctx->dialogue) == DIALOGUE_STATE_TEXT;
+        default:
+            return false;
+    }
+}
+
 int main(int argc, char *argv[])
 {
     /* Setgid-games privilege management: save egid, drop to rgid.
@@ -83,10 +130,20 @@ int main(int argc, char *argv[])
     /* --- Event loop ------------------------------------------------------ */
 
     bool running = true;
-    Uint64 last_ticks = SDL_GetTicks64();
+    uint64_t last_us = sdl2_pacer_now(ctx->pacer);
 
     while (running)
     {
+        /* Live frames are paced; -turbo and -replay pace themselves. */
+        bool paced = sdl2_pacer_is_enabled(ctx->pacer) && !sdl2_loop_is_turbo(ctx->loop) &&
+                     !game_replay_playing(ctx);
+
+        /* Nothing moves while idle: block until input (or a timeout, so
+         * the window keeps redrawing) instead of drawing identical frames. */
+        bool idle = paced && frame_is_idle(ctx);
+        if (idle)
+            SDL_WaitEventTimeout(NULL, SDL2P_IDLE_TIMEOUT_MS);
+
         /* Mark start of frame for edge-triggered input */
         sdl2_input_begin_frame(ctx->input);
 
@@ -105,10 +162,23 @@ int main(int argc, char *argv[])
                         running = false;
                     break;
 
+                case SDL_RENDER_TARGETS_RESET:
+                    /* Target textures lost their contents (e.g. D3D after
+                     * a resize); recompose the cached layers (ADR-088). */
+                    sdl2_layer_invalidate(ctx->backdrop_layer);
+                    sdl2_layer_invalidate(ctx->play_layer);
+                    sdl2_layer_invalidate(ctx->block_layer);
+                    break;
+
                 default:
                     break;
             }
 
+            /* During -replay the recording is the only input; live events
+             * would desynchronize it. */
+            if (game_replay_playing(ctx))
+                continue;
+
             /* Route text/key events to dialogue when active — swallow them
              * so global actions (quit, fullscreen) don't fire while typing. */
             if (sdl2_state_current(ctx->state) == SDL2ST_DIALOGUE && ctx->dialogue != NULL)
@@ -116,15 +186,22 @@ int main(int argc, char *argv[])
                 if (event.type == SDL_TEXTINPUT)
                 {
                     for (int ci = 0; event.text.text[ci] != '\0'; ci++)
+                    {
                         dialogue_system_key_input(ctx->dialogue, DIALOGUE_KEY_CHAR,
                                                   event.text.text[ci]);
+                        game_replay_note_dialogue_key(ctx, DIALOGUE_KEY_CHAR,
+                                                      event.text.text[ci]);
+                    }
                     continue;
                 }
                 if (event.type == SDL_KEYDOWN && !event.key.repeat)
                 {
                     dialogue_key_type_t dk;
                     if (dialogue_key_from_sdl(event.key.keysym.sym, &dk))
+                    {
                         dialogue_system_key_input(ctx->dialogue, dk, '\0');
+                        game_replay_note_dialogue_key(ctx, dk, '\0');
+                    }
                     continue;
                 }
             }
@@ -133,17 +210,48 @@ int main(int argc, char *argv[])
             sdl2_input_process_event(ctx->input, &event);
         }
 
+        /* -record snapshots this frame's input; -replay replaces it with
+         * the recorded frame and says how many ticks to step. */
+        int replay_ticks = game_replay_frame_input(ctx);
+        if (game_replay_finished(ctx))
+            break;
+
         /* Mode-independent keys (SFX, speed, volume, fullscreen, control, quit).
          * Called once per visual frame, after events are processed and before
          * the fixed-timestep loop runs.  See game_input.h for rationale. */
         game_input_global(ctx);
 
-        /* Calculate elapsed time and drive the game loop */
-        Uint64 now = SDL_GetTicks64();
-        Uint64 elapsed = now - last_ticks;
-        last_ticks = now;
+        /* Calculate elapsed time and drive the game loop.  A wake from
+         * the idle wait runs at most one tick, enough to see the key, not
+         * a catch-up burst for the time spent blocked. */
+        uint64_t now = sdl2_pacer_now(ctx->pacer);
+        uint64_t interval = sdl2_loop_tick_interval_us(sdl2_loop_get_speed(ctx->loop));
+        if (idle && now - last_us > interval)
+            last_us = now - interval;
+        uint64_t elapsed = now - last_us;
+        last_us = now;
 
-        sdl2_loop_update(ctx->loop, elapsed);
+        int ticks;
+        if (replay_ticks != GAME_REPLAY_LIVE && sdl2_loop_is_turbo(ctx->loop) &&
+            !game_replay_fast(ctx))
+        {
+            replay_scrub(ctx, replay_ticks);
+            continue;
+        }
+        if (replay_ticks != GAME_REPLAY_LIVE)
+            ticks = sdl2_loop_step(ctx->loop, replay_ticks, !game_replay_fast(ctx));
+        else
+            ticks = sdl2_loop_update_us(ctx->loop, elapsed);
+        game_replay_frame_done(ctx, ticks);
+        perf_hud_end_frame(ctx->perf_hud, elapsed, ticks);
+
+        /* Sleep, then spin, until the next refresh or tick is due. */
+        if (paced && !idle)
+        {
+            uint64_t tick_due = sdl2_pacer_now(ctx->pacer) + sdl2_loop_until_tick_us(ctx->loop);
+            uint64_t deadline = sdl2_pacer_deadline(ctx->pacer, now, tick_due, interval);
+            sdl2_pacer_wait_until(ctx->pacer, deadline);
+        }
     }
 
     game_destroy(ctx);
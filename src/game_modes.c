@@ -42,6 +42,7 @@
 #include "paddle_system.h"
 #include "paths.h"
 #include "presents_system.h"
+#include "rng.h"
 #include "score_system.h"
 #include "sdl2_audio.h"
 #include "sdl2_cursor.h"
@@ -49,9 +50,12 @@
 #include "sdl2_loop.h"
 #include "sdl2_renderer.h"
 #include "sdl2_state.h"
+#include "sdl2_texture.h"
 #include "sfx_system.h"
 #include "special_system.h"
+#include "sprite_catalog.h"
 #include "sys_priv.h"
+#include "trace.h"
 
 /* =========================================================================
  * MODE_GAME — core gameplay
@@ -139,27 +143,25 @@ static bool start_new_game(game_ctx_t *ctx)
     char filename[32];
     snprintf(filename, sizeof(filename), "level%02d.data", file_num);
 
-    char level_path[PATHS_MAX_PATH];
-    bool resolved =
-        paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) == PATHS_OK;
+    bool resolved = game_rules_level_available(ctx, filename);
     bool loaded = false;
     if (resolved)
     {
         level_system_advance_background(ctx->level);
-        loaded = (level_system_load_file(ctx->level, level_path) == LEVEL_SYS_OK);
+        loaded = (game_rules_load_level(ctx, filename) == LEVEL_SYS_OK);
     }
 
     /* A failed load must not enter gameplay: game_rules_check reads the empty
      * grid as a completed level and drops to BONUS.  Faithful to
      * original/file.c:142-146 (SetupStage exits via ShutDown on a
      * ReadNextLevel failure); modernised to refuse the game and return to the
-     * attract cycle instead of exiting the process.  See ADR-056.  Log the
-     * resolved path when we have it (parse failure) so the failing file is
-     * diagnosable; fall back to the filename when resolution itself failed. */
+     * attract cycle instead of exiting the process.  See ADR-056.  Say
+     * whether the file was found (parse failure) or missing altogether, so
+     * the failure is diagnosable whether it came from the pack or a file. */
     if (!loaded)
     {
-        fprintf(stderr, "Error: could not load level file %s — returning to title\n",
-                resolved ? level_path : filename);
+        fprintf(stderr, "Error: could not %s level file %s — returning to title\n",
+                resolved ? "parse" : "find", filename);
         ctx->game_active = false;
         return false;
     }
@@ -293,14 +295,19 @@ static void mode_game_update(sdl2_state_mode_t mode, void *ud)
     game_input_update(ctx);
 
     /* Ball physics */
+    TRACE_BEGIN(ball_update);
     ball_system_env_t benv = game_callbacks_ball_env(ctx);
     ball_system_update(ctx->ball, &benv);
+    TRACE_END(ball_update);
 
     /* Gun physics */
+    TRACE_BEGIN(gun_update);
     gun_system_env_t genv = game_callbacks_gun_env(ctx);
     gun_system_update(ctx->gun, &genv);
+    TRACE_END(gun_update);
 
     /* Block animation slides (BONUS/DEATH/EXTRABALL cycling) */
+    TRACE_BEGIN(block_update);
     int game_frame = (int)sdl2_state_frame(ctx->state);
     block_system_advance_animations(ctx->block, game_frame);
 
@@ -331,6 +338,7 @@ static void mode_game_update(sdl2_state_mode_t mode, void *ud)
      * ExplodeBlocksPending at original/blocks.c:1480-1646). */
     block_system_update_explosions(ctx->block, (int)sdl2_state_frame(ctx->state),
                                    game_callbacks_on_block_finalize, ctx);
+    TRACE_END(block_update);
 
     /* Ball→eyedude collision — original/ball.c:1339-1347 */
     game_rules_check_ball_eyedude(ctx);
@@ -370,7 +378,9 @@ static void mode_game_update(sdl2_state_mode_t mode, void *ud)
     message_system_update(ctx->message, frame);
 
     /* Game rules (level completion, bonus spawning) */
+    TRACE_BEGIN(rules_check);
     game_rules_check(ctx);
+    TRACE_END(rules_check);
 }
 
 /* =========================================================================
@@ -435,8 +445,8 @@ static void attract_random_display(game_ctx_t *ctx, int is_animating)
 
     attract_next_flash = attract_frame_counter + ATTRACT_FLASH_INTERVAL;
     score_system_set_display(ctx->score, attract_fake_score++);
-    ctx->attract_level_display = (rand() % LEVEL_MAX_NUM) + 1;
-    special_system_randomize(ctx->special, rand);
+    ctx->attract_level_display = (rng_next(&ctx->rng) % LEVEL_MAX_NUM) + 1;
+    special_system_randomize(ctx->special, game_callbacks_rand);
 }
 
 /* All menu/attract screens show the plain arrow (the original left the
@@ -625,13 +635,12 @@ static void mode_demo_enter(sdl2_state_mode_t mode, void *ud)
 
     /* Load demo.data blocks per original/demo.c:137 */
     {
-        char level_path[PATHS_MAX_PATH];
         ctx->time_bonus_total = 0;
         ctx->time_remaining = 0;
-        if (paths_level_file(&ctx->paths, "demo.data", level_path, sizeof(level_path)) == PATHS_OK)
+        if (game_rules_level_available(ctx, "demo.data"))
         {
             block_system_clear_all(ctx->block);
-            if (level_system_load_file(ctx->level, level_path) == LEVEL_SYS_OK)
+            if (game_rules_load_level(ctx, "demo.data") == LEVEL_SYS_OK)
             {
                 ctx->time_bonus_total = level_system_get_time_bonus(ctx->level);
                 ctx->time_remaining = ctx->time_bonus_total;
@@ -1733,6 +1742,68 @@ static void mode_edit_update(sdl2_state_mode_t mode, void *ud)
     }
 }
 
+/* =========================================================================
+ * Texture prefetch (ADR-099)
+ *
+ * With -texture-budget the texture cache loads images on first use.  On
+ * each mode change the new mode's images are prefetched, so its first
+ * frame does not stall on uploads.  A prefix names a whole sprite
+ * directory or a single key; the lists follow what each mode's render
+ * path draws.  Without -texture-budget the prefetch is a no-op.
+ * ========================================================================= */
+
+static const char *const prefetch_game[] = {
+    "balls/", "blocks/", "blockex/", "paddle/", "guns/",
+    "digits/", "bgrnds/", "guides/", "eyes/", "stars/",
+};
+static const char *const prefetch_attract_game[] = {
+    "balls/", "blocks/", "blockex/", "paddle/", "guns/", "digits/",
+    "bgrnds/", "guides/", "eyes/", "stars/", SPR_TITLE_BIG, SPR_LEFT_ARROW,
+};
+static const char *const prefetch_presents[] = {"presents/", "stars/"};
+static const char *const prefetch_intro[] = {
+    SPR_TITLE_BIG, "blocks/", SPR_PADDLE_SMALL, "guns/", SPR_BGRND_MAIN, "stars/",
+};
+static const char *const prefetch_text[] = {
+    SPR_TITLE_BIG, SPR_MOUSE, SPR_LEFT_ARROW, SPR_RIGHT_ARROW, SPR_BGRND_MAIN, "stars/",
+};
+static const char *const prefetch_bonus[] = {SPR_FLOPPY, "blocks/", "guns/", "digits/"};
+static const char *const prefetch_highscore[] = {
+    SPR_BGRND_SPACE, SPR_PRESENTS_EARTH, SPR_HIGHSCORE, SPR_BGRND_MAIN,
+};
+static const char *const prefetch_edit[] = {"blocks/", "bgrnds/"};
+
+#define PREFETCH_LIST(list) {list, (int)(sizeof(list) / sizeof(list[0]))}
+
+/* Per-mode prefetch lists.  PAUSE and DIALOGUE draw over the mode below
+ * them, whose images are already resident. */
+static const struct
+{
+    const char *const *prefixes;
+    int count;
+} mode_prefetch[SDL2ST_COUNT] = {
+    [SDL2ST_GAME] = PREFETCH_LIST(prefetch_game),
+    [SDL2ST_DEMO] = PREFETCH_LIST(prefetch_attract_game),
+    [SDL2ST_PREVIEW] = PREFETCH_LIST(prefetch_attract_game),
+    [SDL2ST_PRESENTS] = PREFETCH_LIST(prefetch_presents),
+    [SDL2ST_INTRO] = PREFETCH_LIST(prefetch_intro),
+    [SDL2ST_INSTRUCT] = PREFETCH_LIST(prefetch_text),
+    [SDL2ST_KEYS] = PREFETCH_LIST(prefetch_text),
+    [SDL2ST_KEYSEDIT] = PREFETCH_LIST(prefetch_text),
+    [SDL2ST_BONUS] = PREFETCH_LIST(prefetch_bonus),
+    [SDL2ST_HIGHSCORE] = PREFETCH_LIST(prefetch_highscore),
+    [SDL2ST_EDIT] = PREFETCH_LIST(prefetch_edit),
+};
+
+static void prefetch_mode_textures(sdl2_state_mode_t from, sdl2_state_mode_t to, void *ud)
+{
+    (void)from;
+    game_ctx_t *ctx = (game_ctx_t *)ud;
+    if ((unsigned)to >= SDL2ST_COUNT || mode_prefetch[to].count == 0)
+        return;
+    sdl2_texture_prefetch(ctx->texture, mode_prefetch[to].prefixes, mode_prefetch[to].count);
+}
+
 /* =========================================================================
  * Registration
  * ========================================================================= */
@@ -1858,4 +1929,6 @@ void game_modes_register(game_ctx_t *ctx)
         };
         sdl2_state_register(ctx->state, SDL2ST_DIALOGUE, &def);
     }
+
+    sdl2_state_set_transition_hook(ctx->state, prefetch_mode_textures);
 }
@@ -29,8 +29,11 @@
 #include "level_system.h"
 #include "message_system.h"
 #include "paddle_system.h"
+#include "perf_hud.h"
 #include "score_system.h"
+#include "sdl2_draw.h"
 #include "sdl2_font.h"
+#include "sdl2_layer.h"
 #include "sdl2_regions.h"
 #include "sdl2_renderer.h"
 #include "sdl2_state.h"
@@ -38,6 +41,7 @@
 #include "sfx_system.h"
 #include "special_system.h"
 #include "sprite_catalog.h"
+#include "trace.h"
 
 /* =========================================================================
  * Play area geometry (from stage.h constants)
@@ -72,86 +76,146 @@
 static void render_block_composite(const game_ctx_t *ctx, SDL_Renderer *sdl, int block_x,
                                    int block_y, int block_type, int hit_points);
 
-void game_render_blocks(const game_ctx_t *ctx)
+/* Draw the block in cell (row, col), if any, in window coordinates. */
+static void draw_block_cell(const game_ctx_t *ctx, SDL_Renderer *sdl, int row, int col)
 {
-    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
+    block_system_render_info_t info;
+    if (block_system_get_render_info(ctx->block, row, col, &info) != BLOCK_SYS_OK)
+        return;
+    if (!info.occupied && !info.exploding)
+        return;
 
-    for (int row = 0; row < MAX_ROW; row++)
+    /* Select sprite based on block state */
+    sprite_id_t sprite = SPRITE_NONE;
+
+    if (info.exploding)
     {
-        for (int col = 0; col < MAX_COL; col++)
-        {
-            block_system_render_info_t info;
-            if (block_system_get_render_info(ctx->block, row, col, &info) != BLOCK_SYS_OK)
-                continue;
-            if (!info.occupied && !info.exploding)
-                continue;
+        /* Explosion animation override.
+         *
+         * block_system_update_explosions advances explode_slide
+         * BEFORE the render path runs in the same tick.  So the
+         * slide values the render path sees are off-by-one from
+         * the original switch values:
+         *
+         *   slide=2: original case 1 — explosion sprite frame 0
+         *   slide=3: original case 2 — explosion sprite frame 1
+         *   slide=4: original case 3 — explosion sprite frame 2
+         *   slide=5: post-finalize (occupied=0 — won't reach here)
+         *   slide=1: pre-first-update (not reachable in normal flow
+         *            because update fires on the trigger tick)
+         *
+         * sprite_block_explode_id never returns SPRITE_NONE on its
+         * default case, so the SPRITE_NONE guard below does NOT
+         * fire here.  Skip slide outside [2, 4] explicitly and
+         * pass slide-2 as the 0-based sprite frame index. */
+        if (info.explode_slide < 2 || info.explode_slide > 4)
+            return;
+        sprite = sprite_block_explode_id(info.block_type, info.explode_slide - 2);
+    }
+    else if (info.block_type == COUNTER_BLK && info.counter_slide > 0)
+    {
+        /* Counter blocks show their hit count */
+        sprite = sprite_counter_slide_id(info.counter_slide);
+    }
+    else
+    {
+        /* Animated block types use bonus_slide to select frame */
+        sprite = sprite_block_animated_id(info.block_type, info.bonus_slide);
+        if (sprite == SPRITE_NONE)
+            sprite = sprite_block_id(info.block_type);
+    }
 
-            /* Select sprite key based on block state */
-            const char *key = NULL;
+    if (sprite == SPRITE_NONE)
+        return;
 
-            if (info.exploding)
-            {
-                /* Explosion animation override.
-                 *
-                 * block_system_update_explosions advances explode_slide
-                 * BEFORE the render path runs in the same tick.  So the
-                 * slide values the render path sees are off-by-one from
-                 * the original switch values:
-                 *
-                 *   slide=2: original case 1 — explosion sprite frame 0
-                 *   slide=3: original case 2 — explosion sprite frame 1
-                 *   slide=4: original case 3 — explosion sprite frame 2
-                 *   slide=5: post-finalize (occupied=0 — won't reach here)
-                 *   slide=1: pre-first-update (not reachable in normal flow
-                 *            because update fires on the trigger tick)
-                 *
-                 * sprite_block_explode_key never returns NULL on its
-                 * default case, so the if-key-NULL guard below does NOT
-                 * fire here.  Skip slide outside [2, 4] explicitly and
-                 * pass slide-2 as the 0-based sprite frame index. */
-                if (info.explode_slide < 2 || info.explode_slide > 4)
-                    continue;
-                key = sprite_block_explode_key(info.block_type, info.explode_slide - 2);
-            }
-            else if (info.block_type == COUNTER_BLK && info.counter_slide > 0)
-            {
-                /* Counter blocks show their hit count */
-                key = sprite_counter_slide_key(info.counter_slide);
-            }
-            else
-            {
-                /* Animated block types use bonus_slide to select frame */
-                key = sprite_block_animated_key(info.block_type, info.bonus_slide);
-                if (!key)
-                    key = sprite_block_key(info.block_type);
-            }
+    sdl2_texture_info_t tex;
+    if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
+        return;
 
-            if (!key)
-                continue;
+    /* Draw at the block's pixel position, offset by play area origin */
+    SDL_Rect dst = {
+        .x = PLAY_AREA_X + info.x,
+        .y = PLAY_AREA_Y + info.y,
+        .w = info.width,
+        .h = info.height,
+    };
+    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 
-            sdl2_texture_info_t tex;
-            if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
-                continue;
+    /* Composite overlays — rendered on top of the base sprite.
+     * Shared with game_render_editor_palette so editor previews
+     * also show DROP/RANDOM/BULLET composites. */
+    if (!info.exploding)
+    {
+        render_block_composite(ctx, sdl, PLAY_AREA_X + info.x, PLAY_AREA_Y + info.y,
+                               info.block_type, info.hit_points);
+    }
+}
 
-            /* Draw at the block's pixel position, offset by play area origin */
-            SDL_Rect dst = {
-                .x = PLAY_AREA_X + info.x,
-                .y = PLAY_AREA_Y + info.y,
-                .w = info.width,
-                .h = info.height,
-            };
-            SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+static void draw_all_blocks(const game_ctx_t *ctx, SDL_Renderer *sdl)
+{
+    for (int row = 0; row < MAX_ROW; row++)
+    {
+        for (int col = 0; col < MAX_COL; col++)
+        {
+            draw_block_cell(ctx, sdl, row, col);
+        }
+    }
+}
+
+/*
+ * Blocks live in ctx->block_layer (ADR-089).  A stale layer is composed
+ * from the whole grid; a current one is patched cell by cell from
+ * block_system's dirty masks, so a typical frame redraws only the few
+ * cells that were hit or animated.  Every block sprite and overlay stays
+ * inside its own cell, which is what makes clearing one cell safe.
+ */
+void game_render_blocks(const game_ctx_t *ctx)
+{
+    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
+    sdl2_layer_t *layer = ctx->block_layer;
+    uint16_t dirty[MAX_ROW];
 
-            /* Composite overlays — rendered on top of the base sprite.
-             * Shared with game_render_editor_palette so editor previews
-             * also show DROP/RANDOM/BULLET composites. */
-            if (!info.exploding)
+    int w = 0;
+    int h = 0;
+    sdl2_renderer_get_logical_size(ctx->renderer, &w, &h);
+    if (!sdl2_layer_is_current(layer, w, h, 0))
+    {
+        if (sdl2_layer_begin(layer, w, h, 0) != SDL2LY_OK)
+        {
+            /* No layer (-nolayers, no render targets) or no texture. */
+            draw_all_blocks(ctx, sdl);
+            return;
+        }
+        (void)block_system_take_dirty(ctx->block, dirty);
+        draw_all_blocks(ctx, sdl);
+        sdl2_layer_end(layer);
+    }
+    else if (block_system_take_dirty(ctx->block, dirty) > 0)
+    {
+        if (sdl2_layer_update(layer) != SDL2LY_OK)
+        {
+            sdl2_layer_invalidate(layer);
+            draw_all_blocks(ctx, sdl);
+            return;
+        }
+        for (int row = 0; row < MAX_ROW; row++)
+        {
+            for (int col = 0; dirty[row] >> col; col++)
             {
-                render_block_composite(ctx, sdl, PLAY_AREA_X + info.x, PLAY_AREA_Y + info.y,
-                                       info.block_type, info.hit_points);
+                if (!((dirty[row] >> col) & 1u))
+                    continue;
+                SDL_Rect cell = {PLAY_AREA_X + col * GAME_COL_WIDTH,
+                                 PLAY_AREA_Y + row * GAME_ROW_HEIGHT, GAME_COL_WIDTH,
+                                 GAME_ROW_HEIGHT};
+                sdl2_layer_clear_rect(layer, &cell);
+                draw_block_cell(ctx, sdl, row, col);
             }
         }
+        sdl2_layer_end(layer);
     }
+
+    SDL_Rect area = {PLAY_AREA_X, PLAY_AREA_Y, PLAY_AREA_W, PLAY_AREA_H};
+    sdl2_layer_draw(layer, &area);
 }
 
 /*
@@ -210,7 +274,7 @@ static void render_block_composite(const game_ctx_t *ctx, SDL_Renderer *sdl, int
              * (24,10),(33,10) per original/blocks.c:1682-1685.
              * DrawTheBullet subtracts BULLET_WC=3, BULLET_HC=8. */
             sdl2_texture_info_t btex;
-            if (sdl2_texture_get(ctx->texture, SPR_BULLET, &btex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_BULLET, &btex) == SDL2T_OK)
             {
                 int bwc = btex.width / 2;
                 int bhc = btex.height / 2;
@@ -223,7 +287,7 @@ static void render_block_composite(const game_ctx_t *ctx, SDL_Renderer *sdl, int
                         .w = btex.width,
                         .h = btex.height,
                     };
-                    SDL_RenderCopy(sdl, btex.texture, NULL, &bdst);
+                    sdl2_draw_copy(sdl, btex.texture, &btex.rect, &bdst);
                 }
             }
             break;
@@ -249,14 +313,14 @@ void game_render_balls(const game_ctx_t *ctx)
         if (!info.active)
             continue;
 
-        const char *key = NULL;
+        sprite_id_t sprite = SPRITE_NONE;
 
         switch (info.state)
         {
             case BALL_CREATE:
             {
                 /* Birth animation: slide is 1-8 */
-                key = sprite_ball_birth_key(info.slide);
+                sprite = sprite_ball_birth_id(info.slide);
                 break;
             }
 
@@ -264,23 +328,23 @@ void game_render_balls(const game_ctx_t *ctx)
             case BALL_READY:
             case BALL_DIE:
             case BALL_WAIT:
-                key = sprite_ball_key(info.slide);
+                sprite = sprite_ball_id(info.slide);
                 break;
 
             case BALL_POP:
                 /* Pop animation reuses birth frames in reverse */
-                key = sprite_ball_birth_key(info.slide);
+                sprite = sprite_ball_birth_id(info.slide);
                 break;
 
             default:
                 continue;
         }
 
-        if (!key)
+        if (sprite == SPRITE_NONE)
             continue;
 
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
             continue;
 
         /* Interpolate ball position.
@@ -312,15 +376,15 @@ void game_render_balls(const game_ctx_t *ctx)
             .w = BALL_WIDTH,
             .h = BALL_HEIGHT,
         };
-        SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 
         /* Draw launch direction guide above BALL_READY balls */
         if (info.state == BALL_READY)
         {
             ball_system_guide_info_t guide = ball_system_get_guide_info(ctx->ball);
-            const char *gkey = sprite_guide_key(guide.pos);
+            sprite_id_t guide_sprite = sprite_guide_id(guide.pos);
             sdl2_texture_info_t gtex;
-            if (sdl2_texture_get(ctx->texture, gkey, &gtex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, guide_sprite, &gtex) == SDL2T_OK)
             {
                 /* Legacy top-left: (ballx-14, bally-22) for 29x12 sprite.
                  * X: center on ball. Y: 16px gap + half sprite height above ball. */
@@ -330,7 +394,7 @@ void game_render_balls(const game_ctx_t *ctx)
                     .w = gtex.width,
                     .h = gtex.height,
                 };
-                SDL_RenderCopy(sdl, gtex.texture, NULL, &gdst);
+                sdl2_draw_copy(sdl, gtex.texture, &gtex.rect, &gdst);
             }
         }
     }
@@ -346,9 +410,9 @@ void game_render_paddle(const game_ctx_t *ctx)
     if (paddle_system_get_render_info(ctx->paddle, &info) != PADDLE_SYS_OK)
         return;
 
-    const char *key = sprite_paddle_key(info.width);
+    sprite_id_t sprite = sprite_paddle_id(info.width);
     sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
         return;
 
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
@@ -365,7 +429,7 @@ void game_render_paddle(const game_ctx_t *ctx)
         .w = info.width,
         .h = info.height,
     };
-    SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 }
 
 /* =========================================================================
@@ -376,32 +440,6 @@ void game_render_playfield(const game_ctx_t *ctx)
 {
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
 
-    /* Draw play area border — matches legacy playWindow border_width=2.
-     * BorderGlow (game_render_border_glow) is attract/menu-only in the
-     * original (original/sfx.c; handleGameMode never calls BorderGlow), so
-     * gameplay and the editor keep a static (non-pulsing) border.  Color is
-     * static green while the no-walls special is active and static red
-     * otherwise, matching ToggleWallsOn (original/special.c:141 green,
-     * original/special.c:146 red). */
-    if (special_system_is_active(ctx->special, SPECIAL_NO_WALLS))
-        SDL_SetRenderDrawColor(sdl, 0, 200, 0, 255);
-    else
-        SDL_SetRenderDrawColor(sdl, 200, 0, 0, 255);
-
-    int bx = PLAY_AREA_X - BORDER_THICKNESS;
-    int by = PLAY_AREA_Y - BORDER_THICKNESS;
-    int bw = PLAY_AREA_W + 2 * BORDER_THICKNESS;
-    int bh = PLAY_AREA_H + 2 * BORDER_THICKNESS;
-
-    SDL_Rect top = {bx, by, bw, BORDER_THICKNESS};
-    SDL_Rect bottom = {bx, by + bh - BORDER_THICKNESS, bw, BORDER_THICKNESS};
-    SDL_Rect left = {bx, by, BORDER_THICKNESS, bh};
-    SDL_Rect right = {bx + bw - BORDER_THICKNESS, by, BORDER_THICKNESS, bh};
-    SDL_RenderFillRect(sdl, &top);
-    SDL_RenderFillRect(sdl, &bottom);
-    SDL_RenderFillRect(sdl, &left);
-    SDL_RenderFillRect(sdl, &right);
-
     /* Clip all play area content to the border bounds */
     SDL_Rect clip = {PLAY_AREA_X, PLAY_AREA_Y, PLAY_AREA_W, PLAY_AREA_H};
     SDL_RenderSetClipRect(sdl, &clip);
@@ -471,32 +509,23 @@ static void game_render_editor_grid(const game_ctx_t *ctx)
     SDL_SetRenderDrawColor(sdl, 0x77, 0x00, 0x00, 255);
 
     for (int x = xinc; x <= PLAY_AREA_W; x += xinc)
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + x, PLAY_AREA_Y, PLAY_AREA_X + x,
-                           PLAY_AREA_Y + vert_bottom);
+        sdl2_draw_line(sdl, PLAY_AREA_X + x, PLAY_AREA_Y, PLAY_AREA_X + x,
+                       PLAY_AREA_Y + vert_bottom);
 
     for (int y = yinc; y <= horiz_loop_bound; y += yinc)
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X, PLAY_AREA_Y + y, PLAY_AREA_X + PLAY_AREA_W,
-                           PLAY_AREA_Y + y);
+        sdl2_draw_line(sdl, PLAY_AREA_X, PLAY_AREA_Y + y, PLAY_AREA_X + PLAY_AREA_W,
+                       PLAY_AREA_Y + y);
 }
 
 /* =========================================================================
  * Background rendering
  * ========================================================================= */
 
-void game_render_background(const game_ctx_t *ctx)
+/* Background PNGs are small tiles (e.g., 32x32) — tile them across the play area */
+static void tile_play_area(SDL_Renderer *sdl, const sdl2_texture_info_t *tex)
 {
-    int bg_num = level_system_get_background(ctx->level);
-    const char *key = sprite_background_key(bg_num);
-
-    sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
-        return;
-
-    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
-
-    /* Background PNGs are small tiles (e.g., 32x32) — tile them across the play area */
-    int tw = tex.width;
-    int th = tex.height;
+    int tw = tex->width;
+    int th = tex->height;
     if (tw <= 0 || th <= 0)
         return;
 
@@ -513,13 +542,100 @@ void game_render_background(const game_ctx_t *ctx)
             if (ty + dh > PLAY_AREA_Y + PLAY_AREA_H)
                 dh = PLAY_AREA_Y + PLAY_AREA_H - ty;
 
-            SDL_Rect src = {0, 0, dw, dh};
+            SDL_Rect src = {tex->rect.x, tex->rect.y, dw, dh};
             SDL_Rect dst = {tx, ty, dw, dh};
-            SDL_RenderCopy(sdl, tex.texture, &src, &dst);
+            sdl2_draw_copy(sdl, tex->texture, &src, &dst);
         }
     }
 }
 
+/* Play area border — matches legacy playWindow border_width=2. */
+static void draw_play_border(SDL_Renderer *sdl, game_border_t border)
+{
+    if (border == GAME_BORDER_GREEN)
+        SDL_SetRenderDrawColor(sdl, 0, 200, 0, 255);
+    else if (border == GAME_BORDER_RED)
+        SDL_SetRenderDrawColor(sdl, 200, 0, 0, 255);
+    else
+        return;
+
+    int bx = PLAY_AREA_X - BORDER_THICKNESS;
+    int by = PLAY_AREA_Y - BORDER_THICKNESS;
+    int bw = PLAY_AREA_W + 2 * BORDER_THICKNESS;
+    int bh = PLAY_AREA_H + 2 * BORDER_THICKNESS;
+
+    SDL_Rect top = {bx, by, bw, BORDER_THICKNESS};
+    SDL_Rect bottom = {bx, by + bh - BORDER_THICKNESS, bw, BORDER_THICKNESS};
+    SDL_Rect left = {bx, by, BORDER_THICKNESS, bh};
+    SDL_Rect right = {bx + bw - BORDER_THICKNESS, by, BORDER_THICKNESS, bh};
+    sdl2_draw_fill_rect(sdl, &top);
+    sdl2_draw_fill_rect(sdl, &bottom);
+    sdl2_draw_fill_rect(sdl, &left);
+    sdl2_draw_fill_rect(sdl, &right);
+}
+
+static void draw_backdrop(const game_ctx_t *ctx, sprite_id_t tile, game_border_t border,
+                          bool grid)
+{
+    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
+    sdl2_texture_info_t tex;
+    if (sdl2_texture_get_id(ctx->texture, tile, &tex) == SDL2T_OK)
+        tile_play_area(sdl, &tex);
+    if (grid)
+        game_render_editor_grid(ctx);
+    draw_play_border(sdl, border);
+}
+
+void game_render_backdrop(const game_ctx_t *ctx, sprite_id_t tile, game_border_t border,
+                          bool grid)
+{
+    /* The layer spans the logical canvas so the draw code above keeps
+     * its window coordinates; only the play area and border are copied. */
+    int w = 0;
+    int h = 0;
+    sdl2_renderer_get_logical_size(ctx->renderer, &w, &h);
+    uint64_t key = (uint64_t)(uint32_t)(tile + 1) | (uint64_t)border << 32 | (uint64_t)grid << 40;
+    if (!sdl2_layer_is_current(ctx->play_layer, w, h, key))
+    {
+        if (sdl2_layer_begin(ctx->play_layer, w, h, key) != SDL2LY_OK)
+        {
+            /* No layer (-nolayers, no render targets) or no texture. */
+            draw_backdrop(ctx, tile, border, grid);
+            return;
+        }
+        draw_backdrop(ctx, tile, border, grid);
+        sdl2_layer_end(ctx->play_layer);
+    }
+
+    SDL_Rect area = {PLAY_AREA_X - BORDER_THICKNESS, PLAY_AREA_Y - BORDER_THICKNESS,
+                     PLAY_AREA_W + 2 * BORDER_THICKNESS, PLAY_AREA_H + 2 * BORDER_THICKNESS};
+    sdl2_layer_draw(ctx->play_layer, &area);
+}
+
+static sprite_id_t level_tile(const game_ctx_t *ctx)
+{
+    return sprite_background_id(level_system_get_background(ctx->level));
+}
+
+/*
+ * BorderGlow (game_render_border_glow) is attract/menu-only in the
+ * original (original/sfx.c; handleGameMode never calls BorderGlow), so
+ * gameplay and the editor keep a static (non-pulsing) border.  Color is
+ * static green while the no-walls special is active and static red
+ * otherwise, matching ToggleWallsOn (original/special.c:141 green,
+ * original/special.c:146 red).
+ */
+static game_border_t level_border(const game_ctx_t *ctx)
+{
+    return special_system_is_active(ctx->special, SPECIAL_NO_WALLS) ? GAME_BORDER_GREEN
+                                                                    : GAME_BORDER_RED;
+}
+
+void game_render_background(const game_ctx_t *ctx)
+{
+    game_render_backdrop(ctx, level_tile(ctx), GAME_BORDER_NONE, false);
+}
+
 /* =========================================================================
  * Bullet and tink rendering
  * ========================================================================= */
@@ -530,7 +646,7 @@ void game_render_bullets(const game_ctx_t *ctx)
 
     /* Render bullets */
     sdl2_texture_info_t btex;
-    int have_bullet_tex = (sdl2_texture_get(ctx->texture, SPR_BULLET, &btex) == SDL2T_OK);
+    int have_bullet_tex = (sdl2_texture_get_id(ctx->texture, SPRITE_BULLET, &btex) == SDL2T_OK);
 
     for (int i = 0; i < GUN_MAX_BULLETS; i++)
     {
@@ -557,13 +673,13 @@ void game_render_bullets(const game_ctx_t *ctx)
                 .w = GUN_BULLET_WIDTH,
                 .h = GUN_BULLET_HEIGHT,
             };
-            SDL_RenderCopy(sdl, btex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, btex.texture, &btex.rect, &dst);
         }
     }
 
     /* Render tinks (impact effects) */
     sdl2_texture_info_t ttex;
-    int have_tink_tex = (sdl2_texture_get(ctx->texture, SPR_TINK, &ttex) == SDL2T_OK);
+    int have_tink_tex = (sdl2_texture_get_id(ctx->texture, SPRITE_TINK, &ttex) == SDL2T_OK);
 
     for (int i = 0; i < GUN_MAX_TINKS; i++)
     {
@@ -582,7 +698,7 @@ void game_render_bullets(const game_ctx_t *ctx)
                 .w = GUN_TINK_WIDTH,
                 .h = GUN_TINK_HEIGHT,
             };
-            SDL_RenderCopy(sdl, ttex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, ttex.texture, &ttex.rect, &dst);
         }
     }
 }
@@ -600,7 +716,7 @@ void game_render_lives(const game_ctx_t *ctx)
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
 
     sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, SPR_BALL_LIFE, &tex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_BALL_LIFE, &tex) != SDL2T_OK)
         return;
 
     /* Draw lives right-to-left, anchored at LEVEL_AREA_X + 175 (life i=0
@@ -614,7 +730,7 @@ void game_render_lives(const game_ctx_t *ctx)
     {
         SDL_Rect dst = {.w = tex.width, .h = tex.height};
         level_life_position(LEVEL_AREA_X, LEVEL_AREA_Y, i, tex.width, tex.height, &dst.x, &dst.y);
-        SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
     }
 
     /* Draw level number right-anchored at LEVEL_AREA_X + 260 in absolute
@@ -640,11 +756,11 @@ void game_render_lives(const game_ctx_t *ctx)
     {
         int digit = remaining % 10;
         sdl2_texture_info_t dtex;
-        if (sdl2_texture_get(ctx->texture, sprite_digit_key(digit), &dtex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, sprite_digit_id(digit), &dtex) == SDL2T_OK)
         {
             SDL_Rect dst = {.w = SCORE_DIGIT_WIDTH, .h = SCORE_DIGIT_HEIGHT};
             level_number_digit_position(LEVEL_AREA_X, LEVEL_AREA_Y, digit_index, &dst.x, &dst.y);
-            SDL_RenderCopy(sdl, dtex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, dtex.texture, &dtex.rect, &dst);
         }
         remaining /= 10;
         digit_index++;
@@ -697,7 +813,7 @@ void game_render_ammo_belt(const game_ctx_t *ctx)
         return;
 
     sdl2_texture_info_t btex;
-    if (sdl2_texture_get(ctx->texture, SPR_BULLET, &btex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_BULLET, &btex) != SDL2T_OK)
         return;
 
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
@@ -715,7 +831,7 @@ void game_render_ammo_belt(const game_ctx_t *ctx)
             .w = btex.width,
             .h = btex.height,
         };
-        SDL_RenderCopy(sdl, btex.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, btex.texture, &btex.rect, &dst);
     }
 }
 
@@ -751,9 +867,9 @@ void game_render_score(const game_ctx_t *ctx)
 
     for (int i = 0; i < layout.count; i++)
     {
-        const char *key = sprite_digit_key(layout.digits[i]);
+        sprite_id_t sprite = sprite_digit_id(layout.digits[i]);
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
             continue;
 
         SDL_Rect dst = {
@@ -762,7 +878,7 @@ void game_render_score(const game_ctx_t *ctx)
             .w = SCORE_DIGIT_WIDTH,
             .h = SCORE_WINDOW_HEIGHT,
         };
-        SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
     }
 }
 
@@ -770,11 +886,11 @@ void game_render_score(const game_ctx_t *ctx)
  * Full frame rendering
  * ========================================================================= */
 
-/* Tile the space background across the entire window */
-static void render_main_background(const game_ctx_t *ctx)
+/* Tile the space background across a logical_w x logical_h window */
+static void tile_main_background(const game_ctx_t *ctx, int logical_w, int logical_h)
 {
     sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, SPR_BGRND_SPACE, &tex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_BGRND_SPACE, &tex) != SDL2T_OK)
         return;
 
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
@@ -783,6 +899,26 @@ static void render_main_background(const game_ctx_t *ctx)
     if (tw <= 0 || th <= 0)
         return;
 
+    for (int ty = 0; ty < logical_h; ty += th)
+    {
+        for (int tx = 0; tx < logical_w; tx += tw)
+        {
+            int dw = tw;
+            int dh = th;
+            if (tx + dw > logical_w)
+                dw = logical_w - tx;
+            if (ty + dh > logical_h)
+                dh = logical_h - ty;
+            SDL_Rect src = {tex.rect.x, tex.rect.y, dw, dh};
+            SDL_Rect dst = {tx, ty, dw, dh};
+            sdl2_draw_copy(sdl, tex.texture, &src, &dst);
+        }
+    }
+}
+
+/* Window background, from ctx->backdrop_layer when there is one (ADR-088). */
+static void render_main_background(const game_ctx_t *ctx)
+{
     /* Query the renderer's *current* logical size rather than the
      * compile-time SDL2R_LOGICAL_WIDTH/HEIGHT macros — SDL2ST_EDIT
      * widens the logical canvas at runtime (see
@@ -794,21 +930,18 @@ static void render_main_background(const game_ctx_t *ctx)
     int logical_h = 0;
     sdl2_renderer_get_logical_size(ctx->renderer, &logical_w, &logical_h);
 
-    for (int ty = 0; ty < logical_h; ty += th)
+    sdl2_layer_t *layer = ctx->backdrop_layer;
+    if (!sdl2_layer_is_current(layer, logical_w, logical_h, SPRITE_BGRND_SPACE))
     {
-        for (int tx = 0; tx < logical_w; tx += tw)
+        if (sdl2_layer_begin(layer, logical_w, logical_h, SPRITE_BGRND_SPACE) != SDL2LY_OK)
         {
-            int dw = tw;
-            int dh = th;
-            if (tx + dw > logical_w)
-                dw = logical_w - tx;
-            if (ty + dh > logical_h)
-                dh = logical_h - ty;
-            SDL_Rect src = {0, 0, dw, dh};
-            SDL_Rect dst = {tx, ty, dw, dh};
-            SDL_RenderCopy(sdl, tex.texture, &src, &dst);
+            tile_main_background(ctx, logical_w, logical_h);
+            return;
         }
+        tile_main_background(ctx, logical_w, logical_h);
+        sdl2_layer_end(layer);
     }
+    sdl2_layer_draw(layer, NULL);
 }
 
 /* =========================================================================
@@ -840,15 +973,15 @@ static void render_main_background(const game_ctx_t *ctx)
 #define PALETTE_COL2_CENTER_X (PALETTE_X + EDITOR_TOOL_WIDTH / 2 + EDITOR_TOOL_WIDTH / 4)
 
 /*
- * Look up the sprite key for a palette entry, accounting for COUNTER_BLK's
+ * Look up the sprite for a palette entry, accounting for COUNTER_BLK's
  * five slide variants (original/editor.c:364: DrawTheBlock(..., COUNTER_BLK,
  * j, 0, 0) with j=1..5 selecting the digit sprite).
  */
-static const char *palette_entry_sprite_key(const editor_palette_entry_t *entry)
+static sprite_id_t palette_entry_sprite(const editor_palette_entry_t *entry)
 {
     if (entry->block_type == COUNTER_BLK && entry->counter_slide > 0)
-        return sprite_counter_slide_key(entry->counter_slide);
-    return sprite_block_key(entry->block_type);
+        return sprite_counter_slide_id(entry->counter_slide);
+    return sprite_block_id(entry->block_type);
 }
 
 /*
@@ -871,10 +1004,10 @@ static void draw_panel_border(SDL_Renderer *sdl, SDL_Rect rgn, int thickness)
     SDL_Rect bottom = {bx, by + bh - thickness, bw, thickness};
     SDL_Rect left = {bx, by, thickness, bh};
     SDL_Rect right = {bx + bw - thickness, by, thickness, bh};
-    SDL_RenderFillRect(sdl, &top);
-    SDL_RenderFillRect(sdl, &bottom);
-    SDL_RenderFillRect(sdl, &left);
-    SDL_RenderFillRect(sdl, &right);
+    sdl2_draw_fill_rect(sdl, &top);
+    sdl2_draw_fill_rect(sdl, &bottom);
+    sdl2_draw_fill_rect(sdl, &left);
+    sdl2_draw_fill_rect(sdl, &right);
 }
 
 void game_render_editor_palette(const game_ctx_t *ctx)
@@ -893,12 +1026,12 @@ void game_render_editor_palette(const game_ctx_t *ctx)
         if (!entry)
             continue;
 
-        const char *key = palette_entry_sprite_key(entry);
-        if (!key)
+        sprite_id_t sprite = palette_entry_sprite(entry);
+        if (sprite == SPRITE_NONE)
             continue;
 
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
             continue;
 
         int in_col1 = i < col1_count;
@@ -910,7 +1043,7 @@ void game_render_editor_palette(const game_ctx_t *ctx)
         int ey = PALETTE_Y + row * PALETTE_ROW_PITCH + (PALETTE_ROW_PITCH / 2 - tex.height / 2);
 
         SDL_Rect dst = {ex, ey, tex.width, tex.height};
-        SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 
         /* Composite overlay (DROP digit, RANDOM "- R -", BULLET 4-bullets)
          * shared with game_render_blocks per Copilot review F3.
@@ -934,16 +1067,16 @@ void game_render_editor_palette(const game_ctx_t *ctx)
         editor_system_get_palette_entry(ctx->editor, selected);
     if (active_entry)
     {
-        const char *akey = palette_entry_sprite_key(active_entry);
-        if (akey)
+        sprite_id_t active_sprite = palette_entry_sprite(active_entry);
+        if (active_sprite != SPRITE_NONE)
         {
             sdl2_texture_info_t atex;
-            if (sdl2_texture_get(ctx->texture, akey, &atex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, active_sprite, &atex) == SDL2T_OK)
             {
                 int ax = type_rgn.x + 65;
                 int ay = type_rgn.y + type_rgn.h / 2 - atex.height / 2;
                 SDL_Rect adst = {ax, ay, atex.width, atex.height};
-                SDL_RenderCopy(sdl, atex.texture, NULL, &adst);
+                sdl2_draw_copy(sdl, atex.texture, &atex.rect, &adst);
                 render_block_composite(ctx, sdl, ax, ay, active_entry->block_type, 1);
             }
         }
@@ -1014,29 +1147,31 @@ void game_render_eyedude(const game_ctx_t *ctx)
         return;
 
     /* Select sprite based on direction and frame */
-    const char *key = NULL;
+    sprite_id_t sprite = SPRITE_NONE;
     if (info.dir == EYEDUDE_DIR_LEFT)
     {
-        static const char *const left_keys[] = {SPR_GUY_LEFT_1, SPR_GUY_LEFT_2, SPR_GUY_LEFT_3,
-                                                SPR_GUY_LEFT_4, SPR_GUY_LEFT_5, SPR_GUY_LEFT_6};
-        key = left_keys[info.frame_index % 6];
+        static const sprite_id_t left_sprites[] = {SPRITE_GUY_LEFT_1, SPRITE_GUY_LEFT_2,
+                                                   SPRITE_GUY_LEFT_3, SPRITE_GUY_LEFT_4,
+                                                   SPRITE_GUY_LEFT_5, SPRITE_GUY_LEFT_6};
+        sprite = left_sprites[info.frame_index % 6];
     }
     else if (info.dir == EYEDUDE_DIR_RIGHT)
     {
-        static const char *const right_keys[] = {SPR_GUY_RIGHT_1, SPR_GUY_RIGHT_2, SPR_GUY_RIGHT_3,
-                                                 SPR_GUY_RIGHT_4, SPR_GUY_RIGHT_5, SPR_GUY_RIGHT_6};
-        key = right_keys[info.frame_index % 6];
+        static const sprite_id_t right_sprites[] = {SPRITE_GUY_RIGHT_1, SPRITE_GUY_RIGHT_2,
+                                                    SPRITE_GUY_RIGHT_3, SPRITE_GUY_RIGHT_4,
+                                                    SPRITE_GUY_RIGHT_5, SPRITE_GUY_RIGHT_6};
+        sprite = right_sprites[info.frame_index % 6];
     }
     else if (info.dir == EYEDUDE_DIR_DEAD)
     {
-        key = SPR_EYEDUDE_DEAD;
+        sprite = SPRITE_EYEDUDE_DEAD;
     }
 
-    if (!key)
+    if (sprite == SPRITE_NONE)
         return;
 
     sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
         return;
 
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
@@ -1046,7 +1181,7 @@ void game_render_eyedude(const game_ctx_t *ctx)
         .w = EYEDUDE_WIDTH,
         .h = EYEDUDE_HEIGHT,
     };
-    SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 }
 
 /* =========================================================================
@@ -1084,10 +1219,10 @@ void game_render_border_glow(const game_ctx_t *ctx)
     SDL_Rect bottom = {bx, by + bh - BORDER_THICKNESS, bw, BORDER_THICKNESS};
     SDL_Rect left = {bx, by, BORDER_THICKNESS, bh};
     SDL_Rect right = {bx + bw - BORDER_THICKNESS, by, BORDER_THICKNESS, bh};
-    SDL_RenderFillRect(sdl, &top);
-    SDL_RenderFillRect(sdl, &bottom);
-    SDL_RenderFillRect(sdl, &left);
-    SDL_RenderFillRect(sdl, &right);
+    sdl2_draw_fill_rect(sdl, &top);
+    sdl2_draw_fill_rect(sdl, &bottom);
+    sdl2_draw_fill_rect(sdl, &left);
+    sdl2_draw_fill_rect(sdl, &right);
 }
 
 /* =========================================================================
@@ -1100,11 +1235,11 @@ void game_render_deveyes(const game_ctx_t *ctx)
     if (!info.active)
         return;
 
-    static const char *const eye_keys[] = {SPR_EYEDUDE,   SPR_EYEDUDE_1, SPR_EYEDUDE_2,
-                                           SPR_EYEDUDE_3, SPR_EYEDUDE_4, SPR_EYEDUDE_5};
+    static const sprite_id_t eye_sprites[] = {SPRITE_EYEDUDE,   SPRITE_EYEDUDE_1, SPRITE_EYEDUDE_2,
+                                              SPRITE_EYEDUDE_3, SPRITE_EYEDUDE_4, SPRITE_EYEDUDE_5};
     int fi = info.frame_index % SFX_DEVEYE_FRAMES;
     sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, eye_keys[fi], &tex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, eye_sprites[fi], &tex) != SDL2T_OK)
         return;
 
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
@@ -1114,7 +1249,7 @@ void game_render_deveyes(const game_ctx_t *ctx)
         .w = SFX_DEVEYE_WIDTH,
         .h = SFX_DEVEYE_HEIGHT,
     };
-    SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 }
 
 /* =========================================================================
@@ -1250,7 +1385,7 @@ static void game_render_dialogue(const game_ctx_t *ctx)
 
     /* 1. Stone tile background — original/dialogue.c:165 DrawStageBackground */
     sdl2_texture_info_t bg;
-    if (sdl2_texture_get(ctx->texture, SPR_BGRND_MAIN, &bg) == SDL2T_OK && bg.width > 0 &&
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_BGRND_MAIN, &bg) == SDL2T_OK && bg.width > 0 &&
         bg.height > 0)
     {
         for (int ty = by; ty < by + bh; ty += bg.height)
@@ -1263,9 +1398,9 @@ static void game_render_dialogue(const game_ctx_t *ctx)
                     dw = bx + bw - tx;
                 if (ty + dh > by + bh)
                     dh = by + bh - ty;
-                SDL_Rect src = {0, 0, dw, dh};
+                SDL_Rect src = {bg.rect.x, bg.rect.y, dw, dh};
                 SDL_Rect dst = {tx, ty, dw, dh};
-                SDL_RenderCopy(sdl, bg.texture, &src, &dst);
+                sdl2_draw_copy(sdl, bg.texture, &src, &dst);
             }
         }
     }
@@ -1276,17 +1411,17 @@ static void game_render_dialogue(const game_ctx_t *ctx)
     SDL_Rect border_bot = {bx, by + bh - 4, bw, 4};
     SDL_Rect border_lft = {bx, by, 4, bh};
     SDL_Rect border_rgt = {bx + bw - 4, by, 4, bh};
-    SDL_RenderFillRect(sdl, &border_top);
-    SDL_RenderFillRect(sdl, &border_bot);
-    SDL_RenderFillRect(sdl, &border_lft);
-    SDL_RenderFillRect(sdl, &border_rgt);
+    sdl2_draw_fill_rect(sdl, &border_top);
+    sdl2_draw_fill_rect(sdl, &border_bot);
+    sdl2_draw_fill_rect(sdl, &border_lft);
+    sdl2_draw_fill_rect(sdl, &border_rgt);
 
     /* 3. Icon — original/dialogue.c:176 RenderShape at (2, 4) */
     sdl2_texture_info_t icon;
-    if (sdl2_texture_get(ctx->texture, SPR_TEXT, &icon) == SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_TEXT, &icon) == SDL2T_OK)
     {
         SDL_Rect dst = {bx + 2, by + 4, icon.width, icon.height};
-        SDL_RenderCopy(sdl, icon.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, icon.texture, &icon.rect, &dst);
     }
 
     /* 4. Green shadow message — original/dialogue.c:169 y=10 */
@@ -1304,7 +1439,7 @@ static void game_render_dialogue(const game_ctx_t *ctx)
     /* 5. White separator — original/dialogue.c:187 DrawLine y=45, 2px */
     SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
     SDL_Rect sep = {bx + 10, by + 45, bw - 20, 2};
-    SDL_RenderFillRect(sdl, &sep);
+    sdl2_draw_fill_rect(sdl, &sep);
 
     /* 6. Input area — original/dialogue.c:234-242 */
     const char *input = dialogue_system_get_input(ctx->dialogue);
@@ -1320,27 +1455,124 @@ static void game_render_dialogue(const game_ctx_t *ctx)
         /* Cursor after text */
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
         SDL_Rect cursor = {inp_x + m.width, by + 70, 2, 16};
-        SDL_RenderFillRect(sdl, &cursor);
+        sdl2_draw_fill_rect(sdl, &cursor);
     }
     else
     {
         /* Question mark icon when input is empty — original uses (DIALOGUE_WIDTH/2)-16 */
         sdl2_texture_info_t qmark;
-        if (sdl2_texture_get(ctx->texture, SPR_QUESTION, &qmark) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_QUESTION, &qmark) == SDL2T_OK)
         {
             SDL_Rect dst = {bx + bw / 2 - 16, by + 70, qmark.width, qmark.height};
-            SDL_RenderCopy(sdl, qmark.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, qmark.texture, &qmark.rect, &dst);
         }
     }
 }
 
+/* =========================================================================
+ * Performance HUD — F3 overlay, drawn over everything (ADR-092)
+ * ========================================================================= */
+
+#define PERF_HUD_X 4
+#define PERF_HUD_Y 4
+#define PERF_HUD_PAD 4
+#define PERF_HUD_BAR_W 2
+#define PERF_HUD_W (PERF_HUD_HISTORY * PERF_HUD_BAR_W + 2 * PERF_HUD_PAD)
+#define PERF_HUD_GRAPH_H 40
+#define PERF_HUD_GRAPH_US 33333U  /* Frame time at the top of the graph: two 60 Hz frames */
+#define PERF_HUD_BUDGET_US 16667U /* Bars above this are drawn red */
+
+static void render_perf_hud(const game_ctx_t *ctx)
+{
+    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
+    perf_hud_summary_t s;
+    perf_hud_get_summary(ctx->perf_hud, &s);
+
+    int lh = sdl2_font_line_height(ctx->font, SDL2F_FONT_COPY);
+    int text_y = PERF_HUD_Y + PERF_HUD_PAD;
+    int graph_y = text_y + (2 + s.zone_count) * lh + PERF_HUD_PAD;
+    int graph_bottom = graph_y + PERF_HUD_GRAPH_H;
+
+    SDL_SetRenderDrawBlendMode(sdl, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(sdl, 0, 0, 0, 176);
+    SDL_Rect panel = {PERF_HUD_X, PERF_HUD_Y, PERF_HUD_W, graph_bottom + PERF_HUD_PAD - PERF_HUD_Y};
+    sdl2_draw_fill_rect(sdl, &panel);
+    SDL_SetRenderDrawBlendMode(sdl, SDL_BLENDMODE_NONE);
+
+    /* Text: refreshed twice a second by perf_hud, so it stays readable. */
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color yellow = {255, 255, 50, 255};
+    char line[96];
+    int x = PERF_HUD_X + PERF_HUD_PAD;
+    if (s.frames == 0)
+    {
+        sdl2_font_draw(ctx->font, SDL2F_FONT_COPY, "Measuring...", x, text_y, white);
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "%.0f fps   %.2f ms   worst %.2f ms", s.fps,
+                 s.frame_ms_mean, s.frame_ms_max);
+        sdl2_font_draw(ctx->font, SDL2F_FONT_COPY, line, x, text_y, white);
+        snprintf(line, sizeof(line), "ticks %.2f (max %d)   draws %.0f   tex switches %.0f",
+                 s.ticks_per_frame, s.ticks_max, s.draw_calls, s.texture_switches);
+        sdl2_font_draw(ctx->font, SDL2F_FONT_COPY, line, x, text_y + lh, white);
+    }
+    for (int i = 0; i < s.zone_count; i++)
+    {
+        snprintf(line, sizeof(line), "%s  %.3f ms", s.zones[i].name, s.zones[i].ms_per_frame);
+        sdl2_font_draw(ctx->font, SDL2F_FONT_COPY, line, x, text_y + (2 + i) * lh, yellow);
+    }
+
+    /* Sparkline: one bar per frame, newest on the right, batched into two
+     * fills (within budget, over budget). */
+    uint32_t history[PERF_HUD_HISTORY];
+    size_t n = perf_hud_history(ctx->perf_hud, history, PERF_HUD_HISTORY);
+    SDL_Rect ok[PERF_HUD_HISTORY];
+    SDL_Rect over[PERF_HUD_HISTORY];
+    int n_ok = 0;
+    int n_over = 0;
+    int bar_x = x + (PERF_HUD_HISTORY - (int)n) * PERF_HUD_BAR_W;
+    for (size_t i = 0; i < n; i++, bar_x += PERF_HUD_BAR_W)
+    {
+        uint32_t us = history[i] < PERF_HUD_GRAPH_US ? history[i] : PERF_HUD_GRAPH_US;
+        int h = (int)((uint64_t)us * PERF_HUD_GRAPH_H / PERF_HUD_GRAPH_US);
+        if (h < 1)
+            h = 1;
+        SDL_Rect bar = {bar_x, graph_bottom - h, PERF_HUD_BAR_W, h};
+        if (history[i] > PERF_HUD_BUDGET_US)
+            over[n_over++] = bar;
+        else
+            ok[n_ok++] = bar;
+    }
+    SDL_SetRenderDrawColor(sdl, 0, 200, 0, 255);
+    SDL_RenderFillRects(sdl, ok, n_ok);
+    SDL_SetRenderDrawColor(sdl, 220, 40, 40, 255);
+    SDL_RenderFillRects(sdl, over, n_over);
+
+    /* Budget line */
+    int budget_y = graph_bottom - (int)(PERF_HUD_BUDGET_US * PERF_HUD_GRAPH_H / PERF_HUD_GRAPH_US);
+    SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
+    sdl2_draw_line(sdl, x, budget_y, x + PERF_HUD_HISTORY * PERF_HUD_BAR_W - 1, budget_y);
+}
+
 void game_render_frame(const game_ctx_t *ctx)
 {
+    TRACE_BEGIN(render_frame);
+    game_render_compose(ctx);
+    game_render_present(ctx);
+    TRACE_END(render_frame);
+}
+
+void game_render_compose(const game_ctx_t *ctx)
+{
+    TRACE_BEGIN(render_background);
     sdl2_renderer_clear(ctx->renderer);
 
     /* Main window background (dark texture tiles across entire window) */
     render_main_background(ctx);
+    TRACE_END(render_background);
 
+    TRACE_BEGIN(render_mode);
     sdl2_state_mode_t mode = sdl2_state_current(ctx->state);
 
     switch (mode)
@@ -1361,7 +1593,6 @@ void game_render_frame(const game_ctx_t *ctx)
             game_render_demo(ctx);
             break;
         case SDL2ST_PREVIEW:
-            game_render_background(ctx);
             game_render_preview(ctx);
             break;
         case SDL2ST_KEYS:
@@ -1391,13 +1622,12 @@ void game_render_frame(const game_ctx_t *ctx)
                     break;
                 case SDL2ST_GAME:
                 case SDL2ST_PAUSE:
-                    game_render_background(ctx);
+                    game_render_backdrop(ctx, level_tile(ctx), level_border(ctx), false);
                     game_render_playfield(ctx);
                     /* BorderGlow is attract/menu-only in the original
                      * (original/sfx.c); handleGameMode never calls it, so
                      * gameplay under the dialogue overlay shows the static
-                     * red/green border drawn by game_render_playfield()
-                     * (original/special.c:141,146). */
+                     * red/green border (original/special.c:141,146). */
                     game_render_eyedude(ctx);
                     game_render_deveyes(ctx);
                     break;
@@ -1411,7 +1641,6 @@ void game_render_frame(const game_ctx_t *ctx)
                     game_render_demo(ctx);
                     break;
                 case SDL2ST_PREVIEW:
-                    game_render_background(ctx);
                     game_render_preview(ctx);
                     break;
                 case SDL2ST_KEYS:
@@ -1435,19 +1664,25 @@ void game_render_frame(const game_ctx_t *ctx)
 
         case SDL2ST_GAME:
         case SDL2ST_PAUSE:
-            /* Play area background (level-specific tile) */
-            game_render_background(ctx);
-            /* Playfield border + blocks + paddle + balls + bullets (clipped) */
+        {
+            /* Play area background (level-specific tile) + static border */
+            TRACE_BEGIN(render_backdrop);
+            game_render_backdrop(ctx, level_tile(ctx), level_border(ctx), false);
+            TRACE_END(render_backdrop);
+            /* Blocks + paddle + balls + bullets (clipped) */
+            TRACE_BEGIN(render_playfield);
             game_render_playfield(ctx);
+            TRACE_END(render_playfield);
             /* BorderGlow is attract/menu-only in the original
              * (original/sfx.c); handleGameMode never calls it, so gameplay
              * shows the static red/green border drawn by
-             * game_render_playfield() above (original/special.c:141,146),
+             * game_render_backdrop() above (original/special.c:141,146),
              * matching the original's unanimated playWindow border. */
             /* EyeDude character (inside play area, after clip removed) */
             game_render_eyedude(ctx);
             /* Devil eyes blink animation */
             game_render_deveyes(ctx);
+            TRACE_BEGIN(render_hud);
             /* Score and status */
             game_render_score(ctx);
             /* Lives and level */
@@ -1457,7 +1692,9 @@ void game_render_frame(const game_ctx_t *ctx)
             game_render_timer(ctx);
             /* Specials panel */
             game_render_specials(ctx);
+            TRACE_END(render_hud);
             break;
+        }
 
         case SDL2ST_EDIT:
             /* Editor: show grid background + blocks + palette.
@@ -1467,9 +1704,8 @@ void game_render_frame(const game_ctx_t *ctx)
              * over the grid lines in occupied cells; the grid is visible
              * only in empty cells, matching the original.  Gated off
              * during play-test per editor.c:210-211. */
-            game_render_background(ctx);
-            if (editor_system_get_state(ctx->editor) != EDITOR_STATE_TEST)
-                game_render_editor_grid(ctx);
+            game_render_backdrop(ctx, level_tile(ctx), level_border(ctx),
+                                 editor_system_get_state(ctx->editor) != EDITOR_STATE_TEST);
             game_render_playfield(ctx);
             game_render_editor_palette(ctx);
             break;
@@ -1477,6 +1713,7 @@ void game_render_frame(const game_ctx_t *ctx)
         default:
             break;
     }
+    TRACE_END(render_mode);
 
     /* Outer shell: HUD elements shared by all attract modes.
      * Matches the original's always-mapped X11 sub-windows
@@ -1490,6 +1727,7 @@ void game_render_frame(const game_ctx_t *ctx)
         effective == SDL2ST_PREVIEW || effective == SDL2ST_KEYS || effective == SDL2ST_KEYSEDIT ||
         effective == SDL2ST_HIGHSCORE || effective == SDL2ST_BONUS || effective == SDL2ST_EDIT)
     {
+        TRACE_BEGIN(render_hud);
         game_render_score(ctx);
         game_render_lives(ctx);
         game_render_messages(ctx);
@@ -1498,7 +1736,26 @@ void game_render_frame(const game_ctx_t *ctx)
 
         if (effective == SDL2ST_INTRO || effective == SDL2ST_KEYS)
             game_render_deveyes(ctx);
+        TRACE_END(render_hud);
     }
 
+    /* Performance HUD last, over everything.  Its own draws are dropped
+     * from the counts so they measure the game alone. */
+    sdl2_draw_stats_t draws;
+    sdl2_draw_take_stats(&draws);
+    if (perf_hud_is_visible(ctx->perf_hud))
+    {
+        perf_hud_add_draws(ctx->perf_hud, draws.draw_calls, draws.texture_switches);
+        render_perf_hud(ctx);
+        sdl2_draw_take_stats(NULL);
+    }
+}
+
+void game_render_present(const game_ctx_t *ctx)
+{
+    TRACE_BEGIN(present);
     sdl2_renderer_present(ctx->renderer);
+    TRACE_END(present);
+    /* Lazy textures drawn this frame may now be evicted (ADR-099). */
+    sdl2_texture_next_frame(ctx->texture);
 }
@@ -26,6 +26,7 @@
 #include "level_system.h"
 #include "presents_system.h"
 #include "score_system.h"
+#include "sdl2_draw.h"
 #include "sdl2_font.h"
 #include "sdl2_renderer.h"
 #include "sdl2_state.h"
@@ -43,54 +44,20 @@
  * Helper: render a sparkle (star) frame at a position
  * ========================================================================= */
 
-/* Shared play-area frame: stone background tile + border.
- * When glow is true, uses game_render_border_glow (SFX system state).
- * When false, draws a static green border. */
+/* Shared play-area frame: stone background tile + border, both from the
+ * cached backdrop (ADR-088).  When glow is true, the border is drawn on
+ * top by game_render_border_glow (SFX system state).  When false, the
+ * backdrop carries a static green border. */
 static void render_play_area_frame(const game_ctx_t *ctx, bool glow)
 {
-    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
-    sdl2_texture_info_t bg;
-    if (sdl2_texture_get(ctx->texture, SPR_BGRND_MAIN, &bg) == SDL2T_OK && bg.width > 0 &&
-        bg.height > 0)
-    {
-        int tw = bg.width;
-        int th = bg.height;
-        for (int ty = PLAY_AREA_Y; ty < PLAY_AREA_Y + PLAY_AREA_H; ty += th)
-        {
-            for (int tx = PLAY_AREA_X; tx < PLAY_AREA_X + PLAY_AREA_W; tx += tw)
-            {
-                int dw = tw;
-                int dh = th;
-                if (tx + dw > PLAY_AREA_X + PLAY_AREA_W)
-                    dw = PLAY_AREA_X + PLAY_AREA_W - tx;
-                if (ty + dh > PLAY_AREA_Y + PLAY_AREA_H)
-                    dh = PLAY_AREA_Y + PLAY_AREA_H - ty;
-                SDL_Rect src = {0, 0, dw, dh};
-                SDL_Rect dst = {tx, ty, dw, dh};
-                SDL_RenderCopy(sdl, bg.texture, &src, &dst);
-            }
-        }
-    }
-
     if (glow)
     {
+        game_render_backdrop(ctx, SPRITE_BGRND_MAIN, GAME_BORDER_NONE, false);
         game_render_border_glow(ctx);
     }
     else
     {
-        SDL_SetRenderDrawColor(sdl, 0, 200, 0, 255);
-        int bx = PLAY_AREA_X - 2;
-        int by = PLAY_AREA_Y - 2;
-        int bw = PLAY_AREA_W + 4;
-        int bh = PLAY_AREA_H + 4;
-        SDL_Rect top = {bx, by, bw, 2};
-        SDL_Rect bottom = {bx, by + bh - 2, bw, 2};
-        SDL_Rect left = {bx, by, 2, bh};
-        SDL_Rect right = {bx + bw - 2, by, 2, bh};
-        SDL_RenderFillRect(sdl, &top);
-        SDL_RenderFillRect(sdl, &bottom);
-        SDL_RenderFillRect(sdl, &left);
-        SDL_RenderFillRect(sdl, &right);
+        game_render_backdrop(ctx, SPRITE_BGRND_MAIN, GAME_BORDER_GREEN, false);
     }
 }
 
@@ -99,14 +66,14 @@ static void render_sparkle(const game_ctx_t *ctx, int x, int y, int frame_index)
     if (frame_index < 1 || frame_index > 11)
         return;
 
-    const char *key = sprite_star_key(frame_index);
+    sprite_id_t sprite = sprite_star_id(frame_index);
     sdl2_texture_info_t tex;
-    if (sdl2_texture_get(ctx->texture, key, &tex) != SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, sprite, &tex) != SDL2T_OK)
         return;
 
     SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
     SDL_Rect dst = {x, y, tex.width, tex.height};
-    SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
 }
 
 /* =========================================================================
@@ -147,15 +114,15 @@ void game_render_presents(const game_ctx_t *ctx)
         if (fi.flag_x > 0 || fi.flag_y > 0)
         {
             sdl2_texture_info_t tex;
-            if (sdl2_texture_get(ctx->texture, SPR_PRESENTS_FLAG, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_PRESENTS_FLAG, &tex) == SDL2T_OK)
             {
                 SDL_Rect dst = {fi.flag_x, fi.flag_y, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
             }
-            if (sdl2_texture_get(ctx->texture, SPR_PRESENTS_EARTH, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_PRESENTS_EARTH, &tex) == SDL2T_OK)
             {
                 SDL_Rect dst = {fi.earth_x, fi.earth_y, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
             }
 
             SDL_Color white = {255, 255, 255, 255};
@@ -178,26 +145,26 @@ void game_render_presents(const game_ctx_t *ctx)
 
         if (credits_stage == 1 || credits_stage == 2)
         {
-            if (sdl2_texture_get(ctx->texture, SPR_PRESENTS_JUSTIN, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_PRESENTS_JUSTIN, &tex) == SDL2T_OK)
             {
                 SDL_Rect dst = {140, 530, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
             }
         }
         if (credits_stage == 2)
         {
-            if (sdl2_texture_get(ctx->texture, SPR_PRESENTS_KIBELL, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_PRESENTS_KIBELL, &tex) == SDL2T_OK)
             {
                 SDL_Rect dst = {152, 584, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
             }
         }
         if (credits_stage == 3)
         {
-            if (sdl2_texture_get(ctx->texture, SPR_PRESENTS, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_PRESENTS, &tex) == SDL2T_OK)
             {
                 SDL_Rect dst = {77, 562, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
             }
         }
     }
@@ -208,17 +175,18 @@ void game_render_presents(const game_ctx_t *ctx)
         presents_letter_info_t li;
         if (presents_system_get_letter_info(ctx->presents, &li))
         {
-            static const char *const letter_keys[] = {SPR_TITLE_X, SPR_TITLE_B, SPR_TITLE_O,
-                                                      SPR_TITLE_I, SPR_TITLE_N, SPR_TITLE_G};
+            static const sprite_id_t letter_sprites[] = {SPRITE_TITLE_X, SPRITE_TITLE_B,
+                                                         SPRITE_TITLE_O, SPRITE_TITLE_I,
+                                                         SPRITE_TITLE_N, SPRITE_TITLE_G};
             static const int letter_widths[] = {71, 73, 83, 41, 85, 88};
             int lx = 40;
             for (int i = 0; i <= li.letter_index && i < 6; i++)
             {
                 sdl2_texture_info_t tex;
-                if (sdl2_texture_get(ctx->texture, letter_keys[i], &tex) == SDL2T_OK)
+                if (sdl2_texture_get_id(ctx->texture, letter_sprites[i], &tex) == SDL2T_OK)
                 {
                     SDL_Rect dst = {lx, 220, tex.width, tex.height};
-                    SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
                 }
                 lx += 10 + letter_widths[i];
             }
@@ -230,12 +198,12 @@ void game_render_presents(const game_ctx_t *ctx)
         if (presents_system_get_ii_info(ctx->presents, &ii))
         {
             sdl2_texture_info_t tex;
-            if (sdl2_texture_get(ctx->texture, SPR_TITLE_I, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_TITLE_I, &tex) == SDL2T_OK)
             {
                 SDL_Rect d1 = {ii.i1_x, ii.y, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &d1);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &d1);
                 SDL_Rect d2 = {ii.i2_x, ii.y, tex.width, tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &d2);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &d2);
             }
         }
     }
@@ -285,13 +253,13 @@ void game_render_presents(const game_ctx_t *ctx)
             SDL_Rect top_rect = {0, 0, PRESENTS_TOTAL_WIDTH, wi.top_y};
             SDL_Rect bot_rect = {0, wi.bottom_y, PRESENTS_TOTAL_WIDTH,
                                  PRESENTS_TOTAL_HEIGHT - wi.bottom_y};
-            SDL_RenderFillRect(sdl, &top_rect);
-            SDL_RenderFillRect(sdl, &bot_rect);
+            sdl2_draw_fill_rect(sdl, &top_rect);
+            sdl2_draw_fill_rect(sdl, &bot_rect);
 
             /* Red lines at the wipe edges per original/presents.c:529-532 */
             SDL_SetRenderDrawColor(sdl, 255, 0, 0, 255);
-            SDL_RenderDrawLine(sdl, 2, wi.top_y, PRESENTS_TOTAL_WIDTH - 2, wi.top_y);
-            SDL_RenderDrawLine(sdl, 2, wi.bottom_y - 1, PRESENTS_TOTAL_WIDTH - 2, wi.bottom_y - 1);
+            sdl2_draw_line(sdl, 2, wi.top_y, PRESENTS_TOTAL_WIDTH - 2, wi.top_y);
+            sdl2_draw_line(sdl, 2, wi.bottom_y - 1, PRESENTS_TOTAL_WIDTH - 2, wi.bottom_y - 1);
         }
     }
 }
@@ -314,50 +282,50 @@ void game_render_intro(const game_ctx_t *ctx)
     if (state >= INTRO_STATE_TITLE)
     {
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, SPR_TITLE_BIG, &tex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_TITLE_BIG, &tex) == SDL2T_OK)
         {
             int tx = PLAY_AREA_X + (PLAY_AREA_W - tex.width) / 2;
             SDL_Rect dst = {tx, PLAY_AREA_Y + 10, tex.width, tex.height};
-            SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
         }
     }
 
     /* Block descriptions table.  Each entry's .type is an
      * intro_block_type_t enum (0..21), NOT a block_types.h constant.
-     * The mapping table below translates to the correct sprite key.
+     * The mapping table below translates to the correct sprite.
      * PADDLE and BULLET_ITEM are not block types and get their own
-     * sprite keys directly. */
+     * sprites directly. */
     if (state >= INTRO_STATE_BLOCKS)
     {
-        /* Map INTRO_BLK_* → sprite key.  Order matches the
+        /* Map INTRO_BLK_* → sprite.  Order matches the
          * intro_block_type_t enum in include/intro_system.h. */
-        static const char *const intro_sprite_keys[] = {
-            SPR_BLOCK_RED,        /* INTRO_BLK_RED         → RED_BLK */
-            SPR_BLOCK_ROAMER,     /* INTRO_BLK_ROAMER      → ROAMER_BLK */
-            SPR_BLOCK_PAD_EXPAND, /* INTRO_BLK_PAD_EXPAND  → PAD_EXPAND_BLK */
-            SPR_BLOCK_X2_1,       /* INTRO_BLK_BONUSX2     → BONUSX2_BLK */
-            SPR_BLOCK_LOTSAMMO,   /* INTRO_BLK_MAXAMMO     → MAXAMMO_BLK */
-            SPR_BLOCK_GREEN,      /* INTRO_BLK_DROP        → DROP_BLK */
-            SPR_BLOCK_YELLOW,     /* INTRO_BLK_BULLET      → BULLET_BLK */
-            SPR_BLOCK_HYPERSPACE, /* INTRO_BLK_HYPERSPACE  → HYPERSPACE_BLK */
-            SPR_BLOCK_REVERSE,    /* INTRO_BLK_REVERSE     → REVERSE_BLK */
-            SPR_BLOCK_MACHGUN,    /* INTRO_BLK_MGUN        → MGUN_BLK */
-            SPR_BLOCK_MULTIBALL,  /* INTRO_BLK_MULTIBALL   → MULTIBALL_BLK */
-            SPR_BLOCK_BONUS_1,    /* INTRO_BLK_BONUS       → BONUS_BLK */
-            SPR_BLOCK_COUNTER_5,  /* INTRO_BLK_COUNTER     → COUNTER_BLK (slide=5) */
-            SPR_BLOCK_CLOCK,      /* INTRO_BLK_TIMER       → TIMER_BLK */
-            SPR_BLOCK_BLACK,      /* INTRO_BLK_BLACK       → BLACK_BLK */
-            SPR_BLOCK_BOMB,       /* INTRO_BLK_BOMB        → BOMB_BLK */
-            SPR_PADDLE_SMALL,     /* INTRO_BLK_PADDLE      → paddle sprite */
-            SPR_BULLET,           /* INTRO_BLK_BULLET_ITEM → bullet sprite */
-            SPR_BLOCK_DEATH_1,    /* INTRO_BLK_DEATH       → DEATH_BLK */
-            SPR_BLOCK_EXTRABALL,  /* INTRO_BLK_EXTRABALL   → EXTRABALL_BLK */
-            SPR_BLOCK_WALLOFF,    /* INTRO_BLK_WALLOFF     → WALLOFF_BLK */
-            SPR_BLOCK_STICKY,     /* INTRO_BLK_STICKY      → STICKY_BLK */
+        static const sprite_id_t intro_sprites[] = {
+            SPRITE_BLOCK_RED,        /* INTRO_BLK_RED         → RED_BLK */
+            SPRITE_BLOCK_ROAMER,     /* INTRO_BLK_ROAMER      → ROAMER_BLK */
+            SPRITE_BLOCK_PAD_EXPAND, /* INTRO_BLK_PAD_EXPAND  → PAD_EXPAND_BLK */
+            SPRITE_BLOCK_X2_1,       /* INTRO_BLK_BONUSX2     → BONUSX2_BLK */
+            SPRITE_BLOCK_LOTSAMMO,   /* INTRO_BLK_MAXAMMO     → MAXAMMO_BLK */
+            SPRITE_BLOCK_GREEN,      /* INTRO_BLK_DROP        → DROP_BLK */
+            SPRITE_BLOCK_YELLOW,     /* INTRO_BLK_BULLET      → BULLET_BLK */
+            SPRITE_BLOCK_HYPERSPACE, /* INTRO_BLK_HYPERSPACE  → HYPERSPACE_BLK */
+            SPRITE_BLOCK_REVERSE,    /* INTRO_BLK_REVERSE     → REVERSE_BLK */
+            SPRITE_BLOCK_MACHGUN,    /* INTRO_BLK_MGUN        → MGUN_BLK */
+            SPRITE_BLOCK_MULTIBALL,  /* INTRO_BLK_MULTIBALL   → MULTIBALL_BLK */
+            SPRITE_BLOCK_BONUS_1,    /* INTRO_BLK_BONUS       → BONUS_BLK */
+            SPRITE_BLOCK_COUNTER_5,  /* INTRO_BLK_COUNTER     → COUNTER_BLK (slide=5) */
+            SPRITE_BLOCK_CLOCK,      /* INTRO_BLK_TIMER       → TIMER_BLK */
+            SPRITE_BLOCK_BLACK,      /* INTRO_BLK_BLACK       → BLACK_BLK */
+            SPRITE_BLOCK_BOMB,       /* INTRO_BLK_BOMB        → BOMB_BLK */
+            SPRITE_PADDLE_SMALL,     /* INTRO_BLK_PADDLE      → paddle sprite */
+            SPRITE_BULLET,           /* INTRO_BLK_BULLET_ITEM → bullet sprite */
+            SPRITE_BLOCK_DEATH_1,    /* INTRO_BLK_DEATH       → DEATH_BLK */
+            SPRITE_BLOCK_EXTRABALL,  /* INTRO_BLK_EXTRABALL   → EXTRABALL_BLK */
+            SPRITE_BLOCK_WALLOFF,    /* INTRO_BLK_WALLOFF     → WALLOFF_BLK */
+            SPRITE_BLOCK_STICKY,     /* INTRO_BLK_STICKY      → STICKY_BLK */
         };
-        _Static_assert(sizeof(intro_sprite_keys) / sizeof(intro_sprite_keys[0]) ==
+        _Static_assert(sizeof(intro_sprites) / sizeof(intro_sprites[0]) ==
                            INTRO_BLOCK_TOTAL,
-                       "intro_sprite_keys must match intro_block_type_t enum count");
+                       "intro_sprites must match intro_block_type_t enum count");
 
         const intro_block_entry_t *entries = NULL;
         int count = intro_system_get_block_table(ctx->intro, &entries);
@@ -370,21 +338,21 @@ void game_render_intro(const game_ctx_t *ctx)
         {
             /* Draw block sprite using the corrected mapping. */
             int type_idx = (int)entries[i].type;
-            const char *key = NULL;
+            sprite_id_t sprite = SPRITE_NONE;
             if (type_idx >= 0 &&
-                type_idx < (int)(sizeof(intro_sprite_keys) / sizeof(intro_sprite_keys[0])))
+                type_idx < (int)(sizeof(intro_sprites) / sizeof(intro_sprites[0])))
             {
-                key = intro_sprite_keys[type_idx];
+                sprite = intro_sprites[type_idx];
             }
-            if (key)
+            if (sprite != SPRITE_NONE)
             {
                 sdl2_texture_info_t tex;
-                if (sdl2_texture_get(ctx->texture, key, &tex) == SDL2T_OK)
+                if (sdl2_texture_get_id(ctx->texture, sprite, &tex) == SDL2T_OK)
                 {
                     SDL_Rect dst = {PLAY_AREA_X + entries[i].x + entries[i].x_adjust,
                                     PLAY_AREA_Y + entries[i].y + entries[i].y_adjust, tex.width,
                                     tex.height};
-                    SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                    sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
                 }
             }
 
@@ -435,11 +403,11 @@ void game_render_instruct(const game_ctx_t *ctx)
     if (state >= INTRO_STATE_TITLE)
     {
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, SPR_TITLE_BIG, &tex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_TITLE_BIG, &tex) == SDL2T_OK)
         {
             int tx = PLAY_AREA_X + (PLAY_AREA_W - tex.width) / 2;
             SDL_Rect dst = {tx, PLAY_AREA_Y + 10, tex.width, tex.height};
-            SDL_RenderCopy(sdl2_renderer_get(ctx->renderer), tex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl2_renderer_get(ctx->renderer), tex.texture, &tex.rect, &dst);
         }
     }
 
@@ -512,11 +480,11 @@ void game_render_demo(const game_ctx_t *ctx)
     if (state >= DEMO_STATE_TITLE)
     {
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, SPR_TITLE_BIG, &tex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_TITLE_BIG, &tex) == SDL2T_OK)
         {
             int tx = PLAY_AREA_X + (PLAY_AREA_W - tex.width) / 2;
             SDL_Rect dst = {tx, PLAY_AREA_Y + 10, tex.width, tex.height};
-            SDL_RenderCopy(sdl2_renderer_get(ctx->renderer), tex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl2_renderer_get(ctx->renderer), tex.texture, &tex.rect, &dst);
         }
     }
 
@@ -531,23 +499,23 @@ void game_render_demo(const game_ctx_t *ctx)
         int count = demo_system_get_ball_trail(ctx->demo, &trail);
         for (int i = 0; i < count; i++)
         {
-            const char *key = sprite_ball_key(trail[i].frame_index);
+            sprite_id_t sprite = sprite_ball_id(trail[i].frame_index);
             sdl2_texture_info_t tex;
-            if (sdl2_texture_get(ctx->texture, key, &tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, sprite, &tex) == SDL2T_OK)
             {
                 SDL_Rect dst = {PLAY_AREA_X + trail[i].x, PLAY_AREA_Y + trail[i].y, tex.width,
                                 tex.height};
-                SDL_RenderCopy(sdl, tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, tex.texture, &tex.rect, &dst);
             }
         }
 
         /* Half-disintegrated block at (col=2, row=12) per original/demo.c:173-176 */
-        const char *exkey = sprite_block_explode_key(YELLOW_BLK, 1);
+        sprite_id_t explode_sprite = sprite_block_explode_id(YELLOW_BLK, 1);
         sdl2_texture_info_t etex;
-        if (sdl2_texture_get(ctx->texture, exkey, &etex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, explode_sprite, &etex) == SDL2T_OK)
         {
             SDL_Rect dst = {PLAY_AREA_X + 110, PLAY_AREA_Y + 384, etex.width, etex.height};
-            SDL_RenderCopy(sdl, etex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, etex.texture, &etex.rect, &dst);
         }
 
         /* Paddle + left arrow per original/demo.c:178-182 */
@@ -555,17 +523,17 @@ void game_render_demo(const game_ctx_t *ctx)
         int py = PLAY_AREA_Y + PLAY_AREA_H - 90;
 
         sdl2_texture_info_t ptex;
-        if (sdl2_texture_get(ctx->texture, SPR_PADDLE_HUGE, &ptex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_PADDLE_HUGE, &ptex) == SDL2T_OK)
         {
             SDL_Rect dst = {px - 35, py, ptex.width, ptex.height};
-            SDL_RenderCopy(sdl, ptex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, ptex.texture, &ptex.rect, &dst);
         }
 
         sdl2_texture_info_t atex;
-        if (sdl2_texture_get(ctx->texture, SPR_LEFT_ARROW, &atex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_LEFT_ARROW, &atex) == SDL2T_OK)
         {
             SDL_Rect dst = {px - 75, py - 1, atex.width, atex.height};
-            SDL_RenderCopy(sdl, atex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, atex.texture, &atex.rect, &dst);
         }
     }
 
@@ -610,58 +578,20 @@ void game_render_preview(const game_ctx_t *ctx)
     if (state == DEMO_STATE_NONE)
         return;
 
-    SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
-
-    /* Background tile — original/preview.c:118 cycles backgrounds 2-5 */
+    /* Background tile — original/preview.c:118 cycles backgrounds 2-5.
+     * Red border — original/preview.c uses red XSetWindowBorder; the
+     * sparkle phase swaps it for the glow instead. */
     int level = demo_system_get_preview_level(ctx->demo);
     int bgrnd = (level % 4) + 2;
-    const char *bg_key = sprite_background_key(bgrnd);
-    sdl2_texture_info_t bg;
-    if (sdl2_texture_get(ctx->texture, bg_key, &bg) == SDL2T_OK && bg.width > 0 && bg.height > 0)
-    {
-        for (int ty = PLAY_AREA_Y; ty < PLAY_AREA_Y + PLAY_AREA_H; ty += bg.height)
-        {
-            for (int tx = PLAY_AREA_X; tx < PLAY_AREA_X + PLAY_AREA_W; tx += bg.width)
-            {
-                int dw = bg.width;
-                int dh = bg.height;
-                if (tx + dw > PLAY_AREA_X + PLAY_AREA_W)
-                    dw = PLAY_AREA_X + PLAY_AREA_W - tx;
-                if (ty + dh > PLAY_AREA_Y + PLAY_AREA_H)
-                    dh = PLAY_AREA_Y + PLAY_AREA_H - ty;
-                SDL_Rect src = {0, 0, dw, dh};
-                SDL_Rect dst = {tx, ty, dw, dh};
-                SDL_RenderCopy(sdl, bg.texture, &src, &dst);
-            }
-        }
-    }
+    game_border_t border = state == DEMO_STATE_SPARKLE ? GAME_BORDER_NONE : GAME_BORDER_RED;
+    game_render_backdrop(ctx, sprite_background_id(bgrnd), border, false);
+    if (state == DEMO_STATE_SPARKLE)
+        game_render_border_glow(ctx);
 
     /* Blocks on top of background — original/preview.c:130 */
     if (state >= DEMO_STATE_BLOCKS)
         game_render_blocks(ctx);
 
-    /* Red border — original/preview.c uses red XSetWindowBorder */
-    if (state == DEMO_STATE_SPARKLE)
-    {
-        game_render_border_glow(ctx);
-    }
-    else
-    {
-        SDL_SetRenderDrawColor(sdl, 200, 0, 0, 255);
-        int bx = PLAY_AREA_X - 2;
-        int by = PLAY_AREA_Y - 2;
-        int bw = PLAY_AREA_W + 4;
-        int bh = PLAY_AREA_H + 4;
-        SDL_Rect top = {bx, by, bw, 2};
-        SDL_Rect bottom = {bx, by + bh - 2, bw, 2};
-        SDL_Rect left = {bx, by, 2, bh};
-        SDL_Rect right = {bx + bw - 2, by, 2, bh};
-        SDL_RenderFillRect(sdl, &top);
-        SDL_RenderFillRect(sdl, &bottom);
-        SDL_RenderFillRect(sdl, &left);
-        SDL_RenderFillRect(sdl, &right);
-    }
-
     /* Level name at bottom — original/preview.c:133-134 */
     const char *level_title = level_system_get_title(ctx->level);
     if (level_title && level_title[0] != '\0')
@@ -705,11 +635,11 @@ void game_render_keys(const game_ctx_t *ctx)
     if (state >= KEYS_STATE_TITLE)
     {
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, SPR_TITLE_BIG, &tex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_TITLE_BIG, &tex) == SDL2T_OK)
         {
             int tx = PLAY_AREA_X + (PLAY_AREA_W - tex.width) / 2;
             SDL_Rect dst = {tx, PLAY_AREA_Y + 10, tex.width, tex.height};
-            SDL_RenderCopy(sdl2_renderer_get(ctx->renderer), tex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl2_renderer_get(ctx->renderer), tex.texture, &tex.rect, &dst);
         }
     }
 
@@ -728,10 +658,10 @@ void game_render_keys(const game_ctx_t *ctx)
         /* Horizontal separator line per original/keys.c:147-148 */
         int line_y = PLAY_AREA_Y + 160;
         SDL_SetRenderDrawColor(sdl, 0, 0, 0, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 32, line_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28,
-                           line_y + 2);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 32, line_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28,
+                       line_y + 2);
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 30, line_y, PLAY_AREA_X + PLAY_AREA_W - 30, line_y);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 30, line_y, PLAY_AREA_X + PLAY_AREA_W - 30, line_y);
 
         /* Mouse sprite + arrows + paddle labels per original/keys.c:151-162.
          * mouse_y already includes PLAY_AREA_Y via line_y. */
@@ -739,26 +669,26 @@ void game_render_keys(const game_ctx_t *ctx)
         int cx = PLAY_AREA_X + PLAY_AREA_W / 2;
 
         sdl2_texture_info_t mtex;
-        if (sdl2_texture_get(ctx->texture, SPR_MOUSE, &mtex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_MOUSE, &mtex) == SDL2T_OK)
         {
             SDL_Rect dst = {cx - 17, mouse_y, mtex.width, mtex.height};
-            SDL_RenderCopy(sdl, mtex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, mtex.texture, &mtex.rect, &dst);
         }
 
         sdl2_texture_info_t latex;
-        if (sdl2_texture_get(ctx->texture, SPR_LEFT_ARROW, &latex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_LEFT_ARROW, &latex) == SDL2T_OK)
         {
             SDL_Rect dst = {cx - 17 - 10 - 35, mouse_y + 28, latex.width, latex.height};
-            SDL_RenderCopy(sdl, latex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, latex.texture, &latex.rect, &dst);
         }
         sdl2_font_draw_shadow(ctx->font, SDL2F_FONT_TEXT, "Paddle left",
                               cx - 17 - 10 - 35 - 40 - 60, mouse_y + 28, green);
 
         sdl2_texture_info_t ratex;
-        if (sdl2_texture_get(ctx->texture, SPR_RIGHT_ARROW, &ratex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_RIGHT_ARROW, &ratex) == SDL2T_OK)
         {
             SDL_Rect dst = {cx + 17 + 10, mouse_y + 28, ratex.width, ratex.height};
-            SDL_RenderCopy(sdl, ratex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, ratex.texture, &ratex.rect, &dst);
         }
         sdl2_font_draw_shadow(ctx->font, SDL2F_FONT_TEXT, "Paddle right", cx + 17 + 10 + 40,
                               mouse_y + 28, green);
@@ -779,10 +709,9 @@ void game_render_keys(const game_ctx_t *ctx)
         /* Bottom separator line per original/keys.c:249-250 */
         int bot_y = PLAY_AREA_Y + 250 + 10 * 27 + 10;
         SDL_SetRenderDrawColor(sdl, 0, 0, 0, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 32, bot_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28,
-                           bot_y + 2);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 32, bot_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28, bot_y + 2);
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 30, bot_y, PLAY_AREA_X + PLAY_AREA_W - 30, bot_y);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 30, bot_y, PLAY_AREA_X + PLAY_AREA_W - 30, bot_y);
 
         /* "Insert coin" per original/keys.c:252-253 */
         sdl2_font_draw_shadow_centred(ctx->font, SDL2F_FONT_TEXT, "Insert coin to start the game",
@@ -815,11 +744,11 @@ void game_render_keysedit(const game_ctx_t *ctx)
     if (state >= KEYS_STATE_TITLE)
     {
         sdl2_texture_info_t tex;
-        if (sdl2_texture_get(ctx->texture, SPR_TITLE_BIG, &tex) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_TITLE_BIG, &tex) == SDL2T_OK)
         {
             int tx = PLAY_AREA_X + (PLAY_AREA_W - tex.width) / 2;
             SDL_Rect dst = {tx, PLAY_AREA_Y + 10, tex.width, tex.height};
-            SDL_RenderCopy(sdl2_renderer_get(ctx->renderer), tex.texture, NULL, &dst);
+            sdl2_draw_copy(sdl2_renderer_get(ctx->renderer), tex.texture, &tex.rect, &dst);
         }
     }
 
@@ -836,10 +765,10 @@ void game_render_keysedit(const game_ctx_t *ctx)
         /* Separator line — original/keysedit.c:157 */
         int line_y = PLAY_AREA_Y + 160;
         SDL_SetRenderDrawColor(sdl, 0, 0, 0, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 32, line_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28,
-                           line_y + 2);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 32, line_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28,
+                       line_y + 2);
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 30, line_y, PLAY_AREA_X + PLAY_AREA_W - 30, line_y);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 30, line_y, PLAY_AREA_X + PLAY_AREA_W - 30, line_y);
 
         /* Description text — original/keysedit.c:138-146, alternating greens */
         SDL_Color green_bright = {0, 255, 0, 255};
@@ -875,10 +804,9 @@ void game_render_keysedit(const game_ctx_t *ctx)
         /* Bottom separator — original/keysedit.c:215 */
         int bot_y = start_y + 5 * 30 + 15;
         SDL_SetRenderDrawColor(sdl, 0, 0, 0, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 32, bot_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28,
-                           bot_y + 2);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 32, bot_y + 2, PLAY_AREA_X + PLAY_AREA_W - 28, bot_y + 2);
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 30, bot_y, PLAY_AREA_X + PLAY_AREA_W - 30, bot_y);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 30, bot_y, PLAY_AREA_X + PLAY_AREA_W - 30, bot_y);
 
         /* "Insert coin to start the game" — original/keysedit.c:201-202 */
         SDL_Color tan_clr = {210, 180, 140, 255};
@@ -1003,11 +931,11 @@ void game_render_bonus(const game_ctx_t *ctx)
                                  bonus_system_get_starting_level(ctx->bonus)))
     {
         sdl2_texture_info_t floppy;
-        if (sdl2_texture_get(ctx->texture, SPR_FLOPPY, &floppy) == SDL2T_OK)
+        if (sdl2_texture_get_id(ctx->texture, SPRITE_FLOPPY, &floppy) == SDL2T_OK)
         {
             SDL_Renderer *sdl = sdl2_renderer_get(ctx->renderer);
             SDL_Rect dst = {.x = FLOPPY_X, .y = FLOPPY_Y, .w = floppy.width, .h = floppy.height};
-            SDL_RenderCopy(sdl, floppy.texture, NULL, &dst);
+            sdl2_draw_copy(sdl, floppy.texture, &floppy.rect, &dst);
         }
     }
 
@@ -1072,7 +1000,7 @@ void game_render_bonus(const game_ctx_t *ctx)
              * line positions identical to the original. */
             ypos += text_ascent + GAP * 2;
         }
-        else if (sdl2_texture_get(ctx->texture, SPR_BLOCK_BONUS_1, &coin_tex) == SDL2T_OK)
+        else if (sdl2_texture_get_id(ctx->texture, SPRITE_BLOCK_BONUS_1, &coin_tex) == SDL2T_OK)
         {
             /* Draw only the coins already animated, matching the
              * original's incremental DrawTheBonus per-step pattern
@@ -1092,7 +1020,7 @@ void game_render_bonus(const game_ctx_t *ctx)
                                 .y = ypos,
                                 .w = coin_tex.width,
                                 .h = coin_tex.height};
-                SDL_RenderCopy(sdl, coin_tex.texture, NULL, &dst);
+                sdl2_draw_copy(sdl, coin_tex.texture, &coin_tex.rect, &dst);
             }
             ypos += text_ascent + (GAP * 3) / 2;
         }
@@ -1137,7 +1065,7 @@ void game_render_bonus(const game_ctx_t *ctx)
         else
         {
             sdl2_texture_info_t bullet_tex;
-            if (sdl2_texture_get(ctx->texture, SPR_BULLET, &bullet_tex) == SDL2T_OK)
+            if (sdl2_texture_get_id(ctx->texture, SPRITE_BULLET, &bullet_tex) == SDL2T_OK)
             {
                 /* Draw only the bullets already animated, matching
                  * the original's incremental DrawTheBullet pattern
@@ -1156,7 +1084,7 @@ void game_render_bonus(const game_ctx_t *ctx)
                                     .y = ypos,
                                     .w = bullet_tex.width,
                                     .h = bullet_tex.height};
-                    SDL_RenderCopy(sdl, bullet_tex.texture, NULL, &dst);
+                    sdl2_draw_copy(sdl, bullet_tex.texture, &bullet_tex.rect, &dst);
                 }
             }
         }
@@ -1229,7 +1157,7 @@ void game_render_highscore(const game_ctx_t *ctx)
 
     /* Space background — original/highscore.c:188 BACKGROUND_SPACE */
     sdl2_texture_info_t space_bg;
-    if (sdl2_texture_get(ctx->texture, SPR_BGRND_SPACE, &space_bg) == SDL2T_OK &&
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_BGRND_SPACE, &space_bg) == SDL2T_OK &&
         space_bg.width > 0 && space_bg.height > 0)
     {
         for (int ty = PLAY_AREA_Y; ty < PLAY_AREA_Y + PLAY_AREA_H; ty += space_bg.height)
@@ -1242,21 +1170,21 @@ void game_render_highscore(const game_ctx_t *ctx)
                     dw = PLAY_AREA_X + PLAY_AREA_W - tx;
                 if (ty + dh > PLAY_AREA_Y + PLAY_AREA_H)
                     dh = PLAY_AREA_Y + PLAY_AREA_H - ty;
-                SDL_Rect src = {0, 0, dw, dh};
+                SDL_Rect src = {space_bg.rect.x, space_bg.rect.y, dw, dh};
                 SDL_Rect dst = {tx, ty, dw, dh};
-                SDL_RenderCopy(sdl, space_bg.texture, &src, &dst);
+                sdl2_draw_copy(sdl, space_bg.texture, &src, &dst);
             }
         }
     }
 
     /* Earth globe — original/highscore.c:192-193 */
     sdl2_texture_info_t earth;
-    if (sdl2_texture_get(ctx->texture, SPR_PRESENTS_EARTH, &earth) == SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_PRESENTS_EARTH, &earth) == SDL2T_OK)
     {
         int ex = PLAY_AREA_X + PLAY_AREA_W / 2 - earth.width / 2;
         int ey = PLAY_AREA_Y + PLAY_AREA_H / 2 - earth.height / 2 + 40;
         SDL_Rect dst = {ex, ey, earth.width, earth.height};
-        SDL_RenderCopy(sdl, earth.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, earth.texture, &earth.rect, &dst);
     }
 
     /* Red border — original/highscore.c uses red XSetWindowBorder */
@@ -1275,18 +1203,18 @@ void game_render_highscore(const game_ctx_t *ctx)
         SDL_Rect bottom = {bx, by + bh - 2, bw, 2};
         SDL_Rect left = {bx, by, 2, bh};
         SDL_Rect right = {bx + bw - 2, by, 2, bh};
-        SDL_RenderFillRect(sdl, &top);
-        SDL_RenderFillRect(sdl, &bottom);
-        SDL_RenderFillRect(sdl, &left);
-        SDL_RenderFillRect(sdl, &right);
+        sdl2_draw_fill_rect(sdl, &top);
+        sdl2_draw_fill_rect(sdl, &bottom);
+        sdl2_draw_fill_rect(sdl, &left);
+        sdl2_draw_fill_rect(sdl, &right);
     }
 
     /* "HIGH SCORES" title bitmap — original/highscore.c:191 at (59,20) */
     sdl2_texture_info_t title_tex;
-    if (sdl2_texture_get(ctx->texture, SPR_HIGHSCORE, &title_tex) == SDL2T_OK)
+    if (sdl2_texture_get_id(ctx->texture, SPRITE_HIGHSCORE, &title_tex) == SDL2T_OK)
     {
         SDL_Rect dst = {PLAY_AREA_X + 59 - 35, PLAY_AREA_Y + 20, title_tex.width, title_tex.height};
-        SDL_RenderCopy(sdl, title_tex.texture, NULL, &dst);
+        sdl2_draw_copy(sdl, title_tex.texture, &title_tex.rect, &dst);
     }
 
     SDL_Color white = {255, 255, 255, 255};
@@ -1347,9 +1275,9 @@ void game_render_highscore(const game_ctx_t *ctx)
 
         y += 24;
         SDL_SetRenderDrawColor(sdl, 0, 0, 0, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 22, y + 2, PLAY_AREA_X + PLAY_AREA_W - 18, y + 2);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 22, y + 2, PLAY_AREA_X + PLAY_AREA_W - 18, y + 2);
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 20, y, PLAY_AREA_X + PLAY_AREA_W - 20, y);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 20, y, PLAY_AREA_X + PLAY_AREA_W - 20, y);
         y += 18;
 
         if (!table)
@@ -1438,9 +1366,9 @@ void game_render_highscore(const game_ctx_t *ctx)
 
         /* Bottom separator — original/highscore.c:379-381 */
         SDL_SetRenderDrawColor(sdl, 0, 0, 0, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 22, y + 2, PLAY_AREA_X + PLAY_AREA_W - 18, y + 2);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 22, y + 2, PLAY_AREA_X + PLAY_AREA_W - 18, y + 2);
         SDL_SetRenderDrawColor(sdl, 255, 255, 255, 255);
-        SDL_RenderDrawLine(sdl, PLAY_AREA_X + 20, y, PLAY_AREA_X + PLAY_AREA_W - 20, y);
+        sdl2_draw_line(sdl, PLAY_AREA_X + 20, y, PLAY_AREA_X + PLAY_AREA_W - 20, y);
     }
 
     /* Title sparkle */
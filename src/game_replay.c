@@ -0,0 +1,313 @@
+/*
+ * game_replay.c -- -record / -replay wiring for SDL2-based XBoing.
+ *
+ * Owns the replay_io reader/writer for the session and translates
+ * between replay_frame_t and the live modules (sdl2_input snapshot,
+ * dialogue keystrokes, sdl2_loop tick counts).  See game_replay.h for
+ * the per-frame call order and ADR-078 for the format and its limits.
+ */
+
+#include "game_replay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <SDL2/SDL.h>
+
+#include "replay_io.h"
+#include "score_system.h"
+#include "sdl2_input.h"
+#include "sdl2_loop.h"
+
+/* =========================================================================
+ * Internal state
+ * ========================================================================= */
+
+struct game_replay
+{
+    replay_io_reader_t *in;  /* Non-NULL while playing back */
+    replay_io_writer_t *out; /* Non-NULL while recording */
+    const char *in_path;     /* For messages (argv-owned) */
+    const char *out_path;
+
+    bool fast;     /* -replay-fast: no render, no pacing, exit at end */
+    bool finished; /* -replay-fast recording fully consumed */
+
+    replay_frame_t pending; /* Frame being recorded */
+
+    /* Playback statistics for the end-of-replay summary. */
+    uint64_t frames;
+    uint64_t ticks;
+    Uint64 start_ms;
+
+    /* Normal-speed pacing: wall time the played ticks should have taken. */
+    uint64_t paced_us;
+};
+
+static game_replay_t *replay_get(game_ctx_t *ctx)
+{
+    if (ctx->replay == NULL)
+    {
+        ctx->replay = calloc(1, sizeof(*ctx->replay));
+        if (ctx->replay == NULL)
+        {
+            fprintf(stderr, "xboing: replay: allocation failed\n");
+        }
+    }
+    return ctx->replay;
+}
+
+static void frame_from_snapshot(replay_frame_t *frame, const sdl2_input_snapshot_t *snap)
+{
+    frame->held = snap->held;
+    frame->edge = snap->just_pressed;
+    frame->mouse_x = snap->mouse_x;
+    frame->mouse_y = snap->mouse_y;
+    frame->buttons = snap->mouse_buttons;
+    frame->button_edge = snap->mouse_just_pressed;
+    frame->shift = snap->shift;
+}
+
+static void snapshot_from_frame(sdl2_input_snapshot_t *snap, const replay_frame_t *frame)
+{
+    snap->held = frame->held;
+    snap->just_pressed = frame->edge;
+    snap->mouse_x = frame->mouse_x;
+    snap->mouse_y = frame->mouse_y;
+    snap->mouse_buttons = frame->buttons;
+    snap->mouse_just_pressed = frame->button_edge;
+    snap->shift = frame->shift;
+}
+
+/* Print the key=value summary and stop playing back. */
+static void end_playback(game_ctx_t *ctx, game_replay_t *r, replay_io_status_t st)
+{
+    if (st != REPLAY_IO_END)
+    {
+        fprintf(stderr, "xboing: replay %s: %s after frame %llu\n", r->in_path,
+                replay_io_status_string(st), (unsigned long long)r->frames);
+    }
+
+    double secs = (double)(SDL_GetTicks64() - r->start_ms) / 1000.0;
+    printf("replay=%s frames=%llu ticks=%llu elapsed=%.3fs ticks_per_sec=%.0f score=%lu "
+           "level=%d\n",
+           r->in_path, (unsigned long long)r->frames, (unsigned long long)r->ticks, secs,
+           secs > 0.0 ? (double)r->ticks / secs : 0.0, score_system_get(ctx->score),
+           ctx->level_number);
+    fflush(stdout);
+
+    replay_io_read_close(r->in);
+    r->in = NULL;
+    if (r->fast)
+    {
+        r->finished = true;
+    }
+}
+
+/* =========================================================================
+ * Public API -- Setup
+ * ========================================================================= */
+
+bool game_replay_open_playback(game_ctx_t *ctx, const char *path, bool fast)
+{
+    game_replay_t *r = replay_get(ctx);
+    if (r == NULL)
+    {
+        return false;
+    }
+
+    replay_header_t header;
+    replay_io_status_t st;
+    r->in = replay_io_read_open(path, &header, &st);
+    if (r->in == NULL)
+    {
+        fprintf(stderr, "xboing: -replay %s: %s\n", path, replay_io_status_string(st));
+        return false;
+    }
+    r->in_path = path;
+    r->fast = fast;
+
+    ctx->rng_seed = header.seed;
+    ctx->config.speed = header.speed;
+    ctx->config.start_level = header.start_level;
+    ctx->config.use_keys = header.use_keys;
+    ctx->config.sfx = header.sfx;
+    ctx->level_number = header.start_level;
+    ctx->start_level = header.start_level;
+    ctx->debug_mode = header.debug;
+    return true;
+}
+
+bool game_replay_open_record(game_ctx_t *ctx, const char *path)
+{
+    game_replay_t *r = replay_get(ctx);
+    if (r == NULL)
+    {
+        return false;
+    }
+
+    replay_header_t header = {
+        .seed = ctx->rng_seed,
+        .speed = ctx->config.speed,
+        .start_level = ctx->config.start_level,
+        .use_keys = ctx->config.use_keys,
+        .sfx = ctx->config.sfx,
+        .debug = ctx->debug_mode,
+    };
+    replay_io_status_t st;
+    r->out = replay_io_write_open(path, &header, &st);
+    if (r->out == NULL)
+    {
+        fprintf(stderr, "xboing: -record %s: %s\n", path, replay_io_status_string(st));
+        return false;
+    }
+    r->out_path = path;
+    return true;
+}
+
+/* =========================================================================
+ * Public API -- Queries
+ * ========================================================================= */
+
+bool game_replay_playing(const game_ctx_t *ctx)
+{
+    return ctx->replay != NULL && ctx->replay->in != NULL;
+}
+
+bool game_replay_fast(const game_ctx_t *ctx)
+{
+    return game_replay_playing(ctx) && ctx->replay->fast;
+}
+
+bool game_replay_finished(const game_ctx_t *ctx)
+{
+    return ctx->replay != NULL && ctx->replay->finished;
+}
+
+/* =========================================================================
+ * Public API -- Per-frame hooks
+ * ========================================================================= */
+
+void game_replay_note_dialogue_key(game_ctx_t *ctx, dialogue_key_type_t key, char ch)
+{
+    game_replay_t *r = ctx->replay;
+    if (r == NULL || r->out == NULL || r->pending.key_count >= REPLAY_MAX_KEYS)
+    {
+        return;
+    }
+    r->pending.keys[r->pending.key_count].key = (uint8_t)key;
+    r->pending.keys[r->pending.key_count].ch = ch;
+    r->pending.key_count++;
+}
+
+int game_replay_frame_input(game_ctx_t *ctx)
+{
+    game_replay_t *r = ctx->replay;
+    if (r == NULL)
+    {
+        return GAME_REPLAY_LIVE;
+    }
+
+    sdl2_input_snapshot_t snap;
+
+    if (r->in != NULL)
+    {
+        if (r->frames == 0)
+        {
+            r->start_ms = SDL_GetTicks64();
+        }
+
+        replay_frame_t frame;
+        replay_io_status_t st = replay_io_read_frame(r->in, &frame);
+        if (st == REPLAY_IO_OK)
+        {
+            snapshot_from_frame(&snap, &frame);
+            sdl2_input_apply_snapshot(ctx->input, &snap);
+            if (ctx->dialogue != NULL)
+            {
+                for (int i = 0; i < frame.key_count; i++)
+                {
+                    dialogue_system_key_input(ctx->dialogue,
+                                              (dialogue_key_type_t)frame.keys[i].key,
+                                              frame.keys[i].ch);
+                }
+            }
+
+            /* -record alongside -replay re-records the session as played. */
+            if (r->out != NULL)
+            {
+                r->pending = frame;
+            }
+
+            r->frames++;
+            r->ticks += frame.ticks;
+            return (int)frame.ticks;
+        }
+        end_playback(ctx, r, st);
+    }
+
+    if (r->out != NULL)
+    {
+        sdl2_input_get_snapshot(ctx->input, &snap);
+        frame_from_snapshot(&r->pending, &snap);
+    }
+    return GAME_REPLAY_LIVE;
+}
+
+void game_replay_frame_done(game_ctx_t *ctx, int ticks)
+{
+    game_replay_t *r = ctx->replay;
+    if (r == NULL)
+    {
+        return;
+    }
+
+    if (r->out != NULL)
+    {
+        r->pending.ticks = ticks > 0 ? (uint32_t)ticks : 0;
+        (void)replay_io_write_frame(r->out, &r->pending);
+        r->pending.key_count = 0;
+    }
+
+    /* Hold normal-speed playback to the loop's tick rate.  Frames that
+     * ran no ticks add no time, so they play back as fast as they render.
+     * Turbo scrubbing is unpaced; it keeps the pacing clock at wall time
+     * so leaving turbo resumes at normal speed rather than stalling. */
+    if (r->in != NULL && !r->fast && ticks > 0)
+    {
+        uint64_t wall_us = (SDL_GetTicks64() - r->start_ms) * 1000;
+        if (sdl2_loop_is_turbo(ctx->loop))
+        {
+            r->paced_us = wall_us;
+            return;
+        }
+        r->paced_us += (uint64_t)ticks * sdl2_loop_tick_interval_us(sdl2_loop_get_speed(ctx->loop));
+        if (r->paced_us > wall_us)
+        {
+            SDL_Delay((Uint32)((r->paced_us - wall_us) / 1000));
+        }
+    }
+}
+
+/* =========================================================================
+ * Public API -- Teardown
+ * ========================================================================= */
+
+void game_replay_close(game_ctx_t *ctx)
+{
+    game_replay_t *r = ctx->replay;
+    if (r == NULL)
+    {
+        return;
+    }
+
+    replay_io_read_close(r->in);
+    replay_io_status_t st = replay_io_write_close(r->out);
+    if (r->out != NULL && st != REPLAY_IO_OK)
+    {
+        fprintf(stderr, "xboing: -record %s: %s\n", r->out_path, replay_io_status_string(st));
+    }
+
+    free(r);
+    ctx->replay = NULL;
+}
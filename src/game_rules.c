@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 
+#include "asset_pack.h"
 #include "ball_system.h"
 #include "ball_types.h"
 #include "block_system.h"
@@ -25,252 +26,59 @@
 #include "message_system.h"
 #include "paddle_system.h"
 #include "paths.h"
+#include "rules_logic.h"
 #include "score_system.h"
 #include "sdl2_audio.h"
 #include "sdl2_state.h"
 #include "sfx_system.h"
 #include "special_system.h"
 
-/* Legacy bonus spawning constants */
-#define BONUS_SEED 2000
-/* Bonus/special block lifetime (in frames) before it expires unhit —
- * BLOCK_BONUS_LENGTH (include/block_system.h), citing
- * original/include/blocks.h:73. */
-
 /* =========================================================================
- * Find a random empty cell in the block grid
+ * Level advancement
  * ========================================================================= */
 
-static int find_random_empty_cell(const block_system_t *block, int *out_row, int *out_col)
+/* Find filename in the asset pack, unless XBOING_LEVELS_DIR is set. */
+static bool find_pack_level(const game_ctx_t *ctx, const char *filename, asset_pack_entry_t *out)
 {
-    /* Try random positions up to 100 times.
-     * Row range: 1 to MAX_ROW-7 (rows 1-11) — matches legacy
-     * AddBonusBlock/AddSpecialBlock: r = (rand() % (MAX_ROW - 7)) + 1
-     * This keeps bonus blocks in the upper half, away from the paddle. */
-    for (int attempt = 0; attempt < 100; attempt++)
-    {
-        int row = (rand() % (MAX_ROW - 7)) + 1;
-        int col = rand() % MAX_COL;
-        if (!block_system_is_occupied(block, row, col))
-        {
-            *out_row = row;
-            *out_col = col;
-            return 1;
-        }
-    }
-    return 0; /* Grid too full */
+    if (ctx->assets == NULL || ctx->paths.xboing_levels_dir[0] != '\0')
+        return false;
+
+    char key[ASSET_PACK_MAX_KEY + 1];
+    int n = snprintf(key, sizeof(key), "levels/%s", filename);
+    if (n < 0 || (size_t)n >= sizeof(key))
+        return false;
+    return asset_pack_find(ctx->assets, key, out) == ASSET_PACK_OK;
 }
 
-/* =========================================================================
- * Bonus block spawning — port of main.c:handleGameMode() switch
- * ========================================================================= */
-
-static void try_spawn_bonus(game_ctx_t *ctx, int frame)
+level_system_status_t game_rules_load_level(game_ctx_t *ctx, const char *filename)
 {
-    /* Expire or release the tracked bonus/special cell BEFORE scheduling
-     * or spawning a new one.  Port of HandlePendingSpecials
-     * (original/blocks.c:1167-1186), called once per tick against the
-     * one cell the original tracks via the bonusRow/bonusCol globals. */
-    if (ctx->bonus_block_active)
-    {
-        int row = ctx->bonus_row;
-        int col = ctx->bonus_col;
-
-        if (!block_system_is_occupied(ctx->block, row, col) ||
-            block_system_get_type(ctx->block, row, col) != ctx->bonus_type)
-        {
-            /* Player destroyed or picked it up — bonusBlock is cleared
-             * on finalize/pickup at original/blocks.c:1604, 1622, 1631,
-             * 1838.  The cell itself was already handled by that path;
-             * do not touch the grid here. */
-            ctx->bonus_block_active = false;
-        }
-        else if (frame >= block_system_get_last_frame(ctx->block, row, col))
-        {
-            /* Lifetime elapsed with no hit — original/blocks.c:1173-1184. */
-            block_system_clear(ctx->block, row, col);
-            ctx->bonus_block_active = false;
-        }
-    }
-
-    /* Schedule next bonus if not yet scheduled.  Guarded by
-     * !bonus_block_active (original/main.c:970) so the BONUS_SEED
-     * interval only starts counting once the current special has
-     * cleared — without this guard a spawn's countdown could complete
-     * while a previous special is still on the board. */
-    if (ctx->next_bonus_frame == 0 && !ctx->bonus_block_active)
-    {
-        ctx->next_bonus_frame = frame + (rand() % BONUS_SEED);
-        return;
-    }
-
-    /* Not time yet, or a special is still active (original/main.c:974
-     * `nextBonusFrame <= frame && bonusBlock == False`) */
-    if (ctx->next_bonus_frame == 0 || frame < ctx->next_bonus_frame || ctx->bonus_block_active)
-        return;
+    if (ctx == NULL || filename == NULL)
+        return LEVEL_SYS_ERR_NULL_ARG;
 
-    /* Find an empty cell */
-    int row, col;
-    if (!find_random_empty_cell(ctx->block, &row, &col))
-    {
-        ctx->next_bonus_frame = 0;
-        return;
-    }
+    asset_pack_entry_t e;
+    if (find_pack_level(ctx, filename, &e))
+        return level_system_load_memory(ctx->level, e.data, e.size);
 
-    /* Recorded only when a case below actually places a persistent
-     * bonus/special block — cases 25 (dynamite) and 26 (eyedude) don't
-     * call AddSpecialBlock/AddBonusBlock in the original, so they leave
-     * this unset and bonus_block_active is not raised. */
-    int placed_row = -1;
-    int placed_col = -1;
-    int placed_type = NONE_BLK;
-
-    /* Pick a bonus type — exact probability distribution from legacy */
-    int roll = rand() % 27;
+    char level_path[PATHS_MAX_PATH];
+    if (paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) != PATHS_OK)
+        return LEVEL_SYS_ERR_FILE_NOT_FOUND;
+    return level_system_load_file(ctx->level, level_path);
+}
 
-    if (roll <= 7)
-    {
-        /* Cases 0-7: normal bonus block (8/27 chance) */
-        block_system_add(ctx->block, row, col, BONUS_BLK, 0, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = BONUS_BLK;
-    }
-    else if (roll <= 11)
-    {
-        /* Cases 8-11: x2 bonus (4/27 chance) */
-        if (!special_system_is_active(ctx->special, SPECIAL_X2_BONUS))
-        {
-            block_system_add(ctx->block, row, col, BONUSX2_BLK, 0, frame);
-            placed_row = row;
-            placed_col = col;
-            placed_type = BONUSX2_BLK;
-        }
-    }
-    else if (roll <= 13)
-    {
-        /* Cases 12-13: x4 bonus (2/27 chance) */
-        if (!special_system_is_active(ctx->special, SPECIAL_X4_BONUS))
-        {
-            block_system_add(ctx->block, row, col, BONUSX4_BLK, 0, frame);
-            placed_row = row;
-            placed_col = col;
-            placed_type = BONUSX4_BLK;
-        }
-    }
-    else if (roll <= 15)
-    {
-        /* Cases 14-15: paddle shrink (2/27) */
-        block_system_add(ctx->block, row, col, PAD_SHRINK_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = PAD_SHRINK_BLK;
-    }
-    else if (roll <= 17)
-    {
-        /* Cases 16-17: paddle expand (2/27) */
-        block_system_add(ctx->block, row, col, PAD_EXPAND_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = PAD_EXPAND_BLK;
-    }
-    else if (roll == 18)
-    {
-        /* Case 18: multiball (1/27) */
-        block_system_add(ctx->block, row, col, MULTIBALL_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = MULTIBALL_BLK;
-    }
-    else if (roll == 19)
-    {
-        /* Case 19: reverse (1/27) */
-        block_system_add(ctx->block, row, col, REVERSE_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = REVERSE_BLK;
-    }
-    else if (roll <= 21)
-    {
-        /* Cases 20-21: machine gun (2/27) */
-        block_system_add(ctx->block, row, col, MGUN_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = MGUN_BLK;
-    }
-    else if (roll == 22)
-    {
-        /* Case 22: wall off (1/27) */
-        block_system_add(ctx->block, row, col, WALLOFF_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = WALLOFF_BLK;
-    }
-    else if (roll == 23)
-    {
-        /* Case 23: extra ball (1/27) */
-        block_system_add(ctx->block, row, col, EXTRABALL_BLK, 0, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = EXTRABALL_BLK;
-    }
-    else if (roll == 24)
-    {
-        /* Case 24: death block (1/27) */
-        block_system_add(ctx->block, row, col, DEATH_BLK, 3, frame);
-        placed_row = row;
-        placed_col = col;
-        placed_type = DEATH_BLK;
-    }
-    else if (roll == 25)
-    {
-        /* Case 25: dynamite — clear all blocks of a random color.
-         * Does not add a persistent block (SetExplodeAllType,
-         * original/blocks.c:1072-1113 territory but no AddBonusBlock/
-         * AddSpecialBlock call) — bonus_block_active stays false. */
-        static const int dyn_types[] = {YELLOW_BLK, BLUE_BLK,    RED_BLK,  PURPLE_BLK,
-                                        TAN_BLK,    COUNTER_BLK, GREEN_BLK};
-        int target = dyn_types[rand() % 7];
-        for (int r = 0; r < MAX_ROW; r++)
-        {
-            for (int c = 0; c < MAX_COL; c++)
-            {
-                if (block_system_get_type(ctx->block, r, c) == target)
-                    block_system_clear(ctx->block, r, c);
-            }
-        }
-        /* SetExplodeAllType (original/blocks.c:1001-1113) is silent at
-         * dynamite spawn — bomb@50 plays only for a real BOMB_BLK hit,
-         * via PlaySoundForBlock (original/blocks.c:771-772). */
-    }
-    else
-    {
-        /* Case 26 (final): start eyedude — no persistent block either
-         * (original/main.c:1115-1118 calls ChangeEyeDudeMode, not
-         * AddSpecialBlock). */
-        eyedude_system_set_state(ctx->eyedude, EYEDUDE_STATE_RESET);
-    }
+bool game_rules_level_available(const game_ctx_t *ctx, const char *filename)
+{
+    if (ctx == NULL || filename == NULL)
+        return false;
 
-    if (placed_row >= 0)
-    {
-        /* One-at-a-time gate + finite lifetime — original/blocks.c:
-         * 1075,1079 (AddSpecialBlock) and 1107,1111 (AddBonusBlock) set
-         * bonusBlock=True and lastFrame=frame+BONUS_LENGTH only when a
-         * block was actually placed. */
-        ctx->bonus_block_active = true;
-        ctx->bonus_row = placed_row;
-        ctx->bonus_col = placed_col;
-        ctx->bonus_type = placed_type;
-        block_system_set_last_frame(ctx->block, placed_row, placed_col, frame + BLOCK_BONUS_LENGTH);
-    }
+    asset_pack_entry_t e;
+    if (find_pack_level(ctx, filename, &e))
+        return true;
 
-    ctx->next_bonus_frame = 0;
+    char level_path[PATHS_MAX_PATH];
+    return paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) == PATHS_OK &&
+           access(level_path, R_OK) == 0;
 }
 
-/* =========================================================================
- * Level advancement
- * ========================================================================= */
-
 void game_rules_next_level(game_ctx_t *ctx)
 {
     /* Resolve the next level's file before mutating ctx->level_number
@@ -283,9 +91,7 @@ void game_rules_next_level(game_ctx_t *ctx)
     char filename[32];
     snprintf(filename, sizeof(filename), "level%02d.data", file_num);
 
-    char level_path[PATHS_MAX_PATH];
-    if (paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) != PATHS_OK ||
-        access(level_path, R_OK) != 0)
+    if (!game_rules_level_available(ctx, filename))
     {
         /* Resolve failed or file unreadable — original/level.c calls
          * ShutDown which exits the process.  Modernized: end the game
@@ -309,15 +115,15 @@ void game_rules_next_level(game_ctx_t *ctx)
     gun_system_clear(ctx->gun);
     special_system_turn_off(ctx->special);
 
-    /* Load the level — even after access() probe a parse failure can
+    /* Load the level — even after the availability probe a parse failure can
      * still occur on truncated/corrupt files.  Same end-the-game
      * semantic as the unreadable path: the grid is already cleared,
      * so we must move out of GAME mode to avoid the infinite
      * BONUS-loop game_rules_check would otherwise trigger. */
-    if (level_system_load_file(ctx->level, level_path) != LEVEL_SYS_OK)
+    if (game_rules_load_level(ctx, filename) != LEVEL_SYS_OK)
     {
         fprintf(stderr, "xboing: failed to parse level file %s; ending game on level %d\n",
-                level_path, ctx->level_number);
+                filename, ctx->level_number);
         if (ctx->audio)
             sdl2_audio_play_at_percent(ctx->audio, "game_over", 99);
         message_system_set(ctx->message, "- Level data corrupt -", 0,
@@ -386,20 +192,7 @@ void game_rules_next_level(game_ctx_t *ctx)
 
 void game_rules_ball_died(game_ctx_t *ctx)
 {
-    /* If there are still active balls, do nothing — multiball */
-    if (ball_system_get_active_count(ctx->ball) > 0)
-        return;
-
-    /* No balls left.
-     *
-     * Game-over check happens BEFORE the decrement, matching DeadBall's
-     * `livesLeft <= 0 && GetAnActiveBall() == -1` (original/level.c:482) --
-     * the decrement (DecExtraLife, level.c:500) only runs in the respawn
-     * branch below.  With 3 starting lives this yields 4 balls total:
-     * game-over fires on the death that FINDS lives_left already at 0, not
-     * the one that brings it to 0.
-     *
-     * Play-test: lives never deplete, matching DecExtraLife's
+    /* Play-test: lives never deplete, matching DecExtraLife's
      * `if (mode != MODE_EDIT) livesLeft--;` no-op (original/level.c:
      * 346-357).  The original never needed a dedicated flag for this
      * because `mode` stays MODE_EDIT for the whole editor session,
@@ -408,54 +201,29 @@ void game_rules_ball_died(game_ctx_t *ctx)
      * 474-505) can never trip.  The modern port re-enters a genuinely
      * distinct SDL2ST_GAME mode for play-test, so it needs
      * ctx->play_test_active to recover the same fact. */
-    if (!ctx->play_test_active && ctx->lives_left <= 0)
-    {
-        /* Game over.  Don't clear ctx->game_active here — the highscore
-         * mode's on_enter uses it to distinguish real game-over from
-         * attract-cycle entry.  It is cleared by mode_intro_enter when
-         * the game-over highscore returns to the title (ADR-055). */
-        if (ctx->audio)
-            sdl2_audio_play_at_percent(ctx->audio, "game_over", 99);
-        message_system_set(ctx->message, "GAME OVER", 0, 0);
-
-        sdl2_state_transition(ctx->state, SDL2ST_HIGHSCORE);
-        return;
-    }
-
-    /* Still have lives (or play-testing) — reset ball on paddle.
-     * Clear reverse here: matches original/level.c:492 — SetReverseOff()
-     * inside DeadBall, before ResetBallStart. */
-    if (ctx->audio)
-        sdl2_audio_play_at_percent(ctx->audio, "balllost", 99);
-
-    /* Grant +2 ammo as consolation — original/ball.c:1803-1805.
-     * Skip when unlimited is active: MAXAMMO_BLK sets ammo to GUN_MAX_AMMO+1
-     * as a sentinel, but gun_system_add_ammo clamps to GUN_MAX_AMMO, so the
-     * +2 here would silently reduce 21→20. */
-    if (!gun_system_get_unlimited(ctx->gun))
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    switch (rules_logic_ball_died(&rules, ctx->play_test_active))
     {
-        gun_system_add_ammo(ctx->gun);
-        gun_system_add_ammo(ctx->gun);
+        case RULES_BALL_GAME_OVER:
+            /* Don't clear ctx->game_active here — the highscore mode's
+             * on_enter uses it to distinguish real game-over from
+             * attract-cycle entry.  It is cleared by mode_intro_enter
+             * when the game-over highscore returns to the title
+             * (ADR-055). */
+            if (ctx->audio)
+                sdl2_audio_play_at_percent(ctx->audio, "game_over", 99);
+            message_system_set(ctx->message, "GAME OVER", 0, 0);
+            sdl2_state_transition(ctx->state, SDL2ST_HIGHSCORE);
+            break;
+
+        case RULES_BALL_RESPAWN:
+            if (ctx->audio)
+                sdl2_audio_play_at_percent(ctx->audio, "balllost", 99);
+            break;
+
+        default:
+            break;
     }
-
-    paddle_system_set_reverse(ctx->paddle, 0);
-
-    /* Make the paddle the maximum size — original/level.c:496-497,
-     * ChangePaddleSize(PAD_EXPAND_BLK) called twice, which saturates to
-     * HUGE regardless of the paddle's prior size (the two-call idiom just
-     * guarantees SMALL->HUGE in one step; a single set_size call is
-     * equivalent for a 3-step SMALL/MEDIUM/HUGE scale).  Runs on every
-     * respawn, real game and play-test alike. */
-    paddle_system_set_size(ctx->paddle, PADDLE_SIZE_HUGE);
-
-    /* Decrement lives inside the respawn branch, real game only --
-     * DecExtraLife (original/level.c:500), guarded the same way as the
-     * game-over check above. */
-    if (!ctx->play_test_active)
-        ctx->lives_left--;
-
-    ball_system_env_t env = game_callbacks_ball_env(ctx);
-    ball_system_reset_start(ctx->ball, &env);
 }
 
 /* =========================================================================
@@ -480,8 +248,8 @@ void game_rules_check(game_ctx_t *ctx)
     }
 
     /* Bonus block spawning */
-    int frame = (int)sdl2_state_frame(ctx->state);
-    try_spawn_bonus(ctx, frame);
+    rules_logic_t rules = game_callbacks_rules(ctx);
+    rules_logic_spawn_bonus(&rules, (int)sdl2_state_frame(ctx->state));
 }
 
 void game_rules_skip_level(game_ctx_t *ctx, int frame)
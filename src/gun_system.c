@@ -12,6 +12,7 @@
 
 #include "gun_system.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -43,6 +44,8 @@ struct gun_system
     int unlimited;
     int bullet_start_y;    /* play_height - GUN_BULLET_START_OFFSET */
     int last_update_frame; /* Most recent env->frame from gun_system_update */
+
+    /* Wiring — everything above is snapshot state (see Snapshots) */
     gun_system_callbacks_t callbacks;
     void *user_data;
 };
@@ -89,7 +92,7 @@ static void add_tink(gun_system_t *ctx, int xpos, int frame)
 
             if (ctx->callbacks.on_sound)
             {
-                ctx->callbacks.on_sound("shoot", 80, ctx->user_data);
+                ctx->callbacks.on_sound(SOUND_SHOOT, 80, ctx->user_data);
             }
             return;
         }
@@ -179,7 +182,7 @@ static void update_bullets(gun_system_t *ctx, const gun_system_env_t *env)
 
                 if (ctx->callbacks.on_sound)
                 {
-                    ctx->callbacks.on_sound("ballshot", 50, ctx->user_data);
+                    ctx->callbacks.on_sound(SOUND_BALLSHOT, 50, ctx->user_data);
                 }
                 continue;
             }
@@ -334,7 +337,7 @@ int gun_system_shoot(gun_system_t *ctx, const gun_system_env_t *env)
 
             if (ctx->callbacks.on_sound)
             {
-                ctx->callbacks.on_sound("shotgun", 50, ctx->user_data);
+                ctx->callbacks.on_sound(SOUND_SHOTGUN, 50, ctx->user_data);
             }
             return 1;
         }
@@ -344,7 +347,7 @@ int gun_system_shoot(gun_system_t *ctx, const gun_system_env_t *env)
         /* No ammo — click sound */
         if (ctx->callbacks.on_sound)
         {
-            ctx->callbacks.on_sound("click", 99, ctx->user_data);
+            ctx->callbacks.on_sound(SOUND_CLICK, 99, ctx->user_data);
         }
     }
 
@@ -544,6 +547,36 @@ int gun_system_get_active_tink_count(const gun_system_t *ctx)
     return count;
 }
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct gun_system, copied as bytes. */
+#define GUN_SNAPSHOT_SIZE offsetof(struct gun_system, callbacks)
+
+size_t gun_system_snapshot_size(void)
+{
+    return GUN_SNAPSHOT_SIZE;
+}
+
+void gun_system_snapshot_save(const gun_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, GUN_SNAPSHOT_SIZE);
+}
+
+void gun_system_snapshot_load(gun_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, GUN_SNAPSHOT_SIZE);
+}
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
@@ -11,6 +11,7 @@
 
 #include "level_system.h"
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -185,24 +186,55 @@ int level_system_char_to_block(char ch, int *out_counter_slide)
  * Level loading
  * ========================================================================= */
 
-level_system_status_t level_system_load_file(level_system_t *ctx, const char *path)
+/* Line buffer size; a longer title line spills into the next read, as
+ * with the fgets() of the original loader. */
+#define LINE_BUF_SIZE 1024
+
+/* Most bytes the parser can consume: two lines, then the grid rows and
+ * their newlines.  load_file() reads no more than this. */
+#define LEVEL_PARSE_MAX (2 * (LINE_BUF_SIZE - 1) + LEVEL_GRID_ROWS * (LEVEL_GRID_COLS + 1))
+
+/* Cursor over the level text, whether read from a file or a pack. */
+typedef struct
 {
-    if (ctx == NULL || path == NULL)
+    const char *p;
+    const char *end;
+} level_reader_t;
+
+/* fgetc() over the reader: the next byte, or EOF. */
+static int reader_getc(level_reader_t *r)
+{
+    return r->p < r->end ? (unsigned char)*r->p++ : EOF;
+}
+
+/* fgets() over the reader: up to size - 1 bytes, through the first '\n'.
+ * Returns false at end of input. */
+static bool reader_gets(level_reader_t *r, char *buf, size_t size)
+{
+    if (r->p >= r->end)
     {
-        return LEVEL_SYS_ERR_NULL_ARG;
+        return false;
     }
-
-    FILE *fp = fopen(path, "r");
-    if (fp == NULL)
+    size_t n = 0;
+    while (n < size - 1 && r->p < r->end)
     {
-        return LEVEL_SYS_ERR_FILE_NOT_FOUND;
+        char c = *r->p++;
+        buf[n++] = c;
+        if (c == '\n')
+        {
+            break;
+        }
     }
+    buf[n] = '\0';
+    return true;
+}
 
+static level_system_status_t parse_level(level_system_t *ctx, level_reader_t *r)
+{
     /* Line 1: Title */
-    char buf[1024];
-    if (fgets(buf, (int)sizeof(buf), fp) == NULL)
+    char buf[LINE_BUF_SIZE];
+    if (!reader_gets(r, buf, sizeof(buf)))
     {
-        fclose(fp);
         return LEVEL_SYS_ERR_PARSE_FAILED;
     }
 
@@ -218,16 +250,14 @@ level_system_status_t level_system_load_file(level_system_t *ctx, const char *pa
     ctx->title[LEVEL_TITLE_MAX - 1] = '\0';
 
     /* Line 2: Time bonus */
-    if (fgets(buf, (int)sizeof(buf), fp) == NULL)
+    if (!reader_gets(r, buf, sizeof(buf)))
     {
-        fclose(fp);
         return LEVEL_SYS_ERR_PARSE_FAILED;
     }
 
     int time_val = 0;
     if (sscanf(buf, "%d", &time_val) != 1)
     {
-        fclose(fp);
         return LEVEL_SYS_ERR_PARSE_FAILED;
     }
     ctx->time_bonus = time_val;
@@ -237,10 +267,9 @@ level_system_status_t level_system_load_file(level_system_t *ctx, const char *pa
     {
         for (int col = 0; col < LEVEL_GRID_COLS; col++)
         {
-            int ch = fgetc(fp);
+            int ch = reader_getc(r);
             if (ch == EOF)
             {
-                fclose(fp);
                 return LEVEL_SYS_ERR_PARSE_FAILED;
             }
 
@@ -257,18 +286,52 @@ level_system_status_t level_system_load_file(level_system_t *ctx, const char *pa
         /* Consume the newline after each row.
          * EOF is tolerated only for the final row to allow a missing
          * trailing newline at end-of-file. */
-        int newline = fgetc(fp);
+        int newline = reader_getc(r);
         if (newline == EOF && row != LEVEL_GRID_ROWS - 1)
         {
-            fclose(fp);
             return LEVEL_SYS_ERR_PARSE_FAILED;
         }
     }
 
-    fclose(fp);
     return LEVEL_SYS_OK;
 }
 
+level_system_status_t level_system_load_file(level_system_t *ctx, const char *path)
+{
+    if (ctx == NULL || path == NULL)
+    {
+        return LEVEL_SYS_ERR_NULL_ARG;
+    }
+
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+    {
+        return LEVEL_SYS_ERR_FILE_NOT_FOUND;
+    }
+
+    char text[LEVEL_PARSE_MAX];
+    size_t len = fread(text, 1, sizeof(text), fp);
+    fclose(fp);
+
+    level_reader_t r = {text, text + len};
+    return parse_level(ctx, &r);
+}
+
+level_system_status_t level_system_load_memory(level_system_t *ctx, const char *data, size_t size)
+{
+    if (ctx == NULL || (data == NULL && size > 0))
+    {
+        return LEVEL_SYS_ERR_NULL_ARG;
+    }
+    if (size == 0)
+    {
+        return LEVEL_SYS_ERR_PARSE_FAILED;
+    }
+
+    level_reader_t r = {data, data + size};
+    return parse_level(ctx, &r);
+}
+
 /* =========================================================================
  * Background cycling
  * ========================================================================= */
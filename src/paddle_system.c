@@ -18,7 +18,9 @@
 
 #include "paddle_system.h"
 
+#include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* =========================================================================
  * Internal helpers
@@ -66,6 +68,7 @@ static int pixel_width_for_size(int size_type)
  * Internal struct
  * ========================================================================= */
 
+/* Plain state only: a snapshot is the whole struct (see Snapshots). */
 struct paddle_system
 {
     int pos;         /* Center X position in play-area coordinates */
@@ -463,6 +466,36 @@ paddle_system_status_t paddle_system_get_render_info(const paddle_system_t *ctx,
     return PADDLE_SYS_OK;
 }
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct paddle_system, copied as bytes. */
+#define PADDLE_SNAPSHOT_SIZE sizeof(struct paddle_system)
+
+size_t paddle_system_snapshot_size(void)
+{
+    return PADDLE_SNAPSHOT_SIZE;
+}
+
+void paddle_system_snapshot_save(const paddle_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, PADDLE_SNAPSHOT_SIZE);
+}
+
+void paddle_system_snapshot_load(paddle_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, PADDLE_SNAPSHOT_SIZE);
+}
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
@@ -494,3 +494,30 @@ paths_status_t paths_install_data_dir(const paths_config_t *cfg, const char *sub
     }
     return PATHS_NOT_FOUND;
 }
+
+paths_status_t paths_install_data_file(const paths_config_t *cfg, const char *filename, char *buf,
+                                       size_t bufsize)
+{
+    if (cfg == NULL || filename == NULL || filename[0] == '\0' || buf == NULL || bufsize == 0)
+        return PATHS_NOT_FOUND;
+
+    paths_status_t st;
+    for (int i = 0; i < cfg->xdg_data_dirs_count; i++)
+    {
+        st = build_path(buf, bufsize, cfg->xdg_data_dirs[i], "xboing", filename, NULL);
+        if (st == PATHS_TRUNCATED)
+            return PATHS_TRUNCATED;
+        if (file_exists(buf))
+            return PATHS_OK;
+    }
+
+    if (cfg->install_data_dir[0] != '\0')
+    {
+        st = build_path(buf, bufsize, cfg->install_data_dir, filename, NULL, NULL);
+        if (st == PATHS_TRUNCATED)
+            return PATHS_TRUNCATED;
+        if (file_exists(buf))
+            return PATHS_OK;
+    }
+    return PATHS_NOT_FOUND;
+}
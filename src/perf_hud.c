@@ -0,0 +1,255 @@
+/*
+ * perf_hud.c — Numbers behind the on-screen performance HUD.
+ *
+ * See include/perf_hud.h for API documentation.
+ * See ADR-092 in docs/DESIGN.md for design rationale.
+ */
+
+#include "perf_hud.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+/* Sums over the window being filled. */
+typedef struct
+{
+    int frames;
+    uint64_t frame_us;
+    uint64_t frame_us_max;
+    uint64_t ticks;
+    int ticks_max;
+    uint64_t draw_calls;
+    uint64_t texture_switches;
+} window_t;
+
+struct perf_hud
+{
+    trace_clock_fn clock_fn;
+    bool visible;
+    bool stats_started; /* This HUD owns the running trace statistics */
+
+    uint32_t history[PERF_HUD_HISTORY]; /* Ring of frame times, us */
+    size_t history_next;
+    size_t history_len;
+
+    window_t window;
+    perf_hud_summary_t summary;
+};
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+static void reset(perf_hud_t *ctx)
+{
+    ctx->history_next = 0;
+    ctx->history_len = 0;
+    memset(&ctx->window, 0, sizeof(ctx->window));
+    memset(&ctx->summary, 0, sizeof(ctx->summary));
+}
+
+/* Fold the full window into the summary and start the next one. */
+static void close_window(perf_hud_t *ctx)
+{
+    const window_t *w = &ctx->window;
+    perf_hud_summary_t *s = &ctx->summary;
+    double frames = (double)w->frames;
+
+    s->frames = w->frames;
+    s->fps = w->frame_us > 0 ? frames * 1e6 / (double)w->frame_us : 0.0;
+    s->frame_ms_mean = (double)w->frame_us / frames / 1000.0;
+    s->frame_ms_max = (double)w->frame_us_max / 1000.0;
+    s->ticks_per_frame = (double)w->ticks / frames;
+    s->ticks_max = w->ticks_max;
+    s->draw_calls = (double)w->draw_calls / frames;
+    s->texture_switches = (double)w->texture_switches / frames;
+
+    trace_zone_stat_t zones[PERF_HUD_MAX_ZONES];
+    size_t n = trace_stats_take(zones, PERF_HUD_MAX_ZONES);
+    s->zone_count = (int)n;
+    for (size_t i = 0; i < n; i++)
+    {
+        s->zones[i].name = zones[i].name;
+        s->zones[i].ms_per_frame = (double)zones[i].total_ns / frames / 1e6;
+    }
+
+    memset(&ctx->window, 0, sizeof(ctx->window));
+}
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+perf_hud_t *perf_hud_create(trace_clock_fn clock_fn, perf_hud_status_t *status)
+{
+    if (clock_fn == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = PERF_HUD_ERR_NULL_ARG;
+        }
+        return NULL;
+    }
+
+    perf_hud_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = PERF_HUD_ERR_ALLOC_FAILED;
+        }
+        return NULL;
+    }
+    ctx->clock_fn = clock_fn;
+
+    if (status != NULL)
+    {
+        *status = PERF_HUD_OK;
+    }
+    return ctx;
+}
+
+void perf_hud_destroy(perf_hud_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    perf_hud_set_visible(ctx, false);
+    free(ctx);
+}
+
+/* =========================================================================
+ * Public API — Visibility
+ * ========================================================================= */
+
+void perf_hud_set_visible(perf_hud_t *ctx, bool visible)
+{
+    if (ctx == NULL || visible == ctx->visible)
+    {
+        return;
+    }
+
+    ctx->visible = visible;
+    if (visible)
+    {
+        reset(ctx);
+        ctx->stats_started = trace_stats_start(ctx->clock_fn) == TRACE_OK;
+    }
+    else if (ctx->stats_started)
+    {
+        trace_stats_stop();
+        ctx->stats_started = false;
+    }
+}
+
+bool perf_hud_is_visible(const perf_hud_t *ctx)
+{
+    return ctx != NULL && ctx->visible;
+}
+
+/* =========================================================================
+ * Public API — Per-frame input
+ * ========================================================================= */
+
+void perf_hud_add_draws(perf_hud_t *ctx, uint32_t draw_calls, uint32_t texture_switches)
+{
+    if (ctx == NULL || !ctx->visible)
+    {
+        return;
+    }
+    ctx->window.draw_calls += draw_calls;
+    ctx->window.texture_switches += texture_switches;
+}
+
+void perf_hud_end_frame(perf_hud_t *ctx, uint64_t frame_us, int ticks)
+{
+    if (ctx == NULL || !ctx->visible)
+    {
+        return;
+    }
+
+    ctx->history[ctx->history_next] = frame_us > UINT32_MAX ? UINT32_MAX : (uint32_t)frame_us;
+    ctx->history_next = (ctx->history_next + 1) % PERF_HUD_HISTORY;
+    if (ctx->history_len < PERF_HUD_HISTORY)
+    {
+        ctx->history_len++;
+    }
+
+    window_t *w = &ctx->window;
+    w->frames++;
+    w->frame_us += frame_us;
+    if (frame_us > w->frame_us_max)
+    {
+        w->frame_us_max = frame_us;
+    }
+    if (ticks > 0)
+    {
+        w->ticks += (uint64_t)ticks;
+    }
+    if (ticks > w->ticks_max)
+    {
+        w->ticks_max = ticks;
+    }
+
+    if (w->frame_us >= PERF_HUD_WINDOW_US)
+    {
+        close_window(ctx);
+    }
+}
+
+/* =========================================================================
+ * Public API — Queries
+ * ========================================================================= */
+
+void perf_hud_get_summary(const perf_hud_t *ctx, perf_hud_summary_t *out)
+{
+    if (out == NULL)
+    {
+        return;
+    }
+    if (ctx == NULL)
+    {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    *out = ctx->summary;
+}
+
+size_t perf_hud_history(const perf_hud_t *ctx, uint32_t *out_us, size_t max)
+{
+    if (ctx == NULL || out_us == NULL)
+    {
+        return 0;
+    }
+
+    size_t n = ctx->history_len < max ? ctx->history_len : max;
+    size_t start = (ctx->history_next + PERF_HUD_HISTORY - n) % PERF_HUD_HISTORY;
+    for (size_t i = 0; i < n; i++)
+    {
+        out_us[i] = ctx->history[(start + i) % PERF_HUD_HISTORY];
+    }
+    return n;
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *perf_hud_status_string(perf_hud_status_t status)
+{
+    switch (status)
+    {
+        case PERF_HUD_OK:
+            return "OK";
+        case PERF_HUD_ERR_NULL_ARG:
+            return "NULL argument";
+        case PERF_HUD_ERR_ALLOC_FAILED:
+            return "allocation failed";
+    }
+    return "unknown status";
+}
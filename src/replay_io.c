@@ -0,0 +1,504 @@
+/*
+ * replay_io.c — Compact binary input recording for deterministic replay.
+ *
+ * See include/replay_io.h for the file layout and API documentation.
+ */
+
+#include "replay_io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sdl2_cli.h"
+#include "sdl2_loop.h"
+
+/* =========================================================================
+ * Format constants
+ * ========================================================================= */
+
+static const char replay_magic[4] = {'X', 'B', 'R', 'P'};
+
+/* Header flag bits */
+#define REPLAY_H_USE_KEYS 0x01u
+#define REPLAY_H_SFX 0x02u
+#define REPLAY_H_DEBUG 0x04u
+
+/* Per-frame field bits.  A frame byte of 0 introduces a run. */
+#define REPLAY_F_TICKS 0x01u       /* varint ticks */
+#define REPLAY_F_HELD 0x02u        /* varint held XOR previous */
+#define REPLAY_F_EDGE 0x04u        /* varint edge */
+#define REPLAY_F_MOUSE 0x08u       /* zigzag varint dx, dy */
+#define REPLAY_F_BUTTONS 0x10u     /* varint buttons XOR previous */
+#define REPLAY_F_BUTTON_EDGE 0x20u /* varint button_edge */
+#define REPLAY_F_SHIFT 0x40u       /* shift toggled (no payload) */
+#define REPLAY_F_KEYS 0x80u        /* u8 count, then count x (u8 key, u8 ch) */
+
+/* Most ticks one frame can hold: the loop never runs more per update,
+ * even in turbo.  Anything above is corrupt, not a slow frame. */
+#define REPLAY_MAX_FRAME_TICKS SDL2L_TURBO_MAX_TICKS_PER_UPDATE
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+struct replay_io_writer
+{
+    FILE *fp;
+    replay_frame_t prev; /* Persistent fields of the last frame written */
+    uint64_t run;        /* Pending identical frames not yet written */
+    replay_io_status_t error;
+};
+
+struct replay_io_reader
+{
+    FILE *fp;
+    replay_frame_t prev; /* Persistent fields of the last frame decoded */
+    uint64_t run;        /* Identical frames still owed from a run record */
+    uint64_t frames;
+};
+
+/* =========================================================================
+ * Encoding helpers
+ * ========================================================================= */
+
+static void put_byte(replay_io_writer_t *w, unsigned value)
+{
+    if (w->error == REPLAY_IO_OK && fputc((int)(value & 0xffu), w->fp) == EOF)
+    {
+        w->error = REPLAY_IO_ERR_WRITE;
+    }
+}
+
+static void put_varint(replay_io_writer_t *w, uint64_t value)
+{
+    while (value >= 0x80u)
+    {
+        put_byte(w, (unsigned)(value & 0x7fu) | 0x80u);
+        value >>= 7;
+    }
+    put_byte(w, (unsigned)value);
+}
+
+static uint64_t zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1u);
+}
+
+static void flush_run(replay_io_writer_t *w)
+{
+    if (w->run > 0)
+    {
+        put_byte(w, 0);
+        put_varint(w, w->run);
+        w->run = 0;
+    }
+}
+
+/* =========================================================================
+ * Decoding helpers — each returns 0 on EOF/truncation
+ * ========================================================================= */
+
+static int get_byte(replay_io_reader_t *r, unsigned *out)
+{
+    int c = fgetc(r->fp);
+    if (c == EOF)
+    {
+        return 0;
+    }
+    *out = (unsigned)c;
+    return 1;
+}
+
+static int get_varint(replay_io_reader_t *r, uint64_t *out)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        unsigned b;
+        if (!get_byte(r, &b))
+        {
+            return 0;
+        }
+        value |= (uint64_t)(b & 0x7fu) << shift;
+        if ((b & 0x80u) == 0)
+        {
+            *out = value;
+            return 1;
+        }
+    }
+    return 0; /* Over-long varint */
+}
+
+static int get_u32(replay_io_reader_t *r, uint32_t *out)
+{
+    uint64_t v;
+    if (!get_varint(r, &v) || v > UINT32_MAX)
+    {
+        return 0;
+    }
+    *out = (uint32_t)v;
+    return 1;
+}
+
+/* Clear the per-frame fields of a decoded frame, keeping persistent ones. */
+static void clear_transient(replay_frame_t *frame)
+{
+    frame->edge = 0;
+    frame->button_edge = 0;
+    frame->key_count = 0;
+}
+
+/* =========================================================================
+ * Writing
+ * ========================================================================= */
+
+replay_io_writer_t *replay_io_write_open(const char *path, const replay_header_t *header,
+                                         replay_io_status_t *status)
+{
+    replay_io_status_t st = REPLAY_IO_OK;
+    replay_io_writer_t *w = NULL;
+
+    if (path == NULL || header == NULL)
+    {
+        st = REPLAY_IO_ERR_NULL_ARG;
+        goto done;
+    }
+
+    w = calloc(1, sizeof(*w));
+    if (w == NULL)
+    {
+        st = REPLAY_IO_ERR_ALLOC_FAILED;
+        goto done;
+    }
+
+    w->fp = fopen(path, "wb");
+    if (w->fp == NULL)
+    {
+        free(w);
+        w = NULL;
+        st = REPLAY_IO_ERR_OPEN;
+        goto done;
+    }
+
+    unsigned flags = (header->use_keys ? REPLAY_H_USE_KEYS : 0u) |
+                     (header->sfx ? REPLAY_H_SFX : 0u) | (header->debug ? REPLAY_H_DEBUG : 0u);
+    for (size_t i = 0; i < sizeof(replay_magic); i++)
+    {
+        put_byte(w, (unsigned char)replay_magic[i]);
+    }
+    put_byte(w, REPLAY_IO_VERSION);
+    put_byte(w, flags);
+    put_byte(w, (unsigned)header->speed);
+    put_byte(w, (unsigned)header->start_level);
+    for (int i = 0; i < 8; i++)
+    {
+        put_byte(w, (unsigned)(header->seed >> (8 * i)));
+    }
+    st = w->error;
+
+done:
+    if (status != NULL)
+    {
+        *status = st;
+    }
+    return w;
+}
+
+replay_io_status_t replay_io_write_frame(replay_io_writer_t *w, const replay_frame_t *frame)
+{
+    if (w == NULL || frame == NULL)
+    {
+        return REPLAY_IO_ERR_NULL_ARG;
+    }
+
+    const replay_frame_t *p = &w->prev;
+    int key_count = frame->key_count;
+    if (key_count < 0)
+    {
+        key_count = 0;
+    }
+    if (key_count > REPLAY_MAX_KEYS)
+    {
+        key_count = REPLAY_MAX_KEYS;
+    }
+
+    unsigned flags = 0;
+    if (frame->ticks != p->ticks)
+        flags |= REPLAY_F_TICKS;
+    if (frame->held != p->held)
+        flags |= REPLAY_F_HELD;
+    if (frame->edge != 0)
+        flags |= REPLAY_F_EDGE;
+    if (frame->mouse_x != p->mouse_x || frame->mouse_y != p->mouse_y)
+        flags |= REPLAY_F_MOUSE;
+    if (frame->buttons != p->buttons)
+        flags |= REPLAY_F_BUTTONS;
+    if (frame->button_edge != 0)
+        flags |= REPLAY_F_BUTTON_EDGE;
+    if (frame->shift != p->shift)
+        flags |= REPLAY_F_SHIFT;
+    if (key_count > 0)
+        flags |= REPLAY_F_KEYS;
+
+    if (flags == 0)
+    {
+        w->run++;
+        return w->error;
+    }
+
+    flush_run(w);
+    put_byte(w, flags);
+    if (flags & REPLAY_F_TICKS)
+        put_varint(w, frame->ticks);
+    if (flags & REPLAY_F_HELD)
+        put_varint(w, frame->held ^ p->held);
+    if (flags & REPLAY_F_EDGE)
+        put_varint(w, frame->edge);
+    if (flags & REPLAY_F_MOUSE)
+    {
+        put_varint(w, zigzag((int64_t)frame->mouse_x - p->mouse_x));
+        put_varint(w, zigzag((int64_t)frame->mouse_y - p->mouse_y));
+    }
+    if (flags & REPLAY_F_BUTTONS)
+        put_varint(w, frame->buttons ^ p->buttons);
+    if (flags & REPLAY_F_BUTTON_EDGE)
+        put_varint(w, frame->button_edge);
+    if (flags & REPLAY_F_KEYS)
+    {
+        put_byte(w, (unsigned)key_count);
+        for (int i = 0; i < key_count; i++)
+        {
+            put_byte(w, frame->keys[i].key);
+            put_byte(w, (unsigned char)frame->keys[i].ch);
+        }
+    }
+
+    w->prev = *frame;
+    clear_transient(&w->prev);
+    return w->error;
+}
+
+replay_io_status_t replay_io_write_close(replay_io_writer_t *w)
+{
+    if (w == NULL)
+    {
+        return REPLAY_IO_OK;
+    }
+    flush_run(w);
+    replay_io_status_t st = w->error;
+    if (fclose(w->fp) != 0 && st == REPLAY_IO_OK)
+    {
+        st = REPLAY_IO_ERR_WRITE;
+    }
+    free(w);
+    return st;
+}
+
+/* =========================================================================
+ * Reading
+ * ========================================================================= */
+
+replay_io_reader_t *replay_io_read_open(const char *path, replay_header_t *header,
+                                        replay_io_status_t *status)
+{
+    replay_io_status_t st = REPLAY_IO_OK;
+    replay_io_reader_t *r = NULL;
+
+    if (path == NULL || header == NULL)
+    {
+        st = REPLAY_IO_ERR_NULL_ARG;
+        goto done;
+    }
+
+    r = calloc(1, sizeof(*r));
+    if (r == NULL)
+    {
+        st = REPLAY_IO_ERR_ALLOC_FAILED;
+        goto done;
+    }
+
+    r->fp = fopen(path, "rb");
+    if (r->fp == NULL)
+    {
+        free(r);
+        r = NULL;
+        st = REPLAY_IO_ERR_OPEN;
+        goto done;
+    }
+
+    unsigned char head[16];
+    if (fread(head, 1, sizeof(head), r->fp) != sizeof(head) ||
+        memcmp(head, replay_magic, sizeof(replay_magic)) != 0 || head[4] != REPLAY_IO_VERSION)
+    {
+        replay_io_read_close(r);
+        r = NULL;
+        st = REPLAY_IO_ERR_BAD_FORMAT;
+        goto done;
+    }
+
+    /* Same limits sdl2_cli enforces for -speed and -startlevel. */
+    if (head[6] < SDL2C_MIN_SPEED || head[6] > SDL2C_MAX_SPEED || head[7] < SDL2C_MIN_LEVEL ||
+        head[7] > SDL2C_MAX_LEVEL)
+    {
+        replay_io_read_close(r);
+        r = NULL;
+        st = REPLAY_IO_ERR_BAD_FORMAT;
+        goto done;
+    }
+
+    memset(header, 0, sizeof(*header));
+    header->use_keys = (head[5] & REPLAY_H_USE_KEYS) != 0;
+    header->sfx = (head[5] & REPLAY_H_SFX) != 0;
+    header->debug = (head[5] & REPLAY_H_DEBUG) != 0;
+    header->speed = head[6];
+    header->start_level = head[7];
+    for (int i = 0; i < 8; i++)
+    {
+        header->seed |= (uint64_t)head[8 + i] << (8 * i);
+    }
+
+done:
+    if (status != NULL)
+    {
+        *status = st;
+    }
+    return r;
+}
+
+replay_io_status_t replay_io_read_frame(replay_io_reader_t *r, replay_frame_t *frame)
+{
+    if (r == NULL || frame == NULL)
+    {
+        return REPLAY_IO_ERR_NULL_ARG;
+    }
+
+    if (r->run > 0)
+    {
+        r->run--;
+        *frame = r->prev;
+        r->frames++;
+        return REPLAY_IO_OK;
+    }
+
+    unsigned flags;
+    if (!get_byte(r, &flags))
+    {
+        return REPLAY_IO_END;
+    }
+
+    if (flags == 0)
+    {
+        uint64_t run;
+        if (!get_varint(r, &run) || run == 0)
+        {
+            return REPLAY_IO_ERR_BAD_FORMAT;
+        }
+        r->run = run - 1;
+        *frame = r->prev;
+        r->frames++;
+        return REPLAY_IO_OK;
+    }
+
+    replay_frame_t f = r->prev;
+    uint32_t v;
+    uint64_t dx, dy;
+
+    if (flags & REPLAY_F_TICKS)
+    {
+        if (!get_u32(r, &f.ticks) || f.ticks > REPLAY_MAX_FRAME_TICKS)
+            return REPLAY_IO_ERR_BAD_FORMAT;
+    }
+    if (flags & REPLAY_F_HELD)
+    {
+        if (!get_u32(r, &v))
+            return REPLAY_IO_ERR_BAD_FORMAT;
+        f.held ^= v;
+    }
+    if ((flags & REPLAY_F_EDGE) && !get_u32(r, &f.edge))
+        return REPLAY_IO_ERR_BAD_FORMAT;
+    if (flags & REPLAY_F_MOUSE)
+    {
+        if (!get_varint(r, &dx) || !get_varint(r, &dy))
+            return REPLAY_IO_ERR_BAD_FORMAT;
+        f.mouse_x = (int32_t)((int64_t)f.mouse_x + unzigzag(dx));
+        f.mouse_y = (int32_t)((int64_t)f.mouse_y + unzigzag(dy));
+    }
+    if (flags & REPLAY_F_BUTTONS)
+    {
+        if (!get_u32(r, &v))
+            return REPLAY_IO_ERR_BAD_FORMAT;
+        f.buttons ^= v;
+    }
+    if ((flags & REPLAY_F_BUTTON_EDGE) && !get_u32(r, &f.button_edge))
+        return REPLAY_IO_ERR_BAD_FORMAT;
+    if (flags & REPLAY_F_SHIFT)
+        f.shift = !f.shift;
+    if (flags & REPLAY_F_KEYS)
+    {
+        unsigned count;
+        if (!get_byte(r, &count) || count > REPLAY_MAX_KEYS)
+            return REPLAY_IO_ERR_BAD_FORMAT;
+        for (unsigned i = 0; i < count; i++)
+        {
+            unsigned key, ch;
+            if (!get_byte(r, &key) || !get_byte(r, &ch))
+                return REPLAY_IO_ERR_BAD_FORMAT;
+            f.keys[i].key = (uint8_t)key;
+            f.keys[i].ch = (char)ch;
+        }
+        f.key_count = (int)count;
+    }
+
+    *frame = f;
+    r->prev = f;
+    clear_transient(&r->prev);
+    r->frames++;
+    return REPLAY_IO_OK;
+}
+
+uint64_t replay_io_frames_read(const replay_io_reader_t *r)
+{
+    return r ? r->frames : 0;
+}
+
+void replay_io_read_close(replay_io_reader_t *r)
+{
+    if (r == NULL)
+    {
+        return;
+    }
+    fclose(r->fp);
+    free(r);
+}
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+const char *replay_io_status_string(replay_io_status_t status)
+{
+    switch (status)
+    {
+        case REPLAY_IO_OK:
+            return "OK";
+        case REPLAY_IO_END:
+            return "end of replay";
+        case REPLAY_IO_ERR_NULL_ARG:
+            return "NULL argument";
+        case REPLAY_IO_ERR_OPEN:
+            return "cannot open file";
+        case REPLAY_IO_ERR_WRITE:
+            return "write failed";
+        case REPLAY_IO_ERR_BAD_FORMAT:
+            return "not a replay file or truncated";
+        case REPLAY_IO_ERR_ALLOC_FAILED:
+            return "allocation failed";
+    }
+    return "unknown status";
+}
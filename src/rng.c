@@ -0,0 +1,48 @@
+/*
+ * rng.c — PCG32 (XSH RR) pseudo-random number generator.
+ *
+ * See include/rng.h for API documentation.  Algorithm from
+ * M. E. O'Neill, "PCG: A Family of Simple Fast Space-Efficient
+ * Statistically Good Algorithms for Random Number Generation" (2014),
+ * pcg32_random_r / pcg32_srandom_r.
+ */
+
+#include "rng.h"
+
+#include <stddef.h>
+
+#define RNG_MULTIPLIER 6364136223846793005ULL
+
+/* Fixed stream; the seed alone selects the sequence. */
+#define RNG_DEFAULT_STREAM 0xda3e39cb94b95bdbULL
+
+void rng_seed(rng_t *rng, uint64_t seed)
+{
+    if (rng == NULL)
+    {
+        return;
+    }
+    rng->state = 0;
+    rng->inc = (RNG_DEFAULT_STREAM << 1) | 1u;
+    (void)rng_next_u32(rng);
+    rng->state += seed;
+    (void)rng_next_u32(rng);
+}
+
+uint32_t rng_next_u32(rng_t *rng)
+{
+    if (rng == NULL)
+    {
+        return 0;
+    }
+    uint64_t old = rng->state;
+    rng->state = old * RNG_MULTIPLIER + rng->inc;
+    uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+    uint32_t rot = (uint32_t)(old >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31u));
+}
+
+int rng_next(rng_t *rng)
+{
+    return (int)(rng_next_u32(rng) >> 1);
+}
@@ -0,0 +1,587 @@
+/*
+ * rules_logic.c — Gameplay rules shared by the game and the simulation.
+ *
+ * See include/rules_logic.h for API documentation.
+ */
+
+#include "rules_logic.h"
+
+#include <stddef.h>
+
+#include "ball_types.h"
+#include "block_types.h"
+
+/* =========================================================================
+ * Helpers
+ * ========================================================================= */
+
+static void block_sound(const rules_logic_t *r, int block_type)
+{
+    if (r->on_block_sound != NULL)
+    {
+        r->on_block_sound(block_type, r->user_data);
+    }
+}
+
+static score_system_env_t score_env(const rules_logic_t *r)
+{
+    score_system_env_t env = {
+        .x2_active = special_system_is_active(r->special, SPECIAL_X2_BONUS),
+        .x4_active = special_system_is_active(r->special, SPECIAL_X4_BONUS),
+    };
+    return env;
+}
+
+/* =========================================================================
+ * Ball callbacks
+ * ========================================================================= */
+
+block_hit_result_t rules_logic_block_hit(const rules_logic_t *r, int row, int col,
+                                         int ball_index, int frame)
+{
+    int block_type = block_system_get_type(r->block, row, col);
+    if (block_type == NONE_BLK)
+    {
+        return BLOCK_HIT_BOUNCE;
+    }
+
+    /* In killer mode the ball ploughs through whatever it destroys. */
+    int killer = special_system_is_active(r->special, SPECIAL_KILLER);
+    block_hit_result_t pass = killer ? BLOCK_HIT_ABSORB : BLOCK_HIT_BOUNCE;
+
+    switch (block_type)
+    {
+        case DEATH_BLK:
+        {
+            /* Match original/ball.c:847-861 ordering: kill ball first,
+             * then arm explosion and play sound (the original plays the
+             * sound inside DrawBlock(KILL_BLK) which is called AFTER
+             * ClearBallNow). */
+            ball_system_env_t env = r->ball_env(r->user_data);
+            ball_system_change_mode(r->ball, &env, ball_index, BALL_POP);
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, DEATH_BLK);
+            return BLOCK_HIT_ABSORB;
+        }
+
+        case REVERSE_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, REVERSE_BLK);
+            paddle_system_toggle_reverse(r->paddle);
+            return pass;
+
+        case MULTIBALL_BLK:
+        {
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, MULTIBALL_BLK);
+            ball_system_env_t env = r->ball_env(r->user_data);
+            ball_system_split(r->ball, &env);
+            return pass;
+        }
+
+        case STICKY_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, STICKY_BLK);
+            special_system_set(r->special, SPECIAL_STICKY, 1);
+            paddle_system_set_sticky(r->paddle, 1);
+            return pass;
+
+        case PAD_SHRINK_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, PAD_SHRINK_BLK);
+            paddle_system_change_size(r->paddle, 1);
+            return pass;
+
+        case PAD_EXPAND_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, PAD_EXPAND_BLK);
+            paddle_system_change_size(r->paddle, 0);
+            return pass;
+
+        case MGUN_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, MGUN_BLK);
+            special_system_set(r->special, SPECIAL_FAST_GUN, 1);
+            return pass;
+
+        case WALLOFF_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, WALLOFF_BLK);
+            special_system_set(r->special, SPECIAL_NO_WALLS, 1);
+            return pass;
+
+        case EXTRABALL_BLK:
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, EXTRABALL_BLK);
+            (*r->lives_left)++;
+            return pass;
+
+        case COUNTER_BLK:
+            if (killer || block_system_ball_hit_counter(r->block, row, col) <= 0)
+            {
+                (void)block_system_explode(r->block, row, col, frame);
+                block_sound(r, COUNTER_BLK);
+                return pass;
+            }
+            return BLOCK_HIT_BOUNCE;
+
+        case BLACK_BLK:
+            if (block_system_check_black_hit(r->block, row, col, frame) > 0)
+            {
+                return BLOCK_HIT_BOUNCE;
+            }
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, BLACK_BLK);
+            return pass;
+
+        case HYPERSPACE_BLK:
+            block_sound(r, HYPERSPACE_BLK);
+            return BLOCK_HIT_TELEPORT;
+
+        default:
+            /* Plain colour blocks, bomb, bonus, ammo, timer, ... — their
+             * effects fire at finalize. */
+            (void)block_system_explode(r->block, row, col, frame);
+            block_sound(r, block_type);
+            return pass;
+    }
+}
+
+void rules_logic_block_finalize(const rules_logic_t *r, int row, int col, int block_type,
+                                int hit_points, int frame)
+{
+    /* Score deferred from hit time (original/blocks.c:1547). */
+    if (hit_points > 0)
+    {
+        score_system_env_t senv = score_env(r);
+        score_system_add(r->score, (unsigned long)hit_points, &senv);
+    }
+
+    /* Per-type finalize switch — original/blocks.c:1550-1637. */
+    switch (block_type)
+    {
+        case BOMB_BLK:
+            /* 8-neighbor chain reaction (original/blocks.c:1559-1566).
+             * Return value intentionally discarded — overlapping chains
+             * may try to re-arm an already-exploding neighbor and the
+             * silent skip matches original/blocks.c:1825. */
+            for (int dr = -1; dr <= 1; dr++)
+            {
+                for (int dc = -1; dc <= 1; dc++)
+                {
+                    if (dr == 0 && dc == 0)
+                    {
+                        continue;
+                    }
+                    (void)block_system_explode(r->block, row + dr, col + dc,
+                                               frame + BLOCK_EXPLODE_DELAY);
+                }
+            }
+            /* Screen shake — original/blocks.c:1571-1572 SFX_SHAKE. */
+            if (r->on_shake != NULL)
+            {
+                r->on_shake(r->user_data);
+            }
+            break;
+
+        case BONUSX2_BLK:
+            /* x2 explicitly disables x4 (original/blocks.c:1619). */
+            special_system_set(r->special, SPECIAL_X2_BONUS, 1);
+            special_system_set(r->special, SPECIAL_X4_BONUS, 0);
+            break;
+
+        case BONUSX4_BLK:
+            /* x4 explicitly disables x2 (original/blocks.c:1628). */
+            special_system_set(r->special, SPECIAL_X4_BONUS, 1);
+            special_system_set(r->special, SPECIAL_X2_BONUS, 0);
+            break;
+
+        case TIMER_BLK:
+            /* +20 seconds (original/blocks.c:1576, BLOCK_EXTRA_TIME=20). */
+            if (*r->time_remaining < 1000000)
+            {
+                *r->time_remaining += BLOCK_EXTRA_TIME;
+            }
+            break;
+
+        case BULLET_BLK:
+            /* +4 ammo (original/blocks.c:1584-1585). */
+            if (!gun_system_get_unlimited(r->gun))
+            {
+                for (int i = 0; i < BLOCK_NUMBER_OF_BULLETS_NEW_LEVEL; i++)
+                {
+                    gun_system_add_ammo(r->gun);
+                }
+            }
+            break;
+
+        case MAXAMMO_BLK:
+            /* Unlimited bullets (original/blocks.c:1590-1591). */
+            gun_system_set_unlimited(r->gun, 1);
+            gun_system_set_ammo(r->gun, GUN_MAX_AMMO + 1);
+            break;
+
+        case BONUS_BLK:
+            /* Bonus counter — killer mode at exactly 10
+             * (original/blocks.c:1607). */
+            (*r->bonus_count)++;
+            if (*r->bonus_count == 10)
+            {
+                special_system_set(r->special, SPECIAL_KILLER, 1);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+rules_ball_death_t rules_logic_ball_died(const rules_logic_t *r, bool keep_lives)
+{
+    /* If there are still active balls, do nothing — multiball */
+    if (ball_system_get_active_count(r->ball) > 0)
+    {
+        return RULES_BALL_OTHERS_LEFT;
+    }
+
+    /* Game-over check happens BEFORE the decrement, matching DeadBall's
+     * `livesLeft <= 0 && GetAnActiveBall() == -1` (original/level.c:482) --
+     * the decrement (DecExtraLife, level.c:500) only runs in the respawn
+     * branch below.  With 3 starting lives this yields 4 balls total:
+     * game-over fires on the death that FINDS lives_left already at 0, not
+     * the one that brings it to 0. */
+    if (!keep_lives && *r->lives_left <= 0)
+    {
+        return RULES_BALL_GAME_OVER;
+    }
+
+    /* Grant +2 ammo as consolation — original/ball.c:1803-1805.
+     * Skip when unlimited is active: MAXAMMO_BLK sets ammo to GUN_MAX_AMMO+1
+     * as a sentinel, but gun_system_add_ammo clamps to GUN_MAX_AMMO, so the
+     * +2 here would silently reduce 21→20. */
+    if (!gun_system_get_unlimited(r->gun))
+    {
+        gun_system_add_ammo(r->gun);
+        gun_system_add_ammo(r->gun);
+    }
+
+    /* Clear reverse: original/level.c:492 — SetReverseOff() inside
+     * DeadBall, before ResetBallStart. */
+    paddle_system_set_reverse(r->paddle, 0);
+
+    /* Make the paddle the maximum size — original/level.c:496-497,
+     * ChangePaddleSize(PAD_EXPAND_BLK) called twice, which saturates to
+     * HUGE regardless of the paddle's prior size. */
+    paddle_system_set_size(r->paddle, PADDLE_SIZE_HUGE);
+
+    /* DecExtraLife (original/level.c:500), guarded the same way as the
+     * game-over check above. */
+    if (!keep_lives)
+    {
+        (*r->lives_left)--;
+    }
+
+    ball_system_env_t env = r->ball_env(r->user_data);
+    ball_system_reset_start(r->ball, &env);
+    return RULES_BALL_RESPAWN;
+}
+
+/* =========================================================================
+ * Gun callbacks
+ * ========================================================================= */
+
+int rules_logic_bullet_block_at(const rules_logic_t *r, int bx, int by, int *out_row,
+                                int *out_col)
+{
+    /* Narrow to the 3x3 neighborhood of the bullet's cell. */
+    int center_col = bx / r->col_width;
+    int center_row = by / r->row_height;
+    int r0 = (center_row > 0) ? center_row - 1 : 0;
+    int r1 = (center_row < MAX_ROW - 1) ? center_row + 1 : MAX_ROW - 1;
+    int c0 = (center_col > 0) ? center_col - 1 : 0;
+    int c1 = (center_col < MAX_COL - 1) ? center_col + 1 : MAX_COL - 1;
+
+    for (int row = r0; row <= r1; row++)
+    {
+        for (int col = c0; col <= c1; col++)
+        {
+            if (!block_system_is_occupied(r->block, row, col))
+            {
+                continue;
+            }
+
+            block_system_render_info_t info;
+            if (block_system_get_render_info(r->block, row, col, &info) != BLOCK_SYS_OK)
+            {
+                continue;
+            }
+
+            if (bx >= info.x && bx < info.x + info.width && by >= info.y &&
+                by < info.y + info.height)
+            {
+                *out_row = row;
+                *out_col = col;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int rules_logic_bullet_block_hit(const rules_logic_t *r, int row, int col, int frame)
+{
+    int block_type = block_system_get_type(r->block, row, col);
+    if (block_type == NONE_BLK)
+    {
+        return NONE_BLK;
+    }
+
+    /* Decrement / absorb per block type — original/gun.c:318-350. */
+    if (block_system_decrement_gun_hit(r->block, row, col))
+    {
+        return NONE_BLK;
+    }
+
+    /* Destroyed: every block dies through the explosion lifecycle, as in
+     * original/blocks.c:1547-1637, so finalize-time effects (ammo,
+     * unlimited, score, bomb chain) fire the same for bullets and balls. */
+    (void)block_system_explode(r->block, row, col, frame);
+    block_sound(r, block_type);
+    return block_type;
+}
+
+int rules_logic_bullet_ball_at(const rules_logic_t *r, int bx, int by)
+{
+    for (int i = 0; i < MAX_BALLS; i++)
+    {
+        ball_system_render_info_t info;
+        if (ball_system_get_render_info(r->ball, i, &info) != BALL_SYS_OK)
+        {
+            continue;
+        }
+        if (!info.active || info.state != BALL_ACTIVE)
+        {
+            continue;
+        }
+        int dx = bx - info.x;
+        int dy = by - info.y;
+        if (dx * dx + dy * dy < RULES_BULLET_BALL_RADIUS * RULES_BULLET_BALL_RADIUS)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int rules_logic_eyedude_path_clear(const rules_logic_t *r)
+{
+    for (int col = 0; col < MAX_COL; col++)
+    {
+        if (block_system_is_occupied(r->block, 0, col))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* =========================================================================
+ * Bonus block spawning — port of main.c:handleGameMode() switch
+ * ========================================================================= */
+
+static int find_random_empty_cell(const rules_logic_t *r, int *out_row, int *out_col)
+{
+    /* Try random positions up to 100 times.
+     * Row range: 1 to MAX_ROW-7 (rows 1-11) — matches legacy
+     * AddBonusBlock/AddSpecialBlock: r = (rand() % (MAX_ROW - 7)) + 1
+     * This keeps bonus blocks in the upper half, away from the paddle. */
+    for (int attempt = 0; attempt < 100; attempt++)
+    {
+        int row = (rng_next(r->rng) % (MAX_ROW - 7)) + 1;
+        int col = rng_next(r->rng) % MAX_COL;
+        if (!block_system_is_occupied(r->block, row, col))
+        {
+            *out_row = row;
+            *out_col = col;
+            return 1;
+        }
+    }
+    return 0; /* Grid too full */
+}
+
+/* Case 25: dynamite — clear all blocks of a random color.  Does not add a
+ * persistent block (SetExplodeAllType, original/blocks.c:1001-1113, has
+ * no AddBonusBlock/AddSpecialBlock call) and is silent at spawn. */
+static void spawn_dynamite(const rules_logic_t *r)
+{
+    static const int dyn_types[] = {YELLOW_BLK, BLUE_BLK,    RED_BLK,  PURPLE_BLK,
+                                    TAN_BLK,    COUNTER_BLK, GREEN_BLK};
+    int target = dyn_types[rng_next(r->rng) % 7];
+    for (int row = 0; row < MAX_ROW; row++)
+    {
+        for (int col = 0; col < MAX_COL; col++)
+        {
+            if (block_system_get_type(r->block, row, col) == target)
+            {
+                block_system_clear(r->block, row, col);
+            }
+        }
+    }
+}
+
+void rules_logic_spawn_bonus(const rules_logic_t *r, int frame)
+{
+    /* Expire or release the tracked bonus/special cell BEFORE scheduling
+     * or spawning a new one.  Port of HandlePendingSpecials
+     * (original/blocks.c:1167-1186), called once per tick against the
+     * one cell the original tracks via the bonusRow/bonusCol globals. */
+    if (*r->bonus_block_active)
+    {
+        int row = *r->bonus_row;
+        int col = *r->bonus_col;
+
+        if (!block_system_is_occupied(r->block, row, col) ||
+            block_system_get_type(r->block, row, col) != *r->bonus_type)
+        {
+            /* Player destroyed or picked it up — bonusBlock is cleared
+             * on finalize/pickup at original/blocks.c:1604, 1622, 1631,
+             * 1838.  The cell itself was already handled by that path;
+             * do not touch the grid here. */
+            *r->bonus_block_active = false;
+        }
+        else if (frame >= block_system_get_last_frame(r->block, row, col))
+        {
+            /* Lifetime elapsed with no hit — original/blocks.c:1173-1184. */
+            block_system_clear(r->block, row, col);
+            *r->bonus_block_active = false;
+        }
+    }
+
+    /* Schedule next bonus if not yet scheduled.  Guarded by
+     * !bonus_block_active (original/main.c:970) so the BONUS_SEED
+     * interval only starts counting once the current special has
+     * cleared — without this guard a spawn's countdown could complete
+     * while a previous special is still on the board. */
+    if (*r->next_bonus_frame == 0 && !*r->bonus_block_active)
+    {
+        *r->next_bonus_frame = frame + (rng_next(r->rng) % RULES_BONUS_SEED);
+        return;
+    }
+
+    /* Not time yet, or a special is still active (original/main.c:974
+     * `nextBonusFrame <= frame && bonusBlock == False`) */
+    if (*r->next_bonus_frame == 0 || frame < *r->next_bonus_frame || *r->bonus_block_active)
+    {
+        return;
+    }
+
+    int row, col;
+    if (!find_random_empty_cell(r, &row, &col))
+    {
+        *r->next_bonus_frame = 0;
+        return;
+    }
+
+    /* Pick a bonus type — exact probability distribution from legacy.
+     * placed_type stays NONE_BLK when nothing persistent is placed: the
+     * x2/x4 rolls while that multiplier is already on, dynamite, and the
+     * eyedude (original/main.c:1115-1118 calls ChangeEyeDudeMode, not
+     * AddSpecialBlock). */
+    int placed_type = NONE_BLK;
+    int counter = 0;
+    int roll = rng_next(r->rng) % 27;
+
+    if (roll <= 7)
+    {
+        /* Cases 0-7: normal bonus block (8/27 chance) */
+        placed_type = BONUS_BLK;
+    }
+    else if (roll <= 11)
+    {
+        /* Cases 8-11: x2 bonus (4/27 chance) */
+        if (!special_system_is_active(r->special, SPECIAL_X2_BONUS))
+        {
+            placed_type = BONUSX2_BLK;
+        }
+    }
+    else if (roll <= 13)
+    {
+        /* Cases 12-13: x4 bonus (2/27 chance) */
+        if (!special_system_is_active(r->special, SPECIAL_X4_BONUS))
+        {
+            placed_type = BONUSX4_BLK;
+        }
+    }
+    else if (roll <= 15)
+    {
+        /* Cases 14-15: paddle shrink (2/27) */
+        placed_type = PAD_SHRINK_BLK;
+        counter = 3;
+    }
+    else if (roll <= 17)
+    {
+        /* Cases 16-17: paddle expand (2/27) */
+        placed_type = PAD_EXPAND_BLK;
+        counter = 3;
+    }
+    else if (roll == 18)
+    {
+        /* Case 18: multiball (1/27) */
+        placed_type = MULTIBALL_BLK;
+        counter = 3;
+    }
+    else if (roll == 19)
+    {
+        /* Case 19: reverse (1/27) */
+        placed_type = REVERSE_BLK;
+        counter = 3;
+    }
+    else if (roll <= 21)
+    {
+        /* Cases 20-21: machine gun (2/27) */
+        placed_type = MGUN_BLK;
+        counter = 3;
+    }
+    else if (roll == 22)
+    {
+        /* Case 22: wall off (1/27) */
+        placed_type = WALLOFF_BLK;
+        counter = 3;
+    }
+    else if (roll == 23)
+    {
+        /* Case 23: extra ball (1/27) */
+        placed_type = EXTRABALL_BLK;
+    }
+    else if (roll == 24)
+    {
+        /* Case 24: death block (1/27) */
+        placed_type = DEATH_BLK;
+        counter = 3;
+    }
+    else if (roll == 25)
+    {
+        spawn_dynamite(r);
+    }
+    else
+    {
+        /* Case 26 (final): start eyedude */
+        eyedude_system_set_state(r->eyedude, EYEDUDE_STATE_RESET);
+    }
+
+    if (placed_type != NONE_BLK)
+    {
+        /* One-at-a-time gate + finite lifetime — original/blocks.c:
+         * 1075,1079 (AddSpecialBlock) and 1107,1111 (AddBonusBlock) set
+         * bonusBlock=True and lastFrame=frame+BONUS_LENGTH only when a
+         * block was actually placed. */
+        block_system_add(r->block, row, col, placed_type, counter, frame);
+        *r->bonus_block_active = true;
+        *r->bonus_row = row;
+        *r->bonus_col = col;
+        *r->bonus_type = placed_type;
+        block_system_set_last_frame(r->block, row, col, frame + BLOCK_BONUS_LENGTH);
+    }
+
+    *r->next_bonus_frame = 0;
+}
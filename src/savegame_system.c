@@ -16,6 +16,7 @@
 #include "block_types.h"
 #include "eyedude_system.h"
 #include "game_callbacks.h" /* game_callbacks_ball_env */
+#include "game_rules.h"
 #include "gun_system.h"
 #include "level_system.h"
 #include "message_system.h"
@@ -453,30 +454,24 @@ static int reload_canonical_level(game_ctx_t *ctx, int level_number)
     char filename[32];
     snprintf(filename, sizeof(filename), "level%02d.data", file_num);
 
-    char level_path[PATHS_MAX_PATH];
-    if (paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) != PATHS_OK)
+    if (!game_rules_level_available(ctx, filename))
     {
         return 0;
     }
     block_system_clear_all(ctx->block);
-    return level_system_load_file(ctx->level, level_path) == LEVEL_SYS_OK;
+    return game_rules_load_level(ctx, filename) == LEVEL_SYS_OK;
 }
 
 /* Refresh level_system metadata (title, time_bonus) without disturbing
  * the block grid the caller will replace.  Returns LEVEL_SYS_OK or an
- * error code from level_system_load_file. */
+ * error code from game_rules_load_level. */
 static level_system_status_t refresh_level_metadata(game_ctx_t *ctx, int level_number)
 {
     int file_num = level_system_wrap_number(level_number);
     char filename[32];
     snprintf(filename, sizeof(filename), "level%02d.data", file_num);
 
-    char level_path[PATHS_MAX_PATH];
-    if (paths_level_file(&ctx->paths, filename, level_path, sizeof(level_path)) != PATHS_OK)
-    {
-        return LEVEL_SYS_ERR_FILE_NOT_FOUND;
-    }
-    return level_system_load_file(ctx->level, level_path);
+    return game_rules_load_level(ctx, filename);
 }
 
 int savegame_system_load(game_ctx_t *ctx)
@@ -12,6 +12,7 @@
 #include "score_system.h"
 #include "score_logic.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -23,6 +24,8 @@ struct score_system
 {
     u_long score;
     int life_threshold; /* Previous extra life threshold index */
+
+    /* Wiring — everything above is snapshot state (see Snapshots) */
     score_system_callbacks_t callbacks;
     void *user_data;
 };
@@ -225,6 +228,36 @@ int score_system_get_life_threshold(const score_system_t *ctx)
     return ctx->life_threshold;
 }
 
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct score_system, copied as bytes. */
+#define SCORE_SNAPSHOT_SIZE offsetof(struct score_system, callbacks)
+
+size_t score_system_snapshot_size(void)
+{
+    return SCORE_SNAPSHOT_SIZE;
+}
+
+void score_system_snapshot_save(const score_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, SCORE_SNAPSHOT_SIZE);
+}
+
+void score_system_snapshot_load(score_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, SCORE_SNAPSHOT_SIZE);
+}
+
 /* =========================================================================
  * Utility
  * ========================================================================= */
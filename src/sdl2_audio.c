@@ -2,13 +2,15 @@
  * sdl2_audio.c — SDL2_mixer sound playback and caching.
  *
  * See include/sdl2_audio.h for API documentation.
- * See ADR-010 in docs/DESIGN.md for design rationale.
+ * See ADR-010 in docs/DESIGN.md for design rationale, ADR-097 for
+ * decoding on the worker pool, and ADR-098 for the asset pack.
  */
 
 #include "sdl2_audio.h"
 
 #include <dirent.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,9 +23,21 @@ struct sdl2_audio_entry
 {
     char key[SDL2A_MAX_KEY_LEN + 1];
     Mix_Chunk *chunk;
+    sdl2_audio_priority_t priority;
     bool occupied;
 };
 
+/* What the voice manager last started on one mixer channel.  Only
+ * meaningful while the channel is playing. */
+typedef struct
+{
+    const Mix_Chunk *chunk;
+    sdl2_audio_priority_t priority;
+    unsigned long serial; /* Start order: lower is older */
+    unsigned long tick;   /* Value of ctx->tick when started */
+    int volume;           /* Channel volume, raised by coalesced plays */
+} sdl2_audio_voice_t;
+
 struct sdl2_audio
 {
     struct sdl2_audio_entry entries[SDL2A_MAX_SOUNDS];
@@ -33,6 +47,22 @@ struct sdl2_audio
     bool audio_subsystem_owned;
     bool audio_opened;
     bool mixer_initialized;
+    /* Voice manager: one record per mixer channel. */
+    sdl2_audio_voice_t *voices;
+    int voice_count;
+    unsigned long next_serial;
+    unsigned long tick;
+    sdl2_audio_voice_stats_t voice_stats;
+    /* Sound ID registry from the config: entry index per ID, -1 when
+     * the ID's key is not cached.  id_keys is the caller's table. */
+    const char *const *id_keys;
+    int id_count;
+    short id_slot[SDL2A_MAX_SOUNDS];
+    /* Set from the config until sdl2_audio_finish_decode() collects the
+     * queued files and resolves the registry. */
+    sdl2_decode_t *decoder;
+    const char *const *pending_id_keys;
+    int pending_id_count;
     /* Always-on call log ring buffer.  log_head points at the next
      * slot to write.  log_count saturates at SDL2A_LOG_CAPACITY once
      * the buffer wraps; oldest entry is at (log_head - log_count).
@@ -111,22 +141,17 @@ static const struct sdl2_audio_entry *find_entry(const struct sdl2_audio_entry *
  * File loading
  * ========================================================================= */
 
-static sdl2_audio_status_t insert_sound(sdl2_audio_t *ctx, const char *key, const char *path)
+/* Insert/replace a decoded sound into the hash map, taking ownership of
+ * chunk. */
+static sdl2_audio_status_t insert_chunk(sdl2_audio_t *ctx, const char *key, Mix_Chunk *chunk)
 {
     size_t key_len = strlen(key);
     if (key_len > SDL2A_MAX_KEY_LEN)
     {
+        Mix_FreeChunk(chunk);
         return SDL2A_ERR_KEY_TOO_LONG;
     }
 
-    Mix_Chunk *chunk = Mix_LoadWAV(path);
-    if (chunk == NULL)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: failed to load '%s': %s", path,
-                     Mix_GetError());
-        return SDL2A_ERR_LOAD_FAILED;
-    }
-
     struct sdl2_audio_entry *slot = find_slot(ctx->entries, key);
     if (slot == NULL)
     {
@@ -144,12 +169,161 @@ static sdl2_audio_status_t insert_sound(sdl2_audio_t *ctx, const char *key, cons
     memset(slot->key, 0, sizeof(slot->key));
     memcpy(slot->key, key, key_len);
     slot->chunk = chunk;
+    slot->priority = SDL2A_PRIORITY_NORMAL;
     slot->occupied = true;
     ctx->count++;
 
     return SDL2A_OK;
 }
 
+static sdl2_audio_status_t insert_sound(sdl2_audio_t *ctx, const char *key, const char *path)
+{
+    if (strlen(key) > SDL2A_MAX_KEY_LEN)
+    {
+        return SDL2A_ERR_KEY_TOO_LONG;
+    }
+
+    Mix_Chunk *chunk = Mix_LoadWAV(path);
+    if (chunk == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: failed to load '%s': %s", path,
+                     Mix_GetError());
+        return SDL2A_ERR_LOAD_FAILED;
+    }
+    return insert_chunk(ctx, key, chunk);
+}
+
+/* =========================================================================
+ * Decode pool jobs
+ * ========================================================================= */
+
+/* Runs on a decode worker.  SDL errors are per thread, so log here. */
+static void *decode_wav(const char *path)
+{
+    Mix_Chunk *chunk = Mix_LoadWAV(path);
+    if (chunk == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: failed to load '%s': %s", path,
+                     Mix_GetError());
+    }
+    return chunk;
+}
+
+static void free_chunk(void *item)
+{
+    Mix_FreeChunk(item);
+}
+
+static bool visit_load(void *ud, const char *key, const char *path)
+{
+    return insert_sound(ud, key, path) == SDL2A_OK;
+}
+
+static bool visit_queue(void *ud, const char *key, const char *path)
+{
+    return sdl2_decode_submit(ud, SDL2A_DECODE_BATCH, key, path, decode_wav, free_chunk) ==
+           SDL2D_OK;
+}
+
+/* =========================================================================
+ * Asset pack
+ * ========================================================================= */
+
+#define PACK_SOUND_PREFIX "sounds/"
+
+/*
+ * Make a chunk of a pack PCM entry.  When the samples match the opened
+ * device the chunk borrows the mapped bytes (allocated = 0, so
+ * Mix_FreeChunk leaves them alone); otherwise they are converted into a
+ * buffer the chunk owns.
+ */
+static Mix_Chunk *chunk_from_pcm(const asset_pack_entry_t *e)
+{
+    uint32_t src_freq = e->param[0];
+    uint32_t src_format = e->param[1];
+    uint32_t src_channels = e->param[2];
+    if (e->kind != ASSET_PACK_PCM || e->size == 0 || e->size > INT32_MAX / 8 || src_freq == 0 ||
+        src_freq > INT32_MAX || src_format > UINT16_MAX || src_channels == 0 ||
+        src_channels > UINT8_MAX)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: bad pack sound '%s'", e->key);
+        return NULL;
+    }
+
+    int freq = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    if (Mix_QuerySpec(&freq, &format, &channels) == 0)
+    {
+        return NULL;
+    }
+
+    if ((uint32_t)freq == src_freq && format == src_format && (uint32_t)channels == src_channels)
+    {
+        return Mix_QuickLoad_RAW((Uint8 *)e->data, (Uint32)e->size);
+    }
+
+    SDL_AudioCVT cvt;
+    if (SDL_BuildAudioCVT(&cvt, (SDL_AudioFormat)src_format, (Uint8)src_channels, (int)src_freq,
+                          format, (Uint8)channels, freq) < 0)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: cannot convert '%s': %s", e->key,
+                     SDL_GetError());
+        return NULL;
+    }
+    cvt.len = (int)e->size;
+    cvt.buf = SDL_malloc(e->size * (size_t)cvt.len_mult);
+    if (cvt.buf == NULL)
+    {
+        return NULL;
+    }
+    memcpy(cvt.buf, e->data, e->size);
+    if (SDL_ConvertAudio(&cvt) != 0)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: cannot convert '%s': %s", e->key,
+                     SDL_GetError());
+        SDL_free(cvt.buf);
+        return NULL;
+    }
+
+    Mix_Chunk *chunk = Mix_QuickLoad_RAW(cvt.buf, (Uint32)cvt.len_cvt);
+    if (chunk == NULL)
+    {
+        SDL_free(cvt.buf);
+        return NULL;
+    }
+    chunk->allocated = 1;
+    return chunk;
+}
+
+/* Cache every "sounds/" entry of pack.  Returns the number that failed. */
+static int load_pack(sdl2_audio_t *ctx, const asset_pack_t *pack)
+{
+    const size_t prefix_len = strlen(PACK_SOUND_PREFIX);
+    int failures = 0;
+    int n = asset_pack_count(pack);
+    for (int i = 0; i < n; i++)
+    {
+        asset_pack_entry_t e;
+        if (asset_pack_get(pack, i, &e) != ASSET_PACK_OK ||
+            strncmp(e.key, PACK_SOUND_PREFIX, prefix_len) != 0)
+        {
+            continue;
+        }
+        if (strlen(e.key + prefix_len) > SDL2A_MAX_KEY_LEN)
+        {
+            failures++;
+            continue;
+        }
+        Mix_Chunk *chunk = chunk_from_pcm(&e);
+        if (chunk == NULL || insert_chunk(ctx, e.key + prefix_len, chunk) != SDL2A_OK)
+        {
+            failures++;
+        }
+    }
+    return failures;
+}
+
 /* =========================================================================
  * Directory scanning
  * ========================================================================= */
@@ -186,12 +360,15 @@ static bool derive_key(const char *filename, char *key_buf)
     return true;
 }
 
+/* Called for each .wav found; returns false if the file failed. */
+typedef bool (*scan_visit_fn)(void *ud, const char *key, const char *path);
+
 /*
- * Scan a flat directory for .wav files and load each into the cache.
+ * Scan a flat directory for .wav files and pass each to visit.
  * Returns -1 if the directory cannot be opened, or the number of
- * files that failed to load (0 on complete success).
+ * files that failed (0 on complete success).
  */
-static int scan_sound_dir(sdl2_audio_t *ctx, const char *dir_path)
+static int scan_sound_dir(const char *dir_path, scan_visit_fn visit, void *ud)
 {
     DIR *dir = opendir(dir_path);
     if (dir == NULL)
@@ -224,8 +401,7 @@ static int scan_sound_dir(sdl2_audio_t *ctx, const char *dir_path)
             continue;
         }
 
-        sdl2_audio_status_t st = insert_sound(ctx, key_buf, full_path);
-        if (st != SDL2A_OK)
+        if (!visit(ud, key_buf, full_path))
         {
             failures++;
         }
@@ -235,6 +411,34 @@ static int scan_sound_dir(sdl2_audio_t *ctx, const char *dir_path)
     return failures;
 }
 
+/* =========================================================================
+ * Sound ID registry
+ * ========================================================================= */
+
+/* Resolve each registry key to its cache entry, warning about keys with
+ * no cached sound: a missing asset shows up at startup, not on first play. */
+static void resolve_ids(sdl2_audio_t *ctx, const char *const *keys, int count)
+{
+    ctx->id_keys = keys;
+    ctx->id_count = count;
+    for (int id = 0; id < count; id++)
+    {
+        ctx->id_slot[id] = -1;
+        if (keys[id] == NULL)
+        {
+            continue;
+        }
+        const struct sdl2_audio_entry *e = find_entry(ctx->entries, keys[id]);
+        if (e == NULL)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: no sound for id %d ('%s')", id,
+                        keys[id]);
+            continue;
+        }
+        ctx->id_slot[id] = (short)(e - ctx->entries);
+    }
+}
+
 /* =========================================================================
  * Public API
  * ========================================================================= */
@@ -262,6 +466,23 @@ sdl2_audio_t *sdl2_audio_create(const sdl2_audio_config_t *config, sdl2_audio_st
         return NULL;
     }
 
+    if (config->id_keys == NULL && config->id_count > 0)
+    {
+        if (status != NULL)
+        {
+            *status = SDL2A_ERR_NULL_ARG;
+        }
+        return NULL;
+    }
+    if (config->id_count < 0 || config->id_count > SDL2A_MAX_SOUNDS)
+    {
+        if (status != NULL)
+        {
+            *status = SDL2A_ERR_CACHE_FULL;
+        }
+        return NULL;
+    }
+
     sdl2_audio_t *ctx = calloc(1, sizeof(*ctx));
     if (ctx == NULL)
     {
@@ -313,8 +534,21 @@ sdl2_audio_t *sdl2_audio_create(const sdl2_audio_config_t *config, sdl2_audio_st
     ctx->audio_opened = true;
     ctx->mixer_initialized = true;
 
-    /* Allocate playback channels. */
-    Mix_AllocateChannels(config->channels);
+    /* Allocate playback channels and a voice record for each. */
+    ctx->voice_count = Mix_AllocateChannels(config->channels);
+    if (ctx->voice_count > 0)
+    {
+        ctx->voices = calloc((size_t)ctx->voice_count, sizeof(*ctx->voices));
+        if (ctx->voices == NULL)
+        {
+            sdl2_audio_destroy(ctx);
+            if (status != NULL)
+            {
+                *status = SDL2A_ERR_INIT_FAILED;
+            }
+            return NULL;
+        }
+    }
 
     /* Set initial volume on all channels. */
     Mix_Volume(-1, ctx->volume);
@@ -322,7 +556,23 @@ sdl2_audio_t *sdl2_audio_create(const sdl2_audio_config_t *config, sdl2_audio_st
     /* Scan the sound directory. */
     const char *sound_dir = config->sound_dir != NULL ? config->sound_dir : SDL2A_DEFAULT_SOUND_DIR;
 
-    int failures = scan_sound_dir(ctx, sound_dir);
+    /* With a decoder, only queue the files here; finish_decode() collects
+     * them.  The device is open, so the workers decode to its format. */
+    bool from_pack = asset_pack_count_prefix(config->pack, PACK_SOUND_PREFIX) > 0;
+    int failures;
+    if (from_pack)
+    {
+        sound_dir = "asset pack";
+        failures = load_pack(ctx, config->pack);
+    }
+    else if (config->decoder != NULL)
+    {
+        failures = scan_sound_dir(sound_dir, visit_queue, config->decoder);
+    }
+    else
+    {
+        failures = scan_sound_dir(sound_dir, visit_load, ctx);
+    }
     if (failures < 0)
     {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: cannot open directory '%s'",
@@ -341,6 +591,17 @@ sdl2_audio_t *sdl2_audio_create(const sdl2_audio_config_t *config, sdl2_audio_st
                     failures, sound_dir);
     }
 
+    if (config->decoder != NULL && !from_pack)
+    {
+        ctx->decoder = config->decoder;
+        ctx->pending_id_keys = config->id_keys;
+        ctx->pending_id_count = config->id_count;
+    }
+    else
+    {
+        resolve_ids(ctx, config->id_keys, config->id_count);
+    }
+
     if (status != NULL)
     {
         *status = SDL2A_OK;
@@ -348,6 +609,33 @@ sdl2_audio_t *sdl2_audio_create(const sdl2_audio_config_t *config, sdl2_audio_st
     return ctx;
 }
 
+int sdl2_audio_finish_decode(sdl2_audio_t *ctx)
+{
+    if (ctx == NULL || ctx->decoder == NULL)
+    {
+        return 0;
+    }
+
+    int failures = 0;
+    sdl2_decode_result_t r;
+    while (sdl2_decode_take(ctx->decoder, SDL2A_DECODE_BATCH, &r))
+    {
+        if (r.item == NULL || insert_chunk(ctx, r.key, r.item) != SDL2A_OK)
+        {
+            failures++;
+        }
+    }
+    if (failures > 0)
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: %d decoded file(s) failed",
+                    failures);
+    }
+
+    resolve_ids(ctx, ctx->pending_id_keys, ctx->pending_id_count);
+    ctx->decoder = NULL;
+    return failures;
+}
+
 void sdl2_audio_destroy(sdl2_audio_t *ctx)
 {
     if (ctx == NULL)
@@ -379,6 +667,7 @@ void sdl2_audio_destroy(sdl2_audio_t *ctx)
         SDL_QuitSubSystem(SDL_INIT_AUDIO);
     }
 
+    free(ctx->voices);
     free(ctx);
 }
 
@@ -401,41 +690,93 @@ static void log_append(sdl2_audio_t *ctx, const char *name, sdl2_audio_status_t
     }
 }
 
-// cppcheck-suppress constParameterPointer
-sdl2_audio_status_t sdl2_audio_play(sdl2_audio_t *ctx, const char *name)
+/* =========================================================================
+ * Voice manager
+ * ========================================================================= */
+
+/* A channel already playing this chunk, started in the current tick. */
+static int find_coalesce_voice(const sdl2_audio_t *ctx, const Mix_Chunk *chunk)
 {
-    if (ctx == NULL || name == NULL)
+    for (int ch = 0; ch < ctx->voice_count; ch++)
     {
-        return SDL2A_ERR_NULL_ARG;
+        const sdl2_audio_voice_t *v = &ctx->voices[ch];
+        if (v->chunk == chunk && v->tick == ctx->tick && Mix_Playing(ch))
+        {
+            return ch;
+        }
     }
-    if (ctx->muted)
+    return -1;
+}
+
+/* The voice to steal for a sound of the given priority: the lowest
+ * priority at or below it, oldest first.  -1 if every voice outranks it. */
+static int find_steal_voice(const sdl2_audio_t *ctx, sdl2_audio_priority_t priority)
+{
+    int best = -1;
+    for (int ch = 0; ch < ctx->voice_count; ch++)
     {
-        log_append(ctx, name, SDL2A_OK);
-        return SDL2A_OK;
+        const sdl2_audio_voice_t *v = &ctx->voices[ch];
+        if (v->priority > priority)
+        {
+            continue;
+        }
+        if (best < 0 || v->priority < ctx->voices[best].priority ||
+            (v->priority == ctx->voices[best].priority && v->serial < ctx->voices[best].serial))
+        {
+            best = ch;
+        }
     }
+    return best;
+}
 
-    const struct sdl2_audio_entry *e = find_entry(ctx->entries, name);
-    if (e == NULL)
+/*
+ * Start a cached sound at an SDL volume (0-128) and log the call.
+ * A repeat of a sound already started this tick raises that voice's
+ * volume instead of taking another channel.  With every channel busy,
+ * the oldest lowest-priority voice not above this sound is stolen;
+ * failing that the sound is dropped.
+ */
+static sdl2_audio_status_t play_entry(sdl2_audio_t *ctx, const char *name,
+                                      const struct sdl2_audio_entry *e, int sdl_vol)
+{
+    int channel = find_coalesce_voice(ctx, e->chunk);
+    if (channel >= 0)
     {
-        log_append(ctx, name, SDL2A_ERR_NOT_FOUND);
-        return SDL2A_ERR_NOT_FOUND;
+        sdl2_audio_voice_t *v = &ctx->voices[channel];
+        if (sdl_vol > v->volume)
+        {
+            Mix_Volume(channel, sdl_vol);
+            v->volume = sdl_vol;
+        }
+        ctx->voice_stats.coalesced++;
+        log_append(ctx, name, SDL2A_OK);
+        return SDL2A_OK;
     }
 
-    /* Reserve an available channel first, set its volume, then start
-     * playback on that explicit channel.  If we used the more common
+    /* Reserve a channel first, set its volume, then start playback on
+     * that explicit channel.  If we used the more common
      * Mix_PlayChannel(-1, ...) here, SDL_mixer would start the play
      * using the channel's current volume — which could be a stale
      * per-call attenuation left by a prior sdl2_audio_play_at_percent()
-     * — and only switch to ctx->volume after the play started, giving
-     * an audible volume jump on the first samples. */
-    int channel = Mix_GroupAvailable(-1);
+     * — and only switch to the new volume after the play started,
+     * giving an audible volume jump on the first samples.  Using
+     * per-channel volume (rather than Mix_VolumeChunk) keeps concurrent
+     * plays of the same chunk on different channels independent. */
+    channel = Mix_GroupAvailable(-1);
     if (channel == -1)
     {
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: no free channel for '%s'", name);
-        log_append(ctx, name, SDL2A_ERR_PLAY_FAILED);
-        return SDL2A_ERR_PLAY_FAILED;
+        channel = find_steal_voice(ctx, e->priority);
+        if (channel == -1)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: no free channel for '%s'", name);
+            ctx->voice_stats.dropped++;
+            log_append(ctx, name, SDL2A_ERR_PLAY_FAILED);
+            return SDL2A_ERR_PLAY_FAILED;
+        }
+        Mix_HaltChannel(channel);
+        ctx->voice_stats.stolen++;
     }
-    Mix_Volume(channel, ctx->volume);
+    Mix_Volume(channel, sdl_vol);
     if (Mix_PlayChannel(channel, e->chunk, 0) == -1)
     {
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: Mix_PlayChannel('%s'): %s", name,
@@ -444,10 +785,60 @@ sdl2_audio_status_t sdl2_audio_play(sdl2_audio_t *ctx, const char *name)
         return SDL2A_ERR_PLAY_FAILED;
     }
 
+    if (channel < ctx->voice_count)
+    {
+        sdl2_audio_voice_t *v = &ctx->voices[channel];
+        v->chunk = e->chunk;
+        v->priority = e->priority;
+        v->serial = ctx->next_serial++;
+        v->tick = ctx->tick;
+        v->volume = sdl_vol;
+    }
     log_append(ctx, name, SDL2A_OK);
     return SDL2A_OK;
 }
 
+/* SDL volume for a per-call percentage (clamped to 0-100) of master. */
+static int percent_of_master(const sdl2_audio_t *ctx, int percent)
+{
+    if (percent < 0)
+        percent = 0;
+    if (percent > 100)
+        percent = 100;
+    /* Percent is relative to the configured master volume — matches
+     * the Sun backend's setNewVolume() which scaled by the system's
+     * maxVolume rather than an absolute device max.  At percent=100
+     * a per-call play is exactly as loud as sdl2_audio_play(); at
+     * percent=50 it is half-master; etc.  Round (rather than truncate
+     * toward zero) so a low master volume isn't silenced by small
+     * percent values — e.g. ctx->volume=1 + percent=50 stays audible.
+     * Matches the rounding pattern in percent_to_sdl(). */
+    return (ctx->volume * percent + 50) / 100;
+}
+
+// cppcheck-suppress constParameterPointer
+sdl2_audio_status_t sdl2_audio_play(sdl2_audio_t *ctx, const char *name)
+{
+    if (ctx == NULL || name == NULL)
+    {
+        return SDL2A_ERR_NULL_ARG;
+    }
+    if (ctx->muted)
+    {
+        log_append(ctx, name, SDL2A_OK);
+        return SDL2A_OK;
+    }
+
+    const struct sdl2_audio_entry *e = find_entry(ctx->entries, name);
+    if (e == NULL)
+    {
+        log_append(ctx, name, SDL2A_ERR_NOT_FOUND);
+        return SDL2A_ERR_NOT_FOUND;
+    }
+
+    return play_entry(ctx, name, e, ctx->volume);
+}
+
 sdl2_audio_status_t sdl2_audio_play_at_percent(sdl2_audio_t *ctx, const char *name, int percent)
 {
     if (ctx == NULL || name == NULL)
@@ -467,46 +858,92 @@ sdl2_audio_status_t sdl2_audio_play_at_percent(sdl2_audio_t *ctx, const char *na
         return SDL2A_ERR_NOT_FOUND;
     }
 
-    if (percent < 0)
-        percent = 0;
-    if (percent > 100)
-        percent = 100;
-    /* Percent is relative to the configured master volume — matches
-     * the Sun backend's setNewVolume() which scaled by the system's
-     * maxVolume rather than an absolute device max.  At percent=100
-     * a per-call play is exactly as loud as sdl2_audio_play(); at
-     * percent=50 it is half-master; etc.  Round (rather than truncate
-     * toward zero) so a low master volume isn't silenced by small
-     * percent values — e.g. ctx->volume=1 + percent=50 stays audible.
-     * Matches the rounding pattern in percent_to_sdl(). */
-    int sdl_vol = (ctx->volume * percent + 50) / 100;
-
-    /* Reserve a free channel first, set its volume, then start the play
-     * on that explicit channel.  Setting the volume after Mix_PlayChannel
-     * would let the first samples come out at the recycled channel's
-     * prior volume before switching to sdl_vol.  Using per-channel volume
-     * (rather than Mix_VolumeChunk) keeps concurrent plays of the same
-     * chunk on different channels independent. */
-    int channel = Mix_GroupAvailable(-1);
-    if (channel == -1)
+    return play_entry(ctx, name, e, percent_of_master(ctx, percent));
+}
+
+sdl2_audio_status_t sdl2_audio_play_id(sdl2_audio_t *ctx, int id, int percent)
+{
+    if (ctx == NULL)
     {
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: no free channel for '%s'", name);
-        log_append(ctx, name, SDL2A_ERR_PLAY_FAILED);
-        return SDL2A_ERR_PLAY_FAILED;
+        return SDL2A_ERR_NULL_ARG;
     }
-    Mix_Volume(channel, sdl_vol);
-    if (Mix_PlayChannel(channel, e->chunk, 0) == -1)
+    if (id < 0 || id >= ctx->id_count || ctx->id_keys[id] == NULL)
     {
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_audio: Mix_PlayChannel('%s'): %s", name,
-                    Mix_GetError());
-        log_append(ctx, name, SDL2A_ERR_PLAY_FAILED);
-        return SDL2A_ERR_PLAY_FAILED;
+        char label[24];
+        snprintf(label, sizeof(label), "#%d", id);
+        log_append(ctx, label, SDL2A_ERR_NOT_FOUND);
+        return SDL2A_ERR_NOT_FOUND;
     }
 
-    log_append(ctx, name, SDL2A_OK);
+    const char *name = ctx->id_keys[id];
+    if (ctx->muted)
+    {
+        log_append(ctx, name, SDL2A_OK);
+        return SDL2A_OK;
+    }
+    if (ctx->id_slot[id] < 0)
+    {
+        log_append(ctx, name, SDL2A_ERR_NOT_FOUND);
+        return SDL2A_ERR_NOT_FOUND;
+    }
+
+    return play_entry(ctx, name, &ctx->entries[ctx->id_slot[id]], percent_of_master(ctx, percent));
+}
+
+sdl2_audio_status_t sdl2_audio_set_priority(sdl2_audio_t *ctx, const char *name,
+                                            sdl2_audio_priority_t priority)
+{
+    if (ctx == NULL || name == NULL)
+    {
+        return SDL2A_ERR_NULL_ARG;
+    }
+    struct sdl2_audio_entry *e = find_slot(ctx->entries, name);
+    if (e == NULL || !e->occupied)
+    {
+        return SDL2A_ERR_NOT_FOUND;
+    }
+    e->priority = priority;
     return SDL2A_OK;
 }
 
+sdl2_audio_status_t sdl2_audio_set_priority_id(sdl2_audio_t *ctx, int id,
+                                               sdl2_audio_priority_t priority)
+{
+    if (ctx == NULL)
+    {
+        return SDL2A_ERR_NULL_ARG;
+    }
+    if (id < 0 || id >= ctx->id_count || ctx->id_slot[id] < 0)
+    {
+        return SDL2A_ERR_NOT_FOUND;
+    }
+    ctx->entries[ctx->id_slot[id]].priority = priority;
+    return SDL2A_OK;
+}
+
+void sdl2_audio_begin_tick(sdl2_audio_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    ctx->tick++;
+}
+
+void sdl2_audio_get_voice_stats(const sdl2_audio_t *ctx, sdl2_audio_voice_stats_t *out)
+{
+    if (out == NULL)
+    {
+        return;
+    }
+    if (ctx == NULL)
+    {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    *out = ctx->voice_stats;
+}
+
 int sdl2_audio_log_snapshot(const sdl2_audio_t *ctx, sdl2_audio_call_t *out, int out_capacity)
 {
     if (ctx == NULL || out == NULL || out_capacity <= 0)
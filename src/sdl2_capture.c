@@ -0,0 +1,364 @@
+/*
+ * sdl2_capture.c — Asynchronous frame capture to PNG files.
+ *
+ * See include/sdl2_capture.h for API documentation.
+ * See ADR-093 in docs/DESIGN.md for design rationale.
+ */
+
+#include "sdl2_capture.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL_image.h>
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+typedef struct
+{
+    SDL_Surface *surface; /* Frame pixels; reallocated when the size changes */
+    char path[SDL2CAP_MAX_PATH];
+} capture_buffer_t;
+
+/*
+ * Each buffer is in exactly one place: the free stack, the queue, or
+ * owned by one thread (the render thread filling it, the encoder writing
+ * it).  Only the owner touches its surface and path; `lock` guards the
+ * stack, the queue and the counters.
+ */
+struct sdl2_capture
+{
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *changed; /* Broadcast on every queue, write and quit */
+
+    int count;
+    capture_buffer_t *buffers;
+    int *free_stack;
+    int free_top;
+    int *queue; /* Ring of buffer indices in capture order */
+    int queue_head;
+    int queued;
+    int encoding; /* Buffers the encoder is writing (0 or 1) */
+    bool quit;
+
+    int written;
+    int failed;
+};
+
+/* =========================================================================
+ * Encoder thread
+ * ========================================================================= */
+
+static int encoder_main(void *data)
+{
+    sdl2_capture_t *ctx = data;
+
+    SDL_LockMutex(ctx->lock);
+    for (;;)
+    {
+        while (ctx->queued == 0 && !ctx->quit)
+        {
+            SDL_CondWait(ctx->changed, ctx->lock);
+        }
+        if (ctx->queued == 0)
+        {
+            break; /* Quit with the queue drained */
+        }
+        int idx = ctx->queue[ctx->queue_head];
+        ctx->queue_head = (ctx->queue_head + 1) % ctx->count;
+        ctx->queued--;
+        ctx->encoding++;
+        SDL_UnlockMutex(ctx->lock);
+
+        capture_buffer_t *buf = &ctx->buffers[idx];
+        int rc = IMG_SavePNG(buf->surface, buf->path);
+
+        SDL_LockMutex(ctx->lock);
+        if (rc == 0)
+        {
+            ctx->written++;
+        }
+        else
+        {
+            ctx->failed++;
+        }
+        ctx->encoding--;
+        ctx->free_stack[ctx->free_top++] = idx;
+        SDL_CondBroadcast(ctx->changed);
+    }
+    SDL_UnlockMutex(ctx->lock);
+    return 0;
+}
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+/* Take a free buffer, waiting for the encoder if there is none. */
+static int acquire_buffer(sdl2_capture_t *ctx)
+{
+    SDL_LockMutex(ctx->lock);
+    while (ctx->free_top == 0)
+    {
+        SDL_CondWait(ctx->changed, ctx->lock);
+    }
+    int idx = ctx->free_stack[--ctx->free_top];
+    SDL_UnlockMutex(ctx->lock);
+    return idx;
+}
+
+static void release_buffer(sdl2_capture_t *ctx, int idx)
+{
+    SDL_LockMutex(ctx->lock);
+    ctx->free_stack[ctx->free_top++] = idx;
+    SDL_CondBroadcast(ctx->changed);
+    SDL_UnlockMutex(ctx->lock);
+}
+
+/* The viewport in output pixels: what SDL_RenderReadPixels reads. */
+static SDL_Rect output_viewport(SDL_Renderer *renderer)
+{
+    SDL_Rect vp;
+    float sx = 1.0f;
+    float sy = 1.0f;
+    SDL_RenderGetViewport(renderer, &vp);
+    SDL_RenderGetScale(renderer, &sx, &sy);
+    SDL_Rect r = {(int)((float)vp.x * sx), (int)((float)vp.y * sy), (int)((float)vp.w * sx),
+                  (int)((float)vp.h * sy)};
+    return r;
+}
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+sdl2_capture_config_t sdl2_capture_config_defaults(void)
+{
+    sdl2_capture_config_t cfg;
+    cfg.buffers = 4;
+    return cfg;
+}
+
+sdl2_capture_t *sdl2_capture_create(const sdl2_capture_config_t *config,
+                                    sdl2_capture_status_t *status)
+{
+    sdl2_capture_status_t st = SDL2CAP_OK;
+    sdl2_capture_t *ctx = NULL;
+
+    if (config == NULL)
+    {
+        st = SDL2CAP_ERR_NULL_ARG;
+        goto fail;
+    }
+    if (config->buffers < 1)
+    {
+        st = SDL2CAP_ERR_BAD_CONFIG;
+        goto fail;
+    }
+
+    ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        st = SDL2CAP_ERR_ALLOC_FAILED;
+        goto fail;
+    }
+    ctx->count = config->buffers;
+    ctx->buffers = calloc((size_t)ctx->count, sizeof(*ctx->buffers));
+    ctx->free_stack = calloc((size_t)ctx->count, sizeof(*ctx->free_stack));
+    ctx->queue = calloc((size_t)ctx->count, sizeof(*ctx->queue));
+    ctx->lock = SDL_CreateMutex();
+    ctx->changed = SDL_CreateCond();
+    if (ctx->buffers == NULL || ctx->free_stack == NULL || ctx->queue == NULL ||
+        ctx->lock == NULL || ctx->changed == NULL)
+    {
+        st = SDL2CAP_ERR_ALLOC_FAILED;
+        goto fail;
+    }
+    for (int i = 0; i < ctx->count; i++)
+    {
+        ctx->free_stack[i] = i;
+    }
+    ctx->free_top = ctx->count;
+
+    ctx->thread = SDL_CreateThread(encoder_main, "xboing-capture", ctx);
+    if (ctx->thread == NULL)
+    {
+        st = SDL2CAP_ERR_THREAD_FAILED;
+        goto fail;
+    }
+
+    if (status != NULL)
+    {
+        *status = SDL2CAP_OK;
+    }
+    return ctx;
+
+fail:
+    sdl2_capture_destroy(ctx);
+    if (status != NULL)
+    {
+        *status = st;
+    }
+    return NULL;
+}
+
+void sdl2_capture_destroy(sdl2_capture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    if (ctx->thread != NULL)
+    {
+        SDL_LockMutex(ctx->lock);
+        ctx->quit = true;
+        SDL_CondBroadcast(ctx->changed);
+        SDL_UnlockMutex(ctx->lock);
+        SDL_WaitThread(ctx->thread, NULL);
+    }
+
+    if (ctx->buffers != NULL)
+    {
+        for (int i = 0; i < ctx->count; i++)
+        {
+            SDL_FreeSurface(ctx->buffers[i].surface);
+        }
+    }
+    free(ctx->buffers);
+    free(ctx->free_stack);
+    free(ctx->queue);
+    if (ctx->changed != NULL)
+    {
+        SDL_DestroyCond(ctx->changed);
+    }
+    if (ctx->lock != NULL)
+    {
+        SDL_DestroyMutex(ctx->lock);
+    }
+    free(ctx);
+}
+
+/* =========================================================================
+ * Public API — Capture
+ * ========================================================================= */
+
+sdl2_capture_status_t sdl2_capture_frame(sdl2_capture_t *ctx, SDL_Renderer *renderer,
+                                         const char *path)
+{
+    if (ctx == NULL || renderer == NULL || path == NULL)
+    {
+        return SDL2CAP_ERR_NULL_ARG;
+    }
+    size_t len = strlen(path);
+    if (len >= SDL2CAP_MAX_PATH)
+    {
+        return SDL2CAP_ERR_PATH_TOO_LONG;
+    }
+
+    SDL_Rect rect = output_viewport(renderer);
+    if (rect.w <= 0 || rect.h <= 0)
+    {
+        return SDL2CAP_ERR_READ_FAILED;
+    }
+
+    int idx = acquire_buffer(ctx);
+    capture_buffer_t *buf = &ctx->buffers[idx];
+
+    if (buf->surface == NULL || buf->surface->w != rect.w || buf->surface->h != rect.h)
+    {
+        SDL_FreeSurface(buf->surface);
+        buf->surface =
+            SDL_CreateRGBSurfaceWithFormat(0, rect.w, rect.h, 32, SDL_PIXELFORMAT_RGBA32);
+        if (buf->surface == NULL)
+        {
+            release_buffer(ctx, idx);
+            return SDL2CAP_ERR_ALLOC_FAILED;
+        }
+    }
+    if (SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_RGBA32, buf->surface->pixels,
+                             buf->surface->pitch) != 0)
+    {
+        release_buffer(ctx, idx);
+        return SDL2CAP_ERR_READ_FAILED;
+    }
+    memcpy(buf->path, path, len + 1);
+
+    SDL_LockMutex(ctx->lock);
+    ctx->queue[(ctx->queue_head + ctx->queued) % ctx->count] = idx;
+    ctx->queued++;
+    SDL_CondBroadcast(ctx->changed);
+    SDL_UnlockMutex(ctx->lock);
+    return SDL2CAP_OK;
+}
+
+void sdl2_capture_flush(sdl2_capture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    SDL_LockMutex(ctx->lock);
+    while (ctx->queued > 0 || ctx->encoding > 0)
+    {
+        SDL_CondWait(ctx->changed, ctx->lock);
+    }
+    SDL_UnlockMutex(ctx->lock);
+}
+
+/* =========================================================================
+ * Public API — Queries
+ * ========================================================================= */
+
+int sdl2_capture_written(const sdl2_capture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    SDL_LockMutex(ctx->lock);
+    int n = ctx->written;
+    SDL_UnlockMutex(ctx->lock);
+    return n;
+}
+
+int sdl2_capture_failed(const sdl2_capture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    SDL_LockMutex(ctx->lock);
+    int n = ctx->failed;
+    SDL_UnlockMutex(ctx->lock);
+    return n;
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *sdl2_capture_status_string(sdl2_capture_status_t status)
+{
+    switch (status)
+    {
+        case SDL2CAP_OK:
+            return "OK";
+        case SDL2CAP_ERR_NULL_ARG:
+            return "NULL argument";
+        case SDL2CAP_ERR_BAD_CONFIG:
+            return "invalid configuration";
+        case SDL2CAP_ERR_ALLOC_FAILED:
+            return "allocation failed";
+        case SDL2CAP_ERR_THREAD_FAILED:
+            return "cannot start encoder thread";
+        case SDL2CAP_ERR_PATH_TOO_LONG:
+            return "path too long";
+        case SDL2CAP_ERR_READ_FAILED:
+            return "cannot read frame pixels";
+    }
+    return "unknown status";
+}
@@ -112,9 +112,22 @@ sdl2_cli_config_t sdl2_cli_config_defaults(void)
     cfg.max_volume = 80;
     cfg.debug = false;
     cfg.grab = false;
+    cfg.offscreen = false;
     cfg.visual_capture_mode = -1;
     cfg.visual_capture_interval = 100;
+    cfg.capture_dir = NULL;
     cfg.autoload = false;
+    cfg.record_path = NULL;
+    cfg.replay_path = NULL;
+    cfg.replay_fast = false;
+    cfg.turbo = false;
+    cfg.atlas = true;
+    cfg.layers = true;
+    cfg.pace = true;
+    cfg.trace_path = NULL;
+    cfg.startup_profile = false;
+    cfg.asset_pack_path = NULL;
+    cfg.texture_budget = -1;
     return cfg;
 }
 
@@ -194,11 +207,46 @@ sdl2_cli_status_t sdl2_cli_parse(int argc, char *const argv[], sdl2_cli_config_t
             config->grab = true;
             continue;
         }
+        if (match_option(arg, "-offscreen"))
+        {
+            config->offscreen = true;
+            continue;
+        }
         if (match_option(arg, "-load"))
         {
             config->autoload = true;
             continue;
         }
+        if (match_option(arg, "-replay-fast"))
+        {
+            config->replay_fast = true;
+            continue;
+        }
+        if (match_option(arg, "-turbo"))
+        {
+            config->turbo = true;
+            continue;
+        }
+        if (match_option(arg, "-noatlas"))
+        {
+            config->atlas = false;
+            continue;
+        }
+        if (match_option(arg, "-nolayers"))
+        {
+            config->layers = false;
+            continue;
+        }
+        if (match_option(arg, "-nopace"))
+        {
+            config->pace = false;
+            continue;
+        }
+        if (match_option(arg, "-startup-profile"))
+        {
+            config->startup_profile = true;
+            continue;
+        }
 
         /* Options with integer arguments. */
         if (match_option(arg, "-speed"))
@@ -273,6 +321,30 @@ sdl2_cli_status_t sdl2_cli_parse(int argc, char *const argv[], sdl2_cli_config_t
             continue;
         }
 
+        if (match_option(arg, "-texture-budget"))
+        {
+            int val = 0;
+            parse_int_result_t r = parse_int_arg(argc, argv, &i, &val);
+            if (r == PARSE_INT_MISSING)
+            {
+                if (bad_option != NULL)
+                {
+                    *bad_option = arg;
+                }
+                return SDL2C_ERR_MISSING_VALUE;
+            }
+            if (r == PARSE_INT_INVALID || val < 0 || val > SDL2C_MAX_TEXTURE_BUDGET)
+            {
+                if (bad_option != NULL)
+                {
+                    *bad_option = arg;
+                }
+                return SDL2C_ERR_INVALID_VALUE;
+            }
+            config->texture_budget = val;
+            continue;
+        }
+
         /* Option with string argument. */
         if (match_option(arg, "-nickname"))
         {
@@ -297,6 +369,60 @@ sdl2_cli_status_t sdl2_cli_parse(int argc, char *const argv[], sdl2_cli_config_t
             continue;
         }
 
+        if (match_option(arg, "-record") || match_option(arg, "-replay"))
+        {
+            const char **dest =
+                match_option(arg, "-record") ? &config->record_path : &config->replay_path;
+            if (!parse_str_arg(argc, argv, &i, dest))
+            {
+                if (bad_option != NULL)
+                {
+                    *bad_option = arg;
+                }
+                return SDL2C_ERR_MISSING_VALUE;
+            }
+            continue;
+        }
+
+        if (match_option(arg, "-trace"))
+        {
+            if (!parse_str_arg(argc, argv, &i, &config->trace_path))
+            {
+                if (bad_option != NULL)
+                {
+                    *bad_option = arg;
+                }
+                return SDL2C_ERR_MISSING_VALUE;
+            }
+            continue;
+        }
+
+        if (match_option(arg, "-asset-pack"))
+        {
+            if (!parse_str_arg(argc, argv, &i, &config->asset_pack_path))
+            {
+                if (bad_option != NULL)
+                {
+                    *bad_option = arg;
+                }
+                return SDL2C_ERR_MISSING_VALUE;
+            }
+            continue;
+        }
+
+        if (match_option(arg, "-capture-dir"))
+        {
+            if (!parse_str_arg(argc, argv, &i, &config->capture_dir))
+            {
+                if (bad_option != NULL)
+                {
+                    *bad_option = arg;
+                }
+                return SDL2C_ERR_MISSING_VALUE;
+            }
+            continue;
+        }
+
         if (match_option(arg, "-visual-capture"))
         {
             const char *val = NULL;
@@ -0,0 +1,393 @@
+/*
+ * sdl2_decode.c — Worker pool that decodes asset files off the main thread.
+ *
+ * See include/sdl2_decode.h for API documentation.
+ * See ADR-097 in docs/DESIGN.md for design rationale.
+ */
+
+#include "sdl2_decode.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+typedef enum
+{
+    JOB_QUEUED = 0,
+    JOB_RUNNING,
+    JOB_DONE,
+    JOB_TAKEN
+} job_state_t;
+
+typedef struct
+{
+    int batch;
+    char key[SDL2D_MAX_KEY];
+    char path[SDL2D_MAX_PATH];
+    sdl2_decode_fn decode;
+    sdl2_decode_free_fn free_fn;
+    void *item;
+    job_state_t state;
+} decode_job_t;
+
+/*
+ * Jobs are appended in submission order and never removed, so a job is
+ * named by its index: workers start them in index order (next_job), and
+ * done_order lists them in completion order for take().  `lock` guards
+ * everything below it; a worker copies what it needs out of its job
+ * before unlocking, because a submit may reallocate the array.
+ */
+struct sdl2_decode
+{
+    SDL_Thread *threads[SDL2D_MAX_THREADS];
+    int thread_count;
+    SDL_mutex *lock;
+    SDL_cond *work; /* Signalled on submit and quit */
+    SDL_cond *done; /* Broadcast when a job completes */
+
+    decode_job_t *jobs;
+    int job_count;
+    int job_capacity;
+    int next_job;
+    int *done_order;
+    int done_count;
+    bool quit;
+
+    sdl2_decode_stats_t stats;
+};
+
+/* =========================================================================
+ * Worker threads
+ * ========================================================================= */
+
+static int worker_main(void *data)
+{
+    sdl2_decode_t *ctx = data;
+    char path[SDL2D_MAX_PATH];
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+
+    SDL_LockMutex(ctx->lock);
+    for (;;)
+    {
+        while (ctx->next_job >= ctx->job_count && !ctx->quit)
+        {
+            SDL_CondWait(ctx->work, ctx->lock);
+        }
+        if (ctx->quit)
+        {
+            break;
+        }
+        int idx = ctx->next_job++;
+        decode_job_t *job = &ctx->jobs[idx];
+        job->state = JOB_RUNNING;
+        memcpy(path, job->path, sizeof(path));
+        sdl2_decode_fn decode = job->decode;
+        SDL_UnlockMutex(ctx->lock);
+
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        void *item = decode(path);
+        Uint64 ticks = SDL_GetPerformanceCounter() - t0;
+
+        SDL_LockMutex(ctx->lock);
+        job = &ctx->jobs[idx];
+        job->item = item;
+        job->state = JOB_DONE;
+        ctx->done_order[ctx->done_count++] = idx;
+        ctx->stats.decoded++;
+        if (item == NULL)
+        {
+            ctx->stats.failed++;
+        }
+        ctx->stats.work_us += ticks / freq * 1000000U + ticks % freq * 1000000U / freq;
+        SDL_CondBroadcast(ctx->done);
+    }
+    SDL_UnlockMutex(ctx->lock);
+    return 0;
+}
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+/* Make room for one more job.  Called with the lock held. */
+static bool grow_jobs(sdl2_decode_t *ctx)
+{
+    if (ctx->job_count < ctx->job_capacity)
+    {
+        return true;
+    }
+    int cap = ctx->job_capacity > 0 ? ctx->job_capacity * 2 : 64;
+    decode_job_t *jobs = realloc(ctx->jobs, (size_t)cap * sizeof(*jobs));
+    if (jobs == NULL)
+    {
+        return false;
+    }
+    ctx->jobs = jobs;
+    int *order = realloc(ctx->done_order, (size_t)cap * sizeof(*order));
+    if (order == NULL)
+    {
+        return false;
+    }
+    ctx->done_order = order;
+    ctx->job_capacity = cap;
+    return true;
+}
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+sdl2_decode_config_t sdl2_decode_config_defaults(void)
+{
+    sdl2_decode_config_t cfg;
+    cfg.threads = 0;
+    return cfg;
+}
+
+sdl2_decode_t *sdl2_decode_create(const sdl2_decode_config_t *config,
+                                  sdl2_decode_status_t *status)
+{
+    sdl2_decode_status_t st = SDL2D_OK;
+    sdl2_decode_t *ctx = NULL;
+
+    if (config == NULL)
+    {
+        st = SDL2D_ERR_NULL_ARG;
+        goto fail;
+    }
+    if (config->threads < 0 || config->threads > SDL2D_MAX_THREADS)
+    {
+        st = SDL2D_ERR_BAD_CONFIG;
+        goto fail;
+    }
+
+    ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        st = SDL2D_ERR_ALLOC_FAILED;
+        goto fail;
+    }
+    ctx->lock = SDL_CreateMutex();
+    ctx->work = SDL_CreateCond();
+    ctx->done = SDL_CreateCond();
+    if (ctx->lock == NULL || ctx->work == NULL || ctx->done == NULL)
+    {
+        st = SDL2D_ERR_ALLOC_FAILED;
+        goto fail;
+    }
+
+    int threads = config->threads;
+    if (threads == 0)
+    {
+        threads = SDL_GetCPUCount();
+        if (threads < 1)
+        {
+            threads = 1;
+        }
+        if (threads > SDL2D_MAX_THREADS)
+        {
+            threads = SDL2D_MAX_THREADS;
+        }
+    }
+    for (int i = 0; i < threads; i++)
+    {
+        ctx->threads[i] = SDL_CreateThread(worker_main, "xboing-decode", ctx);
+        if (ctx->threads[i] == NULL)
+        {
+            st = SDL2D_ERR_THREAD_FAILED;
+            goto fail;
+        }
+        ctx->thread_count++;
+    }
+
+    if (status != NULL)
+    {
+        *status = SDL2D_OK;
+    }
+    return ctx;
+
+fail:
+    sdl2_decode_destroy(ctx);
+    if (status != NULL)
+    {
+        *status = st;
+    }
+    return NULL;
+}
+
+void sdl2_decode_destroy(sdl2_decode_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    if (ctx->thread_count > 0)
+    {
+        SDL_LockMutex(ctx->lock);
+        ctx->quit = true;
+        SDL_CondBroadcast(ctx->work);
+        SDL_UnlockMutex(ctx->lock);
+        for (int i = 0; i < ctx->thread_count; i++)
+        {
+            SDL_WaitThread(ctx->threads[i], NULL);
+        }
+    }
+
+    for (int i = 0; i < ctx->job_count; i++)
+    {
+        decode_job_t *job = &ctx->jobs[i];
+        if (job->state == JOB_DONE && job->item != NULL && job->free_fn != NULL)
+        {
+            job->free_fn(job->item);
+        }
+    }
+    free(ctx->jobs);
+    free(ctx->done_order);
+    if (ctx->done != NULL)
+    {
+        SDL_DestroyCond(ctx->done);
+    }
+    if (ctx->work != NULL)
+    {
+        SDL_DestroyCond(ctx->work);
+    }
+    if (ctx->lock != NULL)
+    {
+        SDL_DestroyMutex(ctx->lock);
+    }
+    free(ctx);
+}
+
+/* =========================================================================
+ * Public API — Jobs
+ * ========================================================================= */
+
+sdl2_decode_status_t sdl2_decode_submit(sdl2_decode_t *ctx, int batch, const char *key,
+                                        const char *path, sdl2_decode_fn decode,
+                                        sdl2_decode_free_fn free_fn)
+{
+    if (ctx == NULL || key == NULL || path == NULL || decode == NULL)
+    {
+        return SDL2D_ERR_NULL_ARG;
+    }
+    size_t key_len = strlen(key);
+    size_t path_len = strlen(path);
+    if (key_len >= SDL2D_MAX_KEY || path_len >= SDL2D_MAX_PATH)
+    {
+        return SDL2D_ERR_KEY_TOO_LONG;
+    }
+
+    SDL_LockMutex(ctx->lock);
+    if (!grow_jobs(ctx))
+    {
+        SDL_UnlockMutex(ctx->lock);
+        return SDL2D_ERR_ALLOC_FAILED;
+    }
+    decode_job_t *job = &ctx->jobs[ctx->job_count];
+    memset(job, 0, sizeof(*job));
+    job->batch = batch;
+    memcpy(job->key, key, key_len + 1);
+    memcpy(job->path, path, path_len + 1);
+    job->decode = decode;
+    job->free_fn = free_fn;
+    job->state = JOB_QUEUED;
+    ctx->job_count++;
+    ctx->stats.submitted++;
+    SDL_CondSignal(ctx->work);
+    SDL_UnlockMutex(ctx->lock);
+    return SDL2D_OK;
+}
+
+bool sdl2_decode_take(sdl2_decode_t *ctx, int batch, sdl2_decode_result_t *out)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return false;
+    }
+
+    SDL_LockMutex(ctx->lock);
+    for (;;)
+    {
+        for (int i = 0; i < ctx->done_count; i++)
+        {
+            decode_job_t *job = &ctx->jobs[ctx->done_order[i]];
+            if (job->batch == batch && job->state == JOB_DONE)
+            {
+                memcpy(out->key, job->key, sizeof(out->key));
+                memcpy(out->path, job->path, sizeof(out->path));
+                out->item = job->item;
+                job->item = NULL;
+                job->state = JOB_TAKEN;
+                SDL_UnlockMutex(ctx->lock);
+                return true;
+            }
+        }
+
+        bool outstanding = false;
+        for (int i = 0; i < ctx->job_count && !outstanding; i++)
+        {
+            const decode_job_t *job = &ctx->jobs[i];
+            outstanding = job->batch == batch &&
+                          (job->state == JOB_QUEUED || job->state == JOB_RUNNING);
+        }
+        if (!outstanding)
+        {
+            SDL_UnlockMutex(ctx->lock);
+            return false;
+        }
+        SDL_CondWait(ctx->done, ctx->lock);
+    }
+}
+
+/* =========================================================================
+ * Public API — Queries
+ * ========================================================================= */
+
+int sdl2_decode_threads(const sdl2_decode_t *ctx)
+{
+    return ctx != NULL ? ctx->thread_count : 0;
+}
+
+void sdl2_decode_get_stats(const sdl2_decode_t *ctx, sdl2_decode_stats_t *out)
+{
+    if (out == NULL)
+    {
+        return;
+    }
+    if (ctx == NULL)
+    {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    SDL_LockMutex(ctx->lock);
+    *out = ctx->stats;
+    SDL_UnlockMutex(ctx->lock);
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *sdl2_decode_status_string(sdl2_decode_status_t status)
+{
+    switch (status)
+    {
+        case SDL2D_OK:
+            return "OK";
+        case SDL2D_ERR_NULL_ARG:
+            return "NULL argument";
+        case SDL2D_ERR_BAD_CONFIG:
+            return "invalid configuration";
+        case SDL2D_ERR_ALLOC_FAILED:
+            return "allocation failed";
+        case SDL2D_ERR_THREAD_FAILED:
+            return "cannot start decode thread";
+        case SDL2D_ERR_KEY_TOO_LONG:
+            return "key or path too long";
+    }
+    return "unknown status";
+}
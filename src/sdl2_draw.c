@@ -0,0 +1,27 @@
+/*
+ * sdl2_draw.c — Counted draw calls.
+ *
+ * See include/sdl2_draw.h for API documentation.
+ * See ADR-092 in docs/DESIGN.md for design rationale.
+ */
+
+#include "sdl2_draw.h"
+
+#include <stddef.h>
+
+/* No draw yet: a pointer no texture, and not NULL, can equal. */
+#define NO_TEXTURE ((const SDL_Texture *)&sdl2_draw_state)
+
+/* Public so the inline wrappers can count (see sdl2_draw.h). */
+sdl2_draw_state_t sdl2_draw_state = {{0, 0}, NO_TEXTURE};
+
+void sdl2_draw_take_stats(sdl2_draw_stats_t *out)
+{
+    if (out != NULL)
+    {
+        *out = sdl2_draw_state.stats;
+    }
+    sdl2_draw_state.stats.draw_calls = 0;
+    sdl2_draw_state.stats.texture_switches = 0;
+    sdl2_draw_state.last_texture = NO_TEXTURE;
+}
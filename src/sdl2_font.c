@@ -2,18 +2,22 @@
  * sdl2_font.c — SDL2 TTF font rendering.
  *
  * See include/sdl2_font.h for API documentation.
- * See ADR-006 in docs/DESIGN.md for design rationale.
+ * See ADR-006 in docs/DESIGN.md for design rationale, ADR-087 for the
+ * text cache and glyph strip, and ADR-098 for the asset pack.
  */
 
 #include "sdl2_font.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <SDL2/SDL_ttf.h>
 
+#include "sdl2_draw.h"
+
 /* =========================================================================
  * Internal data structures
  * ========================================================================= */
@@ -25,11 +29,39 @@ struct sdl2_font_spec
     int ptsize;
 };
 
+#define GLYPH_COUNT ((int)sizeof(SDL2F_GLYPH_CHARS) - 1)
+
+/* White glyphs of SDL2F_GLYPH_CHARS side by side in one texture, built on
+ * first use and colour-modulated per draw. */
+struct sdl2_font_glyphs
+{
+    SDL_Texture *texture;
+    bool failed; /* build failed; draw these strings as text */
+    SDL_Rect rect[GLYPH_COUNT];
+    int advance[GLYPH_COUNT];
+};
+
 /* Runtime state for a loaded font. */
 struct sdl2_font_slot
 {
     TTF_Font *font;
     int line_height;
+    struct sdl2_font_glyphs glyphs;
+};
+
+/* One rendered string.  Entries sit in a hash chain and in the LRU list;
+ * texture is NULL while the entry has never been used. */
+struct sdl2_font_text
+{
+    SDL_Texture *texture;
+    int w, h;
+    sdl2_font_id_t font_id;
+    SDL_Color color;
+    unsigned int hash;
+    int chain; /* next entry in the same bucket, -1 ends */
+    int prev;  /* LRU neighbours, most recent at lru_head; -1 ends */
+    int next;
+    char text[SDL2F_TEXT_CACHE_MAX_LEN + 1];
 };
 
 struct sdl2_font
@@ -37,6 +69,17 @@ struct sdl2_font
     SDL_Renderer *renderer; /* borrowed, not owned */
     struct sdl2_font_slot slots[SDL2F_FONT_COUNT];
     bool ttf_initialized;
+    bool glyph_atlas;
+
+    /* Text cache: cache_size entries, bucket_count (a power of two) chains. */
+    struct sdl2_font_text *cache;
+    int *buckets;
+    int cache_size;
+    int bucket_count;
+    int cache_used;
+    int lru_head;
+    int lru_tail;
+    sdl2_font_cache_stats_t stats;
 };
 
 /* Font specifications: maps each enum slot to a TTF file and point size. */
@@ -48,50 +91,418 @@ static const struct sdl2_font_spec font_specs[SDL2F_FONT_COUNT] = {
 };
 
 /* =========================================================================
- * Internal helpers
+ * Text cache
  * ========================================================================= */
 
-static bool is_valid_font_id(sdl2_font_id_t id)
+/* FNV-1a over the text, then the font and colour. */
+static unsigned int text_hash(sdl2_font_id_t font_id, const char *text, SDL_Color color)
 {
-    return id >= 0 && id < SDL2F_FONT_COUNT;
+    unsigned int h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)text; *p != '\0'; p++)
+    {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    const unsigned char tail[5] = {(unsigned char)font_id, color.r, color.g, color.b, color.a};
+    for (size_t i = 0; i < sizeof(tail); i++)
+    {
+        h ^= tail[i];
+        h *= 16777619u;
+    }
+    return h;
 }
 
-/*
- * Render text to the renderer at (x, y).
- * Empty/NULL text is a no-op (returns OK).
- * Creates a transient surface → texture → RenderCopy → cleanup.
- */
-static sdl2_font_status_t render_text(sdl2_font_t *ctx, TTF_Font *font, const char *text, int x,
-                                      int y, SDL_Color color)
+static void lru_unlink(sdl2_font_t *ctx, int i)
 {
-    if (text == NULL || text[0] == '\0')
+    struct sdl2_font_text *e = &ctx->cache[i];
+    if (e->prev >= 0)
+        ctx->cache[e->prev].next = e->next;
+    else
+        ctx->lru_head = e->next;
+    if (e->next >= 0)
+        ctx->cache[e->next].prev = e->prev;
+    else
+        ctx->lru_tail = e->prev;
+    e->prev = -1;
+    e->next = -1;
+}
+
+static void lru_push_front(sdl2_font_t *ctx, int i)
+{
+    struct sdl2_font_text *e = &ctx->cache[i];
+    e->prev = -1;
+    e->next = ctx->lru_head;
+    if (ctx->lru_head >= 0)
+        ctx->cache[ctx->lru_head].prev = i;
+    ctx->lru_head = i;
+    if (ctx->lru_tail < 0)
+        ctx->lru_tail = i;
+}
+
+static int cache_find(const sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text,
+                      SDL_Color color, unsigned int hash)
+{
+    int i = ctx->buckets[hash & (unsigned int)(ctx->bucket_count - 1)];
+    while (i >= 0)
     {
-        return SDL2F_OK;
+        const struct sdl2_font_text *e = &ctx->cache[i];
+        if (e->hash == hash && e->font_id == font_id && e->color.r == color.r &&
+            e->color.g == color.g && e->color.b == color.b && e->color.a == color.a &&
+            strcmp(e->text, text) == 0)
+        {
+            return i;
+        }
+        i = e->chain;
+    }
+    return -1;
+}
+
+static void chain_remove(sdl2_font_t *ctx, int i)
+{
+    int *link = &ctx->buckets[ctx->cache[i].hash & (unsigned int)(ctx->bucket_count - 1)];
+    while (*link >= 0 && *link != i)
+    {
+        link = &ctx->cache[*link].chain;
     }
+    if (*link == i)
+    {
+        *link = ctx->cache[i].chain;
+    }
+}
 
+/* Take an unused entry, or evict the least recently used one. */
+static int cache_take_slot(sdl2_font_t *ctx)
+{
+    if (ctx->cache_used < ctx->cache_size)
+    {
+        return ctx->cache_used++;
+    }
+    int i = ctx->lru_tail;
+    lru_unlink(ctx, i);
+    chain_remove(ctx, i);
+    SDL_DestroyTexture(ctx->cache[i].texture);
+    ctx->cache[i].texture = NULL;
+    ctx->stats.evictions++;
+    return i;
+}
+
+static void cache_free(sdl2_font_t *ctx)
+{
+    for (int i = 0; i < ctx->cache_used; i++)
+    {
+        if (ctx->cache[i].texture != NULL)
+        {
+            SDL_DestroyTexture(ctx->cache[i].texture);
+        }
+    }
+    free(ctx->cache);
+    free(ctx->buckets);
+    ctx->cache = NULL;
+    ctx->buckets = NULL;
+    ctx->cache_size = 0;
+    ctx->cache_used = 0;
+}
+
+/* Allocate the cache for size entries; size 0 leaves it disabled. */
+static bool cache_init(sdl2_font_t *ctx, int size)
+{
+    ctx->lru_head = -1;
+    ctx->lru_tail = -1;
+    if (size <= 0)
+    {
+        return true;
+    }
+    int buckets = 1;
+    while (buckets < size * 2)
+    {
+        buckets *= 2;
+    }
+    ctx->cache = calloc((size_t)size, sizeof(*ctx->cache));
+    ctx->buckets = malloc((size_t)buckets * sizeof(*ctx->buckets));
+    if (ctx->cache == NULL || ctx->buckets == NULL)
+    {
+        cache_free(ctx);
+        return false;
+    }
+    for (int b = 0; b < buckets; b++)
+    {
+        ctx->buckets[b] = -1;
+    }
+    ctx->cache_size = size;
+    ctx->bucket_count = buckets;
+    return true;
+}
+
+/* Render text to a new texture; *w, *h receive its size.  NULL on error. */
+static SDL_Texture *render_texture(sdl2_font_t *ctx, TTF_Font *font, const char *text,
+                                   SDL_Color color, int *w, int *h)
+{
     SDL_Surface *surface = TTF_RenderUTF8_Blended(font, text, color);
     if (surface == NULL)
     {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_font: TTF_RenderUTF8_Blended failed: %s",
                      TTF_GetError());
-        return SDL2F_ERR_RENDER_FAILED;
+        return NULL;
     }
 
     SDL_Texture *texture = SDL_CreateTextureFromSurface(ctx->renderer, surface);
-    int w = surface->w;
-    int h = surface->h;
+    *w = surface->w;
+    *h = surface->h;
     SDL_FreeSurface(surface);
 
     if (texture == NULL)
     {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
                      "sdl2_font: SDL_CreateTextureFromSurface failed: %s", SDL_GetError());
+    }
+    return texture;
+}
+
+/*
+ * Cached texture for (font_id, text, color), rendering and inserting it
+ * on a miss.  Returns the entry index, or -1 when the string cannot be
+ * cached (cache disabled, text too long) or rendering failed (*failed).
+ */
+static int cache_acquire(sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text,
+                         SDL_Color color, bool *failed)
+{
+    *failed = false;
+    size_t len = strlen(text);
+    if (ctx->cache_size == 0 || len > SDL2F_TEXT_CACHE_MAX_LEN)
+    {
+        return -1;
+    }
+
+    unsigned int hash = text_hash(font_id, text, color);
+    int i = cache_find(ctx, font_id, text, color, hash);
+    if (i >= 0)
+    {
+        ctx->stats.hits++;
+        if (ctx->lru_head != i)
+        {
+            lru_unlink(ctx, i);
+            lru_push_front(ctx, i);
+        }
+        return i;
+    }
+
+    ctx->stats.misses++;
+    int w = 0;
+    int h = 0;
+    SDL_Texture *texture = render_texture(ctx, ctx->slots[font_id].font, text, color, &w, &h);
+    if (texture == NULL)
+    {
+        *failed = true;
+        return -1;
+    }
+
+    i = cache_take_slot(ctx);
+    struct sdl2_font_text *e = &ctx->cache[i];
+    e->texture = texture;
+    e->w = w;
+    e->h = h;
+    e->font_id = font_id;
+    e->color = color;
+    e->hash = hash;
+    memcpy(e->text, text, len + 1);
+    int *bucket = &ctx->buckets[hash & (unsigned int)(ctx->bucket_count - 1)];
+    e->chain = *bucket;
+    *bucket = i;
+    lru_push_front(ctx, i);
+    return i;
+}
+
+/* =========================================================================
+ * Glyph strip
+ * ========================================================================= */
+
+static int glyph_index(char c)
+{
+    const char *p = (c != '\0') ? strchr(SDL2F_GLYPH_CHARS, c) : NULL;
+    return (p != NULL) ? (int)(p - SDL2F_GLYPH_CHARS) : -1;
+}
+
+/* Build the font's strip.  On failure marks it failed and returns false. */
+static bool glyphs_build(sdl2_font_t *ctx, struct sdl2_font_slot *slot)
+{
+    struct sdl2_font_glyphs *g = &slot->glyphs;
+    SDL_Surface *surf[GLYPH_COUNT] = {NULL};
+    SDL_Color white = {255, 255, 255, 255};
+    int strip_w = 0;
+    int strip_h = 0;
+    bool ok = true;
+
+    for (int i = 0; i < GLYPH_COUNT && ok; i++)
+    {
+        Uint16 ch = (Uint16)(unsigned char)SDL2F_GLYPH_CHARS[i];
+        int minx;
+        int maxx;
+        int miny;
+        int maxy;
+        surf[i] = TTF_RenderGlyph_Blended(slot->font, ch, white);
+        ok = surf[i] != NULL &&
+             TTF_GlyphMetrics(slot->font, ch, &minx, &maxx, &miny, &maxy, &g->advance[i]) == 0;
+        if (ok)
+        {
+            /* One blank column between glyphs keeps filtering apart. */
+            g->rect[i] = (SDL_Rect){strip_w, 0, surf[i]->w, surf[i]->h};
+            strip_w += surf[i]->w + 1;
+            strip_h = (surf[i]->h > strip_h) ? surf[i]->h : strip_h;
+        }
+    }
+
+    SDL_Surface *strip = NULL;
+    if (ok)
+    {
+        strip = SDL_CreateRGBSurfaceWithFormat(0, strip_w, strip_h, 32, SDL_PIXELFORMAT_RGBA32);
+        ok = strip != NULL;
+    }
+    for (int i = 0; i < GLYPH_COUNT && ok; i++)
+    {
+        SDL_Rect dst = g->rect[i];
+        SDL_SetSurfaceBlendMode(surf[i], SDL_BLENDMODE_NONE);
+        ok = SDL_BlitSurface(surf[i], NULL, strip, &dst) == 0;
+    }
+    if (ok)
+    {
+        g->texture = SDL_CreateTextureFromSurface(ctx->renderer, strip);
+        ok = g->texture != NULL;
+    }
+    if (ok)
+    {
+        SDL_SetTextureBlendMode(g->texture, SDL_BLENDMODE_BLEND);
+    }
+    else
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "sdl2_font: glyph strip unavailable, drawing digits as text: %s",
+                    SDL_GetError());
+        g->failed = true;
+    }
+
+    SDL_FreeSurface(strip);
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        SDL_FreeSurface(surf[i]);
+    }
+    return ok;
+}
+
+/* Whether text can be drawn from the strip; builds it on first use. */
+static bool glyphs_usable(sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text)
+{
+    if (!ctx->glyph_atlas)
+    {
+        return false;
+    }
+    for (const char *p = text; *p != '\0'; p++)
+    {
+        if (glyph_index(*p) < 0)
+        {
+            return false;
+        }
+    }
+    struct sdl2_font_slot *slot = &ctx->slots[font_id];
+    if (slot->glyphs.failed)
+    {
+        return false;
+    }
+    return slot->glyphs.texture != NULL || glyphs_build(ctx, slot);
+}
+
+static int glyphs_width(const struct sdl2_font_glyphs *g, const char *text)
+{
+    int w = 0;
+    for (const char *p = text; *p != '\0'; p++)
+    {
+        w += g->advance[glyph_index(*p)];
+    }
+    return w;
+}
+
+static sdl2_font_status_t glyphs_draw(sdl2_font_t *ctx, const struct sdl2_font_glyphs *g,
+                                      const char *text, int x, int y, SDL_Color color)
+{
+    SDL_SetTextureColorMod(g->texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(g->texture, color.a);
+    ctx->stats.glyph_draws++;
+
+    int pen = x;
+    for (const char *p = text; *p != '\0'; p++)
+    {
+        int i = glyph_index(*p);
+        SDL_Rect dst = {pen, y, g->rect[i].w, g->rect[i].h};
+        if (sdl2_draw_copy(ctx->renderer, g->texture, &g->rect[i], &dst) != 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_font: SDL_RenderCopy failed: %s",
+                         SDL_GetError());
+            return SDL2F_ERR_RENDER_FAILED;
+        }
+        pen += g->advance[i];
+    }
+    return SDL2F_OK;
+}
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+static bool is_valid_font_id(sdl2_font_id_t id)
+{
+    return id >= 0 && id < SDL2F_FONT_COUNT;
+}
+
+/*
+ * Render text to the renderer at (x, y).
+ * Empty/NULL text is a no-op (returns OK).
+ * Draws from the glyph strip or the text cache when it can; otherwise
+ * creates a transient surface → texture → RenderCopy → cleanup.
+ */
+static sdl2_font_status_t render_text(sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text,
+                                      int x, int y, SDL_Color color)
+{
+    if (text == NULL || text[0] == '\0')
+    {
+        return SDL2F_OK;
+    }
+
+    if (glyphs_usable(ctx, font_id, text))
+    {
+        return glyphs_draw(ctx, &ctx->slots[font_id].glyphs, text, x, y, color);
+    }
+
+    bool failed;
+    int i = cache_acquire(ctx, font_id, text, color, &failed);
+    if (failed)
+    {
         return SDL2F_ERR_RENDER_FAILED;
     }
 
+    SDL_Texture *texture;
+    int w;
+    int h;
+    if (i >= 0)
+    {
+        texture = ctx->cache[i].texture;
+        w = ctx->cache[i].w;
+        h = ctx->cache[i].h;
+    }
+    else
+    {
+        ctx->stats.misses++;
+        texture = render_texture(ctx, ctx->slots[font_id].font, text, color, &w, &h);
+        if (texture == NULL)
+        {
+            return SDL2F_ERR_RENDER_FAILED;
+        }
+    }
+
     SDL_Rect dst = {x, y, w, h};
-    int rc = SDL_RenderCopy(ctx->renderer, texture, NULL, &dst);
-    SDL_DestroyTexture(texture);
+    int rc = sdl2_draw_copy(ctx->renderer, texture, NULL, &dst);
+    if (i < 0)
+    {
+        SDL_DestroyTexture(texture);
+    }
 
     if (rc != 0)
     {
@@ -103,6 +514,37 @@ static sdl2_font_status_t render_text(sdl2_font_t *ctx, TTF_Font *font, const ch
     return SDL2F_OK;
 }
 
+/*
+ * Width of text as render_text() would draw it.  Reuses the glyph strip
+ * or a cached texture in that colour before asking SDL_ttf.
+ */
+static sdl2_font_status_t text_width(sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text,
+                                     SDL_Color color, int *w)
+{
+    *w = 0;
+    if (text[0] == '\0')
+    {
+        return SDL2F_OK;
+    }
+    if (glyphs_usable(ctx, font_id, text))
+    {
+        *w = glyphs_width(&ctx->slots[font_id].glyphs, text);
+        return SDL2F_OK;
+    }
+    if (ctx->cache_size > 0)
+    {
+        int i = cache_find(ctx, font_id, text, color, text_hash(font_id, text, color));
+        if (i >= 0)
+        {
+            *w = ctx->cache[i].w;
+            return SDL2F_OK;
+        }
+    }
+    int h = 0;
+    return TTF_SizeUTF8(ctx->slots[font_id].font, text, w, &h) == 0 ? SDL2F_OK
+                                                                    : SDL2F_ERR_RENDER_FAILED;
+}
+
 /* =========================================================================
  * Public API
  * ========================================================================= */
@@ -113,6 +555,8 @@ sdl2_font_config_t sdl2_font_config_defaults(void)
     memset(&cfg, 0, sizeof(cfg));
     cfg.renderer = NULL;
     cfg.font_dir = SDL2F_DEFAULT_FONT_DIR;
+    cfg.text_cache_size = SDL2F_TEXT_CACHE_SIZE;
+    cfg.glyph_atlas = true;
     return cfg;
 }
 
@@ -148,6 +592,16 @@ sdl2_font_t *sdl2_font_create(const sdl2_font_config_t *config, sdl2_font_status
 
     ctx->renderer = config->renderer;
     ctx->ttf_initialized = false;
+    ctx->glyph_atlas = config->glyph_atlas;
+    if (!cache_init(ctx, config->text_cache_size))
+    {
+        free(ctx);
+        if (status != NULL)
+        {
+            *status = SDL2F_ERR_FONT_LOAD;
+        }
+        return NULL;
+    }
 
     /* Initialize SDL2_ttf if not already active. */
     if (!TTF_WasInit())
@@ -156,6 +610,7 @@ sdl2_font_t *sdl2_font_create(const sdl2_font_config_t *config, sdl2_font_status
         {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_font: TTF_Init failed: %s",
                          TTF_GetError());
+            cache_free(ctx);
             free(ctx);
             if (status != NULL)
             {
@@ -185,7 +640,21 @@ sdl2_font_t *sdl2_font_create(const sdl2_font_config_t *config, sdl2_font_status
             return NULL;
         }
 
-        TTF_Font *font = TTF_OpenFont(path, font_specs[i].ptsize);
+        /* SDL2_ttf reads the face lazily, so the pack must outlive ctx. */
+        char key[128];
+        asset_pack_entry_t e;
+        TTF_Font *font;
+        snprintf(key, sizeof(key), "fonts/%s", font_specs[i].filename);
+        if (asset_pack_find(config->pack, key, &e) == ASSET_PACK_OK && e.size <= INT32_MAX)
+        {
+            snprintf(path, sizeof(path), "asset pack:%s", key);
+            font = TTF_OpenFontRW(SDL_RWFromConstMem(e.data, (int)e.size), 1,
+                                  font_specs[i].ptsize);
+        }
+        else
+        {
+            font = TTF_OpenFont(path, font_specs[i].ptsize);
+        }
         if (font == NULL)
         {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_font: failed to open '%s' at %dpt: %s",
@@ -216,8 +685,13 @@ void sdl2_font_destroy(sdl2_font_t *ctx)
         return;
     }
 
+    cache_free(ctx);
     for (int i = 0; i < SDL2F_FONT_COUNT; i++)
     {
+        if (ctx->slots[i].glyphs.texture != NULL)
+        {
+            SDL_DestroyTexture(ctx->slots[i].glyphs.texture);
+        }
         if (ctx->slots[i].font != NULL)
         {
             TTF_CloseFont(ctx->slots[i].font);
@@ -244,7 +718,7 @@ sdl2_font_status_t sdl2_font_draw(sdl2_font_t *ctx, sdl2_font_id_t font_id, cons
         return SDL2F_ERR_INVALID_FONT_ID;
     }
 
-    return render_text(ctx, ctx->slots[font_id].font, text, x, y, color);
+    return render_text(ctx, font_id, text, x, y, color);
 }
 
 sdl2_font_status_t sdl2_font_draw_shadow(sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text,
@@ -260,14 +734,14 @@ sdl2_font_status_t sdl2_font_draw_shadow(sdl2_font_t *ctx, sdl2_font_id_t font_i
     }
 
     SDL_Color shadow = {0, 0, 0, 255};
-    sdl2_font_status_t st = render_text(ctx, ctx->slots[font_id].font, text,
-                                        x + SDL2F_SHADOW_OFFSET, y + SDL2F_SHADOW_OFFSET, shadow);
+    sdl2_font_status_t st =
+        render_text(ctx, font_id, text, x + SDL2F_SHADOW_OFFSET, y + SDL2F_SHADOW_OFFSET, shadow);
     if (st != SDL2F_OK)
     {
         return st;
     }
 
-    return render_text(ctx, ctx->slots[font_id].font, text, x, y, color);
+    return render_text(ctx, font_id, text, x, y, color);
 }
 
 sdl2_font_status_t sdl2_font_draw_shadow_centred(sdl2_font_t *ctx, sdl2_font_id_t font_id,
@@ -285,26 +759,22 @@ sdl2_font_status_t sdl2_font_draw_shadow_centred(sdl2_font_t *ctx, sdl2_font_id_
 
     /* Measure text width for centring. */
     int text_w = 0;
-    if (text[0] != '\0')
+    sdl2_font_status_t st = text_width(ctx, font_id, text, color, &text_w);
+    if (st != SDL2F_OK)
     {
-        int text_h = 0;
-        if (TTF_SizeUTF8(ctx->slots[font_id].font, text, &text_w, &text_h) != 0)
-        {
-            return SDL2F_ERR_RENDER_FAILED;
-        }
+        return st;
     }
 
     int x = (width / 2) - (text_w / 2);
 
     SDL_Color shadow = {0, 0, 0, 255};
-    sdl2_font_status_t st = render_text(ctx, ctx->slots[font_id].font, text,
-                                        x + SDL2F_SHADOW_OFFSET, y + SDL2F_SHADOW_OFFSET, shadow);
+    st = render_text(ctx, font_id, text, x + SDL2F_SHADOW_OFFSET, y + SDL2F_SHADOW_OFFSET, shadow);
     if (st != SDL2F_OK)
     {
         return st;
     }
 
-    return render_text(ctx, ctx->slots[font_id].font, text, x, y, color);
+    return render_text(ctx, font_id, text, x, y, color);
 }
 
 sdl2_font_status_t sdl2_font_measure(sdl2_font_t *ctx, sdl2_font_id_t font_id, const char *text,
@@ -361,6 +831,17 @@ int sdl2_font_ascent(const sdl2_font_t *ctx, sdl2_font_id_t font_id)
     return TTF_FontAscent(font);
 }
 
+sdl2_font_status_t sdl2_font_cache_stats(const sdl2_font_t *ctx, sdl2_font_cache_stats_t *stats)
+{
+    if (ctx == NULL || stats == NULL)
+    {
+        return SDL2F_ERR_NULL_ARG;
+    }
+    *stats = ctx->stats;
+    stats->entries = ctx->cache_used;
+    return SDL2F_OK;
+}
+
 const char *sdl2_font_status_string(sdl2_font_status_t status)
 {
     switch (status)
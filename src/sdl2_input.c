@@ -87,6 +87,7 @@ static const struct sdl2_input_binding default_bindings[SDL2I_ACTION_COUNT] = {
     [SDL2I_SPEED_7] = {{SDL_SCANCODE_7, SDL_SCANCODE_UNKNOWN}},
     [SDL2I_SPEED_8] = {{SDL_SCANCODE_8, SDL_SCANCODE_UNKNOWN}},
     [SDL2I_SPEED_9] = {{SDL_SCANCODE_9, SDL_SCANCODE_UNKNOWN}},
+    [SDL2I_TOGGLE_HUD] = {{SDL_SCANCODE_F3, SDL_SCANCODE_UNKNOWN}},
 };
 
 /* =========================================================================
@@ -375,6 +376,58 @@ bool sdl2_input_shift_held(const sdl2_input_t *ctx)
     return (ctx->modifiers & KMOD_SHIFT) != 0;
 }
 
+/* =========================================================================
+ * Public API — Snapshots
+ * ========================================================================= */
+
+_Static_assert(SDL2I_ACTION_COUNT <= 32, "action bitmask must fit in uint32_t");
+
+void sdl2_input_get_snapshot(const sdl2_input_t *ctx, sdl2_input_snapshot_t *snap)
+{
+    if (ctx == NULL || snap == NULL)
+    {
+        return;
+    }
+
+    memset(snap, 0, sizeof(*snap));
+    for (int i = 0; i < SDL2I_ACTION_COUNT; i++)
+    {
+        if (ctx->pressed[i])
+        {
+            snap->held |= 1u << i;
+        }
+        if (ctx->just_pressed[i])
+        {
+            snap->just_pressed |= 1u << i;
+        }
+    }
+    snap->mouse_x = ctx->mouse_x;
+    snap->mouse_y = ctx->mouse_y;
+    snap->mouse_buttons = ctx->mouse_buttons;
+    snap->mouse_just_pressed = ctx->mouse_just_pressed;
+    snap->shift = (ctx->modifiers & KMOD_SHIFT) != 0;
+}
+
+void sdl2_input_apply_snapshot(sdl2_input_t *ctx, const sdl2_input_snapshot_t *snap)
+{
+    if (ctx == NULL || snap == NULL)
+    {
+        return;
+    }
+
+    memset(ctx->scancode_pressed, 0, sizeof(ctx->scancode_pressed));
+    for (int i = 0; i < SDL2I_ACTION_COUNT; i++)
+    {
+        ctx->pressed[i] = (snap->held & (1u << i)) != 0;
+        ctx->just_pressed[i] = (snap->just_pressed & (1u << i)) != 0;
+    }
+    ctx->mouse_x = snap->mouse_x;
+    ctx->mouse_y = snap->mouse_y;
+    ctx->mouse_buttons = snap->mouse_buttons;
+    ctx->mouse_just_pressed = snap->mouse_just_pressed;
+    ctx->modifiers = snap->shift ? KMOD_LSHIFT : KMOD_NONE;
+}
+
 /* =========================================================================
  * Public API — Key binding management
  * ========================================================================= */
@@ -505,6 +558,8 @@ const char *sdl2_input_action_name(sdl2_input_action_t action)
             return "speed_8";
         case SDL2I_SPEED_9:
             return "speed_9";
+        case SDL2I_TOGGLE_HUD:
+            return "toggle_hud";
         case SDL2I_ACTION_COUNT:
             break;
     }
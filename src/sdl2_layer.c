@@ -0,0 +1,261 @@
+/*
+ * sdl2_layer.c — Cached static layers on render-target textures.
+ *
+ * See include/sdl2_layer.h for API documentation.
+ * See ADR-088 in docs/DESIGN.md for design rationale.
+ */
+
+#include "sdl2_layer.h"
+
+#include <stdlib.h>
+
+#include "sdl2_draw.h"
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+struct sdl2_layer
+{
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    int width, height; /* Size of texture */
+    uint64_t key;      /* What the texture holds, when valid */
+    bool valid;
+    bool composing;           /* Between a successful begin()/update() and end() */
+    bool updating;            /* ...and it was update(), not begin() */
+    SDL_Texture *prev_target; /* Target to restore in end() */
+    uint64_t redraws;
+    uint64_t updates;
+};
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+static void set_status(sdl2_layer_status_t *status, sdl2_layer_status_t value)
+{
+    if (status != NULL)
+    {
+        *status = value;
+    }
+}
+
+/* Make sure the texture is w x h, recreating it if not. */
+static sdl2_layer_status_t ensure_texture(sdl2_layer_t *layer, int w, int h)
+{
+    if (layer->texture != NULL && layer->width == w && layer->height == h)
+    {
+        return SDL2LY_OK;
+    }
+    if (layer->texture != NULL)
+    {
+        SDL_DestroyTexture(layer->texture);
+        layer->texture = NULL;
+    }
+    layer->texture = SDL_CreateTexture(layer->renderer, SDL_PIXELFORMAT_ARGB8888,
+                                       SDL_TEXTUREACCESS_TARGET, w, h);
+    if (layer->texture == NULL)
+    {
+        return SDL2LY_ERR_CREATE_FAILED;
+    }
+    SDL_SetTextureBlendMode(layer->texture, SDL_BLENDMODE_BLEND);
+    layer->width = w;
+    layer->height = h;
+    return SDL2LY_OK;
+}
+
+/* Make the layer's texture the render target, remembering the old one. */
+static sdl2_layer_status_t open_target(sdl2_layer_t *layer)
+{
+    SDL_Texture *prev = SDL_GetRenderTarget(layer->renderer);
+    if (SDL_SetRenderTarget(layer->renderer, layer->texture) != 0)
+    {
+        return SDL2LY_ERR_TARGET_FAILED;
+    }
+    layer->prev_target = prev;
+    layer->composing = true;
+    return SDL2LY_OK;
+}
+
+/* =========================================================================
+ * Public API
+ * ========================================================================= */
+
+sdl2_layer_t *sdl2_layer_create(SDL_Renderer *renderer, sdl2_layer_status_t *status)
+{
+    if (renderer == NULL)
+    {
+        set_status(status, SDL2LY_ERR_NULL_ARG);
+        return NULL;
+    }
+    if (!SDL_RenderTargetSupported(renderer))
+    {
+        set_status(status, SDL2LY_ERR_UNSUPPORTED);
+        return NULL;
+    }
+
+    sdl2_layer_t *layer = calloc(1, sizeof(*layer));
+    if (layer == NULL)
+    {
+        set_status(status, SDL2LY_ERR_CREATE_FAILED);
+        return NULL;
+    }
+    layer->renderer = renderer;
+    set_status(status, SDL2LY_OK);
+    return layer;
+}
+
+void sdl2_layer_destroy(sdl2_layer_t *layer)
+{
+    if (layer == NULL)
+    {
+        return;
+    }
+    if (layer->texture != NULL)
+    {
+        SDL_DestroyTexture(layer->texture);
+    }
+    free(layer);
+}
+
+bool sdl2_layer_is_current(const sdl2_layer_t *layer, int w, int h, uint64_t key)
+{
+    return layer != NULL && layer->valid && layer->width == w && layer->height == h &&
+           layer->key == key;
+}
+
+sdl2_layer_status_t sdl2_layer_begin(sdl2_layer_t *layer, int w, int h, uint64_t key)
+{
+    if (layer == NULL)
+    {
+        return SDL2LY_ERR_NULL_ARG;
+    }
+    if (w <= 0 || h <= 0)
+    {
+        return SDL2LY_ERR_BAD_SIZE;
+    }
+
+    layer->valid = false;
+    sdl2_layer_status_t st = ensure_texture(layer, w, h);
+    if (st != SDL2LY_OK)
+    {
+        return st;
+    }
+
+    st = open_target(layer);
+    if (st != SDL2LY_OK)
+    {
+        return st;
+    }
+    SDL_SetRenderDrawColor(layer->renderer, 0, 0, 0, 0);
+    SDL_RenderClear(layer->renderer);
+
+    layer->key = key;
+    layer->updating = false;
+    return SDL2LY_OK;
+}
+
+sdl2_layer_status_t sdl2_layer_update(sdl2_layer_t *layer)
+{
+    if (layer == NULL)
+    {
+        return SDL2LY_ERR_NULL_ARG;
+    }
+    if (!layer->valid)
+    {
+        return SDL2LY_ERR_STALE;
+    }
+
+    sdl2_layer_status_t st = open_target(layer);
+    if (st != SDL2LY_OK)
+    {
+        return st;
+    }
+    layer->updating = true;
+    return SDL2LY_OK;
+}
+
+void sdl2_layer_clear_rect(sdl2_layer_t *layer, const SDL_Rect *rect)
+{
+    if (layer == NULL || !layer->composing || rect == NULL)
+    {
+        return;
+    }
+    /* Blending a transparent fill would leave the old pixels in place. */
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(layer->renderer, &mode);
+    SDL_SetRenderDrawBlendMode(layer->renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(layer->renderer, 0, 0, 0, 0);
+    sdl2_draw_fill_rect(layer->renderer, rect);
+    SDL_SetRenderDrawBlendMode(layer->renderer, mode);
+}
+
+void sdl2_layer_end(sdl2_layer_t *layer)
+{
+    if (layer == NULL || !layer->composing)
+    {
+        return;
+    }
+    SDL_SetRenderTarget(layer->renderer, layer->prev_target);
+    layer->prev_target = NULL;
+    layer->composing = false;
+    layer->valid = true;
+    if (layer->updating)
+    {
+        layer->updates++;
+    }
+    else
+    {
+        layer->redraws++;
+    }
+}
+
+void sdl2_layer_draw(const sdl2_layer_t *layer, const SDL_Rect *area)
+{
+    if (layer == NULL || !layer->valid)
+    {
+        return;
+    }
+    sdl2_draw_copy(layer->renderer, layer->texture, area, area);
+}
+
+void sdl2_layer_invalidate(sdl2_layer_t *layer)
+{
+    if (layer != NULL)
+    {
+        layer->valid = false;
+    }
+}
+
+uint64_t sdl2_layer_redraws(const sdl2_layer_t *layer)
+{
+    return layer != NULL ? layer->redraws : 0;
+}
+
+uint64_t sdl2_layer_updates(const sdl2_layer_t *layer)
+{
+    return layer != NULL ? layer->updates : 0;
+}
+
+const char *sdl2_layer_status_string(sdl2_layer_status_t status)
+{
+    switch (status)
+    {
+        case SDL2LY_OK:
+            return "OK";
+        case SDL2LY_ERR_NULL_ARG:
+            return "NULL argument";
+        case SDL2LY_ERR_UNSUPPORTED:
+            return "render targets not supported";
+        case SDL2LY_ERR_CREATE_FAILED:
+            return "layer creation failed";
+        case SDL2LY_ERR_BAD_SIZE:
+            return "invalid layer size";
+        case SDL2LY_ERR_TARGET_FAILED:
+            return "cannot set render target";
+        case SDL2LY_ERR_STALE:
+            return "layer is not current";
+    }
+    return "unknown status";
+}
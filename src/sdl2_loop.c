@@ -30,6 +30,12 @@ struct sdl2_loop
     /* Pause state. */
     bool paused;
 
+    /* Turbo mode: budget per update, clock, and current window start. */
+    bool turbo;
+    uint64_t turbo_budget_us;
+    sdl2_loop_clock_fn clock_fn;
+    uint64_t turbo_start_us;
+
     /* Statistics. */
     uint64_t total_ticks;
     double alpha;
@@ -47,6 +53,33 @@ static uint64_t compute_tick_interval(int speed_level)
     return (uint64_t)SDL2L_TICK_UNIT_US * (uint64_t)(10 - speed_level);
 }
 
+/* Turbo update: ticks until the budget is spent, then one render. */
+static int turbo_update(sdl2_loop_t *ctx)
+{
+    sdl2_loop_turbo_begin(ctx);
+
+    int ticks = 0;
+    while (ticks < SDL2L_TURBO_MAX_TICKS_PER_UPDATE && sdl2_loop_turbo_budget_left(ctx))
+    {
+        if (ctx->tick_fn != NULL)
+        {
+            ctx->tick_fn(ctx->user_data);
+        }
+        ticks++;
+        ctx->total_ticks++;
+    }
+
+    ctx->accumulator_us = 0;
+    ctx->alpha = 0.0;
+
+    if (ctx->render_fn != NULL)
+    {
+        ctx->render_fn(ctx->alpha, ctx->user_data);
+    }
+
+    return ticks;
+}
+
 /* =========================================================================
  * Public API — Lifecycle
  * ========================================================================= */
@@ -91,6 +124,17 @@ void sdl2_loop_destroy(sdl2_loop_t *ctx)
  * ========================================================================= */
 
 int sdl2_loop_update(sdl2_loop_t *ctx, uint64_t elapsed_ms)
+{
+    /* Clamp elapsed_ms to prevent overflow in the ms→us conversion.
+     * 2^53 us ≈ 285 years — far beyond any real frame delta. */
+    if (elapsed_ms > UINT64_MAX / US_PER_MS)
+    {
+        elapsed_ms = UINT64_MAX / US_PER_MS;
+    }
+    return sdl2_loop_update_us(ctx, elapsed_ms * US_PER_MS);
+}
+
+int sdl2_loop_update_us(sdl2_loop_t *ctx, uint64_t elapsed_us)
 {
     if (ctx == NULL)
     {
@@ -103,15 +147,18 @@ int sdl2_loop_update(sdl2_loop_t *ctx, uint64_t elapsed_ms)
         return 0;
     }
 
-    /* Clamp elapsed_ms to prevent overflow in the ms→us conversion.
-     * 2^53 us ≈ 285 years — far beyond any real frame delta. */
-    if (elapsed_ms > UINT64_MAX / US_PER_MS)
+    if (ctx->turbo)
     {
-        elapsed_ms = UINT64_MAX / US_PER_MS;
+        return turbo_update(ctx);
     }
 
-    /* Add elapsed time to accumulator (ms → us). */
-    ctx->accumulator_us += elapsed_ms * US_PER_MS;
+    /* Saturate rather than wrap on an absurd delta; the tick clamp below
+     * discards the excess anyway. */
+    if (elapsed_us > UINT64_MAX - ctx->accumulator_us)
+    {
+        elapsed_us = UINT64_MAX - ctx->accumulator_us;
+    }
+    ctx->accumulator_us += elapsed_us;
 
     /* Consume fixed-timestep ticks from the accumulator. */
     int ticks = 0;
@@ -152,6 +199,43 @@ int sdl2_loop_update(sdl2_loop_t *ctx, uint64_t elapsed_ms)
     return ticks;
 }
 
+int sdl2_loop_step(sdl2_loop_t *ctx, int ticks, bool render)
+{
+    if (ctx == NULL || ctx->paused)
+    {
+        return 0;
+    }
+
+    int done = 0;
+    for (; done < ticks; done++)
+    {
+        if (ctx->tick_fn != NULL)
+        {
+            ctx->tick_fn(ctx->user_data);
+        }
+        ctx->total_ticks++;
+    }
+
+    ctx->accumulator_us = 0;
+    ctx->alpha = 0.0;
+
+    if (render && ctx->render_fn != NULL)
+    {
+        ctx->render_fn(ctx->alpha, ctx->user_data);
+    }
+
+    return done;
+}
+
+uint64_t sdl2_loop_until_tick_us(const sdl2_loop_t *ctx)
+{
+    if (ctx == NULL || ctx->turbo || ctx->accumulator_us >= ctx->tick_interval_us)
+    {
+        return 0;
+    }
+    return ctx->tick_interval_us - ctx->accumulator_us;
+}
+
 /* =========================================================================
  * Public API — Speed control
  * ========================================================================= */
@@ -190,6 +274,58 @@ uint64_t sdl2_loop_tick_interval_us(int speed_level)
     return compute_tick_interval(speed_level);
 }
 
+/* =========================================================================
+ * Public API — Turbo
+ * ========================================================================= */
+
+sdl2_loop_status_t sdl2_loop_set_turbo(sdl2_loop_t *ctx, bool on, uint64_t budget_us,
+                                       sdl2_loop_clock_fn clock_fn)
+{
+    if (ctx == NULL || (on && clock_fn == NULL))
+    {
+        return SDL2L_ERR_NULL_ARG;
+    }
+
+    if (on)
+    {
+        ctx->clock_fn = clock_fn;
+        ctx->turbo_budget_us = (budget_us > 0) ? budget_us : SDL2L_TURBO_DEFAULT_BUDGET_US;
+    }
+    else if (ctx->turbo)
+    {
+        ctx->accumulator_us = 0;
+    }
+    ctx->turbo = on;
+    return SDL2L_OK;
+}
+
+bool sdl2_loop_is_turbo(const sdl2_loop_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return false;
+    }
+    return ctx->turbo;
+}
+
+void sdl2_loop_turbo_begin(sdl2_loop_t *ctx)
+{
+    if (ctx == NULL || !ctx->turbo)
+    {
+        return;
+    }
+    ctx->turbo_start_us = ctx->clock_fn();
+}
+
+bool sdl2_loop_turbo_budget_left(const sdl2_loop_t *ctx)
+{
+    if (ctx == NULL || !ctx->turbo)
+    {
+        return false;
+    }
+    return ctx->clock_fn() - ctx->turbo_start_us < ctx->turbo_budget_us;
+}
+
 /* =========================================================================
  * Public API — Pause
  * ========================================================================= */
@@ -0,0 +1,243 @@
+/*
+ * sdl2_pacer.c — Frame pacing for the main loop.
+ *
+ * See include/sdl2_pacer.h for API documentation.
+ * See ADR-090 in docs/DESIGN.md for design rationale.
+ */
+
+#include "sdl2_pacer.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+/* Running mean and variance (Welford). */
+typedef struct
+{
+    uint64_t n;
+    double mean;
+    double m2;
+} running_stat_t;
+
+struct sdl2_pacer
+{
+    sdl2_pacer_clock_fn clock_fn;
+    sdl2_pacer_sleep_fn sleep_fn;
+    bool enabled;
+    uint64_t refresh_us; /* 0 = unknown */
+
+    running_stat_t overshoot; /* Per sleep: actual minus requested, us */
+    running_stat_t late;      /* Per wait: wake time minus deadline, us */
+    uint64_t late_max_us;
+    uint64_t slept_us;
+    uint64_t spun_us;
+};
+
+#define US_PER_MS 1000U
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+static void stat_add(running_stat_t *s, double x)
+{
+    s->n++;
+    double d = x - s->mean;
+    s->mean += d / (double)s->n;
+    s->m2 += d * (x - s->mean);
+}
+
+static double stat_stddev(const running_stat_t *s)
+{
+    return s->n > 1 ? sqrt(s->m2 / (double)(s->n - 1)) : 0.0;
+}
+
+/* Time to leave for spinning: expected sleep overshoot plus one sigma. */
+static uint64_t overshoot_estimate_us(const sdl2_pacer_t *ctx)
+{
+    if (ctx->overshoot.n == 0)
+    {
+        return SDL2P_INITIAL_OVERSHOOT_US;
+    }
+    double est = ctx->overshoot.mean + stat_stddev(&ctx->overshoot);
+    if (est < 0.0)
+    {
+        return 0;
+    }
+    if (est > (double)SDL2P_MAX_OVERSHOOT_US)
+    {
+        return SDL2P_MAX_OVERSHOOT_US;
+    }
+    return (uint64_t)est;
+}
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+sdl2_pacer_t *sdl2_pacer_create(sdl2_pacer_clock_fn clock_fn, sdl2_pacer_sleep_fn sleep_fn,
+                                sdl2_pacer_status_t *status)
+{
+    if (clock_fn == NULL || sleep_fn == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = SDL2P_ERR_NULL_ARG;
+        }
+        return NULL;
+    }
+
+    sdl2_pacer_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = SDL2P_ERR_ALLOC_FAILED;
+        }
+        return NULL;
+    }
+
+    ctx->clock_fn = clock_fn;
+    ctx->sleep_fn = sleep_fn;
+    ctx->enabled = true;
+
+    if (status != NULL)
+    {
+        *status = SDL2P_OK;
+    }
+    return ctx;
+}
+
+void sdl2_pacer_destroy(sdl2_pacer_t *ctx)
+{
+    free(ctx);
+}
+
+/* =========================================================================
+ * Public API — Configuration
+ * ========================================================================= */
+
+void sdl2_pacer_set_enabled(sdl2_pacer_t *ctx, bool enabled)
+{
+    if (ctx != NULL)
+    {
+        ctx->enabled = enabled;
+    }
+}
+
+bool sdl2_pacer_is_enabled(const sdl2_pacer_t *ctx)
+{
+    return ctx != NULL && ctx->enabled;
+}
+
+void sdl2_pacer_set_refresh_hz(sdl2_pacer_t *ctx, int hz)
+{
+    if (ctx != NULL)
+    {
+        ctx->refresh_us = hz > 0 ? 1000000U / (uint64_t)hz : 0;
+    }
+}
+
+/* =========================================================================
+ * Public API — Pacing
+ * ========================================================================= */
+
+uint64_t sdl2_pacer_now(const sdl2_pacer_t *ctx)
+{
+    return ctx != NULL ? ctx->clock_fn() : 0;
+}
+
+uint64_t sdl2_pacer_deadline(const sdl2_pacer_t *ctx, uint64_t frame_start_us,
+                             uint64_t tick_due_us, uint64_t tick_interval_us)
+{
+    uint64_t latest = frame_start_us + SDL2P_MAX_TICKS_PER_FRAME * tick_interval_us;
+    uint64_t due = tick_due_us;
+    if (ctx != NULL && ctx->refresh_us > 0)
+    {
+        due = frame_start_us + ctx->refresh_us;
+    }
+    return due < latest ? due : latest;
+}
+
+void sdl2_pacer_wait_until(sdl2_pacer_t *ctx, uint64_t deadline_us)
+{
+    if (ctx == NULL || !ctx->enabled)
+    {
+        return;
+    }
+
+    uint64_t now = ctx->clock_fn();
+    if (now >= deadline_us)
+    {
+        return;
+    }
+
+    /* Coarse part: whole milliseconds, leaving the expected overshoot. */
+    uint64_t margin = overshoot_estimate_us(ctx);
+    if (deadline_us - now > margin + US_PER_MS)
+    {
+        uint64_t ms = (deadline_us - now - margin) / US_PER_MS;
+        ctx->sleep_fn((uint32_t)ms);
+        uint64_t after = ctx->clock_fn();
+        stat_add(&ctx->overshoot, (double)(after - now) - (double)(ms * US_PER_MS));
+        ctx->slept_us += after - now;
+        now = after;
+    }
+
+    /* Fine part: spin out the remainder. */
+    uint64_t spin_start = now;
+    while (now < deadline_us)
+    {
+        now = ctx->clock_fn();
+    }
+    ctx->spun_us += now - spin_start;
+
+    uint64_t late = now - deadline_us;
+    stat_add(&ctx->late, (double)late);
+    if (late > ctx->late_max_us)
+    {
+        ctx->late_max_us = late;
+    }
+}
+
+void sdl2_pacer_get_stats(const sdl2_pacer_t *ctx, sdl2_pacer_stats_t *out)
+{
+    if (out == NULL)
+    {
+        return;
+    }
+    memset(out, 0, sizeof(*out));
+    if (ctx == NULL)
+    {
+        return;
+    }
+    out->waits = ctx->late.n;
+    out->slept_us = ctx->slept_us;
+    out->spun_us = ctx->spun_us;
+    out->late_mean_us = ctx->late.mean;
+    out->late_stddev_us = stat_stddev(&ctx->late);
+    out->late_max_us = ctx->late_max_us;
+    out->overshoot_us = (double)overshoot_estimate_us(ctx);
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *sdl2_pacer_status_string(sdl2_pacer_status_t status)
+{
+    switch (status)
+    {
+        case SDL2P_OK:
+            return "OK";
+        case SDL2P_ERR_NULL_ARG:
+            return "NULL argument";
+        case SDL2P_ERR_ALLOC_FAILED:
+            return "allocation failed";
+    }
+    return "unknown status";
+}
@@ -14,6 +14,7 @@ struct sdl2_renderer
 {
     SDL_Window *window;
     SDL_Renderer *renderer;
+    SDL_Surface *surface; /* Offscreen render target; NULL when windowed */
     int logical_width;
     int logical_height;
     bool fullscreen;
@@ -30,9 +31,33 @@ sdl2_renderer_config_t sdl2_renderer_config_defaults(void)
     cfg.fullscreen = false;
     cfg.vsync = true;
     cfg.title = "- XBoing II -";
+    cfg.offscreen = false;
     return cfg;
 }
 
+/* Offscreen mode: a software renderer drawing into a surface of the
+ * logical size.  Needs no video driver, so SDL video is left alone. */
+static sdl2_renderer_t *create_offscreen(sdl2_renderer_t *ctx)
+{
+    ctx->surface = SDL_CreateRGBSurfaceWithFormat(0, ctx->logical_width, ctx->logical_height, 32,
+                                                  SDL_PIXELFORMAT_ARGB8888);
+    if (ctx->surface == NULL)
+    {
+        free(ctx);
+        return NULL;
+    }
+    ctx->renderer = SDL_CreateSoftwareRenderer(ctx->surface);
+    if (ctx->renderer == NULL)
+    {
+        SDL_FreeSurface(ctx->surface);
+        free(ctx);
+        return NULL;
+    }
+    SDL_RenderSetLogicalSize(ctx->renderer, ctx->logical_width, ctx->logical_height);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    return ctx;
+}
+
 sdl2_renderer_t *sdl2_renderer_create(const sdl2_renderer_config_t *config)
 {
     if (config == NULL)
@@ -51,6 +76,13 @@ sdl2_renderer_t *sdl2_renderer_create(const sdl2_renderer_config_t *config)
         return NULL;
     }
 
+    if (config->offscreen)
+    {
+        ctx->logical_width = config->logical_width;
+        ctx->logical_height = config->logical_height;
+        return create_offscreen(ctx);
+    }
+
     /* Initialize SDL video if not already active. */
     ctx->sdl_video_owned = false;
     if (!(SDL_WasInit(0) & SDL_INIT_VIDEO))
@@ -169,6 +201,10 @@ void sdl2_renderer_destroy(sdl2_renderer_t *ctx)
     {
         SDL_DestroyRenderer(ctx->renderer);
     }
+    if (ctx->surface != NULL)
+    {
+        SDL_FreeSurface(ctx->surface);
+    }
     if (ctx->window != NULL)
     {
         SDL_DestroyWindow(ctx->window);
@@ -322,8 +358,8 @@ void sdl2_renderer_get_window_size(const sdl2_renderer_t *ctx, int *w, int *h)
 
 int sdl2_renderer_set_logical_width(sdl2_renderer_t *ctx, int new_logical_width)
 {
-    if (ctx == NULL || ctx->window == NULL || ctx->renderer == NULL || ctx->logical_height <= 0 ||
-        new_logical_width <= 0)
+    if (ctx == NULL || (ctx->window == NULL && ctx->surface == NULL) || ctx->renderer == NULL ||
+        ctx->logical_height <= 0 || new_logical_width <= 0)
     {
         return -1;
     }
@@ -340,7 +376,7 @@ int sdl2_renderer_set_logical_width(sdl2_renderer_t *ctx, int new_logical_width)
     int old_win_w = 0;
     int win_h = 0;
     bool window_resized = false;
-    if (!ctx->fullscreen)
+    if (ctx->window != NULL && !ctx->fullscreen)
     {
         SDL_GetWindowSize(ctx->window, &old_win_w, &win_h);
         int new_win_w = (new_logical_width * win_h) / ctx->logical_height;
@@ -360,6 +396,15 @@ int sdl2_renderer_set_logical_width(sdl2_renderer_t *ctx, int new_logical_width)
     return 0;
 }
 
+bool sdl2_renderer_is_offscreen(const sdl2_renderer_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return false;
+    }
+    return ctx->surface != NULL;
+}
+
 int sdl2_renderer_save_screenshot(const sdl2_renderer_t *ctx, const char *path)
 {
     if (ctx == NULL || ctx->renderer == NULL || path == NULL)
@@ -34,6 +34,9 @@ struct sdl2_state
     /* User data passed to all callbacks. */
     void *user_data;
 
+    /* Called on every mode change before on_enter; NULL = none. */
+    sdl2_state_transition_fn transition_hook;
+
     /* If nonzero, log every state transition to stderr.  Set from
      * XBOING_LOG_TRANSITIONS env var at creation time. */
     int log_transitions;
@@ -56,6 +59,15 @@ static void call_handler(sdl2_state_handler_fn fn, sdl2_state_mode_t mode, void
     }
 }
 
+static void call_transition_hook(const sdl2_state_t *ctx, sdl2_state_mode_t from,
+                                 sdl2_state_mode_t to)
+{
+    if (ctx->transition_hook != NULL)
+    {
+        ctx->transition_hook(from, to, ctx->user_data);
+    }
+}
+
 /* =========================================================================
  * Public API — Lifecycle
  * ========================================================================= */
@@ -119,6 +131,17 @@ sdl2_state_status_t sdl2_state_register(sdl2_state_t *ctx, sdl2_state_mode_t mod
     return SDL2ST_OK;
 }
 
+sdl2_state_status_t sdl2_state_set_transition_hook(sdl2_state_t *ctx,
+                                                   sdl2_state_transition_fn hook)
+{
+    if (ctx == NULL)
+    {
+        return SDL2ST_ERR_NULL_ARG;
+    }
+    ctx->transition_hook = hook;
+    return SDL2ST_OK;
+}
+
 /* =========================================================================
  * Public API — Transitions
  * ========================================================================= */
@@ -158,6 +181,7 @@ sdl2_state_status_t sdl2_state_transition(sdl2_state_t *ctx, sdl2_state_mode_t n
     }
 
     /* Call enter on new mode. */
+    call_transition_hook(ctx, old_mode, new_mode);
     call_handler(ctx->handlers[new_mode].on_enter, new_mode, ctx->user_data);
 
     return SDL2ST_OK;
@@ -186,6 +210,7 @@ sdl2_state_status_t sdl2_state_push_dialogue(sdl2_state_t *ctx)
     ctx->current = SDL2ST_DIALOGUE;
 
     /* Call enter on dialogue. */
+    call_transition_hook(ctx, ctx->previous, SDL2ST_DIALOGUE);
     call_handler(ctx->handlers[SDL2ST_DIALOGUE].on_enter, SDL2ST_DIALOGUE, ctx->user_data);
 
     return SDL2ST_OK;
@@ -214,6 +239,7 @@ sdl2_state_status_t sdl2_state_pop_dialogue(sdl2_state_t *ctx)
     ctx->in_dialogue = false;
 
     /* Call enter on restored mode. */
+    call_transition_hook(ctx, SDL2ST_DIALOGUE, restore);
     call_handler(ctx->handlers[restore].on_enter, restore, ctx->user_data);
 
     return SDL2ST_OK;
@@ -2,19 +2,24 @@
  * sdl2_texture.c — SDL2 texture loading and caching.
  *
  * See include/sdl2_texture.h for API documentation.
- * See ADR-005 in docs/DESIGN.md for design rationale.
+ * See ADR-005 in docs/DESIGN.md for design rationale, ADR-085 for the
+ * atlas pages, ADR-097 for decoding on the worker pool, ADR-098 for the
+ * asset pack, and ADR-099 for lazy residency.
  */
 
 #include "sdl2_texture.h"
 
 #include <dirent.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <SDL2/SDL_image.h>
 
+#include "atlas_pack.h"
+
 /* =========================================================================
  * Internal data structures
  * ========================================================================= */
@@ -23,9 +28,18 @@ struct sdl2_texture_entry
 {
     char key[SDL2T_MAX_KEY_LEN + 1];
     SDL_Texture *texture;
-    int width;
-    int height;
+    SDL_Surface *pending; /* Decoded image waiting to be packed (create only) */
+    SDL_Rect rect;        /* Image within texture */
+    bool in_atlas;        /* texture is a shared atlas page, not owned */
     bool occupied;
+
+    /* Lazy mode: where the image reloads from (a PNG file, or RGBA32
+     * pixels in the asset pack), and the frame it was last used in. */
+    char *path;
+    const void *pixels;
+    int pitch;
+    bool failed; /* the last load failed; not retried */
+    unsigned long last_use;
 };
 
 struct sdl2_texture
@@ -34,6 +48,24 @@ struct sdl2_texture
     struct sdl2_texture_entry entries[SDL2T_MAX_TEXTURES];
     int count;
     bool img_initialized;
+    bool packing; /* create() is deferring textures until the atlas is built */
+    int atlas_size;
+    SDL_Texture *atlas_pages[SDL2T_MAX_ATLAS_PAGES];
+    int atlas_page_count;
+
+    /* Residency.  In lazy mode images load on use and, over vram_budget
+     * (0 = no limit), images last used before frame are unloaded. */
+    bool lazy;
+    size_t vram_budget;
+    unsigned long frame;
+    int resident;
+    size_t resident_bytes;
+
+    /* Dense ID table from sdl2_texture_bind_ids(): entry index per ID,
+     * or -1 while the key is not cached. */
+    const char *const *id_keys;
+    int id_count;
+    short id_slot[SDL2T_MAX_TEXTURES];
 };
 
 /* =========================================================================
@@ -86,15 +118,14 @@ static struct sdl2_texture_entry *find_slot(struct sdl2_texture_entry *entries,
 /*
  * Find an occupied slot matching the key exactly.  Returns NULL if not found.
  */
-static const struct sdl2_texture_entry *find_entry(const struct sdl2_texture_entry *entries,
-                                                   const char *key)
+static struct sdl2_texture_entry *find_entry(struct sdl2_texture_entry *entries, const char *key)
 {
     unsigned int idx = fnv1a_hash(key) % SDL2T_MAX_TEXTURES;
 
     for (int i = 0; i < SDL2T_MAX_TEXTURES; i++)
     {
         unsigned int probe = (idx + (unsigned int)i) % SDL2T_MAX_TEXTURES;
-        const struct sdl2_texture_entry *e = &entries[probe];
+        struct sdl2_texture_entry *e = &entries[probe];
 
         if (!e->occupied)
         {
@@ -109,18 +140,149 @@ static const struct sdl2_texture_entry *find_entry(const struct sdl2_texture_ent
     return NULL;
 }
 
+/* =========================================================================
+ * Dense IDs
+ * ========================================================================= */
+
+/* Point every bound ID whose key is key at entry slot. */
+static void bind_slot(sdl2_texture_t *ctx, const char *key, int slot)
+{
+    for (int id = 0; id < ctx->id_count; id++)
+    {
+        if (ctx->id_slot[id] < 0 && ctx->id_keys[id] != NULL && strcmp(ctx->id_keys[id], key) == 0)
+        {
+            ctx->id_slot[id] = (short)slot;
+        }
+    }
+}
+
+static void fill_info(const struct sdl2_texture_entry *e, sdl2_texture_info_t *info)
+{
+    info->texture = e->texture;
+    info->rect = e->rect;
+    info->width = e->rect.w;
+    info->height = e->rect.h;
+}
+
+/* Texture memory of a w x h image: every texture is 32-bit. */
+static size_t image_bytes(int w, int h)
+{
+    return (size_t)w * (size_t)h * 4;
+}
+
 /* =========================================================================
  * File loading
  * ========================================================================= */
 
+/* Free the images an entry holds.  Atlas pages belong to the context.
+ * The entry stays cached, with its lazy-mode source. */
+static void release_entry(sdl2_texture_t *ctx, struct sdl2_texture_entry *e)
+{
+    if (e->texture != NULL)
+    {
+        ctx->resident--;
+        if (!e->in_atlas)
+        {
+            ctx->resident_bytes -= image_bytes(e->rect.w, e->rect.h);
+            SDL_DestroyTexture(e->texture);
+        }
+    }
+    if (e->pending != NULL)
+    {
+        SDL_FreeSurface(e->pending);
+    }
+    e->texture = NULL;
+    e->pending = NULL;
+    e->in_atlas = false;
+}
+
+/*
+ * Insert/replace a decoded image into the hash map, taking ownership of
+ * surface.  While ctx->packing is set the surface is kept for
+ * build_atlas() instead of being turned into a texture of its own.
+ * path is only used in log messages.
+ */
+static sdl2_texture_status_t insert_surface(sdl2_texture_t *ctx, const char *key, const char *path,
+                                            SDL_Surface *surface)
+{
+    size_t key_len = strlen(key);
+    if (key_len > SDL2T_MAX_KEY_LEN)
+    {
+        SDL_FreeSurface(surface);
+        return SDL2T_ERR_KEY_TOO_LONG;
+    }
+
+    SDL_Texture *texture = NULL;
+    if (!ctx->packing)
+    {
+        texture = SDL_CreateTextureFromSurface(ctx->renderer, surface);
+        if (texture == NULL)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                         "sdl2_texture: failed to create texture for '%s': %s", path,
+                         SDL_GetError());
+            SDL_FreeSurface(surface);
+            return SDL2T_ERR_LOAD_FAILED;
+        }
+    }
+
+    struct sdl2_texture_entry *slot = find_slot(ctx->entries, key);
+    if (slot == NULL)
+    {
+        if (texture != NULL)
+        {
+            SDL_DestroyTexture(texture);
+        }
+        SDL_FreeSurface(surface);
+        return SDL2T_ERR_CACHE_FULL;
+    }
+
+    /* If replacing an existing entry, release the old image.  Bound IDs
+     * keep pointing at the slot. */
+    bool replacing = slot->occupied && strcmp(slot->key, key) == 0;
+    if (replacing)
+    {
+        release_entry(ctx, slot);
+        ctx->count--;
+    }
+
+    memset(slot->key, 0, sizeof(slot->key));
+    memcpy(slot->key, key, key_len);
+    slot->texture = texture;
+    slot->pending = NULL;
+    slot->rect = (SDL_Rect){0, 0, surface->w, surface->h};
+    slot->in_atlas = false;
+    slot->occupied = true;
+    ctx->count++;
+    if (!replacing)
+    {
+        bind_slot(ctx, slot->key, (int)(slot - ctx->entries));
+    }
+    if (texture != NULL)
+    {
+        ctx->resident++;
+        ctx->resident_bytes += image_bytes(surface->w, surface->h);
+    }
+
+    if (ctx->packing)
+    {
+        slot->pending = surface;
+    }
+    else
+    {
+        SDL_FreeSurface(surface);
+    }
+
+    return SDL2T_OK;
+}
+
 /*
  * Load a single PNG and insert/replace into the hash map.
  * Internal helper used by both create() and load_file().
  */
 static sdl2_texture_status_t insert_texture(sdl2_texture_t *ctx, const char *key, const char *path)
 {
-    size_t key_len = strlen(key);
-    if (key_len > SDL2T_MAX_KEY_LEN)
+    if (strlen(key) > SDL2T_MAX_KEY_LEN)
     {
         return SDL2T_ERR_KEY_TOO_LONG;
     }
@@ -132,44 +294,434 @@ static sdl2_texture_status_t insert_texture(sdl2_texture_t *ctx, const char *key
                      IMG_GetError());
         return SDL2T_ERR_LOAD_FAILED;
     }
+    return insert_surface(ctx, key, path, surface);
+}
 
-    SDL_Texture *texture = SDL_CreateTextureFromSurface(ctx->renderer, surface);
-    int w = surface->w;
-    int h = surface->h;
-    SDL_FreeSurface(surface);
+/* =========================================================================
+ * Lazy residency
+ * ========================================================================= */
 
-    if (texture == NULL)
+/*
+ * Lazy mode: record where key's image comes from -- a PNG file (path) or
+ * w x h RGBA32 pixels pitch bytes apart -- without loading it.  Replaces
+ * any entry under key.
+ */
+static sdl2_texture_status_t register_image(sdl2_texture_t *ctx, const char *key, const char *path,
+                                            const void *pixels, int w, int h, int pitch)
+{
+    size_t key_len = strlen(key);
+    if (key_len > SDL2T_MAX_KEY_LEN)
     {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                     "sdl2_texture: failed to create texture for '%s': %s", path, SDL_GetError());
-        return SDL2T_ERR_LOAD_FAILED;
+        return SDL2T_ERR_KEY_TOO_LONG;
     }
 
     struct sdl2_texture_entry *slot = find_slot(ctx->entries, key);
     if (slot == NULL)
     {
-        SDL_DestroyTexture(texture);
         return SDL2T_ERR_CACHE_FULL;
     }
 
-    /* If replacing an existing entry, destroy the old texture. */
-    if (slot->occupied && strcmp(slot->key, key) == 0)
+    char *path_copy = NULL;
+    if (path != NULL)
     {
-        SDL_DestroyTexture(slot->texture);
+        path_copy = SDL_strdup(path);
+        if (path_copy == NULL)
+        {
+            return SDL2T_ERR_LOAD_FAILED;
+        }
+    }
+
+    bool replacing = slot->occupied;
+    if (replacing)
+    {
+        release_entry(ctx, slot);
+        SDL_free(slot->path);
         ctx->count--;
     }
 
     memset(slot->key, 0, sizeof(slot->key));
     memcpy(slot->key, key, key_len);
-    slot->texture = texture;
-    slot->width = w;
-    slot->height = h;
+    slot->texture = NULL;
+    slot->pending = NULL;
+    slot->rect = (SDL_Rect){0, 0, w, h};
+    slot->in_atlas = false;
     slot->occupied = true;
+    slot->path = path_copy;
+    slot->pixels = pixels;
+    slot->pitch = pitch;
+    slot->failed = false;
+    slot->last_use = 0;
     ctx->count++;
+    if (!replacing)
+    {
+        bind_slot(ctx, slot->key, (int)(slot - ctx->entries));
+    }
+    return SDL2T_OK;
+}
 
+/*
+ * Unload least recently used images until incoming more bytes fit the
+ * budget.  Images used in the current frame are kept, so what one frame
+ * draws can exceed the budget.  Returns false if incoming does not fit.
+ */
+static bool make_room(sdl2_texture_t *ctx, size_t incoming)
+{
+    if (ctx->vram_budget == 0)
+    {
+        return true;
+    }
+
+    while (ctx->resident_bytes + incoming > ctx->vram_budget)
+    {
+        struct sdl2_texture_entry *victim = NULL;
+        for (int i = 0; i < SDL2T_MAX_TEXTURES; i++)
+        {
+            struct sdl2_texture_entry *e = &ctx->entries[i];
+            if (e->texture == NULL || e->in_atlas || (e->path == NULL && e->pixels == NULL) ||
+                e->last_use >= ctx->frame)
+            {
+                continue;
+            }
+            if (victim == NULL || e->last_use < victim->last_use)
+            {
+                victim = e;
+            }
+        }
+        if (victim == NULL)
+        {
+            return false;
+        }
+        release_entry(ctx, victim);
+    }
+    return true;
+}
+
+/*
+ * Upload surface as e's texture, taking ownership of it.  With must_fit,
+ * give up with SDL2T_ERR_CACHE_FULL when the budget has no room;
+ * otherwise exceed it.
+ */
+static sdl2_texture_status_t upload(sdl2_texture_t *ctx, struct sdl2_texture_entry *e,
+                                    SDL_Surface *surface, bool must_fit)
+{
+    if (!make_room(ctx, image_bytes(surface->w, surface->h)) && must_fit)
+    {
+        SDL_FreeSurface(surface);
+        return SDL2T_ERR_CACHE_FULL;
+    }
+
+    SDL_Texture *texture = SDL_CreateTextureFromSurface(ctx->renderer, surface);
+    if (texture == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                     "sdl2_texture: failed to create texture for '%s': %s", e->key,
+                     SDL_GetError());
+        SDL_FreeSurface(surface);
+        e->failed = true;
+        return SDL2T_ERR_LOAD_FAILED;
+    }
+
+    e->texture = texture;
+    e->rect = (SDL_Rect){0, 0, surface->w, surface->h};
+    ctx->resident++;
+    ctx->resident_bytes += image_bytes(surface->w, surface->h);
+    SDL_FreeSurface(surface);
     return SDL2T_OK;
 }
 
+/* Load e's image from its source and upload it, as upload() does. */
+static sdl2_texture_status_t make_resident(sdl2_texture_t *ctx, struct sdl2_texture_entry *e,
+                                           bool must_fit)
+{
+    if (e->texture != NULL)
+    {
+        return SDL2T_OK;
+    }
+    if (e->failed)
+    {
+        return SDL2T_ERR_LOAD_FAILED;
+    }
+    /* Size known from the pack or an earlier load: check before decoding. */
+    if (must_fit && e->rect.w > 0 && !make_room(ctx, image_bytes(e->rect.w, e->rect.h)))
+    {
+        return SDL2T_ERR_CACHE_FULL;
+    }
+
+    SDL_Surface *surface;
+    if (e->pixels != NULL)
+    {
+        surface = SDL_CreateRGBSurfaceWithFormatFrom((void *)e->pixels, e->rect.w, e->rect.h, 32,
+                                                     e->pitch, SDL_PIXELFORMAT_RGBA32);
+    }
+    else
+    {
+        surface = IMG_Load(e->path);
+    }
+    if (surface == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: failed to load '%s': %s",
+                     e->path != NULL ? e->path : e->key, SDL_GetError());
+        e->failed = true;
+        return SDL2T_ERR_LOAD_FAILED;
+    }
+    return upload(ctx, e, surface, must_fit);
+}
+
+/* Fill *info for a draw of e.  In lazy mode, load e if needed and mark
+ * it used in the current frame. */
+static sdl2_texture_status_t use_entry(sdl2_texture_t *ctx, struct sdl2_texture_entry *e,
+                                       sdl2_texture_info_t *info)
+{
+    if (ctx->lazy)
+    {
+        if (make_resident(ctx, e, false) != SDL2T_OK)
+        {
+            return SDL2T_ERR_NOT_FOUND;
+        }
+        e->last_use = ctx->frame;
+    }
+    fill_info(e, info);
+    return SDL2T_OK;
+}
+
+/* Returns true if key starts with one of prefixes. */
+static bool has_prefix(const char *key, const char *const *prefixes, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (prefixes[i] != NULL && strncmp(key, prefixes[i], strlen(prefixes[i])) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* =========================================================================
+ * Decode pool jobs
+ * ========================================================================= */
+
+/* Runs on a decode worker.  SDL errors are per thread, so log here. */
+static void *decode_png(const char *path)
+{
+    SDL_Surface *surface = IMG_Load(path);
+    if (surface == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: failed to load '%s': %s", path,
+                     IMG_GetError());
+    }
+    return surface;
+}
+
+static void free_surface(void *item)
+{
+    SDL_FreeSurface(item);
+}
+
+/*
+ * Insert every image of the decoder's texture batch as it completes.
+ * Returns the number of files that failed to decode or insert.
+ */
+static int take_decoded(sdl2_texture_t *ctx, sdl2_decode_t *decoder)
+{
+    int failures = 0;
+    sdl2_decode_result_t r;
+    while (sdl2_decode_take(decoder, SDL2T_DECODE_BATCH, &r))
+    {
+        if (r.item == NULL || insert_surface(ctx, r.key, r.path, r.item) != SDL2T_OK)
+        {
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/* =========================================================================
+ * Asset pack
+ * ========================================================================= */
+
+#define PACK_IMAGE_PREFIX "images/"
+
+/*
+ * Insert every "images/" entry of pack.  The surfaces borrow the mapped
+ * pixels (the mapping is read-only, and SDL only reads them), so the
+ * first copy of each image is its upload.  In lazy mode the entries are
+ * only registered.  Returns the number of entries that are malformed or
+ * failed to insert.
+ */
+static int load_pack(sdl2_texture_t *ctx, const asset_pack_t *pack)
+{
+    const size_t prefix_len = strlen(PACK_IMAGE_PREFIX);
+    int failures = 0;
+    int n = asset_pack_count(pack);
+    for (int i = 0; i < n; i++)
+    {
+        asset_pack_entry_t e;
+        if (asset_pack_get(pack, i, &e) != ASSET_PACK_OK ||
+            strncmp(e.key, PACK_IMAGE_PREFIX, prefix_len) != 0)
+        {
+            continue;
+        }
+
+        uint32_t w = e.param[0];
+        uint32_t h = e.param[1];
+        uint32_t pitch = e.param[2];
+        if (e.kind != ASSET_PACK_PIXELS || w == 0 || h == 0 || w > INT32_MAX / 4 ||
+            h > INT32_MAX || pitch < w * 4 || pitch > INT32_MAX || (size_t)pitch * h > e.size)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: bad pack image '%s'",
+                         e.key);
+            failures++;
+            continue;
+        }
+
+        if (ctx->lazy)
+        {
+            if (register_image(ctx, e.key + prefix_len, NULL, e.data, (int)w, (int)h,
+                               (int)pitch) != SDL2T_OK)
+            {
+                failures++;
+            }
+            continue;
+        }
+
+        SDL_Surface *surface =
+            SDL_CreateRGBSurfaceWithFormatFrom((void *)e.data, (int)w, (int)h, 32, (int)pitch,
+                                               SDL_PIXELFORMAT_RGBA32);
+        if (surface == NULL)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                         "sdl2_texture: cannot wrap pack image '%s': %s", e.key,
+                         SDL_GetError());
+            failures++;
+            continue;
+        }
+        if (insert_surface(ctx, e.key + prefix_len, e.key, surface) != SDL2T_OK)
+        {
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/* =========================================================================
+ * Atlas pages
+ * ========================================================================= */
+
+/*
+ * Copy every pending image onto atlas pages, one SDL_Texture per page,
+ * and point the entries at their page and rect.  Images the packer
+ * cannot place (larger than a page, or out of pages) and pages SDL
+ * cannot create fall back to a texture per image.  Returns the number
+ * of images left without a texture.
+ */
+static int build_atlas(sdl2_texture_t *ctx)
+{
+    atlas_pack_item_t items[SDL2T_MAX_TEXTURES];
+    int slots[SDL2T_MAX_TEXTURES];
+    int n = 0;
+    for (int i = 0; i < SDL2T_MAX_TEXTURES; i++)
+    {
+        const struct sdl2_texture_entry *e = &ctx->entries[i];
+        if (e->occupied && e->pending != NULL)
+        {
+            items[n] = (atlas_pack_item_t){.w = e->rect.w, .h = e->rect.h};
+            slots[n] = i;
+            n++;
+        }
+    }
+
+    int pages = 0;
+    atlas_pack_status_t ps = atlas_pack(items, n, ctx->atlas_size, SDL2T_ATLAS_PADDING,
+                                        SDL2T_MAX_ATLAS_PAGES, &pages);
+    if (ps != ATLAS_PACK_OK)
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: atlas packing failed: %s",
+                    atlas_pack_status_string(ps));
+        pages = 0;
+    }
+
+    for (int p = 0; p < pages; p++)
+    {
+        SDL_Surface *sheet = SDL_CreateRGBSurfaceWithFormat(0, ctx->atlas_size, ctx->atlas_size,
+                                                            32, SDL_PIXELFORMAT_RGBA32);
+        if (sheet == NULL)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                        "sdl2_texture: cannot allocate atlas page: %s", SDL_GetError());
+            continue;
+        }
+
+        /* Copy pixels verbatim: the page starts fully transparent and a
+         * colour-keyed image leaves its keyed pixels that way. */
+        for (int k = 0; k < n; k++)
+        {
+            if (items[k].page != p)
+            {
+                continue;
+            }
+            SDL_Surface *src = ctx->entries[slots[k]].pending;
+            SDL_Rect dst = {items[k].x, items[k].y, items[k].w, items[k].h};
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(src, NULL, sheet, &dst);
+        }
+
+        SDL_Texture *page = SDL_CreateTextureFromSurface(ctx->renderer, sheet);
+        SDL_FreeSurface(sheet);
+        if (page == NULL)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                        "sdl2_texture: cannot create atlas page: %s", SDL_GetError());
+            continue;
+        }
+        SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+        ctx->atlas_pages[ctx->atlas_page_count++] = page;
+        ctx->resident_bytes += image_bytes(ctx->atlas_size, ctx->atlas_size);
+
+        for (int k = 0; k < n; k++)
+        {
+            if (items[k].page != p)
+            {
+                continue;
+            }
+            struct sdl2_texture_entry *e = &ctx->entries[slots[k]];
+            SDL_FreeSurface(e->pending);
+            e->pending = NULL;
+            e->texture = page;
+            e->rect = (SDL_Rect){items[k].x, items[k].y, items[k].w, items[k].h};
+            e->in_atlas = true;
+            ctx->resident++;
+        }
+    }
+
+    /* Whatever did not land on a page gets its own texture. */
+    int failures = 0;
+    for (int k = 0; k < n; k++)
+    {
+        struct sdl2_texture_entry *e = &ctx->entries[slots[k]];
+        if (e->pending == NULL)
+        {
+            continue;
+        }
+        e->texture = SDL_CreateTextureFromSurface(ctx->renderer, e->pending);
+        if (e->texture == NULL)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                         "sdl2_texture: failed to create texture for '%s': %s", e->key,
+                         SDL_GetError());
+            failures++;
+        }
+        else
+        {
+            ctx->resident++;
+            ctx->resident_bytes += image_bytes(e->rect.w, e->rect.h);
+        }
+        SDL_FreeSurface(e->pending);
+        e->pending = NULL;
+    }
+    return failures;
+}
+
 /* =========================================================================
  * Recursive directory scanning
  * ========================================================================= */
@@ -219,13 +771,17 @@ static bool derive_key(const char *path, size_t base_dir_len, char *key_buf)
     return true;
 }
 
+/* Called for each .png found; returns false if the file failed. */
+typedef bool (*scan_visit_fn)(void *ud, const char *key, const char *path);
+
 /*
- * Recursively scan a directory for .png files and load each into the cache.
+ * Recursively scan a directory for .png files and pass each to visit.
  * dir_path is the full path to the current directory.
  * base_dir_len is the length of the root base_dir (for key derivation).
- * Returns the number of files that failed to load.
+ * Returns the number of files that failed, or -1 if dir_path cannot be
+ * opened.
  */
-static int scan_directory(sdl2_texture_t *ctx, const char *dir_path, size_t base_dir_len)
+static int scan_directory(const char *dir_path, size_t base_dir_len, scan_visit_fn visit, void *ud)
 {
     DIR *dir = opendir(dir_path);
     if (dir == NULL)
@@ -260,7 +816,7 @@ static int scan_directory(sdl2_texture_t *ctx, const char *dir_path, size_t base
 #ifdef _DIRENT_HAVE_D_TYPE
         if (entry->d_type == DT_DIR)
         {
-            int sub_failures = scan_directory(ctx, full_path, base_dir_len);
+            int sub_failures = scan_directory(full_path, base_dir_len, visit, ud);
             if (sub_failures > 0)
             {
                 failures += sub_failures;
@@ -281,8 +837,7 @@ static int scan_directory(sdl2_texture_t *ctx, const char *dir_path, size_t base
                 failures++;
                 continue;
             }
-            sdl2_texture_status_t st = insert_texture(ctx, key_buf, full_path);
-            if (st != SDL2T_OK)
+            if (!visit(ud, key_buf, full_path))
             {
                 failures++;
             }
@@ -295,7 +850,7 @@ static int scan_directory(sdl2_texture_t *ctx, const char *dir_path, size_t base
             if (probe != NULL)
             {
                 closedir(probe);
-                int sub_failures = scan_directory(ctx, full_path, base_dir_len);
+                int sub_failures = scan_directory(full_path, base_dir_len, visit, ud);
                 if (sub_failures > 0)
                 {
                     failures += sub_failures;
@@ -310,7 +865,7 @@ static int scan_directory(sdl2_texture_t *ctx, const char *dir_path, size_t base
             if (probe != NULL)
             {
                 closedir(probe);
-                int sub_failures = scan_directory(ctx, full_path, base_dir_len);
+                int sub_failures = scan_directory(full_path, base_dir_len, visit, ud);
                 if (sub_failures > 0)
                 {
                     failures += sub_failures;
@@ -324,6 +879,22 @@ static int scan_directory(sdl2_texture_t *ctx, const char *dir_path, size_t base
     return failures;
 }
 
+static bool visit_load(void *ud, const char *key, const char *path)
+{
+    return insert_texture(ud, key, path) == SDL2T_OK;
+}
+
+static bool visit_register(void *ud, const char *key, const char *path)
+{
+    return register_image(ud, key, path, NULL, 0, 0, 0) == SDL2T_OK;
+}
+
+static bool visit_queue(void *ud, const char *key, const char *path)
+{
+    return sdl2_decode_submit(ud, SDL2T_DECODE_BATCH, key, path, decode_png, free_surface) ==
+           SDL2D_OK;
+}
+
 /* =========================================================================
  * Public API
  * ========================================================================= */
@@ -334,9 +905,45 @@ sdl2_texture_config_t sdl2_texture_config_defaults(void)
     memset(&cfg, 0, sizeof(cfg));
     cfg.renderer = NULL;
     cfg.base_dir = "assets/images";
+    cfg.atlas_size = SDL2T_ATLAS_SIZE;
+    cfg.decoder = NULL;
+    cfg.pack = NULL;
+    cfg.lazy = false;
+    cfg.vram_budget = 0;
     return cfg;
 }
 
+sdl2_texture_status_t sdl2_texture_queue_decode(sdl2_decode_t *decoder, const char *base_dir)
+{
+    if (decoder == NULL)
+    {
+        return SDL2T_ERR_NULL_ARG;
+    }
+
+    /* Once, on this thread, before any worker calls IMG_Load(). */
+    if ((IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG) == 0)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: IMG_Init failed: %s",
+                     IMG_GetError());
+        return SDL2T_ERR_IMG_INIT;
+    }
+
+    const char *dir = base_dir != NULL ? base_dir : "assets/images";
+    int failures = scan_directory(dir, strlen(dir), visit_queue, decoder);
+    if (failures < 0)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: cannot open directory '%s'",
+                     dir);
+        return SDL2T_ERR_SCAN_FAILED;
+    }
+    if (failures > 0)
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+                    "sdl2_texture: %d file(s) could not be queued from '%s'", failures, dir);
+    }
+    return SDL2T_OK;
+}
+
 sdl2_texture_t *sdl2_texture_create(const sdl2_texture_config_t *config,
                                     sdl2_texture_status_t *status)
 {
@@ -395,7 +1002,50 @@ sdl2_texture_t *sdl2_texture_create(const sdl2_texture_config_t *config,
     /* Scan the base directory. */
     const char *base_dir = config->base_dir != NULL ? config->base_dir : "assets/images";
 
-    int failures = scan_directory(ctx, base_dir, strlen(base_dir));
+    /* Pages larger than the renderer accepts would never be created. */
+    ctx->atlas_size = config->atlas_size;
+    SDL_RendererInfo rinfo;
+    if (ctx->atlas_size > 0 && SDL_GetRendererInfo(ctx->renderer, &rinfo) == 0)
+    {
+        if (rinfo.max_texture_width > 0 && ctx->atlas_size > rinfo.max_texture_width)
+        {
+            ctx->atlas_size = rinfo.max_texture_width;
+        }
+        if (rinfo.max_texture_height > 0 && ctx->atlas_size > rinfo.max_texture_height)
+        {
+            ctx->atlas_size = rinfo.max_texture_height;
+        }
+    }
+    ctx->lazy = config->lazy;
+    ctx->vram_budget = config->vram_budget;
+    ctx->frame = 1;
+    ctx->packing = ctx->atlas_size > 0 && !ctx->lazy;
+
+    int failures;
+    if (asset_pack_count_prefix(config->pack, PACK_IMAGE_PREFIX) > 0)
+    {
+        base_dir = "asset pack";
+        failures = load_pack(ctx, config->pack);
+    }
+    else if (ctx->lazy)
+    {
+        failures = scan_directory(base_dir, strlen(base_dir), visit_register, ctx);
+    }
+    else if (config->decoder != NULL)
+    {
+        /* sdl2_texture_queue_decode() initialized SDL_image for us. */
+        ctx->img_initialized = true;
+        failures = take_decoded(ctx, config->decoder);
+    }
+    else
+    {
+        failures = scan_directory(base_dir, strlen(base_dir), visit_load, ctx);
+    }
+    if (failures >= 0 && ctx->packing)
+    {
+        failures += build_atlas(ctx);
+    }
+    ctx->packing = false;
     if (failures < 0)
     {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: cannot open directory '%s'",
@@ -431,11 +1081,16 @@ void sdl2_texture_destroy(sdl2_texture_t *ctx)
 
     for (int i = 0; i < SDL2T_MAX_TEXTURES; i++)
     {
-        if (ctx->entries[i].occupied && ctx->entries[i].texture != NULL)
+        if (ctx->entries[i].occupied)
         {
-            SDL_DestroyTexture(ctx->entries[i].texture);
+            release_entry(ctx, &ctx->entries[i]);
+            SDL_free(ctx->entries[i].path);
         }
     }
+    for (int p = 0; p < ctx->atlas_page_count; p++)
+    {
+        SDL_DestroyTexture(ctx->atlas_pages[p]);
+    }
 
     if (ctx->img_initialized)
     {
@@ -445,7 +1100,7 @@ void sdl2_texture_destroy(sdl2_texture_t *ctx)
     free(ctx);
 }
 
-sdl2_texture_status_t sdl2_texture_get(const sdl2_texture_t *ctx, const char *key,
+sdl2_texture_status_t sdl2_texture_get(sdl2_texture_t *ctx, const char *key,
                                        sdl2_texture_info_t *info)
 {
     if (ctx == NULL || key == NULL || info == NULL)
@@ -453,18 +1108,110 @@ sdl2_texture_status_t sdl2_texture_get(const sdl2_texture_t *ctx, const char *ke
         return SDL2T_ERR_NULL_ARG;
     }
 
-    const struct sdl2_texture_entry *e = find_entry(ctx->entries, key);
+    struct sdl2_texture_entry *e = find_entry(ctx->entries, key);
     if (e == NULL)
     {
         return SDL2T_ERR_NOT_FOUND;
     }
 
-    info->texture = e->texture;
-    info->width = e->width;
-    info->height = e->height;
+    return use_entry(ctx, e, info);
+}
+
+sdl2_texture_status_t sdl2_texture_bind_ids(sdl2_texture_t *ctx, const char *const *keys,
+                                            int count)
+{
+    if (ctx == NULL || (keys == NULL && count > 0))
+    {
+        return SDL2T_ERR_NULL_ARG;
+    }
+    if (count < 0 || count > SDL2T_MAX_TEXTURES)
+    {
+        return SDL2T_ERR_CACHE_FULL;
+    }
+
+    ctx->id_keys = keys;
+    ctx->id_count = count;
+    for (int id = 0; id < count; id++)
+    {
+        ctx->id_slot[id] = -1;
+        if (keys[id] == NULL)
+        {
+            continue;
+        }
+        const struct sdl2_texture_entry *e = find_entry(ctx->entries, keys[id]);
+        if (e != NULL)
+        {
+            ctx->id_slot[id] = (short)(e - ctx->entries);
+        }
+    }
     return SDL2T_OK;
 }
 
+sdl2_texture_status_t sdl2_texture_get_id(sdl2_texture_t *ctx, int id,
+                                          sdl2_texture_info_t *info)
+{
+    if (ctx == NULL || info == NULL)
+    {
+        return SDL2T_ERR_NULL_ARG;
+    }
+    if (id < 0 || id >= ctx->id_count || ctx->id_slot[id] < 0)
+    {
+        return SDL2T_ERR_NOT_FOUND;
+    }
+
+    return use_entry(ctx, &ctx->entries[ctx->id_slot[id]], info);
+}
+
+sdl2_texture_status_t sdl2_texture_prefetch(sdl2_texture_t *ctx, const char *const *prefixes,
+                                            int count)
+{
+    if (ctx == NULL || (prefixes == NULL && count > 0))
+    {
+        return SDL2T_ERR_NULL_ARG;
+    }
+    if (!ctx->lazy)
+    {
+        return SDL2T_OK;
+    }
+
+    /* Mark the resident ones first, so making room for the others never
+     * unloads an image that was asked for. */
+    for (int i = 0; i < SDL2T_MAX_TEXTURES; i++)
+    {
+        struct sdl2_texture_entry *e = &ctx->entries[i];
+        if (e->texture != NULL && has_prefix(e->key, prefixes, count))
+        {
+            e->last_use = ctx->frame;
+        }
+    }
+    for (int i = 0; i < SDL2T_MAX_TEXTURES; i++)
+    {
+        struct sdl2_texture_entry *e = &ctx->entries[i];
+        if (!e->occupied || e->texture != NULL || e->failed || !has_prefix(e->key, prefixes, count))
+        {
+            continue;
+        }
+        if (make_resident(ctx, e, true) == SDL2T_OK)
+        {
+            e->last_use = ctx->frame;
+        }
+    }
+    return SDL2T_OK;
+}
+
+void sdl2_texture_next_frame(sdl2_texture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    ctx->frame++;
+    if (ctx->lazy)
+    {
+        (void)make_room(ctx, 0);
+    }
+}
+
 sdl2_texture_status_t sdl2_texture_load_file(sdl2_texture_t *ctx, const char *key, const char *path)
 {
     if (ctx == NULL || key == NULL || path == NULL)
@@ -472,7 +1219,29 @@ sdl2_texture_status_t sdl2_texture_load_file(sdl2_texture_t *ctx, const char *ke
         return SDL2T_ERR_NULL_ARG;
     }
 
-    return insert_texture(ctx, key, path);
+    if (!ctx->lazy)
+    {
+        return insert_texture(ctx, key, path);
+    }
+
+    /* Lazy mode: register the file as the image's source, then upload it
+     * now so that failures are reported here as in eager mode. */
+    SDL_Surface *surface = IMG_Load(path);
+    if (surface == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "sdl2_texture: failed to load '%s': %s", path,
+                     IMG_GetError());
+        return SDL2T_ERR_LOAD_FAILED;
+    }
+    sdl2_texture_status_t st = register_image(ctx, key, path, NULL, 0, 0, 0);
+    if (st != SDL2T_OK)
+    {
+        SDL_FreeSurface(surface);
+        return st;
+    }
+    struct sdl2_texture_entry *e = find_entry(ctx->entries, key);
+    e->last_use = ctx->frame;
+    return upload(ctx, e, surface, false);
 }
 
 int sdl2_texture_count(const sdl2_texture_t *ctx)
@@ -484,6 +1253,33 @@ int sdl2_texture_count(const sdl2_texture_t *ctx)
     return ctx->count;
 }
 
+int sdl2_texture_resident_count(const sdl2_texture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    return ctx->resident;
+}
+
+size_t sdl2_texture_resident_bytes(const sdl2_texture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    return ctx->resident_bytes;
+}
+
+int sdl2_texture_atlas_pages(const sdl2_texture_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    return ctx->atlas_page_count;
+}
+
 const char *sdl2_texture_status_string(sdl2_texture_status_t status)
 {
     switch (status)
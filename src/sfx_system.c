@@ -73,7 +73,7 @@ static int get_rand(const sfx_system_t *ctx)
 {
     if (ctx->rand_fn)
     {
-        return ctx->rand_fn();
+        return ctx->rand_fn(ctx->user_data);
     }
     return rand();
 }
@@ -0,0 +1,580 @@
+/*
+ * sim_batch.c — Multi-threaded batch runner for headless simulations.
+ *
+ * See include/sim_batch.h for API documentation.
+ *
+ * Each worker owns a half-open range [next, end) of job indices behind
+ * its own mutex.  The owner pops from `next`; a thief locks the victim
+ * with the most jobs left and takes the back half by lowering `end`.
+ * Ranges only ever shrink or get replaced by a stolen range, so a worker
+ * that finds every range empty can exit: no new work will appear.
+ *
+ * The calling thread is worker 0.  If pthread_create fails for a worker,
+ * its range is simply stolen by the others, so the run still completes.
+ */
+
+#include "sim_batch.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SIM_BATCH_DEFAULT_MAX_TICKS 200000
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+typedef struct
+{
+    char *path;
+    uint64_t seed;
+    sim_policy_t policy;
+    sim_batch_result_t result;
+} sim_batch_job_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    size_t next;
+    size_t end;
+} sim_batch_range_t;
+
+typedef struct
+{
+    sim_batch_t *batch;
+    sim_batch_range_t *ranges;
+    int workers;
+} sim_batch_run_state_t;
+
+typedef struct
+{
+    sim_batch_run_state_t *run;
+    int self;
+} sim_batch_worker_t;
+
+struct sim_batch
+{
+    sim_batch_config_t config;
+
+    sim_batch_job_t *jobs;
+    size_t job_count;
+    size_t job_capacity;
+    size_t played; /* Jobs [0, played) have results */
+
+    sim_batch_summary_t *summaries;
+    size_t summary_count;
+
+    int threads_used;
+};
+
+/* =========================================================================
+ * Playing one job
+ * ========================================================================= */
+
+static void play_job(const sim_batch_config_t *config, sim_batch_job_t *job)
+{
+    sim_batch_result_t *res = &job->result;
+    memset(res, 0, sizeof(*res));
+    res->path = job->path;
+    res->seed = job->seed;
+    res->policy = job->policy;
+
+    sim_system_config_t sc;
+    sim_system_config_init(&sc);
+    sc.speed_level = config->speed_level;
+    sc.lives = config->lives;
+    sc.policy = job->policy;
+    sc.seed = job->seed;
+
+    sim_system_t *sim = sim_system_create(&sc, &res->load);
+    if (sim == NULL)
+    {
+        return;
+    }
+
+    res->load = sim_system_load_level(sim, job->path);
+    if (res->load == SIM_SYS_OK)
+    {
+        (void)sim_system_run(sim, config->max_ticks);
+        (void)sim_system_get_stats(sim, &res->stats);
+    }
+    sim_system_destroy(sim);
+}
+
+/* =========================================================================
+ * Work stealing
+ * ========================================================================= */
+
+static int take_own(sim_batch_range_t *range, size_t *out)
+{
+    int found = 0;
+    pthread_mutex_lock(&range->lock);
+    if (range->next < range->end)
+    {
+        *out = range->next++;
+        found = 1;
+    }
+    pthread_mutex_unlock(&range->lock);
+    return found;
+}
+
+/*
+ * Move the back half of the fullest other range into ranges[self].
+ * Returns 0 when no other range has work left.
+ */
+static int steal(sim_batch_run_state_t *run, int self)
+{
+    for (;;)
+    {
+        int victim = -1;
+        size_t most = 0;
+        for (int i = 0; i < run->workers; i++)
+        {
+            if (i == self)
+            {
+                continue;
+            }
+            pthread_mutex_lock(&run->ranges[i].lock);
+            size_t left = run->ranges[i].end - run->ranges[i].next;
+            pthread_mutex_unlock(&run->ranges[i].lock);
+            if (left > most)
+            {
+                most = left;
+                victim = i;
+            }
+        }
+        if (victim < 0)
+        {
+            return 0;
+        }
+
+        sim_batch_range_t *v = &run->ranges[victim];
+        pthread_mutex_lock(&v->lock);
+        size_t left = v->end - v->next;
+        size_t take = (left + 1) / 2;
+        size_t begin = v->end - take;
+        size_t end = v->end;
+        v->end = begin;
+        pthread_mutex_unlock(&v->lock);
+
+        if (take == 0)
+        {
+            continue; /* Victim drained between scan and lock — rescan */
+        }
+
+        sim_batch_range_t *own = &run->ranges[self];
+        pthread_mutex_lock(&own->lock);
+        own->next = begin;
+        own->end = end;
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    sim_batch_worker_t *w = arg;
+    sim_batch_run_state_t *run = w->run;
+    sim_batch_t *batch = run->batch;
+
+    for (;;)
+    {
+        size_t index;
+        if (take_own(&run->ranges[w->self], &index))
+        {
+            play_job(&batch->config, &batch->jobs[index]);
+        }
+        else if (!steal(run, w->self))
+        {
+            break;
+        }
+    }
+    return NULL;
+}
+
+static int resolve_thread_count(int requested, size_t jobs)
+{
+    long n = requested;
+    if (n <= 0)
+    {
+        n = sysconf(_SC_NPROCESSORS_ONLN);
+        if (n <= 0)
+        {
+            n = 1;
+        }
+    }
+    if ((size_t)n > jobs)
+    {
+        n = (long)jobs;
+    }
+    return n < 1 ? 1 : (int)n;
+}
+
+/* =========================================================================
+ * Summaries
+ * ========================================================================= */
+
+static int compare_ulong(const void *a, const void *b)
+{
+    unsigned long x = *(const unsigned long *)a;
+    unsigned long y = *(const unsigned long *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted, non-empty array. */
+static unsigned long percentile(const unsigned long *sorted, size_t n, int pct)
+{
+    size_t rank = ((size_t)pct * n + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static void summarize_level(const sim_batch_t *batch, const char *path, unsigned long *scores,
+                            sim_batch_summary_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->path = path;
+
+    size_t played = 0;
+    double ticks_sum = 0.0;
+    double balls_sum = 0.0;
+    double score_sum = 0.0;
+
+    for (size_t i = 0; i < batch->played; i++)
+    {
+        const sim_batch_result_t *r = &batch->jobs[i].result;
+        if (strcmp(r->path, path) != 0)
+        {
+            continue;
+        }
+        out->runs++;
+        if (r->load != SIM_SYS_OK)
+        {
+            out->load_errors++;
+            continue;
+        }
+
+        switch (r->stats.outcome)
+        {
+            case SIM_OUTCOME_LEVEL_CLEARED:
+                if (out->cleared == 0 || r->stats.outcome_tick < out->ticks_to_clear_min)
+                {
+                    out->ticks_to_clear_min = r->stats.outcome_tick;
+                }
+                if (r->stats.outcome_tick > out->ticks_to_clear_max)
+                {
+                    out->ticks_to_clear_max = r->stats.outcome_tick;
+                }
+                ticks_sum += (double)r->stats.outcome_tick;
+                out->cleared++;
+                break;
+            case SIM_OUTCOME_GAME_OVER:
+                out->game_over++;
+                break;
+            case SIM_OUTCOME_RUNNING:
+                out->timed_out++;
+                break;
+        }
+
+        if (r->stats.balls_lost > out->balls_lost_max)
+        {
+            out->balls_lost_max = r->stats.balls_lost;
+        }
+        balls_sum += r->stats.balls_lost;
+        score_sum += (double)r->stats.score;
+        scores[played++] = r->stats.score;
+    }
+
+    if (out->cleared > 0)
+    {
+        out->ticks_to_clear_mean = ticks_sum / out->cleared;
+    }
+    if (played > 0)
+    {
+        qsort(scores, played, sizeof(*scores), compare_ulong);
+        out->clear_rate = (double)out->cleared / (double)played;
+        out->balls_lost_mean = balls_sum / (double)played;
+        out->score_mean = score_sum / (double)played;
+        out->score_min = scores[0];
+        out->score_p50 = percentile(scores, played, 50);
+        out->score_p90 = percentile(scores, played, 90);
+        out->score_max = scores[played - 1];
+    }
+}
+
+static sim_batch_status_t rebuild_summaries(sim_batch_t *batch)
+{
+    free(batch->summaries);
+    batch->summaries = NULL;
+    batch->summary_count = 0;
+    if (batch->played == 0)
+    {
+        return SIM_BATCH_OK;
+    }
+
+    batch->summaries = calloc(batch->played, sizeof(*batch->summaries));
+    unsigned long *scores = malloc(batch->played * sizeof(*scores));
+    if (batch->summaries == NULL || scores == NULL)
+    {
+        free(batch->summaries);
+        free(scores);
+        batch->summaries = NULL;
+        return SIM_BATCH_ERR_ALLOC_FAILED;
+    }
+
+    for (size_t i = 0; i < batch->played; i++)
+    {
+        const char *path = batch->jobs[i].path;
+        int seen = 0;
+        for (size_t s = 0; s < batch->summary_count && !seen; s++)
+        {
+            seen = strcmp(batch->summaries[s].path, path) == 0;
+        }
+        if (!seen)
+        {
+            summarize_level(batch, path, scores, &batch->summaries[batch->summary_count++]);
+        }
+    }
+
+    free(scores);
+    return SIM_BATCH_OK;
+}
+
+/* =========================================================================
+ * Lifecycle
+ * ========================================================================= */
+
+void sim_batch_config_init(sim_batch_config_t *config)
+{
+    if (config == NULL)
+    {
+        return;
+    }
+    sim_system_config_t sc;
+    sim_system_config_init(&sc);
+
+    config->threads = 0;
+    config->max_ticks = SIM_BATCH_DEFAULT_MAX_TICKS;
+    config->speed_level = sc.speed_level;
+    config->lives = sc.lives;
+}
+
+sim_batch_t *sim_batch_create(const sim_batch_config_t *config, sim_batch_status_t *status)
+{
+    sim_batch_t *batch = calloc(1, sizeof(*batch));
+    if (batch == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = SIM_BATCH_ERR_ALLOC_FAILED;
+        }
+        return NULL;
+    }
+
+    if (config != NULL)
+    {
+        batch->config = *config;
+    }
+    else
+    {
+        sim_batch_config_init(&batch->config);
+    }
+
+    if (status != NULL)
+    {
+        *status = SIM_BATCH_OK;
+    }
+    return batch;
+}
+
+void sim_batch_destroy(sim_batch_t *batch)
+{
+    if (batch == NULL)
+    {
+        return;
+    }
+    for (size_t i = 0; i < batch->job_count; i++)
+    {
+        free(batch->jobs[i].path);
+    }
+    free(batch->jobs);
+    free(batch->summaries);
+    free(batch);
+}
+
+/* =========================================================================
+ * Jobs
+ * ========================================================================= */
+
+sim_batch_status_t sim_batch_add_job(sim_batch_t *batch, const char *path, uint64_t seed,
+                                     sim_policy_t policy)
+{
+    if (batch == NULL || path == NULL)
+    {
+        return SIM_BATCH_ERR_NULL_ARG;
+    }
+
+    if (batch->job_count == batch->job_capacity)
+    {
+        size_t cap = batch->job_capacity ? batch->job_capacity * 2 : 64;
+        sim_batch_job_t *jobs = realloc(batch->jobs, cap * sizeof(*jobs));
+        if (jobs == NULL)
+        {
+            return SIM_BATCH_ERR_ALLOC_FAILED;
+        }
+        batch->jobs = jobs;
+        batch->job_capacity = cap;
+    }
+
+    size_t len = strlen(path) + 1;
+    char *copy = malloc(len);
+    if (copy == NULL)
+    {
+        return SIM_BATCH_ERR_ALLOC_FAILED;
+    }
+    memcpy(copy, path, len);
+
+    sim_batch_job_t *job = &batch->jobs[batch->job_count++];
+    memset(job, 0, sizeof(*job));
+    job->path = copy;
+    job->seed = seed;
+    job->policy = policy;
+    return SIM_BATCH_OK;
+}
+
+size_t sim_batch_job_count(const sim_batch_t *batch)
+{
+    return batch ? batch->job_count : 0;
+}
+
+sim_batch_status_t sim_batch_run(sim_batch_t *batch)
+{
+    if (batch == NULL)
+    {
+        return SIM_BATCH_ERR_NULL_ARG;
+    }
+
+    size_t first = batch->played;
+    size_t pending = batch->job_count - first;
+    if (pending == 0)
+    {
+        return rebuild_summaries(batch);
+    }
+
+    int workers = resolve_thread_count(batch->config.threads, pending);
+    sim_batch_range_t *ranges = calloc((size_t)workers, sizeof(*ranges));
+    sim_batch_worker_t *args = calloc((size_t)workers, sizeof(*args));
+    pthread_t *tids = calloc((size_t)workers, sizeof(*tids));
+    int *started = calloc((size_t)workers, sizeof(*started));
+    if (ranges == NULL || args == NULL || tids == NULL || started == NULL)
+    {
+        free(ranges);
+        free(args);
+        free(tids);
+        free(started);
+        return SIM_BATCH_ERR_ALLOC_FAILED;
+    }
+
+    sim_batch_run_state_t run = {batch, ranges, workers};
+    for (int i = 0; i < workers; i++)
+    {
+        pthread_mutex_init(&ranges[i].lock, NULL);
+        ranges[i].next = first + pending * (size_t)i / (size_t)workers;
+        ranges[i].end = first + pending * (size_t)(i + 1) / (size_t)workers;
+        args[i].run = &run;
+        args[i].self = i;
+    }
+
+    int used = 1;
+    for (int i = 1; i < workers; i++)
+    {
+        started[i] = pthread_create(&tids[i], NULL, worker_main, &args[i]) == 0;
+        used += started[i];
+    }
+    (void)worker_main(&args[0]);
+    for (int i = 1; i < workers; i++)
+    {
+        if (started[i])
+        {
+            pthread_join(tids[i], NULL);
+        }
+    }
+
+    for (int i = 0; i < workers; i++)
+    {
+        pthread_mutex_destroy(&ranges[i].lock);
+    }
+    free(ranges);
+    free(args);
+    free(tids);
+    free(started);
+
+    batch->played = batch->job_count;
+    batch->threads_used = used;
+    return rebuild_summaries(batch);
+}
+
+/* =========================================================================
+ * Results
+ * ========================================================================= */
+
+sim_batch_status_t sim_batch_get_result(const sim_batch_t *batch, size_t index,
+                                        sim_batch_result_t *out)
+{
+    if (batch == NULL || out == NULL)
+    {
+        return SIM_BATCH_ERR_NULL_ARG;
+    }
+    if (index >= batch->played)
+    {
+        return SIM_BATCH_ERR_BAD_INDEX;
+    }
+    *out = batch->jobs[index].result;
+    return SIM_BATCH_OK;
+}
+
+size_t sim_batch_summary_count(const sim_batch_t *batch)
+{
+    return batch ? batch->summary_count : 0;
+}
+
+sim_batch_status_t sim_batch_get_summary(const sim_batch_t *batch, size_t index,
+                                         sim_batch_summary_t *out)
+{
+    if (batch == NULL || out == NULL)
+    {
+        return SIM_BATCH_ERR_NULL_ARG;
+    }
+    if (index >= batch->summary_count)
+    {
+        return SIM_BATCH_ERR_BAD_INDEX;
+    }
+    *out = batch->summaries[index];
+    return SIM_BATCH_OK;
+}
+
+int sim_batch_threads_used(const sim_batch_t *batch)
+{
+    return batch ? batch->threads_used : 0;
+}
+
+/* =========================================================================
+ * Utility
+ * ========================================================================= */
+
+const char *sim_batch_status_string(sim_batch_status_t status)
+{
+    switch (status)
+    {
+        case SIM_BATCH_OK:
+            return "OK";
+        case SIM_BATCH_ERR_NULL_ARG:
+            return "NULL argument";
+        case SIM_BATCH_ERR_ALLOC_FAILED:
+            return "allocation failed";
+        case SIM_BATCH_ERR_BAD_INDEX:
+            return "index out of range";
+    }
+    return "unknown status";
+}
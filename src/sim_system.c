@@ -0,0 +1,821 @@
+/*
+ * sim_system.c — Headless gameplay simulation with no SDL2 dependency.
+ *
+ * See include/sim_system.h for API documentation.
+ *
+ * The callbacks below mirror the ones in src/game_callbacks.c and
+ * src/game_rules.c.  The rules themselves (block hits, explosion
+ * finalize, ball death, bullets, bonus spawning) live in rules_logic,
+ * which the game calls too; only audio, message and sfx effects are
+ * left out here, so a simulated level follows the real game's rules.
+ */
+
+#include "sim_system.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ball_types.h"
+#include "block_types.h"
+#include "eyedude_system.h"
+#include "level_system.h"
+#include "rng.h"
+#include "rules_logic.h"
+#include "sdl2_loop.h"
+
+/* Play area geometry — same values as include/game_context.h, repeated
+ * here so this module does not pull in the SDL2 integration headers. */
+#define SIM_PLAY_WIDTH 495
+#define SIM_PLAY_HEIGHT 580
+#define SIM_MAIN_WIDTH 70
+#define SIM_COL_WIDTH (SIM_PLAY_WIDTH / MAX_COL)
+#define SIM_ROW_HEIGHT (SIM_PLAY_HEIGHT / MAX_ROW)
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+struct sim_system
+{
+    ball_system_t *ball;
+    block_system_t *block;
+    paddle_system_t *paddle;
+    gun_system_t *gun;
+    score_system_t *score;
+    level_system_t *level;
+    special_system_t *special;
+    eyedude_system_t *eyedude;
+
+    /* Everything from here down is plain state and is copied as-is into
+     * snapshots (SIM_STATE_OFFSET).  Keep pointers above this line. */
+    sim_system_config_t config;
+    rng_t rng;
+
+    int frame;
+    int lives_left;
+    int time_remaining;
+    int timer_frame_acc;
+    int ticks_per_sec;
+
+    /* Bonus spawning state — mirrors game_ctx_t's fields of the same name */
+    bool bonus_block_active;
+    int next_bonus_frame;
+    int bonus_row;
+    int bonus_col;
+    int bonus_type;
+    int bonus_count;
+
+    sim_system_stats_t stats;
+};
+
+/* =========================================================================
+ * Random source — rand_fn for every owned system and the rules below
+ * ========================================================================= */
+
+static int sim_rand(void *ud)
+{
+    sim_system_t *ctx = ud;
+    return rng_next(&ctx->rng);
+}
+
+/* =========================================================================
+ * Environment builders — game_callbacks_ball_env / game_callbacks_gun_env
+ * ========================================================================= */
+
+static ball_system_env_t sim_ball_env(const sim_system_t *ctx)
+{
+    ball_system_env_t env = {
+        .frame = ctx->frame,
+        .speed_level = ctx->config.speed_level,
+        .paddle_pos = paddle_system_get_pos(ctx->paddle),
+        .paddle_dx = paddle_system_get_dx(ctx->paddle),
+        .paddle_size = paddle_system_get_size(ctx->paddle),
+        .play_width = SIM_PLAY_WIDTH,
+        .play_height = SIM_PLAY_HEIGHT,
+        .no_walls = special_system_is_active(ctx->special, SPECIAL_NO_WALLS),
+        .killer = special_system_is_active(ctx->special, SPECIAL_KILLER),
+        .sticky_bat = special_system_is_active(ctx->special, SPECIAL_STICKY),
+        .col_width = SIM_COL_WIDTH,
+        .row_height = SIM_ROW_HEIGHT,
+    };
+    return env;
+}
+
+static gun_system_env_t sim_gun_env(const sim_system_t *ctx)
+{
+    gun_system_env_t env = {
+        .frame = ctx->frame,
+        .paddle_pos = paddle_system_get_pos(ctx->paddle),
+        .paddle_size = paddle_system_get_size(ctx->paddle),
+        .fast_gun = special_system_is_active(ctx->special, SPECIAL_FAST_GUN),
+    };
+    return env;
+}
+
+static score_system_env_t sim_score_env(const sim_system_t *ctx)
+{
+    score_system_env_t env = {
+        .x2_active = special_system_is_active(ctx->special, SPECIAL_X2_BONUS),
+        .x4_active = special_system_is_active(ctx->special, SPECIAL_X4_BONUS),
+    };
+    return env;
+}
+
+static void set_outcome(sim_system_t *ctx, sim_outcome_t outcome)
+{
+    if (ctx->stats.outcome != SIM_OUTCOME_RUNNING)
+    {
+        return;
+    }
+    ctx->stats.outcome = outcome;
+    ctx->stats.outcome_tick = ctx->stats.ticks;
+}
+
+/* =========================================================================
+ * Shared rules — rules_logic, as game_callbacks_rules builds it
+ * ========================================================================= */
+
+static ball_system_env_t sim_rules_ball_env(void *ud)
+{
+    return sim_ball_env(ud);
+}
+
+static rules_logic_t sim_rules(sim_system_t *ctx)
+{
+    rules_logic_t rules = {
+        .ball = ctx->ball,
+        .block = ctx->block,
+        .paddle = ctx->paddle,
+        .gun = ctx->gun,
+        .score = ctx->score,
+        .special = ctx->special,
+        .eyedude = ctx->eyedude,
+        .rng = &ctx->rng,
+        .lives_left = &ctx->lives_left,
+        .time_remaining = &ctx->time_remaining,
+        .bonus_count = &ctx->bonus_count,
+        .bonus_block_active = &ctx->bonus_block_active,
+        .next_bonus_frame = &ctx->next_bonus_frame,
+        .bonus_row = &ctx->bonus_row,
+        .bonus_col = &ctx->bonus_col,
+        .bonus_type = &ctx->bonus_type,
+        .col_width = SIM_COL_WIDTH,
+        .row_height = SIM_ROW_HEIGHT,
+        .ball_env = sim_rules_ball_env,
+        .user_data = ctx,
+    };
+    return rules;
+}
+
+/* =========================================================================
+ * Ball system callbacks — ball_cb_* in game_callbacks.c
+ * ========================================================================= */
+
+static int sim_cb_check_region(int row, int col, int bx, int by, int bdx, void *ud)
+{
+    sim_system_t *ctx = ud;
+    return block_system_check_region_bbox(row, col, bx, by, bdx, ctx->block);
+}
+
+static int sim_cb_get_window(int row, int col, block_window_t *out, void *ud)
+{
+    sim_system_t *ctx = ud;
+    return block_system_get_window(row, col, out, ctx->block);
+}
+
+static block_hit_result_t sim_cb_on_block_hit(int row, int col, int ball_index, void *ud)
+{
+    sim_system_t *ctx = ud;
+    rules_logic_t rules = sim_rules(ctx);
+    return rules_logic_block_hit(&rules, row, col, ball_index, ctx->frame);
+}
+
+static int sim_cb_cell_available(int row, int col, void *ud)
+{
+    sim_system_t *ctx = ud;
+    return block_system_cell_available(row, col, ctx->block);
+}
+
+static void sim_cb_on_score(unsigned long points, void *ud)
+{
+    sim_system_t *ctx = ud;
+    score_system_add_raw(ctx->score, points);
+}
+
+/* Ball death — game_rules_ball_died */
+static void sim_ball_died(sim_system_t *ctx)
+{
+    rules_logic_t rules = sim_rules(ctx);
+    rules_ball_death_t death = rules_logic_ball_died(&rules, false);
+    if (death != RULES_BALL_OTHERS_LEFT)
+    {
+        ctx->stats.balls_lost++;
+    }
+    if (death == RULES_BALL_GAME_OVER)
+    {
+        set_outcome(ctx, SIM_OUTCOME_GAME_OVER);
+    }
+}
+
+static void sim_cb_on_event(ball_system_event_t event, int ball_index, void *ud)
+{
+    (void)ball_index;
+    sim_system_t *ctx = ud;
+
+    switch (event)
+    {
+        case BALL_EVT_DIED:
+            sim_ball_died(ctx);
+            break;
+
+        case BALL_EVT_PADDLE_HIT:
+            ctx->stats.paddle_hits++;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* =========================================================================
+ * Block explosion finalize — game_callbacks_on_block_finalize
+ * ========================================================================= */
+
+static void sim_on_block_finalize(int row, int col, int block_type, int hit_points, void *ud)
+{
+    sim_system_t *ctx = ud;
+    ctx->stats.blocks_destroyed++;
+    rules_logic_t rules = sim_rules(ctx);
+    rules_logic_block_finalize(&rules, row, col, block_type, hit_points, ctx->frame);
+}
+
+/* =========================================================================
+ * Gun system callbacks — gun_cb_* in game_callbacks.c
+ * ========================================================================= */
+
+static int sim_gun_check_block_hit(int bx, int by, int *out_row, int *out_col, void *ud)
+{
+    sim_system_t *ctx = ud;
+    rules_logic_t rules = sim_rules(ctx);
+    return rules_logic_bullet_block_at(&rules, bx, by, out_row, out_col);
+}
+
+static void sim_gun_on_block_hit(int row, int col, void *ud)
+{
+    sim_system_t *ctx = ud;
+    rules_logic_t rules = sim_rules(ctx);
+    (void)rules_logic_bullet_block_hit(&rules, row, col, ctx->frame);
+}
+
+static int sim_gun_check_ball_hit(int bx, int by, void *ud)
+{
+    sim_system_t *ctx = ud;
+    rules_logic_t rules = sim_rules(ctx);
+    return rules_logic_bullet_ball_at(&rules, bx, by);
+}
+
+static void sim_gun_on_ball_hit(int ball_index, void *ud)
+{
+    sim_system_t *ctx = ud;
+    ball_system_env_t env = sim_ball_env(ctx);
+    ball_system_change_mode(ctx->ball, &env, ball_index, BALL_POP);
+}
+
+static int sim_gun_check_eyedude_hit(int bx, int by, void *ud)
+{
+    const sim_system_t *ctx = ud;
+    return eyedude_system_check_collision(ctx->eyedude, bx, by, RULES_EYEDUDE_BULLET_HW,
+                                          RULES_EYEDUDE_BULLET_HH);
+}
+
+static void sim_gun_on_eyedude_hit(void *ud)
+{
+    sim_system_t *ctx = ud;
+    eyedude_system_set_state(ctx->eyedude, EYEDUDE_STATE_DIE);
+}
+
+static int sim_gun_is_ball_waiting(void *ud)
+{
+    const sim_system_t *ctx = ud;
+    return ball_system_is_ball_waiting(ctx->ball);
+}
+
+/* =========================================================================
+ * EyeDude and level callbacks
+ * ========================================================================= */
+
+static int sim_eyedude_is_path_clear(void *ud)
+{
+    sim_system_t *ctx = ud;
+    rules_logic_t rules = sim_rules(ctx);
+    return rules_logic_eyedude_path_clear(&rules);
+}
+
+static void sim_eyedude_on_score(unsigned long points, void *ud)
+{
+    sim_system_t *ctx = ud;
+    score_system_env_t senv = sim_score_env(ctx);
+    score_system_add(ctx->score, points, &senv);
+}
+
+static void sim_on_level_add_block(int row, int col, int block_type, int counter_slide, void *ud)
+{
+    sim_system_t *ctx = ud;
+    block_system_add(ctx->block, row, col, block_type, counter_slide, 0);
+}
+
+/* =========================================================================
+ * Input policy
+ * ========================================================================= */
+
+static void sim_apply_policy(sim_system_t *ctx)
+{
+    if (ctx->config.policy != SIM_POLICY_TRACK)
+    {
+        paddle_system_update(ctx->paddle, PADDLE_DIR_NONE, 0);
+        return;
+    }
+
+    /* Launch a waiting ball immediately instead of waiting out
+     * BALL_AUTO_ACTIVE_DELAY. */
+    if (ball_system_is_ball_waiting(ctx->ball))
+    {
+        ball_system_env_t env = sim_ball_env(ctx);
+        (void)ball_system_activate_waiting(ctx->ball, &env);
+    }
+
+    /* Chase the lowest active ball — the one closest to falling out. */
+    int target = -1;
+    int lowest_y = -1;
+    for (int i = 0; i < MAX_BALLS; i++)
+    {
+        if (ball_system_get_state(ctx->ball, i) != BALL_ACTIVE)
+        {
+            continue;
+        }
+        int bx = 0;
+        int by = 0;
+        if (ball_system_get_position(ctx->ball, i, &bx, &by) == BALL_SYS_OK && by > lowest_y)
+        {
+            lowest_y = by;
+            target = bx;
+        }
+    }
+
+    int direction = PADDLE_DIR_NONE;
+    if (target >= 0)
+    {
+        int pos = paddle_system_get_pos(ctx->paddle);
+        if (target < pos - PADDLE_VELOCITY)
+        {
+            direction = PADDLE_DIR_LEFT;
+        }
+        else if (target > pos + PADDLE_VELOCITY)
+        {
+            direction = PADDLE_DIR_RIGHT;
+        }
+
+        /* paddle_system swaps LEFT/RIGHT under reverse; undo it so the
+         * policy still moves toward the ball. */
+        if (direction != PADDLE_DIR_NONE && paddle_system_get_reverse(ctx->paddle))
+        {
+            direction = (direction == PADDLE_DIR_LEFT) ? PADDLE_DIR_RIGHT : PADDLE_DIR_LEFT;
+        }
+    }
+
+    paddle_system_update(ctx->paddle, direction, 0);
+}
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+void sim_system_config_init(sim_system_config_t *config)
+{
+    if (config == NULL)
+    {
+        return;
+    }
+    config->speed_level = SDL2L_DEFAULT_SPEED;
+    config->lives = 3;
+    config->policy = SIM_POLICY_TRACK;
+    config->seed = 1;
+}
+
+sim_system_t *sim_system_create(const sim_system_config_t *config, sim_system_status_t *status)
+{
+    sim_system_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = SIM_SYS_ERR_ALLOC_FAILED;
+        }
+        return NULL;
+    }
+
+    sim_system_config_init(&ctx->config);
+    if (config != NULL)
+    {
+        ctx->config = *config;
+    }
+    if (ctx->config.speed_level < SDL2L_MIN_SPEED || ctx->config.speed_level > SDL2L_MAX_SPEED)
+    {
+        ctx->config.speed_level = SDL2L_DEFAULT_SPEED;
+    }
+
+    rng_seed(&ctx->rng, ctx->config.seed);
+
+    uint64_t tick_us = sdl2_loop_tick_interval_us(ctx->config.speed_level);
+    ctx->ticks_per_sec = (tick_us > 0) ? (int)(1000000ULL / tick_us) : 133;
+
+    ball_system_callbacks_t bcb = {
+        .check_region = sim_cb_check_region,
+        .get_window = sim_cb_get_window,
+        .on_block_hit = sim_cb_on_block_hit,
+        .cell_available = sim_cb_cell_available,
+        .on_score = sim_cb_on_score,
+        .on_event = sim_cb_on_event,
+    };
+    gun_system_callbacks_t gcb = {
+        .check_block_hit = sim_gun_check_block_hit,
+        .on_block_hit = sim_gun_on_block_hit,
+        .check_ball_hit = sim_gun_check_ball_hit,
+        .on_ball_hit = sim_gun_on_ball_hit,
+        .check_eyedude_hit = sim_gun_check_eyedude_hit,
+        .on_eyedude_hit = sim_gun_on_eyedude_hit,
+        .is_ball_waiting = sim_gun_is_ball_waiting,
+    };
+    eyedude_system_callbacks_t ecb = {
+        .is_path_clear = sim_eyedude_is_path_clear,
+        .on_score = sim_eyedude_on_score,
+    };
+    level_system_callbacks_t lcb = {.on_add_block = sim_on_level_add_block};
+    score_system_callbacks_t scb = {0};
+    special_system_callbacks_t spcb = {0};
+
+    ctx->block = block_system_create(SIM_COL_WIDTH, SIM_ROW_HEIGHT, sim_rand, ctx, NULL);
+    ctx->paddle = paddle_system_create(SIM_PLAY_WIDTH, SIM_PLAY_HEIGHT, SIM_MAIN_WIDTH, NULL);
+    ctx->ball = ball_system_create(&bcb, ctx, sim_rand, NULL);
+    ctx->gun = gun_system_create(SIM_PLAY_HEIGHT, &gcb, ctx, NULL);
+    ctx->score = score_system_create(&scb, ctx, NULL);
+    ctx->level = level_system_create(&lcb, ctx, NULL);
+    ctx->special = special_system_create(&spcb, ctx);
+    ctx->eyedude = eyedude_system_create(&ecb, ctx, sim_rand);
+
+    if (!ctx->block || !ctx->paddle || !ctx->ball || !ctx->gun || !ctx->score || !ctx->level ||
+        !ctx->special || !ctx->eyedude)
+    {
+        sim_system_destroy(ctx);
+        if (status != NULL)
+        {
+            *status = SIM_SYS_ERR_ALLOC_FAILED;
+        }
+        return NULL;
+    }
+
+    ctx->lives_left = ctx->config.lives;
+    ctx->bonus_type = NONE_BLK;
+
+    if (status != NULL)
+    {
+        *status = SIM_SYS_OK;
+    }
+    return ctx;
+}
+
+void sim_system_destroy(sim_system_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    eyedude_system_destroy(ctx->eyedude);
+    special_system_destroy(ctx->special);
+    level_system_destroy(ctx->level);
+    score_system_destroy(ctx->score);
+    gun_system_destroy(ctx->gun);
+    ball_system_destroy(ctx->ball);
+    paddle_system_destroy(ctx->paddle);
+    block_system_destroy(ctx->block);
+    free(ctx);
+}
+
+sim_system_status_t sim_system_load_level(sim_system_t *ctx, const char *path)
+{
+    if (ctx == NULL || path == NULL)
+    {
+        return SIM_SYS_ERR_NULL_ARG;
+    }
+
+    /* Reset — start_new_game in src/game_modes.c */
+    ctx->frame = 0;
+    ctx->lives_left = ctx->config.lives;
+    ctx->bonus_block_active = false;
+    ctx->next_bonus_frame = 0;
+    ctx->bonus_row = 0;
+    ctx->bonus_col = 0;
+    ctx->bonus_type = NONE_BLK;
+    ctx->bonus_count = 0;
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+
+    score_system_set(ctx->score, 0);
+    special_system_turn_off(ctx->special);
+    gun_system_set_unlimited(ctx->gun, 0);
+    gun_system_set_ammo(ctx->gun, GUN_AMMO_PER_LEVEL);
+    paddle_system_reset(ctx->paddle);
+    paddle_system_set_reverse(ctx->paddle, 0);
+    paddle_system_set_sticky(ctx->paddle, 0);
+    paddle_system_set_size(ctx->paddle, PADDLE_SIZE_HUGE);
+    ball_system_clear_all(ctx->ball);
+    block_system_clear_all(ctx->block);
+    gun_system_clear(ctx->gun);
+    eyedude_system_set_state(ctx->eyedude, EYEDUDE_STATE_NONE);
+
+    if (level_system_load_file(ctx->level, path) != LEVEL_SYS_OK)
+    {
+        block_system_clear_all(ctx->block);
+        return SIM_SYS_ERR_LEVEL_LOAD;
+    }
+
+    ctx->time_remaining = level_system_get_time_bonus(ctx->level);
+    ctx->timer_frame_acc = 0;
+
+    ball_system_env_t env = sim_ball_env(ctx);
+    ball_system_reset_start(ctx->ball, &env);
+
+    return SIM_SYS_OK;
+}
+
+/* =========================================================================
+ * Public API — Simulation
+ * ========================================================================= */
+
+sim_outcome_t sim_system_tick(sim_system_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return SIM_OUTCOME_RUNNING;
+    }
+    if (ctx->stats.outcome != SIM_OUTCOME_RUNNING)
+    {
+        return ctx->stats.outcome;
+    }
+
+    /* sdl2_state_update increments the frame before dispatching the
+     * mode's update handler. */
+    ctx->frame++;
+    ctx->stats.ticks++;
+
+    /* Same order as mode_game_update (src/game_modes.c) */
+    sim_apply_policy(ctx);
+
+    ball_system_env_t benv = sim_ball_env(ctx);
+    ball_system_update(ctx->ball, &benv);
+
+    gun_system_env_t genv = sim_gun_env(ctx);
+    gun_system_update(ctx->gun, &genv);
+
+    block_system_advance_animations(ctx->block, ctx->frame);
+
+    block_system_ball_pos_t ball_positions[MAX_BALLS];
+    for (int i = 0; i < MAX_BALLS; i++)
+    {
+        ball_system_render_info_t info;
+        if (ball_system_get_render_info(ctx->ball, i, &info) == BALL_SYS_OK)
+        {
+            ball_positions[i].active = info.active;
+            ball_positions[i].x = info.x;
+            ball_positions[i].y = info.y;
+        }
+        else
+        {
+            ball_positions[i].active = 0;
+            ball_positions[i].x = 0;
+            ball_positions[i].y = 0;
+        }
+    }
+    block_system_update_movement(ctx->block, ctx->frame, ball_positions, MAX_BALLS);
+
+    block_system_update_explosions(ctx->block, ctx->frame, sim_on_block_finalize, ctx);
+
+    /* Ball→eyedude collision — game_rules_check_ball_eyedude */
+    if (eyedude_system_get_state(ctx->eyedude) == EYEDUDE_STATE_WALK)
+    {
+        for (int i = 0; i < MAX_BALLS; i++)
+        {
+            int bx = 0;
+            int by = 0;
+            if (ball_system_get_state(ctx->ball, i) == BALL_ACTIVE &&
+                ball_system_get_position(ctx->ball, i, &bx, &by) == BALL_SYS_OK &&
+                eyedude_system_check_collision(ctx->eyedude, bx, by, BALL_WC, BALL_HC))
+            {
+                eyedude_system_set_state(ctx->eyedude, EYEDUDE_STATE_DIE);
+                break;
+            }
+        }
+    }
+    eyedude_system_update(ctx->eyedude, ctx->frame, SIM_PLAY_WIDTH);
+
+    if (ctx->time_remaining > 0)
+    {
+        ctx->timer_frame_acc++;
+        if (ctx->timer_frame_acc >= ctx->ticks_per_sec)
+        {
+            ctx->timer_frame_acc -= ctx->ticks_per_sec;
+            ctx->time_remaining--;
+        }
+    }
+
+    /* A game-over from this tick's ball death ends the run before the
+     * rules check, just as the state transition does in the game. */
+    if (ctx->stats.outcome != SIM_OUTCOME_RUNNING)
+    {
+        return ctx->stats.outcome;
+    }
+
+    /* game_rules_check */
+    if (!block_system_still_active(ctx->block))
+    {
+        special_system_turn_off(ctx->special);
+        set_outcome(ctx, SIM_OUTCOME_LEVEL_CLEARED);
+        return ctx->stats.outcome;
+    }
+    rules_logic_t rules = sim_rules(ctx);
+    rules_logic_spawn_bonus(&rules, ctx->frame);
+
+    return ctx->stats.outcome;
+}
+
+sim_outcome_t sim_system_run(sim_system_t *ctx, uint64_t max_ticks)
+{
+    if (ctx == NULL)
+    {
+        return SIM_OUTCOME_RUNNING;
+    }
+    for (uint64_t t = 0; t < max_ticks; t++)
+    {
+        if (sim_system_tick(ctx) != SIM_OUTCOME_RUNNING)
+        {
+            break;
+        }
+    }
+    return ctx->stats.outcome;
+}
+
+/* =========================================================================
+ * Public API — Snapshots
+ * ========================================================================= */
+
+/* Layout: the owned systems' snapshots back to back, in the order below,
+ * then the tail of struct sim_system from `config` on. */
+#define SIM_STATE_OFFSET offsetof(struct sim_system, config)
+#define SIM_STATE_SIZE (sizeof(struct sim_system) - SIM_STATE_OFFSET)
+
+size_t sim_system_snapshot_size(void)
+{
+    return ball_system_snapshot_size() + block_system_snapshot_size() +
+           paddle_system_snapshot_size() + gun_system_snapshot_size() +
+           score_system_snapshot_size() + special_system_snapshot_size() +
+           eyedude_system_snapshot_size() + SIM_STATE_SIZE;
+}
+
+sim_system_snapshot_t *sim_system_snapshot_create(void)
+{
+    return malloc(sim_system_snapshot_size());
+}
+
+void sim_system_snapshot_destroy(sim_system_snapshot_t *snap)
+{
+    free(snap);
+}
+
+sim_system_status_t sim_system_snapshot_save(const sim_system_t *ctx, sim_system_snapshot_t *snap)
+{
+    if (ctx == NULL || snap == NULL)
+    {
+        return SIM_SYS_ERR_NULL_ARG;
+    }
+
+    unsigned char *p = (unsigned char *)snap;
+    ball_system_snapshot_save(ctx->ball, p);
+    p += ball_system_snapshot_size();
+    block_system_snapshot_save(ctx->block, p);
+    p += block_system_snapshot_size();
+    paddle_system_snapshot_save(ctx->paddle, p);
+    p += paddle_system_snapshot_size();
+    gun_system_snapshot_save(ctx->gun, p);
+    p += gun_system_snapshot_size();
+    score_system_snapshot_save(ctx->score, p);
+    p += score_system_snapshot_size();
+    special_system_snapshot_save(ctx->special, p);
+    p += special_system_snapshot_size();
+    eyedude_system_snapshot_save(ctx->eyedude, p);
+    p += eyedude_system_snapshot_size();
+    memcpy(p, (const unsigned char *)ctx + SIM_STATE_OFFSET, SIM_STATE_SIZE);
+    return SIM_SYS_OK;
+}
+
+sim_system_status_t sim_system_snapshot_load(sim_system_t *ctx, const sim_system_snapshot_t *snap)
+{
+    if (ctx == NULL || snap == NULL)
+    {
+        return SIM_SYS_ERR_NULL_ARG;
+    }
+
+    const unsigned char *p = (const unsigned char *)snap;
+    ball_system_snapshot_load(ctx->ball, p);
+    p += ball_system_snapshot_size();
+    block_system_snapshot_load(ctx->block, p);
+    p += block_system_snapshot_size();
+    paddle_system_snapshot_load(ctx->paddle, p);
+    p += paddle_system_snapshot_size();
+    gun_system_snapshot_load(ctx->gun, p);
+    p += gun_system_snapshot_size();
+    score_system_snapshot_load(ctx->score, p);
+    p += score_system_snapshot_size();
+    special_system_snapshot_load(ctx->special, p);
+    p += special_system_snapshot_size();
+    eyedude_system_snapshot_load(ctx->eyedude, p);
+    p += eyedude_system_snapshot_size();
+    memcpy((unsigned char *)ctx + SIM_STATE_OFFSET, p, SIM_STATE_SIZE);
+    return SIM_SYS_OK;
+}
+
+/* =========================================================================
+ * Public API — Queries
+ * ========================================================================= */
+
+sim_system_status_t sim_system_get_stats(const sim_system_t *ctx, sim_system_stats_t *out)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return SIM_SYS_ERR_NULL_ARG;
+    }
+    *out = ctx->stats;
+    out->score = score_system_get(ctx->score);
+    out->lives_left = ctx->lives_left;
+    out->time_remaining = ctx->time_remaining;
+    return SIM_SYS_OK;
+}
+
+int sim_system_get_frame(const sim_system_t *ctx)
+{
+    return ctx ? ctx->frame : 0;
+}
+
+ball_system_t *sim_system_get_ball(const sim_system_t *ctx)
+{
+    return ctx ? ctx->ball : NULL;
+}
+
+block_system_t *sim_system_get_block(const sim_system_t *ctx)
+{
+    return ctx ? ctx->block : NULL;
+}
+
+paddle_system_t *sim_system_get_paddle(const sim_system_t *ctx)
+{
+    return ctx ? ctx->paddle : NULL;
+}
+
+gun_system_t *sim_system_get_gun(const sim_system_t *ctx)
+{
+    return ctx ? ctx->gun : NULL;
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *sim_system_status_string(sim_system_status_t status)
+{
+    switch (status)
+    {
+        case SIM_SYS_OK:
+            return "OK";
+        case SIM_SYS_ERR_NULL_ARG:
+            return "NULL argument";
+        case SIM_SYS_ERR_ALLOC_FAILED:
+            return "allocation failed";
+        case SIM_SYS_ERR_LEVEL_LOAD:
+            return "level load failed";
+    }
+    return "unknown status";
+}
+
+const char *sim_system_outcome_name(sim_outcome_t outcome)
+{
+    switch (outcome)
+    {
+        case SIM_OUTCOME_RUNNING:
+            return "running";
+        case SIM_OUTCOME_LEVEL_CLEARED:
+            return "cleared";
+        case SIM_OUTCOME_GAME_OVER:
+            return "game_over";
+    }
+    return "unknown";
+}
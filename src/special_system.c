@@ -11,6 +11,7 @@
 
 #include "special_system.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -27,6 +28,8 @@ struct special_system
     int killer;
     int x2_bonus;
     int x4_bonus;
+
+    /* Wiring — everything above is snapshot state (see Snapshots) */
     special_system_callbacks_t callbacks;
     void *user_data;
 };
@@ -277,7 +280,16 @@ void special_system_get_labels(const special_system_t *ctx, int reverse_on,
  * Attract mode
  * ========================================================================= */
 
-special_system_state_t special_system_randomize(special_system_t *ctx, int (*rand_fn)(void))
+static int get_rand(const special_system_t *ctx, special_rand_fn rand_fn)
+{
+    if (rand_fn)
+    {
+        return rand_fn(ctx->user_data);
+    }
+    return rand();
+}
+
+special_system_state_t special_system_randomize(special_system_t *ctx, special_rand_fn rand_fn)
 {
     special_system_state_t state;
     memset(&state, 0, sizeof(state));
@@ -287,8 +299,6 @@ special_system_state_t special_system_randomize(special_system_t *ctx, int (*ran
         return state;
     }
 
-    int (*get_rand)(void) = rand_fn ? rand_fn : rand;
-
     /* Each special has ~49% chance of activation, matching legacy
      * RandomDrawSpecials() which uses (rand() % 100) > 50.
      *
@@ -298,16 +308,16 @@ special_system_state_t special_system_randomize(special_system_t *ctx, int (*ran
      *
      * Callbacks (on_wall_state_changed) are NOT fired — state changes
      * are purely cosmetic for the attract-mode panel animation. */
-    ctx->sticky_bat = (get_rand() % 100) > 50 ? 1 : 0;
-    ctx->saving = (get_rand() % 100) > 50 ? 1 : 0;
-    ctx->fast_gun = (get_rand() % 100) > 50 ? 1 : 0;
-    ctx->no_walls = (get_rand() % 100) > 50 ? 1 : 0;
-    ctx->killer = (get_rand() % 100) > 50 ? 1 : 0;
-    ctx->x2_bonus = (get_rand() % 100) > 50 ? 1 : 0;
-    ctx->x4_bonus = (get_rand() % 100) > 50 ? 1 : 0;
+    ctx->sticky_bat = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
+    ctx->saving = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
+    ctx->fast_gun = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
+    ctx->no_walls = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
+    ctx->killer = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
+    ctx->x2_bonus = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
+    ctx->x4_bonus = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
 
     /* Reverse is also randomized in attract mode (legacy line 246) */
-    int reverse_val = (get_rand() % 100) > 50 ? 1 : 0;
+    int reverse_val = (get_rand(ctx, rand_fn) % 100) > 50 ? 1 : 0;
 
     state.reverse_on = reverse_val;
     state.sticky_bat = ctx->sticky_bat;
@@ -320,3 +330,33 @@ special_system_state_t special_system_randomize(special_system_t *ctx, int (*ran
 
     return state;
 }
+
+/* =========================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* The plain-state head of struct special_system, copied as bytes. */
+#define SPECIAL_SNAPSHOT_SIZE offsetof(struct special_system, callbacks)
+
+size_t special_system_snapshot_size(void)
+{
+    return SPECIAL_SNAPSHOT_SIZE;
+}
+
+void special_system_snapshot_save(const special_system_t *ctx, void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(buf, ctx, SPECIAL_SNAPSHOT_SIZE);
+}
+
+void special_system_snapshot_load(special_system_t *ctx, const void *buf)
+{
+    if (ctx == NULL || buf == NULL)
+    {
+        return;
+    }
+    memcpy(ctx, buf, SPECIAL_SNAPSHOT_SIZE);
+}
@@ -209,21 +209,6 @@
 #define SPR_GUIDE_10 "guides/guide10"
 #define SPR_GUIDE_11 "guides/guide11"
 
-/*
- * Return the texture key for a guide frame (pos 0-10 → guide1-guide11).
- */
-static inline const char *sprite_guide_key(int pos)
-{
-    static const char *keys[] = {SPR_GUIDE_1,  SPR_GUIDE_2,  SPR_GUIDE_3, SPR_GUIDE_4,
-                                 SPR_GUIDE_5,  SPR_GUIDE_6,  SPR_GUIDE_7, SPR_GUIDE_8,
-                                 SPR_GUIDE_9,  SPR_GUIDE_10, SPR_GUIDE_11};
-    if (pos < 0 || pos > 10)
-    {
-        return SPR_GUIDE_6; /* center fallback */
-    }
-    return keys[pos];
-}
-
 /* =========================================================================
  * EyeDude  (assets/images/eyes/)
  * ========================================================================= */
@@ -280,267 +265,449 @@ static inline const char *sprite_guide_key(int pos)
 #define SPR_TEXT "text"
 
 /* =========================================================================
- * Lookup helpers -- map block_types.h constants to texture keys
+ * Sprite IDs
+ *
+ * One ID per key above, in the same order.  Draw code resolves sprites by
+ * ID: sdl2_texture_bind_ids() maps the whole table to cache slots once at
+ * startup, and sdl2_texture_get_id() is then an array index instead of a
+ * string hash and probe per draw.  The SPR_* strings remain for tools,
+ * tests and sdl2_texture_get().  See ADR-086 in docs/DESIGN.md.
  * ========================================================================= */
 
 #include <stddef.h>
 
+#define SPRITE_LIST(X) \
+    X(SPRITE_BALL_1, SPR_BALL_1) \
+    X(SPRITE_BALL_2, SPR_BALL_2) \
+    X(SPRITE_BALL_3, SPR_BALL_3) \
+    X(SPRITE_BALL_4, SPR_BALL_4) \
+    X(SPRITE_BALL_KILLER, SPR_BALL_KILLER) \
+    X(SPRITE_BALL_LIFE, SPR_BALL_LIFE) \
+    X(SPRITE_BALL_BIRTH_1, SPR_BALL_BIRTH_1) \
+    X(SPRITE_BALL_BIRTH_2, SPR_BALL_BIRTH_2) \
+    X(SPRITE_BALL_BIRTH_3, SPR_BALL_BIRTH_3) \
+    X(SPRITE_BALL_BIRTH_4, SPR_BALL_BIRTH_4) \
+    X(SPRITE_BALL_BIRTH_5, SPR_BALL_BIRTH_5) \
+    X(SPRITE_BALL_BIRTH_6, SPR_BALL_BIRTH_6) \
+    X(SPRITE_BALL_BIRTH_7, SPR_BALL_BIRTH_7) \
+    X(SPRITE_BALL_BIRTH_8, SPR_BALL_BIRTH_8) \
+    X(SPRITE_PADDLE_SMALL, SPR_PADDLE_SMALL) \
+    X(SPRITE_PADDLE_MEDIUM, SPR_PADDLE_MEDIUM) \
+    X(SPRITE_PADDLE_HUGE, SPR_PADDLE_HUGE) \
+    X(SPRITE_BLOCK_RED, SPR_BLOCK_RED) \
+    X(SPRITE_BLOCK_BLUE, SPR_BLOCK_BLUE) \
+    X(SPRITE_BLOCK_GREEN, SPR_BLOCK_GREEN) \
+    X(SPRITE_BLOCK_TAN, SPR_BLOCK_TAN) \
+    X(SPRITE_BLOCK_YELLOW, SPR_BLOCK_YELLOW) \
+    X(SPRITE_BLOCK_PURPLE, SPR_BLOCK_PURPLE) \
+    X(SPRITE_BLOCK_BLACK, SPR_BLOCK_BLACK) \
+    X(SPRITE_BLOCK_BLACK_HIT, SPR_BLOCK_BLACK_HIT) \
+    X(SPRITE_BLOCK_BOMB, SPR_BLOCK_BOMB) \
+    X(SPRITE_BLOCK_COUNTER, SPR_BLOCK_COUNTER) \
+    X(SPRITE_BLOCK_COUNTER_1, SPR_BLOCK_COUNTER_1) \
+    X(SPRITE_BLOCK_COUNTER_2, SPR_BLOCK_COUNTER_2) \
+    X(SPRITE_BLOCK_COUNTER_3, SPR_BLOCK_COUNTER_3) \
+    X(SPRITE_BLOCK_COUNTER_4, SPR_BLOCK_COUNTER_4) \
+    X(SPRITE_BLOCK_COUNTER_5, SPR_BLOCK_COUNTER_5) \
+    X(SPRITE_BLOCK_DEATH_1, SPR_BLOCK_DEATH_1) \
+    X(SPRITE_BLOCK_DEATH_2, SPR_BLOCK_DEATH_2) \
+    X(SPRITE_BLOCK_DEATH_3, SPR_BLOCK_DEATH_3) \
+    X(SPRITE_BLOCK_DEATH_4, SPR_BLOCK_DEATH_4) \
+    X(SPRITE_BLOCK_DEATH_5, SPR_BLOCK_DEATH_5) \
+    X(SPRITE_BLOCK_DYNAMITE, SPR_BLOCK_DYNAMITE) \
+    X(SPRITE_BLOCK_HYPERSPACE, SPR_BLOCK_HYPERSPACE) \
+    X(SPRITE_BLOCK_STICKY, SPR_BLOCK_STICKY) \
+    X(SPRITE_BLOCK_REVERSE, SPR_BLOCK_REVERSE) \
+    X(SPRITE_BLOCK_WALLOFF, SPR_BLOCK_WALLOFF) \
+    X(SPRITE_BLOCK_MULTIBALL, SPR_BLOCK_MULTIBALL) \
+    X(SPRITE_BLOCK_MACHGUN, SPR_BLOCK_MACHGUN) \
+    X(SPRITE_BLOCK_LOTSAMMO, SPR_BLOCK_LOTSAMMO) \
+    X(SPRITE_BLOCK_PAD_EXPAND, SPR_BLOCK_PAD_EXPAND) \
+    X(SPRITE_BLOCK_PAD_SHRINK, SPR_BLOCK_PAD_SHRINK) \
+    X(SPRITE_BLOCK_EXTRABALL, SPR_BLOCK_EXTRABALL) \
+    X(SPRITE_BLOCK_EXTRABALL_2, SPR_BLOCK_EXTRABALL_2) \
+    X(SPRITE_BLOCK_X2_1, SPR_BLOCK_X2_1) \
+    X(SPRITE_BLOCK_X2_2, SPR_BLOCK_X2_2) \
+    X(SPRITE_BLOCK_X2_3, SPR_BLOCK_X2_3) \
+    X(SPRITE_BLOCK_X2_4, SPR_BLOCK_X2_4) \
+    X(SPRITE_BLOCK_X4_1, SPR_BLOCK_X4_1) \
+    X(SPRITE_BLOCK_X4_2, SPR_BLOCK_X4_2) \
+    X(SPRITE_BLOCK_X4_3, SPR_BLOCK_X4_3) \
+    X(SPRITE_BLOCK_X4_4, SPR_BLOCK_X4_4) \
+    X(SPRITE_BLOCK_BONUS_1, SPR_BLOCK_BONUS_1) \
+    X(SPRITE_BLOCK_BONUS_2, SPR_BLOCK_BONUS_2) \
+    X(SPRITE_BLOCK_BONUS_3, SPR_BLOCK_BONUS_3) \
+    X(SPRITE_BLOCK_BONUS_4, SPR_BLOCK_BONUS_4) \
+    X(SPRITE_BLOCK_ROAMER, SPR_BLOCK_ROAMER) \
+    X(SPRITE_BLOCK_ROAMER_L, SPR_BLOCK_ROAMER_L) \
+    X(SPRITE_BLOCK_ROAMER_R, SPR_BLOCK_ROAMER_R) \
+    X(SPRITE_BLOCK_ROAMER_U, SPR_BLOCK_ROAMER_U) \
+    X(SPRITE_BLOCK_ROAMER_D, SPR_BLOCK_ROAMER_D) \
+    X(SPRITE_BLOCK_CLOCK, SPR_BLOCK_CLOCK) \
+    X(SPRITE_EXPLODE_RED_1, SPR_EXPLODE_RED_1) \
+    X(SPRITE_EXPLODE_RED_2, SPR_EXPLODE_RED_2) \
+    X(SPRITE_EXPLODE_RED_3, SPR_EXPLODE_RED_3) \
+    X(SPRITE_EXPLODE_BLUE_1, SPR_EXPLODE_BLUE_1) \
+    X(SPRITE_EXPLODE_BLUE_2, SPR_EXPLODE_BLUE_2) \
+    X(SPRITE_EXPLODE_BLUE_3, SPR_EXPLODE_BLUE_3) \
+    X(SPRITE_EXPLODE_GREEN_1, SPR_EXPLODE_GREEN_1) \
+    X(SPRITE_EXPLODE_GREEN_2, SPR_EXPLODE_GREEN_2) \
+    X(SPRITE_EXPLODE_GREEN_3, SPR_EXPLODE_GREEN_3) \
+    X(SPRITE_EXPLODE_TAN_1, SPR_EXPLODE_TAN_1) \
+    X(SPRITE_EXPLODE_TAN_2, SPR_EXPLODE_TAN_2) \
+    X(SPRITE_EXPLODE_TAN_3, SPR_EXPLODE_TAN_3) \
+    X(SPRITE_EXPLODE_YELLOW_1, SPR_EXPLODE_YELLOW_1) \
+    X(SPRITE_EXPLODE_YELLOW_2, SPR_EXPLODE_YELLOW_2) \
+    X(SPRITE_EXPLODE_YELLOW_3, SPR_EXPLODE_YELLOW_3) \
+    X(SPRITE_EXPLODE_PURPLE_1, SPR_EXPLODE_PURPLE_1) \
+    X(SPRITE_EXPLODE_PURPLE_2, SPR_EXPLODE_PURPLE_2) \
+    X(SPRITE_EXPLODE_PURPLE_3, SPR_EXPLODE_PURPLE_3) \
+    X(SPRITE_EXPLODE_BOMB_1, SPR_EXPLODE_BOMB_1) \
+    X(SPRITE_EXPLODE_BOMB_2, SPR_EXPLODE_BOMB_2) \
+    X(SPRITE_EXPLODE_BOMB_3, SPR_EXPLODE_BOMB_3) \
+    X(SPRITE_EXPLODE_COUNTER_1, SPR_EXPLODE_COUNTER_1) \
+    X(SPRITE_EXPLODE_COUNTER_2, SPR_EXPLODE_COUNTER_2) \
+    X(SPRITE_EXPLODE_COUNTER_3, SPR_EXPLODE_COUNTER_3) \
+    X(SPRITE_EXPLODE_DEATH_1, SPR_EXPLODE_DEATH_1) \
+    X(SPRITE_EXPLODE_DEATH_2, SPR_EXPLODE_DEATH_2) \
+    X(SPRITE_EXPLODE_DEATH_3, SPR_EXPLODE_DEATH_3) \
+    X(SPRITE_EXPLODE_DEATH_4, SPR_EXPLODE_DEATH_4) \
+    X(SPRITE_EXPLODE_X2_1, SPR_EXPLODE_X2_1) \
+    X(SPRITE_EXPLODE_X2_2, SPR_EXPLODE_X2_2) \
+    X(SPRITE_EXPLODE_X2_3, SPR_EXPLODE_X2_3) \
+    X(SPRITE_BULLET, SPR_BULLET) \
+    X(SPRITE_TINK, SPR_TINK) \
+    X(SPRITE_DIGIT_0, SPR_DIGIT_0) \
+    X(SPRITE_DIGIT_1, SPR_DIGIT_1) \
+    X(SPRITE_DIGIT_2, SPR_DIGIT_2) \
+    X(SPRITE_DIGIT_3, SPR_DIGIT_3) \
+    X(SPRITE_DIGIT_4, SPR_DIGIT_4) \
+    X(SPRITE_DIGIT_5, SPR_DIGIT_5) \
+    X(SPRITE_DIGIT_6, SPR_DIGIT_6) \
+    X(SPRITE_DIGIT_7, SPR_DIGIT_7) \
+    X(SPRITE_DIGIT_8, SPR_DIGIT_8) \
+    X(SPRITE_DIGIT_9, SPR_DIGIT_9) \
+    X(SPRITE_STAR_1, SPR_STAR_1) \
+    X(SPRITE_STAR_2, SPR_STAR_2) \
+    X(SPRITE_STAR_3, SPR_STAR_3) \
+    X(SPRITE_STAR_4, SPR_STAR_4) \
+    X(SPRITE_STAR_5, SPR_STAR_5) \
+    X(SPRITE_STAR_6, SPR_STAR_6) \
+    X(SPRITE_STAR_7, SPR_STAR_7) \
+    X(SPRITE_STAR_8, SPR_STAR_8) \
+    X(SPRITE_STAR_9, SPR_STAR_9) \
+    X(SPRITE_STAR_10, SPR_STAR_10) \
+    X(SPRITE_STAR_11, SPR_STAR_11) \
+    X(SPRITE_BGRND, SPR_BGRND) \
+    X(SPRITE_BGRND_2, SPR_BGRND_2) \
+    X(SPRITE_BGRND_3, SPR_BGRND_3) \
+    X(SPRITE_BGRND_4, SPR_BGRND_4) \
+    X(SPRITE_BGRND_5, SPR_BGRND_5) \
+    X(SPRITE_BGRND_MAIN, SPR_BGRND_MAIN) \
+    X(SPRITE_BGRND_SPACE, SPR_BGRND_SPACE) \
+    X(SPRITE_GUIDE, SPR_GUIDE) \
+    X(SPRITE_GUIDE_1, SPR_GUIDE_1) \
+    X(SPRITE_GUIDE_2, SPR_GUIDE_2) \
+    X(SPRITE_GUIDE_3, SPR_GUIDE_3) \
+    X(SPRITE_GUIDE_4, SPR_GUIDE_4) \
+    X(SPRITE_GUIDE_5, SPR_GUIDE_5) \
+    X(SPRITE_GUIDE_6, SPR_GUIDE_6) \
+    X(SPRITE_GUIDE_7, SPR_GUIDE_7) \
+    X(SPRITE_GUIDE_8, SPR_GUIDE_8) \
+    X(SPRITE_GUIDE_9, SPR_GUIDE_9) \
+    X(SPRITE_GUIDE_10, SPR_GUIDE_10) \
+    X(SPRITE_GUIDE_11, SPR_GUIDE_11) \
+    X(SPRITE_EYEDUDE, SPR_EYEDUDE) \
+    X(SPRITE_EYEDUDE_1, SPR_EYEDUDE_1) \
+    X(SPRITE_EYEDUDE_2, SPR_EYEDUDE_2) \
+    X(SPRITE_EYEDUDE_3, SPR_EYEDUDE_3) \
+    X(SPRITE_EYEDUDE_4, SPR_EYEDUDE_4) \
+    X(SPRITE_EYEDUDE_5, SPR_EYEDUDE_5) \
+    X(SPRITE_EYEDUDE_DEAD, SPR_EYEDUDE_DEAD) \
+    X(SPRITE_GUY_LEFT_1, SPR_GUY_LEFT_1) \
+    X(SPRITE_GUY_LEFT_2, SPR_GUY_LEFT_2) \
+    X(SPRITE_GUY_LEFT_3, SPR_GUY_LEFT_3) \
+    X(SPRITE_GUY_LEFT_4, SPR_GUY_LEFT_4) \
+    X(SPRITE_GUY_LEFT_5, SPR_GUY_LEFT_5) \
+    X(SPRITE_GUY_LEFT_6, SPR_GUY_LEFT_6) \
+    X(SPRITE_GUY_RIGHT_1, SPR_GUY_RIGHT_1) \
+    X(SPRITE_GUY_RIGHT_2, SPR_GUY_RIGHT_2) \
+    X(SPRITE_GUY_RIGHT_3, SPR_GUY_RIGHT_3) \
+    X(SPRITE_GUY_RIGHT_4, SPR_GUY_RIGHT_4) \
+    X(SPRITE_GUY_RIGHT_5, SPR_GUY_RIGHT_5) \
+    X(SPRITE_GUY_RIGHT_6, SPR_GUY_RIGHT_6) \
+    X(SPRITE_PRESENTS, SPR_PRESENTS) \
+    X(SPRITE_PRESENTS_EARTH, SPR_PRESENTS_EARTH) \
+    X(SPRITE_PRESENTS_FLAG, SPR_PRESENTS_FLAG) \
+    X(SPRITE_PRESENTS_JUSTIN, SPR_PRESENTS_JUSTIN) \
+    X(SPRITE_PRESENTS_KIBELL, SPR_PRESENTS_KIBELL) \
+    X(SPRITE_TITLE_BIG, SPR_TITLE_BIG) \
+    X(SPRITE_TITLE_SMALL, SPR_TITLE_SMALL) \
+    X(SPRITE_TITLE_X, SPR_TITLE_X) \
+    X(SPRITE_TITLE_B, SPR_TITLE_B) \
+    X(SPRITE_TITLE_O, SPR_TITLE_O) \
+    X(SPRITE_TITLE_I, SPR_TITLE_I) \
+    X(SPRITE_TITLE_N, SPR_TITLE_N) \
+    X(SPRITE_TITLE_G, SPR_TITLE_G) \
+    X(SPRITE_FLOPPY, SPR_FLOPPY) \
+    X(SPRITE_HIGHSCORE, SPR_HIGHSCORE) \
+    X(SPRITE_ICON, SPR_ICON) \
+    X(SPRITE_LEFT_ARROW, SPR_LEFT_ARROW) \
+    X(SPRITE_RIGHT_ARROW, SPR_RIGHT_ARROW) \
+    X(SPRITE_MOUSE, SPR_MOUSE) \
+    X(SPRITE_QUESTION, SPR_QUESTION) \
+    X(SPRITE_TEXT, SPR_TEXT)
+
+typedef enum
+{
+    SPRITE_NONE = -1,
+#define SPRITE_ENUM_ENTRY(id, key) id,
+    SPRITE_LIST(SPRITE_ENUM_ENTRY)
+#undef SPRITE_ENUM_ENTRY
+    SPRITE_COUNT
+} sprite_id_t;
+
+/*
+ * Return the key table indexed by sprite_id_t (SPRITE_COUNT entries), for
+ * sdl2_texture_bind_ids().  The table has static storage duration.
+ */
+static inline const char *const *sprite_key_table(void)
+{
+#define SPRITE_KEY_ENTRY(id, key) key,
+    static const char *const keys[SPRITE_COUNT] = {SPRITE_LIST(SPRITE_KEY_ENTRY)};
+#undef SPRITE_KEY_ENTRY
+    return keys;
+}
+
+/* Return the texture key for a sprite ID, or NULL for SPRITE_NONE. */
+static inline const char *sprite_key(sprite_id_t id)
+{
+    if (id < 0 || id >= SPRITE_COUNT)
+        return NULL;
+    return sprite_key_table()[id];
+}
+
+/* =========================================================================
+ * Lookup helpers -- map game state to sprite IDs
+ *
+ * Each sprite_*_id() has a sprite_*_key() twin returning the string key,
+ * kept for tooling and tests.
+ * ========================================================================= */
+
 #include "block_types.h"
 
 /*
- * Return the texture key for a block type constant.
- * Returns NULL for NONE_BLK, KILL_BLK, and unknown types.
+ * Return the sprite for a guide frame (pos 0-10 -> guide1-guide11).
  */
-static inline const char *sprite_block_key(int block_type)
+static inline sprite_id_t sprite_guide_id(int pos)
+{
+    if (pos < 0 || pos > 10)
+    {
+        return SPRITE_GUIDE_6; /* center fallback */
+    }
+    return (sprite_id_t)(SPRITE_GUIDE_1 + pos);
+}
+
+/*
+ * Return the sprite for a block type constant.
+ * Returns SPRITE_NONE for NONE_BLK, KILL_BLK, and unknown types.
+ */
+static inline sprite_id_t sprite_block_id(int block_type)
 {
     switch (block_type)
     {
         case RED_BLK:
-            return SPR_BLOCK_RED;
+            return SPRITE_BLOCK_RED;
         case BLUE_BLK:
-            return SPR_BLOCK_BLUE;
+            return SPRITE_BLOCK_BLUE;
         case GREEN_BLK:
-            return SPR_BLOCK_GREEN;
+            return SPRITE_BLOCK_GREEN;
         case TAN_BLK:
-            return SPR_BLOCK_TAN;
+            return SPRITE_BLOCK_TAN;
         case YELLOW_BLK:
-            return SPR_BLOCK_YELLOW;
+            return SPRITE_BLOCK_YELLOW;
         case PURPLE_BLK:
-            return SPR_BLOCK_PURPLE;
+            return SPRITE_BLOCK_PURPLE;
         case BULLET_BLK:
-            return SPR_BLOCK_YELLOW; /* Bullet block base is yellow; 4 bullet sprites composited on top (original/blocks.c:1681-1685) */
+            return SPRITE_BLOCK_YELLOW; /* Bullet block base is yellow; 4 bullet sprites composited on top (original/blocks.c:1681-1685) */
         case BLACK_BLK:
-            return SPR_BLOCK_BLACK;
+            return SPRITE_BLOCK_BLACK;
         case COUNTER_BLK:
-            return SPR_BLOCK_COUNTER;
+            return SPRITE_BLOCK_COUNTER;
         case BOMB_BLK:
-            return SPR_BLOCK_BOMB;
+            return SPRITE_BLOCK_BOMB;
         case DEATH_BLK:
-            return SPR_BLOCK_DEATH_1;
+            return SPRITE_BLOCK_DEATH_1;
         case REVERSE_BLK:
-            return SPR_BLOCK_REVERSE;
+            return SPRITE_BLOCK_REVERSE;
         case HYPERSPACE_BLK:
-            return SPR_BLOCK_HYPERSPACE;
+            return SPRITE_BLOCK_HYPERSPACE;
         case EXTRABALL_BLK:
-            return SPR_BLOCK_EXTRABALL;
+            return SPRITE_BLOCK_EXTRABALL;
         case MGUN_BLK:
-            return SPR_BLOCK_MACHGUN;
+            return SPRITE_BLOCK_MACHGUN;
         case WALLOFF_BLK:
-            return SPR_BLOCK_WALLOFF;
+            return SPRITE_BLOCK_WALLOFF;
         case MULTIBALL_BLK:
-            return SPR_BLOCK_MULTIBALL;
+            return SPRITE_BLOCK_MULTIBALL;
         case STICKY_BLK:
-            return SPR_BLOCK_STICKY;
+            return SPRITE_BLOCK_STICKY;
         case PAD_SHRINK_BLK:
-            return SPR_BLOCK_PAD_SHRINK;
+            return SPRITE_BLOCK_PAD_SHRINK;
         case PAD_EXPAND_BLK:
-            return SPR_BLOCK_PAD_EXPAND;
+            return SPRITE_BLOCK_PAD_EXPAND;
         case DROP_BLK:
-            return SPR_BLOCK_GREEN; /* Drop block renders as green (original/blocks.c:1728) */
+            return SPRITE_BLOCK_GREEN; /* Drop block renders as green (original/blocks.c:1728) */
         case MAXAMMO_BLK:
-            return SPR_BLOCK_LOTSAMMO;
+            return SPRITE_BLOCK_LOTSAMMO;
         case ROAMER_BLK:
-            return SPR_BLOCK_ROAMER;
+            return SPRITE_BLOCK_ROAMER;
         case TIMER_BLK:
-            return SPR_BLOCK_CLOCK;
+            return SPRITE_BLOCK_CLOCK;
         case RANDOM_BLK:
-            return SPR_BLOCK_RED; /* Random block renders as red with "- R -" text overlay (original/blocks.c:1700-1708) */
+            return SPRITE_BLOCK_RED; /* Random block renders as red with "- R -" text overlay (original/blocks.c:1700-1708) */
         case DYNAMITE_BLK:
-            return SPR_BLOCK_DYNAMITE;
+            return SPRITE_BLOCK_DYNAMITE;
         case BONUSX2_BLK:
-            return SPR_BLOCK_X2_1;
+            return SPRITE_BLOCK_X2_1;
         case BONUSX4_BLK:
-            return SPR_BLOCK_X4_1;
+            return SPRITE_BLOCK_X4_1;
         case BONUS_BLK:
-            return SPR_BLOCK_BONUS_1;
+            return SPRITE_BLOCK_BONUS_1;
         case BLACKHIT_BLK:
-            return SPR_BLOCK_BLACK_HIT;
+            return SPRITE_BLOCK_BLACK_HIT;
         default:
-            return NULL;
+            return SPRITE_NONE;
     }
 }
 
 /*
- * Return the texture key for a ball slide frame (0-4 cycles through 4 ball sprites).
+ * Return the sprite for a ball slide frame (0-4 cycles through 4 ball sprites).
  */
-static inline const char *sprite_ball_key(int slide)
+static inline sprite_id_t sprite_ball_id(int slide)
 {
     switch (slide % 4)
     {
         case 0:
-            return SPR_BALL_1;
+            return SPRITE_BALL_1;
         case 1:
-            return SPR_BALL_2;
+            return SPRITE_BALL_2;
         case 2:
-            return SPR_BALL_3;
+            return SPRITE_BALL_3;
         case 3:
-            return SPR_BALL_4;
+            return SPRITE_BALL_4;
         default:
-            return SPR_BALL_1;
+            return SPRITE_BALL_1;
     }
 }
 
 /*
- * Return the texture key for a ball birth animation frame (1-8).
+ * Return the sprite for a ball birth animation frame (1-8).
  */
-static inline const char *sprite_ball_birth_key(int frame)
+static inline sprite_id_t sprite_ball_birth_id(int frame)
 {
-    static const char *const frames[] = {
-        SPR_BALL_BIRTH_1, SPR_BALL_BIRTH_2, SPR_BALL_BIRTH_3, SPR_BALL_BIRTH_4,
-        SPR_BALL_BIRTH_5, SPR_BALL_BIRTH_6, SPR_BALL_BIRTH_7, SPR_BALL_BIRTH_8,
-    };
     if (frame < 1 || frame > 8)
-        return SPR_BALL_1;
-    return frames[frame - 1];
+        return SPRITE_BALL_1;
+    return (sprite_id_t)(SPRITE_BALL_BIRTH_1 + (frame - 1));
 }
 
 /*
- * Return the texture key for a paddle size (40=small, 50=medium, 70=huge).
+ * Return the sprite for a paddle size (40=small, 50=medium, 70=huge).
  */
-static inline const char *sprite_paddle_key(int width)
+static inline sprite_id_t sprite_paddle_id(int width)
 {
     if (width <= 40)
-        return SPR_PADDLE_SMALL;
+        return SPRITE_PADDLE_SMALL;
     if (width <= 50)
-        return SPR_PADDLE_MEDIUM;
-    return SPR_PADDLE_HUGE;
+        return SPRITE_PADDLE_MEDIUM;
+    return SPRITE_PADDLE_HUGE;
 }
 
 /*
- * Return the texture key for a score digit (0-9).
+ * Return the sprite for a score digit (0-9).
  */
-static inline const char *sprite_digit_key(int digit)
+static inline sprite_id_t sprite_digit_id(int digit)
 {
-    static const char *const digits[] = {
-        SPR_DIGIT_0, SPR_DIGIT_1, SPR_DIGIT_2, SPR_DIGIT_3, SPR_DIGIT_4,
-        SPR_DIGIT_5, SPR_DIGIT_6, SPR_DIGIT_7, SPR_DIGIT_8, SPR_DIGIT_9,
-    };
     if (digit < 0 || digit > 9)
-        return SPR_DIGIT_0;
-    return digits[digit];
+        return SPRITE_DIGIT_0;
+    return (sprite_id_t)(SPRITE_DIGIT_0 + digit);
 }
 
 /*
- * Return the texture key for a sparkle/star frame (1-11).
+ * Return the sprite for a sparkle/star frame (1-11).
  */
-static inline const char *sprite_star_key(int frame)
+static inline sprite_id_t sprite_star_id(int frame)
 {
-    static const char *const stars[] = {
-        SPR_STAR_1, SPR_STAR_2, SPR_STAR_3, SPR_STAR_4,  SPR_STAR_5,  SPR_STAR_6,
-        SPR_STAR_7, SPR_STAR_8, SPR_STAR_9, SPR_STAR_10, SPR_STAR_11,
-    };
     if (frame < 1 || frame > 11)
-        return SPR_STAR_1;
-    return stars[frame - 1];
+        return SPRITE_STAR_1;
+    return (sprite_id_t)(SPRITE_STAR_1 + (frame - 1));
 }
 
 /*
- * Return the texture key for a background number (1-5).
+ * Return the sprite for a background number (1-5).
  * Background 1 is the default; 2-5 cycle during gameplay.
  */
-static inline const char *sprite_background_key(int number)
+static inline sprite_id_t sprite_background_id(int number)
 {
     switch (number)
     {
         case 1:
-            return SPR_BGRND;
+            return SPRITE_BGRND;
         case 2:
-            return SPR_BGRND_2;
+            return SPRITE_BGRND_2;
         case 3:
-            return SPR_BGRND_3;
+            return SPRITE_BGRND_3;
         case 4:
-            return SPR_BGRND_4;
+            return SPRITE_BGRND_4;
         case 5:
-            return SPR_BGRND_5;
+            return SPRITE_BGRND_5;
         default:
-            return SPR_BGRND;
+            return SPRITE_BGRND;
     }
 }
 
 /*
- * Return the texture key for a block explosion animation frame.
+ * Return the sprite for a block explosion animation frame.
  * frame is 0-based (0, 1, 2 for most types; 0-3 for DEATH_BLK).
  * Falls back to red explosion for block types without specific
- * explosion sprites.  Never returns NULL.
+ * explosion sprites.  Never returns SPRITE_NONE.
  */
-static inline const char *sprite_block_explode_key(int block_type, int frame)
+static inline sprite_id_t sprite_block_explode_id(int block_type, int frame)
 {
     switch (block_type)
     {
         case RED_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_RED_1, SPR_EXPLODE_RED_2,
-                                            SPR_EXPLODE_RED_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_RED_1 + frame % 3);
         case BLUE_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_BLUE_1, SPR_EXPLODE_BLUE_2,
-                                            SPR_EXPLODE_BLUE_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_BLUE_1 + frame % 3);
         case GREEN_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_GREEN_1, SPR_EXPLODE_GREEN_2,
-                                            SPR_EXPLODE_GREEN_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_GREEN_1 + frame % 3);
         case TAN_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_TAN_1, SPR_EXPLODE_TAN_2,
-                                            SPR_EXPLODE_TAN_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_TAN_1 + frame % 3);
         case YELLOW_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_YELLOW_1, SPR_EXPLODE_YELLOW_2,
-                                            SPR_EXPLODE_YELLOW_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_YELLOW_1 + frame % 3);
         case PURPLE_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_PURPLE_1, SPR_EXPLODE_PURPLE_2,
-                                            SPR_EXPLODE_PURPLE_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_PURPLE_1 + frame % 3);
         case BOMB_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_BOMB_1, SPR_EXPLODE_BOMB_2,
-                                            SPR_EXPLODE_BOMB_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_BOMB_1 + frame % 3);
         case COUNTER_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_COUNTER_1, SPR_EXPLODE_COUNTER_2,
-                                            SPR_EXPLODE_COUNTER_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_COUNTER_1 + frame % 3);
         case DEATH_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_DEATH_1, SPR_EXPLODE_DEATH_2,
-                                            SPR_EXPLODE_DEATH_3, SPR_EXPLODE_DEATH_4};
-            return k[frame % 4];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_DEATH_1 + frame % 4);
         case BONUSX2_BLK:
         case BONUSX4_BLK:
-        {
-            static const char *const k[] = {SPR_EXPLODE_X2_1, SPR_EXPLODE_X2_2, SPR_EXPLODE_X2_3};
-            return k[frame % 3];
-        }
+            return (sprite_id_t)(SPRITE_EXPLODE_X2_1 + frame % 3);
         default:
             /* For block types without specific explosion sprites, use red */
-            {
-                static const char *const k[] = {SPR_EXPLODE_RED_1, SPR_EXPLODE_RED_2,
-                                                SPR_EXPLODE_RED_3};
-                return k[frame % 3];
-            }
+            return (sprite_id_t)(SPRITE_EXPLODE_RED_1 + frame % 3);
     }
 }
 
 /*
- * Return the texture key for a block animation frame, or NULL when the block
- * type has no multi-frame animation.  Call this before sprite_block_key() and
- * fall back to sprite_block_key() when this returns NULL.
+ * Return the sprite for a block animation frame, or SPRITE_NONE when the
+ * block type has no multi-frame animation.  Call this before
+ * sprite_block_id() and fall back to sprite_block_id() when this returns
+ * SPRITE_NONE.
  *
  * slide semantics per block type:
  *   BONUSX2/X4/BONUS_BLK  — 4-frame cycle: slide % 4  → frame index 0..3
@@ -548,76 +715,108 @@ static inline const char *sprite_block_explode_key(int block_type, int frame)
  *   EXTRABALL_BLK          — 2-frame cycle: slide % 2  → frame index 0..1
  *   ROAMER_BLK             — directional:   slide 0=neutral,1=L,2=R,3=U,4=D
  *                            out-of-range slide clamps to index 0 (neutral)
- *   all other types        — NULL (no animation)
+ *   all other types        — SPRITE_NONE (no animation)
  */
-static inline const char *sprite_block_animated_key(int block_type, int slide)
+static inline sprite_id_t sprite_block_animated_id(int block_type, int slide)
 {
     switch (block_type)
     {
         case BONUSX2_BLK:
-        {
-            static const char *const k[] = {SPR_BLOCK_X2_1, SPR_BLOCK_X2_2, SPR_BLOCK_X2_3,
-                                            SPR_BLOCK_X2_4};
-            return k[((slide % 4) + 4) % 4];
-        }
+            return (sprite_id_t)(SPRITE_BLOCK_X2_1 + ((slide % 4) + 4) % 4);
         case BONUSX4_BLK:
-        {
-            static const char *const k[] = {SPR_BLOCK_X4_1, SPR_BLOCK_X4_2, SPR_BLOCK_X4_3,
-                                            SPR_BLOCK_X4_4};
-            return k[((slide % 4) + 4) % 4];
-        }
+            return (sprite_id_t)(SPRITE_BLOCK_X4_1 + ((slide % 4) + 4) % 4);
         case BONUS_BLK:
-        {
-            static const char *const k[] = {SPR_BLOCK_BONUS_1, SPR_BLOCK_BONUS_2,
-                                            SPR_BLOCK_BONUS_3, SPR_BLOCK_BONUS_4};
-            return k[((slide % 4) + 4) % 4];
-        }
+            return (sprite_id_t)(SPRITE_BLOCK_BONUS_1 + ((slide % 4) + 4) % 4);
         case DEATH_BLK:
-        {
-            static const char *const k[] = {SPR_BLOCK_DEATH_1, SPR_BLOCK_DEATH_2,
-                                            SPR_BLOCK_DEATH_3, SPR_BLOCK_DEATH_4,
-                                            SPR_BLOCK_DEATH_5};
-            return k[((slide % 5) + 5) % 5];
-        }
+            return (sprite_id_t)(SPRITE_BLOCK_DEATH_1 + ((slide % 5) + 5) % 5);
         case EXTRABALL_BLK:
         {
-            static const char *const k[] = {SPR_BLOCK_EXTRABALL, SPR_BLOCK_EXTRABALL_2};
+            static const sprite_id_t k[] = {SPRITE_BLOCK_EXTRABALL, SPRITE_BLOCK_EXTRABALL_2};
             return k[((slide % 2) + 2) % 2];
         }
         case ROAMER_BLK:
         {
-            static const char *const k[] = {SPR_BLOCK_ROAMER, SPR_BLOCK_ROAMER_L,
-                                            SPR_BLOCK_ROAMER_R, SPR_BLOCK_ROAMER_U,
-                                            SPR_BLOCK_ROAMER_D};
+            static const sprite_id_t k[] = {SPRITE_BLOCK_ROAMER, SPRITE_BLOCK_ROAMER_L,
+                                            SPRITE_BLOCK_ROAMER_R, SPRITE_BLOCK_ROAMER_U,
+                                            SPRITE_BLOCK_ROAMER_D};
             if (slide < 0 || slide > 4)
                 return k[0]; /* out-of-range clamps to neutral */
             return k[slide];
         }
         default:
-            return NULL;
+            return SPRITE_NONE;
     }
 }
 
 /*
- * Return the texture key for a COUNTER_BLK with a given hit count (1-5).
+ * Return the sprite for a COUNTER_BLK with a given hit count (1-5).
  */
+static inline sprite_id_t sprite_counter_slide_id(int slide)
+{
+    if (slide < 1 || slide > 5)
+        return SPRITE_BLOCK_COUNTER;
+    return (sprite_id_t)(SPRITE_BLOCK_COUNTER_1 + (slide - 1));
+}
+
+/* =========================================================================
+ * String-key twins of the lookup helpers
+ * ========================================================================= */
+
+static inline const char *sprite_guide_key(int pos)
+{
+    return sprite_key(sprite_guide_id(pos));
+}
+
+/* NULL for NONE_BLK, KILL_BLK, and unknown types. */
+static inline const char *sprite_block_key(int block_type)
+{
+    return sprite_key(sprite_block_id(block_type));
+}
+
+static inline const char *sprite_ball_key(int slide)
+{
+    return sprite_key(sprite_ball_id(slide));
+}
+
+static inline const char *sprite_ball_birth_key(int frame)
+{
+    return sprite_key(sprite_ball_birth_id(frame));
+}
+
+static inline const char *sprite_paddle_key(int width)
+{
+    return sprite_key(sprite_paddle_id(width));
+}
+
+static inline const char *sprite_digit_key(int digit)
+{
+    return sprite_key(sprite_digit_id(digit));
+}
+
+static inline const char *sprite_star_key(int frame)
+{
+    return sprite_key(sprite_star_id(frame));
+}
+
+static inline const char *sprite_background_key(int number)
+{
+    return sprite_key(sprite_background_id(number));
+}
+
+static inline const char *sprite_block_explode_key(int block_type, int frame)
+{
+    return sprite_key(sprite_block_explode_id(block_type, frame));
+}
+
+/* NULL when the block type has no multi-frame animation. */
+static inline const char *sprite_block_animated_key(int block_type, int slide)
+{
+    return sprite_key(sprite_block_animated_id(block_type, slide));
+}
+
 static inline const char *sprite_counter_slide_key(int slide)
 {
-    switch (slide)
-    {
-        case 1:
-            return SPR_BLOCK_COUNTER_1;
-        case 2:
-            return SPR_BLOCK_COUNTER_2;
-        case 3:
-            return SPR_BLOCK_COUNTER_3;
-        case 4:
-            return SPR_BLOCK_COUNTER_4;
-        case 5:
-            return SPR_BLOCK_COUNTER_5;
-        default:
-            return SPR_BLOCK_COUNTER;
-    }
+    return sprite_key(sprite_counter_slide_id(slide));
 }
 
 #endif /* SPRITE_CATALOG_H */
@@ -0,0 +1,156 @@
+/*
+ * startup_profile.c — Wall-clock breakdown of game startup by phase.
+ *
+ * See include/startup_profile.h for API documentation.
+ * See ADR-097 in docs/DESIGN.md for design rationale.
+ */
+
+#include "startup_profile.h"
+
+#include <stdlib.h>
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+struct startup_profile
+{
+    startup_profile_clock_fn clock_fn;
+    uint64_t last_us; /* Clock at create or the latest mark */
+    startup_profile_phase_t phases[STARTUP_PROFILE_MAX_PHASES];
+    int count;
+};
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+startup_profile_t *startup_profile_create(startup_profile_clock_fn clock_fn,
+                                          startup_profile_status_t *status)
+{
+    if (clock_fn == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = STARTUP_PROFILE_ERR_NULL_ARG;
+        }
+        return NULL;
+    }
+
+    startup_profile_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+    {
+        if (status != NULL)
+        {
+            *status = STARTUP_PROFILE_ERR_ALLOC_FAILED;
+        }
+        return NULL;
+    }
+    ctx->clock_fn = clock_fn;
+    ctx->last_us = clock_fn();
+
+    if (status != NULL)
+    {
+        *status = STARTUP_PROFILE_OK;
+    }
+    return ctx;
+}
+
+void startup_profile_destroy(startup_profile_t *ctx)
+{
+    free(ctx);
+}
+
+/* =========================================================================
+ * Public API — Recording
+ * ========================================================================= */
+
+startup_profile_status_t startup_profile_mark(startup_profile_t *ctx, const char *name)
+{
+    if (ctx == NULL || name == NULL)
+    {
+        return STARTUP_PROFILE_ERR_NULL_ARG;
+    }
+    if (ctx->count >= STARTUP_PROFILE_MAX_PHASES)
+    {
+        return STARTUP_PROFILE_ERR_FULL;
+    }
+
+    uint64_t now = ctx->clock_fn();
+    ctx->phases[ctx->count].name = name;
+    ctx->phases[ctx->count].us = now >= ctx->last_us ? now - ctx->last_us : 0;
+    ctx->count++;
+    ctx->last_us = now;
+    return STARTUP_PROFILE_OK;
+}
+
+/* =========================================================================
+ * Public API — Queries
+ * ========================================================================= */
+
+int startup_profile_count(const startup_profile_t *ctx)
+{
+    return ctx != NULL ? ctx->count : 0;
+}
+
+startup_profile_status_t startup_profile_get(const startup_profile_t *ctx, int index,
+                                             startup_profile_phase_t *out)
+{
+    if (ctx == NULL || out == NULL || index < 0 || index >= ctx->count)
+    {
+        return STARTUP_PROFILE_ERR_NULL_ARG;
+    }
+    *out = ctx->phases[index];
+    return STARTUP_PROFILE_OK;
+}
+
+uint64_t startup_profile_total_us(const startup_profile_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    uint64_t total = 0;
+    for (int i = 0; i < ctx->count; i++)
+    {
+        total += ctx->phases[i].us;
+    }
+    return total;
+}
+
+void startup_profile_report(const startup_profile_t *ctx, FILE *out)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return;
+    }
+
+    uint64_t total = startup_profile_total_us(ctx);
+    for (int i = 0; i < ctx->count; i++)
+    {
+        const startup_profile_phase_t *p = &ctx->phases[i];
+        double share = total > 0 ? 100.0 * (double)p->us / (double)total : 0.0;
+        fprintf(out, "startup: %-14s %9.2f ms %5.1f%%\n", p->name, (double)p->us / 1000.0, share);
+    }
+    fprintf(out, "startup: %-14s %9.2f ms\n", "total", (double)total / 1000.0);
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *startup_profile_status_string(startup_profile_status_t status)
+{
+    switch (status)
+    {
+        case STARTUP_PROFILE_OK:
+            return "OK";
+        case STARTUP_PROFILE_ERR_NULL_ARG:
+            return "NULL argument or index out of range";
+        case STARTUP_PROFILE_ERR_ALLOC_FAILED:
+            return "allocation failed";
+        case STARTUP_PROFILE_ERR_FULL:
+            return "too many phases";
+    }
+    return "unknown status";
+}
@@ -0,0 +1,362 @@
+/*
+ * trace.c — Scoped timing zones exported as a Chrome trace.
+ *
+ * See include/trace.h for API documentation.
+ * See ADR-091 in docs/DESIGN.md for design rationale.
+ */
+
+#include "trace.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* =========================================================================
+ * Internal data structures
+ * ========================================================================= */
+
+typedef struct
+{
+    const char *name;
+    uint64_t start_ns;
+    uint64_t dur_ns;
+} trace_event_t;
+
+/* One per recording thread.  Only the owner writes events; `count` is
+ * published with release order so a reader sees the events it covers. */
+typedef struct trace_ring
+{
+    struct trace_ring *next;
+    int tid;
+    size_t capacity;
+    _Atomic uint64_t count; /* Events ever written; slot is count % capacity */
+    trace_event_t events[];
+} trace_ring_t;
+
+/* Public so the zone macros can test it inline (see trace.h). */
+atomic_bool trace_active_flag;
+
+static atomic_bool recording; /* A trace is running */
+static atomic_bool stats_on;  /* Statistics are running */
+static atomic_uint session;   /* Bumped by every trace_start */
+static trace_clock_fn clock_fn;
+static uint64_t origin_ns;
+static size_t ring_events;
+static _Atomic(trace_ring_t *) rings;
+static atomic_int next_tid;
+static _Atomic uint64_t unrecorded; /* Zones lost to failed ring allocation */
+
+static _Thread_local trace_ring_t *tls_ring;
+static _Thread_local unsigned tls_session;
+
+/* Statistics: touched only by the thread that started them (tls_stats). */
+static trace_zone_stat_t stat_table[TRACE_MAX_STAT_ZONES];
+static size_t stat_zones;
+static _Thread_local bool tls_stats;
+
+/* =========================================================================
+ * Internal helpers
+ * ========================================================================= */
+
+/* This thread's ring for the current session, allocated on first use. */
+static trace_ring_t *thread_ring(void)
+{
+    unsigned current = atomic_load_explicit(&session, memory_order_acquire);
+    if (tls_session == current)
+    {
+        return tls_ring;
+    }
+
+    tls_session = current;
+    tls_ring = malloc(sizeof(trace_ring_t) + ring_events * sizeof(trace_event_t));
+    if (tls_ring == NULL)
+    {
+        return NULL;
+    }
+    tls_ring->tid = atomic_fetch_add(&next_tid, 1) + 1;
+    tls_ring->capacity = ring_events;
+    atomic_init(&tls_ring->count, 0);
+
+    trace_ring_t *head = atomic_load(&rings);
+    do
+    {
+        tls_ring->next = head;
+    } while (!atomic_compare_exchange_weak(&rings, &head, tls_ring));
+    return tls_ring;
+}
+
+/* Add one completed zone to its name's total.  Names are compared by
+ * content: identical literals in different translation units need not
+ * share a pointer.  The table holds at most TRACE_MAX_STAT_ZONES names. */
+static void stats_add(const char *name, uint64_t dur_ns)
+{
+    for (size_t i = 0; i < stat_zones; i++)
+    {
+        if (stat_table[i].name == name || strcmp(stat_table[i].name, name) == 0)
+        {
+            stat_table[i].total_ns += dur_ns;
+            stat_table[i].count++;
+            return;
+        }
+    }
+    if (stat_zones < TRACE_MAX_STAT_ZONES)
+    {
+        stat_table[stat_zones].name = name;
+        stat_table[stat_zones].total_ns = dur_ns;
+        stat_table[stat_zones].count = 1;
+        stat_zones++;
+    }
+}
+
+static int compare_stat_total(const void *a, const void *b)
+{
+    uint64_t ta = ((const trace_zone_stat_t *)a)->total_ns;
+    uint64_t tb = ((const trace_zone_stat_t *)b)->total_ns;
+    return (ta < tb) - (ta > tb);
+}
+
+/* Write ns (since origin) as microseconds with three decimals. */
+static void write_us(FILE *fp, uint64_t ns)
+{
+    fprintf(fp, "%llu.%03u", (unsigned long long)(ns / 1000U), (unsigned)(ns % 1000U));
+}
+
+/* =========================================================================
+ * Public API — Lifecycle
+ * ========================================================================= */
+
+trace_status_t trace_start(trace_clock_fn fn, size_t events_per_thread)
+{
+    if (fn == NULL)
+    {
+        return TRACE_ERR_NULL_ARG;
+    }
+    if (atomic_load(&recording))
+    {
+        return TRACE_ERR_RUNNING;
+    }
+
+    clock_fn = fn;
+    ring_events = events_per_thread > 0 ? events_per_thread : TRACE_DEFAULT_EVENTS;
+    origin_ns = fn();
+    atomic_store(&unrecorded, 0);
+    atomic_store(&next_tid, 0);
+    /* Never 0, so a thread that has not recorded yet always allocates. */
+    if (atomic_fetch_add(&session, 1) + 1 == 0)
+    {
+        atomic_fetch_add(&session, 1);
+    }
+    atomic_store(&recording, true);
+    atomic_store(&trace_active_flag, true);
+    return TRACE_OK;
+}
+
+bool trace_is_running(void)
+{
+    return atomic_load(&recording);
+}
+
+trace_status_t trace_write_json(const char *path)
+{
+    if (path == NULL)
+    {
+        return TRACE_ERR_NULL_ARG;
+    }
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL)
+    {
+        return TRACE_ERR_IO;
+    }
+
+    fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    const char *sep = "";
+    for (trace_ring_t *r = atomic_load(&rings); r != NULL; r = r->next)
+    {
+        fprintf(fp,
+                "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, "
+                "\"args\": {\"name\": \"thread %d\"}}",
+                sep, r->tid, r->tid);
+        sep = ",\n";
+
+        uint64_t count = atomic_load_explicit(&r->count, memory_order_acquire);
+        uint64_t first = count > r->capacity ? count - r->capacity : 0;
+        for (uint64_t i = first; i < count; i++)
+        {
+            const trace_event_t *ev = &r->events[i % r->capacity];
+            uint64_t start = ev->start_ns > origin_ns ? ev->start_ns - origin_ns : 0;
+            fprintf(fp, ",\n{\"name\": \"%s\", \"cat\": \"xboing\", \"ph\": \"X\", \"ts\": ",
+                    ev->name);
+            write_us(fp, start);
+            fprintf(fp, ", \"dur\": ");
+            write_us(fp, ev->dur_ns);
+            fprintf(fp, ", \"pid\": 1, \"tid\": %d}", r->tid);
+        }
+    }
+    fprintf(fp, "\n]}\n");
+
+    bool failed = ferror(fp) != 0;
+    if (fclose(fp) != 0)
+    {
+        failed = true;
+    }
+    return failed ? TRACE_ERR_IO : TRACE_OK;
+}
+
+uint64_t trace_dropped(void)
+{
+    uint64_t dropped = atomic_load(&unrecorded);
+    for (trace_ring_t *r = atomic_load(&rings); r != NULL; r = r->next)
+    {
+        uint64_t count = atomic_load(&r->count);
+        if (count > r->capacity)
+        {
+            dropped += count - r->capacity;
+        }
+    }
+    return dropped;
+}
+
+void trace_shutdown(void)
+{
+    atomic_store(&recording, false);
+    atomic_store(&trace_active_flag, atomic_load(&stats_on));
+    trace_ring_t *r = atomic_exchange(&rings, NULL);
+    while (r != NULL)
+    {
+        trace_ring_t *next = r->next;
+        free(r);
+        r = next;
+    }
+    /* Rings are per session, so threads reallocate after the next start. */
+    tls_ring = NULL;
+    tls_session = 0;
+}
+
+/* =========================================================================
+ * Public API — Statistics
+ * ========================================================================= */
+
+trace_status_t trace_stats_start(trace_clock_fn fn)
+{
+    if (fn == NULL)
+    {
+        return TRACE_ERR_NULL_ARG;
+    }
+    if (atomic_load(&stats_on))
+    {
+        return TRACE_ERR_RUNNING;
+    }
+
+    if (!atomic_load(&recording))
+    {
+        clock_fn = fn;
+    }
+    stat_zones = 0;
+    tls_stats = true;
+    atomic_store(&stats_on, true);
+    atomic_store(&trace_active_flag, true);
+    return TRACE_OK;
+}
+
+void trace_stats_stop(void)
+{
+    tls_stats = false;
+    atomic_store(&stats_on, false);
+    atomic_store(&trace_active_flag, atomic_load(&recording));
+}
+
+size_t trace_stats_take(trace_zone_stat_t *out, size_t max)
+{
+    trace_zone_stat_t sorted[TRACE_MAX_STAT_ZONES];
+    size_t n = 0;
+    for (size_t i = 0; i < stat_zones; i++)
+    {
+        if (stat_table[i].count > 0)
+        {
+            sorted[n++] = stat_table[i];
+        }
+        stat_table[i].total_ns = 0;
+        stat_table[i].count = 0;
+    }
+    qsort(sorted, n, sizeof(sorted[0]), compare_stat_total);
+
+    if (out == NULL)
+    {
+        return 0;
+    }
+    if (n > max)
+    {
+        n = max;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        out[i] = sorted[i];
+    }
+    return n;
+}
+
+/* =========================================================================
+ * Public API — Zone recording
+ * ========================================================================= */
+
+uint64_t trace_zone_begin(void)
+{
+    if (!atomic_load_explicit(&trace_active_flag, memory_order_relaxed))
+    {
+        return 0;
+    }
+    return clock_fn();
+}
+
+void trace_zone_end(const char *name, uint64_t t0)
+{
+    if (t0 == 0 || !atomic_load_explicit(&trace_active_flag, memory_order_relaxed))
+    {
+        return;
+    }
+    uint64_t now = clock_fn();
+    uint64_t dur = now > t0 ? now - t0 : 0;
+
+    if (tls_stats)
+    {
+        stats_add(name, dur);
+    }
+    if (!atomic_load_explicit(&recording, memory_order_relaxed))
+    {
+        return;
+    }
+
+    trace_ring_t *ring = thread_ring();
+    if (ring == NULL)
+    {
+        atomic_fetch_add_explicit(&unrecorded, 1, memory_order_relaxed);
+        return;
+    }
+    uint64_t n = atomic_load_explicit(&ring->count, memory_order_relaxed);
+    trace_event_t *ev = &ring->events[n % ring->capacity];
+    ev->name = name;
+    ev->start_ns = t0;
+    ev->dur_ns = dur;
+    atomic_store_explicit(&ring->count, n + 1, memory_order_release);
+}
+
+/* =========================================================================
+ * Public API — Utility
+ * ========================================================================= */
+
+const char *trace_status_string(trace_status_t status)
+{
+    switch (status)
+    {
+        case TRACE_OK:
+            return "OK";
+        case TRACE_ERR_NULL_ARG:
+            return "NULL argument";
+        case TRACE_ERR_RUNNING:
+            return "trace already running";
+        case TRACE_ERR_IO:
+            return "cannot write trace file";
+    }
+    return "unknown status";
+}
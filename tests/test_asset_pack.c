@@ -0,0 +1,372 @@
+/*
+ * test_asset_pack.c — CMocka tests for the memory-mapped asset pack.
+ *
+ * Pure logic tests — no SDL2 needed.  Each test writes a pack to a
+ * per-process temp file with the writer and maps it back.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* cmocka.h must come after the setjmp/stdarg/stddef includes. */
+#include <cmocka.h>
+
+#include "asset_pack.h"
+
+/* =========================================================================
+ * Helpers
+ * ========================================================================= */
+
+static char pack_path[64];
+
+static int setup_path(void **state)
+{
+    (void)state;
+    snprintf(pack_path, sizeof(pack_path), "/tmp/test_asset_pack_%d.pak", (int)getpid());
+    return 0;
+}
+
+static int remove_pack(void **state)
+{
+    (void)state;
+    (void)remove(pack_path);
+    return 0;
+}
+
+static void add_raw(asset_pack_writer_t *w, const char *key, const char *text)
+{
+    asset_pack_entry_t e = {.key = key, .data = text, .size = strlen(text)};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+}
+
+/* Write a pack holding a level, a 3x2 image and a font. */
+static void write_sample_pack(void)
+{
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_non_null(w);
+
+    add_raw(w, "levels/level01.data", "Title\n120\n");
+    add_raw(w, "fonts/Sans.ttf", "not really a font");
+
+    uint8_t pixels[2 * 12];
+    for (size_t i = 0; i < sizeof(pixels); i++)
+    {
+        pixels[i] = (uint8_t)i;
+    }
+    asset_pack_entry_t img = {.key = "images/balls/ball1",
+                              .data = pixels,
+                              .size = sizeof(pixels),
+                              .kind = ASSET_PACK_PIXELS,
+                              .param = {3, 2, 12}};
+    assert_int_equal(asset_pack_writer_add(w, &img), ASSET_PACK_OK);
+    assert_int_equal(asset_pack_writer_count(w), 3);
+
+    assert_int_equal(asset_pack_writer_save(w, pack_path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+}
+
+static asset_pack_t *open_pack(void)
+{
+    asset_pack_status_t st = ASSET_PACK_ERR_NULL_ARG;
+    asset_pack_t *p = asset_pack_open(pack_path, &st);
+    assert_non_null(p);
+    assert_int_equal(st, ASSET_PACK_OK);
+    return p;
+}
+
+/* Overwrite len bytes at offset of the pack file. */
+static void patch_pack(long offset, const void *bytes, size_t len)
+{
+    FILE *fp = fopen(pack_path, "r+b");
+    assert_non_null(fp);
+    assert_int_equal(fseek(fp, offset, SEEK_SET), 0);
+    assert_int_equal(fwrite(bytes, 1, len, fp), len);
+    fclose(fp);
+}
+
+static void assert_open_fails(asset_pack_status_t expected)
+{
+    asset_pack_status_t st = ASSET_PACK_OK;
+    assert_null(asset_pack_open(pack_path, &st));
+    assert_int_equal(st, expected);
+}
+
+/* =========================================================================
+ * Group 1: Round trip
+ * ========================================================================= */
+
+/* TC-01: Every entry comes back with its data, kind and parameters. */
+static void test_round_trip(void **state)
+{
+    (void)state;
+    write_sample_pack();
+    asset_pack_t *p = open_pack();
+    assert_int_equal(asset_pack_count(p), 3);
+
+    asset_pack_entry_t e;
+    assert_int_equal(asset_pack_find(p, "levels/level01.data", &e), ASSET_PACK_OK);
+    assert_int_equal(e.kind, ASSET_PACK_RAW);
+    assert_int_equal(e.size, 10);
+    assert_memory_equal(e.data, "Title\n120\n", 10);
+    assert_string_equal(e.key, "levels/level01.data");
+
+    assert_int_equal(asset_pack_find(p, "images/balls/ball1", &e), ASSET_PACK_OK);
+    assert_int_equal(e.kind, ASSET_PACK_PIXELS);
+    assert_int_equal(e.size, 24);
+    assert_int_equal(e.param[0], 3);
+    assert_int_equal(e.param[1], 2);
+    assert_int_equal(e.param[2], 12);
+    assert_int_equal(((const uint8_t *)e.data)[23], 23);
+
+    assert_int_equal(asset_pack_find(p, "images/balls/ball2", &e), ASSET_PACK_ERR_NOT_FOUND);
+    assert_int_equal(asset_pack_find(p, "images", &e), ASSET_PACK_ERR_NOT_FOUND);
+    asset_pack_close(p);
+}
+
+/* TC-02: Blobs start on ASSET_PACK_ALIGN boundaries within the mapping. */
+static void test_blobs_aligned(void **state)
+{
+    (void)state;
+    write_sample_pack();
+    asset_pack_t *p = open_pack();
+    for (int i = 0; i < asset_pack_count(p); i++)
+    {
+        asset_pack_entry_t e;
+        assert_int_equal(asset_pack_get(p, i, &e), ASSET_PACK_OK);
+        assert_int_equal((uintptr_t)e.data % ASSET_PACK_ALIGN, 0);
+    }
+    asset_pack_close(p);
+}
+
+/* TC-03: Entries are indexed in key order, and prefixes count them. */
+static void test_key_order_and_prefix(void **state)
+{
+    (void)state;
+    write_sample_pack();
+    asset_pack_t *p = open_pack();
+
+    asset_pack_entry_t e;
+    assert_int_equal(asset_pack_get(p, 0, &e), ASSET_PACK_OK);
+    assert_string_equal(e.key, "fonts/Sans.ttf");
+    assert_int_equal(asset_pack_get(p, 1, &e), ASSET_PACK_OK);
+    assert_string_equal(e.key, "images/balls/ball1");
+    assert_int_equal(asset_pack_get(p, 2, &e), ASSET_PACK_OK);
+    assert_string_equal(e.key, "levels/level01.data");
+    assert_int_equal(asset_pack_get(p, 3, &e), ASSET_PACK_ERR_NOT_FOUND);
+    assert_int_equal(asset_pack_get(p, -1, &e), ASSET_PACK_ERR_NOT_FOUND);
+
+    assert_int_equal(asset_pack_count_prefix(p, "images/"), 1);
+    assert_int_equal(asset_pack_count_prefix(p, "sounds/"), 0);
+    assert_int_equal(asset_pack_count_prefix(p, ""), 3);
+    asset_pack_close(p);
+}
+
+/* TC-04: Hundreds of keys all resolve through the hash directory. */
+static void test_many_entries(void **state)
+{
+    (void)state;
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    enum
+    {
+        N = 500
+    };
+    for (int i = N - 1; i >= 0; i--)
+    {
+        char key[32];
+        char text[32];
+        snprintf(key, sizeof(key), "levels/level%03d.data", i);
+        snprintf(text, sizeof(text), "level %d", i);
+        add_raw(w, key, text);
+    }
+    assert_int_equal(asset_pack_writer_save(w, pack_path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+
+    asset_pack_t *p = open_pack();
+    assert_int_equal(asset_pack_count(p), N);
+    for (int i = 0; i < N; i++)
+    {
+        char key[32];
+        char text[32];
+        snprintf(key, sizeof(key), "levels/level%03d.data", i);
+        int len = snprintf(text, sizeof(text), "level %d", i);
+        asset_pack_entry_t e;
+        assert_int_equal(asset_pack_find(p, key, &e), ASSET_PACK_OK);
+        assert_int_equal(e.size, (size_t)len);
+        assert_memory_equal(e.data, text, (size_t)len);
+    }
+    asset_pack_close(p);
+}
+
+/* TC-05: Empty blobs and an empty pack are both valid. */
+static void test_empty(void **state)
+{
+    (void)state;
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_int_equal(asset_pack_writer_save(w, pack_path), ASSET_PACK_OK);
+    asset_pack_t *p = open_pack();
+    assert_int_equal(asset_pack_count(p), 0);
+    asset_pack_entry_t e;
+    assert_int_equal(asset_pack_find(p, "levels/x", &e), ASSET_PACK_ERR_NOT_FOUND);
+    asset_pack_close(p);
+
+    asset_pack_entry_t blank = {.key = "levels/blank"};
+    assert_int_equal(asset_pack_writer_add(w, &blank), ASSET_PACK_OK);
+    assert_int_equal(asset_pack_writer_save(w, pack_path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+    p = open_pack();
+    assert_int_equal(asset_pack_find(p, "levels/blank", &e), ASSET_PACK_OK);
+    assert_int_equal(e.size, 0);
+    asset_pack_close(p);
+}
+
+/* =========================================================================
+ * Group 2: Writer errors
+ * ========================================================================= */
+
+/* TC-06: Bad keys and duplicates are refused without being added. */
+static void test_writer_rejects(void **state)
+{
+    (void)state;
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    add_raw(w, "sounds/boing", "x");
+
+    asset_pack_entry_t e = {.key = "sounds/boing", .data = "y", .size = 1};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_ERR_DUPLICATE);
+    e.key = "";
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_ERR_KEY_TOO_LONG);
+    char long_key[ASSET_PACK_MAX_KEY + 2];
+    memset(long_key, 'k', sizeof(long_key) - 1);
+    long_key[sizeof(long_key) - 1] = '\0';
+    e.key = long_key;
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_ERR_KEY_TOO_LONG);
+    e.key = "sounds/other";
+    e.data = NULL;
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_ERR_NULL_ARG);
+    e.data = "y";
+    e.kind = (asset_pack_kind_t)7;
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_ERR_BAD_FORMAT);
+
+    assert_int_equal(asset_pack_writer_count(w), 1);
+    assert_int_equal(asset_pack_writer_save(w, "/nonexistent_dir/x.pak"), ASSET_PACK_ERR_IO);
+    asset_pack_writer_destroy(w);
+}
+
+/* =========================================================================
+ * Group 3: Damaged packs
+ * ========================================================================= */
+
+/* TC-07: Missing files, foreign files and truncation are refused. */
+static void test_open_rejects_bad_files(void **state)
+{
+    (void)state;
+    assert_open_fails(ASSET_PACK_ERR_IO);
+
+    FILE *fp = fopen(pack_path, "wb");
+    assert_non_null(fp);
+    for (int i = 0; i < 100; i++)
+    {
+        fputs("not a pack ", fp);
+    }
+    fclose(fp);
+    assert_open_fails(ASSET_PACK_ERR_BAD_FORMAT);
+
+    write_sample_pack();
+    assert_int_equal(truncate(pack_path, 200), 0);
+    assert_open_fails(ASSET_PACK_ERR_BAD_FORMAT);
+}
+
+/* TC-08: A directory pointing outside the file is refused. */
+static void test_open_rejects_bad_directory(void **state)
+{
+    (void)state;
+    static const uint8_t huge[8] = {0, 0, 0, 0, 0, 0, 0, 0x40};
+
+    /* Version. */
+    write_sample_pack();
+    patch_pack(8, "\x02", 1);
+    assert_open_fails(ASSET_PACK_ERR_BAD_FORMAT);
+
+    /* Bucket count not above the entry count. */
+    write_sample_pack();
+    patch_pack(16, "\x03\x00\x00\x00", 4);
+    assert_open_fails(ASSET_PACK_ERR_BAD_FORMAT);
+
+    /* First entry's data offset (header 64 + field 16). */
+    write_sample_pack();
+    patch_pack(64 + 16, huge, sizeof(huge));
+    assert_open_fails(ASSET_PACK_ERR_BAD_FORMAT);
+
+    /* First entry's key length. */
+    write_sample_pack();
+    patch_pack(64 + 4, "\x40", 1);
+    assert_open_fails(ASSET_PACK_ERR_BAD_FORMAT);
+}
+
+/* =========================================================================
+ * Group 4: NULL safety and status strings
+ * ========================================================================= */
+
+/* TC-09: NULL is safe everywhere; a NULL pack finds nothing. */
+static void test_null_args(void **state)
+{
+    (void)state;
+    asset_pack_status_t st = ASSET_PACK_OK;
+    assert_null(asset_pack_open(NULL, &st));
+    assert_int_equal(st, ASSET_PACK_ERR_NULL_ARG);
+    asset_pack_close(NULL);
+
+    asset_pack_entry_t e;
+    assert_int_equal(asset_pack_find(NULL, "images/x", &e), ASSET_PACK_ERR_NOT_FOUND);
+    assert_int_equal(asset_pack_find(NULL, NULL, &e), ASSET_PACK_ERR_NULL_ARG);
+    assert_int_equal(asset_pack_get(NULL, 0, &e), ASSET_PACK_ERR_NULL_ARG);
+    assert_int_equal(asset_pack_count(NULL), 0);
+    assert_int_equal(asset_pack_count_prefix(NULL, "images/"), 0);
+
+    assert_int_equal(asset_pack_writer_add(NULL, &e), ASSET_PACK_ERR_NULL_ARG);
+    assert_int_equal(asset_pack_writer_save(NULL, pack_path), ASSET_PACK_ERR_NULL_ARG);
+    assert_int_equal(asset_pack_writer_count(NULL), 0);
+    asset_pack_writer_destroy(NULL);
+}
+
+/* TC-10: Every status has a string. */
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(asset_pack_status_string(ASSET_PACK_OK), "OK");
+    assert_string_equal(asset_pack_status_string(ASSET_PACK_ERR_BAD_FORMAT),
+                        "not a valid asset pack");
+    assert_string_equal(asset_pack_status_string(ASSET_PACK_ERR_DUPLICATE), "duplicate key");
+    assert_string_equal(asset_pack_status_string((asset_pack_status_t)99), "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Round trip */
+        cmocka_unit_test_setup_teardown(test_round_trip, setup_path, remove_pack),
+        cmocka_unit_test_setup_teardown(test_blobs_aligned, setup_path, remove_pack),
+        cmocka_unit_test_setup_teardown(test_key_order_and_prefix, setup_path, remove_pack),
+        cmocka_unit_test_setup_teardown(test_many_entries, setup_path, remove_pack),
+        cmocka_unit_test_setup_teardown(test_empty, setup_path, remove_pack),
+        /* Group 2: Writer errors */
+        cmocka_unit_test_setup_teardown(test_writer_rejects, setup_path, remove_pack),
+        /* Group 3: Damaged packs */
+        cmocka_unit_test_setup_teardown(test_open_rejects_bad_files, setup_path, remove_pack),
+        cmocka_unit_test_setup_teardown(test_open_rejects_bad_directory, setup_path, remove_pack),
+        /* Group 4: NULL safety and status strings */
+        cmocka_unit_test_setup_teardown(test_null_args, setup_path, remove_pack),
+        cmocka_unit_test_setup_teardown(test_status_strings, setup_path, remove_pack),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
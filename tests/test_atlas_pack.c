@@ -0,0 +1,296 @@
+/*
+ * test_atlas_pack.c — Unit tests for the atlas shelf packer.
+ *
+ * Checks the properties sdl2_texture relies on: every packed item lies
+ * inside its page, no two items on a page overlap (padding included),
+ * items that cannot fit are reported as ATLAS_PACK_NONE, and the layout
+ * is a pure function of the inputs.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "atlas_pack.h"
+
+/* =========================================================================
+ * Helpers
+ * ========================================================================= */
+
+static atlas_pack_item_t item(int w, int h)
+{
+    atlas_pack_item_t it;
+    memset(&it, 0, sizeof(it));
+    it.w = w;
+    it.h = h;
+    return it;
+}
+
+/* Deterministic sizes in [lo, hi]. */
+static uint32_t lcg_next(uint32_t *s)
+{
+    *s = *s * 1103515245u + 12345u;
+    return (*s >> 16) & 0x7fffu;
+}
+
+static void fill_random(atlas_pack_item_t *items, int n, uint32_t seed, int lo, int hi)
+{
+    for (int i = 0; i < n; i++)
+    {
+        int w = lo + (int)(lcg_next(&seed) % (uint32_t)(hi - lo + 1));
+        int h = lo + (int)(lcg_next(&seed) % (uint32_t)(hi - lo + 1));
+        items[i] = item(w, h);
+    }
+}
+
+/* Every packed item inside its page; padded rects on one page disjoint. */
+static void assert_valid_layout(const atlas_pack_item_t *items, int n, int page_size, int padding,
+                                int pages_used)
+{
+    for (int i = 0; i < n; i++)
+    {
+        const atlas_pack_item_t *a = &items[i];
+        if (a->page == ATLAS_PACK_NONE)
+        {
+            continue;
+        }
+        assert_true(a->page >= 0 && a->page < pages_used);
+        assert_true(a->x >= 0 && a->x + a->w <= page_size);
+        assert_true(a->y >= 0 && a->y + a->h <= page_size);
+        for (int j = 0; j < i; j++)
+        {
+            const atlas_pack_item_t *b = &items[j];
+            if (b->page != a->page)
+            {
+                continue;
+            }
+            int apart = a->x + a->w + padding <= b->x || b->x + b->w + padding <= a->x ||
+                        a->y + a->h + padding <= b->y || b->y + b->h + padding <= a->y;
+            assert_true(apart);
+        }
+    }
+}
+
+/* =========================================================================
+ * Group 1: Argument handling
+ * ========================================================================= */
+
+static void test_null_args(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[1] = {item(4, 4)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 1, 64, 0, 1, NULL), ATLAS_PACK_ERR_NULL_ARG);
+    assert_int_equal(atlas_pack(NULL, 1, 64, 0, 1, &pages), ATLAS_PACK_ERR_NULL_ARG);
+    assert_int_equal(atlas_pack(NULL, 0, 64, 0, 1, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 0);
+}
+
+static void test_bad_sizes(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[1] = {item(4, 4)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 1, 0, 0, 1, &pages), ATLAS_PACK_ERR_BAD_SIZE);
+    assert_int_equal(atlas_pack(items, 1, 64, -1, 1, &pages), ATLAS_PACK_ERR_BAD_SIZE);
+    assert_int_equal(atlas_pack(items, 1, 64, 0, -1, &pages), ATLAS_PACK_ERR_BAD_SIZE);
+    assert_int_equal(atlas_pack(items, -1, 64, 0, 1, &pages), ATLAS_PACK_ERR_BAD_SIZE);
+    assert_int_equal(pages, 0);
+}
+
+/* =========================================================================
+ * Group 2: Placement
+ * ========================================================================= */
+
+static void test_single_item_at_origin(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[1] = {item(20, 19)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 1, 64, 1, 4, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 1);
+    assert_int_equal(items[0].page, 0);
+    assert_int_equal(items[0].x, 0);
+    assert_int_equal(items[0].y, 0);
+}
+
+/* Tallest first: the tall item opens the first shelf at the origin. */
+static void test_tallest_first(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[3] = {item(10, 5), item(10, 30), item(10, 12)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 3, 64, 2, 1, &pages), ATLAS_PACK_OK);
+    assert_int_equal(items[1].x, 0);
+    assert_int_equal(items[1].y, 0);
+    assert_int_equal(items[2].x, 12);
+    assert_int_equal(items[2].y, 0);
+    assert_int_equal(items[0].x, 24);
+    assert_int_equal(items[0].y, 0);
+}
+
+/* A full shelf wraps to a new one below, padding included. */
+static void test_shelf_wraps(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[3] = {item(30, 10), item(30, 10), item(30, 10)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 3, 64, 1, 1, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 1);
+    assert_int_equal(items[2].x, 0);
+    assert_int_equal(items[2].y, 11);
+    assert_valid_layout(items, 3, 64, 1, pages);
+}
+
+static void test_oversized_item_not_packed(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[3] = {item(65, 4), item(8, 8), item(4, 65)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 3, 64, 0, 2, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 1);
+    assert_int_equal(items[0].page, ATLAS_PACK_NONE);
+    assert_int_equal(items[1].page, 0);
+    assert_int_equal(items[2].page, ATLAS_PACK_NONE);
+}
+
+static void test_page_sized_item_fills_page(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[2] = {item(64, 64), item(1, 1)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 2, 64, 1, 2, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 2);
+    assert_int_equal(items[0].page, 0);
+    assert_int_equal(items[1].page, 1);
+}
+
+/* =========================================================================
+ * Group 3: Pages
+ * ========================================================================= */
+
+/* Items spill onto later pages; past max_pages they are not packed. */
+static void test_out_of_pages(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[5];
+    for (int i = 0; i < 5; i++)
+    {
+        items[i] = item(40, 40);
+    }
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 5, 64, 0, 3, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 3);
+    for (int i = 0; i < 3; i++)
+    {
+        assert_int_equal(items[i].page, i);
+    }
+    assert_int_equal(items[3].page, ATLAS_PACK_NONE);
+    assert_int_equal(items[4].page, ATLAS_PACK_NONE);
+}
+
+static void test_zero_pages_packs_nothing(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[2] = {item(4, 4), item(4, 4)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 2, 64, 0, 0, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 0);
+    assert_int_equal(items[0].page, ATLAS_PACK_NONE);
+    assert_int_equal(items[1].page, ATLAS_PACK_NONE);
+}
+
+/* Smaller items fill gaps on earlier pages before later ones. */
+static void test_first_fit_backfills(void **state)
+{
+    (void)state;
+    atlas_pack_item_t items[3] = {item(60, 40), item(60, 40), item(4, 4)};
+    int pages = -1;
+    assert_int_equal(atlas_pack(items, 3, 64, 0, 4, &pages), ATLAS_PACK_OK);
+    assert_int_equal(pages, 2);
+    assert_int_equal(items[2].page, 0);
+    assert_valid_layout(items, 3, 64, 0, pages);
+}
+
+/* =========================================================================
+ * Group 4: Randomised layouts
+ * ========================================================================= */
+
+static void test_random_layouts_valid(void **state)
+{
+    (void)state;
+    enum
+    {
+        N = 200
+    };
+    atlas_pack_item_t items[N];
+    for (uint32_t seed = 1; seed <= 20; seed++)
+    {
+        fill_random(items, N, seed, 1, 90);
+        int pages = -1;
+        assert_int_equal(atlas_pack(items, N, 256, 1, 8, &pages), ATLAS_PACK_OK);
+        assert_true(pages >= 1 && pages <= 8);
+        assert_valid_layout(items, N, 256, 1, pages);
+    }
+}
+
+static void test_layout_deterministic(void **state)
+{
+    (void)state;
+    enum
+    {
+        N = 120
+    };
+    atlas_pack_item_t a[N];
+    atlas_pack_item_t b[N];
+    fill_random(a, N, 7, 1, 40);
+    memcpy(b, a, sizeof(a));
+
+    int pa = -1;
+    int pb = -1;
+    assert_int_equal(atlas_pack(a, N, 128, 1, 8, &pa), ATLAS_PACK_OK);
+    assert_int_equal(atlas_pack(b, N, 128, 1, 8, &pb), ATLAS_PACK_OK);
+    assert_int_equal(pa, pb);
+    assert_memory_equal(a, b, sizeof(a));
+}
+
+/* =========================================================================
+ * Group 5: Status strings
+ * ========================================================================= */
+
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(atlas_pack_status_string(ATLAS_PACK_OK), "OK");
+    assert_string_equal(atlas_pack_status_string(ATLAS_PACK_ERR_NULL_ARG), "NULL argument");
+    assert_string_equal(atlas_pack_status_string((atlas_pack_status_t)99), "unknown status");
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Argument handling */
+        cmocka_unit_test(test_null_args),
+        cmocka_unit_test(test_bad_sizes),
+        /* Group 2: Placement */
+        cmocka_unit_test(test_single_item_at_origin),
+        cmocka_unit_test(test_tallest_first),
+        cmocka_unit_test(test_shelf_wraps),
+        cmocka_unit_test(test_oversized_item_not_packed),
+        cmocka_unit_test(test_page_sized_item_fills_page),
+        /* Group 3: Pages */
+        cmocka_unit_test(test_out_of_pages),
+        cmocka_unit_test(test_zero_pages_packs_nothing),
+        cmocka_unit_test(test_first_fit_backfills),
+        /* Group 4: Randomised layouts */
+        cmocka_unit_test(test_random_layouts_valid),
+        cmocka_unit_test(test_layout_deterministic),
+        /* Group 5: Status strings */
+        cmocka_unit_test(test_status_strings),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
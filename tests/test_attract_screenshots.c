@@ -9,7 +9,8 @@
  * prove that the C-key path leaves the screen in a different visual
  * state than the direct path — a structural initialization bug.
  *
- * Requires SDL_VIDEODRIVER=offscreen for real pixel rendering.
+ * Renders with -offscreen (ADR-094): real pixels from the software
+ * renderer at the logical size, with no display or video driver.
  * Uses -nosound to avoid SDL_mixer teardown crash with dummy audio.
  */
 
@@ -130,8 +131,9 @@ static int group_setup(void **vstate)
 {
     char arg0[] = "xboing_test";
     char arg1[] = "-nosound";
-    char *argv[] = {arg0, arg1, NULL};
-    g_ctx = game_create(2, argv);
+    char arg2[] = "-offscreen";
+    char *argv[] = {arg0, arg1, arg2, NULL};
+    g_ctx = game_create(3, argv);
     assert_non_null(g_ctx);
     mkdir(".tmp", 0755);
     sdl2_state_transition(g_ctx->state, SDL2ST_PRESENTS);
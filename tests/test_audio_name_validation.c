@@ -1,8 +1,8 @@
 /*
  * test_audio_name_validation.c — catch misnamed sound asset references
- * at CI time.  Verifies every string literal that production code
- * passes to sdl2_audio_play() resolves to an entry in the audio
- * cache loaded from sounds/.
+ * at CI time.  Verifies every sound catalog ID, and every string
+ * literal that production code passes to sdl2_audio_play(), resolves
+ * to an entry in the audio cache loaded from sounds/.
  *
  * This is the test that would have caught the broken "hyperspace"
  * literal in PR #138.  Spec: docs/specs/2026-06-03-sfx-testability.md
@@ -24,6 +24,7 @@
 #include "block_sound.h"
 #include "block_types.h"
 #include "sdl2_audio.h"
+#include "sound_catalog.h"
 
 /* =========================================================================
  * SDL setup / teardown — uses dummy audio driver so no hardware needed.
@@ -46,6 +47,8 @@ static int group_teardown(void **state)
 static int setup_audio(void **state)
 {
     sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    cfg.id_keys = sound_key_table();
+    cfg.id_count = SOUND_COUNT;
     sdl2_audio_status_t st;
     sdl2_audio_t *audio = sdl2_audio_create(&cfg, &st);
     if (!audio)
@@ -65,41 +68,51 @@ static int teardown_audio(void **state)
 }
 
 /* =========================================================================
- * Every name returned by block_sound_lookup resolves in the cache.
+ * Every sound catalog ID resolves to a cached sound.
  *
- * This is the test that would have caught the broken "hyperspace"
- * literal: block_sound_lookup(HYPERSPACE_BLK).name used to return that
- * name, sdl2_audio_play would return SDL2A_ERR_NOT_FOUND, this assert
- * fails.
+ * Game systems and block_sound_lookup report sounds by ID, so this
+ * covers every sound they can fire.  A catalog key with no matching
+ * file in sounds/ (the broken "hyperspace" literal from PR #138, as it
+ * would look today) makes sdl2_audio_play_id return
+ * SDL2A_ERR_NOT_FOUND and fails here.
  * ========================================================================= */
 
-static void test_every_block_sound_name_resolves(void **state)
+static void test_every_catalog_id_resolves(void **state)
 {
     sdl2_audio_t *audio = (sdl2_audio_t *)*state;
-    for (int t = 0; t < MAX_BLOCKS; t++)
+    for (int id = 0; id < SOUND_COUNT; id++)
     {
-        const char *name = block_sound_lookup(t).name;
-        if (name == NULL)
-        {
-            continue;
-        }
         /* Free up channels between plays — the configured pool size
          * (16 under sdl2_audio_config_defaults()) is exceeded by this
          * loop, and an exhausted allocator would return
-         * SDL2A_ERR_PLAY_FAILED even though the name resolves
+         * SDL2A_ERR_PLAY_FAILED even though the ID resolves
          * correctly.  Halting between plays keeps the test focused
-         * on name→asset resolution, not channel allocation. */
+         * on ID→asset resolution, not channel allocation. */
         sdl2_audio_halt(audio);
-        sdl2_audio_status_t st = sdl2_audio_play(audio, name);
+        sdl2_audio_status_t st = sdl2_audio_play_id(audio, id, 100);
         if (st != SDL2A_OK)
         {
-            fprintf(stderr, "block_type=%d → name=\"%s\" → status=%s\n", t, name,
+            fprintf(stderr, "id=%d → key=\"%s\" → status=%s\n", id, sound_key((sound_id_t)id),
                     sdl2_audio_status_string(st));
         }
         assert_int_equal(st, SDL2A_OK);
     }
 }
 
+/* Every block type with a sound maps to a catalog ID. */
+static void test_every_block_sound_id_in_catalog(void **state)
+{
+    (void)state;
+    for (int t = 0; t < MAX_BLOCKS; t++)
+    {
+        block_sound_t s = block_sound_lookup(t);
+        if (s.id != SOUND_NONE)
+        {
+            assert_non_null(sound_key(s.id));
+        }
+    }
+}
+
 /* =========================================================================
  * Every literal currently passed to sdl2_audio_play in src/.
  *
@@ -111,8 +124,8 @@ static void test_every_block_sound_name_resolves(void **state)
  * ========================================================================= */
 
 static const char *const k_known_literals[] = {
-    "applause", "balllost", "bomb",    "buzzer", "game_over",
-    "paddle",   "tone",     "toggle",  "youagod", NULL,
+    "applause", "balllost", "buzzer", "game_over", "toggle",
+    "tone",     "touch",    "youagod", NULL,
 };
 
 static void test_every_known_literal_resolves(void **state)
@@ -141,11 +154,11 @@ static void test_log_records_zero_errors_for_valid_names(void **state)
     sdl2_audio_log_clear(audio);
     for (int t = 0; t < MAX_BLOCKS; t++)
     {
-        const char *name = block_sound_lookup(t).name;
-        if (name)
+        block_sound_t s = block_sound_lookup(t);
+        if (s.id != SOUND_NONE)
         {
             sdl2_audio_halt(audio); /* see note above on channel pool */
-            (void)sdl2_audio_play(audio, name);
+            (void)sdl2_audio_play_id(audio, s.id, s.volume);
         }
     }
     assert_int_equal(sdl2_audio_log_error_count(audio), 0);
@@ -172,8 +185,9 @@ static void test_log_records_misname(void **state)
 int main(void)
 {
     const struct CMUnitTest tests[] = {
-        cmocka_unit_test_setup_teardown(test_every_block_sound_name_resolves, setup_audio,
+        cmocka_unit_test_setup_teardown(test_every_catalog_id_resolves, setup_audio,
                                         teardown_audio),
+        cmocka_unit_test(test_every_block_sound_id_in_catalog),
         cmocka_unit_test_setup_teardown(test_every_known_literal_resolves, setup_audio,
                                         teardown_audio),
         cmocka_unit_test_setup_teardown(test_log_records_zero_errors_for_valid_names, setup_audio,
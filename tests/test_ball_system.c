@@ -32,6 +32,7 @@
 
 #include "ball_system.h"
 #include "ball_types.h"
+#include "block_system.h"
 
 /* =========================================================================
  * Helpers
@@ -68,8 +69,10 @@ typedef struct
     char last_message[128];
 } test_cb_log_t;
 
-static void cb_on_sound(const char *name, int volume, void *ud)
+static void cb_on_sound(sound_id_t sound, int volume, void *ud)
 {
+    const char *name = sound_key(sound);
+    assert_non_null(name);
     (void)volume;
     test_cb_log_t *log = (test_cb_log_t *)ud;
     log->sound_count++;
@@ -172,7 +175,7 @@ static void test_create_returns_context(void **state)
 {
     (void)state;
     ball_system_status_t st;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, &st);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, &st);
 
     assert_non_null(ctx);
     assert_int_equal(st, BALL_SYS_OK);
@@ -184,7 +187,7 @@ static void test_create_returns_context(void **state)
 static void test_create_all_balls_inactive(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     assert_non_null(ctx);
 
     for (int i = 0; i < MAX_BALLS; i++)
@@ -203,7 +206,7 @@ static void test_create_all_balls_inactive(void **state)
 static void test_create_guide_initial_position(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     assert_non_null(ctx);
 
     ball_system_guide_info_t guide = ball_system_get_guide_info(ctx);
@@ -219,6 +222,34 @@ static void test_destroy_null_safe(void **state)
     ball_system_destroy(NULL); /* Should not crash */
 }
 
+/* Injected rand_fn: counts calls and checks it receives user_data. */
+typedef struct
+{
+    int calls;
+} rand_probe_t;
+
+static int probe_rand(void *user_data)
+{
+    rand_probe_t *probe = user_data;
+    probe->calls++;
+    return 0;
+}
+
+/* TC-04b: ball_system_add draws its mass from the injected rand_fn. */
+static void test_create_uses_injected_rand(void **state)
+{
+    (void)state;
+    rand_probe_t probe = {0};
+    ball_system_t *ctx = ball_system_create(NULL, &probe, probe_rand, NULL);
+    assert_non_null(ctx);
+
+    ball_system_env_t env = make_env(100);
+    assert_int_equal(ball_system_add(ctx, &env, 100, 200, 3, -3, NULL), 0);
+    assert_int_equal(probe.calls, 1);
+
+    ball_system_destroy(ctx);
+}
+
 /* =========================================================================
  * Group 2: Ball management
  * ========================================================================= */
@@ -227,7 +258,7 @@ static void test_destroy_null_safe(void **state)
 static void test_add_returns_slot_zero(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
     ball_system_status_t st;
 
@@ -251,7 +282,7 @@ static void test_add_returns_slot_zero(void **state)
 static void test_add_fills_consecutive_slots(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     for (int i = 0; i < MAX_BALLS; i++)
@@ -267,7 +298,7 @@ static void test_add_fills_consecutive_slots(void **state)
 static void test_add_full_returns_error(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Fill all slots */
@@ -290,7 +321,7 @@ static void test_add_full_returns_error(void **state)
 static void test_clear_resets_to_defaults(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 200, 300, 5, -5, NULL);
@@ -311,7 +342,7 @@ static void test_clear_resets_to_defaults(void **state)
 static void test_clear_allows_reuse(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Fill all slots */
@@ -337,7 +368,7 @@ static void test_clear_allows_reuse(void **state)
 static void test_clear_all(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     for (int i = 0; i < MAX_BALLS; i++)
@@ -377,7 +408,7 @@ static void test_add_null_context(void **state)
 static void test_render_info_active_ball(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 150, 250, 3, -3, NULL);
@@ -402,7 +433,7 @@ static void test_render_info_active_ball(void **state)
 static void test_render_info_interpolation_fields(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(0);
 
     /* Add a ball and force it to BALL_ACTIVE */
@@ -440,7 +471,7 @@ static void test_render_info_interpolation_fields(void **state)
 static void test_render_info_inactive_slot(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     ball_system_render_info_t info;
     ball_system_status_t st = ball_system_get_render_info(ctx, 3, &info);
@@ -455,7 +486,7 @@ static void test_render_info_inactive_slot(void **state)
 static void test_render_info_invalid_index(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     ball_system_render_info_t info;
     ball_system_status_t st = ball_system_get_render_info(ctx, MAX_BALLS, &info);
@@ -471,7 +502,7 @@ static void test_render_info_invalid_index(void **state)
 static void test_guide_info_initial(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     ball_system_guide_info_t guide = ball_system_get_guide_info(ctx);
     assert_int_equal(guide.pos, 6);
@@ -531,7 +562,7 @@ static void test_update_null_safe(void **state)
 static void test_active_ball_position_update(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Add ball and force it to ACTIVE state with known velocity */
@@ -554,7 +585,7 @@ static void test_active_ball_position_update(void **state)
 static void test_active_ball_skipped_off_frame(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 200, 300, 5, -5, NULL);
@@ -577,7 +608,7 @@ static void test_active_ball_skipped_off_frame(void **state)
 static void test_create_animation_increments_slide(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     /* frame=100, so nextFrame = 100 + BIRTH_FRAME_RATE = 105 */
     ball_system_env_t env = make_env(100);
 
@@ -607,7 +638,7 @@ static void test_create_animation_increments_slide(void **state)
 static void test_create_animation_completes_to_ready(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 0, 0, 3, -3, NULL);
@@ -637,7 +668,7 @@ static void test_create_animation_completes_to_ready(void **state)
 static void test_wait_transitions_on_frame(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Use reset_start which sets up BALL_WAIT → BALL_CREATE */
@@ -660,7 +691,7 @@ static void test_ready_auto_activates(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Create a ball and manually transition to BALL_READY with known nextFrame */
@@ -675,7 +706,7 @@ static void test_ready_auto_activates(void **state)
     ball_system_destroy(ctx);
 
     log = (test_cb_log_t){0};
-    ctx = ball_system_create(&cbs, &log, NULL);
+    ctx = ball_system_create(&cbs, &log, NULL, NULL);
     env = make_env(100);
 
     ball_system_add(ctx, &env, 0, 0, 3, -3, NULL);
@@ -709,7 +740,7 @@ static void test_pop_animation_emits_died(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 200, 300, 3, -3, NULL);
@@ -754,7 +785,7 @@ static void test_wall_bounce_left(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball near left wall with leftward velocity.
@@ -805,7 +836,7 @@ static void test_wall_bounce_right(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball near right wall with rightward velocity */
@@ -828,7 +859,7 @@ static void test_wall_bounce_top(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball near top with upward velocity */
@@ -848,7 +879,7 @@ static void test_wall_bounce_top(void **state)
 static void test_wall_wrap_left(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
     env.no_walls = 1;
 
@@ -871,7 +902,7 @@ static void test_wall_wrap_left(void **state)
 static void test_wall_wrap_right(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
     env.no_walls = 1;
 
@@ -898,7 +929,7 @@ static void test_wall_wrap_right(void **state)
 static void test_ball_past_paddle_triggers_die(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball just above the die threshold:
@@ -921,7 +952,7 @@ static void test_ball_off_bottom_clears(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball well below screen:
@@ -955,7 +986,7 @@ static void test_paddle_hit_bounces_upward(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Paddle line = play_height - DIST_BASE - 2 = 580 - 30 - 2 = 548
@@ -991,7 +1022,7 @@ static void test_paddle_hit_scores(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, env.paddle_pos, 536, 0, 5, NULL);
@@ -1010,7 +1041,7 @@ static void test_paddle_hit_scores(void **state)
 static void test_sticky_bat_catches_ball(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
     env.sticky_bat = 1;
 
@@ -1031,7 +1062,7 @@ static void test_ball_misses_paddle(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball far from paddle horizontally — paddle at 247, ball at 50 */
@@ -1060,7 +1091,7 @@ static void test_ball_misses_paddle(void **state)
 static void test_guide_direction_table(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Default guide_pos = 6: dx=1, dy=-5 */
@@ -1084,7 +1115,7 @@ static void test_activate_waiting_fires_event(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, env.paddle_pos, env.play_height - DIST_BALL_OF_PADDLE, 0, 0, NULL);
@@ -1107,7 +1138,7 @@ static void test_activate_waiting_fires_event(void **state)
 static void test_speed_normalized_after_paddle(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     ball_system_env_t env = make_env(100);
     env.speed_level = 5;
 
@@ -1131,7 +1162,7 @@ static void test_auto_tilt_fires(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Add ball with lastPaddleHitFrame in the past */
@@ -1175,7 +1206,7 @@ static void test_block_collision_bounce_top(void **state)
     ball_system_callbacks_t cbs = {0};
     cbs.check_region = cb_check_region;
     cbs.on_block_hit = cb_on_block_hit;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place ball at (220, 155) with downward velocity.
@@ -1208,7 +1239,7 @@ static void test_block_collision_no_bounce(void **state)
     ball_system_callbacks_t cbs = {0};
     cbs.check_region = cb_check_region;
     cbs.on_block_hit = cb_on_block_hit;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 220, 155, 3, 5, NULL);
@@ -1239,7 +1270,7 @@ static void test_block_no_collision(void **state)
     ball_system_callbacks_t cbs = {0};
     cbs.check_region = cb_check_region;
     cbs.on_block_hit = cb_on_block_hit;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_add(ctx, &env, 200, 200, 3, -3, NULL);
@@ -1267,7 +1298,7 @@ static void test_block_collision_bounce_left(void **state)
     ball_system_callbacks_t cbs = {0};
     cbs.check_region = cb_check_region;
     cbs.on_block_hit = cb_on_block_hit;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Ball moving rightward into block */
@@ -1292,7 +1323,7 @@ static void test_ball_to_ball_collision_sound(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Ball 0 at paddle position heading down — will hit paddle on update.
@@ -1333,7 +1364,7 @@ static void test_ball_to_ball_no_collision(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Place two balls far apart */
@@ -1362,7 +1393,7 @@ static void test_ball_to_ball_skips_inactive(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Ball 0 active, ball 1 in CREATE state (close but not active) */
@@ -1399,7 +1430,7 @@ static void test_split_teleports_ball(void **state)
 
     ball_system_callbacks_t cbs = {0};
     cbs.cell_available = cb_cell_available;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Add an initial ball so slot 0 is occupied */
@@ -1422,7 +1453,7 @@ static void test_split_adds_ball(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Add an initial ball so slot 0 is occupied */
@@ -1458,7 +1489,7 @@ static void test_split_full_shows_message(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Fill all slots */
@@ -1497,7 +1528,7 @@ static void test_split_full_shows_message(void **state)
 static void test_guide_advances_every_8_ticks(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     assert_non_null(ctx);
 
     /* Add a ball at frame 0 and move to BALL_READY.  ball_system_add
@@ -1570,7 +1601,7 @@ static void test_guide_advances_every_8_ticks(void **state)
 static void test_get_velocity_default_zero(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     int dx = 99, dy = 99;
     ball_system_status_t st = ball_system_get_velocity(ctx, 0, &dx, &dy);
@@ -1585,7 +1616,7 @@ static void test_get_velocity_default_zero(void **state)
 static void test_get_velocity_invalid_index(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     int dx = 0, dy = 0;
     assert_int_equal(ball_system_get_velocity(ctx, -1, &dx, &dy),
@@ -1599,7 +1630,7 @@ static void test_get_velocity_invalid_index(void **state)
 static void test_get_velocity_null_args(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     int dx = 0, dy = 0;
     assert_int_equal(ball_system_get_velocity(NULL, 0, &dx, &dy), BALL_SYS_ERR_NULL_ARG);
     assert_int_equal(ball_system_get_velocity(ctx, 0, NULL, &dy), BALL_SYS_ERR_NULL_ARG);
@@ -1610,7 +1641,7 @@ static void test_get_velocity_null_args(void **state)
 static void test_get_wait_mode_default(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     assert_int_equal(ball_system_get_wait_mode(ctx, 0), BALL_NONE);
     /* Invalid index also returns BALL_NONE (sentinel). */
     assert_int_equal(ball_system_get_wait_mode(ctx, -1), BALL_NONE);
@@ -1621,7 +1652,7 @@ static void test_get_wait_mode_default(void **state)
 static void test_restore_active_ball_roundtrip(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     /* Restore a moving ball into slot 0. */
     ball_system_status_t st = ball_system_restore(
@@ -1649,7 +1680,7 @@ static void test_restore_active_ball_roundtrip(void **state)
 static void test_restore_ball_create_becomes_ready(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
 
     ball_system_restore(ctx, 0, 100, 1, BALL_CREATE, 100, 100, 0, 0, BALL_NONE);
 
@@ -1661,7 +1692,7 @@ static void test_restore_ball_create_becomes_ready(void **state)
 static void test_restore_invalid_index(void **state)
 {
     (void)state;
-    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL);
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
     assert_int_equal(
         ball_system_restore(ctx, -1, 100, 1, BALL_ACTIVE, 0, 0, 0, 0, BALL_NONE),
         BALL_SYS_ERR_INVALID_INDEX);
@@ -1681,7 +1712,7 @@ static void test_restore_active_no_auto_tilt_first_tick(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
 
     int save_frame = 1000;
     ball_system_restore(ctx, 0, save_frame, /*active*/ 1, BALL_ACTIVE, /*x*/ 247, /*y*/ 400,
@@ -1713,7 +1744,7 @@ static void test_restore_ready_no_auto_activate_first_tick(void **state)
     (void)state;
     test_cb_log_t log = {0};
     ball_system_callbacks_t cbs = make_test_callbacks();
-    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &log, NULL, NULL);
 
     int save_frame = 1000;
     ball_system_restore(ctx, 0, save_frame, 1, BALL_READY, 247, 528, 0, 0, BALL_NONE);
@@ -1811,7 +1842,7 @@ static void test_raymarch_starts_at_pre_tick_position(void **state)
     ball_system_callbacks_t cbs = {0};
     cbs.check_region = cb_check_region_windowed;
     cbs.on_block_hit = cb_on_block_hit_windowed;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     /* Restore an active ball at (220, 180), velocity (0, -15).  Restore
@@ -1856,7 +1887,7 @@ static void test_check_for_collision_search_base_does_not_drift(void **state)
     ball_system_callbacks_t cbs = {0};
     cbs.check_region = cb_check_region_windowed;
     cbs.on_block_hit = cb_on_block_hit_windowed;
-    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL);
+    ball_system_t *ctx = ball_system_create(&cbs, &bc, NULL, NULL);
     ball_system_env_t env = make_env(100);
 
     ball_system_restore(ctx, 0, env.frame - 1, 1, BALL_ACTIVE, 220, 190, 0, -11, BALL_NONE);
@@ -1867,6 +1898,229 @@ static void test_check_for_collision_search_base_does_not_drift(void **state)
     ball_system_destroy(ctx);
 }
 
+/* =========================================================================
+ * Group 16: Snapshots
+ * ========================================================================= */
+
+/* Two contexts loaded from one snapshot advance identically. */
+static void test_snapshot_round_trip(void **state)
+{
+    (void)state;
+    ball_system_t *a = ball_system_create(NULL, NULL, NULL, NULL);
+    ball_system_t *b = ball_system_create(NULL, NULL, NULL, NULL);
+    ball_system_env_t env = make_env(100);
+
+    ball_system_restore(a, 0, env.frame, 1, BALL_ACTIVE, 120, 300, 4, -5, BALL_NONE);
+    ball_system_restore(a, 2, env.frame, 1, BALL_ACTIVE, 300, 200, -3, 6, BALL_NONE);
+    ball_system_add(b, &env, 50, 50, 1, 1, NULL);
+
+    unsigned char *buf = malloc(ball_system_snapshot_size());
+    assert_non_null(buf);
+    ball_system_snapshot_save(a, buf);
+    ball_system_snapshot_load(b, buf);
+    free(buf);
+
+    for (int f = 101; f < 161; f++)
+    {
+        env.frame = f;
+        ball_system_update(a, &env);
+        ball_system_update(b, &env);
+    }
+    for (int i = 0; i < MAX_BALLS; i++)
+    {
+        int ax = 0, ay = 0, bx = 0, by = 0;
+        assert_int_equal(ball_system_get_state(b, i), ball_system_get_state(a, i));
+        ball_system_get_position(a, i, &ax, &ay);
+        ball_system_get_position(b, i, &bx, &by);
+        assert_int_equal(bx, ax);
+        assert_int_equal(by, ay);
+    }
+    assert_int_equal(ball_system_get_active_count(b), 2);
+
+    ball_system_destroy(a);
+    ball_system_destroy(b);
+}
+
+/* NULL context or buffer is ignored. */
+static void test_snapshot_null_args(void **state)
+{
+    (void)state;
+    unsigned char buf[8];
+    ball_system_snapshot_save(NULL, buf);
+    ball_system_snapshot_load(NULL, buf);
+
+    ball_system_t *ctx = ball_system_create(NULL, NULL, NULL, NULL);
+    ball_system_snapshot_save(ctx, NULL);
+    ball_system_snapshot_load(ctx, NULL);
+    assert_int_equal(ball_system_get_active_count(ctx), 0);
+    ball_system_destroy(ctx);
+}
+
+/* =========================================================================
+ * Group 17: Cell windows
+ *
+ * get_window must be a drop-in replacement for check_region: the same
+ * grid gives the same trajectory and the same hits in the same order,
+ * from far fewer callback invocations.
+ * ========================================================================= */
+
+typedef struct
+{
+    block_system_t *blocks;
+    int region_calls;
+    int window_calls;
+    int hits;
+    int hit_cells[256]; /* row * MAX_COL + col, in hit order */
+    unsigned int seed;  /* Per-context stream so the two runs draw alike */
+} test_grid_cb_t;
+
+static int cb_grid_rand(void *ud)
+{
+    test_grid_cb_t *g = (test_grid_cb_t *)ud;
+    g->seed = g->seed * 1103515245u + 12345u;
+    return (int)((g->seed >> 1) & 0x7fffffff);
+}
+
+static int cb_grid_check_region(int row, int col, int bx, int by, int bdx, void *ud)
+{
+    test_grid_cb_t *g = (test_grid_cb_t *)ud;
+    g->region_calls++;
+    return block_system_check_region_bbox(row, col, bx, by, bdx, g->blocks);
+}
+
+static int cb_grid_get_window(int row, int col, block_window_t *out, void *ud)
+{
+    test_grid_cb_t *g = (test_grid_cb_t *)ud;
+    g->window_calls++;
+    return block_system_get_window(row, col, out, g->blocks);
+}
+
+/* Clears the block like a one-hit red block, so the grid changes under
+ * the ball and a stale window would show. */
+static block_hit_result_t cb_grid_on_block_hit(int row, int col, int ball_index, void *ud)
+{
+    test_grid_cb_t *g = (test_grid_cb_t *)ud;
+    (void)ball_index;
+    if (g->hits < (int)(sizeof(g->hit_cells) / sizeof(g->hit_cells[0])))
+    {
+        g->hit_cells[g->hits] = row * MAX_COL + col;
+    }
+    g->hits++;
+    block_system_clear(g->blocks, row, col);
+    return BLOCK_HIT_BOUNCE;
+}
+
+static ball_system_t *make_grid_balls(test_grid_cb_t *g, int use_window)
+{
+    block_system_status_t st;
+    g->blocks = block_system_create(55, 32, NULL, NULL, &st);
+    assert_non_null(g->blocks);
+    for (int r = 2; r < 12; r++)
+    {
+        for (int c = 0; c < MAX_COL; c++)
+        {
+            if ((r * 7 + c * 3) % 5 != 0)
+            {
+                assert_int_equal(block_system_add(g->blocks, r, c, RED_BLK, 0, 0), BLOCK_SYS_OK);
+            }
+        }
+    }
+
+    ball_system_callbacks_t cbs = {0};
+    if (use_window)
+    {
+        cbs.get_window = cb_grid_get_window;
+    }
+    else
+    {
+        cbs.check_region = cb_grid_check_region;
+    }
+    cbs.on_block_hit = cb_grid_on_block_hit;
+    ball_system_t *ctx = ball_system_create(&cbs, g, cb_grid_rand, NULL);
+    assert_non_null(ctx);
+
+    ball_system_restore(ctx, 0, 0, 1, BALL_ACTIVE, 60, 500, 4, -7, BALL_NONE);
+    ball_system_restore(ctx, 1, 0, 1, BALL_ACTIVE, 250, 480, -6, -9, BALL_NONE);
+    ball_system_restore(ctx, 2, 0, 1, BALL_ACTIVE, 400, 520, 3, -11, BALL_NONE);
+    return ctx;
+}
+
+static void test_window_matches_check_region_trajectory(void **state)
+{
+    (void)state;
+    test_grid_cb_t gr = {0};
+    test_grid_cb_t gw = {0};
+    ball_system_t *by_region = make_grid_balls(&gr, 0);
+    ball_system_t *by_window = make_grid_balls(&gw, 1);
+    ball_system_env_t env = make_env(0);
+    env.paddle_size = env.play_width * 2; /* Never miss: keep the balls in play */
+
+    for (int tick = 0; tick < 2000; tick++)
+    {
+        env.frame += BALL_FRAME_RATE;
+        ball_system_update(by_region, &env);
+        ball_system_update(by_window, &env);
+        for (int i = 0; i < 3; i++)
+        {
+            int rx = 0, ry = 0, wx = 0, wy = 0;
+            ball_system_get_position(by_region, i, &rx, &ry);
+            ball_system_get_position(by_window, i, &wx, &wy);
+            assert_int_equal(wx, rx);
+            assert_int_equal(wy, ry);
+        }
+    }
+
+    assert_true(gr.hits > 10);
+    assert_int_equal(gw.hits, gr.hits);
+    assert_memory_equal(gw.hit_cells, gr.hit_cells, sizeof(gr.hit_cells));
+    assert_int_equal(gw.region_calls, 0);
+    assert_true(gw.window_calls * 4 < gr.region_calls);
+
+    ball_system_destroy(by_region);
+    ball_system_destroy(by_window);
+    block_system_destroy(gr.blocks);
+    block_system_destroy(gw.blocks);
+}
+
+/* A get_window that declines (returns 0) falls back to check_region. */
+static int cb_grid_no_window(int row, int col, block_window_t *out, void *ud)
+{
+    test_grid_cb_t *g = (test_grid_cb_t *)ud;
+    (void)row;
+    (void)col;
+    (void)out;
+    g->window_calls++;
+    return 0;
+}
+
+static void test_window_declined_falls_back_to_check_region(void **state)
+{
+    (void)state;
+    test_grid_cb_t g = {0};
+    ball_system_t *ctx = make_grid_balls(&g, 0);
+    ball_system_destroy(ctx);
+
+    ball_system_callbacks_t cbs = {0};
+    cbs.check_region = cb_grid_check_region;
+    cbs.get_window = cb_grid_no_window;
+    cbs.on_block_hit = cb_grid_on_block_hit;
+    ctx = ball_system_create(&cbs, &g, NULL, NULL);
+    ball_system_env_t env = make_env(0);
+    ball_system_restore(ctx, 0, 0, 1, BALL_ACTIVE, 60, 500, 4, -7, BALL_NONE);
+
+    for (int tick = 0; tick < 100; tick++)
+    {
+        env.frame += BALL_FRAME_RATE;
+        ball_system_update(ctx, &env);
+    }
+    assert_true(g.window_calls > 0);
+    assert_true(g.region_calls > 0);
+    assert_true(g.hits > 0);
+
+    ball_system_destroy(ctx);
+    block_system_destroy(g.blocks);
+}
+
 int main(void)
 {
     const struct CMUnitTest tests[] = {
@@ -1875,6 +2129,7 @@ int main(void)
         cmocka_unit_test(test_create_all_balls_inactive),
         cmocka_unit_test(test_create_guide_initial_position),
         cmocka_unit_test(test_destroy_null_safe),
+        cmocka_unit_test(test_create_uses_injected_rand),
         /* Group 2: Ball management */
         cmocka_unit_test(test_add_returns_slot_zero),
         cmocka_unit_test(test_add_fills_consecutive_slots),
@@ -1950,6 +2205,12 @@ int main(void)
         /* Group 15: Ray-march start position (xboing-c-qck) */
         cmocka_unit_test(test_raymarch_starts_at_pre_tick_position),
         cmocka_unit_test(test_check_for_collision_search_base_does_not_drift),
+        /* Group 16: Snapshots */
+        cmocka_unit_test(test_snapshot_round_trip),
+        cmocka_unit_test(test_snapshot_null_args),
+        /* Group 17: Cell windows */
+        cmocka_unit_test(test_window_matches_check_region_trajectory),
+        cmocka_unit_test(test_window_declined_falls_back_to_check_region),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
@@ -0,0 +1,295 @@
+/*
+ * test_bench.c — microbenchmark harness (benchmarks/bench.c).
+ *
+ * Covers the parts the regression gate depends on: bench_run calibration
+ * and timer pausing, the JSON round trip through a baseline file, and
+ * the tolerance rule in bench_compare.  Timings themselves are not
+ * asserted beyond being positive.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+
+#include "bench.h"
+
+/* =========================================================================
+ * Helpers
+ * ========================================================================= */
+
+static char tmp_path[256];
+
+static int setup_tmpfile(void **state)
+{
+    (void)state;
+    snprintf(tmp_path, sizeof(tmp_path), "/tmp/test_bench_%d.json", (int)getpid());
+    return 0;
+}
+
+static int teardown_tmpfile(void **state)
+{
+    (void)state;
+    unlink(tmp_path);
+    return 0;
+}
+
+static bench_result_t make_result(const char *name, double ns_per_op)
+{
+    bench_result_t r;
+    memset(&r, 0, sizeof(r));
+    snprintf(r.name, sizeof(r.name), "%s", name);
+    r.iterations = 1000;
+    r.ns_per_op = ns_per_op;
+    return r;
+}
+
+typedef struct
+{
+    int calls;
+    uint64_t last_iterations;
+    uint64_t total_ops;
+} counter_t;
+
+static void bench_count(bench_t *b, void *arg)
+{
+    counter_t *c = arg;
+    c->calls++;
+    c->last_iterations = bench_iterations(b);
+    bench_timer_start(b);
+    volatile uint64_t x = 0;
+    for (uint64_t i = 0; i < bench_iterations(b); i++)
+    {
+        x += i;
+    }
+    bench_timer_stop(b);
+    c->total_ops += bench_iterations(b);
+    bench_sink((int)x);
+}
+
+/* Never starts the timer: every run measures zero time. */
+static void bench_untimed(bench_t *b, void *arg)
+{
+    counter_t *c = arg;
+    c->calls++;
+    c->last_iterations = bench_iterations(b);
+}
+
+/* =========================================================================
+ * Running benchmarks
+ * ========================================================================= */
+
+static void test_config_defaults(void **state)
+{
+    (void)state;
+    bench_config_t cfg;
+    bench_config_init(&cfg);
+    assert_int_equal(cfg.min_time_ns, BENCH_DEFAULT_MIN_TIME_NS);
+    assert_int_equal(cfg.reps, BENCH_DEFAULT_REPS);
+}
+
+static void test_run_null_args(void **state)
+{
+    (void)state;
+    bench_result_t r;
+    counter_t c = {0};
+    assert_int_equal(bench_run(NULL, NULL, bench_count, &c, &r), BENCH_ERR_NULL_ARG);
+    assert_int_equal(bench_run(NULL, "x", NULL, &c, &r), BENCH_ERR_NULL_ARG);
+    assert_int_equal(bench_run(NULL, "x", bench_count, &c, NULL), BENCH_ERR_NULL_ARG);
+    assert_int_equal(c.calls, 0);
+}
+
+static void test_run_calibrates_and_reports(void **state)
+{
+    (void)state;
+    bench_config_t cfg = {.min_time_ns = 1000000, .reps = 3};
+    counter_t c = {0};
+    bench_result_t r;
+    assert_int_equal(bench_run(&cfg, "count", bench_count, &c, &r), BENCH_OK);
+
+    assert_string_equal(r.name, "count");
+    assert_true(r.iterations > 1);
+    assert_true(r.ns_per_op > 0.0);
+    /* Calibration runs, then exactly `reps` timed runs at the final count. */
+    assert_true(c.calls > cfg.reps);
+    assert_int_equal(c.last_iterations, r.iterations);
+}
+
+static void test_run_untimed_terminates(void **state)
+{
+    (void)state;
+    bench_config_t cfg = {.min_time_ns = 1000000, .reps = 1};
+    counter_t c = {0};
+    bench_result_t r;
+    assert_int_equal(bench_run(&cfg, "untimed", bench_untimed, &c, &r), BENCH_OK);
+    assert_true(r.ns_per_op == 0.0);
+    assert_true(r.iterations > 0);
+}
+
+static void test_name_truncated(void **state)
+{
+    (void)state;
+    char long_name[BENCH_NAME_MAX * 2];
+    memset(long_name, 'n', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = '\0';
+
+    bench_config_t cfg = {.min_time_ns = 1000, .reps = 1};
+    counter_t c = {0};
+    bench_result_t r;
+    assert_int_equal(bench_run(&cfg, long_name, bench_count, &c, &r), BENCH_OK);
+    assert_int_equal(strlen(r.name), BENCH_NAME_MAX - 1);
+}
+
+/* =========================================================================
+ * JSON output and baselines
+ * ========================================================================= */
+
+static void test_json_round_trip(void **state)
+{
+    (void)state;
+    bench_result_t out[3] = {
+        make_result("ball_update/1", 5123.25),
+        make_result("block_check_region/dense", 249.5),
+        make_result("gun_update/full", 0.125),
+    };
+
+    FILE *fp = fopen(tmp_path, "w");
+    assert_non_null(fp);
+    assert_int_equal(bench_write_json(fp, out, 3), BENCH_OK);
+    fclose(fp);
+
+    bench_result_t in[BENCH_MAX_RESULTS];
+    int count = -1;
+    assert_int_equal(bench_read_baseline(tmp_path, in, BENCH_MAX_RESULTS, &count), BENCH_OK);
+    assert_int_equal(count, 3);
+    for (int i = 0; i < 3; i++)
+    {
+        assert_string_equal(in[i].name, out[i].name);
+        assert_int_equal(in[i].iterations, out[i].iterations);
+        assert_float_equal(in[i].ns_per_op, out[i].ns_per_op, 0.001);
+    }
+}
+
+static void test_read_baseline_missing_file(void **state)
+{
+    (void)state;
+    bench_result_t in[4];
+    int count = -1;
+    assert_int_equal(bench_read_baseline("/nonexistent/dir/baseline.json", in, 4, &count),
+                     BENCH_ERR_IO);
+    assert_int_equal(count, 0);
+}
+
+static void test_read_baseline_full(void **state)
+{
+    (void)state;
+    bench_result_t out[3] = {make_result("a", 1.0), make_result("b", 2.0), make_result("c", 3.0)};
+    FILE *fp = fopen(tmp_path, "w");
+    assert_non_null(fp);
+    assert_int_equal(bench_write_json(fp, out, 3), BENCH_OK);
+    fclose(fp);
+
+    bench_result_t in[2];
+    int count = -1;
+    assert_int_equal(bench_read_baseline(tmp_path, in, 2, &count), BENCH_ERR_FULL);
+    assert_int_equal(count, 2);
+}
+
+static void test_read_baseline_malformed(void **state)
+{
+    (void)state;
+    FILE *fp = fopen(tmp_path, "w");
+    assert_non_null(fp);
+    fputs("{\n  \"benchmarks\": [\n    {\"name\": \"a\", \"iterations\": 5}\n  ]\n}\n", fp);
+    fclose(fp);
+
+    bench_result_t in[4];
+    int count = -1;
+    assert_int_equal(bench_read_baseline(tmp_path, in, 4, &count), BENCH_ERR_PARSE);
+}
+
+/* =========================================================================
+ * Regression check
+ * ========================================================================= */
+
+static void test_compare_tolerance(void **state)
+{
+    (void)state;
+    bench_result_t base[3] = {
+        make_result("faster", 100.0),
+        make_result("within", 100.0),
+        make_result("slower", 100.0),
+    };
+    bench_result_t now[3] = {
+        make_result("faster", 60.0),
+        make_result("within", 124.0),
+        make_result("slower", 126.0),
+    };
+    assert_int_equal(bench_compare(now, 3, base, 3, 25.0, NULL), 1);
+    assert_int_equal(bench_compare(now, 3, base, 3, 30.0, NULL), 0);
+    assert_int_equal(bench_compare(now, 3, base, 3, 0.0, NULL), 2);
+}
+
+static void test_compare_new_benchmark_never_fails(void **state)
+{
+    (void)state;
+    bench_result_t base[1] = {make_result("old", 10.0)};
+    bench_result_t now[2] = {make_result("old", 10.0), make_result("new", 1e9)};
+    assert_int_equal(bench_compare(now, 2, base, 1, 0.0, NULL), 0);
+    assert_int_equal(bench_compare(now, 2, NULL, 0, 0.0, NULL), 0);
+}
+
+static void test_compare_report_marks_regression(void **state)
+{
+    (void)state;
+    bench_result_t base[1] = {make_result("gun_update/full", 100.0)};
+    bench_result_t now[1] = {make_result("gun_update/full", 200.0)};
+
+    FILE *fp = fopen(tmp_path, "w+");
+    assert_non_null(fp);
+    assert_int_equal(bench_compare(now, 1, base, 1, 25.0, fp), 1);
+    rewind(fp);
+    char line[256];
+    assert_non_null(fgets(line, sizeof(line), fp));
+    fclose(fp);
+    assert_non_null(strstr(line, "gun_update/full"));
+    assert_non_null(strstr(line, "REGRESSED"));
+}
+
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(bench_status_string(BENCH_OK), "OK");
+    assert_string_equal(bench_status_string(BENCH_ERR_PARSE), "malformed baseline");
+    assert_string_equal(bench_status_string((bench_status_t)99), "unknown status");
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Running benchmarks */
+        cmocka_unit_test(test_config_defaults),
+        cmocka_unit_test(test_run_null_args),
+        cmocka_unit_test(test_run_calibrates_and_reports),
+        cmocka_unit_test(test_run_untimed_terminates),
+        cmocka_unit_test(test_name_truncated),
+        /* JSON output and baselines */
+        cmocka_unit_test_setup_teardown(test_json_round_trip, setup_tmpfile, teardown_tmpfile),
+        cmocka_unit_test(test_read_baseline_missing_file),
+        cmocka_unit_test_setup_teardown(test_read_baseline_full, setup_tmpfile, teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_read_baseline_malformed, setup_tmpfile,
+                                        teardown_tmpfile),
+        /* Regression check */
+        cmocka_unit_test(test_compare_tolerance),
+        cmocka_unit_test(test_compare_new_benchmark_never_fails),
+        cmocka_unit_test_setup_teardown(test_compare_report_marks_regression, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test(test_status_strings),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
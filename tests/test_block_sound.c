@@ -1,11 +1,11 @@
 /*
  * test_block_sound.c — exhaustive table test for the block-type →
- * (sound name, volume) mapping.  Pure function, no audio context needed.
+ * (sound ID, volume) mapping.  Pure function, no audio context needed.
  *
  * Spec: docs/specs/2026-06-03-sfx-testability.md (Component 3a).
  * Peer review B2: every block type defined in block_types.h gets an
  * explicit assertion.  A vacuous `(void)block_sound_lookup(t)` loop
- * would let a NULL-returning regression pass.
+ * would let a SOUND_NONE-returning regression pass.
  *
  * Volume column added by docs/audits/2026-06-28-audio-volume-modulation.md.
  */
@@ -29,14 +29,14 @@ _Static_assert(MAX_BLOCKS == 30,
 static void assert_sound(int block_type, const char *name, int volume)
 {
     block_sound_t s = block_sound_lookup(block_type);
-    assert_string_equal(s.name, name);
+    assert_string_equal(sound_key(s.id), name);
     assert_int_equal(s.volume, volume);
 }
 
 static void test_block_sound_exhaustive(void **state)
 {
     (void)state;
-    /* Asserts the current block-type → (name, volume) mapping for every
+    /* Asserts the current block-type → (sound key, volume) mapping for every
      * type defined in block_types.h.  Regressions on these entries
      * (renames, deletions, wrong names, wrong volumes) fail here.
      * Additions are caught at compile time by the _Static_assert above. */
@@ -69,20 +69,20 @@ static void test_block_sound_exhaustive(void **state)
     assert_sound(BLACK_BLK, "metal", 99);
     assert_sound(HYPERSPACE_BLK, "hypspc", 99);
     /* Explicitly silent — see comments in src/block_sound.c. */
-    assert_null(block_sound_lookup(DYNAMITE_BLK).name);
-    assert_null(block_sound_lookup(BLACKHIT_BLK).name);
+    assert_int_equal(block_sound_lookup(DYNAMITE_BLK).id, SOUND_NONE);
+    assert_int_equal(block_sound_lookup(BLACKHIT_BLK).id, SOUND_NONE);
 }
 
 static void test_block_sound_sentinels_and_invalid(void **state)
 {
     (void)state;
     /* Sentinels: not destructible blocks. */
-    assert_null(block_sound_lookup(NONE_BLK).name);
-    assert_null(block_sound_lookup(KILL_BLK).name);
+    assert_int_equal(block_sound_lookup(NONE_BLK).id, SOUND_NONE);
+    assert_int_equal(block_sound_lookup(KILL_BLK).id, SOUND_NONE);
     /* Out-of-range values: defensively silent, not crash. */
-    assert_null(block_sound_lookup(-99).name);
-    assert_null(block_sound_lookup(MAX_BLOCKS).name);
-    assert_null(block_sound_lookup(9999).name);
+    assert_int_equal(block_sound_lookup(-99).id, SOUND_NONE);
+    assert_int_equal(block_sound_lookup(MAX_BLOCKS).id, SOUND_NONE);
+    assert_int_equal(block_sound_lookup(9999).id, SOUND_NONE);
 }
 
 int main(void)
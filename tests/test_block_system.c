@@ -34,7 +34,7 @@
 static block_system_t *make_ctx(void)
 {
     block_system_status_t st;
-    block_system_t *ctx = block_system_create(COL_WIDTH, ROW_HEIGHT, &st);
+    block_system_t *ctx = block_system_create(COL_WIDTH, ROW_HEIGHT, NULL, NULL, &st);
     assert_non_null(ctx);
     assert_int_equal(st, BLOCK_SYS_OK);
     return ctx;
@@ -1513,6 +1513,461 @@ static void test_explode_all_required_full_required_grid(void **state)
     block_system_destroy(ctx);
 }
 
+/* =========================================================================
+ * Group 18: injected rand_fn
+ * ========================================================================= */
+
+typedef struct
+{
+    int calls;
+} rand_probe_t;
+
+static int probe_rand(void *user_data)
+{
+    rand_probe_t *probe = user_data;
+    probe->calls++;
+    return 0;
+}
+
+/* TC-61: Timer rolls go to the owning context's rand_fn with its
+ * rand_user_data, and never to another context's. */
+static void test_rand_fn_is_per_context(void **state)
+{
+    (void)state;
+    rand_probe_t probe_a = {0};
+    rand_probe_t probe_b = {0};
+    block_system_t *a = block_system_create(COL_WIDTH, ROW_HEIGHT, probe_rand, &probe_a, NULL);
+    block_system_t *b = block_system_create(COL_WIDTH, ROW_HEIGHT, probe_rand, &probe_b, NULL);
+    assert_non_null(a);
+    assert_non_null(b);
+
+    /* ROAMER_BLK rolls its eye and move timers at add time. */
+    assert_int_equal(block_system_add(a, 5, 4, ROAMER_BLK, 0, 0), BLOCK_SYS_OK);
+    assert_int_equal(probe_a.calls, 2);
+    assert_int_equal(probe_b.calls, 0);
+
+    /* DROP_BLK rolls one drop timer. */
+    assert_int_equal(block_system_add(b, 5, 4, DROP_BLK, 0, 0), BLOCK_SYS_OK);
+    assert_int_equal(probe_a.calls, 2);
+    assert_int_equal(probe_b.calls, 1);
+
+    block_system_destroy(a);
+    block_system_destroy(b);
+}
+
+/* =========================================================================
+ * Group 19: snapshots
+ * ========================================================================= */
+
+/* TC-62: A snapshot restores grid contents and explosion state into
+ * another context, which keeps its own rand_fn. */
+static void test_snapshot_round_trip(void **state)
+{
+    (void)state;
+    rand_probe_t probe_b = {0};
+    block_system_t *a = make_ctx();
+    block_system_t *b = block_system_create(COL_WIDTH, ROW_HEIGHT, probe_rand, &probe_b, NULL);
+    assert_non_null(b);
+
+    assert_int_equal(block_system_add(a, 2, 3, RED_BLK, 0, 0), BLOCK_SYS_OK);
+    assert_int_equal(block_system_add(a, 7, 1, COUNTER_BLK, 3, 0), BLOCK_SYS_OK);
+    assert_int_equal(block_system_add(a, 9, 8, BLUE_BLK, 0, 0), BLOCK_SYS_OK);
+    assert_int_equal(block_system_explode(a, 9, 8, 10), BLOCK_SYS_OK);
+    assert_int_equal(block_system_add(b, 0, 0, YELLOW_BLK, 0, 0), BLOCK_SYS_OK);
+
+    unsigned char *buf = malloc(block_system_snapshot_size());
+    assert_non_null(buf);
+    block_system_snapshot_save(a, buf);
+    block_system_snapshot_load(b, buf);
+    free(buf);
+
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        for (int c = 0; c < MAX_COL; c++)
+        {
+            assert_int_equal(block_system_is_occupied(b, r, c), block_system_is_occupied(a, r, c));
+            assert_int_equal(block_system_get_type(b, r, c), block_system_get_type(a, r, c));
+            assert_int_equal(block_system_get_hit_points(b, r, c),
+                             block_system_get_hit_points(a, r, c));
+        }
+    }
+    assert_int_equal(block_system_get_exploding_count(b), 1);
+    assert_int_equal(block_system_is_occupied(b, 0, 0), 0);
+
+    /* Timer rolls after the load still go to b's own rand_fn. */
+    assert_int_equal(block_system_add(b, 5, 4, DROP_BLK, 0, 0), BLOCK_SYS_OK);
+    assert_int_equal(probe_b.calls, 1);
+
+    block_system_destroy(a);
+    block_system_destroy(b);
+}
+
+/* =========================================================================
+ * Group 20: incremental occupancy and required count
+ * ========================================================================= */
+
+/* Scan the grid through render info (the per-cell entries) and check the
+ * incrementally kept occupancy bits and required count agree with it. */
+static void assert_counts_match_scan(const block_system_t *ctx)
+{
+    int required = 0;
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        for (int c = 0; c < MAX_COL; c++)
+        {
+            block_system_render_info_t info;
+            assert_int_equal(block_system_get_render_info(ctx, r, c, &info), BLOCK_SYS_OK);
+            assert_int_equal(block_system_is_occupied(ctx, r, c) != 0, info.occupied != 0);
+            assert_int_equal(block_system_cell_available(r, c, (void *)ctx) != 0,
+                             !info.occupied && !info.exploding);
+            if (info.occupied && block_system_type_is_required(info.block_type))
+            {
+                required++;
+            }
+        }
+    }
+    assert_int_equal(block_system_get_required_count(ctx), required);
+    assert_int_equal(block_system_still_active(ctx) != 0,
+                     required > 0 || block_system_get_exploding_count(ctx) > 1);
+}
+
+/* TC-63: Counts follow add, replace, clear and clear_all. */
+static void test_required_count_add_clear(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+    assert_int_equal(block_system_get_required_count(ctx), 0);
+
+    block_system_add(ctx, 0, 0, RED_BLK, 0, 0);
+    block_system_add(ctx, 1, 1, BLACK_BLK, 0, 0);
+    block_system_add(ctx, 2, 2, RANDOM_BLK, 0, 0);
+    assert_int_equal(block_system_get_required_count(ctx), 2);
+    assert_counts_match_scan(ctx);
+
+    /* Replacing a required block with a non-required one. */
+    block_system_add(ctx, 0, 0, BOMB_BLK, 0, 0);
+    assert_int_equal(block_system_get_required_count(ctx), 1);
+    block_system_clear(ctx, 2, 2);
+    assert_int_equal(block_system_get_required_count(ctx), 0);
+    assert_counts_match_scan(ctx);
+
+    block_system_add(ctx, 5, 5, BLUE_BLK, 0, 0);
+    block_system_clear_all(ctx);
+    assert_int_equal(block_system_get_required_count(ctx), 0);
+    assert_int_equal(block_system_is_occupied(ctx, 1, 1), 0);
+    assert_counts_match_scan(ctx);
+    assert_int_equal(block_system_get_required_count(NULL), 0);
+
+    block_system_destroy(ctx);
+}
+
+static int lcg_rand(void *user_data)
+{
+    unsigned int *seed = user_data;
+    *seed = *seed * 1103515245u + 12345u;
+    return (int)((*seed >> 1) & 0x7fffffff);
+}
+
+/* TC-64: Random mutations — adds of every type, clears, explosions run
+ * to finalize, roamer/drop moves, RANDOM_BLK morphs and a snapshot load —
+ * never leave the counts out of step with a full scan. */
+static void test_required_count_matches_scan_under_churn(void **state)
+{
+    (void)state;
+    unsigned int seed = 77;
+    unsigned int pick = 1234;
+    block_system_t *ctx = block_system_create(COL_WIDTH, ROW_HEIGHT, lcg_rand, &seed, NULL);
+    assert_non_null(ctx);
+    unsigned char *snap = malloc(block_system_snapshot_size());
+    assert_non_null(snap);
+
+    for (int frame = 1; frame < 6000; frame++)
+    {
+        int r = lcg_rand(&pick) % MAX_ROW;
+        int c = lcg_rand(&pick) % MAX_COL;
+        switch (lcg_rand(&pick) % 8)
+        {
+            case 0:
+            case 1:
+                block_system_add(ctx, r, c, lcg_rand(&pick) % MAX_BLOCKS, 0, frame);
+                break;
+            case 2:
+                block_system_clear(ctx, r, c);
+                break;
+            case 3:
+                block_system_explode(ctx, r, c, frame);
+                break;
+            default:
+                break;
+        }
+        block_system_update_explosions(ctx, frame, NULL, NULL);
+        block_system_update_movement(ctx, frame, NULL, 0);
+
+        if (frame == 3000)
+        {
+            block_system_snapshot_save(ctx, snap);
+        }
+        if (frame % 500 == 0)
+        {
+            assert_counts_match_scan(ctx);
+        }
+    }
+
+    block_system_snapshot_load(ctx, snap);
+    assert_counts_match_scan(ctx);
+    free(snap);
+    block_system_destroy(ctx);
+}
+
+/* =========================================================================
+ * Group 21: deadline-scheduled block timers (ADR-084)
+ * ========================================================================= */
+
+/* TC-65: Retiming a roamer through set_last_frame takes effect on the
+ * new deadline — setters reschedule the cell, not just the next scan. */
+static void test_timer_setter_reschedules(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    /* Eye timer lands at frame >= 50, so the first firing is the move. */
+    block_system_add(ctx, 8, 4, ROAMER_BLK, 0, 0);
+    block_system_set_last_frame(ctx, 8, 4, 5);
+
+    block_system_update_movement(ctx, 4, NULL, 0);
+    assert_int_equal(block_system_get_type(ctx, 8, 4), ROAMER_BLK);
+    block_system_update_movement(ctx, 5, NULL, 0);
+    assert_int_not_equal(block_system_get_type(ctx, 8, 4), ROAMER_BLK);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-66: Thousands of superseded deadlines overflow the heap and force
+ * rebuilds; the live deadline still fires on time afterwards. */
+static void test_timer_heap_rebuild_keeps_live_deadline(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    block_system_add(ctx, 8, 4, ROAMER_BLK, 0, 0);
+    block_system_add(ctx, 2, 2, DROP_BLK, 0, 0);
+    for (int i = 0; i < 5000; i++)
+    {
+        block_system_set_last_frame(ctx, 8, 4, 1000000 + i);
+    }
+    block_system_set_last_frame(ctx, 8, 4, 7);
+
+    block_system_update_movement(ctx, 7, NULL, 0);
+    assert_int_not_equal(block_system_get_type(ctx, 8, 4), ROAMER_BLK);
+
+    /* The drop block's own timer survived the rebuilds. */
+    int dropped = 0;
+    for (int frame = 8; frame < 2000 && !dropped; frame++)
+    {
+        block_system_update_movement(ctx, frame, NULL, 0);
+        dropped = block_system_get_type(ctx, 3, 2) == DROP_BLK;
+    }
+    assert_true(dropped);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-67: set_random turns a plain block into a morphing one on the next
+ * tick, the same as a RANDOM_BLK loaded with the level. */
+static void test_timer_set_random_schedules_morph(void **state)
+{
+    (void)state;
+    unsigned int seed = 5;
+    block_system_t *ctx = block_system_create(COL_WIDTH, ROW_HEIGHT, lcg_rand, &seed, NULL);
+    assert_non_null(ctx);
+
+    block_system_add(ctx, 4, 4, TAN_BLK, 0, 0);
+    block_system_update_movement(ctx, 10, NULL, 0);
+    assert_int_equal(block_system_get_type(ctx, 4, 4), TAN_BLK);
+
+    block_system_set_random(ctx, 4, 4, 1);
+    int morphed = 0;
+    for (int frame = 11; frame < 3000 && !morphed; frame++)
+    {
+        block_system_update_movement(ctx, frame, NULL, 0);
+        morphed = block_system_get_type(ctx, 4, 4) != TAN_BLK;
+    }
+    assert_true(morphed);
+
+    block_system_destroy(ctx);
+}
+
+/* =========================================================================
+ * Group 22: render change tracking (ADR-089)
+ * ========================================================================= */
+
+/* Take the dirty set and assert it is exactly the one cell (row, col). */
+static void assert_only_dirty(block_system_t *ctx, int row, int col)
+{
+    uint16_t rows[MAX_ROW];
+    assert_int_equal(block_system_take_dirty(ctx, rows), 1);
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        assert_int_equal(rows[r], r == row ? 1u << col : 0u);
+    }
+}
+
+static int take_dirty_count(block_system_t *ctx)
+{
+    uint16_t rows[MAX_ROW];
+    return block_system_take_dirty(ctx, rows);
+}
+
+/* TC-68: A fresh grid is clean; NULL is handled. */
+static void test_dirty_initially_clean(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+    uint16_t rows[MAX_ROW];
+    rows[3] = 0xffff;
+
+    assert_int_equal(block_system_take_dirty(ctx, rows), 0);
+    assert_int_equal(rows[3], 0);
+    assert_int_equal(block_system_get_generation(ctx), 0);
+
+    rows[3] = 0xffff;
+    assert_int_equal(block_system_take_dirty(NULL, rows), 0);
+    assert_int_equal(rows[3], 0);
+    assert_int_equal(block_system_get_generation(NULL), 0);
+    block_system_mark_all_dirty(NULL);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-69: add and clear mark their cell; take clears the mask; clearing
+ * an empty cell marks nothing. */
+static void test_dirty_add_clear(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    block_system_add(ctx, 5, 3, RED_BLK, 0, 0);
+    assert_true(block_system_get_generation(ctx) > 0);
+    assert_only_dirty(ctx, 5, 3);
+    assert_int_equal(take_dirty_count(ctx), 0);
+
+    block_system_clear(ctx, 5, 3);
+    assert_only_dirty(ctx, 5, 3);
+
+    uint32_t gen = block_system_get_generation(ctx);
+    block_system_clear(ctx, 5, 3);
+    block_system_clear_all(ctx);
+    assert_int_equal(take_dirty_count(ctx), 0);
+    assert_int_equal(block_system_get_generation(ctx), gen);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-70: Every explosion stage marks the cell, through to finalize on the
+ * fourth update. */
+static void test_dirty_explosion_stages(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    block_system_add(ctx, 2, 8, BLUE_BLK, 0, 0);
+    (void)take_dirty_count(ctx);
+
+    assert_int_equal(block_system_explode(ctx, 2, 8, 100), BLOCK_SYS_OK);
+    assert_only_dirty(ctx, 2, 8);
+
+    for (int stage = 0; stage < 4; stage++)
+    {
+        block_system_update_explosions(ctx, 100 + stage * BLOCK_EXPLODE_DELAY, NULL, NULL);
+        assert_only_dirty(ctx, 2, 8);
+    }
+    assert_int_equal(block_system_is_occupied(ctx, 2, 8), 0);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-71: Animation ticks mark a cell only when its frame changes. */
+static void test_dirty_animation_only_on_frame_change(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    block_system_add(ctx, 0, 0, BONUS_BLK, 0, 0);
+    block_system_add(ctx, 1, 1, RED_BLK, 0, 0);
+    block_system_advance_animations(ctx, 0);
+    (void)take_dirty_count(ctx);
+
+    for (int frame = 1; frame < BLOCK_BONUS_DELAY; frame++)
+    {
+        block_system_advance_animations(ctx, frame);
+    }
+    assert_int_equal(take_dirty_count(ctx), 0);
+
+    block_system_advance_animations(ctx, BLOCK_BONUS_DELAY);
+    assert_only_dirty(ctx, 0, 0);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-72: Counter hits from ball and bullet mark the cell. */
+static void test_dirty_counter_hits(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    block_system_add(ctx, 6, 6, COUNTER_BLK, 3, 0);
+    (void)take_dirty_count(ctx);
+
+    assert_int_equal(block_system_ball_hit_counter(ctx, 6, 6), 1);
+    assert_only_dirty(ctx, 6, 6);
+    assert_int_equal(block_system_decrement_gun_hit(ctx, 6, 6), 1);
+    assert_only_dirty(ctx, 6, 6);
+
+    /* A black block absorbs bullets without changing. */
+    block_system_add(ctx, 7, 7, BLACK_BLK, 0, 0);
+    (void)take_dirty_count(ctx);
+    assert_int_equal(block_system_decrement_gun_hit(ctx, 7, 7), 1);
+    assert_int_equal(take_dirty_count(ctx), 0);
+
+    block_system_destroy(ctx);
+}
+
+/* TC-73: A roamer move marks both the cell it left and the one it entered. */
+static void test_dirty_roamer_move(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+
+    block_system_add(ctx, 8, 4, ROAMER_BLK, 0, 0);
+    block_system_set_last_frame(ctx, 8, 4, 5);
+    (void)take_dirty_count(ctx);
+
+    block_system_update_movement(ctx, 5, NULL, 0);
+    uint16_t rows[MAX_ROW];
+    assert_int_equal(block_system_take_dirty(ctx, rows), 2);
+    assert_true(rows[8] & (1u << 4));
+
+    block_system_destroy(ctx);
+}
+
+/* TC-74: Loading a snapshot marks the whole grid. */
+static void test_dirty_snapshot_load_marks_all(void **state)
+{
+    (void)state;
+    block_system_t *ctx = make_ctx();
+    void *buf = malloc(block_system_snapshot_size());
+    assert_non_null(buf);
+
+    block_system_snapshot_save(ctx, buf);
+    uint32_t gen = block_system_get_generation(ctx);
+    block_system_snapshot_load(ctx, buf);
+    assert_true(block_system_get_generation(ctx) != gen);
+    assert_int_equal(take_dirty_count(ctx), MAX_ROW * MAX_COL);
+
+    free(buf);
+    block_system_destroy(ctx);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -1607,6 +2062,30 @@ int main(void)
         cmocka_unit_test(test_explode_all_required_mixed_grid),
         cmocka_unit_test(test_explode_all_required_reentry_no_double_arm),
         cmocka_unit_test(test_explode_all_required_full_required_grid),
+
+        /* Group 18: injected rand_fn */
+        cmocka_unit_test(test_rand_fn_is_per_context),
+
+        /* Group 19: snapshots */
+        cmocka_unit_test(test_snapshot_round_trip),
+
+        /* Group 20: incremental occupancy and required count */
+        cmocka_unit_test(test_required_count_add_clear),
+        cmocka_unit_test(test_required_count_matches_scan_under_churn),
+
+        /* Group 21: deadline-scheduled block timers */
+        cmocka_unit_test(test_timer_setter_reschedules),
+        cmocka_unit_test(test_timer_heap_rebuild_keeps_live_deadline),
+        cmocka_unit_test(test_timer_set_random_schedules_morph),
+
+        /* Group 22: render change tracking */
+        cmocka_unit_test(test_dirty_initially_clean),
+        cmocka_unit_test(test_dirty_add_clear),
+        cmocka_unit_test(test_dirty_explosion_stages),
+        cmocka_unit_test(test_dirty_animation_only_on_frame_change),
+        cmocka_unit_test(test_dirty_counter_hits),
+        cmocka_unit_test(test_dirty_roamer_move),
+        cmocka_unit_test(test_dirty_snapshot_load_marks_all),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
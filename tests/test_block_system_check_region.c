@@ -12,6 +12,8 @@
  *   - Seam-between-adjacent-blocks behaviour (the bug class that this
  *     classifier exists to fix — see bead xboing-c-83u)
  *   - Exhaustive corner combinations for an isolated block
+ *   - Equivalence of the cell-window path (block_system_get_window +
+ *     block_window_check_region) with the direct classifier
  *
  * Block grid in these tests: env col_width=55, row_height=32,
  * BLOCK_WIDTH=40, BLOCK_HEIGHT=20.  Block at (row, col) sits at
@@ -56,7 +58,7 @@ static int setup_seam(void **state)
     assert_non_null(f);
 
     block_system_status_t st;
-    f->ctx = block_system_create(55, 32, &st);
+    f->ctx = block_system_create(55, 32, NULL, NULL, &st);
     assert_non_null(f->ctx);
     assert_int_equal(st, BLOCK_SYS_OK);
 
@@ -186,7 +188,7 @@ static int setup_isolated(void **state)
     assert_non_null(f);
 
     block_system_status_t st;
-    f->ctx = block_system_create(55, 32, &st);
+    f->ctx = block_system_create(55, 32, NULL, NULL, &st);
     assert_non_null(f->ctx);
     assert_int_equal(st, BLOCK_SYS_OK);
 
@@ -238,6 +240,117 @@ static void test_edge_of_grid_no_neighbour_above_for_row_zero(void **state)
     assert_int_equal(block_system_check_region_bbox(0, 4, 247, 0, 0, f->ctx), BLOCK_REGION_TOP);
 }
 
+/* =========================================================================
+ * Group 6 — cell windows: block_window_check_region must agree with
+ * block_system_check_region_bbox for every probe ball_system makes.
+ * ========================================================================= */
+
+static int setup_empty(void **state)
+{
+    fixture_t *f = calloc(1, sizeof(*f));
+    assert_non_null(f);
+
+    block_system_status_t st;
+    f->ctx = block_system_create(55, 32, NULL, NULL, &st);
+    assert_non_null(f->ctx);
+    assert_int_equal(st, BLOCK_SYS_OK);
+
+    *state = f;
+    return 0;
+}
+
+/* Compare every covered cell of the window centred on (row, col) against
+ * the direct classifier, with the ball swept across the 3x3 neighbourhood. */
+static void assert_window_matches(block_system_t *ctx, int row, int col)
+{
+    block_window_t w;
+    assert_int_equal(block_system_get_window(row, col, &w, ctx), 1);
+
+    for (int r = row - 1; r <= row + 1; r++)
+    {
+        for (int c = col - 1; c <= col + 1; c++)
+        {
+            assert_true(block_window_covers(&w, r, c));
+            for (int by = r * 32 - 16; by <= r * 32 + 48; by += 5)
+            {
+                for (int bx = c * 55 - 20; bx <= c * 55 + 75; bx += 6)
+                {
+                    int direct = block_system_check_region_bbox(r, c, bx, by, 0, ctx);
+                    assert_int_equal(block_window_check_region(&w, r, c, bx, by), direct);
+                }
+            }
+        }
+    }
+}
+
+static void test_window_null_args(void **state)
+{
+    fixture_t *f = *state;
+    block_window_t w;
+    assert_int_equal(block_system_get_window(1, 1, NULL, f->ctx), 0);
+    assert_int_equal(block_system_get_window(1, 1, &w, NULL), 0);
+}
+
+static void test_window_matches_seam_grid(void **state)
+{
+    fixture_t *f = *state;
+    assert_window_matches(f->ctx, 1, 4);
+    assert_window_matches(f->ctx, 0, 3);
+    assert_window_matches(f->ctx, 2, 5);
+}
+
+/* Windows centred on the grid border read the off-grid cells as empty,
+ * matching the classifier's out-of-bounds NONE and missing neighbours. */
+static void test_window_matches_grid_edges(void **state)
+{
+    fixture_t *f = *state;
+    for (int r = 0; r < MAX_ROW; r++)
+    {
+        assert_int_equal(block_system_add(f->ctx, r, 0, RED_BLK, 0, 0), BLOCK_SYS_OK);
+        assert_int_equal(block_system_add(f->ctx, r, MAX_COL - 1, RED_BLK, 0, 0), BLOCK_SYS_OK);
+    }
+    for (int c = 0; c < MAX_COL; c++)
+    {
+        assert_int_equal(block_system_add(f->ctx, 0, c, RED_BLK, 0, 0), BLOCK_SYS_OK);
+    }
+
+    assert_window_matches(f->ctx, 0, 0);
+    assert_window_matches(f->ctx, 0, MAX_COL - 1);
+    assert_window_matches(f->ctx, MAX_ROW - 1, 0);
+    assert_window_matches(f->ctx, MAX_ROW - 1, MAX_COL - 1);
+    assert_window_matches(f->ctx, -1, 4);
+    assert_window_matches(f->ctx, 5, MAX_COL);
+}
+
+/* Exploding blocks are not hittable but still suppress their
+ * neighbours' faces — the window keeps the two bit sets apart. */
+static void test_window_matches_random_grids_with_explosions(void **state)
+{
+    fixture_t *f = *state;
+    srand(0x8b1);
+    for (int round = 0; round < 8; round++)
+    {
+        assert_int_equal(block_system_clear_all(f->ctx), BLOCK_SYS_OK);
+        for (int r = 0; r < MAX_ROW; r++)
+        {
+            for (int c = 0; c < MAX_COL; c++)
+            {
+                if (rand() % 2 == 0)
+                {
+                    assert_int_equal(block_system_add(f->ctx, r, c, RED_BLK, 0, 0),
+                                     BLOCK_SYS_OK);
+                    if (rand() % 4 == 0)
+                    {
+                        assert_int_equal(block_system_explode(f->ctx, r, c, 0), BLOCK_SYS_OK);
+                    }
+                }
+            }
+        }
+        assert_window_matches(f->ctx, rand() % MAX_ROW, rand() % MAX_COL);
+        assert_window_matches(f->ctx, rand() % MAX_ROW, rand() % MAX_COL);
+    }
+}
+
 int main(void)
 {
     const struct CMUnitTest tests[] = {
@@ -274,6 +387,14 @@ int main(void)
                                         teardown_fixture),
         cmocka_unit_test_setup_teardown(test_edge_of_grid_no_neighbour_above_for_row_zero,
                                         setup_isolated, teardown_fixture),
+        /* Group 6: cell windows */
+        cmocka_unit_test_setup_teardown(test_window_null_args, setup_seam, teardown_fixture),
+        cmocka_unit_test_setup_teardown(test_window_matches_seam_grid, setup_seam,
+                                        teardown_fixture),
+        cmocka_unit_test_setup_teardown(test_window_matches_grid_edges, setup_empty,
+                                        teardown_fixture),
+        cmocka_unit_test_setup_teardown(test_window_matches_random_grids_with_explosions,
+                                        setup_empty, teardown_fixture),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
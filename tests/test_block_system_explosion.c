@@ -25,7 +25,7 @@
 static block_system_t *make_ctx(void)
 {
     block_system_status_t st;
-    block_system_t *ctx = block_system_create(COL_WIDTH, ROW_HEIGHT, &st);
+    block_system_t *ctx = block_system_create(COL_WIDTH, ROW_HEIGHT, NULL, NULL, &st);
     assert_non_null(ctx);
     assert_int_equal(st, BLOCK_SYS_OK);
     return ctx;
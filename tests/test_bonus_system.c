@@ -102,8 +102,9 @@ static void on_save_triggered(void *ud)
     g_save_triggered = 1;
 }
 
-static void on_sound(const char *name, int volume, void *ud)
+static void on_sound(sound_id_t sound, int volume, void *ud)
 {
+    const char *name = sound_key(sound);
     (void)volume;
     (void)ud;
     g_sound_count++;
@@ -122,8 +122,10 @@ static int stub_query_cell(int row, int col, editor_cell_t *cell, void *ud)
     return cell->occupied;
 }
 
-static void stub_sound(const char *name, int volume, void *ud)
+static void stub_sound(sound_id_t sound, int volume, void *ud)
 {
+    const char *name = sound_key(sound);
+    assert_non_null(name);
     test_state_t *s = (test_state_t *)ud;
     (void)volume;
     snprintf(s->last_sound, sizeof(s->last_sound), "%s", name);
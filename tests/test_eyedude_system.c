@@ -51,8 +51,9 @@ static void on_score(unsigned long pts, void *ud)
     g_score_added += pts;
 }
 
-static void on_sound(const char *name, int volume, void *ud)
+static void on_sound(sound_id_t sound, int volume, void *ud)
 {
+    const char *name = sound_key(sound);
     (void)volume;
     (void)ud;
     g_sound_count++;
@@ -84,8 +85,9 @@ static eyedude_system_callbacks_t make_callbacks(void)
 static int g_rand_seq[16];
 static int g_rand_idx;
 
-static int test_rand(void)
+static int test_rand(void *user_data)
 {
+    (void)user_data;
     return g_rand_seq[g_rand_idx++ % 16];
 }
 
@@ -0,0 +1,322 @@
+/*
+ * test_game_replay.c — -record / -replay round trip through the full stack.
+ *
+ * Records a scripted session (mouse paddle, key presses, uneven tick
+ * counts per frame) with game_main.c's per-frame call order, then plays
+ * the file back in a fresh context seeded differently and checks that it
+ * ends in exactly the same state: RNG, score, level, paddle, tick count.
+ * The same holds when -turbo scrubs through the recording, many recorded
+ * frames per drawn frame.
+ *
+ * Requires: SDL_VIDEODRIVER=dummy, SDL_AUDIODRIVER=dummy
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+
+#include <SDL2/SDL.h>
+
+#include "game_context.h"
+#include "game_init.h"
+#include "game_input.h"
+#include "game_replay.h"
+#include "paddle_system.h"
+#include "score_system.h"
+#include "sdl2_input.h"
+#include "sdl2_loop.h"
+#include "sdl2_state.h"
+
+/* =========================================================================
+ * Helpers
+ * ========================================================================= */
+
+#define SESSION_FRAMES 1500
+
+static char arg_prog[] = "xboing_test";
+static char arg_record[] = "-record";
+static char arg_replay[] = "-replay";
+static char arg_fast[] = "-replay-fast";
+static char arg_speed[] = "-speed";
+static char arg_startlevel[] = "-startlevel";
+static char arg_load[] = "-load";
+static char arg_turbo[] = "-turbo";
+static char val_speed7[] = "7";
+static char val_speed2[] = "2";
+static char val_level3[] = "3";
+static char tmp_path[256];
+
+typedef struct
+{
+    rng_t rng;
+    unsigned long score;
+    int level;
+    int paddle_pos;
+    uint64_t ticks;
+    sdl2_state_mode_t mode;
+} end_state_t;
+
+static int setup_tmpfile(void **state)
+{
+    (void)state;
+    snprintf(tmp_path, sizeof(tmp_path), "/tmp/test_game_replay_%d.xbr", (int)getpid());
+    return 0;
+}
+
+static int teardown_tmpfile(void **state)
+{
+    (void)state;
+    unlink(tmp_path);
+    return 0;
+}
+
+static void send_key(game_ctx_t *ctx, SDL_Scancode sc, bool down)
+{
+    SDL_Event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+    ev.key.keysym.scancode = sc;
+    sdl2_input_process_event(ctx->input, &ev);
+}
+
+static void send_mouse(game_ctx_t *ctx, int x, int y)
+{
+    SDL_Event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.type = SDL_MOUSEMOTION;
+    ev.motion.x = x;
+    ev.motion.y = y;
+    sdl2_input_process_event(ctx->input, &ev);
+}
+
+/* Live input for frame f: start a game, sweep the mouse, fire now and then. */
+static void script_frame(game_ctx_t *ctx, int f)
+{
+    if (f == 11 || f == 501 || f == 506)
+        send_key(ctx, SDL_SCANCODE_SPACE, true);
+    if (f == 12 || f == 502 || f == 507)
+        send_key(ctx, SDL_SCANCODE_SPACE, false);
+    if (f > 510 && f % 97 == 0)
+        send_key(ctx, SDL_SCANCODE_K, true);
+    if (f > 510 && f % 97 == 1)
+        send_key(ctx, SDL_SCANCODE_K, false);
+    send_mouse(ctx, 60 + (f * 7) % 400, 300);
+}
+
+/* Uneven tick counts, including empty frames, as a real frame loop sees.
+ * Key presses above avoid the empty frames: an edge on a frame that runs
+ * no ticks is never seen by the per-tick mode handlers. */
+static int script_ticks(int f)
+{
+    return (f % 5 == 0) ? 0 : (f % 7 == 0) ? 3 : 1;
+}
+
+static void capture_end(game_ctx_t *ctx, end_state_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->rng = ctx->rng;
+    out->score = score_system_get(ctx->score);
+    out->level = ctx->level_number;
+    out->paddle_pos = paddle_system_get_pos(ctx->paddle);
+    out->ticks = sdl2_loop_total_ticks(ctx->loop);
+    out->mode = sdl2_state_current(ctx->state);
+}
+
+/* One game_main.c frame with the live input supplied by script_frame. */
+static void record_frame(game_ctx_t *ctx, int f)
+{
+    sdl2_input_begin_frame(ctx->input);
+    script_frame(ctx, f);
+    assert_int_equal(game_replay_frame_input(ctx), GAME_REPLAY_LIVE);
+    game_input_global(ctx);
+    int ticks = sdl2_loop_step(ctx->loop, script_ticks(f), false);
+    game_replay_frame_done(ctx, ticks);
+}
+
+static void record_session(char *argv[], int argc, end_state_t *out)
+{
+    srand(42);
+    game_ctx_t *ctx = game_create(argc, argv);
+    assert_non_null(ctx);
+    sdl2_state_transition(ctx->state, SDL2ST_PRESENTS);
+
+    for (int f = 0; f < SESSION_FRAMES; f++)
+        record_frame(ctx, f);
+
+    capture_end(ctx, out);
+    game_destroy(ctx);
+}
+
+/* =========================================================================
+ * Tests
+ * ========================================================================= */
+
+static void test_replay_reproduces_session(void **state)
+{
+    (void)state;
+    char *rec_argv[] = {arg_prog, arg_record, tmp_path, NULL};
+    end_state_t recorded;
+    record_session(rec_argv, 3, &recorded);
+    assert_int_equal(recorded.mode, SDL2ST_GAME);
+
+    /* Different process seed: only the recording may decide the outcome. */
+    srand(9999);
+    char *play_argv[] = {arg_prog, arg_replay, tmp_path, arg_fast, NULL};
+    game_ctx_t *ctx = game_create(4, play_argv);
+    assert_non_null(ctx);
+    assert_true(game_replay_playing(ctx));
+    assert_true(game_replay_fast(ctx));
+    sdl2_state_transition(ctx->state, SDL2ST_PRESENTS);
+
+    int frames = 0;
+    for (;;)
+    {
+        sdl2_input_begin_frame(ctx->input);
+        int ticks = game_replay_frame_input(ctx);
+        if (game_replay_finished(ctx))
+            break;
+        assert_true(ticks >= 0);
+        game_input_global(ctx);
+        game_replay_frame_done(ctx, sdl2_loop_step(ctx->loop, ticks, false));
+        frames++;
+    }
+    assert_int_equal(frames, SESSION_FRAMES);
+    assert_false(game_replay_playing(ctx));
+
+    end_state_t replayed;
+    capture_end(ctx, &replayed);
+    assert_int_equal(replayed.rng.state, recorded.rng.state);
+    assert_int_equal(replayed.rng.inc, recorded.rng.inc);
+    assert_int_equal(replayed.score, recorded.score);
+    assert_int_equal(replayed.level, recorded.level);
+    assert_int_equal(replayed.paddle_pos, recorded.paddle_pos);
+    assert_int_equal(replayed.ticks, recorded.ticks);
+    assert_int_equal(replayed.mode, recorded.mode);
+
+    game_destroy(ctx);
+}
+
+/* game_main.c's replay_scrub: recorded frames back to back until the
+ * turbo budget is spent, then one render.  Returns frames played. */
+static int scrub_frame(game_ctx_t *ctx, int ticks)
+{
+    int frames = 0;
+    sdl2_loop_turbo_begin(ctx->loop);
+    for (;;)
+    {
+        game_replay_frame_done(ctx, sdl2_loop_step(ctx->loop, ticks, false));
+        frames++;
+        if (!sdl2_loop_turbo_budget_left(ctx->loop))
+            break;
+        sdl2_input_begin_frame(ctx->input);
+        ticks = game_replay_frame_input(ctx);
+        if (ticks == GAME_REPLAY_LIVE)
+            break;
+        game_input_global(ctx);
+    }
+    sdl2_loop_step(ctx->loop, 0, true);
+    return frames;
+}
+
+static void test_turbo_scrub_matches_recording(void **state)
+{
+    (void)state;
+    char *rec_argv[] = {arg_prog, arg_record, tmp_path, NULL};
+    end_state_t recorded;
+    record_session(rec_argv, 3, &recorded);
+
+    srand(31337);
+    char *play_argv[] = {arg_prog, arg_replay, tmp_path, arg_turbo, NULL};
+    game_ctx_t *ctx = game_create(4, play_argv);
+    assert_non_null(ctx);
+    assert_true(sdl2_loop_is_turbo(ctx->loop));
+    assert_false(game_replay_fast(ctx));
+    sdl2_state_transition(ctx->state, SDL2ST_PRESENTS);
+
+    int frames = 0;
+    int drawn = 0;
+    while (game_replay_playing(ctx))
+    {
+        sdl2_input_begin_frame(ctx->input);
+        int ticks = game_replay_frame_input(ctx);
+        if (ticks == GAME_REPLAY_LIVE)
+            break;
+        game_input_global(ctx);
+        frames += scrub_frame(ctx, ticks);
+        drawn++;
+    }
+    assert_int_equal(frames, SESSION_FRAMES);
+    assert_true(drawn < frames);
+
+    end_state_t replayed;
+    capture_end(ctx, &replayed);
+    assert_int_equal(replayed.rng.state, recorded.rng.state);
+    assert_int_equal(replayed.score, recorded.score);
+    assert_int_equal(replayed.level, recorded.level);
+    assert_int_equal(replayed.paddle_pos, recorded.paddle_pos);
+    assert_int_equal(replayed.ticks, recorded.ticks);
+    assert_int_equal(replayed.mode, recorded.mode);
+
+    game_destroy(ctx);
+}
+
+static void test_replay_header_overrides_cli(void **state)
+{
+    (void)state;
+    char *rec_argv[] = {arg_prog, arg_record, tmp_path, arg_speed, val_speed7, arg_startlevel,
+                        val_level3, NULL};
+    srand(7);
+    game_ctx_t *ctx = game_create(7, rec_argv);
+    assert_non_null(ctx);
+    uint64_t seed = ctx->rng_seed;
+    game_destroy(ctx);
+
+    char *play_argv[] = {arg_prog, arg_replay, tmp_path, arg_speed, val_speed2, NULL};
+    ctx = game_create(5, play_argv);
+    assert_non_null(ctx);
+    assert_int_equal(ctx->config.speed, 7);
+    assert_int_equal(sdl2_loop_get_speed(ctx->loop), 7);
+    assert_int_equal(ctx->config.start_level, 3);
+    assert_int_equal(ctx->level_number, 3);
+    assert_int_equal(ctx->rng_seed, seed);
+    assert_false(game_replay_fast(ctx));
+    game_destroy(ctx);
+}
+
+static void test_replay_missing_file_fails(void **state)
+{
+    (void)state;
+    char missing[] = "/nonexistent/dir/none.xbr";
+    char *argv[] = {arg_prog, arg_replay, missing, NULL};
+    assert_null(game_create(3, argv));
+}
+
+static void test_load_with_record_rejected(void **state)
+{
+    (void)state;
+    char *argv[] = {arg_prog, arg_record, tmp_path, arg_load, NULL};
+    assert_null(game_create(4, argv));
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup_teardown(test_replay_reproduces_session, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_turbo_scrub_matches_recording, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_replay_header_overrides_cli, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test(test_replay_missing_file_fails),
+        cmocka_unit_test_setup_teardown(test_load_with_record_rejected, setup_tmpfile,
+                                        teardown_tmpfile),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
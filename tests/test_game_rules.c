@@ -27,10 +27,14 @@
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 #include <cmocka.h>
 
+#include "asset_pack.h"
 #include "ball_system.h"
 #include "ball_types.h"
 #include "block_system.h"
@@ -38,8 +42,10 @@
 #include "game_context.h"
 #include "game_init.h"
 #include "game_rules.h"
+#include "level_system.h"
 #include "message_system.h"
 #include "paddle_system.h"
+#include "rng.h"
 #include "sdl2_audio.h"
 #include "sdl2_input.h"
 #include "sdl2_state.h"
@@ -301,7 +307,7 @@ static void test_check_real_game_clears_board_reaches_bonus(void **vstate)
  * elapse -- and place a second special block -- while the previous one
  * was still on the grid, unhit.  These tests drive game_rules_check
  * indirectly through sdl2_state_update (mode_game_update calls it once
- * per tick) with a fixed rand() seed for reproducibility.
+ * per tick) with a fixed ctx->rng seed for reproducibility.
  *
  * ctx->play_test_active=true is used purely as a test seam here: it
  * suppresses game_rules_check's level-complete/bonus transition
@@ -369,7 +375,7 @@ static void test_spawn_throttle_one_at_a_time(void **vstate)
     fixture_t *f = (fixture_t *)*vstate;
     game_ctx_t *ctx = f->ctx;
 
-    srand(12345u);
+    rng_seed(&ctx->rng, 12345u);
     ctx->play_test_active = true;
     block_system_clear_all(ctx->block);
     assert_int_equal(throttle_count_occupied(ctx->block), 0);
@@ -399,7 +405,7 @@ static void test_spawn_throttle_one_at_a_time(void **vstate)
          * stay at the sentinel 0 (src/game_rules.c:100). A mutant that
          * drops the `&& !ctx->bonus_block_active` term reschedules on
          * the very next tick after a placement -- deterministically,
-         * regardless of the rand() stream -- so this catches it here
+         * regardless of the ctx->rng stream -- so this catches it here
          * even though max_concurrent<=1 alone does not. */
         if (ctx->bonus_block_active)
             assert_int_equal(ctx->next_bonus_frame, 0);
@@ -420,7 +426,7 @@ static void test_spawn_throttle_expires_and_rearms(void **vstate)
     fixture_t *f = (fixture_t *)*vstate;
     game_ctx_t *ctx = f->ctx;
 
-    srand(777u);
+    rng_seed(&ctx->rng, 777u);
     ctx->play_test_active = true;
     block_system_clear_all(ctx->block);
 
@@ -488,7 +494,7 @@ static void test_spawn_throttle_no_reschedule_while_active(void **vstate)
     fixture_t *f = (fixture_t *)*vstate;
     game_ctx_t *ctx = f->ctx;
 
-    srand(42u);
+    rng_seed(&ctx->rng, 42u);
     ctx->play_test_active = true;
     block_system_clear_all(ctx->block);
 
@@ -674,9 +680,9 @@ static void test_skip_level_drives_level_to_completion(void **vstate)
  * "bomb"@50 is reserved for a real BOMB_BLK hit via PlaySoundForBlock
  * (original/blocks.c:771-772).
  *
- * There is no seam to force roll==25 directly, so this brute-forces an
- * rand() seed at test time: for a given seed, rand()/srand() is fully
- * deterministic (same libc, same call sequence every run -- not flaky),
+ * There is no seam to force roll==25 directly, so this brute-forces a
+ * ctx->rng seed at test time: for a given seed, rng_seed()/rng_next() is
+ * fully deterministic (same call sequence every run -- not flaky),
  * so trying seeds 1..500 in order and stopping at the first one that
  * lands on dynamite is itself a deterministic, repeatable sequence.
  * Detection: seed seven blocks, one of each color in try_spawn_bonus's
@@ -697,7 +703,7 @@ static void test_skip_level_drives_level_to_completion(void **vstate)
  * dynamite/non-dynamite outcome for this seed is observable after one
  * tick instead of up to THROTTLE_BONUS_SEED*2 (4000).  This skips only
  * the schedule-and-wait bookkeeping, not the roll itself: find_random_empty_cell
- * and `rand() % 27` still execute for real off the seeded rand() stream,
+ * and `rng_next() % 27` still execute for real off the seeded ctx->rng,
  * so this is still a genuine per-seed roll, not a stubbed one.
  * ========================================================================= */
 
@@ -752,7 +758,7 @@ static void test_dynamite_spawn_silent_no_bomb_sfx(void **vstate)
         seed_dynamite_targets(ctx);
         ctx->bonus_block_active = false;
         sdl2_audio_log_clear(ctx->audio);
-        srand(seed);
+        rng_seed(&ctx->rng, seed);
 
         /* Force the roll to happen on the very next tick instead of
          * waiting out the BONUS_SEED schedule interval -- see the
@@ -781,6 +787,73 @@ static void test_dynamite_spawn_silent_no_bomb_sfx(void **vstate)
     }
 }
 
+/* =========================================================================
+ * Level loading from the asset pack (ADR-098)
+ *
+ * game_rules_load_level() reads "levels/<file>" from ctx->assets when the
+ * pack has it, falls back to the loose files when it does not, and
+ * ignores the pack under XBOING_LEVELS_DIR.
+ * ========================================================================= */
+
+/* levels/level02.data ("Genesis II") under another title. */
+static size_t read_retitled_level(char *buf, size_t bufsize)
+{
+    FILE *fp = fopen("levels/level02.data", "r");
+    assert_non_null(fp);
+    char line[256];
+    assert_non_null(fgets(line, sizeof(line), fp));
+    size_t n = (size_t)snprintf(buf, bufsize, "Packed level\n");
+    n += fread(buf + n, 1, bufsize - n, fp);
+    fclose(fp);
+    assert_true(n < bufsize);
+    return n;
+}
+
+static void test_load_level_prefers_pack(void **vstate)
+{
+    fixture_t *f = (fixture_t *)*vstate;
+    game_ctx_t *ctx = f->ctx;
+
+    char level[4096];
+    size_t level_size = read_retitled_level(level, sizeof(level));
+
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_non_null(w);
+    asset_pack_entry_t e = {"levels/level02.data", level, level_size, ASSET_PACK_RAW, {0, 0, 0}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/test_game_rules_%d.pak", (int)getpid());
+    assert_int_equal(asset_pack_writer_save(w, path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+
+    asset_pack_close(ctx->assets);
+    ctx->assets = asset_pack_open(path, NULL);
+    assert_non_null(ctx->assets);
+    char saved_levels_dir[sizeof(ctx->paths.xboing_levels_dir)];
+    memcpy(saved_levels_dir, ctx->paths.xboing_levels_dir, sizeof(saved_levels_dir));
+    ctx->paths.xboing_levels_dir[0] = '\0';
+
+    assert_true(game_rules_level_available(ctx, "level02.data"));
+    assert_int_equal(game_rules_load_level(ctx, "level02.data"), LEVEL_SYS_OK);
+    assert_string_equal(level_system_get_title(ctx->level), "Packed level");
+
+    /* Not in the pack: the loose file. */
+    assert_int_equal(game_rules_load_level(ctx, "level03.data"), LEVEL_SYS_OK);
+    assert_string_equal(level_system_get_title(ctx->level), "Make my day!");
+    assert_false(game_rules_level_available(ctx, "level99.data"));
+    assert_int_equal(game_rules_load_level(ctx, "level99.data"), LEVEL_SYS_ERR_FILE_NOT_FOUND);
+
+    /* XBOING_LEVELS_DIR: the loose file, even though the pack has it. */
+    snprintf(ctx->paths.xboing_levels_dir, sizeof(ctx->paths.xboing_levels_dir), "levels");
+    assert_int_equal(game_rules_load_level(ctx, "level02.data"), LEVEL_SYS_OK);
+    assert_string_equal(level_system_get_title(ctx->level), "Genesis II");
+
+    memcpy(ctx->paths.xboing_levels_dir, saved_levels_dir, sizeof(saved_levels_dir));
+    asset_pack_close(ctx->assets);
+    ctx->assets = NULL;
+    unlink(path);
+}
+
 /* =========================================================================
  * Main
  * ========================================================================= */
@@ -824,6 +897,9 @@ int main(void)
 
         /* Silent dynamite bomb (mission m-2026-07-17-014) */
         cmocka_unit_test_setup_teardown(test_dynamite_spawn_silent_no_bomb_sfx, setup, teardown),
+
+        /* Level loading from the asset pack (ADR-098) */
+        cmocka_unit_test_setup_teardown(test_load_level_prefers_pack, setup, teardown),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -15,7 +15,8 @@
  *   1. Run with GOLDEN_GENERATE defined
  *   2. Copy the printed table into the golden[] array
  *
- * Requires: SDL_VIDEODRIVER=dummy, SDL_AUDIODRIVER=dummy
+ * Renders offscreen (-offscreen, ADR-094), so no display is needed.
+ * Requires: SDL_AUDIODRIVER=dummy
  */
 
 #include <setjmp.h>
@@ -49,6 +50,7 @@ typedef struct
  * ========================================================================= */
 
 static char arg_prog[] = "xboing_test";
+static char arg_offscreen[] = "-offscreen";
 
 /* =========================================================================
  * Helper: run attract cycle and collect transitions
@@ -56,8 +58,8 @@ static char arg_prog[] = "xboing_test";
 
 static int collect_attract_transitions(golden_entry_t *log, int max_entries, int tick_count)
 {
-    char *argv[] = {arg_prog, NULL};
-    game_ctx_t *ctx = game_create(1, argv);
+    char *argv[] = {arg_prog, arg_offscreen, NULL};
+    game_ctx_t *ctx = game_create(2, argv);
     if (!ctx)
         return -1;
 
@@ -132,8 +132,10 @@ static void stub_on_eyedude_hit(void *ud)
     s->eyedude_hit_count++;
 }
 
-static void stub_on_sound(const char *name, int volume, void *ud)
+static void stub_on_sound(sound_id_t sound, int volume, void *ud)
 {
+    const char *name = sound_key(sound);
+    assert_non_null(name);
     (void)volume;
     stub_state_t *s = ud;
     s->sound_count++;
@@ -17,6 +17,7 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /* CMocka must come after setjmp.h */
@@ -491,6 +492,67 @@ static void test_load_no_callback_safe(void **state)
     level_system_destroy(ctx);
 }
 
+/* Loading the file's bytes from memory gives the same level as the file. */
+static void test_load_memory_matches_file(void **state)
+{
+    (void)state;
+    char path[512];
+    make_level_path(path, (int)sizeof(path), 3);
+
+    stub_state_t from_file;
+    level_system_t *ctx = create_test_ctx(&from_file);
+    assert_int_equal(level_system_load_file(ctx, path), LEVEL_SYS_OK);
+    level_system_destroy(ctx);
+
+    FILE *fp = fopen(path, "rb");
+    assert_non_null(fp);
+    char text[4096];
+    size_t len = fread(text, 1, sizeof(text), fp);
+    fclose(fp);
+
+    /* An exact-size heap copy: a read past the end shows up under ASan. */
+    char *copy = malloc(len);
+    assert_non_null(copy);
+    memcpy(copy, text, len);
+
+    stub_state_t from_memory;
+    ctx = create_test_ctx(&from_memory);
+    assert_int_equal(level_system_load_memory(ctx, copy, len), LEVEL_SYS_OK);
+    assert_string_equal(level_system_get_title(ctx), "Make my day!");
+    assert_int_equal(from_memory.add_block_count, from_file.add_block_count);
+    assert_memory_equal(from_memory.grid_types, from_file.grid_types,
+                        sizeof(from_file.grid_types));
+    assert_memory_equal(from_memory.grid_slides, from_file.grid_slides,
+                        sizeof(from_file.grid_slides));
+    level_system_destroy(ctx);
+    free(copy);
+}
+
+/* The final row may end the buffer without a newline. */
+static void test_load_memory_unterminated(void **state)
+{
+    (void)state;
+    char text[2 + 4 + LEVEL_GRID_ROWS * (LEVEL_GRID_COLS + 1)];
+    int n = snprintf(text, sizeof(text), "T\n60\n");
+    for (int r = 0; r < LEVEL_GRID_ROWS; r++)
+    {
+        memcpy(text + n, "r........\n", LEVEL_GRID_COLS + 1);
+        n += LEVEL_GRID_COLS + 1;
+    }
+
+    stub_state_t s;
+    level_system_t *ctx = create_test_ctx(&s);
+    assert_int_equal(level_system_load_memory(ctx, text, (size_t)n - 1), LEVEL_SYS_OK);
+    assert_string_equal(level_system_get_title(ctx), "T");
+    assert_int_equal(level_system_get_time_bonus(ctx), 60);
+    assert_int_equal(s.add_block_count, LEVEL_GRID_ROWS);
+
+    /* One cell short of the grid is a parse failure. */
+    assert_int_equal(level_system_load_memory(ctx, text, (size_t)n - 2),
+                     LEVEL_SYS_ERR_PARSE_FAILED);
+    level_system_destroy(ctx);
+}
+
 /* =========================================================================
  * Group 5: Background cycling
  * ========================================================================= */
@@ -570,6 +632,10 @@ static void test_load_null_args(void **state)
 
     assert_int_equal(level_system_load_file(NULL, "/some/path"), LEVEL_SYS_ERR_NULL_ARG);
     assert_int_equal(level_system_load_file(ctx, NULL), LEVEL_SYS_ERR_NULL_ARG);
+    assert_int_equal(level_system_load_memory(NULL, "x", 1), LEVEL_SYS_ERR_NULL_ARG);
+    assert_int_equal(level_system_load_memory(ctx, NULL, 1), LEVEL_SYS_ERR_NULL_ARG);
+    assert_int_equal(level_system_load_memory(ctx, NULL, 0), LEVEL_SYS_ERR_PARSE_FAILED);
+    assert_int_equal(level_system_load_memory(ctx, "Title\n", 6), LEVEL_SYS_ERR_PARSE_FAILED);
 
     level_system_destroy(ctx);
 }
@@ -614,6 +680,8 @@ int main(void)
         cmocka_unit_test(test_load_level03_mixed),
         cmocka_unit_test(test_load_level80_boundary),
         cmocka_unit_test(test_load_no_callback_safe),
+        cmocka_unit_test(test_load_memory_matches_file),
+        cmocka_unit_test(test_load_memory_unterminated),
 
         /* Group 5: Background cycling */
         cmocka_unit_test(test_background_initial),
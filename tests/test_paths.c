@@ -1132,6 +1132,47 @@ static void test_install_prefix_truncated_propagates(void **state)
     rmdir(xdg_home);
 }
 
+/* TC-56: paths_install_data_file — finds a file directly under
+ *         <XDG_DATA_DIRS>/xboing/, misses once it is gone, and rejects NULL
+ *         args.  install_data_dir is zeroed so the compiled prefix cannot
+ *         satisfy the lookup. */
+static void test_install_data_file(void **state)
+{
+    (void)state;
+    char root[64];
+    assert_int_equal(make_temp_tree(root, sizeof(root), "xboing/levels"), 0);
+
+    char file[256];
+    snprintf(file, sizeof(file), "%s/xboing/xboing.pak", root);
+    FILE *fp = fopen(file, "w");
+    assert_non_null(fp);
+    fclose(fp);
+
+    paths_config_t cfg;
+    paths_init_explicit(&cfg, "/home/test", NULL, NULL, root, NULL, NULL, NULL);
+    cfg.install_data_dir[0] = '\0';
+
+    char buf[PATHS_MAX_PATH];
+    assert_int_equal(paths_install_data_file(&cfg, "xboing.pak", buf, sizeof(buf)), PATHS_OK);
+    assert_string_equal(buf, file);
+
+    char small[4];
+    assert_int_equal(paths_install_data_file(&cfg, "xboing.pak", small, sizeof(small)),
+                     PATHS_TRUNCATED);
+
+    unlink(file);
+    assert_int_equal(paths_install_data_file(&cfg, "xboing.pak", buf, sizeof(buf)),
+                     PATHS_NOT_FOUND);
+
+    assert_int_equal(paths_install_data_file(NULL, "xboing.pak", buf, sizeof(buf)),
+                     PATHS_NOT_FOUND);
+    assert_int_equal(paths_install_data_file(&cfg, NULL, buf, sizeof(buf)), PATHS_NOT_FOUND);
+    assert_int_equal(paths_install_data_file(&cfg, "xboing.pak", NULL, sizeof(buf)),
+                     PATHS_NOT_FOUND);
+
+    remove_temp_tree(root, "xboing/levels");
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -1182,6 +1223,7 @@ int main(void)
         cmocka_unit_test(test_install_data_dir_not_found),
         cmocka_unit_test(test_install_data_dir_truncated),
         cmocka_unit_test(test_install_data_dir_null_args),
+        cmocka_unit_test(test_install_data_file),
         cmocka_unit_test(test_levels_dir_readable_env_override),
         cmocka_unit_test(test_levels_dir_readable_install_fallback),
         cmocka_unit_test(test_levels_dir_readable_cwd_fallback),
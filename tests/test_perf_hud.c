@@ -0,0 +1,258 @@
+/*
+ * test_perf_hud.c — CMocka tests for the performance HUD's numbers.
+ *
+ * Pure logic tests — no SDL2 needed.  A fake nanosecond clock drives the
+ * trace statistics that supply the per-zone costs.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* cmocka.h must come after the setjmp/stdarg/stddef includes. */
+#include <cmocka.h>
+
+#include "perf_hud.h"
+
+/* =========================================================================
+ * Fake clock and helpers
+ * ========================================================================= */
+
+static uint64_t fake_ns;
+
+static uint64_t fake_clock(void)
+{
+    return fake_ns;
+}
+
+static int reset_fake_clock(void **state)
+{
+    (void)state;
+    fake_ns = 1000000U;
+    return 0;
+}
+
+static perf_hud_t *create_hud(void)
+{
+    perf_hud_status_t st = PERF_HUD_ERR_NULL_ARG;
+    perf_hud_t *hud = perf_hud_create(fake_clock, &st);
+    assert_non_null(hud);
+    assert_int_equal(st, PERF_HUD_OK);
+    return hud;
+}
+
+/* A zone lasting us microseconds of fake time. */
+static void fake_zone(const char *name, uint64_t us)
+{
+    const uint64_t t0 = trace_zone_begin();
+    fake_ns += us * 1000U;
+    trace_zone_end(name, t0);
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle and visibility
+ * ========================================================================= */
+
+/* TC-01: Create requires a clock; NULL is safe everywhere. */
+static void test_create_and_null(void **state)
+{
+    (void)state;
+    perf_hud_status_t st = PERF_HUD_OK;
+    assert_null(perf_hud_create(NULL, &st));
+    assert_int_equal(st, PERF_HUD_ERR_NULL_ARG);
+    assert_null(perf_hud_create(NULL, NULL));
+
+    perf_hud_destroy(NULL);
+    perf_hud_set_visible(NULL, true);
+    perf_hud_add_draws(NULL, 1, 1);
+    perf_hud_end_frame(NULL, 1000, 1);
+    assert_false(perf_hud_is_visible(NULL));
+
+    perf_hud_summary_t s;
+    memset(&s, 0xff, sizeof(s));
+    perf_hud_get_summary(NULL, &s);
+    assert_int_equal(s.frames, 0);
+    uint32_t hist[4];
+    assert_int_equal(perf_hud_history(NULL, hist, 4), 0);
+}
+
+/* TC-02: Starts hidden; showing turns the zones on, hiding turns them off. */
+static void test_visibility_drives_zones(void **state)
+{
+    (void)state;
+    perf_hud_t *hud = create_hud();
+    assert_false(perf_hud_is_visible(hud));
+    assert_int_equal(trace_zone_begin(), 0);
+
+    perf_hud_set_visible(hud, true);
+    assert_true(perf_hud_is_visible(hud));
+    assert_int_not_equal(trace_zone_begin(), 0);
+
+    perf_hud_set_visible(hud, false);
+    assert_false(perf_hud_is_visible(hud));
+    assert_int_equal(trace_zone_begin(), 0);
+    perf_hud_destroy(hud);
+}
+
+/* TC-03: Frames and draws are ignored while hidden. */
+static void test_hidden_ignores_frames(void **state)
+{
+    (void)state;
+    perf_hud_t *hud = create_hud();
+    perf_hud_add_draws(hud, 10, 5);
+    perf_hud_end_frame(hud, PERF_HUD_WINDOW_US, 1);
+
+    uint32_t hist[4];
+    assert_int_equal(perf_hud_history(hud, hist, 4), 0);
+    perf_hud_summary_t s;
+    perf_hud_get_summary(hud, &s);
+    assert_int_equal(s.frames, 0);
+    perf_hud_destroy(hud);
+}
+
+/* =========================================================================
+ * Group 2: Summary
+ * ========================================================================= */
+
+/* TC-04: A full window yields FPS, frame times, ticks and draw means. */
+static void test_window_summary(void **state)
+{
+    (void)state;
+    perf_hud_t *hud = create_hud();
+    perf_hud_set_visible(hud, true);
+
+    /* 29 frames of 16 ms and one of 36 ms: exactly 500 ms. */
+    for (int i = 0; i < 30; i++)
+    {
+        perf_hud_add_draws(hud, 100, 20);
+        perf_hud_end_frame(hud, i == 29 ? 36000 : 16000, i % 2 == 0 ? 2 : 1);
+        if (i < 29)
+        {
+            perf_hud_summary_t partial;
+            perf_hud_get_summary(hud, &partial);
+            assert_int_equal(partial.frames, 0);
+        }
+    }
+
+    perf_hud_summary_t s;
+    perf_hud_get_summary(hud, &s);
+    assert_int_equal(s.frames, 30);
+    assert_true(s.fps > 59.99 && s.fps < 60.01);
+    assert_true(s.frame_ms_mean > 16.66 && s.frame_ms_mean < 16.67);
+    assert_true(s.frame_ms_max > 35.99 && s.frame_ms_max < 36.01);
+    assert_true(s.ticks_per_frame > 1.49 && s.ticks_per_frame < 1.51);
+    assert_int_equal(s.ticks_max, 2);
+    assert_true(s.draw_calls > 99.9 && s.draw_calls < 100.1);
+    assert_true(s.texture_switches > 19.9 && s.texture_switches < 20.1);
+    perf_hud_destroy(hud);
+}
+
+/* TC-05: Zone costs are per frame, heaviest first, capped at the maximum. */
+static void test_window_zones(void **state)
+{
+    (void)state;
+    perf_hud_t *hud = create_hud();
+    perf_hud_set_visible(hud, true);
+
+    static const char *names[] = {"a", "b", "c", "d", "e", "f", "g"};
+    for (int frame = 0; frame < 2; frame++)
+    {
+        for (int z = 0; z < 7; z++)
+        {
+            fake_zone(names[z], 100U * (uint64_t)(z + 1));
+        }
+        perf_hud_end_frame(hud, PERF_HUD_WINDOW_US / 2, 1);
+    }
+
+    perf_hud_summary_t s;
+    perf_hud_get_summary(hud, &s);
+    assert_int_equal(s.zone_count, PERF_HUD_MAX_ZONES);
+    assert_string_equal(s.zones[0].name, "g");
+    assert_true(s.zones[0].ms_per_frame > 0.699 && s.zones[0].ms_per_frame < 0.701);
+    assert_string_equal(s.zones[4].name, "c");
+    perf_hud_destroy(hud);
+}
+
+/* TC-06: Showing again starts from a clean summary. */
+static void test_show_resets(void **state)
+{
+    (void)state;
+    perf_hud_t *hud = create_hud();
+    perf_hud_set_visible(hud, true);
+    perf_hud_end_frame(hud, PERF_HUD_WINDOW_US, 1);
+    perf_hud_set_visible(hud, false);
+    perf_hud_set_visible(hud, true);
+
+    perf_hud_summary_t s;
+    perf_hud_get_summary(hud, &s);
+    assert_int_equal(s.frames, 0);
+    uint32_t hist[4];
+    assert_int_equal(perf_hud_history(hud, hist, 4), 0);
+    perf_hud_destroy(hud);
+}
+
+/* =========================================================================
+ * Group 3: History
+ * ========================================================================= */
+
+/* TC-07: The history keeps the newest frames, oldest first. */
+static void test_history_ring(void **state)
+{
+    (void)state;
+    perf_hud_t *hud = create_hud();
+    perf_hud_set_visible(hud, true);
+    for (uint32_t i = 1; i <= PERF_HUD_HISTORY + 10; i++)
+    {
+        perf_hud_end_frame(hud, i, 0);
+    }
+
+    uint32_t hist[PERF_HUD_HISTORY];
+    assert_int_equal(perf_hud_history(hud, hist, PERF_HUD_HISTORY), PERF_HUD_HISTORY);
+    assert_int_equal(hist[0], 11);
+    assert_int_equal(hist[PERF_HUD_HISTORY - 1], PERF_HUD_HISTORY + 10);
+
+    assert_int_equal(perf_hud_history(hud, hist, 3), 3);
+    assert_int_equal(hist[0], PERF_HUD_HISTORY + 8);
+    assert_int_equal(hist[2], PERF_HUD_HISTORY + 10);
+    perf_hud_destroy(hud);
+}
+
+/* =========================================================================
+ * Group 4: Status strings
+ * ========================================================================= */
+
+/* TC-08: Every status has a string. */
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(perf_hud_status_string(PERF_HUD_OK), "OK");
+    assert_string_equal(perf_hud_status_string(PERF_HUD_ERR_NULL_ARG), "NULL argument");
+    assert_string_equal(perf_hud_status_string(PERF_HUD_ERR_ALLOC_FAILED), "allocation failed");
+    assert_string_equal(perf_hud_status_string((perf_hud_status_t)99), "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle and visibility */
+        cmocka_unit_test_setup(test_create_and_null, reset_fake_clock),
+        cmocka_unit_test_setup(test_visibility_drives_zones, reset_fake_clock),
+        cmocka_unit_test_setup(test_hidden_ignores_frames, reset_fake_clock),
+        /* Group 2: Summary */
+        cmocka_unit_test_setup(test_window_summary, reset_fake_clock),
+        cmocka_unit_test_setup(test_window_zones, reset_fake_clock),
+        cmocka_unit_test_setup(test_show_resets, reset_fake_clock),
+        /* Group 3: History */
+        cmocka_unit_test_setup(test_history_ring, reset_fake_clock),
+        /* Group 4: Status strings */
+        cmocka_unit_test_setup(test_status_strings, reset_fake_clock),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -57,6 +57,7 @@ static const SDL_Scancode action_scancodes[SDL2I_ACTION_COUNT] = {
     [SDL2I_SPEED_7] = SDL_SCANCODE_7,
     [SDL2I_SPEED_8] = SDL_SCANCODE_8,
     [SDL2I_SPEED_9] = SDL_SCANCODE_9,
+    [SDL2I_TOGGLE_HUD] = SDL_SCANCODE_F3,
 };
 
 SDL_Scancode replay_action_to_scancode(sdl2_input_action_t action)
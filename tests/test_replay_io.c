@@ -0,0 +1,444 @@
+/*
+ * test_replay_io.c — Tests for the binary replay recording format.
+ *
+ * 4 groups:
+ *   1. Round-trip (4 tests)
+ *   2. Compactness (2 tests)
+ *   3. Error handling (5 tests)
+ *   4. Null safety (1 test)
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* cmocka must come after setjmp.h / stdarg.h / stddef.h */
+#include <cmocka.h>
+
+#include "replay_io.h"
+#include "sdl2_loop.h"
+
+/* =========================================================================
+ * Test helpers
+ * ========================================================================= */
+
+static char tmp_path[256];
+
+static int setup_tmpfile(void **state)
+{
+    (void)state;
+    snprintf(tmp_path, sizeof(tmp_path), "/tmp/xboing_test_rp_XXXXXX");
+    int fd = mkstemp(tmp_path);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    close(fd);
+    return 0;
+}
+
+static int teardown_tmpfile(void **state)
+{
+    (void)state;
+    (void)remove(tmp_path);
+    return 0;
+}
+
+static replay_header_t make_header(void)
+{
+    replay_header_t h;
+    memset(&h, 0, sizeof(h));
+    h.seed = 0x0123456789abcdefULL;
+    h.speed = 7;
+    h.start_level = 42;
+    h.use_keys = true;
+    h.sfx = true;
+    h.debug = false;
+    return h;
+}
+
+static long file_size(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    assert_non_null(fp);
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fclose(fp);
+    return size;
+}
+
+static void assert_frame_equal(const replay_frame_t *a, const replay_frame_t *b)
+{
+    assert_int_equal(a->ticks, b->ticks);
+    assert_int_equal(a->held, b->held);
+    assert_int_equal(a->edge, b->edge);
+    assert_int_equal(a->mouse_x, b->mouse_x);
+    assert_int_equal(a->mouse_y, b->mouse_y);
+    assert_int_equal(a->buttons, b->buttons);
+    assert_int_equal(a->button_edge, b->button_edge);
+    assert_int_equal(a->shift, b->shift);
+    assert_int_equal(a->key_count, b->key_count);
+    for (int i = 0; i < a->key_count; i++)
+    {
+        assert_int_equal(a->keys[i].key, b->keys[i].key);
+        assert_int_equal(a->keys[i].ch, b->keys[i].ch);
+    }
+}
+
+/* =========================================================================
+ * Group 1: Round-trip
+ * ========================================================================= */
+
+static void test_header_roundtrip(void **state)
+{
+    (void)state;
+    replay_header_t in = make_header();
+    replay_io_status_t st;
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &in, &st);
+    assert_non_null(w);
+    assert_int_equal(st, REPLAY_IO_OK);
+    assert_int_equal(replay_io_write_close(w), REPLAY_IO_OK);
+
+    replay_header_t out;
+    replay_io_reader_t *r = replay_io_read_open(tmp_path, &out, &st);
+    assert_non_null(r);
+    assert_int_equal(st, REPLAY_IO_OK);
+    assert_true(out.seed == in.seed);
+    assert_int_equal(out.speed, 7);
+    assert_int_equal(out.start_level, 42);
+    assert_true(out.use_keys);
+    assert_true(out.sfx);
+    assert_false(out.debug);
+
+    replay_frame_t f;
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_END);
+    replay_io_read_close(r);
+}
+
+static void test_frames_roundtrip(void **state)
+{
+    (void)state;
+    replay_frame_t frames[6];
+    memset(frames, 0, sizeof(frames));
+    frames[0].ticks = 8;
+    frames[0].mouse_x = 250;
+    frames[0].mouse_y = 600;
+    frames[1] = frames[0];
+    frames[1].held = 1u << 2;
+    frames[1].edge = 1u << 2;
+    frames[1].mouse_x = 180; /* negative delta */
+    frames[2] = frames[1];
+    frames[2].edge = 0;
+    frames[2].buttons = 1u;
+    frames[2].button_edge = 1u;
+    frames[2].shift = true;
+    frames[3] = frames[2];
+    frames[3].button_edge = 0;
+    frames[3].key_count = 3;
+    frames[3].keys[0] = (replay_key_t){0, 'a'};
+    frames[3].keys[1] = (replay_key_t){0, 'Z'};
+    frames[3].keys[2] = (replay_key_t){4, '\0'};
+    frames[4] = frames[3];
+    frames[4].key_count = 0;
+    frames[4].ticks = 0;
+    frames[4].held = 0;
+    frames[4].shift = false;
+    frames[5] = frames[4];
+    frames[5].mouse_x = -5;
+    frames[5].mouse_y = 0x7fff;
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    for (int i = 0; i < 6; i++)
+    {
+        assert_int_equal(replay_io_write_frame(w, &frames[i]), REPLAY_IO_OK);
+    }
+    assert_int_equal(replay_io_write_close(w), REPLAY_IO_OK);
+
+    replay_io_reader_t *r = replay_io_read_open(tmp_path, &h, NULL);
+    assert_non_null(r);
+    for (int i = 0; i < 6; i++)
+    {
+        replay_frame_t f;
+        assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_OK);
+        assert_frame_equal(&f, &frames[i]);
+    }
+    replay_frame_t f;
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_END);
+    assert_int_equal(replay_io_frames_read(r), 6);
+    replay_io_read_close(r);
+}
+
+static void test_runs_expand_with_edges_cleared(void **state)
+{
+    (void)state;
+    replay_frame_t a;
+    memset(&a, 0, sizeof(a));
+    a.ticks = 9;
+    a.held = 3;
+    a.edge = 1;
+
+    replay_frame_t idle = a;
+    idle.edge = 0;
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    replay_io_write_frame(w, &a);
+    for (int i = 0; i < 100; i++)
+    {
+        replay_io_write_frame(w, &idle);
+    }
+    replay_io_write_frame(w, &a);
+    assert_int_equal(replay_io_write_close(w), REPLAY_IO_OK);
+
+    replay_io_reader_t *r = replay_io_read_open(tmp_path, &h, NULL);
+    replay_frame_t f;
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_OK);
+    assert_frame_equal(&f, &a);
+    for (int i = 0; i < 100; i++)
+    {
+        assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_OK);
+        assert_frame_equal(&f, &idle);
+    }
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_OK);
+    assert_frame_equal(&f, &a);
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_END);
+    replay_io_read_close(r);
+}
+
+static void test_excess_keys_dropped(void **state)
+{
+    (void)state;
+    replay_frame_t a;
+    memset(&a, 0, sizeof(a));
+    a.key_count = REPLAY_MAX_KEYS + 5;
+    for (int i = 0; i < REPLAY_MAX_KEYS; i++)
+    {
+        a.keys[i] = (replay_key_t){0, (char)('a' + i)};
+    }
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    replay_io_write_frame(w, &a);
+    replay_io_write_close(w);
+
+    replay_io_reader_t *r = replay_io_read_open(tmp_path, &h, NULL);
+    replay_frame_t f;
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_OK);
+    assert_int_equal(f.key_count, REPLAY_MAX_KEYS);
+    assert_int_equal(f.keys[REPLAY_MAX_KEYS - 1].ch, 'a' + REPLAY_MAX_KEYS - 1);
+    replay_io_read_close(r);
+}
+
+/* =========================================================================
+ * Group 2: Compactness
+ * ========================================================================= */
+
+static void test_idle_frames_cost_a_run(void **state)
+{
+    (void)state;
+    replay_frame_t idle;
+    memset(&idle, 0, sizeof(idle));
+    idle.ticks = 8;
+    idle.mouse_x = 300;
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    for (int i = 0; i < 36000; i++) /* ten minutes at 60 fps */
+    {
+        replay_io_write_frame(w, &idle);
+    }
+    assert_int_equal(replay_io_write_close(w), REPLAY_IO_OK);
+
+    /* 16-byte header + one literal frame + one run record. */
+    assert_true(file_size(tmp_path) < 32);
+}
+
+static void test_paddle_motion_is_small(void **state)
+{
+    (void)state;
+    replay_frame_t f;
+    memset(&f, 0, sizeof(f));
+    f.ticks = 8;
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    for (int i = 0; i < 1000; i++)
+    {
+        f.mouse_x = 250 + (i % 40) - 20; /* small sweeps */
+        replay_io_write_frame(w, &f);
+    }
+    assert_int_equal(replay_io_write_close(w), REPLAY_IO_OK);
+
+    /* Flag byte + two one-byte zigzag deltas per moving frame. */
+    assert_true(file_size(tmp_path) <= 16 + 1000 * 4);
+}
+
+/* =========================================================================
+ * Group 3: Error handling
+ * ========================================================================= */
+
+static void test_bad_magic_rejected(void **state)
+{
+    (void)state;
+    FILE *fp = fopen(tmp_path, "wb");
+    fputs("NOTAREPLAYFILE!!", fp);
+    fclose(fp);
+
+    replay_header_t h;
+    replay_io_status_t st;
+    assert_null(replay_io_read_open(tmp_path, &h, &st));
+    assert_int_equal(st, REPLAY_IO_ERR_BAD_FORMAT);
+}
+
+static void test_truncated_frame_rejected(void **state)
+{
+    (void)state;
+    replay_frame_t f;
+    memset(&f, 0, sizeof(f));
+    f.ticks = 300; /* two-byte varint */
+    f.held = 5;
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    replay_io_write_frame(w, &f);
+    replay_io_write_close(w);
+    assert_int_equal(truncate(tmp_path, file_size(tmp_path) - 2), 0);
+
+    replay_io_reader_t *r = replay_io_read_open(tmp_path, &h, NULL);
+    assert_non_null(r);
+    assert_int_equal(replay_io_read_frame(r, &f), REPLAY_IO_ERR_BAD_FORMAT);
+    replay_io_read_close(r);
+}
+
+/* Overwrite one header byte of the file at tmp_path. */
+static void patch_byte(long offset, unsigned char value)
+{
+    FILE *fp = fopen(tmp_path, "r+b");
+    assert_non_null(fp);
+    assert_int_equal(fseek(fp, offset, SEEK_SET), 0);
+    assert_int_equal(fputc(value, fp), value);
+    fclose(fp);
+}
+
+static void test_out_of_range_header_rejected(void **state)
+{
+    (void)state;
+    /* Byte offsets of speed and start_level, and values outside the
+     * -speed 1-9 and -startlevel 1-80 ranges. */
+    static const struct
+    {
+        long offset;
+        unsigned char value;
+    } cases[] = {{6, 0}, {6, 10}, {6, 255}, {7, 0}, {7, 81}};
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        replay_header_t h = make_header();
+        replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+        assert_int_equal(replay_io_write_close(w), REPLAY_IO_OK);
+        patch_byte(cases[i].offset, cases[i].value);
+
+        replay_io_status_t st;
+        assert_null(replay_io_read_open(tmp_path, &h, &st));
+        assert_int_equal(st, REPLAY_IO_ERR_BAD_FORMAT);
+    }
+}
+
+static void test_excess_ticks_rejected(void **state)
+{
+    (void)state;
+    replay_frame_t f;
+    memset(&f, 0, sizeof(f));
+    f.ticks = SDL2L_TURBO_MAX_TICKS_PER_UPDATE;
+    replay_frame_t bad = f;
+    bad.ticks = 0xFFFFFFFFu; /* would read back as GAME_REPLAY_LIVE */
+
+    replay_header_t h = make_header();
+    replay_io_writer_t *w = replay_io_write_open(tmp_path, &h, NULL);
+    replay_io_write_frame(w, &f);
+    replay_io_write_frame(w, &bad);
+    replay_io_write_close(w);
+
+    replay_io_reader_t *r = replay_io_read_open(tmp_path, &h, NULL);
+    assert_non_null(r);
+    replay_frame_t got;
+    assert_int_equal(replay_io_read_frame(r, &got), REPLAY_IO_OK);
+    assert_int_equal(got.ticks, SDL2L_TURBO_MAX_TICKS_PER_UPDATE);
+    assert_int_equal(replay_io_read_frame(r, &got), REPLAY_IO_ERR_BAD_FORMAT);
+    replay_io_read_close(r);
+}
+
+static void test_open_missing_file(void **state)
+{
+    (void)state;
+    replay_header_t h = make_header();
+    replay_io_status_t st;
+    assert_null(replay_io_read_open("/nonexistent/dir/replay.xbr", &h, &st));
+    assert_int_equal(st, REPLAY_IO_ERR_OPEN);
+    assert_null(replay_io_write_open("/nonexistent/dir/replay.xbr", &h, &st));
+    assert_int_equal(st, REPLAY_IO_ERR_OPEN);
+}
+
+/* =========================================================================
+ * Group 4: Null safety
+ * ========================================================================= */
+
+static void test_null_safety(void **state)
+{
+    (void)state;
+    replay_header_t h = make_header();
+    replay_frame_t f;
+    replay_io_status_t st;
+
+    assert_null(replay_io_write_open(NULL, &h, &st));
+    assert_int_equal(st, REPLAY_IO_ERR_NULL_ARG);
+    assert_null(replay_io_write_open("x", NULL, &st));
+    assert_null(replay_io_read_open(NULL, &h, &st));
+    assert_int_equal(st, REPLAY_IO_ERR_NULL_ARG);
+    assert_int_equal(replay_io_write_frame(NULL, &f), REPLAY_IO_ERR_NULL_ARG);
+    assert_int_equal(replay_io_read_frame(NULL, &f), REPLAY_IO_ERR_NULL_ARG);
+    assert_int_equal(replay_io_write_close(NULL), REPLAY_IO_OK);
+    assert_int_equal(replay_io_frames_read(NULL), 0);
+    replay_io_read_close(NULL);
+    assert_string_equal(replay_io_status_string(REPLAY_IO_END), "end of replay");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Round-trip */
+        cmocka_unit_test_setup_teardown(test_header_roundtrip, setup_tmpfile, teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_frames_roundtrip, setup_tmpfile, teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_runs_expand_with_edges_cleared, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_excess_keys_dropped, setup_tmpfile,
+                                        teardown_tmpfile),
+        /* Group 2: Compactness */
+        cmocka_unit_test_setup_teardown(test_idle_frames_cost_a_run, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_paddle_motion_is_small, setup_tmpfile,
+                                        teardown_tmpfile),
+        /* Group 3: Error handling */
+        cmocka_unit_test_setup_teardown(test_bad_magic_rejected, setup_tmpfile, teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_truncated_frame_rejected, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_out_of_range_header_rejected, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test_setup_teardown(test_excess_ticks_rejected, setup_tmpfile,
+                                        teardown_tmpfile),
+        cmocka_unit_test(test_open_missing_file),
+        /* Group 4: Null safety */
+        cmocka_unit_test(test_null_safety),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
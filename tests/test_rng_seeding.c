@@ -96,7 +96,8 @@ static void test_different_seeds_diverge(void **state)
  *       different rand() states; this test catches that.
  *
  *   (b) Consumption: game_create+destroy DOES consume at least one
- *       rand() call (ball mass init, level RNG, etc).  Asserting
+ *       rand() call (the seed for the game's own ctx->rng is drawn
+ *       from it).  Asserting
  *       this rules out a regression where game_create somehow
  *       short-circuits rand consumption.
  *
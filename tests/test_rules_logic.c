@@ -0,0 +1,482 @@
+/*
+ * test_rules_logic.c — CMocka tests for the shared gameplay rules.
+ *
+ * Each test builds the pure gameplay systems directly and drives one rule
+ * through a rules_logic_t, the way game_callbacks.c and sim_system.c do.
+ *
+ * Test groups:
+ *   1. Ball block hits (5 tests)
+ *   2. Explosion finalize (4 tests)
+ *   3. Ball death (3 tests)
+ *   4. Bullets (2 tests)
+ *   5. Bonus spawning (3 tests)
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CMocka must come after setjmp.h */
+#include <cmocka.h>
+
+#include "block_types.h"
+#include "rules_logic.h"
+
+/* Play area geometry — same values as include/game_context.h. */
+#define T_PLAY_WIDTH 495
+#define T_PLAY_HEIGHT 580
+#define T_MAIN_WIDTH 70
+#define T_COL_WIDTH (T_PLAY_WIDTH / MAX_COL)
+#define T_ROW_HEIGHT (T_PLAY_HEIGHT / MAX_ROW)
+
+/* =========================================================================
+ * Fixture: the systems and rule state a game_ctx_t or sim_system_t owns
+ * ========================================================================= */
+
+typedef struct
+{
+    ball_system_t *ball;
+    block_system_t *block;
+    paddle_system_t *paddle;
+    gun_system_t *gun;
+    score_system_t *score;
+    special_system_t *special;
+    eyedude_system_t *eyedude;
+    rng_t rng;
+
+    int lives_left;
+    int time_remaining;
+    int bonus_count;
+    bool bonus_block_active;
+    int next_bonus_frame;
+    int bonus_row;
+    int bonus_col;
+    int bonus_type;
+
+    int sounds;      /* on_block_sound calls */
+    int last_sound;  /* block type of the last one */
+    int shakes;      /* on_shake calls */
+    int frame;
+} fixture_t;
+
+static int fx_rand(void *ud)
+{
+    fixture_t *fx = ud;
+    return rng_next(&fx->rng);
+}
+
+static ball_system_env_t fx_ball_env(void *ud)
+{
+    const fixture_t *fx = ud;
+    ball_system_env_t env = {
+        .frame = fx->frame,
+        .speed_level = 5,
+        .paddle_pos = paddle_system_get_pos(fx->paddle),
+        .paddle_dx = paddle_system_get_dx(fx->paddle),
+        .paddle_size = paddle_system_get_size(fx->paddle),
+        .play_width = T_PLAY_WIDTH,
+        .play_height = T_PLAY_HEIGHT,
+        .no_walls = special_system_is_active(fx->special, SPECIAL_NO_WALLS),
+        .killer = special_system_is_active(fx->special, SPECIAL_KILLER),
+        .sticky_bat = special_system_is_active(fx->special, SPECIAL_STICKY),
+        .col_width = T_COL_WIDTH,
+        .row_height = T_ROW_HEIGHT,
+    };
+    return env;
+}
+
+static void fx_block_sound(int block_type, void *ud)
+{
+    fixture_t *fx = ud;
+    fx->sounds++;
+    fx->last_sound = block_type;
+}
+
+static void fx_shake(void *ud)
+{
+    fixture_t *fx = ud;
+    fx->shakes++;
+}
+
+static rules_logic_t fx_rules(fixture_t *fx)
+{
+    rules_logic_t rules = {
+        .ball = fx->ball,
+        .block = fx->block,
+        .paddle = fx->paddle,
+        .gun = fx->gun,
+        .score = fx->score,
+        .special = fx->special,
+        .eyedude = fx->eyedude,
+        .rng = &fx->rng,
+        .lives_left = &fx->lives_left,
+        .time_remaining = &fx->time_remaining,
+        .bonus_count = &fx->bonus_count,
+        .bonus_block_active = &fx->bonus_block_active,
+        .next_bonus_frame = &fx->next_bonus_frame,
+        .bonus_row = &fx->bonus_row,
+        .bonus_col = &fx->bonus_col,
+        .bonus_type = &fx->bonus_type,
+        .col_width = T_COL_WIDTH,
+        .row_height = T_ROW_HEIGHT,
+        .ball_env = fx_ball_env,
+        .on_block_sound = fx_block_sound,
+        .on_shake = fx_shake,
+        .user_data = fx,
+    };
+    return rules;
+}
+
+static int setup(void **state)
+{
+    fixture_t *fx = calloc(1, sizeof(*fx));
+    assert_non_null(fx);
+    rng_seed(&fx->rng, 42);
+
+    ball_system_callbacks_t bcb = {0};
+    gun_system_callbacks_t gcb = {0};
+    score_system_callbacks_t scb = {0};
+    special_system_callbacks_t spcb = {0};
+    eyedude_system_callbacks_t ecb = {0};
+
+    fx->block = block_system_create(T_COL_WIDTH, T_ROW_HEIGHT, fx_rand, fx, NULL);
+    fx->paddle = paddle_system_create(T_PLAY_WIDTH, T_PLAY_HEIGHT, T_MAIN_WIDTH, NULL);
+    fx->ball = ball_system_create(&bcb, fx, fx_rand, NULL);
+    fx->gun = gun_system_create(T_PLAY_HEIGHT, &gcb, fx, NULL);
+    fx->score = score_system_create(&scb, fx, NULL);
+    fx->special = special_system_create(&spcb, fx);
+    fx->eyedude = eyedude_system_create(&ecb, fx, fx_rand);
+    assert_non_null(fx->block);
+    assert_non_null(fx->paddle);
+    assert_non_null(fx->ball);
+    assert_non_null(fx->gun);
+    assert_non_null(fx->score);
+    assert_non_null(fx->special);
+    assert_non_null(fx->eyedude);
+
+    fx->lives_left = 3;
+    fx->bonus_type = NONE_BLK;
+    fx->frame = 100;
+    *state = fx;
+    return 0;
+}
+
+static int teardown(void **state)
+{
+    fixture_t *fx = *state;
+    eyedude_system_destroy(fx->eyedude);
+    special_system_destroy(fx->special);
+    score_system_destroy(fx->score);
+    gun_system_destroy(fx->gun);
+    ball_system_destroy(fx->ball);
+    paddle_system_destroy(fx->paddle);
+    block_system_destroy(fx->block);
+    free(fx);
+    return 0;
+}
+
+/* =========================================================================
+ * Group 1: Ball block hits
+ * ========================================================================= */
+
+static void test_block_hit_reverse(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 3, 4, REVERSE_BLK, 0, fx->frame);
+
+    assert_int_equal(rules_logic_block_hit(&rules, 3, 4, 0, fx->frame), BLOCK_HIT_BOUNCE);
+    assert_int_equal(paddle_system_get_reverse(fx->paddle), 1);
+    assert_int_equal(block_system_get_exploding_count(fx->block), 1);
+    assert_int_equal(fx->sounds, 1);
+    assert_int_equal(fx->last_sound, REVERSE_BLK);
+}
+
+static void test_block_hit_killer_absorbs(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    special_system_set(fx->special, SPECIAL_KILLER, 1);
+    block_system_add(fx->block, 2, 2, RED_BLK, 0, fx->frame);
+
+    assert_int_equal(rules_logic_block_hit(&rules, 2, 2, 0, fx->frame), BLOCK_HIT_ABSORB);
+    assert_int_equal(block_system_get_exploding_count(fx->block), 1);
+}
+
+static void test_block_hit_extra_ball(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 5, 1, EXTRABALL_BLK, 0, fx->frame);
+
+    (void)rules_logic_block_hit(&rules, 5, 1, 0, fx->frame);
+    assert_int_equal(fx->lives_left, 4);
+}
+
+static void test_block_hit_counter_survives(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 4, 4, COUNTER_BLK, 3, fx->frame);
+
+    assert_int_equal(rules_logic_block_hit(&rules, 4, 4, 0, fx->frame), BLOCK_HIT_BOUNCE);
+    assert_int_equal(block_system_get_exploding_count(fx->block), 0);
+    assert_int_equal(fx->sounds, 0);
+}
+
+static void test_block_hit_hyperspace_teleports(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 6, 6, HYPERSPACE_BLK, 0, fx->frame);
+
+    assert_int_equal(rules_logic_block_hit(&rules, 6, 6, 0, fx->frame), BLOCK_HIT_TELEPORT);
+    assert_true(block_system_is_occupied(fx->block, 6, 6));
+    assert_int_equal(fx->last_sound, HYPERSPACE_BLK);
+}
+
+/* =========================================================================
+ * Group 2: Explosion finalize
+ * ========================================================================= */
+
+static void test_finalize_score_multiplier(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    special_system_set(fx->special, SPECIAL_X2_BONUS, 1);
+
+    rules_logic_block_finalize(&rules, 1, 1, RED_BLK, 100, fx->frame);
+    assert_int_equal(score_system_get(fx->score), 200);
+}
+
+static void test_finalize_bomb_chain(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 4, 3, RED_BLK, 0, fx->frame);
+    block_system_add(fx->block, 5, 5, BLUE_BLK, 0, fx->frame);
+
+    rules_logic_block_finalize(&rules, 4, 4, BOMB_BLK, 0, fx->frame);
+    assert_int_equal(block_system_get_exploding_count(fx->block), 2);
+    assert_int_equal(fx->shakes, 1);
+}
+
+static void test_finalize_timer_and_ammo(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    gun_system_set_ammo(fx->gun, 0);
+
+    rules_logic_block_finalize(&rules, 1, 1, TIMER_BLK, 0, fx->frame);
+    rules_logic_block_finalize(&rules, 1, 2, BULLET_BLK, 0, fx->frame);
+    assert_int_equal(fx->time_remaining, BLOCK_EXTRA_TIME);
+    assert_int_equal(gun_system_get_ammo(fx->gun), BLOCK_NUMBER_OF_BULLETS_NEW_LEVEL);
+
+    rules_logic_block_finalize(&rules, 1, 3, MAXAMMO_BLK, 0, fx->frame);
+    assert_int_equal(gun_system_get_unlimited(fx->gun), 1);
+}
+
+static void test_finalize_tenth_bonus_killer(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+
+    for (int i = 0; i < 9; i++)
+    {
+        rules_logic_block_finalize(&rules, 1, 1, BONUS_BLK, 0, fx->frame);
+    }
+    assert_false(special_system_is_active(fx->special, SPECIAL_KILLER));
+    rules_logic_block_finalize(&rules, 1, 1, BONUS_BLK, 0, fx->frame);
+    assert_int_equal(fx->bonus_count, 10);
+    assert_true(special_system_is_active(fx->special, SPECIAL_KILLER));
+}
+
+/* =========================================================================
+ * Group 3: Ball death
+ * ========================================================================= */
+
+static void test_ball_died_respawns(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    paddle_system_set_size(fx->paddle, PADDLE_SIZE_SMALL);
+    paddle_system_set_reverse(fx->paddle, 1);
+
+    assert_int_equal(rules_logic_ball_died(&rules, false), RULES_BALL_RESPAWN);
+    assert_int_equal(fx->lives_left, 2);
+    assert_int_equal(paddle_system_get_size_type(fx->paddle), PADDLE_SIZE_HUGE);
+    assert_int_equal(paddle_system_get_reverse(fx->paddle), 0);
+    assert_int_equal(ball_system_get_state(fx->ball, 0), BALL_WAIT);
+}
+
+static void test_ball_died_game_over(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    fx->lives_left = 0;
+    enum BallStates before = ball_system_get_state(fx->ball, 0);
+
+    assert_int_equal(rules_logic_ball_died(&rules, false), RULES_BALL_GAME_OVER);
+    assert_int_equal(fx->lives_left, 0);
+    assert_int_equal(ball_system_get_state(fx->ball, 0), before);
+}
+
+static void test_ball_died_keep_lives(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    fx->lives_left = 0;
+
+    assert_int_equal(rules_logic_ball_died(&rules, true), RULES_BALL_RESPAWN);
+    assert_int_equal(rules_logic_ball_died(&rules, true), RULES_BALL_RESPAWN);
+    assert_int_equal(fx->lives_left, 0);
+}
+
+/* =========================================================================
+ * Group 4: Bullets
+ * ========================================================================= */
+
+static void test_bullet_finds_block(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 3, 2, RED_BLK, 0, fx->frame);
+
+    block_system_render_info_t info;
+    assert_int_equal(block_system_get_render_info(fx->block, 3, 2, &info), BLOCK_SYS_OK);
+    int row = -1;
+    int col = -1;
+    assert_int_equal(rules_logic_bullet_block_at(&rules, info.x + 1, info.y + 1, &row, &col), 1);
+    assert_int_equal(row, 3);
+    assert_int_equal(col, 2);
+    assert_int_equal(rules_logic_bullet_block_at(&rules, 5, T_PLAY_HEIGHT - 5, &row, &col), 0);
+}
+
+static void test_bullet_destroys_ammo_block(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 2, 2, BULLET_BLK, 0, fx->frame);
+
+    assert_int_equal(rules_logic_bullet_block_hit(&rules, 2, 2, fx->frame), BULLET_BLK);
+    assert_int_equal(block_system_get_exploding_count(fx->block), 1);
+    assert_int_equal(fx->last_sound, BULLET_BLK);
+    assert_int_equal(rules_logic_bullet_block_hit(&rules, 7, 7, fx->frame), NONE_BLK);
+}
+
+/* =========================================================================
+ * Group 5: Bonus spawning
+ * ========================================================================= */
+
+/* Tick the spawner until something is rolled; returns the frame it ran. */
+static int spawn_until_rolled(fixture_t *fx, const rules_logic_t *rules)
+{
+    rules_logic_spawn_bonus(rules, fx->frame);
+    assert_true(fx->next_bonus_frame >= fx->frame);
+    assert_true(fx->next_bonus_frame < fx->frame + RULES_BONUS_SEED);
+    int due = fx->next_bonus_frame;
+    rules_logic_spawn_bonus(rules, due);
+    return due;
+}
+
+static void test_spawn_schedules_then_rolls(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+
+    int placed = 0;
+    for (int i = 0; i < 50; i++)
+    {
+        fx->frame = spawn_until_rolled(fx, &rules) + 1;
+        assert_int_equal(fx->next_bonus_frame, 0);
+        if (fx->bonus_block_active)
+        {
+            placed++;
+            assert_int_equal(block_system_get_type(fx->block, fx->bonus_row, fx->bonus_col),
+                             fx->bonus_type);
+            block_system_clear(fx->block, fx->bonus_row, fx->bonus_col);
+            rules_logic_spawn_bonus(&rules, fx->frame);
+            assert_false(fx->bonus_block_active);
+        }
+    }
+    /* 23 of the 27 rolls place a block. */
+    assert_true(placed > 25);
+}
+
+static void test_spawn_expires_unhit_block(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+
+    int due = 0;
+    while (!fx->bonus_block_active)
+    {
+        due = spawn_until_rolled(fx, &rules);
+        fx->frame = due + 1;
+    }
+    int row = fx->bonus_row;
+    int col = fx->bonus_col;
+
+    rules_logic_spawn_bonus(&rules, due + BLOCK_BONUS_LENGTH - 1);
+    assert_true(block_system_is_occupied(fx->block, row, col));
+    rules_logic_spawn_bonus(&rules, due + BLOCK_BONUS_LENGTH);
+    assert_false(block_system_is_occupied(fx->block, row, col));
+    assert_false(fx->bonus_block_active);
+}
+
+static void test_spawn_waits_for_active_block(void **state)
+{
+    fixture_t *fx = *state;
+    rules_logic_t rules = fx_rules(fx);
+    block_system_add(fx->block, 1, 1, BONUS_BLK, 0, fx->frame);
+    block_system_set_last_frame(fx->block, 1, 1, fx->frame + BLOCK_BONUS_LENGTH);
+    fx->bonus_block_active = true;
+    fx->bonus_row = 1;
+    fx->bonus_col = 1;
+    fx->bonus_type = BONUS_BLK;
+
+    /* No new spawn is scheduled while a spawned block is on the grid. */
+    rules_logic_spawn_bonus(&rules, fx->frame + 1);
+    assert_int_equal(fx->next_bonus_frame, 0);
+    assert_true(fx->bonus_block_active);
+}
+
+/* =========================================================================
+ * Main
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Ball block hits */
+        cmocka_unit_test_setup_teardown(test_block_hit_reverse, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_block_hit_killer_absorbs, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_block_hit_extra_ball, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_block_hit_counter_survives, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_block_hit_hyperspace_teleports, setup, teardown),
+
+        /* Group 2: Explosion finalize */
+        cmocka_unit_test_setup_teardown(test_finalize_score_multiplier, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_finalize_bomb_chain, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_finalize_timer_and_ammo, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_finalize_tenth_bonus_killer, setup, teardown),
+
+        /* Group 3: Ball death */
+        cmocka_unit_test_setup_teardown(test_ball_died_respawns, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_ball_died_game_over, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_ball_died_keep_lives, setup, teardown),
+
+        /* Group 4: Bullets */
+        cmocka_unit_test_setup_teardown(test_bullet_finds_block, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_bullet_destroys_ammo_block, setup, teardown),
+
+        /* Group 5: Bonus spawning */
+        cmocka_unit_test_setup_teardown(test_spawn_schedules_then_rolls, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_spawn_expires_unhit_block, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_spawn_waits_for_active_block, setup, teardown),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
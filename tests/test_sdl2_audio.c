@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <cmocka.h>
 
@@ -612,6 +613,334 @@ static void test_play_at_percent_muted_returns_ok(void **state)
     sdl2_audio_set_muted(ctx, false);
 }
 
+/* =========================================================================
+ * Group N: Voice manager (ADR-095)
+ * ========================================================================= */
+
+/* Two channels at full master volume, so per-channel volumes identify
+ * which play owns a channel. */
+static int setup_two_voices(void **state)
+{
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    cfg.channels = 2;
+    sdl2_audio_status_t st;
+    sdl2_audio_t *ctx = sdl2_audio_create(&cfg, &st);
+    if (ctx == NULL)
+    {
+        fprintf(stderr, "sdl2_audio_create failed: %s\n", sdl2_audio_status_string(st));
+        return -1;
+    }
+    *state = ctx;
+    return 0;
+}
+
+static sdl2_audio_voice_stats_t voice_stats(const sdl2_audio_t *ctx)
+{
+    sdl2_audio_voice_stats_t vs;
+    sdl2_audio_get_voice_stats(ctx, &vs);
+    return vs;
+}
+
+/* Repeats in one tick share a voice at the loudest requested volume. */
+static void test_voice_coalesce_same_tick(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    sdl2_audio_begin_tick(ctx);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "boing", 10), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "boing", 50), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "boing", 20), SDL2A_OK);
+
+    assert_int_equal(Mix_Playing(-1), 1);
+    assert_int_equal(Mix_Volume(0, -1), (MIX_MAX_VOLUME * 50 + 50) / 100);
+    assert_int_equal(voice_stats(ctx).coalesced, 2);
+    assert_int_equal(sdl2_audio_log_error_count(ctx), 0);
+
+    /* A new tick gets a voice of its own. */
+    sdl2_audio_begin_tick(ctx);
+    assert_int_equal(sdl2_audio_play(ctx, "boing"), SDL2A_OK);
+    assert_int_equal(Mix_Playing(-1), 2);
+    assert_int_equal(voice_stats(ctx).coalesced, 2);
+}
+
+/* With every channel busy, the oldest voice of the same class is stolen. */
+static void test_voice_steal_oldest(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "bomb", 10), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "paddle", 20), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "metal", 30), SDL2A_OK);
+
+    assert_int_equal(Mix_Playing(-1), 2);
+    assert_int_equal(Mix_Volume(0, -1), (MIX_MAX_VOLUME * 30 + 50) / 100); /* bomb's channel */
+    assert_int_equal(Mix_Volume(1, -1), (MIX_MAX_VOLUME * 20 + 50) / 100);
+    sdl2_audio_voice_stats_t vs = voice_stats(ctx);
+    assert_int_equal(vs.stolen, 1);
+    assert_int_equal(vs.dropped, 0);
+}
+
+/* A lower class is stolen before an older voice of a higher class. */
+static void test_voice_steal_lowest_priority_first(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_set_priority(ctx, "boing", SDL2A_PRIORITY_LOW), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "bomb", 10), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "boing", 20), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_at_percent(ctx, "metal", 30), SDL2A_OK);
+
+    assert_int_equal(Mix_Volume(0, -1), (MIX_MAX_VOLUME * 10 + 50) / 100); /* bomb survives */
+    assert_int_equal(Mix_Volume(1, -1), (MIX_MAX_VOLUME * 30 + 50) / 100);
+    assert_int_equal(voice_stats(ctx).stolen, 1);
+}
+
+/* A sound never cuts off a higher class; it is dropped and counted. */
+static void test_voice_drop_when_outranked(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_set_priority(ctx, "bomb", SDL2A_PRIORITY_HIGH), SDL2A_OK);
+    assert_int_equal(sdl2_audio_set_priority(ctx, "metal", SDL2A_PRIORITY_HIGH), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play(ctx, "bomb"), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play(ctx, "metal"), SDL2A_OK);
+
+    assert_int_equal(sdl2_audio_play(ctx, "paddle"), SDL2A_ERR_PLAY_FAILED);
+    sdl2_audio_voice_stats_t vs = voice_stats(ctx);
+    assert_int_equal(vs.dropped, 1);
+    assert_int_equal(vs.stolen, 0);
+    assert_int_equal(sdl2_audio_log_error_count(ctx), 1);
+    assert_int_equal(Mix_Playing(-1), 2);
+}
+
+static void test_voice_api_errors(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_set_priority(ctx, "nonexistent_xyz", SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_set_priority(ctx, NULL, SDL2A_PRIORITY_HIGH), SDL2A_ERR_NULL_ARG);
+    assert_int_equal(sdl2_audio_set_priority(NULL, "boing", SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NULL_ARG);
+    sdl2_audio_begin_tick(NULL);
+
+    sdl2_audio_voice_stats_t vs = {1, 1, 1};
+    sdl2_audio_get_voice_stats(NULL, &vs);
+    assert_int_equal(vs.dropped + vs.stolen + vs.coalesced, 0);
+    sdl2_audio_get_voice_stats(ctx, NULL);
+}
+
+/* =========================================================================
+ * Group N: Sound IDs (ADR-096)
+ * ========================================================================= */
+
+/* ID 0 and 3 are cached; ID 1 names no file; ID 2 is unbound. */
+static const char *const k_id_keys[] = {"boing", "nonexistent_xyz", NULL, "paddle"};
+
+static int setup_ids(void **state)
+{
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    cfg.id_keys = k_id_keys;
+    cfg.id_count = 4;
+    sdl2_audio_status_t st;
+    sdl2_audio_t *ctx = sdl2_audio_create(&cfg, &st);
+    if (ctx == NULL)
+    {
+        fprintf(stderr, "sdl2_audio_create failed: %s\n", sdl2_audio_status_string(st));
+        return -1;
+    }
+    *state = ctx;
+    return 0;
+}
+
+static void test_id_config_defaults(void **state)
+{
+    (void)state;
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    assert_null(cfg.id_keys);
+    assert_int_equal(cfg.id_count, 0);
+}
+
+static void test_id_create_rejects_bad_registry(void **state)
+{
+    (void)state;
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    sdl2_audio_status_t st = SDL2A_OK;
+    cfg.id_count = 1;
+    assert_null(sdl2_audio_create(&cfg, &st));
+    assert_int_equal(st, SDL2A_ERR_NULL_ARG);
+
+    cfg.id_keys = k_id_keys;
+    cfg.id_count = SDL2A_MAX_SOUNDS + 1;
+    assert_null(sdl2_audio_create(&cfg, &st));
+    assert_int_equal(st, SDL2A_ERR_CACHE_FULL);
+}
+
+/* Playing by ID matches playing by key: same volume, same log entry. */
+static void test_id_play_resolves(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    Mix_HaltChannel(-1);
+    assert_int_equal(sdl2_audio_play_id(ctx, 0, 50), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_id(ctx, 3, 200), SDL2A_OK);
+    assert_int_equal(Mix_Playing(-1), 2);
+    assert_int_equal(Mix_Volume(0, -1), (MIX_MAX_VOLUME * 50 + 50) / 100);
+    assert_int_equal(Mix_Volume(1, -1), MIX_MAX_VOLUME);
+
+    sdl2_audio_call_t entries[2];
+    assert_int_equal(sdl2_audio_log_snapshot(ctx, entries, 2), 2);
+    assert_string_equal(entries[0].name, "boing");
+    assert_string_equal(entries[1].name, "paddle");
+    assert_int_equal(sdl2_audio_log_error_count(ctx), 0);
+}
+
+/* Unresolved and out-of-range IDs are logged misses, not crashes. */
+static void test_id_play_not_found(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_play_id(ctx, 1, 100), SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_play_id(ctx, 2, 100), SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_play_id(ctx, -1, 100), SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_play_id(ctx, 4, 100), SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_play_id(NULL, 0, 100), SDL2A_ERR_NULL_ARG);
+
+    sdl2_audio_call_t entries[4];
+    assert_int_equal(sdl2_audio_log_snapshot(ctx, entries, 4), 4);
+    assert_string_equal(entries[0].name, "nonexistent_xyz");
+    assert_string_equal(entries[1].name, "#2");
+    assert_string_equal(entries[3].name, "#4");
+    assert_int_equal(sdl2_audio_log_error_count(ctx), 4);
+}
+
+static void test_id_play_muted_returns_ok(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    sdl2_audio_set_muted(ctx, true);
+    assert_int_equal(sdl2_audio_play_id(ctx, 0, 100), SDL2A_OK);
+    sdl2_audio_set_muted(ctx, false);
+}
+
+/* Priorities can be set by ID, with the same misses as play_id. */
+static void test_id_set_priority(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_set_priority_id(ctx, 0, SDL2A_PRIORITY_LOW), SDL2A_OK);
+    assert_int_equal(sdl2_audio_set_priority_id(ctx, 3, SDL2A_PRIORITY_HIGH), SDL2A_OK);
+    assert_int_equal(sdl2_audio_set_priority_id(ctx, 1, SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_set_priority_id(ctx, 2, SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_set_priority_id(ctx, -1, SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_set_priority_id(ctx, 4, SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_set_priority_id(NULL, 0, SDL2A_PRIORITY_HIGH),
+                     SDL2A_ERR_NULL_ARG);
+}
+
+/* A context created without a registry has no IDs. */
+static void test_id_without_registry(void **state)
+{
+    sdl2_audio_t *ctx = (sdl2_audio_t *)*state;
+    assert_int_equal(sdl2_audio_play_id(ctx, 0, 100), SDL2A_ERR_NOT_FOUND);
+}
+
+/* =========================================================================
+ * Group N: Decoding on the worker pool (ADR-097)
+ * ========================================================================= */
+
+static void test_decode_config_default(void **state)
+{
+    (void)state;
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    assert_null(cfg.decoder);
+    assert_null(cfg.pack);
+    assert_int_equal(sdl2_audio_finish_decode(NULL), 0);
+}
+
+/* The cache and the IDs stay empty until finish_decode() collects the
+ * decoded sounds; afterwards the context behaves as if loaded serially. */
+static void test_decode_fills_cache_on_finish(void **state)
+{
+    (void)state;
+    sdl2_decode_config_t dcfg = sdl2_decode_config_defaults();
+    sdl2_decode_t *dec = sdl2_decode_create(&dcfg, NULL);
+    assert_non_null(dec);
+
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    cfg.id_keys = k_id_keys;
+    cfg.id_count = 4;
+    cfg.decoder = dec;
+    sdl2_audio_status_t st;
+    sdl2_audio_t *ctx = sdl2_audio_create(&cfg, &st);
+    assert_non_null(ctx);
+    assert_int_equal(st, SDL2A_OK);
+    assert_int_equal(sdl2_audio_count(ctx), 0);
+    assert_int_equal(sdl2_audio_play_id(ctx, 0, 100), SDL2A_ERR_NOT_FOUND);
+
+    assert_int_equal(sdl2_audio_finish_decode(ctx), 0);
+    assert_true(sdl2_audio_count(ctx) >= 40);
+    assert_int_equal(sdl2_audio_play_id(ctx, 0, 100), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play_id(ctx, 1, 100), SDL2A_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_audio_play(ctx, "paddle"), SDL2A_OK);
+
+    sdl2_decode_stats_t stats;
+    sdl2_decode_get_stats(dec, &stats);
+    assert_int_equal(stats.submitted, sdl2_audio_count(ctx));
+    sdl2_decode_destroy(dec);
+
+    /* The decoder is no longer referenced. */
+    assert_int_equal(sdl2_audio_finish_decode(ctx), 0);
+    assert_int_equal(sdl2_audio_play_id(ctx, 3, 100), SDL2A_OK);
+    sdl2_audio_destroy(ctx);
+}
+
+/* =========================================================================
+ * Group N: Asset pack (ADR-098)
+ * ========================================================================= */
+
+/* Pack sounds are cached under their key minus "sounds/", in the device
+ * format or not, without touching sound_dir; malformed entries are
+ * skipped. */
+static void test_pack_sounds(void **state)
+{
+    (void)state;
+    static Sint16 stereo[2 * 441];
+    static Uint8 mono[220];
+
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_non_null(w);
+    asset_pack_entry_t e = {"sounds/native", stereo, sizeof(stereo), ASSET_PACK_PCM,
+                            {44100, AUDIO_S16SYS, 2}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    e = (asset_pack_entry_t){"sounds/mono", mono, sizeof(mono), ASSET_PACK_PCM,
+                             {22050, AUDIO_U8, 1}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    e = (asset_pack_entry_t){"sounds/bad", mono, sizeof(mono), ASSET_PACK_PCM,
+                             {22050, AUDIO_U8, 0}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    e = (asset_pack_entry_t){"images/x", mono, sizeof(mono), ASSET_PACK_RAW, {0, 0, 0}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/test_sdl2_audio_%d.pak", (int)getpid());
+    assert_int_equal(asset_pack_writer_save(w, path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+    asset_pack_t *pack = asset_pack_open(path, NULL);
+    assert_non_null(pack);
+
+    sdl2_audio_config_t cfg = sdl2_audio_config_defaults();
+    cfg.sound_dir = "/nonexistent/path/xyz";
+    cfg.pack = pack;
+    sdl2_audio_status_t st;
+    sdl2_audio_t *ctx = sdl2_audio_create(&cfg, &st);
+    assert_non_null(ctx);
+    assert_int_equal(st, SDL2A_OK);
+    assert_int_equal(sdl2_audio_count(ctx), 2);
+    assert_int_equal(sdl2_audio_play(ctx, "native"), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play(ctx, "mono"), SDL2A_OK);
+    assert_int_equal(sdl2_audio_play(ctx, "bad"), SDL2A_ERR_NOT_FOUND);
+    sdl2_audio_destroy(ctx);
+
+    asset_pack_close(pack);
+    unlink(path);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -722,6 +1051,40 @@ int main(void)
         cmocka_unit_test(test_log_null_safety),
     };
 
+    const struct CMUnitTest voice_tests[] = {
+        cmocka_unit_test_setup_teardown(test_voice_coalesce_same_tick, setup_two_voices,
+                                        teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_voice_steal_oldest, setup_two_voices,
+                                        teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_voice_steal_lowest_priority_first, setup_two_voices,
+                                        teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_voice_drop_when_outranked, setup_two_voices,
+                                        teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_voice_api_errors, setup_two_voices,
+                                        teardown_audio_ctx),
+    };
+
+    const struct CMUnitTest id_tests[] = {
+        cmocka_unit_test(test_id_config_defaults),
+        cmocka_unit_test(test_id_create_rejects_bad_registry),
+        cmocka_unit_test_setup_teardown(test_id_play_resolves, setup_ids, teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_id_play_not_found, setup_ids, teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_id_play_muted_returns_ok, setup_ids,
+                                        teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_id_set_priority, setup_ids, teardown_audio_ctx),
+        cmocka_unit_test_setup_teardown(test_id_without_registry, setup_audio_ctx,
+                                        teardown_audio_ctx),
+    };
+
+    const struct CMUnitTest decode_tests[] = {
+        cmocka_unit_test(test_decode_config_default),
+        cmocka_unit_test(test_decode_fills_cache_on_finish),
+    };
+
+    const struct CMUnitTest pack_tests[] = {
+        cmocka_unit_test(test_pack_sounds),
+    };
+
     int failed = 0;
     failed += cmocka_run_group_tests_name("config defaults", config_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("error handling", error_tests, group_setup_sdl,
@@ -739,5 +1102,13 @@ int main(void)
     failed += cmocka_run_group_tests_name("status strings", status_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("call log", log_tests, group_setup_sdl,
                                           group_teardown_sdl);
+    failed += cmocka_run_group_tests_name("voice manager", voice_tests, group_setup_sdl,
+                                          group_teardown_sdl);
+    failed += cmocka_run_group_tests_name("sound IDs", id_tests, group_setup_sdl,
+                                          group_teardown_sdl);
+    failed += cmocka_run_group_tests_name("decode pool", decode_tests, group_setup_sdl,
+                                          group_teardown_sdl);
+    failed += cmocka_run_group_tests_name("asset pack", pack_tests, group_setup_sdl,
+                                          group_teardown_sdl);
     return failed;
 }
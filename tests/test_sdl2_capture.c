@@ -0,0 +1,267 @@
+/*
+ * test_sdl2_capture.c — Unit tests for asynchronous frame capture.
+ *
+ * Captures frames from SDL's software renderer on an in-memory surface
+ * into a fresh temporary directory, then checks the PNG files the encoder
+ * thread wrote.  SDL_VIDEODRIVER is set to dummy in CMakeLists.txt for
+ * consistency with the other SDL tests.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+
+#include <SDL2/SDL_image.h>
+
+#include "sdl2_capture.h"
+
+#define CANVAS_W 32
+#define CANVAS_H 24
+
+/* =========================================================================
+ * Fixture: software renderer on a surface, temporary output directory
+ * ========================================================================= */
+
+typedef struct
+{
+    SDL_Surface *surface;
+    SDL_Renderer *renderer;
+    char dir[64];
+    char path[128];
+} fixture_t;
+
+static int setup(void **state)
+{
+    static fixture_t fx;
+    fx.surface =
+        SDL_CreateRGBSurfaceWithFormat(0, CANVAS_W, CANVAS_H, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (fx.surface == NULL)
+    {
+        return -1;
+    }
+    fx.renderer = SDL_CreateSoftwareRenderer(fx.surface);
+    if (fx.renderer == NULL)
+    {
+        SDL_FreeSurface(fx.surface);
+        return -1;
+    }
+    snprintf(fx.dir, sizeof(fx.dir), "/tmp/xboing_test_cap_XXXXXX");
+    if (mkdtemp(fx.dir) == NULL)
+    {
+        return -1;
+    }
+    *state = &fx;
+    return 0;
+}
+
+static int teardown(void **state)
+{
+    fixture_t *fx = *state;
+    char path[128];
+    for (int i = 0; i < 100; i++)
+    {
+        snprintf(path, sizeof(path), "%s/frame-%03d.png", fx->dir, i);
+        (void)remove(path);
+    }
+    (void)rmdir(fx->dir);
+    SDL_DestroyRenderer(fx->renderer);
+    SDL_FreeSurface(fx->surface);
+    return 0;
+}
+
+/* Path of frame n in the fixture's directory (reused buffer). */
+static const char *frame_path(fixture_t *fx, int n)
+{
+    snprintf(fx->path, sizeof(fx->path), "%s/frame-%03d.png", fx->dir, n);
+    return fx->path;
+}
+
+static sdl2_capture_t *create_capture(int buffers)
+{
+    sdl2_capture_config_t cfg = sdl2_capture_config_defaults();
+    cfg.buffers = buffers;
+    sdl2_capture_status_t st = SDL2CAP_ERR_NULL_ARG;
+    sdl2_capture_t *cap = sdl2_capture_create(&cfg, &st);
+    assert_non_null(cap);
+    assert_int_equal(st, SDL2CAP_OK);
+    return cap;
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle
+ * ========================================================================= */
+
+/* TC-01: Defaults, bad configs and NULL arguments. */
+static void test_create_and_null(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_capture_config_t cfg = sdl2_capture_config_defaults();
+    assert_int_equal(cfg.buffers, 4);
+
+    sdl2_capture_status_t st = SDL2CAP_OK;
+    assert_null(sdl2_capture_create(NULL, &st));
+    assert_int_equal(st, SDL2CAP_ERR_NULL_ARG);
+    cfg.buffers = 0;
+    assert_null(sdl2_capture_create(&cfg, &st));
+    assert_int_equal(st, SDL2CAP_ERR_BAD_CONFIG);
+
+    sdl2_capture_t *cap = create_capture(2);
+    assert_int_equal(sdl2_capture_frame(NULL, fx->renderer, "x.png"), SDL2CAP_ERR_NULL_ARG);
+    assert_int_equal(sdl2_capture_frame(cap, NULL, "x.png"), SDL2CAP_ERR_NULL_ARG);
+    assert_int_equal(sdl2_capture_frame(cap, fx->renderer, NULL), SDL2CAP_ERR_NULL_ARG);
+    sdl2_capture_destroy(cap);
+
+    sdl2_capture_destroy(NULL);
+    sdl2_capture_flush(NULL);
+    assert_int_equal(sdl2_capture_written(NULL), 0);
+    assert_int_equal(sdl2_capture_failed(NULL), 0);
+}
+
+/* TC-02: Destroy writes everything still queued. */
+static void test_destroy_drains(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_capture_t *cap = create_capture(4);
+    for (int i = 0; i < 4; i++)
+    {
+        assert_int_equal(sdl2_capture_frame(cap, fx->renderer, frame_path(fx, i)), SDL2CAP_OK);
+    }
+    sdl2_capture_destroy(cap);
+
+    for (int i = 0; i < 4; i++)
+    {
+        assert_int_equal(access(frame_path(fx, i), F_OK), 0);
+    }
+}
+
+/* =========================================================================
+ * Group 2: Capture
+ * ========================================================================= */
+
+/* TC-03: More frames than buffers: the render side waits, nothing is lost. */
+static void test_more_frames_than_buffers(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_capture_t *cap = create_capture(2);
+    for (int i = 0; i < 20; i++)
+    {
+        assert_int_equal(sdl2_capture_frame(cap, fx->renderer, frame_path(fx, i)), SDL2CAP_OK);
+    }
+    sdl2_capture_flush(cap);
+    assert_int_equal(sdl2_capture_written(cap), 20);
+    assert_int_equal(sdl2_capture_failed(cap), 0);
+    for (int i = 0; i < 20; i++)
+    {
+        assert_int_equal(access(frame_path(fx, i), F_OK), 0);
+    }
+    sdl2_capture_destroy(cap);
+}
+
+/* TC-04: A path that cannot be written counts as a failure. */
+static void test_write_failure_counted(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_capture_t *cap = create_capture(2);
+    char bad[160];
+    snprintf(bad, sizeof(bad), "%s/missing/frame.png", fx->dir);
+    assert_int_equal(sdl2_capture_frame(cap, fx->renderer, bad), SDL2CAP_OK);
+    sdl2_capture_flush(cap);
+    assert_int_equal(sdl2_capture_written(cap), 0);
+    assert_int_equal(sdl2_capture_failed(cap), 1);
+    sdl2_capture_destroy(cap);
+}
+
+/* TC-05: Over-long paths are refused before any pixels are read. */
+static void test_path_too_long(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_capture_t *cap = create_capture(1);
+    char *path = malloc(SDL2CAP_MAX_PATH + 1);
+    assert_non_null(path);
+    memset(path, 'a', SDL2CAP_MAX_PATH);
+    path[SDL2CAP_MAX_PATH] = '\0';
+    assert_int_equal(sdl2_capture_frame(cap, fx->renderer, path), SDL2CAP_ERR_PATH_TOO_LONG);
+    free(path);
+    sdl2_capture_destroy(cap);
+}
+
+/* TC-06: The PNG holds the frame as drawn. */
+static void test_png_matches_frame(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_SetRenderDrawColor(fx->renderer, 0, 0, 255, 255);
+    SDL_RenderClear(fx->renderer);
+    SDL_SetRenderDrawColor(fx->renderer, 255, 0, 0, 255);
+    SDL_Rect r = {4, 4, 8, 8};
+    SDL_RenderFillRect(fx->renderer, &r);
+
+    sdl2_capture_t *cap = create_capture(1);
+    assert_int_equal(sdl2_capture_frame(cap, fx->renderer, frame_path(fx, 0)), SDL2CAP_OK);
+    sdl2_capture_destroy(cap);
+
+    SDL_Surface *png = IMG_Load(frame_path(fx, 0));
+    assert_non_null(png);
+    assert_int_equal(png->w, CANVAS_W);
+    assert_int_equal(png->h, CANVAS_H);
+    SDL_Surface *rgba = SDL_ConvertSurfaceFormat(png, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(png);
+    assert_non_null(rgba);
+    const uint8_t *row = (const uint8_t *)rgba->pixels + 5 * rgba->pitch;
+    assert_int_equal(row[5 * 4 + 0], 255); /* inside the red square */
+    assert_int_equal(row[5 * 4 + 2], 0);
+    assert_int_equal(row[20 * 4 + 0], 0); /* blue background */
+    assert_int_equal(row[20 * 4 + 2], 255);
+    SDL_FreeSurface(rgba);
+}
+
+/* =========================================================================
+ * Group 3: Status strings
+ * ========================================================================= */
+
+/* TC-07: Every status has a string. */
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_OK), "OK");
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_ERR_NULL_ARG), "NULL argument");
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_ERR_BAD_CONFIG),
+                        "invalid configuration");
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_ERR_ALLOC_FAILED),
+                        "allocation failed");
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_ERR_THREAD_FAILED),
+                        "cannot start encoder thread");
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_ERR_PATH_TOO_LONG), "path too long");
+    assert_string_equal(sdl2_capture_status_string(SDL2CAP_ERR_READ_FAILED),
+                        "cannot read frame pixels");
+    assert_string_equal(sdl2_capture_status_string((sdl2_capture_status_t)99),
+                        "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle */
+        cmocka_unit_test_setup_teardown(test_create_and_null, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_destroy_drains, setup, teardown),
+        /* Group 2: Capture */
+        cmocka_unit_test_setup_teardown(test_more_frames_than_buffers, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_write_failure_counted, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_path_too_long, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_png_matches_frame, setup, teardown),
+        /* Group 3: Status strings */
+        cmocka_unit_test(test_status_strings),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -524,6 +524,188 @@ static void test_status_string_unknown(void **state)
     assert_non_null(sdl2_cli_status_string((sdl2_cli_status_t)999));
 }
 
+/* =========================================================================
+ * Group 12: Replay options
+ * ========================================================================= */
+
+static void test_replay_defaults_off(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_null(cfg.record_path);
+    assert_null(cfg.replay_path);
+    assert_false(cfg.replay_fast);
+}
+
+static void test_record_path(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    char *const argv[] = {"xboing", "-record", "run.xbr"};
+    assert_int_equal(sdl2_cli_parse(3, argv, &cfg, NULL), SDL2C_OK);
+    assert_string_equal(cfg.record_path, "run.xbr");
+    assert_null(cfg.replay_path);
+}
+
+static void test_replay_path_fast(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    char *const argv[] = {"xboing", "-replay", "run.xbr", "-replay-fast"};
+    assert_int_equal(sdl2_cli_parse(4, argv, &cfg, NULL), SDL2C_OK);
+    assert_string_equal(cfg.replay_path, "run.xbr");
+    assert_null(cfg.record_path);
+    assert_true(cfg.replay_fast);
+}
+
+static void test_record_missing_value(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    const char *bad = NULL;
+    char *const argv[] = {"xboing", "-replay"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, &bad), SDL2C_ERR_MISSING_VALUE);
+    assert_string_equal(bad, "-replay");
+}
+
+static void test_turbo_flag(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_false(cfg.turbo);
+    char *const argv[] = {"xboing", "-replay", "run.xbr", "-turbo"};
+    assert_int_equal(sdl2_cli_parse(4, argv, &cfg, NULL), SDL2C_OK);
+    assert_true(cfg.turbo);
+    assert_false(cfg.replay_fast);
+}
+
+static void test_offscreen_flag(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_false(cfg.offscreen);
+    char *const argv[] = {"xboing", "-offscreen"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, NULL), SDL2C_OK);
+    assert_true(cfg.offscreen);
+}
+
+static void test_noatlas_flag(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_true(cfg.atlas);
+    char *const argv[] = {"xboing", "-noatlas"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, NULL), SDL2C_OK);
+    assert_false(cfg.atlas);
+}
+
+static void test_nolayers_flag(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_true(cfg.layers);
+    char *const argv[] = {"xboing", "-nolayers"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, NULL), SDL2C_OK);
+    assert_false(cfg.layers);
+}
+
+static void test_nopace_flag(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_true(cfg.pace);
+    char *const argv[] = {"xboing", "-nopace"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, NULL), SDL2C_OK);
+    assert_false(cfg.pace);
+}
+
+static void test_startup_profile_flag(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_false(cfg.startup_profile);
+    char *const argv[] = {"xboing", "-startup-profile"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, NULL), SDL2C_OK);
+    assert_true(cfg.startup_profile);
+}
+
+static void test_trace_path(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_null(cfg.trace_path);
+    char *const argv[] = {"xboing", "-trace", "frames.json"};
+    assert_int_equal(sdl2_cli_parse(3, argv, &cfg, NULL), SDL2C_OK);
+    assert_string_equal(cfg.trace_path, "frames.json");
+}
+
+static void test_trace_missing_value(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    const char *bad = NULL;
+    char *const argv[] = {"xboing", "-trace"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, &bad), SDL2C_ERR_MISSING_VALUE);
+    assert_string_equal(bad, "-trace");
+}
+
+static void test_asset_pack_path(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_null(cfg.asset_pack_path);
+    char *const argv[] = {"xboing", "-asset-pack", "build/xboing.pak"};
+    assert_int_equal(sdl2_cli_parse(3, argv, &cfg, NULL), SDL2C_OK);
+    assert_string_equal(cfg.asset_pack_path, "build/xboing.pak");
+
+    const char *bad = NULL;
+    char *const missing[] = {"xboing", "-asset-pack"};
+    assert_int_equal(sdl2_cli_parse(2, missing, &cfg, &bad), SDL2C_ERR_MISSING_VALUE);
+    assert_string_equal(bad, "-asset-pack");
+}
+
+static void test_texture_budget(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_int_equal(cfg.texture_budget, -1);
+    char *const argv[] = {"xboing", "-texture-budget", "24"};
+    assert_int_equal(sdl2_cli_parse(3, argv, &cfg, NULL), SDL2C_OK);
+    assert_int_equal(cfg.texture_budget, 24);
+    char *const unlimited[] = {"xboing", "-texture-budget", "0"};
+    assert_int_equal(sdl2_cli_parse(3, unlimited, &cfg, NULL), SDL2C_OK);
+    assert_int_equal(cfg.texture_budget, 0);
+
+    const char *bad = NULL;
+    char *const negative[] = {"xboing", "-texture-budget", "-1"};
+    assert_int_equal(sdl2_cli_parse(3, negative, &cfg, &bad), SDL2C_ERR_INVALID_VALUE);
+    assert_string_equal(bad, "-texture-budget");
+    char *const huge[] = {"xboing", "-texture-budget", "4097"};
+    assert_int_equal(sdl2_cli_parse(3, huge, &cfg, &bad), SDL2C_ERR_INVALID_VALUE);
+    char *const missing[] = {"xboing", "-texture-budget"};
+    assert_int_equal(sdl2_cli_parse(2, missing, &cfg, &bad), SDL2C_ERR_MISSING_VALUE);
+}
+
+static void test_capture_dir(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    assert_null(cfg.capture_dir);
+    char *const argv[] = {"xboing", "-visual-capture", "intro", "-capture-dir", "shots"};
+    assert_int_equal(sdl2_cli_parse(5, argv, &cfg, NULL), SDL2C_OK);
+    assert_string_equal(cfg.capture_dir, "shots");
+}
+
+static void test_capture_dir_missing_value(void **state)
+{
+    (void)state;
+    sdl2_cli_config_t cfg = sdl2_cli_config_defaults();
+    const char *bad = NULL;
+    char *const argv[] = {"xboing", "-capture-dir"};
+    assert_int_equal(sdl2_cli_parse(2, argv, &cfg, &bad), SDL2C_ERR_MISSING_VALUE);
+    assert_string_equal(bad, "-capture-dir");
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -600,6 +782,25 @@ int main(void)
         cmocka_unit_test(test_status_string_unknown),
     };
 
+    const struct CMUnitTest replay_tests[] = {
+        cmocka_unit_test(test_replay_defaults_off),
+        cmocka_unit_test(test_record_path),
+        cmocka_unit_test(test_replay_path_fast),
+        cmocka_unit_test(test_record_missing_value),
+        cmocka_unit_test(test_turbo_flag),
+        cmocka_unit_test(test_offscreen_flag),
+        cmocka_unit_test(test_noatlas_flag),
+        cmocka_unit_test(test_nolayers_flag),
+        cmocka_unit_test(test_nopace_flag),
+        cmocka_unit_test(test_startup_profile_flag),
+        cmocka_unit_test(test_asset_pack_path),
+        cmocka_unit_test(test_texture_budget),
+        cmocka_unit_test(test_trace_path),
+        cmocka_unit_test(test_trace_missing_value),
+        cmocka_unit_test(test_capture_dir),
+        cmocka_unit_test(test_capture_dir_missing_value),
+    };
+
     int failed = 0;
     failed += cmocka_run_group_tests_name("defaults", defaults_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("null_args", null_tests, NULL, NULL);
@@ -612,6 +813,7 @@ int main(void)
     failed += cmocka_run_group_tests_name("errors", error_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("combinations", combo_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("status_strings", status_tests, NULL, NULL);
+    failed += cmocka_run_group_tests_name("replay", replay_tests, NULL, NULL);
 
     return failed;
 }
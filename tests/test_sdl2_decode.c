@@ -0,0 +1,339 @@
+/*
+ * test_sdl2_decode.c — Unit tests for the asset decode worker pool.
+ *
+ * The decode functions here stand in for IMG_Load and Mix_LoadWAV: they
+ * copy the path, fail on request, or sleep first, so the tests exercise
+ * the pool's hand-off without touching any files.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "sdl2_decode.h"
+
+/* =========================================================================
+ * Fake decoders
+ * ========================================================================= */
+
+/* Items released by free_item(), only ever called from the test thread. */
+static int freed_items;
+
+static void *copy_path(const char *path)
+{
+    size_t len = strlen(path) + 1;
+    char *item = malloc(len);
+    if (item != NULL)
+    {
+        memcpy(item, path, len);
+    }
+    return item;
+}
+
+static void *always_fail(const char *path)
+{
+    (void)path;
+    return NULL;
+}
+
+static void *slow_copy_path(const char *path)
+{
+    SDL_Delay(30);
+    return copy_path(path);
+}
+
+static void free_item(void *item)
+{
+    free(item);
+    freed_items++;
+}
+
+static sdl2_decode_t *create_pool(int threads)
+{
+    sdl2_decode_config_t cfg = sdl2_decode_config_defaults();
+    cfg.threads = threads;
+    sdl2_decode_status_t st = SDL2D_ERR_NULL_ARG;
+    sdl2_decode_t *ctx = sdl2_decode_create(&cfg, &st);
+    assert_non_null(ctx);
+    assert_int_equal(st, SDL2D_OK);
+    return ctx;
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle
+ * ========================================================================= */
+
+static void test_config_defaults(void **state)
+{
+    (void)state;
+    sdl2_decode_config_t cfg = sdl2_decode_config_defaults();
+    assert_int_equal(cfg.threads, 0);
+}
+
+static void test_create_rejects_bad_config(void **state)
+{
+    (void)state;
+    sdl2_decode_status_t st = SDL2D_OK;
+    assert_null(sdl2_decode_create(NULL, &st));
+    assert_int_equal(st, SDL2D_ERR_NULL_ARG);
+
+    sdl2_decode_config_t cfg = sdl2_decode_config_defaults();
+    cfg.threads = -1;
+    assert_null(sdl2_decode_create(&cfg, &st));
+    assert_int_equal(st, SDL2D_ERR_BAD_CONFIG);
+    cfg.threads = SDL2D_MAX_THREADS + 1;
+    assert_null(sdl2_decode_create(&cfg, &st));
+    assert_int_equal(st, SDL2D_ERR_BAD_CONFIG);
+}
+
+static void test_thread_count(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(3);
+    assert_int_equal(sdl2_decode_threads(ctx), 3);
+    sdl2_decode_destroy(ctx);
+
+    ctx = create_pool(0);
+    assert_true(sdl2_decode_threads(ctx) >= 1);
+    assert_true(sdl2_decode_threads(ctx) <= SDL2D_MAX_THREADS);
+    sdl2_decode_destroy(ctx);
+
+    assert_int_equal(sdl2_decode_threads(NULL), 0);
+    sdl2_decode_destroy(NULL);
+}
+
+/* =========================================================================
+ * Group 2: Submit and take
+ * ========================================================================= */
+
+static void test_submit_rejects_bad_args(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(1);
+    assert_int_equal(sdl2_decode_submit(NULL, 1, "k", "p", copy_path, free_item),
+                     SDL2D_ERR_NULL_ARG);
+    assert_int_equal(sdl2_decode_submit(ctx, 1, NULL, "p", copy_path, free_item),
+                     SDL2D_ERR_NULL_ARG);
+    assert_int_equal(sdl2_decode_submit(ctx, 1, "k", NULL, copy_path, free_item),
+                     SDL2D_ERR_NULL_ARG);
+    assert_int_equal(sdl2_decode_submit(ctx, 1, "k", "p", NULL, free_item), SDL2D_ERR_NULL_ARG);
+
+    char long_key[SDL2D_MAX_KEY + 1];
+    memset(long_key, 'k', sizeof(long_key) - 1);
+    long_key[sizeof(long_key) - 1] = '\0';
+    assert_int_equal(sdl2_decode_submit(ctx, 1, long_key, "p", copy_path, free_item),
+                     SDL2D_ERR_KEY_TOO_LONG);
+
+    sdl2_decode_stats_t stats;
+    sdl2_decode_get_stats(ctx, &stats);
+    assert_int_equal(stats.submitted, 0);
+    sdl2_decode_destroy(ctx);
+}
+
+/* Every file of a batch comes back exactly once, then take() says done. */
+static void test_take_returns_each_file_once(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(4);
+    enum
+    {
+        FILES = 100
+    };
+    for (int i = 0; i < FILES; i++)
+    {
+        char key[16];
+        char path[32];
+        snprintf(key, sizeof(key), "k%d", i);
+        snprintf(path, sizeof(path), "dir/k%d.png", i);
+        assert_int_equal(sdl2_decode_submit(ctx, 1, key, path, copy_path, free_item), SDL2D_OK);
+    }
+
+    bool seen[FILES] = {false};
+    sdl2_decode_result_t r;
+    int taken = 0;
+    while (sdl2_decode_take(ctx, 1, &r))
+    {
+        int i = atoi(r.key + 1);
+        assert_true(i >= 0 && i < FILES);
+        assert_false(seen[i]);
+        seen[i] = true;
+        assert_non_null(r.item);
+        assert_string_equal(r.item, r.path);
+        free(r.item);
+        taken++;
+    }
+    assert_int_equal(taken, FILES);
+    assert_false(sdl2_decode_take(ctx, 1, &r));
+
+    sdl2_decode_stats_t stats;
+    sdl2_decode_get_stats(ctx, &stats);
+    assert_int_equal(stats.submitted, FILES);
+    assert_int_equal(stats.decoded, FILES);
+    assert_int_equal(stats.failed, 0);
+    sdl2_decode_destroy(ctx);
+}
+
+/* One worker decodes in submission order, so results arrive in it too. */
+static void test_single_worker_keeps_order(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(1);
+    static const char *const keys[] = {"c", "a", "b"};
+    for (int i = 0; i < 3; i++)
+    {
+        assert_int_equal(sdl2_decode_submit(ctx, 7, keys[i], keys[i], copy_path, free_item),
+                         SDL2D_OK);
+    }
+    sdl2_decode_result_t r;
+    for (int i = 0; i < 3; i++)
+    {
+        assert_true(sdl2_decode_take(ctx, 7, &r));
+        assert_string_equal(r.key, keys[i]);
+        free(r.item);
+    }
+    assert_false(sdl2_decode_take(ctx, 7, &r));
+    sdl2_decode_destroy(ctx);
+}
+
+/* take() waits for a decode still running rather than giving up. */
+static void test_take_waits_for_slow_decode(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(1);
+    assert_int_equal(sdl2_decode_submit(ctx, 1, "slow", "slow.png", slow_copy_path, free_item),
+                     SDL2D_OK);
+    sdl2_decode_result_t r;
+    assert_true(sdl2_decode_take(ctx, 1, &r));
+    assert_string_equal(r.item, "slow.png");
+    free(r.item);
+
+    sdl2_decode_stats_t stats;
+    sdl2_decode_get_stats(ctx, &stats);
+    assert_true(stats.work_us >= 20000U);
+    sdl2_decode_destroy(ctx);
+}
+
+/* A failed decode is still handed back, with no item, and counted. */
+static void test_failed_decode(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(2);
+    assert_int_equal(sdl2_decode_submit(ctx, 1, "bad", "bad.png", always_fail, free_item),
+                     SDL2D_OK);
+    sdl2_decode_result_t r;
+    assert_true(sdl2_decode_take(ctx, 1, &r));
+    assert_string_equal(r.key, "bad");
+    assert_null(r.item);
+    assert_false(sdl2_decode_take(ctx, 1, &r));
+
+    sdl2_decode_stats_t stats;
+    sdl2_decode_get_stats(ctx, &stats);
+    assert_int_equal(stats.decoded, 1);
+    assert_int_equal(stats.failed, 1);
+    sdl2_decode_destroy(ctx);
+}
+
+/* Batches are taken independently of one another. */
+static void test_batches_are_separate(void **state)
+{
+    (void)state;
+    sdl2_decode_t *ctx = create_pool(2);
+    assert_int_equal(sdl2_decode_submit(ctx, 1, "img", "img.png", copy_path, free_item),
+                     SDL2D_OK);
+    assert_int_equal(sdl2_decode_submit(ctx, 2, "snd", "snd.wav", copy_path, free_item),
+                     SDL2D_OK);
+
+    sdl2_decode_result_t r;
+    assert_false(sdl2_decode_take(ctx, 3, &r));
+    assert_true(sdl2_decode_take(ctx, 2, &r));
+    assert_string_equal(r.key, "snd");
+    free(r.item);
+    assert_false(sdl2_decode_take(ctx, 2, &r));
+    assert_true(sdl2_decode_take(ctx, 1, &r));
+    assert_string_equal(r.key, "img");
+    free(r.item);
+    sdl2_decode_destroy(ctx);
+}
+
+/* Destroy releases whatever was decoded but never taken. */
+static void test_destroy_frees_untaken(void **state)
+{
+    (void)state;
+    freed_items = 0;
+    sdl2_decode_t *ctx = create_pool(1);
+    for (int i = 0; i < 5; i++)
+    {
+        assert_int_equal(sdl2_decode_submit(ctx, 1, "k", "p", copy_path, free_item), SDL2D_OK);
+    }
+    /* One worker runs jobs in submission order, so once this marker is
+     * back every file of batch 1 has been decoded. */
+    assert_int_equal(sdl2_decode_submit(ctx, 2, "m", "m", copy_path, free_item), SDL2D_OK);
+    sdl2_decode_result_t r;
+    assert_true(sdl2_decode_take(ctx, 2, &r));
+    free(r.item);
+
+    sdl2_decode_destroy(ctx);
+    assert_int_equal(freed_items, 5);
+}
+
+/* =========================================================================
+ * Group 3: Queries and utility
+ * ========================================================================= */
+
+static void test_null_queries(void **state)
+{
+    (void)state;
+    sdl2_decode_result_t r;
+    assert_false(sdl2_decode_take(NULL, 1, &r));
+
+    sdl2_decode_stats_t stats;
+    memset(&stats, 0xff, sizeof(stats));
+    sdl2_decode_get_stats(NULL, &stats);
+    assert_int_equal(stats.submitted, 0);
+    assert_int_equal(stats.work_us, 0);
+    sdl2_decode_get_stats(NULL, NULL);
+}
+
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(sdl2_decode_status_string(SDL2D_OK), "OK");
+    assert_string_equal(sdl2_decode_status_string(SDL2D_ERR_BAD_CONFIG),
+                        "invalid configuration");
+    assert_string_equal(sdl2_decode_status_string(SDL2D_ERR_THREAD_FAILED),
+                        "cannot start decode thread");
+    assert_string_equal(sdl2_decode_status_string((sdl2_decode_status_t)99), "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle */
+        cmocka_unit_test(test_config_defaults),
+        cmocka_unit_test(test_create_rejects_bad_config),
+        cmocka_unit_test(test_thread_count),
+        /* Group 2: Submit and take */
+        cmocka_unit_test(test_submit_rejects_bad_args),
+        cmocka_unit_test(test_take_returns_each_file_once),
+        cmocka_unit_test(test_single_worker_keeps_order),
+        cmocka_unit_test(test_take_waits_for_slow_decode),
+        cmocka_unit_test(test_failed_decode),
+        cmocka_unit_test(test_batches_are_separate),
+        cmocka_unit_test(test_destroy_frees_untaken),
+        /* Group 3: Queries and utility */
+        cmocka_unit_test(test_null_queries),
+        cmocka_unit_test(test_status_strings),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
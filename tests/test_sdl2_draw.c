@@ -0,0 +1,167 @@
+/*
+ * test_sdl2_draw.c — Unit tests for counted draw calls.
+ *
+ * Draws through SDL's software renderer onto an in-memory surface, so the
+ * wrappers can be checked to still draw as well as count.  SDL_VIDEODRIVER
+ * is set to dummy in CMakeLists.txt for consistency with the other SDL
+ * tests.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include "sdl2_draw.h"
+
+#define CANVAS_W 32
+#define CANVAS_H 32
+
+/* =========================================================================
+ * Fixture: software renderer on a surface, two small textures
+ * ========================================================================= */
+
+typedef struct
+{
+    SDL_Surface *surface;
+    SDL_Renderer *renderer;
+    SDL_Texture *tex_a;
+    SDL_Texture *tex_b;
+} fixture_t;
+
+static SDL_Texture *make_texture(SDL_Renderer *renderer)
+{
+    return SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 4, 4);
+}
+
+static int setup(void **state)
+{
+    static fixture_t fx;
+    fx.surface =
+        SDL_CreateRGBSurfaceWithFormat(0, CANVAS_W, CANVAS_H, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (fx.surface == NULL)
+    {
+        return -1;
+    }
+    fx.renderer = SDL_CreateSoftwareRenderer(fx.surface);
+    if (fx.renderer == NULL)
+    {
+        SDL_FreeSurface(fx.surface);
+        return -1;
+    }
+    fx.tex_a = make_texture(fx.renderer);
+    fx.tex_b = make_texture(fx.renderer);
+    if (fx.tex_a == NULL || fx.tex_b == NULL)
+    {
+        return -1;
+    }
+    sdl2_draw_take_stats(NULL);
+    *state = &fx;
+    return 0;
+}
+
+static int teardown(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_DestroyTexture(fx->tex_a);
+    SDL_DestroyTexture(fx->tex_b);
+    SDL_DestroyRenderer(fx->renderer);
+    SDL_FreeSurface(fx->surface);
+    return 0;
+}
+
+static sdl2_draw_stats_t take(void)
+{
+    sdl2_draw_stats_t st;
+    sdl2_draw_take_stats(&st);
+    return st;
+}
+
+/* =========================================================================
+ * Group 1: Counting
+ * ========================================================================= */
+
+/* TC-01: Every wrapper counts one draw. */
+static void test_each_call_counts(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_Rect r = {0, 0, 4, 4};
+    assert_int_equal(sdl2_draw_copy(fx->renderer, fx->tex_a, NULL, &r), 0);
+    assert_int_equal(sdl2_draw_fill_rect(fx->renderer, &r), 0);
+    assert_int_equal(sdl2_draw_line(fx->renderer, 0, 0, 3, 3), 0);
+    assert_int_equal(take().draw_calls, 3);
+}
+
+/* TC-02: Only a change of texture counts as a switch; fills have none. */
+static void test_texture_switches(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_Rect r = {0, 0, 4, 4};
+    sdl2_draw_copy(fx->renderer, fx->tex_a, NULL, &r); /* switch: first draw */
+    sdl2_draw_copy(fx->renderer, fx->tex_a, NULL, &r);
+    sdl2_draw_copy(fx->renderer, fx->tex_b, NULL, &r); /* switch */
+    sdl2_draw_fill_rect(fx->renderer, &r);             /* switch: untextured */
+    sdl2_draw_line(fx->renderer, 0, 0, 1, 1);
+    sdl2_draw_copy(fx->renderer, fx->tex_b, NULL, &r); /* switch */
+
+    sdl2_draw_stats_t st = take();
+    assert_int_equal(st.draw_calls, 6);
+    assert_int_equal(st.texture_switches, 4);
+}
+
+/* TC-03: Taking resets the counters and the last texture. */
+static void test_take_resets(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_Rect r = {0, 0, 4, 4};
+    sdl2_draw_copy(fx->renderer, fx->tex_a, NULL, &r);
+    sdl2_draw_take_stats(NULL);
+
+    sdl2_draw_stats_t st = take();
+    assert_int_equal(st.draw_calls, 0);
+    assert_int_equal(st.texture_switches, 0);
+
+    sdl2_draw_copy(fx->renderer, fx->tex_a, NULL, &r);
+    assert_int_equal(take().texture_switches, 1);
+}
+
+/* =========================================================================
+ * Group 2: Drawing
+ * ========================================================================= */
+
+/* TC-04: The wrappers still draw. */
+static void test_fill_draws(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_SetRenderDrawColor(fx->renderer, 0, 0, 0, 255);
+    SDL_RenderClear(fx->renderer);
+    SDL_SetRenderDrawColor(fx->renderer, 255, 0, 0, 255);
+    SDL_Rect r = {8, 8, 4, 4};
+    sdl2_draw_fill_rect(fx->renderer, &r);
+
+    uint32_t px = 0;
+    SDL_Rect at = {9, 9, 1, 1};
+    assert_int_equal(
+        SDL_RenderReadPixels(fx->renderer, &at, SDL_PIXELFORMAT_ARGB8888, &px, (int)sizeof(px)), 0);
+    assert_int_equal(px, 0xFFFF0000u);
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Counting */
+        cmocka_unit_test_setup_teardown(test_each_call_counts, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_texture_switches, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_take_resets, setup, teardown),
+        /* Group 2: Drawing */
+        cmocka_unit_test_setup_teardown(test_fill_draws, setup, teardown),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -10,7 +10,10 @@
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <cmocka.h>
 
@@ -27,6 +30,25 @@ static sdl2_renderer_t *create_renderer(void)
     return sdl2_renderer_create(&cfg);
 }
 
+/* Font context with the given text cache size and glyph strip setting. */
+static sdl2_font_t *create_cached_font_ctx(const sdl2_renderer_t *rctx, int cache_size, bool glyphs)
+{
+    sdl2_font_config_t cfg = sdl2_font_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.text_cache_size = cache_size;
+    cfg.glyph_atlas = glyphs;
+    sdl2_font_status_t status;
+    return sdl2_font_create(&cfg, &status);
+}
+
+static sdl2_font_cache_stats_t cache_stats(const sdl2_font_t *fctx)
+{
+    sdl2_font_cache_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    assert_int_equal(sdl2_font_cache_stats(fctx, &stats), SDL2F_OK);
+    return stats;
+}
+
 /*
  * Create a font context using default config and the test renderer.
  * Returns NULL if either renderer or font creation fails.
@@ -52,6 +74,9 @@ static void test_config_defaults(void **state)
     assert_null(cfg.renderer);
     assert_non_null(cfg.font_dir);
     assert_string_equal(cfg.font_dir, SDL2F_DEFAULT_FONT_DIR);
+    assert_int_equal(cfg.text_cache_size, SDL2F_TEXT_CACHE_SIZE);
+    assert_true(cfg.glyph_atlas);
+    assert_null(cfg.pack);
 }
 
 /* =========================================================================
@@ -379,6 +404,250 @@ static void test_status_strings(void **state)
     }
 }
 
+/* =========================================================================
+ * Group 7: Text cache and glyph strip
+ * ========================================================================= */
+
+static const SDL_Color white = {255, 255, 255, 255};
+
+/* TC-21: cache_stats() rejects NULL. */
+static void test_cache_stats_null_args(void **state)
+{
+    (void)state;
+    sdl2_font_cache_stats_t stats;
+    assert_int_equal(sdl2_font_cache_stats(NULL, &stats), SDL2F_ERR_NULL_ARG);
+
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_font_t *fctx = create_font_ctx(rctx);
+    assert_non_null(fctx);
+    assert_int_equal(sdl2_font_cache_stats(fctx, NULL), SDL2F_ERR_NULL_ARG);
+
+    sdl2_font_destroy(fctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-22: The second draw of a string is a hit; font and colour are part
+ * of the key. */
+static void test_cache_hit_on_repeat(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_font_t *fctx = create_cached_font_ctx(rctx, 8, true);
+    assert_non_null(fctx);
+
+    SDL_Color red = {255, 0, 0, 255};
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "Bonus", 0, 0, white), SDL2F_OK);
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "Bonus", 5, 5, white), SDL2F_OK);
+    sdl2_font_cache_stats_t st = cache_stats(fctx);
+    assert_int_equal(st.misses, 1);
+    assert_int_equal(st.hits, 1);
+    assert_int_equal(st.entries, 1);
+
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "Bonus", 0, 0, red), SDL2F_OK);
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_DATA, "Bonus", 0, 0, white), SDL2F_OK);
+    st = cache_stats(fctx);
+    assert_int_equal(st.misses, 3);
+    assert_int_equal(st.entries, 3);
+
+    sdl2_font_destroy(fctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-23: A shadow draw caches the black shadow and the foreground; the
+ * centred variant reuses both. */
+static void test_cache_shadow_centred(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_font_t *fctx = create_cached_font_ctx(rctx, 8, true);
+    assert_non_null(fctx);
+
+    assert_int_equal(sdl2_font_draw_shadow(fctx, SDL2F_FONT_TITLE, "Game Over", 0, 0, white),
+                     SDL2F_OK);
+    assert_int_equal(
+        sdl2_font_draw_shadow_centred(fctx, SDL2F_FONT_TITLE, "Game Over", 10, white, 495),
+        SDL2F_OK);
+    sdl2_font_cache_stats_t st = cache_stats(fctx);
+    assert_int_equal(st.misses, 2);
+    assert_int_equal(st.hits, 2);
+    assert_int_equal(st.entries, 2);
+
+    sdl2_font_destroy(fctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-24: A full cache evicts the least recently used string. */
+static void test_cache_evicts_lru(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_font_t *fctx = create_cached_font_ctx(rctx, 2, true);
+    assert_non_null(fctx);
+
+    sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "alpha", 0, 0, white);
+    sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "beta", 0, 0, white);
+    sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "alpha", 0, 0, white); /* alpha now newest */
+    sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "gamma", 0, 0, white); /* evicts beta */
+    sdl2_font_cache_stats_t st = cache_stats(fctx);
+    assert_int_equal(st.evictions, 1);
+    assert_int_equal(st.entries, 2);
+    assert_int_equal(st.hits, 1);
+
+    sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "alpha", 0, 0, white);
+    assert_int_equal(cache_stats(fctx).hits, 2);
+    sdl2_font_draw(fctx, SDL2F_FONT_TEXT, "beta", 0, 0, white);
+    st = cache_stats(fctx);
+    assert_int_equal(st.hits, 2);
+    assert_int_equal(st.misses, 4);
+    assert_int_equal(st.evictions, 2);
+
+    sdl2_font_destroy(fctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-25: With the cache disabled, or for over-long text, every draw
+ * renders. */
+static void test_cache_bypass(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+
+    sdl2_font_t *off = create_cached_font_ctx(rctx, 0, true);
+    assert_non_null(off);
+    sdl2_font_draw(off, SDL2F_FONT_TEXT, "Bonus", 0, 0, white);
+    sdl2_font_draw(off, SDL2F_FONT_TEXT, "Bonus", 0, 0, white);
+    sdl2_font_cache_stats_t st = cache_stats(off);
+    assert_int_equal(st.misses, 2);
+    assert_int_equal(st.hits, 0);
+    assert_int_equal(st.entries, 0);
+    sdl2_font_destroy(off);
+
+    sdl2_font_t *fctx = create_cached_font_ctx(rctx, 8, true);
+    assert_non_null(fctx);
+    char longtext[SDL2F_TEXT_CACHE_MAX_LEN + 2];
+    memset(longtext, 'x', sizeof(longtext) - 1);
+    longtext[sizeof(longtext) - 1] = '\0';
+    sdl2_font_draw(fctx, SDL2F_FONT_COPY, longtext, 0, 0, white);
+    sdl2_font_draw(fctx, SDL2F_FONT_COPY, longtext, 0, 0, white);
+    st = cache_stats(fctx);
+    assert_int_equal(st.misses, 2);
+    assert_int_equal(st.entries, 0);
+    sdl2_font_destroy(fctx);
+
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-26: Strings made of SDL2F_GLYPH_CHARS come from the glyph strip,
+ * unless glyph_atlas is off. */
+static void test_glyph_strip(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+
+    sdl2_font_t *fctx = create_cached_font_ctx(rctx, 8, true);
+    assert_non_null(fctx);
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_DATA, "01:59", 0, 0, white), SDL2F_OK);
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_DATA, "01:58", 0, 0, white), SDL2F_OK);
+    sdl2_font_cache_stats_t st = cache_stats(fctx);
+    assert_int_equal(st.glyph_draws, 2);
+    assert_int_equal(st.misses, 0);
+    assert_int_equal(st.entries, 0);
+
+    /* Any other character sends the whole string through the cache. */
+    assert_int_equal(sdl2_font_draw(fctx, SDL2F_FONT_DATA, "Level 3", 0, 0, white), SDL2F_OK);
+    st = cache_stats(fctx);
+    assert_int_equal(st.glyph_draws, 2);
+    assert_int_equal(st.misses, 1);
+    sdl2_font_destroy(fctx);
+
+    sdl2_font_t *plain = create_cached_font_ctx(rctx, 8, false);
+    assert_non_null(plain);
+    assert_int_equal(sdl2_font_draw(plain, SDL2F_FONT_DATA, "01:59", 0, 0, white), SDL2F_OK);
+    st = cache_stats(plain);
+    assert_int_equal(st.glyph_draws, 0);
+    assert_int_equal(st.misses, 1);
+    sdl2_font_destroy(plain);
+
+    sdl2_renderer_destroy(rctx);
+}
+
+/* =========================================================================
+ * Group 8: Asset pack (ADR-098)
+ * ========================================================================= */
+
+/* Add the TTF file name from assets/fonts to w as "fonts/<name>". */
+static void add_font_file(asset_pack_writer_t *w, const char *name)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", SDL2F_DEFAULT_FONT_DIR, name);
+    FILE *fp = fopen(path, "rb");
+    assert_non_null(fp);
+    assert_int_equal(fseek(fp, 0, SEEK_END), 0);
+    long size = ftell(fp);
+    assert_true(size > 0);
+    rewind(fp);
+    void *data = malloc((size_t)size);
+    assert_non_null(data);
+    assert_int_equal(fread(data, 1, (size_t)size, fp), (size_t)size);
+    fclose(fp);
+
+    char key[128];
+    snprintf(key, sizeof(key), "fonts/%s", name);
+    asset_pack_entry_t e = {key, data, (size_t)size, ASSET_PACK_RAW, {0, 0, 0}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    free(data);
+}
+
+/* TC-27: Fonts open from the pack without touching font_dir, with the
+ * same metrics as the loose files. */
+static void test_pack_fonts(void **state)
+{
+    (void)state;
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_non_null(w);
+    add_font_file(w, "LiberationSans-Bold.ttf");
+    add_font_file(w, "LiberationSans-Regular.ttf");
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/test_sdl2_font_%d.pak", (int)getpid());
+    assert_int_equal(asset_pack_writer_save(w, path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+    asset_pack_t *pack = asset_pack_open(path, NULL);
+    assert_non_null(pack);
+
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_font_t *loose = create_font_ctx(rctx);
+    assert_non_null(loose);
+
+    sdl2_font_config_t cfg = sdl2_font_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.font_dir = "/nonexistent/path/that/does/not/exist";
+    cfg.pack = pack;
+    sdl2_font_status_t status;
+    sdl2_font_t *packed = sdl2_font_create(&cfg, &status);
+    assert_non_null(packed);
+    assert_int_equal(status, SDL2F_OK);
+
+    for (int i = 0; i < SDL2F_FONT_COUNT; i++)
+    {
+        assert_int_equal(sdl2_font_line_height(packed, (sdl2_font_id_t)i),
+                         sdl2_font_line_height(loose, (sdl2_font_id_t)i));
+    }
+    assert_int_equal(sdl2_font_draw(packed, SDL2F_FONT_TEXT, "Bonus", 0, 0, white), SDL2F_OK);
+
+    sdl2_font_destroy(packed);
+    sdl2_font_destroy(loose);
+    sdl2_renderer_destroy(rctx);
+    asset_pack_close(pack);
+    unlink(path);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -412,6 +681,15 @@ int main(void)
         cmocka_unit_test(test_draw_empty_string),
         /* Group 6: Status strings */
         cmocka_unit_test(test_status_strings),
+        /* Group 7: Text cache and glyph strip */
+        cmocka_unit_test(test_cache_stats_null_args),
+        cmocka_unit_test(test_cache_hit_on_repeat),
+        cmocka_unit_test(test_cache_shadow_centred),
+        cmocka_unit_test(test_cache_evicts_lru),
+        cmocka_unit_test(test_cache_bypass),
+        cmocka_unit_test(test_glyph_strip),
+        /* Group 8: Asset pack */
+        cmocka_unit_test(test_pack_fonts),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -166,6 +166,12 @@ static void test_default_speed_bindings(void **state)
     assert_int_equal(sdl2_input_get_binding(ctx, SDL2I_SPEED_9, 0), SDL_SCANCODE_9);
 }
 
+static void test_default_hud_binding(void **state)
+{
+    const sdl2_input_t *ctx = (const sdl2_input_t *)*state;
+    assert_int_equal(sdl2_input_get_binding(ctx, SDL2I_TOGGLE_HUD, 0), SDL_SCANCODE_F3);
+}
+
 /* =========================================================================
  * Group 3: Key press / release
  * ========================================================================= */
@@ -587,6 +593,89 @@ static void test_unknown_status_string(void **state)
     assert_string_equal(s, "unknown status");
 }
 
+/* =========================================================================
+ * Group 10: Snapshots (replay)
+ * ========================================================================= */
+
+static void test_snapshot_captures_state(void **state)
+{
+    sdl2_input_t *ctx = (sdl2_input_t *)*state;
+    SDL_Event ev = make_key_event(SDL_KEYDOWN, SDL_SCANCODE_K, KMOD_LSHIFT);
+    sdl2_input_process_event(ctx, &ev);
+    ev = make_mouse_button(SDL_MOUSEBUTTONDOWN, SDL_BUTTON_LEFT, 120, 40);
+    sdl2_input_process_event(ctx, &ev);
+
+    sdl2_input_snapshot_t snap;
+    sdl2_input_get_snapshot(ctx, &snap);
+    assert_int_equal(snap.held, 1u << SDL2I_SHOOT);
+    assert_int_equal(snap.just_pressed, 1u << SDL2I_SHOOT);
+    assert_int_equal(snap.mouse_x, 120);
+    assert_int_equal(snap.mouse_y, 40);
+    assert_int_equal(snap.mouse_buttons, SDL_BUTTON(SDL_BUTTON_LEFT));
+    assert_int_equal(snap.mouse_just_pressed, SDL_BUTTON(SDL_BUTTON_LEFT));
+    assert_true(snap.shift);
+}
+
+static void test_snapshot_round_trip(void **state)
+{
+    sdl2_input_t *ctx = (sdl2_input_t *)*state;
+    sdl2_input_snapshot_t in = {
+        .held = (1u << SDL2I_LEFT) | (1u << SDL2I_SHOOT),
+        .just_pressed = 1u << SDL2I_SHOOT,
+        .mouse_x = 300,
+        .mouse_y = 500,
+        .mouse_buttons = SDL_BUTTON(SDL_BUTTON_RIGHT),
+        .mouse_just_pressed = 0,
+        .shift = true,
+    };
+    sdl2_input_apply_snapshot(ctx, &in);
+
+    assert_true(sdl2_input_pressed(ctx, SDL2I_LEFT));
+    assert_true(sdl2_input_just_pressed(ctx, SDL2I_SHOOT));
+    assert_false(sdl2_input_just_pressed(ctx, SDL2I_LEFT));
+    assert_true(sdl2_input_mouse_pressed(ctx, SDL_BUTTON_RIGHT));
+    assert_true(sdl2_input_shift_held(ctx));
+
+    sdl2_input_snapshot_t out;
+    sdl2_input_get_snapshot(ctx, &out);
+    assert_int_equal(out.held, in.held);
+    assert_int_equal(out.just_pressed, in.just_pressed);
+    assert_int_equal(out.mouse_x, in.mouse_x);
+    assert_int_equal(out.mouse_y, in.mouse_y);
+    assert_int_equal(out.mouse_buttons, in.mouse_buttons);
+    assert_int_equal(out.mouse_just_pressed, in.mouse_just_pressed);
+    assert_true(out.shift);
+}
+
+static void test_apply_snapshot_replaces_live_keys(void **state)
+{
+    sdl2_input_t *ctx = (sdl2_input_t *)*state;
+    SDL_Event ev = make_key_event(SDL_KEYDOWN, SDL_SCANCODE_LEFT, 0);
+    sdl2_input_process_event(ctx, &ev);
+
+    sdl2_input_snapshot_t empty;
+    memset(&empty, 0, sizeof(empty));
+    sdl2_input_apply_snapshot(ctx, &empty);
+    assert_false(sdl2_input_pressed(ctx, SDL2I_LEFT));
+
+    /* Releasing J (LEFT's second binding) must not find Left still held. */
+    ev = make_key_event(SDL_KEYDOWN, SDL_SCANCODE_J, 0);
+    sdl2_input_process_event(ctx, &ev);
+    ev = make_key_event(SDL_KEYUP, SDL_SCANCODE_J, 0);
+    sdl2_input_process_event(ctx, &ev);
+    assert_false(sdl2_input_pressed(ctx, SDL2I_LEFT));
+}
+
+static void test_snapshot_null_safe(void **state)
+{
+    (void)state;
+    sdl2_input_snapshot_t snap;
+    memset(&snap, 0, sizeof(snap));
+    sdl2_input_get_snapshot(NULL, &snap);
+    sdl2_input_apply_snapshot(NULL, &snap);
+    assert_int_equal(snap.held, 0);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -607,6 +696,7 @@ int main(void)
         cmocka_unit_test_setup_teardown(test_default_pause_binding, setup_input, teardown_input),
         cmocka_unit_test_setup_teardown(test_default_quit_binding, setup_input, teardown_input),
         cmocka_unit_test_setup_teardown(test_default_speed_bindings, setup_input, teardown_input),
+        cmocka_unit_test_setup_teardown(test_default_hud_binding, setup_input, teardown_input),
     };
 
     const struct CMUnitTest keypress_tests[] = {
@@ -674,6 +764,14 @@ int main(void)
                                         teardown_input),
     };
 
+    const struct CMUnitTest snapshot_tests[] = {
+        cmocka_unit_test_setup_teardown(test_snapshot_captures_state, setup_input, teardown_input),
+        cmocka_unit_test_setup_teardown(test_snapshot_round_trip, setup_input, teardown_input),
+        cmocka_unit_test_setup_teardown(test_apply_snapshot_replaces_live_keys, setup_input,
+                                        teardown_input),
+        cmocka_unit_test(test_snapshot_null_safe),
+    };
+
     int failed = 0;
     failed += cmocka_run_group_tests_name("lifecycle", lifecycle_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("default bindings", binding_tests, NULL, NULL);
@@ -685,5 +783,6 @@ int main(void)
     failed += cmocka_run_group_tests_name("names and strings", name_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("mouse just-pressed", mouse_just_pressed_tests, NULL,
                                           NULL);
+    failed += cmocka_run_group_tests_name("snapshots", snapshot_tests, NULL, NULL);
     return failed;
 }
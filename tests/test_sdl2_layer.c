@@ -0,0 +1,382 @@
+/*
+ * test_sdl2_layer.c — Unit tests for cached static layers.
+ *
+ * Renders through SDL's software renderer onto an in-memory surface, so
+ * composed pixels can be read back without a window.  SDL_VIDEODRIVER is
+ * set to dummy in CMakeLists.txt for consistency with the other SDL tests.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "sdl2_layer.h"
+
+#define CANVAS_W 64
+#define CANVAS_H 48
+
+/* =========================================================================
+ * Fixture: software renderer on a surface
+ * ========================================================================= */
+
+typedef struct
+{
+    SDL_Surface *surface;
+    SDL_Renderer *renderer;
+} fixture_t;
+
+static int setup(void **state)
+{
+    static fixture_t fx;
+    fx.surface =
+        SDL_CreateRGBSurfaceWithFormat(0, CANVAS_W, CANVAS_H, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (fx.surface == NULL)
+    {
+        return -1;
+    }
+    fx.renderer = SDL_CreateSoftwareRenderer(fx.surface);
+    if (fx.renderer == NULL)
+    {
+        SDL_FreeSurface(fx.surface);
+        return -1;
+    }
+    *state = &fx;
+    return 0;
+}
+
+static int teardown(void **state)
+{
+    fixture_t *fx = *state;
+    SDL_DestroyRenderer(fx->renderer);
+    SDL_FreeSurface(fx->surface);
+    return 0;
+}
+
+static sdl2_layer_t *create_layer(const fixture_t *fx)
+{
+    sdl2_layer_status_t st = SDL2LY_ERR_NULL_ARG;
+    sdl2_layer_t *layer = sdl2_layer_create(fx->renderer, &st);
+    assert_non_null(layer);
+    assert_int_equal(st, SDL2LY_OK);
+    return layer;
+}
+
+/* ARGB of the window pixel at (x, y). */
+static uint32_t read_pixel(const fixture_t *fx, int x, int y)
+{
+    uint32_t px = 0;
+    SDL_Rect r = {x, y, 1, 1};
+    assert_int_equal(
+        SDL_RenderReadPixels(fx->renderer, &r, SDL_PIXELFORMAT_ARGB8888, &px, (int)sizeof(px)), 0);
+    return px;
+}
+
+static void fill(SDL_Renderer *r, int x, int y, int w, int h, Uint8 cr, Uint8 cg, Uint8 cb)
+{
+    SDL_Rect rect = {x, y, w, h};
+    SDL_SetRenderDrawColor(r, cr, cg, cb, 255);
+    SDL_RenderFillRect(r, &rect);
+}
+
+/* =========================================================================
+ * Group 1: NULL handling
+ * ========================================================================= */
+
+/* TC-01: create with NULL renderer fails with NULL_ARG. */
+static void test_create_null_renderer(void **state)
+{
+    (void)state;
+    sdl2_layer_status_t st = SDL2LY_OK;
+    assert_null(sdl2_layer_create(NULL, &st));
+    assert_int_equal(st, SDL2LY_ERR_NULL_ARG);
+    assert_null(sdl2_layer_create(NULL, NULL));
+}
+
+/* TC-02: every entry point tolerates a NULL layer. */
+static void test_null_layer(void **state)
+{
+    (void)state;
+    sdl2_layer_destroy(NULL);
+    sdl2_layer_end(NULL);
+    sdl2_layer_draw(NULL, NULL);
+    sdl2_layer_invalidate(NULL);
+    assert_false(sdl2_layer_is_current(NULL, CANVAS_W, CANVAS_H, 0));
+    assert_int_equal(sdl2_layer_begin(NULL, CANVAS_W, CANVAS_H, 0), SDL2LY_ERR_NULL_ARG);
+    assert_int_equal(sdl2_layer_redraws(NULL), 0);
+    assert_int_equal(sdl2_layer_update(NULL), SDL2LY_ERR_NULL_ARG);
+    sdl2_layer_clear_rect(NULL, NULL);
+    assert_int_equal(sdl2_layer_updates(NULL), 0);
+}
+
+/* =========================================================================
+ * Group 2: Currency
+ * ========================================================================= */
+
+/* TC-03: a new layer is stale and has no redraws. */
+static void test_new_layer_stale(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 0));
+    assert_int_equal(sdl2_layer_redraws(layer), 0);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-04: begin/end makes the layer current for that key and size only. */
+static void test_current_after_compose(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 7), SDL2LY_OK);
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 7));
+    sdl2_layer_end(layer);
+
+    assert_true(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 7));
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 8));
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W + 1, CANVAS_H, 7));
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H - 1, 7));
+    assert_int_equal(sdl2_layer_redraws(layer), 1);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-05: invalidate makes a current layer stale until recomposed. */
+static void test_invalidate(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    sdl2_layer_end(layer);
+    sdl2_layer_invalidate(layer);
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 1));
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    sdl2_layer_end(layer);
+    assert_true(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 1));
+    assert_int_equal(sdl2_layer_redraws(layer), 2);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-06: a bad size is rejected and leaves the layer stale. */
+static void test_bad_size(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    sdl2_layer_end(layer);
+    assert_int_equal(sdl2_layer_begin(layer, 0, CANVAS_H, 1), SDL2LY_ERR_BAD_SIZE);
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, -1, 1), SDL2LY_ERR_BAD_SIZE);
+    sdl2_layer_end(layer);
+    assert_int_equal(sdl2_layer_redraws(layer), 1);
+    assert_null(SDL_GetRenderTarget(fx->renderer));
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-07: end without a successful begin changes nothing. */
+static void test_end_without_begin(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+    sdl2_layer_end(layer);
+    assert_false(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 0));
+    assert_int_equal(sdl2_layer_redraws(layer), 0);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-13: update needs a current layer; update/end keeps it current and
+ * counts as an update, not a redraw. */
+static void test_update_keeps_current(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_update(layer), SDL2LY_ERR_STALE);
+    assert_null(SDL_GetRenderTarget(fx->renderer));
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 3), SDL2LY_OK);
+    sdl2_layer_end(layer);
+    assert_int_equal(sdl2_layer_update(layer), SDL2LY_OK);
+    assert_non_null(SDL_GetRenderTarget(fx->renderer));
+    sdl2_layer_end(layer);
+
+    assert_null(SDL_GetRenderTarget(fx->renderer));
+    assert_true(sdl2_layer_is_current(layer, CANVAS_W, CANVAS_H, 3));
+    assert_int_equal(sdl2_layer_redraws(layer), 1);
+    assert_int_equal(sdl2_layer_updates(layer), 1);
+
+    sdl2_layer_invalidate(layer);
+    assert_int_equal(sdl2_layer_update(layer), SDL2LY_ERR_STALE);
+    sdl2_layer_destroy(layer);
+}
+
+/* =========================================================================
+ * Group 3: Render target handling
+ * ========================================================================= */
+
+/* TC-08: begin redirects drawing, end restores the window target. */
+static void test_target_restored(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_null(SDL_GetRenderTarget(fx->renderer));
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    assert_non_null(SDL_GetRenderTarget(fx->renderer));
+    sdl2_layer_end(layer);
+    assert_null(SDL_GetRenderTarget(fx->renderer));
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-09: composing one layer inside another restores the outer one. */
+static void test_nested_targets(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *outer = create_layer(fx);
+    sdl2_layer_t *inner = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(outer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    SDL_Texture *outer_target = SDL_GetRenderTarget(fx->renderer);
+    assert_int_equal(sdl2_layer_begin(inner, CANVAS_W, CANVAS_H, 2), SDL2LY_OK);
+    sdl2_layer_end(inner);
+    assert_ptr_equal(SDL_GetRenderTarget(fx->renderer), outer_target);
+    sdl2_layer_end(outer);
+    assert_null(SDL_GetRenderTarget(fx->renderer));
+
+    sdl2_layer_destroy(inner);
+    sdl2_layer_destroy(outer);
+}
+
+/* =========================================================================
+ * Group 4: Pixels
+ * ========================================================================= */
+
+/* TC-10: composed pixels appear on draw; cleared areas stay transparent. */
+static void test_draw_composed(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    fill(fx->renderer, 8, 8, 16, 16, 255, 0, 0);
+    sdl2_layer_end(layer);
+
+    fill(fx->renderer, 0, 0, CANVAS_W, CANVAS_H, 0, 0, 255);
+    sdl2_layer_draw(layer, NULL);
+    assert_int_equal(read_pixel(fx, 10, 10), 0xFFFF0000u);
+    assert_int_equal(read_pixel(fx, 40, 40), 0xFF0000FFu);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-11: draw with an area copies only that area, in place. */
+static void test_draw_area(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    fill(fx->renderer, 0, 0, CANVAS_W, CANVAS_H, 0, 255, 0);
+    sdl2_layer_end(layer);
+
+    fill(fx->renderer, 0, 0, CANVAS_W, CANVAS_H, 0, 0, 0);
+    SDL_Rect area = {4, 4, 8, 8};
+    sdl2_layer_draw(layer, &area);
+    assert_int_equal(read_pixel(fx, 5, 5), 0xFF00FF00u);
+    assert_int_equal(read_pixel(fx, 20, 20), 0xFF000000u);
+    assert_int_equal(read_pixel(fx, 2, 2), 0xFF000000u);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-12: a stale layer draws nothing. */
+static void test_stale_draws_nothing(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    fill(fx->renderer, 0, 0, CANVAS_W, CANVAS_H, 255, 255, 255);
+    sdl2_layer_end(layer);
+    sdl2_layer_invalidate(layer);
+
+    fill(fx->renderer, 0, 0, CANVAS_W, CANVAS_H, 0, 0, 0);
+    sdl2_layer_draw(layer, NULL);
+    assert_int_equal(read_pixel(fx, 10, 10), 0xFF000000u);
+    sdl2_layer_destroy(layer);
+}
+
+/* TC-14: update keeps earlier content; clear_rect makes just its rect
+ * transparent again, whatever the draw blend mode. */
+static void test_update_clear_rect(void **state)
+{
+    fixture_t *fx = *state;
+    sdl2_layer_t *layer = create_layer(fx);
+
+    assert_int_equal(sdl2_layer_begin(layer, CANVAS_W, CANVAS_H, 1), SDL2LY_OK);
+    fill(fx->renderer, 0, 0, 32, 32, 255, 0, 0);
+    sdl2_layer_end(layer);
+
+    SDL_SetRenderDrawBlendMode(fx->renderer, SDL_BLENDMODE_BLEND);
+    assert_int_equal(sdl2_layer_update(layer), SDL2LY_OK);
+    SDL_Rect hole = {0, 0, 8, 8};
+    sdl2_layer_clear_rect(layer, &hole);
+    fill(fx->renderer, 40, 0, 8, 8, 0, 255, 0);
+    sdl2_layer_end(layer);
+
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(fx->renderer, &mode);
+    assert_int_equal(mode, SDL_BLENDMODE_BLEND);
+
+    fill(fx->renderer, 0, 0, CANVAS_W, CANVAS_H, 0, 0, 255);
+    sdl2_layer_draw(layer, NULL);
+    assert_int_equal(read_pixel(fx, 4, 4), 0xFF0000FFu);
+    assert_int_equal(read_pixel(fx, 20, 20), 0xFFFF0000u);
+    assert_int_equal(read_pixel(fx, 44, 4), 0xFF00FF00u);
+    sdl2_layer_destroy(layer);
+}
+
+/* =========================================================================
+ * Group 5: Status strings
+ * ========================================================================= */
+
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(sdl2_layer_status_string(SDL2LY_OK), "OK");
+    assert_string_equal(sdl2_layer_status_string(SDL2LY_ERR_NULL_ARG), "NULL argument");
+    assert_string_equal(sdl2_layer_status_string(SDL2LY_ERR_UNSUPPORTED),
+                        "render targets not supported");
+    assert_string_equal(sdl2_layer_status_string(SDL2LY_ERR_STALE), "layer is not current");
+    assert_string_equal(sdl2_layer_status_string((sdl2_layer_status_t)99), "unknown status");
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: NULL handling */
+        cmocka_unit_test(test_create_null_renderer),
+        cmocka_unit_test(test_null_layer),
+        /* Group 2: Currency */
+        cmocka_unit_test_setup_teardown(test_new_layer_stale, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_current_after_compose, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_invalidate, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_bad_size, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_end_without_begin, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_update_keeps_current, setup, teardown),
+        /* Group 3: Render target handling */
+        cmocka_unit_test_setup_teardown(test_target_restored, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_nested_targets, setup, teardown),
+        /* Group 4: Pixels */
+        cmocka_unit_test_setup_teardown(test_draw_composed, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_draw_area, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_stale_draws_nothing, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_update_clear_rect, setup, teardown),
+        /* Group 5: Status strings */
+        cmocka_unit_test(test_status_strings),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -302,6 +302,70 @@ static void test_max_ticks_per_update(void **state)
     sdl2_loop_destroy(ctx);
 }
 
+static void test_step_exact_ticks(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_status_t status;
+    sdl2_loop_t *ctx = create_default_loop(&log, &status);
+
+    /* Step ignores wall time and the per-update clamp. */
+    int ticks = sdl2_loop_step(ctx, 25, true);
+    assert_int_equal(ticks, 25);
+    assert_int_equal(log.tick_count, 25);
+    assert_int_equal(log.render_count, 1);
+    assert_float_equal(log.last_alpha, 0.0, 0.001);
+    assert_int_equal(sdl2_loop_total_ticks(ctx), 25);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_step_without_render(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_status_t status;
+    sdl2_loop_t *ctx = create_default_loop(&log, &status);
+
+    assert_int_equal(sdl2_loop_step(ctx, 3, false), 3);
+    assert_int_equal(sdl2_loop_step(ctx, 0, false), 0);
+    assert_int_equal(log.tick_count, 3);
+    assert_int_equal(log.render_count, 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_step_clears_accumulator(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_status_t status;
+    sdl2_loop_t *ctx = create_default_loop(&log, &status);
+
+    /* 5 ms banked at speed 5 (7.5 ms/tick) must not leak into the next update. */
+    sdl2_loop_update(ctx, 5);
+    sdl2_loop_step(ctx, 1, false);
+    assert_int_equal(sdl2_loop_update(ctx, 5), 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_step_paused_and_null(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_status_t status;
+    sdl2_loop_t *ctx = create_default_loop(&log, &status);
+
+    sdl2_loop_set_paused(ctx, true);
+    assert_int_equal(sdl2_loop_step(ctx, 4, true), 0);
+    assert_int_equal(log.tick_count, 0);
+    assert_int_equal(log.render_count, 0);
+    assert_int_equal(sdl2_loop_step(NULL, 4, true), 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
 /* =========================================================================
  * Group 6: Pause
  * ========================================================================= */
@@ -595,6 +659,217 @@ static void test_warp9_tick_rate(void **state)
     sdl2_loop_destroy(ctx);
 }
 
+/* =========================================================================
+ * Group 12: Turbo
+ * ========================================================================= */
+
+/* Fake clock: each read advances by fake_step_us. */
+static uint64_t fake_now_us;
+static uint64_t fake_step_us;
+
+static uint64_t fake_clock(void)
+{
+    uint64_t now = fake_now_us;
+    fake_now_us += fake_step_us;
+    return now;
+}
+
+static void reset_fake_clock(uint64_t step_us)
+{
+    fake_now_us = 0;
+    fake_step_us = step_us;
+}
+
+static void test_turbo_runs_until_budget(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    /* 1 ms per clock read against a 12 ms budget: the window opens at
+     * t=0 and the check before each tick passes at t=1..11 ms. */
+    reset_fake_clock(1000);
+    assert_int_equal(sdl2_loop_set_turbo(ctx, true, 12000, fake_clock), SDL2L_OK);
+    assert_true(sdl2_loop_is_turbo(ctx));
+
+    int ticks = sdl2_loop_update(ctx, 0);
+    assert_int_equal(ticks, 11);
+    assert_int_equal(log.tick_count, 11);
+    assert_int_equal(log.render_count, 1);
+    assert_true(log.last_alpha == 0.0);
+    assert_int_equal(sdl2_loop_total_ticks(ctx), 11);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_ignores_elapsed_and_speed(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    /* Far beyond SDL2L_MAX_TICKS_PER_UPDATE, and independent of warp. */
+    reset_fake_clock(10);
+    sdl2_loop_set_turbo(ctx, true, 5000, fake_clock);
+    assert_int_equal(sdl2_loop_update(ctx, 1000), 499);
+
+    reset_fake_clock(10);
+    sdl2_loop_set_speed(ctx, 1);
+    assert_int_equal(sdl2_loop_update(ctx, 0), 499);
+    assert_int_equal(log.render_count, 2);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_stalled_clock_capped(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    reset_fake_clock(0);
+    sdl2_loop_set_turbo(ctx, true, 0, fake_clock);
+    assert_int_equal(sdl2_loop_update(ctx, 16), SDL2L_TURBO_MAX_TICKS_PER_UPDATE);
+    assert_int_equal(log.render_count, 1);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_default_budget(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    reset_fake_clock(1000);
+    sdl2_loop_set_turbo(ctx, true, 0, fake_clock);
+    assert_int_equal(sdl2_loop_update(ctx, 0), SDL2L_TURBO_DEFAULT_BUDGET_US / 1000 - 1);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_paused(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    reset_fake_clock(1000);
+    sdl2_loop_set_turbo(ctx, true, 12000, fake_clock);
+    sdl2_loop_set_paused(ctx, true);
+    assert_int_equal(sdl2_loop_update(ctx, 100), 0);
+    assert_int_equal(log.render_count, 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_off_resumes_fixed_timestep(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    /* Leave 5 ms in the accumulator, go turbo and back: no catch-up. */
+    sdl2_loop_update(ctx, 5);
+    reset_fake_clock(1000);
+    sdl2_loop_set_turbo(ctx, true, 3000, fake_clock);
+    assert_int_equal(sdl2_loop_update(ctx, 0), 2);
+    assert_int_equal(sdl2_loop_set_turbo(ctx, false, 0, NULL), SDL2L_OK);
+    assert_false(sdl2_loop_is_turbo(ctx));
+
+    /* Warp 5: 7.5 ms per tick. */
+    assert_int_equal(sdl2_loop_update(ctx, 7), 0);
+    assert_int_equal(sdl2_loop_update(ctx, 1), 1);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_budget_window(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    /* Off: no budget, begin is a no-op. */
+    sdl2_loop_turbo_begin(ctx);
+    assert_false(sdl2_loop_turbo_budget_left(ctx));
+
+    reset_fake_clock(1000);
+    sdl2_loop_set_turbo(ctx, true, 2500, fake_clock);
+    sdl2_loop_turbo_begin(ctx);                      /* t=0 */
+    assert_true(sdl2_loop_turbo_budget_left(ctx));   /* t=1000 */
+    assert_true(sdl2_loop_turbo_budget_left(ctx));   /* t=2000 */
+    assert_false(sdl2_loop_turbo_budget_left(ctx));  /* t=3000 */
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_turbo_null_args(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+
+    assert_int_equal(sdl2_loop_set_turbo(NULL, true, 0, fake_clock), SDL2L_ERR_NULL_ARG);
+    assert_int_equal(sdl2_loop_set_turbo(ctx, true, 0, NULL), SDL2L_ERR_NULL_ARG);
+    assert_false(sdl2_loop_is_turbo(ctx));
+    assert_false(sdl2_loop_is_turbo(NULL));
+    assert_false(sdl2_loop_turbo_budget_left(NULL));
+    sdl2_loop_turbo_begin(NULL);
+
+    sdl2_loop_destroy(ctx);
+}
+
+/* =========================================================================
+ * Group 13: Microsecond updates and tick deadline
+ * ========================================================================= */
+
+static void test_update_us_sub_millisecond(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+    uint64_t interval = sdl2_loop_tick_interval_us(SDL2L_DEFAULT_SPEED);
+
+    assert_int_equal(sdl2_loop_update_us(ctx, interval - 1), 0);
+    assert_int_equal(sdl2_loop_update_us(ctx, 1), 1);
+    assert_int_equal(log.tick_count, 1);
+    assert_int_equal(log.render_count, 2);
+    assert_int_equal(sdl2_loop_update_us(NULL, interval), 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_until_tick_tracks_accumulator(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+    uint64_t interval = sdl2_loop_tick_interval_us(SDL2L_DEFAULT_SPEED);
+
+    assert_int_equal(sdl2_loop_until_tick_us(ctx), interval);
+    sdl2_loop_update_us(ctx, interval + 300);
+    assert_int_equal(sdl2_loop_until_tick_us(ctx), interval - 300);
+    sdl2_loop_update_us(ctx, interval - 300);
+    assert_int_equal(sdl2_loop_until_tick_us(ctx), interval);
+    assert_int_equal(sdl2_loop_until_tick_us(NULL), 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
+static void test_until_tick_zero_in_turbo(void **state)
+{
+    (void)state;
+    callback_log_t log;
+    sdl2_loop_t *ctx = create_default_loop(&log, NULL);
+    reset_fake_clock(1000);
+
+    assert_int_equal(sdl2_loop_set_turbo(ctx, true, 0, fake_clock), SDL2L_OK);
+    assert_int_equal(sdl2_loop_until_tick_us(ctx), 0);
+
+    sdl2_loop_destroy(ctx);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -625,6 +900,10 @@ int main(void)
         cmocka_unit_test(test_update_null),
         /* Group 5: Spiral of death */
         cmocka_unit_test(test_max_ticks_per_update),
+        cmocka_unit_test(test_step_exact_ticks),
+        cmocka_unit_test(test_step_without_render),
+        cmocka_unit_test(test_step_clears_accumulator),
+        cmocka_unit_test(test_step_paused_and_null),
         /* Group 6: Pause */
         cmocka_unit_test(test_pause_no_ticks),
         cmocka_unit_test(test_unpause_clears_accumulator),
@@ -648,6 +927,19 @@ int main(void)
         /* Group 11: Warp speed characterization */
         cmocka_unit_test(test_all_speeds_produce_correct_interval),
         cmocka_unit_test(test_warp9_tick_rate),
+        /* Group 12: Turbo */
+        cmocka_unit_test(test_turbo_runs_until_budget),
+        cmocka_unit_test(test_turbo_ignores_elapsed_and_speed),
+        cmocka_unit_test(test_turbo_stalled_clock_capped),
+        cmocka_unit_test(test_turbo_default_budget),
+        cmocka_unit_test(test_turbo_paused),
+        cmocka_unit_test(test_turbo_off_resumes_fixed_timestep),
+        cmocka_unit_test(test_turbo_budget_window),
+        cmocka_unit_test(test_turbo_null_args),
+        /* Group 13: Microsecond updates and tick deadline */
+        cmocka_unit_test(test_update_us_sub_millisecond),
+        cmocka_unit_test(test_until_tick_tracks_accumulator),
+        cmocka_unit_test(test_until_tick_zero_in_turbo),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
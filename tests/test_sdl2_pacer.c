@@ -0,0 +1,317 @@
+/*
+ * test_sdl2_pacer.c — CMocka tests for the frame pacer.
+ *
+ * Pure logic tests — no video, audio, or SDL2 runtime needed.
+ * A fake clock and a fake sleep (which advances the fake clock by the
+ * requested time plus a configurable overshoot) make all tests
+ * deterministic.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* cmocka.h must come after the setjmp/stdarg/stddef includes. */
+#include <cmocka.h>
+
+#include "sdl2_pacer.h"
+
+/* =========================================================================
+ * Fake time
+ * ========================================================================= */
+
+static uint64_t fake_now_us;
+static uint64_t fake_overshoot_us; /* Added to every sleep */
+static uint64_t fake_spin_step_us; /* Advance per clock read */
+static int sleep_calls;
+static uint32_t last_sleep_ms;
+
+static uint64_t fake_clock(void)
+{
+    uint64_t t = fake_now_us;
+    fake_now_us += fake_spin_step_us;
+    return t;
+}
+
+static void fake_sleep(uint32_t ms)
+{
+    sleep_calls++;
+    last_sleep_ms = ms;
+    fake_now_us += (uint64_t)ms * 1000U + fake_overshoot_us;
+}
+
+static int reset_fake_time(void **state)
+{
+    (void)state;
+    fake_now_us = 1000000U;
+    fake_overshoot_us = 0;
+    fake_spin_step_us = 10;
+    sleep_calls = 0;
+    last_sleep_ms = 0;
+    return 0;
+}
+
+static sdl2_pacer_t *create_pacer(void)
+{
+    sdl2_pacer_status_t st = SDL2P_ERR_NULL_ARG;
+    sdl2_pacer_t *p = sdl2_pacer_create(fake_clock, fake_sleep, &st);
+    assert_non_null(p);
+    assert_int_equal(st, SDL2P_OK);
+    return p;
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle and NULL safety
+ * ========================================================================= */
+
+/* TC-01: Create requires both callbacks. */
+static void test_create_requires_callbacks(void **state)
+{
+    (void)state;
+    sdl2_pacer_status_t st = SDL2P_OK;
+    assert_null(sdl2_pacer_create(NULL, fake_sleep, &st));
+    assert_int_equal(st, SDL2P_ERR_NULL_ARG);
+    st = SDL2P_OK;
+    assert_null(sdl2_pacer_create(fake_clock, NULL, &st));
+    assert_int_equal(st, SDL2P_ERR_NULL_ARG);
+    assert_null(sdl2_pacer_create(NULL, NULL, NULL));
+}
+
+/* TC-02: A new pacer is enabled; NULL is safe everywhere. */
+static void test_defaults_and_null(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    assert_true(sdl2_pacer_is_enabled(p));
+    sdl2_pacer_destroy(p);
+
+    sdl2_pacer_destroy(NULL);
+    sdl2_pacer_set_enabled(NULL, true);
+    sdl2_pacer_set_refresh_hz(NULL, 60);
+    sdl2_pacer_wait_until(NULL, 0);
+    sdl2_pacer_get_stats(NULL, NULL);
+    assert_false(sdl2_pacer_is_enabled(NULL));
+    assert_int_equal(sdl2_pacer_now(NULL), 0);
+
+    sdl2_pacer_stats_t stats;
+    memset(&stats, 0xff, sizeof(stats));
+    sdl2_pacer_get_stats(NULL, &stats);
+    assert_int_equal(stats.waits, 0);
+    assert_int_equal(stats.late_max_us, 0);
+}
+
+/* TC-03: now() reads the injected clock. */
+static void test_now_reads_clock(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    fake_spin_step_us = 0;
+    fake_now_us = 123456;
+    assert_int_equal(sdl2_pacer_now(p), 123456);
+    sdl2_pacer_destroy(p);
+}
+
+/* =========================================================================
+ * Group 2: Deadlines
+ * ========================================================================= */
+
+/* TC-04: Without a refresh rate the next tick is the deadline. */
+static void test_deadline_tick(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    assert_int_equal(sdl2_pacer_deadline(p, 1000, 1500, 1000), 1500);
+    assert_int_equal(sdl2_pacer_deadline(NULL, 1000, 1500, 1000), 1500);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-05: With a refresh rate the next refresh is the deadline. */
+static void test_deadline_refresh(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    sdl2_pacer_set_refresh_hz(p, 100); /* 10 ms */
+    assert_int_equal(sdl2_pacer_deadline(p, 1000, 1500, 5000), 11000);
+
+    sdl2_pacer_set_refresh_hz(p, 0);
+    assert_int_equal(sdl2_pacer_deadline(p, 1000, 1500, 5000), 1500);
+    sdl2_pacer_set_refresh_hz(p, -5);
+    assert_int_equal(sdl2_pacer_deadline(p, 1000, 1500, 5000), 1500);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-06: A frame never spans more than SDL2P_MAX_TICKS_PER_FRAME ticks. */
+static void test_deadline_capped(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    uint64_t cap = 1000 + SDL2P_MAX_TICKS_PER_FRAME * 100U;
+    assert_int_equal(sdl2_pacer_deadline(p, 1000, 1000000, 100), cap);
+
+    sdl2_pacer_set_refresh_hz(p, 1); /* 1 s, far beyond the cap */
+    assert_int_equal(sdl2_pacer_deadline(p, 1000, 1500, 100), cap);
+    sdl2_pacer_destroy(p);
+}
+
+/* =========================================================================
+ * Group 3: Waiting
+ * ========================================================================= */
+
+/* TC-07: A disabled pacer never sleeps or spins. */
+static void test_disabled_returns_at_once(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    sdl2_pacer_set_enabled(p, false);
+    assert_false(sdl2_pacer_is_enabled(p));
+
+    uint64_t start = fake_now_us;
+    sdl2_pacer_wait_until(p, start + 50000);
+    assert_int_equal(fake_now_us, start);
+    assert_int_equal(sleep_calls, 0);
+
+    sdl2_pacer_stats_t stats;
+    sdl2_pacer_get_stats(p, &stats);
+    assert_int_equal(stats.waits, 0);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-08: A deadline already passed is not waited for. */
+static void test_past_deadline(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    sdl2_pacer_wait_until(p, fake_now_us - 1);
+    assert_int_equal(sleep_calls, 0);
+
+    sdl2_pacer_stats_t stats;
+    sdl2_pacer_get_stats(p, &stats);
+    assert_int_equal(stats.waits, 0);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-09: Long waits sleep first, leaving the overshoot margin to spin. */
+static void test_sleep_then_spin(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    uint64_t deadline = fake_now_us + 10000;
+
+    sdl2_pacer_wait_until(p, deadline);
+
+    /* 10 ms minus the initial 1 ms margin. */
+    assert_int_equal(sleep_calls, 1);
+    assert_int_equal(last_sleep_ms, 9);
+    assert_true(fake_now_us >= deadline);
+
+    sdl2_pacer_stats_t stats;
+    sdl2_pacer_get_stats(p, &stats);
+    assert_int_equal(stats.waits, 1);
+    assert_true(stats.slept_us >= 9000);
+    assert_true(stats.spun_us >= 900 && stats.spun_us <= 1100);
+    assert_true(stats.late_max_us < fake_spin_step_us * 2);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-10: Waits shorter than margin plus a millisecond only spin. */
+static void test_short_wait_spins(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    uint64_t deadline = fake_now_us + 1500;
+
+    sdl2_pacer_wait_until(p, deadline);
+    assert_int_equal(sleep_calls, 0);
+    assert_true(fake_now_us >= deadline);
+
+    sdl2_pacer_stats_t stats;
+    sdl2_pacer_get_stats(p, &stats);
+    assert_int_equal(stats.waits, 1);
+    assert_int_equal(stats.slept_us, 0);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-11: A sloppy sleep widens the margin; the deadline is still met. */
+static void test_overshoot_adapts(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    fake_overshoot_us = 2500;
+
+    for (int i = 0; i < 5; i++)
+    {
+        uint64_t deadline = fake_now_us + 16000;
+        sdl2_pacer_wait_until(p, deadline);
+    }
+
+    sdl2_pacer_stats_t stats;
+    sdl2_pacer_get_stats(p, &stats);
+    assert_true(stats.overshoot_us >= 2500.0 && stats.overshoot_us <= 2600.0);
+
+    /* With the margin learnt, the sleep no longer lands past the deadline. */
+    uint64_t deadline = fake_now_us + 16000;
+    sdl2_pacer_wait_until(p, deadline);
+    assert_int_equal(last_sleep_ms, 13);
+    assert_true(fake_now_us - deadline < fake_spin_step_us * 2);
+    sdl2_pacer_destroy(p);
+}
+
+/* TC-12: The overshoot estimate is clamped to SDL2P_MAX_OVERSHOOT_US. */
+static void test_overshoot_clamped(void **state)
+{
+    (void)state;
+    sdl2_pacer_t *p = create_pacer();
+    fake_overshoot_us = 20000;
+    sdl2_pacer_wait_until(p, fake_now_us + 16000);
+
+    sdl2_pacer_stats_t stats;
+    sdl2_pacer_get_stats(p, &stats);
+    assert_true(stats.overshoot_us <= (double)SDL2P_MAX_OVERSHOOT_US);
+    assert_true(stats.late_max_us >= 5000);
+    sdl2_pacer_destroy(p);
+}
+
+/* =========================================================================
+ * Group 4: Status strings
+ * ========================================================================= */
+
+/* TC-13: Every status has a string. */
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(sdl2_pacer_status_string(SDL2P_OK), "OK");
+    assert_string_equal(sdl2_pacer_status_string(SDL2P_ERR_NULL_ARG), "NULL argument");
+    assert_string_equal(sdl2_pacer_status_string(SDL2P_ERR_ALLOC_FAILED), "allocation failed");
+    assert_string_equal(sdl2_pacer_status_string((sdl2_pacer_status_t)99), "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle and NULL safety */
+        cmocka_unit_test_setup(test_create_requires_callbacks, reset_fake_time),
+        cmocka_unit_test_setup(test_defaults_and_null, reset_fake_time),
+        cmocka_unit_test_setup(test_now_reads_clock, reset_fake_time),
+        /* Group 2: Deadlines */
+        cmocka_unit_test_setup(test_deadline_tick, reset_fake_time),
+        cmocka_unit_test_setup(test_deadline_refresh, reset_fake_time),
+        cmocka_unit_test_setup(test_deadline_capped, reset_fake_time),
+        /* Group 3: Waiting */
+        cmocka_unit_test_setup(test_disabled_returns_at_once, reset_fake_time),
+        cmocka_unit_test_setup(test_past_deadline, reset_fake_time),
+        cmocka_unit_test_setup(test_sleep_then_spin, reset_fake_time),
+        cmocka_unit_test_setup(test_short_wait_spins, reset_fake_time),
+        cmocka_unit_test_setup(test_overshoot_adapts, reset_fake_time),
+        cmocka_unit_test_setup(test_overshoot_clamped, reset_fake_time),
+        /* Group 4: Status strings */
+        cmocka_unit_test_setup(test_status_strings, reset_fake_time),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -10,6 +10,7 @@
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <cmocka.h>
@@ -33,6 +34,7 @@ static void test_config_defaults(void **state)
     assert_true(cfg.vsync);
     assert_non_null(cfg.title);
     assert_string_equal(cfg.title, "- XBoing II -");
+    assert_false(cfg.offscreen);
 }
 
 /* =========================================================================
@@ -496,6 +498,99 @@ static void test_set_logical_width_fullscreen_no_window_change(void **state)
     sdl2_renderer_destroy(ctx);
 }
 
+/* =========================================================================
+ * Group 10: Offscreen mode (ADR-094)
+ * ========================================================================= */
+
+static sdl2_renderer_t *create_offscreen(void)
+{
+    sdl2_renderer_config_t cfg = sdl2_renderer_config_defaults();
+    cfg.offscreen = true;
+    sdl2_renderer_t *ctx = sdl2_renderer_create(&cfg);
+    assert_non_null(ctx);
+    return ctx;
+}
+
+/* TC-22: No window, no video subsystem, and a usable renderer. */
+static void test_offscreen_no_window(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *ctx = create_offscreen();
+
+    assert_true(sdl2_renderer_is_offscreen(ctx));
+    assert_non_null(sdl2_renderer_get(ctx));
+    assert_null(sdl2_renderer_get_window(ctx));
+    assert_int_equal(SDL_WasInit(SDL_INIT_VIDEO), 0);
+
+    int w = -1, h = -1;
+    sdl2_renderer_get_window_size(ctx, &w, &h);
+    assert_int_equal(w, 0);
+    assert_int_equal(h, 0);
+    sdl2_renderer_get_logical_size(ctx, &w, &h);
+    assert_int_equal(w, SDL2R_LOGICAL_WIDTH);
+    assert_int_equal(h, SDL2R_LOGICAL_HEIGHT);
+
+    /* Window operations are no-ops. */
+    assert_false(sdl2_renderer_toggle_fullscreen(ctx));
+    sdl2_renderer_minimize(ctx);
+    sdl2_renderer_set_mouse_grab(ctx, true);
+    assert_false(sdl2_renderer_is_mouse_grabbed(ctx));
+
+    sdl2_renderer_destroy(ctx);
+    assert_false(sdl2_renderer_is_offscreen(NULL));
+}
+
+/* TC-23: The whole target is the logical size, and reads back what was
+ * drawn, before and after present. */
+static void test_offscreen_reads_back(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *ctx = create_offscreen();
+    SDL_Renderer *r = sdl2_renderer_get(ctx);
+
+    int out_w = 0, out_h = 0;
+    assert_int_equal(SDL_GetRendererOutputSize(r, &out_w, &out_h), 0);
+    assert_int_equal(out_w, SDL2R_LOGICAL_WIDTH);
+    assert_int_equal(out_h, SDL2R_LOGICAL_HEIGHT);
+
+    sdl2_renderer_clear(ctx);
+    SDL_SetRenderDrawColor(r, 255, 0, 0, 255);
+    SDL_Rect rect = {SDL2R_LOGICAL_WIDTH - 10, SDL2R_LOGICAL_HEIGHT - 10, 10, 10};
+    SDL_RenderFillRect(r, &rect);
+    sdl2_renderer_present(ctx);
+
+    uint32_t px = 0;
+    SDL_Rect at = {SDL2R_LOGICAL_WIDTH - 1, SDL2R_LOGICAL_HEIGHT - 1, 1, 1};
+    assert_int_equal(SDL_RenderReadPixels(r, &at, SDL_PIXELFORMAT_ARGB8888, &px, 4), 0);
+    assert_int_equal(px, 0xFFFF0000u);
+    at.x = 0;
+    at.y = 0;
+    assert_int_equal(SDL_RenderReadPixels(r, &at, SDL_PIXELFORMAT_ARGB8888, &px, 4), 0);
+    assert_int_equal(px, 0xFF000000u);
+
+    sdl2_renderer_destroy(ctx);
+}
+
+/* TC-24: Widening works without a window, like fullscreen. */
+static void test_offscreen_set_logical_width(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *ctx = create_offscreen();
+
+    assert_int_equal(sdl2_renderer_set_logical_width(ctx, SDL2R_LOGICAL_WIDTH + 120), 0);
+    int w = 0, h = 0;
+    sdl2_renderer_get_logical_size(ctx, &w, &h);
+    assert_int_equal(w, SDL2R_LOGICAL_WIDTH + 120);
+    assert_int_equal(h, SDL2R_LOGICAL_HEIGHT);
+    assert_null(sdl2_renderer_get_window(ctx));
+
+    assert_int_equal(sdl2_renderer_set_logical_width(ctx, SDL2R_LOGICAL_WIDTH), 0);
+    sdl2_renderer_get_logical_size(ctx, &w, &h);
+    assert_int_equal(w, SDL2R_LOGICAL_WIDTH);
+
+    sdl2_renderer_destroy(ctx);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -538,6 +633,10 @@ int main(void)
         cmocka_unit_test(test_set_logical_width_null_ctx),
         cmocka_unit_test(test_set_logical_width_non_positive),
         cmocka_unit_test(test_set_logical_width_fullscreen_no_window_change),
+        /* Group 10: Offscreen mode */
+        cmocka_unit_test(test_offscreen_no_window),
+        cmocka_unit_test(test_offscreen_reads_back),
+        cmocka_unit_test(test_offscreen_set_logical_width),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -70,6 +70,22 @@ static void log_exit(sdl2_state_mode_t mode, void *user_data)
     }
 }
 
+/* Transition hook: logged as type 3 with the destination mode, plus the
+ * source mode of the most recent call. */
+static sdl2_state_mode_t hook_last_from = SDL2ST_NONE;
+
+static void log_transition(sdl2_state_mode_t from, sdl2_state_mode_t to, void *user_data)
+{
+    call_log_t *log = (call_log_t *)user_data;
+    hook_last_from = from;
+    if (log->count < MAX_CALLS)
+    {
+        log->calls[log->count].mode = to;
+        log->calls[log->count].type = 3;
+        log->count++;
+    }
+}
+
 static const sdl2_state_mode_def_t logging_def = {
     .on_enter = log_enter,
     .on_update = log_update,
@@ -632,6 +648,61 @@ static void test_startup_sequence(void **state)
     assert_int_equal(sdl2_state_previous(ts->ctx), SDL2ST_INTRO);
 }
 
+/* =========================================================================
+ * Group 11: Transition hook
+ * ========================================================================= */
+
+static void test_transition_hook_runs_before_enter(void **state)
+{
+    test_state_t *ts = (test_state_t *)*state;
+    sdl2_state_register(ts->ctx, SDL2ST_INTRO, &logging_def);
+    sdl2_state_register(ts->ctx, SDL2ST_GAME, &logging_def);
+    assert_int_equal(sdl2_state_set_transition_hook(ts->ctx, log_transition), SDL2ST_OK);
+
+    sdl2_state_transition(ts->ctx, SDL2ST_INTRO);
+    ts->log.count = 0;
+    sdl2_state_transition(ts->ctx, SDL2ST_GAME);
+
+    /* exit(INTRO), hook(-> GAME), enter(GAME); the hook sees the new mode
+     * as current. */
+    assert_int_equal(ts->log.count, 3);
+    assert_int_equal(ts->log.calls[0].type, 2);
+    assert_int_equal(ts->log.calls[1].type, 3);
+    assert_int_equal(ts->log.calls[1].mode, SDL2ST_GAME);
+    assert_int_equal(hook_last_from, SDL2ST_INTRO);
+    assert_int_equal(ts->log.calls[2].type, 0);
+
+    /* Same-mode transitions are no-ops and do not call the hook. */
+    ts->log.count = 0;
+    sdl2_state_transition(ts->ctx, SDL2ST_GAME);
+    assert_int_equal(ts->log.count, 0);
+}
+
+static void test_transition_hook_dialogue(void **state)
+{
+    test_state_t *ts = (test_state_t *)*state;
+    sdl2_state_set_transition_hook(ts->ctx, log_transition);
+    sdl2_state_transition(ts->ctx, SDL2ST_EDIT);
+
+    ts->log.count = 0;
+    sdl2_state_push_dialogue(ts->ctx);
+    assert_int_equal(ts->log.count, 1);
+    assert_int_equal(ts->log.calls[0].mode, SDL2ST_DIALOGUE);
+    assert_int_equal(hook_last_from, SDL2ST_EDIT);
+
+    sdl2_state_pop_dialogue(ts->ctx);
+    assert_int_equal(ts->log.count, 2);
+    assert_int_equal(ts->log.calls[1].mode, SDL2ST_EDIT);
+    assert_int_equal(hook_last_from, SDL2ST_DIALOGUE);
+
+    /* Clearing the hook stops the calls. */
+    sdl2_state_set_transition_hook(ts->ctx, NULL);
+    sdl2_state_transition(ts->ctx, SDL2ST_INTRO);
+    assert_int_equal(ts->log.count, 2);
+    assert_int_equal(sdl2_state_set_transition_hook(NULL, log_transition),
+                     SDL2ST_ERR_NULL_ARG);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -716,6 +787,13 @@ int main(void)
         cmocka_unit_test_setup_teardown(test_startup_sequence, setup_state, teardown_state),
     };
 
+    const struct CMUnitTest hook_tests[] = {
+        cmocka_unit_test_setup_teardown(test_transition_hook_runs_before_enter, setup_state,
+                                        teardown_state),
+        cmocka_unit_test_setup_teardown(test_transition_hook_dialogue, setup_state,
+                                        teardown_state),
+    };
+
     int failed = 0;
     failed += cmocka_run_group_tests_name("lifecycle", lifecycle_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("registration", registration_tests, NULL, NULL);
@@ -727,5 +805,6 @@ int main(void)
     failed += cmocka_run_group_tests_name("names and strings", name_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("pause toggle", pause_tests, NULL, NULL);
     failed += cmocka_run_group_tests_name("startup sequence", startup_tests, NULL, NULL);
+    failed += cmocka_run_group_tests_name("transition hook", hook_tests, NULL, NULL);
     return failed;
 }
@@ -10,6 +10,7 @@
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -71,6 +72,11 @@ static void test_config_defaults(void **state)
     assert_null(cfg.renderer);
     assert_non_null(cfg.base_dir);
     assert_string_equal(cfg.base_dir, "assets/images");
+    assert_int_equal(cfg.atlas_size, SDL2T_ATLAS_SIZE);
+    assert_null(cfg.decoder);
+    assert_null(cfg.pack);
+    assert_false(cfg.lazy);
+    assert_int_equal(cfg.vram_budget, 0);
 }
 
 /* =========================================================================
@@ -460,6 +466,621 @@ static void test_status_strings(void **state)
     }
 }
 
+/* =========================================================================
+ * Group 7: Atlas pages
+ * ========================================================================= */
+
+static sdl2_texture_t *create_full_cache(sdl2_renderer_t *rctx, int atlas_size)
+{
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.atlas_size = atlas_size;
+
+    sdl2_texture_status_t status;
+    sdl2_texture_t *ctx = sdl2_texture_create(&cfg, &status);
+    assert_non_null(ctx);
+    assert_int_equal(status, SDL2T_OK);
+    return ctx;
+}
+
+static bool rects_overlap(const SDL_Rect *a, const SDL_Rect *b)
+{
+    return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+/* TC-19: The stock sprite set packs onto one page of disjoint rects. */
+static void test_atlas_full_load_one_page(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_full_cache(rctx, SDL2T_ATLAS_SIZE);
+
+    assert_int_equal(sdl2_texture_count(ctx), 180);
+    assert_int_equal(sdl2_texture_atlas_pages(ctx), 1);
+
+    const char *keys[] = {"balls/ball1", "blocks/redblk", "paddle/padmed", "guns/bullet",
+                          "blockex/exred1", "digits/digit0", "bgrnds/bgrnd"};
+    enum
+    {
+        NKEYS = sizeof(keys) / sizeof(keys[0])
+    };
+    sdl2_texture_info_t info[NKEYS];
+    for (int i = 0; i < NKEYS; i++)
+    {
+        assert_int_equal(sdl2_texture_get(ctx, keys[i], &info[i]), SDL2T_OK);
+        assert_ptr_equal(info[i].texture, info[0].texture);
+        assert_int_equal(info[i].rect.w, info[i].width);
+        assert_int_equal(info[i].rect.h, info[i].height);
+        assert_true(info[i].rect.x >= 0 && info[i].rect.x + info[i].rect.w <= SDL2T_ATLAS_SIZE);
+        assert_true(info[i].rect.y >= 0 && info[i].rect.y + info[i].rect.h <= SDL2T_ATLAS_SIZE);
+        for (int j = 0; j < i; j++)
+        {
+            assert_false(rects_overlap(&info[i].rect, &info[j].rect));
+        }
+    }
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-20: atlas_size 0 keeps one texture per image, rect at the origin. */
+static void test_atlas_disabled(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_full_cache(rctx, 0);
+
+    assert_int_equal(sdl2_texture_count(ctx), 180);
+    assert_int_equal(sdl2_texture_atlas_pages(ctx), 0);
+
+    sdl2_texture_info_t ball;
+    sdl2_texture_info_t block;
+    assert_int_equal(sdl2_texture_get(ctx, "balls/ball1", &ball), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get(ctx, "blocks/redblk", &block), SDL2T_OK);
+    assert_ptr_not_equal(ball.texture, block.texture);
+    assert_int_equal(ball.rect.x, 0);
+    assert_int_equal(ball.rect.y, 0);
+    assert_int_equal(ball.rect.w, 20);
+    assert_int_equal(ball.rect.h, 19);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-21: A page too small for an image leaves that image standalone. */
+static void test_atlas_oversized_image_standalone(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_full_cache(rctx, 256);
+
+    assert_int_equal(sdl2_texture_count(ctx), 180);
+    assert_true(sdl2_texture_atlas_pages(ctx) >= 1);
+
+    /* presents/earth is 400x400; ball1 is small enough for a page. */
+    sdl2_texture_info_t earth;
+    sdl2_texture_info_t ball;
+    assert_int_equal(sdl2_texture_get(ctx, "presents/earth", &earth), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get(ctx, "balls/ball1", &ball), SDL2T_OK);
+    assert_non_null(earth.texture);
+    assert_ptr_not_equal(earth.texture, ball.texture);
+    assert_int_equal(earth.rect.x, 0);
+    assert_int_equal(earth.rect.y, 0);
+    assert_int_equal(earth.rect.w, 400);
+    assert_int_equal(earth.rect.h, 400);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-22: load_file() over an atlas image gives it its own texture and
+ * leaves the page to the other images. */
+static void test_atlas_replace_entry(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_full_cache(rctx, SDL2T_ATLAS_SIZE);
+
+    sdl2_texture_info_t block;
+    assert_int_equal(sdl2_texture_get(ctx, "blocks/redblk", &block), SDL2T_OK);
+
+    assert_int_equal(sdl2_texture_load_file(ctx, "balls/ball1", "assets/images/balls/ball2.png"),
+                     SDL2T_OK);
+    assert_int_equal(sdl2_texture_count(ctx), 180);
+    assert_int_equal(sdl2_texture_atlas_pages(ctx), 1);
+
+    sdl2_texture_info_t ball;
+    assert_int_equal(sdl2_texture_get(ctx, "balls/ball1", &ball), SDL2T_OK);
+    assert_ptr_not_equal(ball.texture, block.texture);
+    assert_int_equal(ball.rect.x, 0);
+    assert_int_equal(ball.rect.y, 0);
+
+    sdl2_texture_info_t again;
+    assert_int_equal(sdl2_texture_get(ctx, "blocks/redblk", &again), SDL2T_OK);
+    assert_ptr_equal(again.texture, block.texture);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-23: atlas_pages(NULL) is 0. */
+static void test_atlas_pages_null(void **state)
+{
+    (void)state;
+    assert_int_equal(sdl2_texture_atlas_pages(NULL), 0);
+}
+
+/* =========================================================================
+ * Group 8: Dense IDs
+ * ========================================================================= */
+
+static const char *const id_keys[] = {"balls/ball1", "blocks/redblk", NULL, "no/such/key"};
+
+/* TC-24: bind_ids / get_id argument checks. */
+static void test_ids_null_args(void **state)
+{
+    (void)state;
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_bind_ids(NULL, id_keys, 4), SDL2T_ERR_NULL_ARG);
+    assert_int_equal(sdl2_texture_get_id(NULL, 0, &info), SDL2T_ERR_NULL_ARG);
+
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.base_dir = empty_dir;
+    sdl2_texture_status_t status;
+    sdl2_texture_t *ctx = sdl2_texture_create(&cfg, &status);
+    assert_non_null(ctx);
+
+    assert_int_equal(sdl2_texture_bind_ids(ctx, NULL, 1), SDL2T_ERR_NULL_ARG);
+    assert_int_equal(sdl2_texture_bind_ids(ctx, id_keys, SDL2T_MAX_TEXTURES + 1),
+                     SDL2T_ERR_CACHE_FULL);
+    assert_int_equal(sdl2_texture_get_id(ctx, 0, NULL), SDL2T_ERR_NULL_ARG);
+
+    /* Nothing bound yet: every ID is unknown. */
+    assert_int_equal(sdl2_texture_get_id(ctx, 0, &info), SDL2T_ERR_NOT_FOUND);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-25: get_id returns the same image as get() with the bound key. */
+static void test_ids_match_keys(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_full_cache(rctx, SDL2T_ATLAS_SIZE);
+
+    assert_int_equal(sdl2_texture_bind_ids(ctx, id_keys, 4), SDL2T_OK);
+    for (int id = 0; id < 2; id++)
+    {
+        sdl2_texture_info_t by_key;
+        sdl2_texture_info_t by_id;
+        assert_int_equal(sdl2_texture_get(ctx, id_keys[id], &by_key), SDL2T_OK);
+        assert_int_equal(sdl2_texture_get_id(ctx, id, &by_id), SDL2T_OK);
+        assert_ptr_equal(by_id.texture, by_key.texture);
+        assert_int_equal(by_id.width, by_key.width);
+        assert_int_equal(by_id.height, by_key.height);
+        assert_memory_equal(&by_id.rect, &by_key.rect, sizeof(by_id.rect));
+    }
+
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_get_id(ctx, 2, &info), SDL2T_ERR_NOT_FOUND); /* NULL key */
+    assert_int_equal(sdl2_texture_get_id(ctx, 3, &info), SDL2T_ERR_NOT_FOUND); /* not cached */
+    assert_int_equal(sdl2_texture_get_id(ctx, 4, &info), SDL2T_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_texture_get_id(ctx, -1, &info), SDL2T_ERR_NOT_FOUND);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-26: An ID bound before its key is loaded resolves once load_file()
+ * inserts it, and still resolves after the key is replaced. */
+static void test_ids_bind_before_load(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.base_dir = empty_dir;
+    sdl2_texture_status_t status;
+    sdl2_texture_t *ctx = sdl2_texture_create(&cfg, &status);
+    assert_non_null(ctx);
+
+    static const char *const keys[] = {"sprite"};
+    assert_int_equal(sdl2_texture_bind_ids(ctx, keys, 1), SDL2T_OK);
+
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_get_id(ctx, 0, &info), SDL2T_ERR_NOT_FOUND);
+
+    assert_int_equal(sdl2_texture_load_file(ctx, "sprite", "assets/images/balls/ball1.png"),
+                     SDL2T_OK);
+    assert_int_equal(sdl2_texture_get_id(ctx, 0, &info), SDL2T_OK);
+    assert_int_equal(info.width, 20);
+
+    assert_int_equal(sdl2_texture_load_file(ctx, "sprite", "assets/images/floppy.png"), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get_id(ctx, 0, &info), SDL2T_OK);
+    assert_int_equal(info.width, 32);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* =========================================================================
+ * Group 9: Decoding on the worker pool (ADR-097)
+ * ========================================================================= */
+
+static sdl2_texture_t *create_decoded_cache(sdl2_renderer_t *rctx, int atlas_size)
+{
+    sdl2_decode_config_t dcfg = sdl2_decode_config_defaults();
+    sdl2_decode_t *dec = sdl2_decode_create(&dcfg, NULL);
+    assert_non_null(dec);
+    assert_int_equal(sdl2_texture_queue_decode(dec, NULL), SDL2T_OK);
+
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.atlas_size = atlas_size;
+    cfg.decoder = dec;
+
+    sdl2_texture_status_t status;
+    sdl2_texture_t *ctx = sdl2_texture_create(&cfg, &status);
+    assert_non_null(ctx);
+    assert_int_equal(status, SDL2T_OK);
+
+    sdl2_decode_stats_t stats;
+    sdl2_decode_get_stats(dec, &stats);
+    assert_int_equal(stats.submitted, 180);
+    assert_int_equal(stats.failed, 0);
+    sdl2_decode_destroy(dec);
+    return ctx;
+}
+
+/* TC-27: queue_decode validates its arguments. */
+static void test_decode_queue_errors(void **state)
+{
+    (void)state;
+    assert_int_equal(sdl2_texture_queue_decode(NULL, "assets/images"), SDL2T_ERR_NULL_ARG);
+
+    sdl2_decode_config_t dcfg = sdl2_decode_config_defaults();
+    sdl2_decode_t *dec = sdl2_decode_create(&dcfg, NULL);
+    assert_non_null(dec);
+    assert_int_equal(sdl2_texture_queue_decode(dec, "/nonexistent/path/xyz"),
+                     SDL2T_ERR_SCAN_FAILED);
+    sdl2_decode_destroy(dec);
+}
+
+/* TC-28: Decoded images land under the same keys and sizes as a scan,
+ * with and without atlas pages. */
+static void test_decode_matches_scan(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int atlas_size = pass == 0 ? SDL2T_ATLAS_SIZE : 0;
+        sdl2_texture_t *scanned = create_full_cache(rctx, atlas_size);
+        sdl2_texture_t *decoded = create_decoded_cache(rctx, atlas_size);
+
+        assert_int_equal(sdl2_texture_count(decoded), sdl2_texture_count(scanned));
+        assert_int_equal(sdl2_texture_atlas_pages(decoded), sdl2_texture_atlas_pages(scanned));
+
+        const char *keys[] = {"balls/ball1", "blocks/redblk", "presents/earth", "bgrnds/bgrnd"};
+        for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+        {
+            sdl2_texture_info_t a;
+            sdl2_texture_info_t b;
+            assert_int_equal(sdl2_texture_get(scanned, keys[i], &a), SDL2T_OK);
+            assert_int_equal(sdl2_texture_get(decoded, keys[i], &b), SDL2T_OK);
+            assert_non_null(b.texture);
+            assert_int_equal(b.width, a.width);
+            assert_int_equal(b.height, a.height);
+        }
+
+        sdl2_texture_destroy(decoded);
+        sdl2_texture_destroy(scanned);
+    }
+
+    sdl2_renderer_destroy(rctx);
+}
+
+/* =========================================================================
+ * Group 10: Asset pack (ADR-098)
+ * ========================================================================= */
+
+/* TC-29: Pack images are inserted under their key minus "images/", the
+ * directory is not scanned, and malformed or non-image entries are
+ * skipped. */
+static void test_pack_images(void **state)
+{
+    (void)state;
+    static uint8_t small[4 * 3 * 2];
+    static uint8_t wide[8 * 5 * 4];
+
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_non_null(w);
+    asset_pack_entry_t e = {"images/balls/test", small, sizeof(small), ASSET_PACK_PIXELS,
+                            {3, 2, 12}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    e = (asset_pack_entry_t){"images/wide", wide, sizeof(wide), ASSET_PACK_PIXELS, {5, 4, 32}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    /* Claims more rows than it has bytes for. */
+    e = (asset_pack_entry_t){"images/short", small, sizeof(small), ASSET_PACK_PIXELS, {3, 9, 12}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    e = (asset_pack_entry_t){"levels/x.data", small, sizeof(small), ASSET_PACK_RAW, {0, 0, 0}};
+    assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+
+    char path[64];
+    snprintf(path, sizeof(path), "%s/test.pak", empty_dir);
+    assert_int_equal(asset_pack_writer_save(w, path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+    asset_pack_t *pack = asset_pack_open(path, NULL);
+    assert_non_null(pack);
+
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    for (int pass = 0; pass < 2; pass++)
+    {
+        sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+        cfg.renderer = sdl2_renderer_get(rctx);
+        cfg.base_dir = "/nonexistent/path/xyz";
+        cfg.atlas_size = pass == 0 ? SDL2T_ATLAS_SIZE : 0;
+        cfg.pack = pack;
+
+        sdl2_texture_status_t status;
+        sdl2_texture_t *ctx = sdl2_texture_create(&cfg, &status);
+        assert_non_null(ctx);
+        assert_int_equal(status, SDL2T_OK);
+        assert_int_equal(sdl2_texture_count(ctx), 2);
+
+        sdl2_texture_info_t info;
+        assert_int_equal(sdl2_texture_get(ctx, "balls/test", &info), SDL2T_OK);
+        assert_non_null(info.texture);
+        assert_int_equal(info.width, 3);
+        assert_int_equal(info.height, 2);
+        assert_int_equal(sdl2_texture_get(ctx, "wide", &info), SDL2T_OK);
+        assert_int_equal(info.width, 5);
+        assert_int_equal(info.height, 4);
+        assert_int_equal(sdl2_texture_get(ctx, "short", &info), SDL2T_ERR_NOT_FOUND);
+
+        sdl2_texture_destroy(ctx);
+    }
+
+    sdl2_renderer_destroy(rctx);
+    asset_pack_close(pack);
+    unlink(path);
+}
+
+/* =========================================================================
+ * Group 11: Lazy residency (ADR-099)
+ * ========================================================================= */
+
+static sdl2_texture_t *create_lazy(sdl2_renderer_t *rctx, const asset_pack_t *pack,
+                                   size_t budget)
+{
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.pack = pack;
+    cfg.lazy = true;
+    cfg.vram_budget = budget;
+    sdl2_texture_status_t status;
+    sdl2_texture_t *ctx = sdl2_texture_create(&cfg, &status);
+    assert_int_equal(status, SDL2T_OK);
+    return ctx;
+}
+
+/* TC-30: Lazy create finds every image but uploads none; lookups by key
+ * and by ID upload on first use, with the eager dimensions. */
+static void test_lazy_loads_on_first_use(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_lazy(rctx, NULL, 0);
+    assert_non_null(ctx);
+    assert_int_equal(sdl2_texture_count(ctx), 180);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 0);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), 0);
+    assert_int_equal(sdl2_texture_atlas_pages(ctx), 0);
+
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_get(ctx, "balls/ball1", &info), SDL2T_OK);
+    assert_non_null(info.texture);
+    assert_int_equal(info.width, 20);
+    assert_int_equal(info.height, 19);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 1);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), 20 * 19 * 4);
+
+    /* A second lookup reuses the texture. */
+    SDL_Texture *first = info.texture;
+    assert_int_equal(sdl2_texture_get(ctx, "balls/ball1", &info), SDL2T_OK);
+    assert_ptr_equal(info.texture, first);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 1);
+
+    static const char *const keys[] = {"guns/bullet", "no/such/key"};
+    assert_int_equal(sdl2_texture_bind_ids(ctx, keys, 2), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get_id(ctx, 0, &info), SDL2T_OK);
+    assert_int_equal(info.width, 7);
+    assert_int_equal(info.height, 16);
+    assert_int_equal(sdl2_texture_get_id(ctx, 1, &info), SDL2T_ERR_NOT_FOUND);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 2);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
+/* TC-31: A prefetch uploads every image under its prefixes, and is a
+ * no-op for an eager cache. */
+static void test_lazy_prefetch(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_lazy(rctx, NULL, 0);
+    assert_non_null(ctx);
+
+    static const char *const prefixes[] = {"presents/", "floppy"};
+    assert_int_equal(sdl2_texture_prefetch(ctx, prefixes, 2), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 13 + 1);
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_get(ctx, "presents/earth", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 14);
+
+    assert_int_equal(sdl2_texture_prefetch(NULL, prefixes, 2), SDL2T_ERR_NULL_ARG);
+    assert_int_equal(sdl2_texture_prefetch(ctx, NULL, 1), SDL2T_ERR_NULL_ARG);
+    assert_int_equal(sdl2_texture_prefetch(ctx, NULL, 0), SDL2T_OK);
+    sdl2_texture_destroy(ctx);
+
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.atlas_size = 0;
+    ctx = sdl2_texture_create(&cfg, NULL);
+    assert_non_null(ctx);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 180);
+    size_t bytes = sdl2_texture_resident_bytes(ctx);
+    assert_int_equal(sdl2_texture_prefetch(ctx, prefixes, 2), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), bytes);
+    sdl2_texture_destroy(ctx);
+
+    sdl2_renderer_destroy(rctx);
+}
+
+/* Write a pack of four 4x4 images "images/a" .. "images/d" (64 bytes of
+ * texture each) to path and open it. */
+static asset_pack_t *open_square_pack(char *path, size_t path_size)
+{
+    static uint8_t pixels[4 * 4 * 4];
+    asset_pack_writer_t *w = asset_pack_writer_create(NULL);
+    assert_non_null(w);
+    static const char *const keys[] = {"images/a", "images/b", "images/c", "images/d"};
+    for (int i = 0; i < 4; i++)
+    {
+        asset_pack_entry_t e = {keys[i], pixels, sizeof(pixels), ASSET_PACK_PIXELS, {4, 4, 16}};
+        assert_int_equal(asset_pack_writer_add(w, &e), ASSET_PACK_OK);
+    }
+    snprintf(path, path_size, "%s/squares.pak", empty_dir);
+    assert_int_equal(asset_pack_writer_save(w, path), ASSET_PACK_OK);
+    asset_pack_writer_destroy(w);
+    asset_pack_t *pack = asset_pack_open(path, NULL);
+    assert_non_null(pack);
+    return pack;
+}
+
+/* TC-32: Over the budget the least recently used image is unloaded, and
+ * reloads on its next lookup.  Images used in the current frame are kept
+ * even over the budget until the next frame. */
+static void test_lazy_budget_evicts_lru(void **state)
+{
+    (void)state;
+    char path[64];
+    asset_pack_t *pack = open_square_pack(path, sizeof(path));
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_lazy(rctx, pack, 2 * 64);
+    assert_non_null(ctx);
+    assert_int_equal(sdl2_texture_count(ctx), 4);
+
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_get(ctx, "a", &info), SDL2T_OK);
+    sdl2_texture_next_frame(ctx);
+    assert_int_equal(sdl2_texture_get(ctx, "b", &info), SDL2T_OK);
+    sdl2_texture_next_frame(ctx);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), 128);
+
+    /* c pushes out a, the least recently used. */
+    assert_int_equal(sdl2_texture_get(ctx, "c", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 2);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), 128);
+    sdl2_texture_next_frame(ctx);
+
+    /* a reloads and pushes out b. */
+    assert_int_equal(sdl2_texture_get(ctx, "a", &info), SDL2T_OK);
+    assert_int_equal(info.width, 4);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 2);
+
+    /* All four in one frame: over the budget until the frame ends. */
+    assert_int_equal(sdl2_texture_get(ctx, "b", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get(ctx, "c", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get(ctx, "d", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 4);
+    sdl2_texture_next_frame(ctx);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 2);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), 128);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+    asset_pack_close(pack);
+    unlink(path);
+}
+
+/* TC-33: A prefetch keeps the images it names and stops at the budget
+ * rather than unloading what it just loaded. */
+static void test_lazy_prefetch_budget(void **state)
+{
+    (void)state;
+    char path[64];
+    asset_pack_t *pack = open_square_pack(path, sizeof(path));
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_t *ctx = create_lazy(rctx, pack, 2 * 64);
+    assert_non_null(ctx);
+
+    sdl2_texture_info_t info;
+    assert_int_equal(sdl2_texture_get(ctx, "a", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get(ctx, "b", &info), SDL2T_OK);
+    sdl2_texture_next_frame(ctx);
+
+    /* b is asked for again, so a goes to make room for one of c and d;
+     * the other does not fit. */
+    static const char *const wanted[] = {"b", "c", "d"};
+    assert_int_equal(sdl2_texture_prefetch(ctx, wanted, 3), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 2);
+    assert_int_equal(sdl2_texture_resident_bytes(ctx), 128);
+
+    /* The other still loads on use, over the budget for this frame. */
+    assert_int_equal(sdl2_texture_get(ctx, "c", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_get(ctx, "d", &info), SDL2T_OK);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 3);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+    asset_pack_close(pack);
+    unlink(path);
+}
+
+/* TC-34: In lazy mode load_file() still uploads at once and reports a
+ * missing file without caching the key. */
+static void test_lazy_load_file(void **state)
+{
+    (void)state;
+    sdl2_renderer_t *rctx = create_renderer();
+    assert_non_null(rctx);
+    sdl2_texture_config_t cfg = sdl2_texture_config_defaults();
+    cfg.renderer = sdl2_renderer_get(rctx);
+    cfg.base_dir = empty_dir;
+    cfg.lazy = true;
+    sdl2_texture_t *ctx = sdl2_texture_create(&cfg, NULL);
+    assert_non_null(ctx);
+
+    assert_int_equal(sdl2_texture_load_file(ctx, "x", "/nonexistent.png"),
+                     SDL2T_ERR_LOAD_FAILED);
+    assert_int_equal(sdl2_texture_count(ctx), 0);
+    assert_int_equal(sdl2_texture_load_file(ctx, "x", "assets/images/floppy.png"), SDL2T_OK);
+    assert_int_equal(sdl2_texture_count(ctx), 1);
+    assert_int_equal(sdl2_texture_resident_count(ctx), 1);
+
+    sdl2_texture_destroy(ctx);
+    sdl2_renderer_destroy(rctx);
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -491,6 +1112,27 @@ int main(void)
         cmocka_unit_test(test_full_load_spot_check),
         /* Group 6: Status strings */
         cmocka_unit_test(test_status_strings),
+        /* Group 7: Atlas pages */
+        cmocka_unit_test(test_atlas_full_load_one_page),
+        cmocka_unit_test(test_atlas_disabled),
+        cmocka_unit_test(test_atlas_oversized_image_standalone),
+        cmocka_unit_test(test_atlas_replace_entry),
+        cmocka_unit_test(test_atlas_pages_null),
+        /* Group 8: Dense IDs */
+        cmocka_unit_test(test_ids_null_args),
+        cmocka_unit_test(test_ids_match_keys),
+        cmocka_unit_test(test_ids_bind_before_load),
+        /* Group 9: Decoding on the worker pool */
+        cmocka_unit_test(test_decode_queue_errors),
+        cmocka_unit_test(test_decode_matches_scan),
+        /* Group 10: Asset pack */
+        cmocka_unit_test(test_pack_images),
+        /* Group 11: Lazy residency */
+        cmocka_unit_test(test_lazy_loads_on_first_use),
+        cmocka_unit_test(test_lazy_prefetch),
+        cmocka_unit_test(test_lazy_budget_evicts_lru),
+        cmocka_unit_test(test_lazy_prefetch_budget),
+        cmocka_unit_test(test_lazy_load_file),
     };
 
     return cmocka_run_group_tests(tests, group_setup, group_teardown);
@@ -57,8 +57,9 @@ static sfx_system_callbacks_t make_callbacks(void)
 static int g_rand_seq[64];
 static int g_rand_idx;
 
-static int test_rand(void)
+static int test_rand(void *user_data)
 {
+    (void)user_data;
     return g_rand_seq[g_rand_idx++ % 64];
 }
 
@@ -0,0 +1,349 @@
+/*
+ * test_sim_batch.c — CMocka tests for the multi-threaded batch runner.
+ *
+ * Uses real level files from levels/ with a short tick cap so the whole
+ * file runs in a few seconds.  The load-bearing property is that results
+ * and summaries do not depend on the thread count.
+ *
+ * Test groups:
+ *   1. Lifecycle (3 tests)
+ *   2. Running (4 tests)
+ *   3. Summaries (3 tests)
+ *   4. Utility (1 test)
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* CMocka must come after setjmp.h */
+#include <cmocka.h>
+
+#include "sim_batch.h"
+
+/* =========================================================================
+ * Test level file path — set by CMake define LEVELS_DIR
+ * ========================================================================= */
+
+#ifndef LEVELS_DIR
+#define LEVELS_DIR "./levels"
+#endif
+
+#define TEST_TICKS 20000
+
+static void make_level_path(char *buf, size_t bufsize, int level_num)
+{
+    snprintf(buf, bufsize, "%s/level%02d.data", LEVELS_DIR, level_num);
+}
+
+static sim_batch_t *create_batch(int threads)
+{
+    sim_batch_config_t config;
+    sim_batch_config_init(&config);
+    config.threads = threads;
+    config.max_ticks = TEST_TICKS;
+
+    sim_batch_status_t st;
+    sim_batch_t *batch = sim_batch_create(&config, &st);
+    assert_non_null(batch);
+    assert_int_equal(st, SIM_BATCH_OK);
+    return batch;
+}
+
+/* Levels 1-3, seeds 1-4 each: 12 jobs. */
+static void add_sweep(sim_batch_t *batch)
+{
+    char path[512];
+    for (int level = 1; level <= 3; level++)
+    {
+        make_level_path(path, sizeof(path), level);
+        for (uint64_t seed = 1; seed <= 4; seed++)
+        {
+            assert_int_equal(sim_batch_add_job(batch, path, seed, SIM_POLICY_TRACK),
+                             SIM_BATCH_OK);
+        }
+    }
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle
+ * ========================================================================= */
+
+static void test_config_init(void **state)
+{
+    (void)state;
+    sim_batch_config_t config;
+    memset(&config, 0xff, sizeof(config));
+    sim_batch_config_init(&config);
+    assert_int_equal(config.threads, 0);
+    assert_int_equal(config.max_ticks, 200000);
+    assert_int_equal(config.speed_level, 5);
+    assert_int_equal(config.lives, 3);
+}
+
+static void test_create_empty(void **state)
+{
+    (void)state;
+    sim_batch_t *batch = sim_batch_create(NULL, NULL);
+    assert_non_null(batch);
+    assert_int_equal(sim_batch_job_count(batch), 0);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_summary_count(batch), 0);
+    sim_batch_destroy(batch);
+}
+
+static void test_null_args(void **state)
+{
+    (void)state;
+    sim_batch_result_t res;
+    sim_batch_summary_t sum;
+    sim_batch_t *batch = sim_batch_create(NULL, NULL);
+
+    sim_batch_destroy(NULL);
+    assert_int_equal(sim_batch_add_job(NULL, "x", 1, SIM_POLICY_TRACK), SIM_BATCH_ERR_NULL_ARG);
+    assert_int_equal(sim_batch_add_job(batch, NULL, 1, SIM_POLICY_TRACK), SIM_BATCH_ERR_NULL_ARG);
+    assert_int_equal(sim_batch_run(NULL), SIM_BATCH_ERR_NULL_ARG);
+    assert_int_equal(sim_batch_get_result(batch, 0, NULL), SIM_BATCH_ERR_NULL_ARG);
+    assert_int_equal(sim_batch_get_summary(NULL, 0, &sum), SIM_BATCH_ERR_NULL_ARG);
+    assert_int_equal(sim_batch_get_result(batch, 0, &res), SIM_BATCH_ERR_BAD_INDEX);
+    assert_int_equal(sim_batch_job_count(NULL), 0);
+    assert_int_equal(sim_batch_summary_count(NULL), 0);
+    sim_batch_destroy(batch);
+}
+
+/* =========================================================================
+ * Group 2: Running
+ * ========================================================================= */
+
+static void test_results_match_single_sim(void **state)
+{
+    (void)state;
+    char path[512];
+    make_level_path(path, sizeof(path), 1);
+
+    sim_batch_t *batch = create_batch(2);
+    assert_int_equal(sim_batch_add_job(batch, path, 9, SIM_POLICY_TRACK), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+
+    sim_batch_result_t res;
+    assert_int_equal(sim_batch_get_result(batch, 0, &res), SIM_BATCH_OK);
+    assert_string_equal(res.path, path);
+    assert_int_equal(res.seed, 9);
+    assert_int_equal(res.load, SIM_SYS_OK);
+
+    sim_system_config_t sc;
+    sim_system_config_init(&sc);
+    sc.seed = 9;
+    sim_system_t *sim = sim_system_create(&sc, NULL);
+    assert_int_equal(sim_system_load_level(sim, path), SIM_SYS_OK);
+    sim_system_run(sim, TEST_TICKS);
+    sim_system_stats_t want;
+    sim_system_get_stats(sim, &want);
+    sim_system_destroy(sim);
+
+    assert_int_equal(res.stats.ticks, want.ticks);
+    assert_int_equal(res.stats.score, want.score);
+    assert_int_equal(res.stats.outcome, want.outcome);
+    assert_int_equal(res.stats.blocks_destroyed, want.blocks_destroyed);
+    sim_batch_destroy(batch);
+}
+
+static void test_thread_count_does_not_change_results(void **state)
+{
+    (void)state;
+    sim_batch_t *one = create_batch(1);
+    sim_batch_t *many = create_batch(5);
+    add_sweep(one);
+    add_sweep(many);
+    assert_int_equal(sim_batch_run(one), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_run(many), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_threads_used(one), 1);
+    assert_true(sim_batch_threads_used(many) >= 1);
+
+    for (size_t i = 0; i < sim_batch_job_count(one); i++)
+    {
+        sim_batch_result_t a, b;
+        assert_int_equal(sim_batch_get_result(one, i, &a), SIM_BATCH_OK);
+        assert_int_equal(sim_batch_get_result(many, i, &b), SIM_BATCH_OK);
+        assert_int_equal(a.seed, b.seed);
+        assert_int_equal(a.stats.ticks, b.stats.ticks);
+        assert_int_equal(a.stats.score, b.stats.score);
+        assert_int_equal(a.stats.balls_lost, b.stats.balls_lost);
+        assert_int_equal(a.stats.outcome, b.stats.outcome);
+    }
+    sim_batch_destroy(one);
+    sim_batch_destroy(many);
+}
+
+static void test_more_threads_than_jobs(void **state)
+{
+    (void)state;
+    char path[512];
+    make_level_path(path, sizeof(path), 2);
+
+    sim_batch_t *batch = create_batch(16);
+    assert_int_equal(sim_batch_add_job(batch, path, 1, SIM_POLICY_IDLE), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_threads_used(batch), 1);
+
+    sim_batch_result_t res;
+    assert_int_equal(sim_batch_get_result(batch, 0, &res), SIM_BATCH_OK);
+    assert_int_equal(res.policy, SIM_POLICY_IDLE);
+    assert_true(res.stats.ticks > 0);
+    assert_true(res.stats.ticks <= TEST_TICKS);
+    sim_batch_destroy(batch);
+}
+
+static void test_second_run_plays_only_new_jobs(void **state)
+{
+    (void)state;
+    char path[512];
+    make_level_path(path, sizeof(path), 1);
+
+    sim_batch_t *batch = create_batch(2);
+    sim_batch_add_job(batch, path, 1, SIM_POLICY_TRACK);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+
+    sim_batch_result_t before, after;
+    sim_batch_get_result(batch, 0, &before);
+    assert_int_equal(sim_batch_get_result(batch, 1, &after), SIM_BATCH_ERR_BAD_INDEX);
+
+    sim_batch_add_job(batch, path, 2, SIM_POLICY_TRACK);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_get_result(batch, 1, &after), SIM_BATCH_OK);
+    assert_int_equal(after.seed, 2);
+    sim_batch_get_result(batch, 0, &after);
+    assert_int_equal(after.stats.score, before.stats.score);
+
+    sim_batch_summary_t sum;
+    assert_int_equal(sim_batch_get_summary(batch, 0, &sum), SIM_BATCH_OK);
+    assert_int_equal(sum.runs, 2);
+    sim_batch_destroy(batch);
+}
+
+/* =========================================================================
+ * Group 3: Summaries
+ * ========================================================================= */
+
+static void test_summary_per_level_in_add_order(void **state)
+{
+    (void)state;
+    sim_batch_t *batch = create_batch(3);
+    add_sweep(batch);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+    assert_int_equal(sim_batch_summary_count(batch), 3);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        char path[512];
+        make_level_path(path, sizeof(path), (int)i + 1);
+
+        sim_batch_summary_t sum;
+        assert_int_equal(sim_batch_get_summary(batch, i, &sum), SIM_BATCH_OK);
+        assert_string_equal(sum.path, path);
+        assert_int_equal(sum.runs, 4);
+        assert_int_equal(sum.load_errors, 0);
+        assert_int_equal(sum.cleared + sum.game_over + sum.timed_out, 4);
+        assert_true(sum.score_min <= sum.score_p50);
+        assert_true(sum.score_p50 <= sum.score_p90);
+        assert_true(sum.score_p90 <= sum.score_max);
+        assert_true(sum.score_mean >= (double)sum.score_min);
+        assert_true(sum.score_mean <= (double)sum.score_max);
+    }
+
+    sim_batch_summary_t sum;
+    assert_int_equal(sim_batch_get_summary(batch, 3, &sum), SIM_BATCH_ERR_BAD_INDEX);
+    sim_batch_destroy(batch);
+}
+
+static void test_summary_clear_stats(void **state)
+{
+    (void)state;
+    char path[512];
+    make_level_path(path, sizeof(path), 1);
+
+    sim_batch_config_t config;
+    sim_batch_config_init(&config);
+    config.threads = 2;
+    sim_batch_t *batch = sim_batch_create(&config, NULL);
+    for (uint64_t seed = 1; seed <= 3; seed++)
+    {
+        sim_batch_add_job(batch, path, seed, SIM_POLICY_TRACK);
+    }
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+
+    sim_batch_summary_t sum;
+    assert_int_equal(sim_batch_get_summary(batch, 0, &sum), SIM_BATCH_OK);
+    assert_true(sum.cleared > 0);
+    assert_true(sum.clear_rate > 0.0);
+    assert_true(sum.ticks_to_clear_min > 0);
+    assert_true(sum.ticks_to_clear_min <= sum.ticks_to_clear_max);
+    assert_true(sum.ticks_to_clear_mean >= (double)sum.ticks_to_clear_min);
+    assert_true(sum.ticks_to_clear_mean <= (double)sum.ticks_to_clear_max);
+    sim_batch_destroy(batch);
+}
+
+static void test_summary_counts_load_errors(void **state)
+{
+    (void)state;
+    sim_batch_t *batch = create_batch(2);
+    sim_batch_add_job(batch, "/nonexistent/level.data", 1, SIM_POLICY_TRACK);
+    sim_batch_add_job(batch, "/nonexistent/level.data", 2, SIM_POLICY_TRACK);
+    assert_int_equal(sim_batch_run(batch), SIM_BATCH_OK);
+
+    sim_batch_result_t res;
+    sim_batch_get_result(batch, 0, &res);
+    assert_int_equal(res.load, SIM_SYS_ERR_LEVEL_LOAD);
+
+    sim_batch_summary_t sum;
+    assert_int_equal(sim_batch_get_summary(batch, 0, &sum), SIM_BATCH_OK);
+    assert_int_equal(sum.runs, 2);
+    assert_int_equal(sum.load_errors, 2);
+    assert_int_equal(sum.cleared, 0);
+    assert_true(sum.clear_rate == 0.0);
+    sim_batch_destroy(batch);
+}
+
+/* =========================================================================
+ * Group 4: Utility
+ * ========================================================================= */
+
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(sim_batch_status_string(SIM_BATCH_OK), "OK");
+    assert_string_equal(sim_batch_status_string(SIM_BATCH_ERR_BAD_INDEX), "index out of range");
+    assert_string_equal(sim_batch_status_string((sim_batch_status_t)99), "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle */
+        cmocka_unit_test(test_config_init),
+        cmocka_unit_test(test_create_empty),
+        cmocka_unit_test(test_null_args),
+
+        /* Group 2: Running */
+        cmocka_unit_test(test_results_match_single_sim),
+        cmocka_unit_test(test_thread_count_does_not_change_results),
+        cmocka_unit_test(test_more_threads_than_jobs),
+        cmocka_unit_test(test_second_run_plays_only_new_jobs),
+
+        /* Group 3: Summaries */
+        cmocka_unit_test(test_summary_per_level_in_add_order),
+        cmocka_unit_test(test_summary_clear_stats),
+        cmocka_unit_test(test_summary_counts_load_errors),
+
+        /* Group 4: Utility */
+        cmocka_unit_test(test_status_strings),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
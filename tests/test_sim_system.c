@@ -0,0 +1,450 @@
+/*
+ * test_sim_system.c — CMocka tests for the headless simulation module.
+ *
+ * Tests use real level files from levels/ directory.  Each context owns
+ * its RNG (config.seed), so runs are reproducible without srand().
+ *
+ * Test groups:
+ *   1. Lifecycle (3 tests)
+ *   2. Level loading (3 tests)
+ *   3. Simulation (6 tests)
+ *   4. Snapshots (4 tests)
+ *   5. Utility (2 tests)
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CMocka must come after setjmp.h */
+#include <cmocka.h>
+
+#include "sim_system.h"
+
+/* =========================================================================
+ * Test level file path — set by CMake define LEVELS_DIR
+ * ========================================================================= */
+
+#ifndef LEVELS_DIR
+#define LEVELS_DIR "./levels"
+#endif
+
+static void make_level_path(char *buf, int bufsize, int level_num)
+{
+    snprintf(buf, (size_t)bufsize, "%s/level%02d.data", LEVELS_DIR, level_num);
+}
+
+static sim_system_t *create_loaded(int level_num, sim_policy_t policy, uint64_t seed)
+{
+    sim_system_config_t config;
+    sim_system_config_init(&config);
+    config.policy = policy;
+    config.seed = seed;
+
+    sim_system_status_t st;
+    sim_system_t *sim = sim_system_create(&config, &st);
+    assert_non_null(sim);
+    assert_int_equal(st, SIM_SYS_OK);
+
+    char path[512];
+    make_level_path(path, (int)sizeof(path), level_num);
+    assert_int_equal(sim_system_load_level(sim, path), SIM_SYS_OK);
+    return sim;
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle
+ * ========================================================================= */
+
+static void test_create_defaults(void **state)
+{
+    (void)state;
+    sim_system_status_t st = SIM_SYS_ERR_NULL_ARG;
+    sim_system_t *sim = sim_system_create(NULL, &st);
+    assert_non_null(sim);
+    assert_int_equal(st, SIM_SYS_OK);
+    assert_non_null(sim_system_get_ball(sim));
+    assert_non_null(sim_system_get_block(sim));
+    assert_non_null(sim_system_get_paddle(sim));
+    assert_non_null(sim_system_get_gun(sim));
+    assert_int_equal(sim_system_get_frame(sim), 0);
+    sim_system_destroy(sim);
+}
+
+static void test_config_init(void **state)
+{
+    (void)state;
+    sim_system_config_t config;
+    memset(&config, 0xff, sizeof(config));
+    sim_system_config_init(&config);
+    assert_int_equal(config.speed_level, 5);
+    assert_int_equal(config.lives, 3);
+    assert_int_equal(config.policy, SIM_POLICY_TRACK);
+    assert_int_equal(config.seed, 1);
+}
+
+static void test_destroy_null(void **state)
+{
+    (void)state;
+    sim_system_destroy(NULL);
+}
+
+/* =========================================================================
+ * Group 2: Level loading
+ * ========================================================================= */
+
+static void test_load_level_places_blocks(void **state)
+{
+    (void)state;
+    sim_system_t *sim = create_loaded(1, SIM_POLICY_TRACK, 1);
+
+    assert_true(block_system_still_active(sim_system_get_block(sim)));
+    assert_int_equal(ball_system_get_state(sim_system_get_ball(sim), 0), BALL_WAIT);
+
+    sim_system_stats_t stats;
+    assert_int_equal(sim_system_get_stats(sim, &stats), SIM_SYS_OK);
+    assert_int_equal(stats.outcome, SIM_OUTCOME_RUNNING);
+    assert_int_equal(stats.lives_left, 3);
+    assert_true(stats.time_remaining > 0);
+    assert_int_equal(stats.ticks, 0);
+    sim_system_destroy(sim);
+}
+
+static void test_load_missing_file(void **state)
+{
+    (void)state;
+    sim_system_t *sim = sim_system_create(NULL, NULL);
+    assert_non_null(sim);
+    assert_int_equal(sim_system_load_level(sim, "/nonexistent/level.data"),
+                     SIM_SYS_ERR_LEVEL_LOAD);
+    assert_false(block_system_still_active(sim_system_get_block(sim)));
+    sim_system_destroy(sim);
+}
+
+static void test_load_null_args(void **state)
+{
+    (void)state;
+    sim_system_t *sim = sim_system_create(NULL, NULL);
+    assert_int_equal(sim_system_load_level(NULL, "x"), SIM_SYS_ERR_NULL_ARG);
+    assert_int_equal(sim_system_load_level(sim, NULL), SIM_SYS_ERR_NULL_ARG);
+    sim_system_destroy(sim);
+}
+
+/* =========================================================================
+ * Group 3: Simulation
+ * ========================================================================= */
+
+static void test_tick_advances_frame(void **state)
+{
+    (void)state;
+    sim_system_t *sim = create_loaded(1, SIM_POLICY_TRACK, 1);
+
+    for (int i = 0; i < 100; i++)
+    {
+        assert_int_equal(sim_system_tick(sim), SIM_OUTCOME_RUNNING);
+    }
+    assert_int_equal(sim_system_get_frame(sim), 100);
+
+    sim_system_stats_t stats;
+    sim_system_get_stats(sim, &stats);
+    assert_int_equal(stats.ticks, 100);
+    sim_system_destroy(sim);
+}
+
+static void test_track_policy_launches_ball(void **state)
+{
+    (void)state;
+    sim_system_t *sim = create_loaded(1, SIM_POLICY_TRACK, 1);
+
+    /* The ball sits in BALL_WAIT/BALL_CREATE first, then is launched as
+     * soon as it reaches BALL_READY instead of waiting for auto-launch. */
+    ball_system_t *ball = sim_system_get_ball(sim);
+    for (int i = 0; i < 1000 && ball_system_get_active_count(ball) == 0; i++)
+    {
+        sim_system_tick(sim);
+    }
+    assert_true(ball_system_get_active_count(ball) > 0);
+    assert_true(sim_system_get_frame(sim) < BALL_AUTO_ACTIVE_DELAY);
+    sim_system_destroy(sim);
+}
+
+static void test_track_policy_clears_level01(void **state)
+{
+    (void)state;
+    sim_system_t *sim = create_loaded(1, SIM_POLICY_TRACK, 1);
+
+    sim_outcome_t outcome = sim_system_run(sim, 500000);
+    assert_int_equal(outcome, SIM_OUTCOME_LEVEL_CLEARED);
+
+    sim_system_stats_t stats;
+    sim_system_get_stats(sim, &stats);
+    assert_true(stats.blocks_destroyed > 0);
+    assert_true(stats.score > 0);
+    assert_true(stats.paddle_hits > 0);
+    assert_int_equal(stats.outcome_tick, stats.ticks);
+
+    /* Ticking after an outcome is a no-op */
+    assert_int_equal(sim_system_tick(sim), SIM_OUTCOME_LEVEL_CLEARED);
+    sim_system_get_stats(sim, &stats);
+    assert_int_equal(stats.ticks, stats.outcome_tick);
+    sim_system_destroy(sim);
+}
+
+static void test_idle_policy_game_over(void **state)
+{
+    (void)state;
+    sim_system_t *sim = create_loaded(1, SIM_POLICY_IDLE, 1);
+
+    sim_outcome_t outcome = sim_system_run(sim, 500000);
+    assert_int_equal(outcome, SIM_OUTCOME_GAME_OVER);
+
+    sim_system_stats_t stats;
+    sim_system_get_stats(sim, &stats);
+    assert_int_equal(stats.lives_left, 0);
+    assert_true(stats.balls_lost >= 4);
+    sim_system_destroy(sim);
+}
+
+static void test_same_seed_same_run(void **state)
+{
+    (void)state;
+    sim_system_stats_t a, b;
+
+    sim_system_t *sim = create_loaded(2, SIM_POLICY_TRACK, 42);
+    sim_system_run(sim, 20000);
+    sim_system_get_stats(sim, &a);
+    sim_system_destroy(sim);
+
+    sim = create_loaded(2, SIM_POLICY_TRACK, 42);
+    sim_system_run(sim, 20000);
+    sim_system_get_stats(sim, &b);
+    sim_system_destroy(sim);
+
+    assert_int_equal(a.ticks, b.ticks);
+    assert_int_equal(a.score, b.score);
+    assert_int_equal(a.blocks_destroyed, b.blocks_destroyed);
+    assert_int_equal(a.paddle_hits, b.paddle_hits);
+    assert_int_equal(a.balls_lost, b.balls_lost);
+}
+
+static void test_contexts_do_not_share_rng(void **state)
+{
+    (void)state;
+    sim_system_stats_t solo, a, b;
+
+    sim_system_t *sim = create_loaded(2, SIM_POLICY_TRACK, 7);
+    sim_system_run(sim, 20000);
+    sim_system_get_stats(sim, &solo);
+    sim_system_destroy(sim);
+
+    /* Interleave two contexts tick by tick and drain the stdlib stream
+     * in between: neither may perturb the other's run. */
+    sim_system_t *sa = create_loaded(2, SIM_POLICY_TRACK, 7);
+    sim_system_t *sb = create_loaded(3, SIM_POLICY_TRACK, 99);
+    for (int i = 0; i < 20000; i++)
+    {
+        sim_system_tick(sa);
+        (void)rand();
+        sim_system_tick(sb);
+    }
+    sim_system_get_stats(sa, &a);
+    sim_system_get_stats(sb, &b);
+    sim_system_destroy(sa);
+    sim_system_destroy(sb);
+
+    assert_int_equal(a.ticks, solo.ticks);
+    assert_int_equal(a.score, solo.score);
+    assert_int_equal(a.blocks_destroyed, solo.blocks_destroyed);
+    assert_int_equal(a.paddle_hits, solo.paddle_hits);
+    assert_int_equal(a.balls_lost, solo.balls_lost);
+}
+
+/* =========================================================================
+ * Group 4: Snapshots
+ * ========================================================================= */
+
+/* Run `ticks` ticks and fill *out; also return the paddle position. */
+static int run_and_capture(sim_system_t *sim, uint64_t ticks, sim_system_stats_t *out)
+{
+    sim_system_run(sim, ticks);
+    sim_system_get_stats(sim, out);
+    return paddle_system_get_pos(sim_system_get_paddle(sim));
+}
+
+static void assert_same_stats(const sim_system_stats_t *a, const sim_system_stats_t *b)
+{
+    assert_int_equal(a->ticks, b->ticks);
+    assert_int_equal(a->score, b->score);
+    assert_int_equal(a->blocks_destroyed, b->blocks_destroyed);
+    assert_int_equal(a->paddle_hits, b->paddle_hits);
+    assert_int_equal(a->balls_lost, b->balls_lost);
+    assert_int_equal(a->lives_left, b->lives_left);
+    assert_int_equal(a->time_remaining, b->time_remaining);
+    assert_int_equal(a->outcome, b->outcome);
+}
+
+static void test_snapshot_rewind_repeats_run(void **state)
+{
+    (void)state;
+    sim_system_stats_t first, second;
+
+    sim_system_t *sim = create_loaded(2, SIM_POLICY_TRACK, 11);
+    sim_system_run(sim, 3000);
+    int frame = sim_system_get_frame(sim);
+
+    sim_system_snapshot_t *snap = sim_system_snapshot_create();
+    assert_non_null(snap);
+    assert_int_equal(sim_system_snapshot_save(sim, snap), SIM_SYS_OK);
+
+    int pos1 = run_and_capture(sim, 8000, &first);
+    assert_true(first.ticks > 3000);
+
+    assert_int_equal(sim_system_snapshot_load(sim, snap), SIM_SYS_OK);
+    assert_int_equal(sim_system_get_frame(sim), frame);
+    int pos2 = run_and_capture(sim, 8000, &second);
+
+    assert_same_stats(&first, &second);
+    assert_int_equal(pos1, pos2);
+
+    sim_system_snapshot_destroy(snap);
+    sim_system_destroy(sim);
+}
+
+static void test_snapshot_forks_into_other_context(void **state)
+{
+    (void)state;
+    sim_system_stats_t orig, fork;
+
+    sim_system_t *sim = create_loaded(2, SIM_POLICY_TRACK, 5);
+    sim_system_run(sim, 2500);
+
+    /* Different level, seed and policy: the snapshot must replace all of it. */
+    sim_system_t *other = create_loaded(4, SIM_POLICY_IDLE, 12345);
+    sim_system_run(other, 100);
+
+    sim_system_snapshot_t *snap = sim_system_snapshot_create();
+    assert_non_null(snap);
+    sim_system_snapshot_save(sim, snap);
+    sim_system_snapshot_load(other, snap);
+
+    int pos1 = run_and_capture(sim, 6000, &orig);
+    int pos2 = run_and_capture(other, 6000, &fork);
+    assert_same_stats(&orig, &fork);
+    assert_int_equal(pos1, pos2);
+    assert_int_equal(block_system_still_active(sim_system_get_block(sim)),
+                     block_system_still_active(sim_system_get_block(other)));
+
+    sim_system_snapshot_destroy(snap);
+    sim_system_destroy(other);
+    sim_system_destroy(sim);
+}
+
+static void test_snapshot_is_memcpy_able(void **state)
+{
+    (void)state;
+    sim_system_stats_t orig, copy;
+    size_t size = sim_system_snapshot_size();
+    assert_true(size > 0);
+
+    sim_system_t *sim = create_loaded(3, SIM_POLICY_TRACK, 77);
+    sim_system_run(sim, 1500);
+
+    sim_system_snapshot_t *snap = sim_system_snapshot_create();
+    assert_non_null(snap);
+    sim_system_snapshot_save(sim, snap);
+
+    /* A byte copy of the blob outlives the original buffer. */
+    unsigned char *raw = malloc(size);
+    assert_non_null(raw);
+    memcpy(raw, snap, size);
+    sim_system_snapshot_destroy(snap);
+
+    sim_system_get_stats(sim, &orig);
+    sim_system_run(sim, 500);
+    sim_system_snapshot_load(sim, (const sim_system_snapshot_t *)raw);
+    sim_system_get_stats(sim, &copy);
+    assert_same_stats(&orig, &copy);
+
+    free(raw);
+    sim_system_destroy(sim);
+}
+
+static void test_snapshot_null_args(void **state)
+{
+    (void)state;
+    sim_system_t *sim = sim_system_create(NULL, NULL);
+    assert_non_null(sim);
+    sim_system_snapshot_t *snap = sim_system_snapshot_create();
+    assert_non_null(snap);
+
+    assert_int_equal(sim_system_snapshot_save(NULL, snap), SIM_SYS_ERR_NULL_ARG);
+    assert_int_equal(sim_system_snapshot_save(sim, NULL), SIM_SYS_ERR_NULL_ARG);
+    assert_int_equal(sim_system_snapshot_load(NULL, snap), SIM_SYS_ERR_NULL_ARG);
+    assert_int_equal(sim_system_snapshot_load(sim, NULL), SIM_SYS_ERR_NULL_ARG);
+    sim_system_snapshot_destroy(NULL);
+
+    sim_system_snapshot_destroy(snap);
+    sim_system_destroy(sim);
+}
+
+/* =========================================================================
+ * Group 5: Utility
+ * ========================================================================= */
+
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(sim_system_status_string(SIM_SYS_OK), "OK");
+    assert_string_equal(sim_system_status_string(SIM_SYS_ERR_LEVEL_LOAD), "level load failed");
+    assert_string_equal(sim_system_status_string((sim_system_status_t)99), "unknown status");
+}
+
+static void test_outcome_names(void **state)
+{
+    (void)state;
+    assert_string_equal(sim_system_outcome_name(SIM_OUTCOME_RUNNING), "running");
+    assert_string_equal(sim_system_outcome_name(SIM_OUTCOME_LEVEL_CLEARED), "cleared");
+    assert_string_equal(sim_system_outcome_name(SIM_OUTCOME_GAME_OVER), "game_over");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle */
+        cmocka_unit_test(test_create_defaults),
+        cmocka_unit_test(test_config_init),
+        cmocka_unit_test(test_destroy_null),
+
+        /* Group 2: Level loading */
+        cmocka_unit_test(test_load_level_places_blocks),
+        cmocka_unit_test(test_load_missing_file),
+        cmocka_unit_test(test_load_null_args),
+
+        /* Group 3: Simulation */
+        cmocka_unit_test(test_tick_advances_frame),
+        cmocka_unit_test(test_track_policy_launches_ball),
+        cmocka_unit_test(test_track_policy_clears_level01),
+        cmocka_unit_test(test_idle_policy_game_over),
+        cmocka_unit_test(test_same_seed_same_run),
+        cmocka_unit_test(test_contexts_do_not_share_rng),
+
+        /* Group 4: Snapshots */
+        cmocka_unit_test(test_snapshot_rewind_repeats_run),
+        cmocka_unit_test(test_snapshot_forks_into_other_context),
+        cmocka_unit_test(test_snapshot_is_memcpy_able),
+        cmocka_unit_test(test_snapshot_null_args),
+
+        /* Group 5: Utility */
+        cmocka_unit_test(test_status_strings),
+        cmocka_unit_test(test_outcome_names),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,106 @@
+/*
+ * test_sound_catalog.c — Tests for the sound ID catalog (ADR-096).
+ *
+ * Pure header tests plus one directory scan: every .wav in sounds/ must
+ * have an ID, so a new asset cannot be added without one.  The reverse
+ * direction (every ID has a file) is checked against the real audio
+ * cache in test_audio_name_validation.c.  Working directory is the
+ * project root (set in tests/CMakeLists.txt).
+ */
+
+#include <dirent.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* cmocka must come after setjmp.h / stdarg.h / stddef.h */
+#include <cmocka.h>
+
+#include "sound_catalog.h"
+
+/* =========================================================================
+ * Group 1 — Key table
+ * ========================================================================= */
+
+static void test_key_table_complete_and_unique(void **state)
+{
+    (void)state;
+    const char *const *keys = sound_key_table();
+    for (int i = 0; i < SOUND_COUNT; i++)
+    {
+        assert_non_null(keys[i]);
+        assert_ptr_equal(sound_key((sound_id_t)i), keys[i]);
+        for (int j = 0; j < i; j++)
+        {
+            assert_string_not_equal(keys[i], keys[j]);
+        }
+    }
+    assert_string_equal(sound_key(SOUND_BOING), "boing");
+    assert_string_equal(sound_key(SOUND_DOH1), "Doh1");
+    assert_string_equal(sound_key(SOUND_YOUAGOD), "youagod");
+}
+
+static void test_key_out_of_range_is_null(void **state)
+{
+    (void)state;
+    assert_null(sound_key(SOUND_NONE));
+    assert_null(sound_key(SOUND_COUNT));
+}
+
+/* =========================================================================
+ * Group 2 — Catalog covers the sound assets
+ * ========================================================================= */
+
+static int catalog_has(const char *key)
+{
+    for (int i = 0; i < SOUND_COUNT; i++)
+    {
+        if (strcmp(sound_key((sound_id_t)i), key) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+static void test_every_wav_has_an_id(void **state)
+{
+    (void)state;
+    DIR *dir = opendir("sounds");
+    assert_non_null(dir);
+
+    int wavs = 0;
+    const struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        size_t len = strlen(entry->d_name);
+        if (len < 4 || strcmp(entry->d_name + len - 4, ".wav") != 0)
+            continue;
+
+        char key[64];
+        snprintf(key, sizeof(key), "%.*s", (int)(len - 4), entry->d_name);
+        if (!catalog_has(key))
+            fprintf(stderr, "sounds/%s has no SOUND_LIST entry\n", entry->d_name);
+        assert_true(catalog_has(key));
+        wavs++;
+    }
+    closedir(dir);
+    assert_int_equal(wavs, SOUND_COUNT);
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1 — Key table */
+        cmocka_unit_test(test_key_table_complete_and_unique),
+        cmocka_unit_test(test_key_out_of_range_is_null),
+        /* Group 2 — Catalog covers the sound assets */
+        cmocka_unit_test(test_every_wav_has_an_id),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
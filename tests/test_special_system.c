@@ -46,8 +46,9 @@ static void reset_wall_tracking(void)
 static int g_rand_sequence[16];
 static int g_rand_index;
 
-static int deterministic_rand(void)
+static int deterministic_rand(void *user_data)
 {
+    (void)user_data;
     return g_rand_sequence[g_rand_index++];
 }
 
@@ -10,11 +10,15 @@
  *   3. DEATH 5-frame cycling (slide modulo 5)
  *   4. EXTRABALL 2-frame cycling (slide modulo 2)
  *   5. ROAMER directional + out-of-range clamp
+ *   6. Negative slide handling for cycling cases
+ *   7. sprite_block_key base-sprite corrections
+ *   8. Sprite IDs: key table and the ID helpers' enum arithmetic
  */
 
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdio.h>
 #include <string.h>
 
 /* cmocka must come after setjmp.h / stdarg.h / stddef.h */
@@ -211,6 +215,91 @@ static void test_block_key_bullet_blk_is_yellow(void **state)
     assert_string_equal(sprite_block_key(BULLET_BLK), SPR_BLOCK_YELLOW);
 }
 
+/* =========================================================================
+ * Group 8 — Sprite IDs (ADR-086)
+ *
+ * Several *_id helpers index into runs of the enum (SPRITE_DIGIT_0 + d);
+ * these checks catch a SPRITE_LIST reorder that would break a run.
+ * ========================================================================= */
+
+static void test_key_table_complete_and_unique(void **state)
+{
+    (void)state;
+    const char *const *keys = sprite_key_table();
+    for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+        assert_non_null(keys[i]);
+        assert_ptr_equal(sprite_key((sprite_id_t)i), keys[i]);
+        for (int j = 0; j < i; j++)
+        {
+            assert_string_not_equal(keys[i], keys[j]);
+        }
+    }
+    assert_string_equal(sprite_key(SPRITE_BALL_1), SPR_BALL_1);
+    assert_string_equal(sprite_key(SPRITE_PRESENTS_EARTH), SPR_PRESENTS_EARTH);
+}
+
+static void test_key_out_of_range_is_null(void **state)
+{
+    (void)state;
+    assert_null(sprite_key(SPRITE_NONE));
+    assert_null(sprite_key(SPRITE_COUNT));
+}
+
+/* Expected key for frame n of a numbered run, e.g. "digits/digit%d". */
+static void assert_run(sprite_id_t id, const char *fmt, int n)
+{
+    char want[64];
+    snprintf(want, sizeof(want), fmt, n);
+    assert_string_equal(sprite_key(id), want);
+}
+
+static void test_id_runs_are_contiguous(void **state)
+{
+    (void)state;
+    for (int d = 0; d <= 9; d++)
+    {
+        assert_run(sprite_digit_id(d), "digits/digit%d", d);
+    }
+    for (int f = 1; f <= 11; f++)
+    {
+        assert_run(sprite_star_id(f), "stars/star%d", f);
+    }
+    for (int pos = 0; pos <= 10; pos++)
+    {
+        assert_run(sprite_guide_id(pos), "guides/guide%d", pos + 1);
+    }
+    for (int f = 1; f <= 8; f++)
+    {
+        assert_run(sprite_ball_birth_id(f), "balls/bbirth%d", f);
+    }
+    for (int slide = 1; slide <= 5; slide++)
+    {
+        assert_run(sprite_counter_slide_id(slide), "blocks/cntblk%d", slide);
+    }
+    for (int f = 0; f < 3; f++)
+    {
+        assert_run(sprite_block_explode_id(RED_BLK, f), "blockex/exred%d", f + 1);
+        assert_run(sprite_block_explode_id(BONUSX4_BLK, f), "blockex/exx2bs%d", f + 1);
+    }
+    for (int f = 0; f < 4; f++)
+    {
+        assert_run(sprite_block_explode_id(DEATH_BLK, f), "blockex/exdeath%d", f + 1);
+    }
+}
+
+static void test_id_fallbacks(void **state)
+{
+    (void)state;
+    assert_int_equal(sprite_digit_id(10), SPRITE_DIGIT_0);
+    assert_int_equal(sprite_star_id(0), SPRITE_STAR_1);
+    assert_int_equal(sprite_guide_id(11), SPRITE_GUIDE_6);
+    assert_int_equal(sprite_ball_birth_id(9), SPRITE_BALL_1);
+    assert_int_equal(sprite_counter_slide_id(0), SPRITE_BLOCK_COUNTER);
+    assert_int_equal(sprite_block_id(NONE_BLK), SPRITE_NONE);
+    assert_null(sprite_block_key(NONE_BLK));
+}
+
 /* =========================================================================
  * Test runner
  * ========================================================================= */
@@ -248,6 +337,12 @@ int main(void)
         cmocka_unit_test(test_block_key_drop_blk_is_green),
         cmocka_unit_test(test_block_key_random_blk_is_red),
         cmocka_unit_test(test_block_key_bullet_blk_is_yellow),
+
+        /* Group 8 — Sprite IDs */
+        cmocka_unit_test(test_key_table_complete_and_unique),
+        cmocka_unit_test(test_key_out_of_range_is_null),
+        cmocka_unit_test(test_id_runs_are_contiguous),
+        cmocka_unit_test(test_id_fallbacks),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
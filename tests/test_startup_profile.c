@@ -0,0 +1,193 @@
+/*
+ * test_startup_profile.c — CMocka tests for the startup phase profile.
+ *
+ * Pure logic tests — no SDL2 needed.  A fake microsecond clock sets each
+ * phase's length.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* cmocka.h must come after the setjmp/stdarg/stddef includes. */
+#include <cmocka.h>
+
+#include "startup_profile.h"
+
+/* =========================================================================
+ * Fake clock and helpers
+ * ========================================================================= */
+
+static uint64_t fake_us;
+
+static uint64_t fake_clock(void)
+{
+    return fake_us;
+}
+
+static int reset_fake_clock(void **state)
+{
+    (void)state;
+    fake_us = 5000000U;
+    return 0;
+}
+
+static startup_profile_t *create_profile(void)
+{
+    startup_profile_status_t st = STARTUP_PROFILE_ERR_NULL_ARG;
+    startup_profile_t *p = startup_profile_create(fake_clock, &st);
+    assert_non_null(p);
+    assert_int_equal(st, STARTUP_PROFILE_OK);
+    return p;
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle
+ * ========================================================================= */
+
+/* TC-01: Create requires a clock; NULL is safe everywhere. */
+static void test_create_and_null(void **state)
+{
+    (void)state;
+    startup_profile_status_t st = STARTUP_PROFILE_OK;
+    assert_null(startup_profile_create(NULL, &st));
+    assert_int_equal(st, STARTUP_PROFILE_ERR_NULL_ARG);
+    assert_null(startup_profile_create(NULL, NULL));
+
+    startup_profile_destroy(NULL);
+    assert_int_equal(startup_profile_mark(NULL, "x"), STARTUP_PROFILE_ERR_NULL_ARG);
+    assert_int_equal(startup_profile_count(NULL), 0);
+    assert_int_equal(startup_profile_total_us(NULL), 0);
+    startup_profile_report(NULL, stdout);
+
+    startup_profile_phase_t ph;
+    assert_int_equal(startup_profile_get(NULL, 0, &ph), STARTUP_PROFILE_ERR_NULL_ARG);
+
+    startup_profile_t *p = create_profile();
+    assert_int_equal(startup_profile_mark(p, NULL), STARTUP_PROFILE_ERR_NULL_ARG);
+    assert_int_equal(startup_profile_count(p), 0);
+    startup_profile_report(p, NULL);
+    startup_profile_destroy(p);
+}
+
+/* =========================================================================
+ * Group 2: Phases
+ * ========================================================================= */
+
+/* TC-02: Each mark records the time since the previous one. */
+static void test_marks_split_time(void **state)
+{
+    (void)state;
+    startup_profile_t *p = create_profile();
+
+    fake_us += 1500;
+    assert_int_equal(startup_profile_mark(p, "config"), STARTUP_PROFILE_OK);
+    fake_us += 20000;
+    assert_int_equal(startup_profile_mark(p, "window"), STARTUP_PROFILE_OK);
+    assert_int_equal(startup_profile_mark(p, "empty"), STARTUP_PROFILE_OK);
+
+    assert_int_equal(startup_profile_count(p), 3);
+    startup_profile_phase_t ph;
+    assert_int_equal(startup_profile_get(p, 0, &ph), STARTUP_PROFILE_OK);
+    assert_string_equal(ph.name, "config");
+    assert_int_equal(ph.us, 1500);
+    assert_int_equal(startup_profile_get(p, 1, &ph), STARTUP_PROFILE_OK);
+    assert_string_equal(ph.name, "window");
+    assert_int_equal(ph.us, 20000);
+    assert_int_equal(startup_profile_get(p, 2, &ph), STARTUP_PROFILE_OK);
+    assert_int_equal(ph.us, 0);
+    assert_int_equal(startup_profile_get(p, 3, &ph), STARTUP_PROFILE_ERR_NULL_ARG);
+    assert_int_equal(startup_profile_get(p, -1, &ph), STARTUP_PROFILE_ERR_NULL_ARG);
+
+    assert_int_equal(startup_profile_total_us(p), 21500);
+    startup_profile_destroy(p);
+}
+
+/* TC-03: Marks beyond the capacity are refused without disturbing the rest. */
+static void test_full(void **state)
+{
+    (void)state;
+    startup_profile_t *p = create_profile();
+    for (int i = 0; i < STARTUP_PROFILE_MAX_PHASES; i++)
+    {
+        fake_us += 10;
+        assert_int_equal(startup_profile_mark(p, "phase"), STARTUP_PROFILE_OK);
+    }
+    fake_us += 10;
+    assert_int_equal(startup_profile_mark(p, "late"), STARTUP_PROFILE_ERR_FULL);
+    assert_int_equal(startup_profile_count(p), STARTUP_PROFILE_MAX_PHASES);
+    assert_int_equal(startup_profile_total_us(p), 10U * STARTUP_PROFILE_MAX_PHASES);
+    startup_profile_destroy(p);
+}
+
+/* =========================================================================
+ * Group 3: Report
+ * ========================================================================= */
+
+/* TC-04: One line per phase with its share, then the total. */
+static void test_report(void **state)
+{
+    (void)state;
+    startup_profile_t *p = create_profile();
+    fake_us += 25000;
+    startup_profile_mark(p, "textures");
+    fake_us += 75000;
+    startup_profile_mark(p, "audio");
+
+    FILE *f = tmpfile();
+    assert_non_null(f);
+    startup_profile_report(p, f);
+    rewind(f);
+
+    char text[512];
+    size_t n = fread(text, 1, sizeof(text) - 1, f);
+    text[n] = '\0';
+    fclose(f);
+
+    assert_non_null(strstr(text, "startup: textures           25.00 ms  25.0%\n"));
+    assert_non_null(strstr(text, "startup: audio              75.00 ms  75.0%\n"));
+    assert_non_null(strstr(text, "startup: total             100.00 ms\n"));
+    assert_true(strstr(text, "textures") < strstr(text, "audio"));
+    startup_profile_destroy(p);
+}
+
+/* =========================================================================
+ * Group 4: Status strings
+ * ========================================================================= */
+
+/* TC-05: Every status has a string. */
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(startup_profile_status_string(STARTUP_PROFILE_OK), "OK");
+    assert_string_equal(startup_profile_status_string(STARTUP_PROFILE_ERR_ALLOC_FAILED),
+                        "allocation failed");
+    assert_string_equal(startup_profile_status_string(STARTUP_PROFILE_ERR_FULL),
+                        "too many phases");
+    assert_string_equal(startup_profile_status_string((startup_profile_status_t)99),
+                        "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle */
+        cmocka_unit_test_setup(test_create_and_null, reset_fake_clock),
+        /* Group 2: Phases */
+        cmocka_unit_test_setup(test_marks_split_time, reset_fake_clock),
+        cmocka_unit_test_setup(test_full, reset_fake_clock),
+        /* Group 3: Report */
+        cmocka_unit_test_setup(test_report, reset_fake_clock),
+        /* Group 4: Status strings */
+        cmocka_unit_test_setup(test_status_strings, reset_fake_clock),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
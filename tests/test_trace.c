@@ -0,0 +1,371 @@
+/*
+ * test_trace.c — CMocka tests for the frame profiler's timing zones.
+ *
+ * Pure logic tests — no SDL2 needed.  A fake nanosecond clock makes the
+ * recorded timestamps deterministic; the JSON is checked by searching
+ * the written file for the expected events.
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* cmocka.h must come after the setjmp/stdarg/stddef includes. */
+#include <cmocka.h>
+
+#include <pthread.h>
+
+/* The zone macros are under test, so compile them in regardless. */
+#ifndef XBOING_TRACE
+#define XBOING_TRACE 1
+#endif
+
+#include "trace.h"
+
+/* =========================================================================
+ * Fake clock and helpers
+ * ========================================================================= */
+
+static _Atomic uint64_t fake_ns;
+
+/* Each read advances time by 1 us, so every zone lasts at least that. */
+static uint64_t fake_clock(void)
+{
+    return fake_ns += 1000U;
+}
+
+static char trace_path[64];
+
+static int setup(void **state)
+{
+    (void)state;
+    fake_ns = 5000000U;
+    snprintf(trace_path, sizeof(trace_path), "test_trace_%d.json", rand());
+    return 0;
+}
+
+static int teardown(void **state)
+{
+    (void)state;
+    trace_shutdown();
+    trace_stats_stop();
+    remove(trace_path);
+    return 0;
+}
+
+/* Read the whole trace file into a NUL-terminated buffer. */
+static char *read_trace(void)
+{
+    FILE *fp = fopen(trace_path, "r");
+    assert_non_null(fp);
+    static char buf[1 << 16];
+    size_t n = fread(buf, 1, sizeof(buf) - 1, fp);
+    buf[n] = '\0';
+    fclose(fp);
+    return buf;
+}
+
+static int count_occurrences(const char *haystack, const char *needle)
+{
+    int n = 0;
+    for (const char *p = strstr(haystack, needle); p != NULL; p = strstr(p + 1, needle))
+    {
+        n++;
+    }
+    return n;
+}
+
+static void one_zone(void)
+{
+    const uint64_t t0 = trace_zone_begin();
+    trace_zone_end("work", t0);
+}
+
+/* A zone whose body reads the clock `reads` times: (reads + 1) us long. */
+static void timed_zone(const char *name, int reads)
+{
+    const uint64_t t0 = trace_zone_begin();
+    for (int i = 0; i < reads; i++)
+    {
+        fake_clock();
+    }
+    trace_zone_end(name, t0);
+}
+
+/* =========================================================================
+ * Group 1: Lifecycle
+ * ========================================================================= */
+
+/* TC-01: start needs a clock and refuses to run twice. */
+static void test_start_and_restart(void **state)
+{
+    (void)state;
+    assert_false(trace_is_running());
+    assert_int_equal(trace_start(NULL, 0), TRACE_ERR_NULL_ARG);
+    assert_int_equal(trace_start(fake_clock, 0), TRACE_OK);
+    assert_true(trace_is_running());
+    assert_int_equal(trace_start(fake_clock, 0), TRACE_ERR_RUNNING);
+    trace_shutdown();
+    assert_false(trace_is_running());
+    trace_shutdown();
+}
+
+/* TC-02: With no trace running, zones cost nothing and record nothing. */
+static void test_idle_zones_record_nothing(void **state)
+{
+    (void)state;
+    uint64_t before = fake_ns;
+    assert_int_equal(trace_zone_begin(), 0);
+    trace_zone_end("work", 0);
+    assert_int_equal(fake_ns, before);
+
+    assert_int_equal(trace_start(fake_clock, 16), TRACE_OK);
+    assert_int_equal(trace_write_json(trace_path), TRACE_OK);
+    assert_int_equal(count_occurrences(read_trace(), "\"ph\": \"X\""), 0);
+}
+
+/* =========================================================================
+ * Group 2: Recording and export
+ * ========================================================================= */
+
+/* TC-03: Macro zones nest and carry their names and timings. */
+static void test_macro_zones_exported(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_start(fake_clock, 16), TRACE_OK); /* origin 5001 us */
+
+    TRACE_BEGIN(outer); /* 5002 us */
+    TRACE_BEGIN(inner); /* 5003 us */
+    TRACE_END(inner);   /* 5004 us */
+    TRACE_END(outer);   /* 5005 us */
+
+    assert_int_equal(trace_write_json(trace_path), TRACE_OK);
+    const char *json = read_trace();
+    assert_non_null(strstr(json, "\"traceEvents\""));
+    assert_non_null(strstr(json, "\"name\": \"thread_name\""));
+    assert_non_null(strstr(json, "{\"name\": \"inner\", \"cat\": \"xboing\", \"ph\": \"X\", "
+                                 "\"ts\": 2.000, \"dur\": 1.000"));
+    assert_non_null(strstr(json, "{\"name\": \"outer\", \"cat\": \"xboing\", \"ph\": \"X\", "
+                                 "\"ts\": 1.000, \"dur\": 3.000"));
+    assert_int_equal(trace_dropped(), 0);
+}
+
+/* TC-04: A full ring keeps the newest zones and counts the rest. */
+static void test_ring_overwrites_oldest(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_start(fake_clock, 4), TRACE_OK);
+    for (int i = 0; i < 10; i++)
+    {
+        one_zone();
+    }
+    assert_int_equal(trace_dropped(), 6);
+
+    assert_int_equal(trace_write_json(trace_path), TRACE_OK);
+    const char *json = read_trace();
+    assert_int_equal(count_occurrences(json, "\"name\": \"work\""), 4);
+    /* The last zone began at the 21st clock read after the origin. */
+    assert_non_null(strstr(json, "\"ts\": 19.000"));
+    assert_null(strstr(json, "\"ts\": 1.000"));
+}
+
+/* TC-05: A restarted trace starts empty. */
+static void test_restart_clears(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_start(fake_clock, 16), TRACE_OK);
+    one_zone();
+    trace_shutdown();
+
+    assert_int_equal(trace_start(fake_clock, 16), TRACE_OK);
+    one_zone();
+    assert_int_equal(trace_write_json(trace_path), TRACE_OK);
+    assert_int_equal(count_occurrences(read_trace(), "\"name\": \"work\""), 1);
+}
+
+/* =========================================================================
+ * Group 3: Threads
+ * ========================================================================= */
+
+static void *worker(void *arg)
+{
+    (void)arg;
+    for (int i = 0; i < 100; i++)
+    {
+        one_zone();
+    }
+    return NULL;
+}
+
+/* TC-06: Each thread records into its own ring, exported as its own tid. */
+static void test_threads_get_own_rings(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_start(fake_clock, 256), TRACE_OK);
+    pthread_t threads[3];
+    for (int i = 0; i < 3; i++)
+    {
+        assert_int_equal(pthread_create(&threads[i], NULL, worker, NULL), 0);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    assert_int_equal(trace_write_json(trace_path), TRACE_OK);
+    const char *json = read_trace();
+    assert_int_equal(count_occurrences(json, "\"name\": \"thread_name\""), 3);
+    assert_int_equal(count_occurrences(json, "\"name\": \"work\""), 300);
+    assert_non_null(strstr(json, "\"tid\": 1}"));
+    assert_non_null(strstr(json, "\"tid\": 3}"));
+    assert_int_equal(trace_dropped(), 0);
+}
+
+/* =========================================================================
+ * Group 4: Statistics
+ * ========================================================================= */
+
+/* TC-07: Totals are kept per name, sorted, and reset by each take. */
+static void test_stats_totals_sorted(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_stats_start(NULL), TRACE_ERR_NULL_ARG);
+    assert_int_equal(trace_stats_start(fake_clock), TRACE_OK);
+    assert_int_equal(trace_stats_start(fake_clock), TRACE_ERR_RUNNING);
+    assert_false(trace_is_running());
+
+    timed_zone("small", 0);
+    timed_zone("big", 4);
+    timed_zone("big", 2);
+
+    trace_zone_stat_t out[4];
+    assert_int_equal(trace_stats_take(out, 4), 2);
+    assert_string_equal(out[0].name, "big");
+    assert_int_equal(out[0].total_ns, 8000);
+    assert_int_equal(out[0].count, 2);
+    assert_string_equal(out[1].name, "small");
+    assert_int_equal(out[1].total_ns, 1000);
+    assert_int_equal(out[1].count, 1);
+
+    assert_int_equal(trace_stats_take(out, 4), 0);
+    timed_zone("small", 0);
+    assert_int_equal(trace_stats_take(out, 1), 1);
+    assert_string_equal(out[0].name, "small");
+}
+
+/* TC-08: Statistics and a file trace run side by side and stop apart. */
+static void test_stats_with_trace(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_stats_start(fake_clock), TRACE_OK);
+    assert_int_equal(trace_start(fake_clock, 16), TRACE_OK);
+    TRACE_BEGIN(both);
+    TRACE_END(both);
+
+    trace_shutdown();
+    TRACE_BEGIN(stats_only);
+    TRACE_END(stats_only);
+
+    trace_zone_stat_t out[4];
+    assert_int_equal(trace_stats_take(out, 4), 2);
+
+    trace_stats_stop();
+    assert_int_equal(trace_zone_begin(), 0);
+    assert_int_equal(trace_stats_take(out, 4), 0);
+}
+
+static void *stats_worker(void *arg)
+{
+    (void)arg;
+    one_zone();
+    return NULL;
+}
+
+/* TC-09: Only the thread that started the statistics is counted. */
+static void test_stats_owner_thread_only(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_stats_start(fake_clock), TRACE_OK);
+    pthread_t thread;
+    assert_int_equal(pthread_create(&thread, NULL, stats_worker, NULL), 0);
+    pthread_join(thread, NULL);
+
+    trace_zone_stat_t out[4];
+    assert_int_equal(trace_stats_take(out, 4), 0);
+    assert_int_equal(trace_stats_take(NULL, 4), 0);
+}
+
+/* TC-10: One name in two buffers (as from two translation units whose
+ * literals were not merged) is one zone. */
+static void test_stats_names_compared_by_content(void **state)
+{
+    (void)state;
+    char first[] = "zone";
+    char second[] = "zone";
+    assert_ptr_not_equal(first, second);
+    assert_int_equal(trace_stats_start(fake_clock), TRACE_OK);
+
+    timed_zone(first, 1);
+    timed_zone(second, 2);
+
+    trace_zone_stat_t out[4];
+    assert_int_equal(trace_stats_take(out, 4), 1);
+    assert_string_equal(out[0].name, "zone");
+    assert_int_equal(out[0].count, 2);
+}
+
+/* =========================================================================
+ * Group 5: Errors and status strings
+ * ========================================================================= */
+
+/* TC-11: Unwritable paths are reported. */
+static void test_write_errors(void **state)
+{
+    (void)state;
+    assert_int_equal(trace_write_json(NULL), TRACE_ERR_NULL_ARG);
+    assert_int_equal(trace_write_json("/nonexistent-dir/trace.json"), TRACE_ERR_IO);
+}
+
+/* TC-12: Every status has a string. */
+static void test_status_strings(void **state)
+{
+    (void)state;
+    assert_string_equal(trace_status_string(TRACE_OK), "OK");
+    assert_string_equal(trace_status_string(TRACE_ERR_NULL_ARG), "NULL argument");
+    assert_string_equal(trace_status_string(TRACE_ERR_RUNNING), "trace already running");
+    assert_string_equal(trace_status_string(TRACE_ERR_IO), "cannot write trace file");
+    assert_string_equal(trace_status_string((trace_status_t)99), "unknown status");
+}
+
+/* =========================================================================
+ * Test runner
+ * ========================================================================= */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        /* Group 1: Lifecycle */
+        cmocka_unit_test_setup_teardown(test_start_and_restart, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_idle_zones_record_nothing, setup, teardown),
+        /* Group 2: Recording and export */
+        cmocka_unit_test_setup_teardown(test_macro_zones_exported, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_ring_overwrites_oldest, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_restart_clears, setup, teardown),
+        /* Group 3: Threads */
+        cmocka_unit_test_setup_teardown(test_threads_get_own_rings, setup, teardown),
+        /* Group 4: Statistics */
+        cmocka_unit_test_setup_teardown(test_stats_totals_sorted, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_stats_with_trace, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_stats_owner_thread_only, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_stats_names_compared_by_content, setup, teardown),
+        /* Group 5: Errors and status strings */
+        cmocka_unit_test_setup_teardown(test_write_errors, setup, teardown),
+        cmocka_unit_test_setup_teardown(test_status_strings, setup, teardown),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
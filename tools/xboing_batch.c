@@ -0,0 +1,223 @@
+/*
+ * xboing_batch.c — multi-core seeded soak runner for level packs.
+ *
+ * Plays every level in a range under many seeds through sim_batch (one
+ * headless game per job, spread over all cores with work stealing) and
+ * prints one summary line per level plus a totals line.  This is the
+ * level-pack release gate: -min-clear makes the exit status fail when
+ * any level's clear rate drops below a threshold.
+ *
+ * Usage:
+ *   ./xboing_batch [-levels-dir DIR] [-first N] [-last N] [-seeds N]
+ *                  [-seed-base S] [-threads N] [-ticks N] [-speed 1-9]
+ *                  [-policy track|idle] [-min-clear PCT]
+ *
+ * Defaults: levels 1-80 from ./levels, 16 seeds starting at 1, one
+ * thread per CPU, 200000 ticks per game, speed 5, track policy.
+ *
+ * Output lines are key=value so runs can be grepped or diffed.  Exit
+ * status is 0 on success, 1 on a usage error, 2 when -min-clear is given
+ * and some level (or a level load) fails it.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "level_system.h"
+#include "parse_util.h"
+#include "sim_batch.h"
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-levels-dir DIR] [-first N] [-last N] [-seeds N]\n"
+            "          [-seed-base S] [-threads N] [-ticks N] [-speed 1-9]\n"
+            "          [-policy track|idle] [-min-clear PCT]\n",
+            argv0);
+}
+
+static double elapsed_seconds(const struct timespec *start, const struct timespec *end)
+{
+    return (double)(end->tv_sec - start->tv_sec) + (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    const char *levels_dir = "levels";
+    int first = 1;
+    int last = LEVEL_MAX_NUM;
+    int seeds = 16;
+    int seed_base = 1;
+    int max_ticks = 200000;
+    int min_clear = -1;
+    sim_policy_t policy = SIM_POLICY_TRACK;
+
+    sim_batch_config_t config;
+    sim_batch_config_init(&config);
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        int ok = 1;
+
+        if (val == NULL)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+
+        if (strcmp(arg, "-levels-dir") == 0)
+        {
+            levels_dir = val;
+        }
+        else if (strcmp(arg, "-first") == 0)
+        {
+            ok = parse_int_in_range(val, 1, LEVEL_MAX_NUM, &first);
+        }
+        else if (strcmp(arg, "-last") == 0)
+        {
+            ok = parse_int_in_range(val, 1, LEVEL_MAX_NUM, &last);
+        }
+        else if (strcmp(arg, "-seeds") == 0)
+        {
+            ok = parse_int_in_range(val, 1, 1000000, &seeds);
+        }
+        else if (strcmp(arg, "-seed-base") == 0)
+        {
+            ok = parse_int_in_range(val, 0, 2147483647, &seed_base);
+        }
+        else if (strcmp(arg, "-threads") == 0)
+        {
+            ok = parse_int_in_range(val, 0, 1024, &config.threads);
+        }
+        else if (strcmp(arg, "-ticks") == 0)
+        {
+            ok = parse_int_in_range(val, 1, 2000000000, &max_ticks);
+        }
+        else if (strcmp(arg, "-speed") == 0)
+        {
+            ok = parse_int_in_range(val, 1, 9, &config.speed_level);
+        }
+        else if (strcmp(arg, "-min-clear") == 0)
+        {
+            ok = parse_int_in_range(val, 0, 100, &min_clear);
+        }
+        else if (strcmp(arg, "-policy") == 0)
+        {
+            if (strcmp(val, "track") == 0)
+            {
+                policy = SIM_POLICY_TRACK;
+            }
+            else if (strcmp(val, "idle") == 0)
+            {
+                policy = SIM_POLICY_IDLE;
+            }
+            else
+            {
+                ok = 0;
+            }
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+
+        if (!ok)
+        {
+            fprintf(stderr, "xboing_batch: bad %s '%s'\n", arg, val);
+            return 1;
+        }
+        i++;
+    }
+
+    if (first > last)
+    {
+        fprintf(stderr, "xboing_batch: -first %d is after -last %d\n", first, last);
+        return 1;
+    }
+    config.max_ticks = (uint64_t)max_ticks;
+
+    sim_batch_status_t st;
+    sim_batch_t *batch = sim_batch_create(&config, &st);
+    if (batch == NULL)
+    {
+        fprintf(stderr, "xboing_batch: %s\n", sim_batch_status_string(st));
+        return 1;
+    }
+
+    for (int level = first; level <= last; level++)
+    {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/level%02d.data", levels_dir, level);
+        for (int s = 0; s < seeds; s++)
+        {
+            st = sim_batch_add_job(batch, path, (uint64_t)seed_base + (uint64_t)s, policy);
+            if (st != SIM_BATCH_OK)
+            {
+                fprintf(stderr, "xboing_batch: %s\n", sim_batch_status_string(st));
+                sim_batch_destroy(batch);
+                return 1;
+            }
+        }
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    st = sim_batch_run(batch);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (st != SIM_BATCH_OK)
+    {
+        fprintf(stderr, "xboing_batch: %s\n", sim_batch_status_string(st));
+        sim_batch_destroy(batch);
+        return 1;
+    }
+
+    int failed = 0;
+    int games = 0;
+    int cleared = 0;
+    unsigned long long ticks = 0;
+    size_t levels = sim_batch_summary_count(batch);
+
+    for (size_t i = 0; i < levels; i++)
+    {
+        sim_batch_summary_t sum;
+        (void)sim_batch_get_summary(batch, i, &sum);
+        printf("level=%s runs=%d cleared=%d game_over=%d timed_out=%d load_errors=%d "
+               "clear_rate=%.3f ticks_to_clear_mean=%.0f ticks_to_clear_max=%llu "
+               "balls_lost_mean=%.2f score_min=%lu score_p50=%lu score_p90=%lu "
+               "score_max=%lu\n",
+               sum.path, sum.runs, sum.cleared, sum.game_over, sum.timed_out, sum.load_errors,
+               sum.clear_rate, sum.ticks_to_clear_mean,
+               (unsigned long long)sum.ticks_to_clear_max, sum.balls_lost_mean, sum.score_min,
+               sum.score_p50, sum.score_p90, sum.score_max);
+
+        games += sum.runs;
+        cleared += sum.cleared;
+        if (min_clear >= 0 &&
+            (sum.load_errors > 0 || sum.clear_rate * 100.0 < (double)min_clear))
+        {
+            failed++;
+        }
+    }
+
+    for (size_t i = 0; i < sim_batch_job_count(batch); i++)
+    {
+        sim_batch_result_t res;
+        if (sim_batch_get_result(batch, i, &res) == SIM_BATCH_OK)
+        {
+            ticks += res.stats.ticks;
+        }
+    }
+
+    double secs = elapsed_seconds(&t0, &t1);
+    printf("total levels=%zu games=%d cleared=%d failed_levels=%d threads=%d elapsed=%.3fs "
+           "games_per_sec=%.1f ticks_per_sec=%.0f\n",
+           levels, games, cleared, failed, sim_batch_threads_used(batch), secs,
+           secs > 0.0 ? (double)games / secs : 0.0, secs > 0.0 ? (double)ticks / secs : 0.0);
+
+    sim_batch_destroy(batch);
+    return failed > 0 ? 2 : 0;
+}
@@ -0,0 +1,373 @@
+/*
+ * xboing_pack.c — builds the xboing.pak asset pack.
+ *
+ * Reads the loose asset directories and writes them into one pack file
+ * (asset_pack.h) that the installed game maps at startup.  Images and
+ * sounds are decoded here, at build time, so the game does no PNG or
+ * WAV decoding at all:
+ *
+ *   images  every .png under DIR, recursively, as RGBA32 pixels keyed
+ *           "images/<path minus .png>" (e.g. "images/balls/ball1")
+ *   sounds  every .wav in DIR, converted to 44100 Hz signed 16-bit
+ *           stereo (the mixer's default device format), keyed
+ *           "sounds/<name minus .wav>"
+ *   fonts   every .ttf in DIR, as shipped, keyed "fonts/<file>"
+ *   levels  every .data in DIR, as shipped, keyed "levels/<file>"
+ *
+ * Usage:
+ *   ./xboing_pack -o OUT [-images DIR] [-sounds DIR] [-fonts DIR]
+ *                 [-levels DIR]
+ *
+ * The output depends only on the input files, so rebuilding from the
+ * same tree gives a byte-identical pack.
+ * Exit status is 0 on success, 1 on a usage error or any file that
+ * cannot be read or converted.
+ */
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include "asset_pack.h"
+
+/* Sound format stored in the pack: MIX_DEFAULT_FORMAT at the default rate. */
+#define PACK_SOUND_FREQ 44100
+#define PACK_SOUND_FORMAT AUDIO_S16SYS
+#define PACK_SOUND_CHANNELS 2
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s -o OUT [-images DIR] [-sounds DIR] [-fonts DIR]\n"
+            "          [-levels DIR]\n",
+            argv0);
+}
+
+/* Returns true if name ends with ext. */
+static bool has_extension(const char *name, const char *ext)
+{
+    size_t len = strlen(name);
+    size_t ext_len = strlen(ext);
+    return len > ext_len && strcmp(name + len - ext_len, ext) == 0;
+}
+
+static bool is_directory(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+/* Add one entry, reporting failures.  Returns true on success. */
+static bool add_entry(asset_pack_writer_t *w, const asset_pack_entry_t *e)
+{
+    asset_pack_status_t st = asset_pack_writer_add(w, e);
+    if (st != ASSET_PACK_OK)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", e->key, asset_pack_status_string(st));
+        return false;
+    }
+    return true;
+}
+
+/* =========================================================================
+ * Per-kind converters
+ * ========================================================================= */
+
+/* Decode a PNG to RGBA32 and add it as ASSET_PACK_PIXELS. */
+static bool add_image(asset_pack_writer_t *w, const char *key, const char *path)
+{
+    SDL_Surface *loaded = IMG_Load(path);
+    if (loaded == NULL)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", path, IMG_GetError());
+        return false;
+    }
+    SDL_Surface *rgba = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (rgba == NULL)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", path, SDL_GetError());
+        return false;
+    }
+
+    asset_pack_entry_t e = {0};
+    e.key = key;
+    e.data = rgba->pixels;
+    e.size = (size_t)rgba->pitch * (size_t)rgba->h;
+    e.kind = ASSET_PACK_PIXELS;
+    e.param[0] = (uint32_t)rgba->w;
+    e.param[1] = (uint32_t)rgba->h;
+    e.param[2] = (uint32_t)rgba->pitch;
+    bool ok = add_entry(w, &e);
+    SDL_FreeSurface(rgba);
+    return ok;
+}
+
+/* Decode a WAV, convert it to the pack sound format, add it as PCM. */
+static bool add_sound(asset_pack_writer_t *w, const char *key, const char *path)
+{
+    SDL_AudioSpec spec;
+    Uint8 *buf = NULL;
+    Uint32 len = 0;
+    if (SDL_LoadWAV(path, &spec, &buf, &len) == NULL)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", path, SDL_GetError());
+        return false;
+    }
+
+    SDL_AudioCVT cvt;
+    if (SDL_BuildAudioCVT(&cvt, spec.format, spec.channels, spec.freq, PACK_SOUND_FORMAT,
+                          PACK_SOUND_CHANNELS, PACK_SOUND_FREQ) < 0)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", path, SDL_GetError());
+        SDL_FreeWAV(buf);
+        return false;
+    }
+    cvt.len = (int)len;
+    cvt.buf = SDL_malloc((size_t)len * (size_t)cvt.len_mult);
+    if (cvt.buf == NULL)
+    {
+        fprintf(stderr, "xboing_pack: %s: out of memory\n", path);
+        SDL_FreeWAV(buf);
+        return false;
+    }
+    memcpy(cvt.buf, buf, len);
+    SDL_FreeWAV(buf);
+    if (SDL_ConvertAudio(&cvt) != 0)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", path, SDL_GetError());
+        SDL_free(cvt.buf);
+        return false;
+    }
+
+    asset_pack_entry_t e = {0};
+    e.key = key;
+    e.data = cvt.buf;
+    e.size = (size_t)cvt.len_cvt;
+    e.kind = ASSET_PACK_PCM;
+    e.param[0] = PACK_SOUND_FREQ;
+    e.param[1] = PACK_SOUND_FORMAT;
+    e.param[2] = PACK_SOUND_CHANNELS;
+    bool ok = add_entry(w, &e);
+    SDL_free(cvt.buf);
+    return ok;
+}
+
+/* Add a file's bytes unchanged as ASSET_PACK_RAW. */
+static bool add_raw(asset_pack_writer_t *w, const char *key, const char *path)
+{
+    size_t size = 0;
+    void *data = SDL_LoadFile(path, &size);
+    if (data == NULL)
+    {
+        fprintf(stderr, "xboing_pack: %s: %s\n", path, SDL_GetError());
+        return false;
+    }
+
+    asset_pack_entry_t e = {0};
+    e.key = key;
+    e.data = data;
+    e.size = size;
+    e.kind = ASSET_PACK_RAW;
+    bool ok = add_entry(w, &e);
+    SDL_free(data);
+    return ok;
+}
+
+/* =========================================================================
+ * Directory walk
+ * ========================================================================= */
+
+typedef bool (*add_fn)(asset_pack_writer_t *w, const char *key, const char *path);
+
+typedef struct
+{
+    const char *prefix;    /* key prefix, e.g. "images/" */
+    const char *extension; /* files to take, e.g. ".png" */
+    bool strip_extension;  /* drop the extension from the key */
+    bool recursive;        /* descend into subdirectories */
+    add_fn add;
+} pack_kind_t;
+
+/*
+ * Add every matching file under dir_path.  rel is the path of dir_path
+ * relative to the kind's root ("" at the root).  Returns the number of
+ * files that failed.
+ */
+static int add_dir(asset_pack_writer_t *w, const pack_kind_t *kind, const char *dir_path,
+                   const char *rel)
+{
+    DIR *dir = opendir(dir_path);
+    if (dir == NULL)
+    {
+        fprintf(stderr, "xboing_pack: cannot open directory '%s'\n", dir_path);
+        return 1;
+    }
+
+    int failures = 0;
+    const struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        const char *name = entry->d_name;
+        if (name[0] == '.')
+        {
+            continue;
+        }
+
+        char path[1024];
+        char sub_rel[ASSET_PACK_MAX_KEY + 1];
+        int n = snprintf(path, sizeof(path), "%s/%s", dir_path, name);
+        int m = snprintf(sub_rel, sizeof(sub_rel), "%s%s%s", rel, rel[0] != '\0' ? "/" : "",
+                         name);
+        if (n < 0 || (size_t)n >= sizeof(path) || m < 0 || (size_t)m >= sizeof(sub_rel))
+        {
+            fprintf(stderr, "xboing_pack: path too long: %s/%s\n", dir_path, name);
+            failures++;
+            continue;
+        }
+
+        if (is_directory(path))
+        {
+            if (kind->recursive)
+            {
+                failures += add_dir(w, kind, path, sub_rel);
+            }
+            continue;
+        }
+        if (!has_extension(name, kind->extension))
+        {
+            continue;
+        }
+
+        size_t key_len = (size_t)m;
+        if (kind->strip_extension)
+        {
+            key_len -= strlen(kind->extension);
+        }
+        char key[ASSET_PACK_MAX_KEY + 1];
+        n = snprintf(key, sizeof(key), "%s%.*s", kind->prefix, (int)key_len, sub_rel);
+        if (n < 0 || (size_t)n >= sizeof(key))
+        {
+            fprintf(stderr, "xboing_pack: key too long: %s%s\n", kind->prefix, sub_rel);
+            failures++;
+            continue;
+        }
+
+        if (!kind->add(w, key, path))
+        {
+            failures++;
+        }
+    }
+
+    closedir(dir);
+    return failures;
+}
+
+/* =========================================================================
+ * Entry point
+ * ========================================================================= */
+
+int main(int argc, char *argv[])
+{
+    static const pack_kind_t kinds[] = {
+        {"images/", ".png", true, true, add_image},
+        {"sounds/", ".wav", true, false, add_sound},
+        {"fonts/", ".ttf", false, false, add_raw},
+        {"levels/", ".data", false, false, add_raw},
+    };
+    const char *dirs[4] = {NULL, NULL, NULL, NULL};
+    const char *out_path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(arg, "-o") == 0)
+        {
+            out_path = argv[++i];
+        }
+        else if (strcmp(arg, "-images") == 0)
+        {
+            dirs[0] = argv[++i];
+        }
+        else if (strcmp(arg, "-sounds") == 0)
+        {
+            dirs[1] = argv[++i];
+        }
+        else if (strcmp(arg, "-fonts") == 0)
+        {
+            dirs[2] = argv[++i];
+        }
+        else if (strcmp(arg, "-levels") == 0)
+        {
+            dirs[3] = argv[++i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (out_path == NULL)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if ((IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG) == 0)
+    {
+        fprintf(stderr, "xboing_pack: IMG_Init: %s\n", IMG_GetError());
+        return 1;
+    }
+
+    asset_pack_status_t st;
+    asset_pack_writer_t *w = asset_pack_writer_create(&st);
+    if (w == NULL)
+    {
+        fprintf(stderr, "xboing_pack: %s\n", asset_pack_status_string(st));
+        IMG_Quit();
+        return 1;
+    }
+
+    int failures = 0;
+    for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++)
+    {
+        if (dirs[k] != NULL)
+        {
+            failures += add_dir(w, &kinds[k], dirs[k], "");
+        }
+    }
+
+    int rc = 0;
+    if (failures > 0)
+    {
+        fprintf(stderr, "xboing_pack: %d file(s) failed; %s not written\n", failures, out_path);
+        rc = 1;
+    }
+    else
+    {
+        st = asset_pack_writer_save(w, out_path);
+        if (st != ASSET_PACK_OK)
+        {
+            fprintf(stderr, "xboing_pack: %s: %s\n", out_path, asset_pack_status_string(st));
+            rc = 1;
+        }
+        else
+        {
+            printf("xboing_pack: wrote %d assets to %s\n", asset_pack_writer_count(w), out_path);
+        }
+    }
+
+    asset_pack_writer_destroy(w);
+    IMG_Quit();
+    return rc;
+}